@@ -693,11 +693,7 @@ describe('VisionCamera - Frame', () => {
     }
   })
 
-  // TODO: Re-enable this test once the Android CameraX ImageAnalysis pipeline surfaces
-  //       dropped-frame notifications. Today HybridFrameOutput.setOnFrameDroppedCallback
-  //       is a no-op on Android (see the `TODO: CameraX does not have a way to figure
-  //       out if a Frame has been dropped` comment in HybridFrameOutput.kt).
-  it.skip('invokes the onFrameDropped callback when the worklet stalls', async () => {
+  it('invokes the onFrameDropped callback when the worklet stalls', async () => {
     const session = await VisionCamera.createCameraSession(false)
     const frameOutput = VisionCamera.createFrameOutput({
       targetResolution: CommonResolutions.HD_16_9,
@@ -745,6 +741,69 @@ describe('VisionCamera - Frame', () => {
     }
   })
 
+  it('reports frame pipeline statistics', async () => {
+    const session = await VisionCamera.createCameraSession(false)
+    const frameOutput = VisionCamera.createFrameOutput({
+      targetResolution: CommonResolutions.HD_16_9,
+      pixelFormat: 'native',
+      enablePreviewSizedOutputBuffers: false,
+      enablePhysicalBufferRotation: false,
+      enableCameraMatrixDelivery: false,
+      allowDeferredStart: false,
+      dropFramesWhileBusy: true,
+    })
+    await session.configure([
+      {
+        input: backDevice,
+        outputs: [{ output: frameOutput, mirrorMode: 'auto' }],
+        constraints: [{ fps: 30 }],
+      },
+    ])
+
+    const initial = frameOutput.getStatistics()
+    expect(initial.framesDelivered).toBe(0)
+    expect(initial.callbackDuration.sampleCount).toBe(0)
+
+    const runtime = workletsProvider.createRuntimeForThread(frameOutput.thread)
+    runtime.setOnFrameCallback(frameOutput, (frame) => {
+      'worklet'
+      const start = Date.now()
+      // Deliberately stall so subsequent frames are dropped.
+      while (Date.now() - start < 100) {
+        // busy wait
+      }
+      frame.dispose()
+    })
+
+    await session.start()
+    try {
+      await waitUntil(
+        () => {
+          const stats = frameOutput.getStatistics()
+          return stats.framesDelivered >= 5 && stats.framesDropped > 0
+        },
+        { timeout: 15_000 },
+      )
+    } finally {
+      runtime.setOnFrameCallback(frameOutput, undefined)
+      await session.stop()
+    }
+
+    // The last Frame Callback may still be running after the session stopped.
+    await waitUntil(() => frameOutput.getStatistics().framesInFlight === 0, {
+      timeout: 5_000,
+    })
+    const stats = frameOutput.getStatistics()
+    expect(stats.framesInFlight).toBe(0)
+    expect(stats.droppedFrames.frameWasLate).toBeGreaterThan(0)
+    expect(stats.callbackDuration.minimum).toBeGreaterThanOrEqual(100)
+    expect(stats.callbackDuration.median).toBeLessThanOrEqual(
+      stats.callbackDuration.p90,
+    )
+    expect(stats.deliveryLatency.sampleCount).toBeGreaterThan(0)
+    expect(stats.frameInterval.average).toBeGreaterThanOrEqual(100)
+  })
+
   // TODO: Re-enable once the Android frame output honors `enablePreviewSizedOutputBuffers`
   //       (today HybridFrameOutput.kt / HybridDepthFrameOutput.kt both have a
   //       `TODO: enablePreviewSizedOutputBuffers is not taken into account here.`).
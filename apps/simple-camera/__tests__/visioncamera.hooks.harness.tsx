@@ -30,6 +30,7 @@ import {
   getUIRotation,
   useCamera,
   useCameraDevice,
+  useFrameOutput,
   useOrientation,
   usePhotoOutput,
   usePreviewOutput,
@@ -643,4 +644,64 @@ describe('VisionCamera - Hooks', () => {
 
     expect(onError).not.toHaveBeenCalled()
   })
+
+  it('processes frames in parallel and delivers onFrameResult in capture order', async () => {
+    const onError = fn<(error: Error) => void>()
+    const onFrameResult = fn<(threadId: number, timestamp: number) => void>()
+
+    function TestCamera(): null {
+      const frameOutput = useFrameOutput({
+        targetResolution: CommonResolutions.VGA_16_9,
+        allowDeferredStart: false,
+        parallelism: 2,
+        onFrame(frame) {
+          'worklet'
+          // Each thread runs its own Worklet Runtime, so this tags every
+          // result with the thread that produced it.
+          const runtime = globalThis as typeof globalThis & {
+            __frameThreadId?: number
+          }
+          runtime.__frameThreadId ??= Math.random()
+          // One thread is slower than the other, so results complete out
+          // of order.
+          const stall = 20 + runtime.__frameThreadId * 60
+          const start = Date.now()
+          while (Date.now() - start < stall) {
+            // busy wait
+          }
+          frame.dispose()
+          return runtime.__frameThreadId
+        },
+        onFrameResult,
+      })
+      useCamera({
+        isActive: true,
+        device: 'back',
+        outputs: [frameOutput],
+        onError,
+      })
+      return null
+    }
+
+    await render(<TestCamera />, { timeout: 10_000 })
+    await waitFor(
+      () => {
+        const error = onError.mock.lastCall?.[0]
+        if (error != null) throw error
+        const threadIds = new Set(
+          onFrameResult.mock.calls.map(([threadId]) => threadId),
+        )
+        expect(onFrameResult.mock.calls.length).toBeGreaterThanOrEqual(10)
+        expect(threadIds.size).toBe(2)
+      },
+      { timeout: 15_000 },
+    )
+
+    const timestamps = onFrameResult.mock.calls.map(
+      ([, timestamp]) => timestamp,
+    )
+    expect(timestamps).toEqual([...timestamps].sort((a, b) => a - b))
+    expect(new Set(timestamps).size).toBe(timestamps.length)
+    expect(onError).not.toHaveBeenCalled()
+  })
 })
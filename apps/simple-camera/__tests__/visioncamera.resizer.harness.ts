@@ -1,3 +1,4 @@
+import { Platform } from 'react-native'
 import {
   afterAll,
   assert,
@@ -13,6 +14,7 @@ import type {
   CameraOrientation,
   Frame,
   MirrorMode,
+  NativeBuffer,
 } from 'react-native-vision-camera'
 import {
   CommonResolutions,
@@ -20,12 +22,17 @@ import {
   VisionCamera,
 } from 'react-native-vision-camera'
 import type {
+  ChannelOrder,
+  DataType,
   GPUFrame,
+  PixelLayout,
+  Rect,
   Resizer,
   ResizerOptions,
   ScaleMode,
 } from 'react-native-vision-camera-resizer'
 import {
+  createMultiResizer,
   createResizer,
   isResizerAvailable,
 } from 'react-native-vision-camera-resizer'
@@ -41,6 +48,54 @@ const outputOrientations = [
 ] satisfies CameraOrientation[]
 const mirrorModes = ['off', 'on'] satisfies MirrorMode[]
 const scaleModes = ['cover', 'contain', 'stretch'] satisfies ScaleMode[]
+const dataTypes = ['uint8', 'int8', 'float16', 'float32'] satisfies DataType[]
+// 'gray' has no RGB values to compare against, it is covered by its own test.
+const channelOrders = [
+  'rgb',
+  'bgr',
+  'rgba',
+  'bgra',
+  'argb',
+] satisfies ChannelOrder[]
+const pixelLayouts = ['interleaved', 'planar'] satisfies PixelLayout[]
+const rotationDegreesByOrientation = {
+  up: 0,
+  right: 90,
+  down: 180,
+  left: 270,
+} satisfies Record<CameraOrientation, number>
+const channelsPerPixel = {
+  rgb: 3,
+  bgr: 3,
+  gray: 1,
+  rgba: 4,
+  bgra: 4,
+  argb: 4,
+} satisfies Record<ChannelOrder, number>
+// Where the red, green and blue values of one pixel are stored, relative to its first value.
+const rgbChannelOffsets = {
+  rgb: [0, 1, 2],
+  bgr: [2, 1, 0],
+  rgba: [0, 1, 2],
+  bgra: [2, 1, 0],
+  argb: [1, 2, 3],
+} satisfies Record<Exclude<ChannelOrder, 'gray'>, number[]>
+const bytesPerValue = {
+  uint8: 1,
+  int8: 1,
+  float16: 2,
+  float32: 4,
+} satisfies Record<DataType, number>
+// Allowed difference to the 'uint8' output, in 0...255 units.
+// Float outputs are not rounded to whole values.
+const valueTolerances = {
+  uint8: 0,
+  int8: 0,
+  float16: 1.3,
+  float32: 1,
+} satisfies Record<DataType, number>
+const IMAGENET_MEAN = [0.485, 0.456, 0.406]
+const IMAGENET_STANDARD_DEVIATION = [0.229, 0.224, 0.225]
 
 // Odd dimensions exercise the final, partial Metal/Vulkan threadgroups.
 const ORACLE_WIDTH = 47
@@ -48,6 +103,13 @@ const ORACLE_HEIGHT = 47
 const FORMAT_WIDTH = 47
 const FORMAT_HEIGHT = 31
 const MAX_SPATIAL_FRAME_ATTEMPTS = 6
+const AREA_OUTPUT_WIDTH = 40
+const AREA_OUTPUT_HEIGHT = 30
+const AREA_DOWNSCALE_FACTOR = 8
+const DYNAMIC_WIDTH = 64
+const DYNAMIC_HEIGHT = 48
+const DYNAMIC_MAX_WIDTH = 128
+const DYNAMIC_MAX_HEIGHT = 96
 
 type RawPixelData = ReturnType<Image['toRawPixelData']>
 type ImagePixelFormat = RawPixelData['pixelFormat']
@@ -241,6 +303,21 @@ describe('VisionCamera - Resizer', () => {
                 expect(resized.dataType).toBe('uint8')
                 expect(resized.pixelLayout).toBe('interleaved')
 
+                const transform = resized.getTransform()
+                expect(transform.rotationDegrees).toBe(
+                  rotationDegreesByOrientation[frame.orientation],
+                )
+                expect(transform.isMirrored).toBe(frame.isMirrored)
+                const outputCenter = new Float32Array([
+                  ORACLE_WIDTH / 2,
+                  ORACLE_HEIGHT / 2,
+                ])
+                resized.convertOutputPointsToFramePoints(outputCenter.buffer)
+                const frameCenterX = frame.width / 2
+                const frameCenterY = frame.height / 2
+                expect(outputCenter[0]).toBeCloseTo(frameCenterX, 1)
+                expect(outputCenter[1]).toBeCloseTo(frameCenterY, 1)
+
                 const gpuPixels = copyUint8Pixels(resized)
                 expectGpuPixelsToMatchReference(
                   gpuPixels,
@@ -270,251 +347,1141 @@ describe('VisionCamera - Resizer', () => {
             }
           }
         } finally {
-          for (const resizer of resizers) {
-            resizer.dispose()
+          for (const resizer of resizers) {
+            resizer.dispose()
+          }
+        }
+      })
+    }
+  }
+
+  it('writes equivalent formats from one real Camera Frame', async (context) => {
+    if (!isResizerAvailable()) {
+      return context.skip(
+        'resizer: GPU resizing is not available on this device',
+      )
+    }
+
+    const baseOptions = {
+      width: FORMAT_WIDTH,
+      height: FORMAT_HEIGHT,
+      scaleMode: 'stretch',
+    } as const
+    const resizers = await createTestResizers([
+      {
+        ...baseOptions,
+        channelOrder: 'rgb',
+        dataType: 'uint8',
+        pixelLayout: 'interleaved',
+      },
+      {
+        ...baseOptions,
+        channelOrder: 'bgr',
+        dataType: 'uint8',
+        pixelLayout: 'interleaved',
+      },
+      {
+        ...baseOptions,
+        channelOrder: 'rgb',
+        dataType: 'uint8',
+        pixelLayout: 'planar',
+      },
+      {
+        ...baseOptions,
+        channelOrder: 'rgb',
+        dataType: 'int8',
+        pixelLayout: 'interleaved',
+      },
+      {
+        ...baseOptions,
+        channelOrder: 'rgb',
+        dataType: 'float16',
+        pixelLayout: 'interleaved',
+      },
+      {
+        ...baseOptions,
+        channelOrder: 'rgb',
+        dataType: 'float32',
+        pixelLayout: 'interleaved',
+      },
+    ])
+    const [
+      rgbResizer,
+      bgrResizer,
+      planarResizer,
+      int8Resizer,
+      float16Resizer,
+      float32Resizer,
+    ] = resizers
+
+    try {
+      if (
+        rgbResizer == null ||
+        bgrResizer == null ||
+        planarResizer == null ||
+        int8Resizer == null ||
+        float16Resizer == null ||
+        float32Resizer == null
+      ) {
+        throw new Error('missing Resizer format test case')
+      }
+
+      await withCapturedFrame(context, backDevice, (capturedFrame) => {
+        const rgbFrame = rgbResizer.resize(capturedFrame)
+        let rgbPixels: Uint8Array
+        try {
+          expect(() => rgbResizer.resize(capturedFrame)).toThrow()
+          expectGpuFrameMetadata(rgbFrame, 'rgb', 'uint8', 'interleaved', 1)
+          rgbPixels = copyUint8Pixels(rgbFrame)
+        } finally {
+          rgbFrame.dispose()
+        }
+        expect(() => rgbFrame.width).toThrow()
+        expect(() => rgbFrame.getPixelBuffer()).toThrow()
+
+        const reusableFrame = rgbResizer.resize(capturedFrame)
+        try {
+          expect(reusableFrame.width).toBe(FORMAT_WIDTH)
+        } finally {
+          reusableFrame.dispose()
+        }
+
+        const bgrPixels = resizeToUint8(
+          bgrResizer,
+          capturedFrame,
+          'bgr',
+          'interleaved',
+        )
+        const planarPixels = resizeToUint8(
+          planarResizer,
+          capturedFrame,
+          'rgb',
+          'planar',
+        )
+        const int8Pixels = resizeToInt8(int8Resizer, capturedFrame)
+        const float16Pixels = resizeToFloat16(float16Resizer, capturedFrame)
+        const float32Pixels = resizeToFloat32(float32Resizer, capturedFrame)
+
+        const pixelCount = FORMAT_WIDTH * FORMAT_HEIGHT
+        expect(rgbPixels).toHaveLength(pixelCount * 3)
+        expect(bgrPixels).toHaveLength(pixelCount * 3)
+        expect(planarPixels).toHaveLength(pixelCount * 3)
+        expect(int8Pixels).toHaveLength(pixelCount * 3)
+        expect(float16Pixels).toHaveLength(pixelCount * 3)
+        expect(float32Pixels).toHaveLength(pixelCount * 3)
+
+        for (let pixel = 0; pixel < pixelCount; pixel++) {
+          for (let channel = 0; channel < 3; channel++) {
+            const interleavedIndex = pixel * 3 + channel
+            const planarIndex = channel * pixelCount + pixel
+            const uint8Value = rgbPixels[interleavedIndex]
+            const int8Value = int8Pixels[interleavedIndex]
+            const float16Value = decodeFloat16(
+              float16Pixels[interleavedIndex] ?? 0,
+            )
+            const float32Value = float32Pixels[interleavedIndex]
+            if (
+              uint8Value == null ||
+              int8Value == null ||
+              float32Value == null
+            ) {
+              throw new Error(`missing output channel at ${interleavedIndex}`)
+            }
+
+            expect(planarPixels[planarIndex]).toBe(uint8Value)
+            expect(int8Value).toBe(uint8Value - 128)
+            expect(
+              Math.abs(float16Value - uint8Value / 255),
+            ).toBeLessThanOrEqual(0.005)
+            expect(
+              Math.abs(float32Value - uint8Value / 255),
+            ).toBeLessThanOrEqual(1 / 255)
+          }
+
+          const index = pixel * 3
+          expect(bgrPixels[index]).toBe(rgbPixels[index + 2])
+          expect(bgrPixels[index + 1]).toBe(rgbPixels[index + 1])
+          expect(bgrPixels[index + 2]).toBe(rgbPixels[index])
+        }
+      })
+    } finally {
+      for (const resizer of resizers) {
+        resizer.dispose()
+      }
+    }
+  })
+
+  it('writes every DataType, ChannelOrder and PixelLayout combination from one real Camera Frame', async (context) => {
+    if (!isResizerAvailable()) {
+      return context.skip(
+        'resizer: GPU resizing is not available on this device',
+      )
+    }
+
+    const baseOptions = {
+      width: FORMAT_WIDTH,
+      height: FORMAT_HEIGHT,
+      scaleMode: 'stretch',
+    } as const
+    const formatCases = dataTypes.flatMap((dataType) =>
+      channelOrders.flatMap((channelOrder) =>
+        pixelLayouts.map((pixelLayout) => ({
+          dataType,
+          channelOrder,
+          pixelLayout,
+        })),
+      ),
+    )
+    const resizers = await createTestResizers([
+      {
+        ...baseOptions,
+        channelOrder: 'rgb',
+        dataType: 'uint8',
+        pixelLayout: 'interleaved',
+      },
+      ...formatCases.map((formatCase) => ({ ...baseOptions, ...formatCase })),
+    ])
+    const [referenceResizer, ...formatResizers] = resizers
+
+    try {
+      if (referenceResizer == null) {
+        throw new Error('missing Resizer test case')
+      }
+
+      await withCapturedFrame(context, backDevice, (capturedFrame) => {
+        const referencePixels = resizeToUint8(
+          referenceResizer,
+          capturedFrame,
+          'rgb',
+          'interleaved',
+        )
+        for (let index = 0; index < formatCases.length; index++) {
+          const formatCase = formatCases[index]
+          const resizer = formatResizers[index]
+          if (formatCase == null || resizer == null) {
+            throw new Error(`missing Resizer format test case at ${index}`)
+          }
+
+          const resized = resizer.resize(capturedFrame)
+          let rgbValues: number[]
+          try {
+            expect(resized.width).toBe(FORMAT_WIDTH)
+            expect(resized.height).toBe(FORMAT_HEIGHT)
+            expect(resized.channelOrder).toBe(formatCase.channelOrder)
+            expect(resized.dataType).toBe(formatCase.dataType)
+            expect(resized.pixelLayout).toBe(formatCase.pixelLayout)
+            const expectedByteLength =
+              FORMAT_WIDTH *
+              FORMAT_HEIGHT *
+              channelsPerPixel[formatCase.channelOrder] *
+              bytesPerValue[formatCase.dataType]
+            expect(resized.getPixelBuffer().byteLength).toBe(expectedByteLength)
+            rgbValues = readRgbValues(resized)
+          } finally {
+            resized.dispose()
+          }
+
+          const tolerance = valueTolerances[formatCase.dataType]
+          for (
+            let valueIndex = 0;
+            valueIndex < referencePixels.length;
+            valueIndex++
+          ) {
+            const difference = Math.abs(
+              (rgbValues[valueIndex] ?? Number.NaN) -
+                (referencePixels[valueIndex] ?? Number.NaN),
+            )
+            expect(difference).toBeLessThanOrEqual(tolerance)
+          }
+        }
+      })
+    } finally {
+      for (const resizer of resizers) {
+        resizer.dispose()
+      }
+    }
+  })
+
+  it("writes luma-only 'gray' and opaque alpha outputs from one real Camera Frame", async (context) => {
+    if (!isResizerAvailable()) {
+      return context.skip(
+        'resizer: GPU resizing is not available on this device',
+      )
+    }
+
+    const baseOptions = {
+      width: FORMAT_WIDTH,
+      height: FORMAT_HEIGHT,
+      scaleMode: 'stretch',
+      dataType: 'uint8',
+      pixelLayout: 'interleaved',
+    } as const
+    const resizers = await createTestResizers([
+      { ...baseOptions, channelOrder: 'rgb' },
+      { ...baseOptions, channelOrder: 'gray' },
+      { ...baseOptions, channelOrder: 'rgba' },
+    ])
+    const [rgbResizer, grayResizer, rgbaResizer] = resizers
+
+    try {
+      if (rgbResizer == null || grayResizer == null || rgbaResizer == null) {
+        throw new Error('missing Resizer test case')
+      }
+
+      await withCapturedFrame(context, backDevice, (capturedFrame) => {
+        const rgbPixels = resizeToUint8(
+          rgbResizer,
+          capturedFrame,
+          'rgb',
+          'interleaved',
+        )
+        const grayPixels = resizeToUint8(
+          grayResizer,
+          capturedFrame,
+          'gray',
+          'interleaved',
+        )
+        const rgbaPixels = resizeToUint8(
+          rgbaResizer,
+          capturedFrame,
+          'rgba',
+          'interleaved',
+        )
+
+        // 'gray' is one luma byte per pixel. It is sampled from the Y plane, so
+        // it only differs from the luma of the clamped 'rgb' output slightly.
+        expect(grayPixels.length).toBe(FORMAT_WIDTH * FORMAT_HEIGHT)
+        const lumaDifference = calculateMeanAbsoluteDifference(
+          grayPixels,
+          toLumas(rgbPixels),
+        )
+        expect(lumaDifference).toBeLessThan(3)
+
+        // 'rgba' is the 'rgb' output with an opaque alpha byte after every pixel.
+        const rgbaColors: number[] = []
+        for (let index = 0; index < rgbaPixels.length; index += 4) {
+          expect(rgbaPixels[index + 3]).toBe(255)
+          rgbaColors.push(
+            rgbaPixels[index] ?? 0,
+            rgbaPixels[index + 1] ?? 0,
+            rgbaPixels[index + 2] ?? 0,
+          )
+        }
+        expect(rgbaColors).toEqual(Array.from(rgbPixels))
+      })
+    } finally {
+      for (const resizer of resizers) {
+        resizer.dispose()
+      }
+    }
+  })
+
+  it('applies normalization and quantization from one real Camera Frame', async (context) => {
+    if (!isResizerAvailable()) {
+      return context.skip(
+        'resizer: GPU resizing is not available on this device',
+      )
+    }
+
+    const baseOptions = {
+      width: FORMAT_WIDTH,
+      height: FORMAT_HEIGHT,
+      scaleMode: 'stretch',
+    } as const
+    const resizers = await createTestResizers([
+      {
+        ...baseOptions,
+        channelOrder: 'rgb',
+        dataType: 'uint8',
+        pixelLayout: 'interleaved',
+      },
+      {
+        ...baseOptions,
+        channelOrder: 'rgb',
+        dataType: 'float32',
+        pixelLayout: 'interleaved',
+        mean: IMAGENET_MEAN,
+        standardDeviation: IMAGENET_STANDARD_DEVIATION,
+      },
+      {
+        ...baseOptions,
+        channelOrder: 'rgb',
+        dataType: 'uint8',
+        pixelLayout: 'interleaved',
+        quantizationScale: 2 / 255,
+        quantizationZeroPoint: 10,
+      },
+      {
+        ...baseOptions,
+        channelOrder: 'rgb',
+        dataType: 'int8',
+        pixelLayout: 'interleaved',
+        mean: [0.5],
+        standardDeviation: [0.5],
+        quantizationScale: 1 / 127,
+        quantizationZeroPoint: 0,
+      },
+    ])
+    const [
+      referenceResizer,
+      normalizedResizer,
+      quantizedResizer,
+      symmetricResizer,
+    ] = resizers
+
+    try {
+      if (
+        referenceResizer == null ||
+        normalizedResizer == null ||
+        quantizedResizer == null ||
+        symmetricResizer == null
+      ) {
+        throw new Error('missing Resizer test case')
+      }
+
+      await withCapturedFrame(context, backDevice, (capturedFrame) => {
+        const referencePixels = resizeToUint8(
+          referenceResizer,
+          capturedFrame,
+          'rgb',
+          'interleaved',
+        )
+
+        const normalizedFrame = normalizedResizer.resize(capturedFrame)
+        let normalizedValues: Float32Array
+        try {
+          normalizedValues = new Float32Array(
+            normalizedFrame.getPixelBuffer(),
+          ).slice()
+        } finally {
+          normalizedFrame.dispose()
+        }
+        const quantizedFrame = quantizedResizer.resize(capturedFrame)
+        let quantizedValues: Uint8Array
+        try {
+          quantizedValues = copyUint8Pixels(quantizedFrame)
+        } finally {
+          quantizedFrame.dispose()
+        }
+        const symmetricFrame = symmetricResizer.resize(capturedFrame)
+        let symmetricValues: Int8Array
+        try {
+          symmetricValues = new Int8Array(
+            symmetricFrame.getPixelBuffer(),
+          ).slice()
+        } finally {
+          symmetricFrame.dispose()
+        }
+
+        for (let index = 0; index < referencePixels.length; index++) {
+          const channel = index % 3
+          const reference = (referencePixels[index] ?? Number.NaN) / 255
+          const mean = IMAGENET_MEAN[channel] ?? 0
+          const standardDeviation = IMAGENET_STANDARD_DEVIATION[channel] ?? 1
+
+          // (x - mean) / standardDeviation, within one uint8 step.
+          const expectedNormalized = (reference - mean) / standardDeviation
+          const normalizedDifference = Math.abs(
+            (normalizedValues[index] ?? Number.NaN) - expectedNormalized,
+          )
+          expect(normalizedDifference).toBeLessThanOrEqual(
+            1 / 255 / standardDeviation,
+          )
+
+          // round(x / (2 / 255)) + 10
+          const expectedQuantized = Math.round((reference * 255) / 2) + 10
+          const quantizedDifference = Math.abs(
+            (quantizedValues[index] ?? Number.NaN) - expectedQuantized,
+          )
+          expect(quantizedDifference).toBeLessThanOrEqual(1)
+
+          // round(((x - 0.5) / 0.5) / (1 / 127)) + 0
+          const expectedSymmetric = Math.round((reference * 2 - 1) * 127)
+          const symmetricDifference = Math.abs(
+            (symmetricValues[index] ?? Number.NaN) - expectedSymmetric,
+          )
+          expect(symmetricDifference).toBeLessThanOrEqual(1)
+        }
+      })
+    } finally {
+      for (const resizer of resizers) {
+        resizer.dispose()
+      }
+    }
+  })
+
+  it('crops, batches and maps output points back into one real Camera Frame', async (context) => {
+    if (!isResizerAvailable()) {
+      return context.skip(
+        'resizer: GPU resizing is not available on this device',
+      )
+    }
+
+    const resizers = await createTestResizers([
+      {
+        width: FORMAT_WIDTH,
+        height: FORMAT_HEIGHT,
+        channelOrder: 'rgb',
+        dataType: 'uint8',
+        scaleMode: 'stretch',
+        pixelLayout: 'interleaved',
+        maxBatchSize: 2,
+      },
+    ])
+    const [resizer] = resizers
+
+    try {
+      if (resizer == null) {
+        throw new Error('missing Resizer test case')
+      }
+
+      await withCapturedFrame(context, backDevice, (capturedFrame) => {
+        const fullRect: Rect = {
+          left: 0,
+          top: 0,
+          right: capturedFrame.width,
+          bottom: capturedFrame.height,
+        }
+        const crop: Rect = {
+          left: Math.round(capturedFrame.width / 4),
+          top: Math.round(capturedFrame.height / 4),
+          right: Math.round((capturedFrame.width * 3) / 4),
+          bottom: Math.round((capturedFrame.height * 3) / 4),
+        }
+        const expectedRotationDegrees =
+          rotationDegreesByOrientation[capturedFrame.orientation]
+
+        const uncroppedPixels = resizeToUint8(
+          resizer,
+          capturedFrame,
+          'rgb',
+          'interleaved',
+        )
+        const fullCropFrame = resizer.resize(capturedFrame, { crop: fullRect })
+        let fullCropPixels: Uint8Array
+        try {
+          fullCropPixels = copyUint8Pixels(fullCropFrame)
+        } finally {
+          fullCropFrame.dispose()
+        }
+        expect(fullCropPixels).toEqual(uncroppedPixels)
+
+        const croppedFrame = resizer.resize(capturedFrame, { crop })
+        let croppedPixels: Uint8Array
+        try {
+          const transform = croppedFrame.getTransform()
+          expectRectToBeCloseTo(transform.crop, crop)
+          expect(transform.rotationDegrees).toBe(expectedRotationDegrees)
+          expect(transform.isMirrored).toBe(capturedFrame.isMirrored)
+          expect(() => croppedFrame.getTransform(1)).toThrow()
+
+          // Stretch maps the output corners onto the crop corners,
+          // in an order that depends on the rotation.
+          const outputPoints = new Float32Array([
+            0,
+            0,
+            FORMAT_WIDTH,
+            0,
+            0,
+            FORMAT_HEIGHT,
+            FORMAT_WIDTH,
+            FORMAT_HEIGHT,
+          ])
+          croppedFrame.convertOutputPointsToFramePoints(outputPoints.buffer)
+          const mappedBounds = getPointBounds(outputPoints)
+          expectRectToBeCloseTo(mappedBounds, crop)
+
+          const oddSizedPoints = new Uint8Array(6)
+          expect(() =>
+            croppedFrame.convertOutputPointsToFramePoints(
+              oddSizedPoints.buffer,
+            ),
+          ).toThrow()
+          croppedPixels = copyUint8Pixels(croppedFrame)
+        } finally {
+          croppedFrame.dispose()
+        }
+        expect(() => croppedFrame.getTransform()).toThrow()
+        expect(croppedPixels).not.toEqual(uncroppedPixels)
+
+        const batchFrame = resizer.resizeBatch(capturedFrame, [crop, fullRect])
+        try {
+          expect(batchFrame.batchSize).toBe(2)
+          const imageByteLength = FORMAT_WIDTH * FORMAT_HEIGHT * 3
+          const batchPixels = copyUint8Pixels(batchFrame)
+          expect(batchPixels).toHaveLength(imageByteLength * 2)
+          const firstImage = batchPixels.slice(0, imageByteLength)
+          const secondImage = batchPixels.slice(imageByteLength)
+          expect(firstImage).toEqual(croppedPixels)
+          expect(secondImage).toEqual(uncroppedPixels)
+
+          expectRectToBeCloseTo(batchFrame.getTransform(0).crop, crop)
+          expectRectToBeCloseTo(batchFrame.getTransform(1).crop, fullRect)
+          expect(() => batchFrame.getTransform(2)).toThrow()
+          expect(() => batchFrame.getTransform(0.5)).toThrow()
+
+          const outputCenter = new Float32Array([
+            FORMAT_WIDTH / 2,
+            FORMAT_HEIGHT / 2,
+          ])
+          batchFrame.convertOutputPointsToFramePoints(outputCenter.buffer, 1)
+          const frameCenterX = capturedFrame.width / 2
+          const frameCenterY = capturedFrame.height / 2
+          expect(outputCenter[0]).toBeCloseTo(frameCenterX, 1)
+          expect(outputCenter[1]).toBeCloseTo(frameCenterY, 1)
+        } finally {
+          batchFrame.dispose()
+        }
+      })
+    } finally {
+      for (const resizer of resizers) {
+        resizer.dispose()
+      }
+    }
+  })
+
+  it("exposes 'native' outputs as a NativeBuffer", async (context) => {
+    if (!isResizerAvailable()) {
+      return context.skip(
+        'resizer: GPU resizing is not available on this device',
+      )
+    }
+    if (Platform.OS !== 'android') {
+      return context.skip("resizer outputBufferType 'native': Android only")
+    }
+
+    const baseOptions = {
+      width: FORMAT_WIDTH,
+      height: FORMAT_HEIGHT,
+      scaleMode: 'stretch',
+    } as const
+    const resizers = await createTestResizers([
+      {
+        ...baseOptions,
+        channelOrder: 'rgb',
+        dataType: 'uint8',
+        pixelLayout: 'interleaved',
+        outputBufferType: 'native',
+      },
+      {
+        ...baseOptions,
+        channelOrder: 'rgb',
+        dataType: 'uint8',
+        pixelLayout: 'interleaved',
+      },
+    ])
+    const [nativeResizer, cpuResizer] = resizers
+
+    try {
+      if (nativeResizer == null || cpuResizer == null) {
+        throw new Error('missing Resizer test case')
+      }
+
+      await withCapturedFrame(context, backDevice, (capturedFrame) => {
+        const nativeFrame = nativeResizer.resize(capturedFrame)
+        let nativeBuffer: NativeBuffer
+        try {
+          expect(() => nativeFrame.getPixelBuffer()).toThrow()
+          nativeBuffer = nativeFrame.getNativeBuffer()
+        } finally {
+          nativeFrame.dispose()
+        }
+        try {
+          expect(nativeBuffer.pointer).not.toBe(0n)
+          // The NativeBuffer keeps the only output buffer checked out.
+          expect(() => nativeResizer.resize(capturedFrame)).toThrow()
+        } finally {
+          nativeBuffer.release()
+        }
+
+        const reusedFrame = nativeResizer.resize(capturedFrame)
+        try {
+          expect(reusedFrame.width).toBe(FORMAT_WIDTH)
+        } finally {
+          reusedFrame.dispose()
+        }
+
+        const cpuFrame = cpuResizer.resize(capturedFrame)
+        try {
+          expect(() => cpuFrame.getNativeBuffer()).toThrow()
+        } finally {
+          cpuFrame.dispose()
+        }
+      })
+    } finally {
+      for (const resizer of resizers) {
+        resizer.dispose()
+      }
+    }
+  })
+
+  it("exposes 'texture' outputs as a NativeBuffer and a pixel buffer", async (context) => {
+    if (!isResizerAvailable()) {
+      return context.skip(
+        'resizer: GPU resizing is not available on this device',
+      )
+    }
+
+    // Textures are copied as-is, so only the platform's native texel layout is accepted.
+    const textureChannelOrder: ChannelOrder =
+      Platform.OS === 'android' ? 'rgba' : 'bgra'
+    const baseOptions = {
+      width: FORMAT_WIDTH,
+      height: FORMAT_HEIGHT,
+      channelOrder: textureChannelOrder,
+      dataType: 'uint8',
+      pixelLayout: 'interleaved',
+      scaleMode: 'stretch',
+    } as const
+    let didRejectRgb = false
+    try {
+      const rgbResizer = await createTestResizer({
+        ...baseOptions,
+        channelOrder: 'rgb',
+        outputBufferType: 'texture',
+      })
+      rgbResizer.dispose()
+    } catch {
+      didRejectRgb = true
+    }
+    expect(didRejectRgb).toBe(true)
+
+    const resizers = await createTestResizers([
+      { ...baseOptions, outputBufferType: 'texture' },
+      baseOptions,
+    ])
+    const [textureResizer, cpuResizer] = resizers
+
+    try {
+      if (textureResizer == null || cpuResizer == null) {
+        throw new Error('missing Resizer test case')
+      }
+
+      await withCapturedFrame(context, backDevice, (capturedFrame) => {
+        const cpuPixels = resizeToUint8(
+          cpuResizer,
+          capturedFrame,
+          textureChannelOrder,
+          'interleaved',
+        )
+
+        const textureFrame = textureResizer.resize(capturedFrame)
+        let nativeBuffer: NativeBuffer
+        try {
+          expectGpuFrameMetadata(
+            textureFrame,
+            textureChannelOrder,
+            'uint8',
+            'interleaved',
+            1,
+          )
+          // The texture is a copy of the pixel buffer, which stays readable.
+          expect(copyUint8Pixels(textureFrame)).toEqual(cpuPixels)
+          nativeBuffer = textureFrame.getNativeBuffer()
+        } finally {
+          textureFrame.dispose()
+        }
+        try {
+          expect(nativeBuffer.pointer).not.toBe(0n)
+          // The NativeBuffer keeps the only output buffer checked out.
+          expect(() => textureResizer.resize(capturedFrame)).toThrow()
+        } finally {
+          nativeBuffer.release()
+        }
+
+        // A texture has a fixed size.
+        expect(() =>
+          textureResizer.resize(capturedFrame, { width: FORMAT_WIDTH - 1 }),
+        ).toThrow()
+      })
+    } finally {
+      for (const resizer of resizers) {
+        resizer.dispose()
+      }
+    }
+  })
+
+  it('reports import cache statistics and stage timings after resizing one real Camera Frame', async (context) => {
+    if (!isResizerAvailable()) {
+      return context.skip(
+        'resizer: GPU resizing is not available on this device',
+      )
+    }
+
+    const resizer = await createTestResizer({
+      width: FORMAT_WIDTH,
+      height: FORMAT_HEIGHT,
+      scaleMode: 'stretch',
+      channelOrder: 'rgb',
+      dataType: 'uint8',
+      pixelLayout: 'interleaved',
+      enableProfiling: true,
+    })
+    let isResizerDisposed = false
+
+    try {
+      await withCapturedFrame(context, backDevice, (frame) => {
+        // Resizing the same buffer twice imports it once, then re-uses it.
+        for (let i = 0; i < 2; i++) {
+          const gpuFrame = resizer.resize(frame)
+          gpuFrame.dispose()
+        }
+
+        const statistics = resizer.getStatistics()
+        if (Platform.OS === 'android') {
+          const importCache = statistics.importCache
+          assert.exists(importCache, 'no import cache statistics')
+          expect(importCache.misses).toBeGreaterThanOrEqual(1)
+          expect(importCache.hits).toBeGreaterThanOrEqual(1)
+          expect(importCache.size).toBeGreaterThanOrEqual(1)
+          expect(importCache.size).toBeLessThanOrEqual(importCache.capacity)
+
+          const timings = statistics.timings
+          assert.exists(timings, 'no stage timings')
+          const cpuStages = [
+            timings.queryProperties,
+            timings.importImage,
+            timings.record,
+            timings.submit,
+            timings.wait,
+          ]
+          // GPU stages are only reported if the GPU supports timestamps.
+          const gpuStages = [timings.gpuFill, timings.gpuDispatch].filter(
+            (stage) => stage != null,
+          )
+          for (const stage of cpuStages) {
+            expect(stage.sampleCount).toBe(2)
+          }
+          for (const stage of [...cpuStages, ...gpuStages]) {
+            expect(stage.p50).toBeGreaterThanOrEqual(0)
+            expect(stage.p95).toBeGreaterThanOrEqual(stage.p50)
+            expect(stage.p99).toBeGreaterThanOrEqual(stage.p95)
+          }
+        } else {
+          // CVMetalTextureCache does not expose any statistics.
+          expect(statistics.importCache).toBeUndefined()
+          expect(statistics.timings).toBeUndefined()
+        }
+      })
+
+      resizer.dispose()
+      isResizerDisposed = true
+      expect(() => resizer.getStatistics()).toThrow()
+    } finally {
+      if (!isResizerDisposed) {
+        resizer.dispose()
+      }
+    }
+  })
+  it('resizes one real Camera Frame into several outputs with a MultiResizer', async (context) => {
+    if (!isResizerAvailable()) {
+      return context.skip(
+        'resizer: GPU resizing is not available on this device',
+      )
+    }
+
+    const targets = [
+      {
+        width: FORMAT_WIDTH,
+        height: FORMAT_HEIGHT,
+        scaleMode: 'stretch',
+        channelOrder: 'rgb',
+        dataType: 'uint8',
+        pixelLayout: 'interleaved',
+      },
+      {
+        width: ORACLE_WIDTH,
+        height: ORACLE_HEIGHT,
+        scaleMode: 'cover',
+        channelOrder: 'bgr',
+        dataType: 'float32',
+        pixelLayout: 'planar',
+      },
+    ] satisfies ResizerOptions[]
+    const multiResizer = await withTimeout(
+      createMultiResizer(targets),
+      15_000,
+      'create MultiResizer',
+    )
+    let isMultiResizerDisposed = false
+    let resizers: Resizer[] = []
+
+    try {
+      // Every output of the MultiResizer must match a standalone Resizer with the same options.
+      resizers = await createTestResizers(targets)
+      await withCapturedFrame(context, backDevice, async (capturedFrame) => {
+        const expectedPixels = resizers.map((resizer) => {
+          const resized = resizer.resize(capturedFrame)
+          try {
+            return copyUint8Pixels(resized)
+          } finally {
+            resized.dispose()
+          }
+        })
+
+        const outputs = multiResizer.resize(capturedFrame)
+        try {
+          expect(outputs.length).toBe(targets.length)
+          for (let index = 0; index < targets.length; index++) {
+            const output = outputs[index]
+            const target = targets[index]
+            assert.exists(output, `missing MultiResizer output ${index}`)
+            assert.exists(target, `missing MultiResizer target ${index}`)
+            expect(output.width).toBe(target.width)
+            expect(output.height).toBe(target.height)
+            expect(output.channelOrder).toBe(target.channelOrder)
+            expect(output.dataType).toBe(target.dataType)
+            expect(output.pixelLayout).toBe(target.pixelLayout)
+            expect(copyUint8Pixels(output)).toEqual(expectedPixels[index])
+          }
+        } finally {
+          for (const output of outputs) {
+            output.dispose()
+          }
+        }
+
+        const asyncOutputs = await withTimeout(
+          multiResizer.resizeAsync(capturedFrame),
+          15_000,
+          'resize Camera Frame with MultiResizer.resizeAsync()',
+        )
+        try {
+          expect(asyncOutputs.length).toBe(targets.length)
+          for (let index = 0; index < targets.length; index++) {
+            const output = asyncOutputs[index]
+            assert.exists(output, `missing async MultiResizer output ${index}`)
+            expect(copyUint8Pixels(output)).toEqual(expectedPixels[index])
+          }
+        } finally {
+          for (const output of asyncOutputs) {
+            output.dispose()
           }
         }
       })
+
+      multiResizer.dispose()
+      isMultiResizerDisposed = true
+      expect(() => multiResizer.getStatistics()).toThrow()
+    } finally {
+      for (const resizer of resizers) {
+        resizer.dispose()
+      }
+      if (!isMultiResizerDisposed) {
+        multiResizer.dispose()
+      }
     }
-  }
+  })
 
-  it('writes equivalent formats from one real Camera Frame', async (context) => {
+  it('computes luma statistics and motion for one real Camera Frame', async (context) => {
     if (!isResizerAvailable()) {
       return context.skip(
         'resizer: GPU resizing is not available on this device',
       )
     }
 
-    const baseOptions = {
-      width: FORMAT_WIDTH,
-      height: FORMAT_HEIGHT,
+    const options = {
+      width: 64,
+      height: 48,
       scaleMode: 'stretch',
+      channelOrder: 'rgb',
+      dataType: 'uint8',
+      pixelLayout: 'interleaved',
     } as const
-    const resizers = await createTestResizers([
-      {
-        ...baseOptions,
-        channelOrder: 'rgb',
-        dataType: 'uint8',
-        pixelLayout: 'interleaved',
-      },
-      {
-        ...baseOptions,
-        channelOrder: 'bgr',
-        dataType: 'uint8',
-        pixelLayout: 'interleaved',
-      },
-      {
-        ...baseOptions,
-        channelOrder: 'rgb',
-        dataType: 'uint8',
-        pixelLayout: 'planar',
-      },
-      {
-        ...baseOptions,
-        channelOrder: 'rgb',
-        dataType: 'int8',
-        pixelLayout: 'interleaved',
-      },
-      {
-        ...baseOptions,
-        channelOrder: 'rgb',
-        dataType: 'float16',
-        pixelLayout: 'interleaved',
-      },
-      {
-        ...baseOptions,
-        channelOrder: 'rgb',
-        dataType: 'float32',
-        pixelLayout: 'interleaved',
-      },
-    ])
-    const [
-      rgbResizer,
-      bgrResizer,
-      planarResizer,
-      int8Resizer,
-      float16Resizer,
-      float32Resizer,
-    ] = resizers
+    const statisticsResizer = await createTestResizer({
+      ...options,
+      enableFrameStatistics: true,
+    })
+    const plainResizer = await createTestResizer(options)
 
     try {
-      if (
-        rgbResizer == null ||
-        bgrResizer == null ||
-        planarResizer == null ||
-        int8Resizer == null ||
-        float16Resizer == null ||
-        float32Resizer == null
-      ) {
-        throw new Error('missing Resizer format test case')
-      }
-
-      const session = await VisionCamera.createCameraSession(false)
-      const frameOutput = VisionCamera.createFrameOutput({
-        targetResolution: CommonResolutions.VGA_4_3,
-        pixelFormat: 'yuv',
-        enablePreviewSizedOutputBuffers: false,
-        enablePhysicalBufferRotation: false,
-        enableCameraMatrixDelivery: false,
-        allowDeferredStart: false,
-        dropFramesWhileBusy: true,
-      })
-      frameOutput.outputOrientation = 'up'
-      await session.configure([
-        {
-          input: backDevice,
-          outputs: [{ output: frameOutput, mirrorMode: 'off' }],
-          constraints: [],
-        },
-      ])
-
-      const receivedFrame = deferred<Frame>()
-      const sessionFailed = deferred<never>()
-      const errorSubscription = session.addOnErrorListener(sessionFailed.reject)
-      const runtime = workletsProvider.createRuntimeForThread(
-        frameOutput.thread,
-      )
-      const didCapture = createSynchronizable(false)
-      const framesSeen = createSynchronizable(0)
-      let isWaitingForFrame = true
-      const receiveFrame = (frame: Frame) => {
-        if (isWaitingForFrame) {
-          isWaitingForFrame = false
-          receivedFrame.resolve(frame)
-        } else {
-          frame.dispose()
+      await withCapturedFrame(context, backDevice, (capturedFrame) => {
+        const firstFrame = statisticsResizer.resize(capturedFrame)
+        const firstStatistics = firstFrame.frameStatistics
+        const firstPixels = new Uint8Array(firstFrame.getPixelBuffer())
+        assert.exists(firstStatistics, 'no frame statistics')
+        expect(firstStatistics.thumbnail.length).toBe(256)
+        expect(firstStatistics.motion).toBeUndefined()
+        expect(firstStatistics.meanLuma).toBeGreaterThanOrEqual(0)
+        expect(firstStatistics.meanLuma).toBeLessThanOrEqual(255)
+        for (const cell of firstStatistics.thumbnail) {
+          expect(cell).toBeGreaterThanOrEqual(0)
+          expect(cell).toBeLessThanOrEqual(255)
         }
-      }
-      const reportFrameError = (message: string) => {
-        receivedFrame.reject(new Error(message))
-      }
-      runtime.setOnFrameCallback(frameOutput, (frame) => {
-        'worklet'
-        const frameNumber = framesSeen.getBlocking()
-        framesSeen.setBlocking(frameNumber + 1)
-        if (frameNumber < 2) {
-          frame.dispose()
-          return
-        }
-        if (didCapture.getBlocking()) {
-          frame.dispose()
-          return
-        }
-        didCapture.setBlocking(true)
-        try {
-          scheduleOnRN(receiveFrame, frame)
-        } catch (error) {
-          frame.dispose()
-          scheduleOnRN(reportFrameError, String(error))
-        }
-      })
 
-      let didStart = false
-      let frame: Frame | undefined
-      try {
-        await session.start()
-        didStart = true
-        frame = await Promise.race([
-          withTimeout(
-            receivedFrame.promise,
-            15_000,
-            'receive Camera Frame for Resizer format tests',
-          ),
-          sessionFailed.promise,
-        ])
-        runtime.setOnFrameCallback(frameOutput, undefined)
-        if (!frame.hasNativeBuffer) {
-          return context.skip(
-            'resizer: Camera Frame does not expose a native GPU buffer',
-          )
-        }
-        const capturedFrame = frame
+        // The mean luma matches the mean luma of the written pixels, up to per-pixel rounding.
+        const lumas = toLumas(firstPixels)
+        const expectedMeanLuma =
+          lumas.reduce((sum, luma) => sum + luma, 0) / lumas.length
+        expect(firstStatistics.meanLuma).toBeCloseTo(expectedMeanLuma, 0)
+        firstFrame.dispose()
+        expect(firstFrame.frameStatistics).toBeUndefined()
+
+        // The same buffer resized again produces the same thumbnail.
+        const secondFrame = statisticsResizer.resize(capturedFrame)
+        const secondStatistics = secondFrame.frameStatistics
+        assert.exists(secondStatistics, 'no frame statistics')
+        expect(secondStatistics.thumbnail).toEqual(firstStatistics.thumbnail)
+        expect(secondStatistics.motion).toBe(0)
+        secondFrame.dispose()
+
+        const plainFrame = plainResizer.resize(capturedFrame)
+        expect(plainFrame.frameStatistics).toBeUndefined()
+        plainFrame.dispose()
+      })
+    } finally {
+      statisticsResizer.dispose()
+      plainResizer.dispose()
+    }
+  })
 
-        const rgbFrame = rgbResizer.resize(capturedFrame)
-        let rgbPixels: Uint8Array
-        try {
-          expect(() => rgbResizer.resize(capturedFrame)).toThrow()
-          expectGpuFrameMetadata(rgbFrame, 'rgb', 'uint8', 'interleaved', 1)
-          rgbPixels = copyUint8Pixels(rgbFrame)
-        } finally {
-          rgbFrame.dispose()
-        }
-        expect(() => rgbFrame.width).toThrow()
-        expect(() => rgbFrame.getPixelBuffer()).toThrow()
+  it("averages the covered input area with filter 'area'", async (context) => {
+    if (!isResizerAvailable()) {
+      return context.skip(
+        'resizer: GPU resizing is not available on this device',
+      )
+    }
 
-        const reusableFrame = rgbResizer.resize(capturedFrame)
-        try {
-          expect(reusableFrame.width).toBe(FORMAT_WIDTH)
-        } finally {
-          reusableFrame.dispose()
-        }
+    const outputOptions = {
+      width: AREA_OUTPUT_WIDTH,
+      height: AREA_OUTPUT_HEIGHT,
+      scaleMode: 'stretch',
+      channelOrder: 'rgb',
+      dataType: 'uint8',
+      pixelLayout: 'interleaved',
+    } as const
+    const resizers = await createTestResizers([
+      { ...outputOptions, filter: 'bilinear' },
+      { ...outputOptions, filter: 'area' },
+      // Every reference pixel averages one AREA_DOWNSCALE_FACTOR x AREA_DOWNSCALE_FACTOR block of this output.
+      {
+        ...outputOptions,
+        width: AREA_OUTPUT_WIDTH * AREA_DOWNSCALE_FACTOR,
+        height: AREA_OUTPUT_HEIGHT * AREA_DOWNSCALE_FACTOR,
+      },
+    ])
+    const [bilinearResizer, areaResizer, fullResizer] = resizers
+    assert.exists(bilinearResizer, 'bilinear Resizer was not created')
+    assert.exists(areaResizer, 'area Resizer was not created')
+    assert.exists(fullResizer, 'full-size Resizer was not created')
 
-        const bgrPixels = resizeToUint8(
-          bgrResizer,
+    try {
+      await withCapturedFrame(context, backDevice, (capturedFrame) => {
+        const reference = boxDownscaleRgb(
+          resizeToUint8(fullResizer, capturedFrame, 'rgb', 'interleaved'),
+          AREA_OUTPUT_WIDTH * AREA_DOWNSCALE_FACTOR,
+          AREA_OUTPUT_HEIGHT * AREA_DOWNSCALE_FACTOR,
+          AREA_DOWNSCALE_FACTOR,
+        )
+        const bilinearPixels = resizeToUint8(
+          bilinearResizer,
           capturedFrame,
-          'bgr',
+          'rgb',
           'interleaved',
         )
-        const planarPixels = resizeToUint8(
-          planarResizer,
+        const areaPixels = resizeToUint8(
+          areaResizer,
           capturedFrame,
           'rgb',
-          'planar',
+          'interleaved',
         )
-        const int8Pixels = resizeToInt8(int8Resizer, capturedFrame)
-        const float16Pixels = resizeToFloat16(float16Resizer, capturedFrame)
-        const float32Pixels = resizeToFloat32(float32Resizer, capturedFrame)
 
-        const pixelCount = FORMAT_WIDTH * FORMAT_HEIGHT
-        expect(rgbPixels).toHaveLength(pixelCount * 3)
-        expect(bgrPixels).toHaveLength(pixelCount * 3)
-        expect(planarPixels).toHaveLength(pixelCount * 3)
-        expect(int8Pixels).toHaveLength(pixelCount * 3)
-        expect(float16Pixels).toHaveLength(pixelCount * 3)
-        expect(float32Pixels).toHaveLength(pixelCount * 3)
+        // A single bilinear tap skips most of the input each output pixel covers, the area filter spreads 4x4 taps over it.
+        const bilinearDifference = calculateMeanAbsoluteDifference(
+          bilinearPixels,
+          reference,
+        )
+        const areaDifference = calculateMeanAbsoluteDifference(
+          areaPixels,
+          reference,
+        )
+        expect(areaDifference).toBeLessThan(8)
+        expect(areaDifference).toBeLessThanOrEqual(bilinearDifference)
+      })
+    } finally {
+      for (const resizer of resizers) {
+        resizer.dispose()
+      }
+    }
+  })
 
-        for (let pixel = 0; pixel < pixelCount; pixel++) {
-          for (let channel = 0; channel < 3; channel++) {
-            const interleavedIndex = pixel * 3 + channel
-            const planarIndex = channel * pixelCount + pixel
-            const uint8Value = rgbPixels[interleavedIndex]
-            const int8Value = int8Pixels[interleavedIndex]
-            const float16Value = decodeFloat16(
-              float16Pixels[interleavedIndex] ?? 0,
-            )
-            const float32Value = float32Pixels[interleavedIndex]
-            if (
-              uint8Value == null ||
-              int8Value == null ||
-              float32Value == null
-            ) {
-              throw new Error(`missing output channel at ${interleavedIndex}`)
-            }
+  it('resizes one real Camera Frame to per-call output sizes up to maxWidth/maxHeight', async (context) => {
+    if (!isResizerAvailable()) {
+      return context.skip(
+        'resizer: GPU resizing is not available on this device',
+      )
+    }
 
-            expect(planarPixels[planarIndex]).toBe(uint8Value)
-            expect(int8Value).toBe(uint8Value - 128)
-            expect(
-              Math.abs(float16Value - uint8Value / 255),
-            ).toBeLessThanOrEqual(0.005)
-            expect(
-              Math.abs(float32Value - uint8Value / 255),
-            ).toBeLessThanOrEqual(1 / 255)
-          }
+    const outputOptions = {
+      scaleMode: 'stretch',
+      channelOrder: 'rgb',
+      dataType: 'uint8',
+      pixelLayout: 'interleaved',
+    } as const
+    const resizers = await createTestResizers([
+      {
+        ...outputOptions,
+        width: DYNAMIC_WIDTH,
+        height: DYNAMIC_HEIGHT,
+        maxWidth: DYNAMIC_MAX_WIDTH,
+        maxHeight: DYNAMIC_MAX_HEIGHT,
+      },
+      // References created with the sizes the dynamic Resizer is asked for.
+      { ...outputOptions, width: 96, height: 72 },
+      // 50 is not a multiple of the 4 pixels one invocation packs for 'uint8'.
+      { ...outputOptions, width: 50, height: 40 },
+    ])
+    const [dynamicResizer, grownResizer, unalignedResizer] = resizers
+    assert.exists(dynamicResizer, 'dynamic Resizer was not created')
+    assert.exists(grownResizer, '96x72 Resizer was not created')
+    assert.exists(unalignedResizer, '50x40 Resizer was not created')
 
-          const index = pixel * 3
-          expect(bgrPixels[index]).toBe(rgbPixels[index + 2])
-          expect(bgrPixels[index + 1]).toBe(rgbPixels[index + 1])
-          expect(bgrPixels[index + 2]).toBe(rgbPixels[index])
+    try {
+      await withCapturedFrame(context, backDevice, (capturedFrame) => {
+        const resizeWithSize = (width: number, height: number) => {
+          const resized = dynamicResizer.resize(capturedFrame, {
+            width: width,
+            height: height,
+          })
+          const expectedByteLength = width * height * channelsPerPixel.rgb
+          try {
+            expect(resized.width).toBe(width)
+            expect(resized.height).toBe(height)
+            expect(resized.getPixelBuffer().byteLength).toBe(expectedByteLength)
+            return copyUint8Pixels(resized)
+          } finally {
+            resized.dispose()
+          }
         }
-      } finally {
-        isWaitingForFrame = false
-        runtime.setOnFrameCallback(frameOutput, undefined)
-        frame?.dispose()
-        errorSubscription.remove()
-        if (didStart) {
-          await session.stop()
+
+        // Growing past the configured size must produce the same pixels as a Resizer created with that size.
+        const grownPixels = resizeWithSize(96, 72)
+        expect(grownPixels).toEqual(
+          resizeToUint8(grownResizer, capturedFrame, 'rgb', 'interleaved'),
+        )
+        const unalignedPixels = resizeWithSize(50, 40)
+        expect(unalignedPixels).toEqual(
+          resizeToUint8(unalignedResizer, capturedFrame, 'rgb', 'interleaved'),
+        )
+        resizeWithSize(DYNAMIC_MAX_WIDTH, DYNAMIC_MAX_HEIGHT)
+
+        // Calls without a size keep using the configured one.
+        const defaultFrame = dynamicResizer.resize(capturedFrame)
+        try {
+          expect(defaultFrame.width).toBe(DYNAMIC_WIDTH)
+          expect(defaultFrame.height).toBe(DYNAMIC_HEIGHT)
+        } finally {
+          defaultFrame.dispose()
         }
-      }
+
+        const tooWide = DYNAMIC_MAX_WIDTH + 1
+        expect(() =>
+          dynamicResizer.resize(capturedFrame, { width: tooWide }),
+        ).toThrow()
+        expect(() =>
+          dynamicResizer.resize(capturedFrame, { height: 0 }),
+        ).toThrow()
+        expect(() => grownResizer.resize(capturedFrame, { width: 97 })).toThrow()
+      })
     } finally {
       for (const resizer of resizers) {
         resizer.dispose()
@@ -548,6 +1515,97 @@ async function createTestResizers(
   }
 }
 
+// Streams `device` into a YUV Frame Output and runs `body` with one Frame, then
+// tears the session down again. Skips the test if the Frame has no GPU buffer.
+async function withCapturedFrame(
+  context: { skip: (reason: string) => void },
+  device: CameraDevice,
+  body: (frame: Frame) => void | Promise<void>,
+): Promise<void> {
+  const session = await VisionCamera.createCameraSession(false)
+  const frameOutput = VisionCamera.createFrameOutput({
+    targetResolution: CommonResolutions.VGA_4_3,
+    pixelFormat: 'yuv',
+    enablePreviewSizedOutputBuffers: false,
+    enablePhysicalBufferRotation: false,
+    enableCameraMatrixDelivery: false,
+    allowDeferredStart: false,
+    dropFramesWhileBusy: true,
+  })
+  frameOutput.outputOrientation = 'up'
+  await session.configure([
+    {
+      input: device,
+      outputs: [{ output: frameOutput, mirrorMode: 'off' }],
+      constraints: [],
+    },
+  ])
+
+  const receivedFrame = deferred<Frame>()
+  const sessionFailed = deferred<never>()
+  const errorSubscription = session.addOnErrorListener(sessionFailed.reject)
+  const runtime = workletsProvider.createRuntimeForThread(frameOutput.thread)
+  const didCapture = createSynchronizable(false)
+  const framesSeen = createSynchronizable(0)
+  let isWaitingForFrame = true
+  const receiveFrame = (frame: Frame) => {
+    if (isWaitingForFrame) {
+      isWaitingForFrame = false
+      receivedFrame.resolve(frame)
+    } else {
+      frame.dispose()
+    }
+  }
+  const reportFrameError = (message: string) => {
+    receivedFrame.reject(new Error(message))
+  }
+  runtime.setOnFrameCallback(frameOutput, (frame) => {
+    'worklet'
+    const frameNumber = framesSeen.getBlocking()
+    framesSeen.setBlocking(frameNumber + 1)
+    if (frameNumber < 2) {
+      frame.dispose()
+      return
+    }
+    if (didCapture.getBlocking()) {
+      frame.dispose()
+      return
+    }
+    didCapture.setBlocking(true)
+    try {
+      scheduleOnRN(receiveFrame, frame)
+    } catch (error) {
+      frame.dispose()
+      scheduleOnRN(reportFrameError, String(error))
+    }
+  })
+
+  let didStart = false
+  let frame: Frame | undefined
+  try {
+    await session.start()
+    didStart = true
+    frame = await Promise.race([
+      withTimeout(receivedFrame.promise, 15_000, 'receive Camera Frame'),
+      sessionFailed.promise,
+    ])
+    runtime.setOnFrameCallback(frameOutput, undefined)
+    if (!frame.hasNativeBuffer) {
+      context.skip('resizer: Camera Frame does not expose a native GPU buffer')
+      return
+    }
+    await body(frame)
+  } finally {
+    isWaitingForFrame = false
+    runtime.setOnFrameCallback(frameOutput, undefined)
+    frame?.dispose()
+    errorSubscription.remove()
+    if (didStart) {
+      await session.stop()
+    }
+  }
+}
+
 function convertFrameToUprightPixels(frame: Frame): RawPixelData {
   const convertedImage = HybridFrameConverter.convertFrameToImage(frame)
   try {
@@ -718,6 +1776,35 @@ function readImageRgb(
   return [r, g, b]
 }
 
+function boxDownscaleRgb(
+  pixels: Uint8Array,
+  width: number,
+  height: number,
+  factor: number,
+): Uint8Array {
+  const outputWidth = width / factor
+  const outputHeight = height / factor
+  const result = new Uint8Array(outputWidth * outputHeight * 3)
+  for (let y = 0; y < outputHeight; y++) {
+    for (let x = 0; x < outputWidth; x++) {
+      for (let channel = 0; channel < 3; channel++) {
+        let sum = 0
+        for (let blockY = 0; blockY < factor; blockY++) {
+          for (let blockX = 0; blockX < factor; blockX++) {
+            const sourceIndex =
+              ((y * factor + blockY) * width + (x * factor + blockX)) * 3
+            sum += pixels[sourceIndex + channel] ?? 0
+          }
+        }
+        result[(y * outputWidth + x) * 3 + channel] = Math.round(
+          sum / (factor * factor),
+        )
+      }
+    }
+  }
+  return result
+}
+
 function copyUint8Pixels(frame: GPUFrame): Uint8Array {
   return new Uint8Array(frame.getPixelBuffer()).slice()
 }
@@ -725,7 +1812,7 @@ function copyUint8Pixels(frame: GPUFrame): Uint8Array {
 function resizeToUint8(
   resizer: Resizer,
   frame: Parameters<Resizer['resize']>[0],
-  channelOrder: 'rgb' | 'bgr',
+  channelOrder: ChannelOrder,
   pixelLayout: 'interleaved' | 'planar',
 ): Uint8Array {
   const resized = resizer.resize(frame)
@@ -776,9 +1863,79 @@ function resizeToFloat32(
   }
 }
 
+function readRgbValues(frame: GPUFrame): number[] {
+  const buffer = frame.getPixelBuffer()
+  let values: ArrayLike<number>
+  let toUint8Range: (value: number) => number
+  switch (frame.dataType) {
+    case 'uint8':
+      values = new Uint8Array(buffer)
+      toUint8Range = (value) => value
+      break
+    case 'int8':
+      values = new Int8Array(buffer)
+      toUint8Range = (value) => value + 128
+      break
+    case 'float16':
+      values = new Uint16Array(buffer)
+      toUint8Range = (value) => decodeFloat16(value) * 255
+      break
+    case 'float32':
+      values = new Float32Array(buffer)
+      toUint8Range = (value) => value * 255
+      break
+    default:
+      throw new Error('GPUFrame has no DataType')
+  }
+
+  const channelOrder = frame.channelOrder
+  if (channelOrder == null || channelOrder === 'gray') {
+    throw new Error(`GPUFrame has no RGB channels (${channelOrder})`)
+  }
+  const pixelCount = frame.width * frame.height
+  const channelCount = channelsPerPixel[channelOrder]
+  const channelOffsets = rgbChannelOffsets[channelOrder]
+  const result = new Array<number>(pixelCount * 3)
+  for (let pixel = 0; pixel < pixelCount; pixel++) {
+    for (let channel = 0; channel < 3; channel++) {
+      const sourceChannel = channelOffsets[channel] ?? channel
+      const sourceIndex =
+        frame.pixelLayout === 'planar'
+          ? sourceChannel * pixelCount + pixel
+          : pixel * channelCount + sourceChannel
+      result[pixel * 3 + channel] = toUint8Range(
+        values[sourceIndex] ?? Number.NaN,
+      )
+    }
+  }
+  return result
+}
+
+function getPointBounds(points: Float32Array): Rect {
+  const xs: number[] = []
+  const ys: number[] = []
+  for (let index = 0; index < points.length; index += 2) {
+    xs.push(points[index] ?? Number.NaN)
+    ys.push(points[index + 1] ?? Number.NaN)
+  }
+  return {
+    left: Math.min(...xs),
+    top: Math.min(...ys),
+    right: Math.max(...xs),
+    bottom: Math.max(...ys),
+  }
+}
+
+function expectRectToBeCloseTo(actual: Rect, expected: Rect): void {
+  expect(actual.left).toBeCloseTo(expected.left, 1)
+  expect(actual.top).toBeCloseTo(expected.top, 1)
+  expect(actual.right).toBeCloseTo(expected.right, 1)
+  expect(actual.bottom).toBeCloseTo(expected.bottom, 1)
+}
+
 function expectGpuFrameMetadata(
   frame: GPUFrame,
-  channelOrder: 'rgb' | 'bgr',
+  channelOrder: ChannelOrder,
   dataType: 'uint8' | 'int8' | 'float16' | 'float32',
   pixelLayout: 'interleaved' | 'planar',
   bytesPerChannel: number,
@@ -789,7 +1946,10 @@ function expectGpuFrameMetadata(
   expect(frame.dataType).toBe(dataType)
   expect(frame.pixelLayout).toBe(pixelLayout)
   expect(frame.getPixelBuffer().byteLength).toBe(
-    FORMAT_WIDTH * FORMAT_HEIGHT * 3 * bytesPerChannel,
+    FORMAT_WIDTH *
+      FORMAT_HEIGHT *
+      channelsPerPixel[channelOrder] *
+      bytesPerChannel,
   )
 }
 
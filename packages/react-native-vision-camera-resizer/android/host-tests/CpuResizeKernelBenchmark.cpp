@@ -0,0 +1,111 @@
+///
+/// CpuResizeKernelBenchmark.cpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#include "CpuResizeKernelReference.hpp"
+#include "ResizerTestSupport.hpp"
+
+#include "utils/OutputBufferLayout.hpp"
+#include "utils/OutputNormalization.hpp"
+#include "utils/ResizeTransformMapping.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+namespace margelo::nitro::camera::resizer::host_tests {
+
+namespace {
+
+  // A 1080p camera Frame into a typical detector input, on one thread (the worker pool splits exactly this work into bands).
+  constexpr uint32_t kInputWidth = 1920;
+  constexpr uint32_t kInputHeight = 1080;
+  constexpr uint32_t kOutputWidth = 640;
+  constexpr uint32_t kOutputHeight = 640;
+
+  enum class BenchmarkTarget { RGB_UINT8_INTERLEAVED, RGB_FLOAT32_PLANAR, GRAY_UINT8 };
+
+  using ResizeRowsFunction = void (*)(const cpu::CpuResizeJob&, uint32_t, uint32_t) noexcept;
+
+  void runResizeBenchmark(benchmark::State& state, ResizeRowsFunction resizeRows) {
+    const TestImageLayout layout = static_cast<TestImageLayout>(state.range(0));
+    const BenchmarkTarget target = static_cast<BenchmarkTarget>(state.range(1));
+    const TestImage testImage = TestImage::makeGradient(layout, kInputWidth, kInputHeight);
+
+    ChannelOrder channelOrder = ChannelOrder::RGB;
+    DataType dataType = DataType::UINT8;
+    PixelLayout pixelLayout = PixelLayout::INTERLEAVED;
+    switch (target) {
+      case BenchmarkTarget::RGB_UINT8_INTERLEAVED:
+        break;
+      case BenchmarkTarget::RGB_FLOAT32_PLANAR:
+        dataType = DataType::FLOAT32;
+        pixelLayout = PixelLayout::PLANAR;
+        break;
+      case BenchmarkTarget::GRAY_UINT8:
+        channelOrder = ChannelOrder::GRAY;
+        break;
+    }
+    const ResizerOptions options =
+        makeOptions(kOutputWidth, kOutputHeight, channelOrder, dataType, ScaleMode::COVER, pixelLayout, ResizeFilter::BILINEAR);
+    const ResizeTransform transform = margelo::nitro::camera::resizer::utils::getResizeTransform(
+        margelo::nitro::camera::resizer::utils::CropRegion{}, kInputWidth, kInputHeight, kOutputWidth, kOutputHeight, 90, false, options.scaleMode);
+    std::vector<uint8_t> output(margelo::nitro::camera::resizer::utils::getOutputTotalByteCount(channelOrder, dataType, kOutputWidth, kOutputHeight));
+
+    const cpu::CpuResizeJob job{
+        .input = testImage.getImage(),
+        .outputToInput = margelo::nitro::camera::resizer::utils::getOutputToFrameMatrix(transform),
+        .cropLeft = static_cast<float>(transform.crop.left),
+        .cropTop = static_cast<float>(transform.crop.top),
+        .cropRight = static_cast<float>(transform.crop.right),
+        .cropBottom = static_cast<float>(transform.crop.bottom),
+        .isPaddedOutsideCrop = false,
+        .filter = ResizeFilter::BILINEAR,
+        .normalization = margelo::nitro::camera::resizer::utils::getOutputNormalization(options),
+        .channelOrder = channelOrder,
+        .dataType = dataType,
+        .pixelLayout = pixelLayout,
+        .outputWidth = kOutputWidth,
+        .outputHeight = kOutputHeight,
+        .output = output.data(),
+        .cellLumaSums = nullptr,
+    };
+    for (auto _ : state) {
+      resizeRows(job, 0, kOutputHeight);
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * kOutputWidth * kOutputHeight);
+  }
+
+  void applyArguments(benchmark::internal::Benchmark* benchmark) {
+    benchmark->ArgNames({"layout", "target"});
+    for (const TestImageLayout layout : {TestImageLayout::NV12, TestImageLayout::NV21, TestImageLayout::I420, TestImageLayout::RGBA}) {
+      for (const BenchmarkTarget target : {BenchmarkTarget::RGB_UINT8_INTERLEAVED, BenchmarkTarget::RGB_FLOAT32_PLANAR, BenchmarkTarget::GRAY_UINT8}) {
+        benchmark->Args({static_cast<int64_t>(layout), static_cast<int64_t>(target)});
+      }
+    }
+    benchmark->Unit(benchmark::kMicrosecond);
+  }
+
+} // namespace
+
+/**
+ * The shipped kernel, see `cpu::resizeRows(...)`.
+ */
+static void BM_CpuResizeKernel(benchmark::State& state) {
+  runResizeBenchmark(state, &cpu::resizeRows);
+}
+
+/**
+ * The scalar reference, as the baseline for the vectorized kernel.
+ */
+static void BM_CpuResizeKernelReference(benchmark::State& state) {
+  runResizeBenchmark(state, &resizeRowsReference);
+}
+
+BENCHMARK(BM_CpuResizeKernel)->Apply(applyArguments);
+BENCHMARK(BM_CpuResizeKernelReference)->Apply(applyArguments);
+
+} // namespace margelo::nitro::camera::resizer::host_tests
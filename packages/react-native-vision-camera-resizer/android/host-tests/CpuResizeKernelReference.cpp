@@ -0,0 +1,220 @@
+///
+/// CpuResizeKernelReference.cpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#include "CpuResizeKernelReference.hpp"
+
+#include "utils/FrameLumaStatistics.hpp"
+#include "utils/OutputBufferLayout.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+
+namespace margelo::nitro::camera::resizer::host_tests {
+
+namespace {
+
+  constexpr uint32_t kMaxChannelCount = 4;
+  constexpr uint32_t kMaxAreaTapsPerAxis = 4;
+
+  struct Color final {
+    float red{0.0f};
+    float green{0.0f};
+    float blue{0.0f};
+  };
+
+  /**
+   * Bilinearly samples one 8-bit channel with clamp-to-edge addressing, where texel centers sit at `+ 0.5`.
+   */
+  [[nodiscard]] float sampleChannel(const uint8_t* plane, uint32_t rowStride, uint32_t pixelStride, uint32_t width, uint32_t height, float x,
+                                    float y) noexcept {
+    const float texelX = x - 0.5f;
+    const float texelY = y - 0.5f;
+    const int32_t left = static_cast<int32_t>(std::floor(texelX));
+    const int32_t top = static_cast<int32_t>(std::floor(texelY));
+    const float weightX = texelX - static_cast<float>(left);
+    const float weightY = texelY - static_cast<float>(top);
+    const int32_t maxX = static_cast<int32_t>(width) - 1;
+    const int32_t maxY = static_cast<int32_t>(height) - 1;
+
+    const auto read = [&](int32_t column, int32_t row) {
+      const size_t offset = (static_cast<size_t>(std::clamp(row, 0, maxY)) * rowStride) + (static_cast<size_t>(std::clamp(column, 0, maxX)) * pixelStride);
+      return static_cast<float>(plane[offset]);
+    };
+    const float topLeft = read(left, top);
+    const float topRight = read(left + 1, top);
+    const float bottomLeft = read(left, top + 1);
+    const float bottomRight = read(left + 1, top + 1);
+    const float topValue = topLeft + ((topRight - topLeft) * weightX);
+    const float bottomValue = bottomLeft + ((bottomRight - bottomLeft) * weightX);
+    return (topValue + ((bottomValue - topValue) * weightY)) * (1.0f / 255.0f);
+  }
+
+  [[nodiscard]] Color sampleInput(const cpu::CpuResizeJob& job, float x, float y) noexcept {
+    const cpu::CpuInputImage& input = job.input;
+    Color color{};
+    if (input.format == cpu::CpuInputImage::Format::RGBA_8888) {
+      color.red = sampleChannel(input.planes[0] + 0, input.rowStrides[0], input.pixelStrides[0], input.width, input.height, x, y);
+      color.green = sampleChannel(input.planes[0] + 1, input.rowStrides[0], input.pixelStrides[0], input.width, input.height, x, y);
+      color.blue = sampleChannel(input.planes[0] + 2, input.rowStrides[0], input.pixelStrides[0], input.width, input.height, x, y);
+    } else {
+      const float luma = sampleChannel(input.planes[0], input.rowStrides[0], input.pixelStrides[0], input.width, input.height, x, y);
+      if (job.channelOrder == ChannelOrder::GRAY) {
+        color = Color{.red = luma, .green = luma, .blue = luma};
+      } else {
+        const uint32_t chromaWidth = (input.width + 1) / 2;
+        const uint32_t chromaHeight = (input.height + 1) / 2;
+        const float cb =
+            sampleChannel(input.planes[1], input.rowStrides[1], input.pixelStrides[1], chromaWidth, chromaHeight, x * 0.5f, y * 0.5f) - 0.5f;
+        const float cr =
+            sampleChannel(input.planes[2], input.rowStrides[2], input.pixelStrides[2], chromaWidth, chromaHeight, x * 0.5f, y * 0.5f) - 0.5f;
+        color.red = std::clamp(luma + (1.402f * cr), 0.0f, 1.0f);
+        color.green = std::clamp(luma - (0.344136f * cb) - (0.714136f * cr), 0.0f, 1.0f);
+        color.blue = std::clamp(luma + (1.772f * cb), 0.0f, 1.0f);
+      }
+    }
+    if (job.isPaddedOutsideCrop && (x < job.cropLeft || x > job.cropRight || y < job.cropTop || y > job.cropBottom)) {
+      return Color{};
+    }
+    return color;
+  }
+
+  [[nodiscard]] uint32_t getAreaTapCount(float footprint) noexcept {
+    const float tapCount = std::ceil(footprint * 0.5f);
+    return static_cast<uint32_t>(std::clamp(tapCount, 1.0f, static_cast<float>(kMaxAreaTapsPerAxis)));
+  }
+
+  [[nodiscard]] Color sampleOutputPixel(const cpu::CpuResizeJob& job, uint32_t column, uint32_t row, uint32_t tapCountX, uint32_t tapCountY) noexcept {
+    const margelo::nitro::camera::resizer::utils::OutputToFrameMatrix& matrix = job.outputToInput;
+    Color sum{};
+    for (uint32_t tapY = 0; tapY < tapCountY; tapY++) {
+      const float outputY = static_cast<float>(row) + ((static_cast<float>(tapY) + 0.5f) * (1.0f / static_cast<float>(tapCountY)));
+      for (uint32_t tapX = 0; tapX < tapCountX; tapX++) {
+        const float outputX = static_cast<float>(column) + ((static_cast<float>(tapX) + 0.5f) * (1.0f / static_cast<float>(tapCountX)));
+        const float inputX = (outputX * matrix.m00) + ((matrix.m01 * outputY) + matrix.tx);
+        const float inputY = (outputX * matrix.m10) + ((matrix.m11 * outputY) + matrix.ty);
+        const Color tap = sampleInput(job, inputX, inputY);
+        sum.red += tap.red;
+        sum.green += tap.green;
+        sum.blue += tap.blue;
+      }
+    }
+    const float weight = 1.0f / static_cast<float>(tapCountX * tapCountY);
+    return Color{.red = sum.red * weight, .green = sum.green * weight, .blue = sum.blue * weight};
+  }
+
+  [[nodiscard]] uint16_t floatToHalf(float value) noexcept {
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const uint32_t sign = (bits >> 16) & 0x8000u;
+    const int32_t exponent = static_cast<int32_t>((bits >> 23) & 0xFFu);
+    const uint32_t mantissa = bits & 0x7FFFFFu;
+    if (exponent == 0xFF) {
+      return static_cast<uint16_t>(sign | 0x7C00u | (mantissa != 0 ? 0x200u : 0u));
+    }
+    // Round to nearest even by going through double, which represents every half and every halfway point exactly.
+    const double magnitude = std::abs(static_cast<double>(value));
+    if (magnitude >= 65520.0) {
+      return static_cast<uint16_t>(sign | 0x7C00u);
+    }
+    if (magnitude < std::ldexp(1.0, -14)) {
+      return static_cast<uint16_t>(sign | static_cast<uint32_t>(std::nearbyint(magnitude * std::ldexp(1.0, 24))));
+    }
+    int halfExponent = 0;
+    const double fraction = std::frexp(magnitude, &halfExponent);
+    // `fraction` is in [0.5, 1), so the 11 significant bits of a half are `fraction * 2^11`.
+    uint32_t significand = static_cast<uint32_t>(std::nearbyint(fraction * 2048.0));
+    if (significand == 2048) {
+      significand = 1024;
+      halfExponent++;
+    }
+    const uint32_t biasedExponent = static_cast<uint32_t>(halfExponent - 1 + 15);
+    if (biasedExponent >= 31) {
+      return static_cast<uint16_t>(sign | 0x7C00u);
+    }
+    return static_cast<uint16_t>(sign | (biasedExponent << 10) | (significand - 1024));
+  }
+
+  void writeValue(const cpu::CpuResizeJob& job, size_t valueIndex, float value) noexcept {
+    switch (job.dataType) {
+      case DataType::INT8: {
+        const float quantized = std::nearbyint(value * job.normalization.inverseQuantizationScale) + job.normalization.quantizationZeroPoint;
+        reinterpret_cast<int8_t*>(job.output)[valueIndex] = static_cast<int8_t>(std::clamp(quantized, -128.0f, 127.0f));
+        return;
+      }
+      case DataType::UINT8: {
+        const float quantized = std::nearbyint(value * job.normalization.inverseQuantizationScale) + job.normalization.quantizationZeroPoint;
+        job.output[valueIndex] = static_cast<uint8_t>(std::clamp(quantized, 0.0f, 255.0f));
+        return;
+      }
+      case DataType::FLOAT16: {
+        const uint16_t half = floatToHalf(value);
+        std::memcpy(job.output + (valueIndex * sizeof(uint16_t)), &half, sizeof(uint16_t));
+        return;
+      }
+      case DataType::FLOAT32:
+        std::memcpy(job.output + (valueIndex * sizeof(float)), &value, sizeof(float));
+        return;
+    }
+  }
+
+} // namespace
+
+void resizeRowsReference(const cpu::CpuResizeJob& job, uint32_t firstRow, uint32_t endRow) noexcept {
+  const margelo::nitro::camera::resizer::utils::OutputToFrameMatrix& matrix = job.outputToInput;
+  const size_t pixelCount = static_cast<size_t>(job.outputWidth) * job.outputHeight;
+  const uint32_t channelCount = margelo::nitro::camera::resizer::utils::getChannelsPerPixel(job.channelOrder);
+  uint32_t tapCountX = 1;
+  uint32_t tapCountY = 1;
+  if (job.filter == ResizeFilter::AREA) {
+    tapCountX = getAreaTapCount(std::hypot(matrix.m00, matrix.m10));
+    tapCountY = getAreaTapCount(std::hypot(matrix.m01, matrix.m11));
+  }
+
+  for (uint32_t row = firstRow; row < endRow; row++) {
+    for (uint32_t column = 0; column < job.outputWidth; column++) {
+      const Color color = sampleOutputPixel(job, column, row, tapCountX, tapCountY);
+      std::array<float, kMaxChannelCount> values{};
+      switch (job.channelOrder) {
+        case ChannelOrder::RGB:
+          values = {color.red, color.green, color.blue, 0.0f};
+          break;
+        case ChannelOrder::BGR:
+          values = {color.blue, color.green, color.red, 0.0f};
+          break;
+        case ChannelOrder::GRAY:
+          values[0] = (color.red * 0.299f) + (color.green * 0.587f) + (color.blue * 0.114f);
+          break;
+        case ChannelOrder::RGBA:
+          values = {color.red, color.green, color.blue, 1.0f};
+          break;
+        case ChannelOrder::BGRA:
+          values = {color.blue, color.green, color.red, 1.0f};
+          break;
+        case ChannelOrder::ARGB:
+          values = {1.0f, color.red, color.green, color.blue};
+          break;
+      }
+
+      if (job.cellLumaSums != nullptr) {
+        const uint32_t cell = (margelo::nitro::camera::resizer::utils::getFrameStatisticsCell(row, job.outputHeight) *
+                               margelo::nitro::camera::resizer::utils::kFrameStatisticsGridSize) +
+                              margelo::nitro::camera::resizer::utils::getFrameStatisticsCell(column, job.outputWidth);
+        job.cellLumaSums[cell].fetch_add(margelo::nitro::camera::resizer::utils::getPixelLuma(color.red, color.green, color.blue),
+                                         std::memory_order_relaxed);
+      }
+      const size_t pixelIndex = (static_cast<size_t>(row) * job.outputWidth) + column;
+      for (uint32_t channel = 0; channel < channelCount; channel++) {
+        const float value = (values[channel] * job.normalization.channelScale[channel]) + job.normalization.channelBias[channel];
+        const size_t valueIndex = job.pixelLayout == PixelLayout::PLANAR ? (channel * pixelCount) + pixelIndex : (pixelIndex * channelCount) + channel;
+        writeValue(job, valueIndex, value);
+      }
+    }
+  }
+}
+
+} // namespace margelo::nitro::camera::resizer::host_tests
@@ -0,0 +1,21 @@
+///
+/// CpuResizeKernelReference.hpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include "cpu/CpuResizeKernel.hpp"
+
+#include <cstdint>
+
+namespace margelo::nitro::camera::resizer::host_tests {
+
+/**
+ * A plain scalar implementation of `cpu::resizeRows(...)`: one output pixel and one input byte at a time, without any vectors.
+ * It defines the values the vectorized kernel has to produce, and the baseline its benchmarks are measured against.
+ */
+void resizeRowsReference(const cpu::CpuResizeJob& job, uint32_t firstRow, uint32_t endRow) noexcept;
+
+} // namespace margelo::nitro::camera::resizer::host_tests
@@ -0,0 +1,252 @@
+///
+/// CpuResizeKernelTest.cpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#include "CpuResizeKernelReference.hpp"
+#include "ResizerTestSupport.hpp"
+
+#include "utils/FrameLumaStatistics.hpp"
+#include "utils/OutputBufferLayout.hpp"
+#include "utils/OutputNormalization.hpp"
+#include "utils/ResizeTransformMapping.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace margelo::nitro::camera::resizer::host_tests {
+
+namespace {
+
+  using OutputSize = margelo::nitro::camera::resizer::utils::OutputSize;
+  using CropRegion = margelo::nitro::camera::resizer::utils::CropRegion;
+
+  // Written around and between the rows a call may write, so stray vector stores show up.
+  constexpr uint8_t kCanary = 0xA5;
+  constexpr size_t kCanaryByteCount = 64;
+
+  struct InputSize final {
+    uint32_t width;
+    uint32_t height;
+  };
+
+  // An odd size with padded rows, plus the degenerate sizes where left and right taps collapse onto one texel.
+  constexpr std::array<InputSize, 3> kInputSizes = {InputSize{97, 73}, InputSize{2, 3}, InputSize{1, 1}};
+  // Full vector groups, a partial trailing group, and outputs narrower than one vector.
+  constexpr std::array<OutputSize, 3> kOutputSizes = {OutputSize{48, 32}, OutputSize{45, 31}, OutputSize{3, 5}};
+  constexpr std::array<CropRegion, 2> kRegions = {
+      CropRegion{.x = 0.0f, .y = 0.0f, .width = 1.0f, .height = 1.0f},
+      CropRegion{.x = 0.25f, .y = 0.125f, .width = 0.5f, .height = 0.75f},
+  };
+
+  using KernelTestParam = std::tuple<TestImageLayout, DataType, ChannelOrder, PixelLayout>;
+
+  /**
+   * An output image with `kCanaryByteCount` canary bytes before and after it.
+   */
+  class GuardedOutput final {
+  public:
+    explicit GuardedOutput(size_t byteCount) : _bytes(byteCount + (2 * kCanaryByteCount), kCanary), _byteCount(byteCount) {}
+
+    [[nodiscard]] uint8_t* data() noexcept {
+      return _bytes.data() + kCanaryByteCount;
+    }
+    [[nodiscard]] std::span<const uint8_t> getOutput() const noexcept {
+      return std::span<const uint8_t>(_bytes.data() + kCanaryByteCount, _byteCount);
+    }
+    [[nodiscard]] bool areGuardsIntact() const noexcept {
+      for (size_t index = 0; index < kCanaryByteCount; index++) {
+        if (_bytes[index] != kCanary || _bytes[kCanaryByteCount + _byteCount + index] != kCanary) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+  private:
+    std::vector<uint8_t> _bytes;
+    size_t _byteCount;
+  };
+
+  [[nodiscard]] cpu::CpuResizeJob makeJob(const cpu::CpuInputImage& input, const ResizerOptions& options, const OutputSize& outputSize, int rotationDegrees,
+                                          bool isMirrored, const CropRegion& region, uint8_t* output,
+                                          std::atomic<uint32_t>* cellLumaSums) {
+    const ResizeTransform transform = margelo::nitro::camera::resizer::utils::getResizeTransform(
+        region, input.width, input.height, outputSize.width, outputSize.height, rotationDegrees, isMirrored, options.scaleMode);
+    return cpu::CpuResizeJob{
+        .input = input,
+        .outputToInput = margelo::nitro::camera::resizer::utils::getOutputToFrameMatrix(transform),
+        .cropLeft = static_cast<float>(transform.crop.left),
+        .cropTop = static_cast<float>(transform.crop.top),
+        .cropRight = static_cast<float>(transform.crop.right),
+        .cropBottom = static_cast<float>(transform.crop.bottom),
+        .isPaddedOutsideCrop = options.scaleMode == ScaleMode::CONTAIN,
+        .filter = options.filter.value_or(ResizeFilter::BILINEAR),
+        .normalization = margelo::nitro::camera::resizer::utils::getOutputNormalization(options),
+        .channelOrder = options.channelOrder,
+        .dataType = options.dataType,
+        .pixelLayout = options.pixelLayout,
+        .outputWidth = outputSize.width,
+        .outputHeight = outputSize.height,
+        .output = output,
+        .cellLumaSums = cellLumaSums,
+    };
+  }
+
+  [[nodiscard]] std::string getTestName(const testing::TestParamInfo<KernelTestParam>& info) {
+    const auto& [imageLayout, dataType, channelOrder, pixelLayout] = info.param;
+    std::string name;
+    switch (imageLayout) {
+      case TestImageLayout::RGBA:
+        name = "Rgba";
+        break;
+      case TestImageLayout::NV12:
+        name = "Nv12";
+        break;
+      case TestImageLayout::NV21:
+        name = "Nv21";
+        break;
+      case TestImageLayout::I420:
+        name = "I420";
+        break;
+    }
+    switch (dataType) {
+      case DataType::INT8:
+        name += "ToInt8";
+        break;
+      case DataType::UINT8:
+        name += "ToUint8";
+        break;
+      case DataType::FLOAT16:
+        name += "ToFloat16";
+        break;
+      case DataType::FLOAT32:
+        name += "ToFloat32";
+        break;
+    }
+    switch (channelOrder) {
+      case ChannelOrder::RGB:
+        name += "Rgb";
+        break;
+      case ChannelOrder::BGR:
+        name += "Bgr";
+        break;
+      case ChannelOrder::GRAY:
+        name += "Gray";
+        break;
+      case ChannelOrder::RGBA:
+        name += "Rgba";
+        break;
+      case ChannelOrder::BGRA:
+        name += "Bgra";
+        break;
+      case ChannelOrder::ARGB:
+        name += "Argb";
+        break;
+    }
+    return name + (pixelLayout == PixelLayout::PLANAR ? "Planar" : "Interleaved");
+  }
+
+  class CpuResizeKernelTest : public testing::TestWithParam<KernelTestParam> {};
+
+} // namespace
+
+TEST_P(CpuResizeKernelTest, MatchesScalarReference) {
+  const auto& [imageLayout, dataType, channelOrder, pixelLayout] = GetParam();
+  // Both sides use the same float math, so only rounding of the last bit (e.g. fused multiply-adds) may differ.
+  const double tolerance = dataType == DataType::FLOAT32 ? 1e-5 : dataType == DataType::FLOAT16 ? 2e-3 : 1.0;
+
+  for (const InputSize& inputSize : kInputSizes) {
+    const TestImage testImage = TestImage::makeGradient(imageLayout, inputSize.width, inputSize.height);
+    for (const ScaleMode scaleMode : {ScaleMode::COVER, ScaleMode::CONTAIN, ScaleMode::STRETCH}) {
+      for (const ResizeFilter filter : {ResizeFilter::BILINEAR, ResizeFilter::AREA}) {
+        for (const OutputSize& outputSize : kOutputSizes) {
+          const ResizerOptions options = makeOptions(outputSize.width, outputSize.height, channelOrder, dataType, scaleMode, pixelLayout, filter);
+          const size_t byteCount =
+              margelo::nitro::camera::resizer::utils::getOutputTotalByteCount(channelOrder, dataType, outputSize.width, outputSize.height);
+          for (const int rotationDegrees : {0, 90, 180, 270}) {
+            for (const bool isMirrored : {false, true}) {
+              for (const CropRegion& region : kRegions) {
+                SCOPED_TRACE(testing::Message() << inputSize.width << "x" << inputSize.height << " into " << outputSize.width << "x" << outputSize.height
+                                                << ", scale mode " << static_cast<int>(scaleMode) << ", filter " << static_cast<int>(filter)
+                                                << ", rotated by " << rotationDegrees << (isMirrored ? ", mirrored" : "") << ", region {" << region.x
+                                                << ", " << region.y << ", " << region.width << ", " << region.height << "}");
+                GuardedOutput expected(byteCount);
+                GuardedOutput actual(byteCount);
+                std::array<std::atomic<uint32_t>, margelo::nitro::camera::resizer::utils::kFrameStatisticsCellCount> expectedCellLumaSums{};
+                std::array<std::atomic<uint32_t>, margelo::nitro::camera::resizer::utils::kFrameStatisticsCellCount> actualCellLumaSums{};
+
+                resizeRowsReference(makeJob(testImage.getImage(), options, outputSize, rotationDegrees, isMirrored, region, expected.data(),
+                                            expectedCellLumaSums.data()),
+                                    0, outputSize.height);
+                // Split the rows into uneven bands, like the worker pool does.
+                const cpu::CpuResizeJob job =
+                    makeJob(testImage.getImage(), options, outputSize, rotationDegrees, isMirrored, region, actual.data(), actualCellLumaSums.data());
+                const uint32_t split = outputSize.height / 3;
+                cpu::resizeRows(job, 0, split);
+                cpu::resizeRows(job, split, outputSize.height);
+
+                ASSERT_TRUE(actual.areGuardsIntact()) << "The kernel wrote outside of its output.";
+                const OutputComparison comparison = compareOutputs(dataType, expected.getOutput(), actual.getOutput(), tolerance);
+                EXPECT_EQ(comparison.mismatchCount, 0u) << comparison.describe();
+                for (size_t cell = 0; cell < expectedCellLumaSums.size(); cell++) {
+                  EXPECT_NEAR(static_cast<double>(actualCellLumaSums[cell].load()), static_cast<double>(expectedCellLumaSums[cell].load()), 16.0)
+                      << "cell " << cell;
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Rows run concurrently on the worker pool, so a call must never touch bytes of rows outside its own range, not even temporarily.
+ */
+TEST_P(CpuResizeKernelTest, OnlyWritesItsOwnRows) {
+  const auto& [imageLayout, dataType, channelOrder, pixelLayout] = GetParam();
+  const TestImage testImage = TestImage::makeGradient(imageLayout, 97, 73);
+  for (const OutputSize& outputSize : kOutputSizes) {
+    const ResizerOptions options = makeOptions(outputSize.width, outputSize.height, channelOrder, dataType, ScaleMode::COVER, pixelLayout, ResizeFilter::BILINEAR);
+    const size_t byteCount = margelo::nitro::camera::resizer::utils::getOutputTotalByteCount(channelOrder, dataType, outputSize.width, outputSize.height);
+    const uint32_t firstRow = 1;
+    const uint32_t endRow = outputSize.height - 1;
+
+    GuardedOutput output(byteCount);
+    cpu::resizeRows(makeJob(testImage.getImage(), options, outputSize, 0, false, kRegions[0], output.data(), nullptr), firstRow, endRow);
+    ASSERT_TRUE(output.areGuardsIntact());
+
+    const uint32_t channelCount = margelo::nitro::camera::resizer::utils::getChannelsPerPixel(channelOrder);
+    const size_t bytesPerValue = margelo::nitro::camera::resizer::utils::getBytesPerChannel(dataType);
+    const size_t planeCount = pixelLayout == PixelLayout::PLANAR ? channelCount : 1;
+    const size_t rowByteCount = static_cast<size_t>(outputSize.width) * bytesPerValue * (pixelLayout == PixelLayout::PLANAR ? 1 : channelCount);
+    const size_t planeByteCount = rowByteCount * outputSize.height;
+    const std::span<const uint8_t> bytes = output.getOutput();
+    for (size_t plane = 0; plane < planeCount; plane++) {
+      for (const uint32_t row : {0u, outputSize.height - 1}) {
+        for (size_t byte = 0; byte < rowByteCount; byte++) {
+          ASSERT_EQ(bytes[(plane * planeByteCount) + (row * rowByteCount) + byte], kCanary)
+              << "Row " << row << " of plane " << plane << " was written by a call for rows " << firstRow << " ..< " << endRow << ".";
+        }
+      }
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(AllFormats, CpuResizeKernelTest,
+                         testing::Combine(testing::Values(TestImageLayout::RGBA, TestImageLayout::NV12, TestImageLayout::NV21, TestImageLayout::I420),
+                                          testing::Values(DataType::INT8, DataType::UINT8, DataType::FLOAT16, DataType::FLOAT32),
+                                          testing::Values(ChannelOrder::RGB, ChannelOrder::BGR, ChannelOrder::GRAY, ChannelOrder::RGBA,
+                                                          ChannelOrder::BGRA, ChannelOrder::ARGB),
+                                          testing::Values(PixelLayout::INTERLEAVED, PixelLayout::PLANAR)),
+                         getTestName);
+
+} // namespace margelo::nitro::camera::resizer::host_tests
@@ -0,0 +1,564 @@
+///
+/// HostResizerPipeline.cpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#include "HostResizerPipeline.hpp"
+
+#include "utils/FrameLumaStatistics.hpp"
+#include "utils/OutputBufferLayout.hpp"
+#include "vulkan/VulkanResizerShaderConfig.hpp"
+#include "vulkan/VulkanUtils.hpp"
+
+#include <array>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace margelo::nitro::camera::resizer::host_tests {
+
+namespace {
+
+  namespace shader_config = margelo::nitro::camera::resizer::vulkan::shader_config;
+  namespace vk_utils = margelo::nitro::camera::resizer::vulkan::utils;
+
+  // Matches `kStorageBufferAlignment` of `VulkanResizerPipeline`, so partial trailing words stay inside the buffer.
+  constexpr VkDeviceSize kStorageBufferAlignment = 16;
+  // The second plane of a 2-plane image must start on a texel (and copy) boundary.
+  constexpr VkDeviceSize kPlaneAlignment = 16;
+
+  [[nodiscard]] VkDeviceSize alignUp(VkDeviceSize value, VkDeviceSize alignment) noexcept {
+    return ((value + alignment - 1) / alignment) * alignment;
+  }
+
+  [[nodiscard]] uint32_t getChromaSize(uint32_t lumaSize) noexcept {
+    return (lumaSize + 1) / 2;
+  }
+
+} // namespace
+
+HostResizerPipeline::HostResizerPipeline(std::shared_ptr<HostVulkanDevice> device, const cpu::CpuInputImage& input, const ResizerOptions& options,
+                                         const vulkan::VulkanPipelineCache::WorkgroupSize& workgroupSize)
+    : _device(std::move(device)), _options(options), _workgroupSize(workgroupSize) {
+  try {
+    createInputImage(input);
+    uploadInputImage(input);
+    createComputePipeline(workgroupSize);
+  } catch (...) {
+    destroy();
+    throw;
+  }
+}
+
+HostResizerPipeline::~HostResizerPipeline() {
+  destroy();
+}
+
+void HostResizerPipeline::record(const margelo::nitro::camera::resizer::utils::OutputSize& outputSize, int rotationDegrees, bool isMirrored,
+                                 const margelo::nitro::camera::resizer::utils::CropRegion& region) {
+  _outputByteCount = margelo::nitro::camera::resizer::utils::getOutputTotalByteCount(_options.channelOrder, _options.dataType, outputSize.width,
+                                                                                     outputSize.height);
+  if (_outputByteCount > _outputBuffer.byteCount) [[unlikely]] {
+    throw std::runtime_error("The requested output size is larger than the output buffer of this HostResizerPipeline.");
+  }
+  // The region buffer is host-coherent and not read by a submission in flight, since every submission is waited for.
+  std::memcpy(_regionBuffer.mappedData, &region, sizeof(shader_config::ShaderRegion));
+
+  vk_utils::checkVk(vkResetCommandBuffer(_commandBuffer, 0), "Failed to reset the Vulkan resizer command buffer.");
+  VkCommandBufferBeginInfo beginInfo{
+      .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+      .pNext = nullptr,
+      .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+      .pInheritanceInfo = nullptr,
+  };
+  vk_utils::checkVk(vkBeginCommandBuffer(_commandBuffer, &beginInfo), "Failed to begin recording the Vulkan resizer command buffer.");
+
+  // Sub-word atomicOr writes need a zeroed buffer. Everything else must be written by whole-word stores, so fill it with a
+  // pattern that no correct output ever leaves behind everywhere.
+  const bool requiresZeroedOutput = shader_config::requiresZeroedOutputBuffer(_options, outputSize.width);
+  vkCmdFillBuffer(_commandBuffer, _outputBuffer.buffer, 0, VK_WHOLE_SIZE, requiresZeroedOutput ? 0u : kUnwrittenWord);
+  vkCmdFillBuffer(_commandBuffer, _statisticsBuffer.buffer, 0, VK_WHOLE_SIZE, 0u);
+
+  std::array<VkBufferMemoryBarrier, 2> fillBarriers{};
+  for (size_t index = 0; index < fillBarriers.size(); index++) {
+    VkBufferMemoryBarrier& fillBarrier = fillBarriers[index];
+    fillBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    fillBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    fillBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    fillBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    fillBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    fillBarrier.buffer = index == 0 ? _outputBuffer.buffer : _statisticsBuffer.buffer;
+    fillBarrier.offset = 0;
+    fillBarrier.size = VK_WHOLE_SIZE;
+  }
+  vkCmdPipelineBarrier(_commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr,
+                       static_cast<uint32_t>(fillBarriers.size()), fillBarriers.data(), 0, nullptr);
+
+  vkCmdBindPipeline(_commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, _pipeline);
+  vkCmdBindDescriptorSets(_commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, _pipelineLayout, 0, 1, &_descriptorSet, 0, nullptr);
+  const shader_config::ShaderPushConstants shaderPushConstants =
+      shader_config::ShaderPushConstants::make(outputSize.width, outputSize.height, rotationDegrees, isMirrored);
+  vkCmdPushConstants(_commandBuffer, _pipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(shader_config::ShaderPushConstants), &shaderPushConstants);
+
+  const uint32_t invocationsPerRow = vk_utils::divideRoundUp(outputSize.width, shader_config::getPixelsPerInvocation(_options));
+  vkCmdDispatch(_commandBuffer, vk_utils::divideRoundUp(invocationsPerRow, _workgroupSize.x), vk_utils::divideRoundUp(outputSize.height, _workgroupSize.y), 1);
+
+  VkBufferMemoryBarrier hostReadBarrier{};
+  hostReadBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+  hostReadBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+  hostReadBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+  hostReadBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+  hostReadBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+  hostReadBarrier.buffer = _outputBuffer.buffer;
+  hostReadBarrier.offset = 0;
+  hostReadBarrier.size = VK_WHOLE_SIZE;
+  vkCmdPipelineBarrier(_commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 0, nullptr, 1, &hostReadBarrier, 0, nullptr);
+
+  vk_utils::checkVk(vkEndCommandBuffer(_commandBuffer), "Failed to end recording the Vulkan resizer command buffer.");
+}
+
+void HostResizerPipeline::submit() {
+  const VkDevice device = _device->getDevice();
+  vk_utils::checkVk(vkResetFences(device, 1, &_fence), "Failed to reset the Vulkan resizer fence.");
+
+  VkSubmitInfo submitInfo{};
+  submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+  submitInfo.commandBufferCount = 1;
+  submitInfo.pCommandBuffers = &_commandBuffer;
+  vk_utils::checkVk(vkQueueSubmit(_device->getQueue(), 1, &submitInfo, _fence), "Failed to submit the Vulkan resizer command buffer.");
+}
+
+void HostResizerPipeline::wait() {
+  vk_utils::checkVk(vkWaitForFences(_device->getDevice(), 1, &_fence, VK_TRUE, std::numeric_limits<uint64_t>::max()),
+                    "Failed to wait for the Vulkan resizer fence.");
+}
+
+void HostResizerPipeline::invalidate() {
+  VkMappedMemoryRange range{
+      .sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,
+      .pNext = nullptr,
+      .memory = _outputBuffer.memory,
+      .offset = 0,
+      .size = VK_WHOLE_SIZE,
+  };
+  vk_utils::checkVk(vkInvalidateMappedMemoryRanges(_device->getDevice(), 1, &range), "Failed to invalidate the Vulkan resizer output buffer.");
+}
+
+std::span<const uint8_t> HostResizerPipeline::getOutput() const noexcept {
+  return std::span<const uint8_t>(_outputBuffer.mappedData, _outputByteCount);
+}
+
+std::vector<uint8_t> HostResizerPipeline::resize(const margelo::nitro::camera::resizer::utils::OutputSize& outputSize, int rotationDegrees, bool isMirrored,
+                                                 const margelo::nitro::camera::resizer::utils::CropRegion& region) {
+  record(outputSize, rotationDegrees, isMirrored, region);
+  submit();
+  wait();
+  invalidate();
+  const std::span<const uint8_t> output = getOutput();
+  return std::vector<uint8_t>(output.begin(), output.end());
+}
+
+HostResizerPipeline::HostBuffer HostResizerPipeline::createHostBuffer(VkDeviceSize byteCount, VkBufferUsageFlags usage) const {
+  const VkDevice device = _device->getDevice();
+  HostBuffer buffer{};
+  buffer.byteCount = byteCount;
+
+  VkBufferCreateInfo bufferCreateInfo{};
+  bufferCreateInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+  bufferCreateInfo.size = byteCount;
+  bufferCreateInfo.usage = usage;
+  bufferCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+  try {
+    vk_utils::checkVk(vkCreateBuffer(device, &bufferCreateInfo, nullptr, &buffer.buffer), "Failed to create a host-visible Vulkan buffer.");
+
+    VkMemoryRequirements memoryRequirements{};
+    vkGetBufferMemoryRequirements(device, buffer.buffer, &memoryRequirements);
+    VkMemoryAllocateInfo allocateInfo{};
+    allocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocateInfo.allocationSize = memoryRequirements.size;
+    allocateInfo.memoryTypeIndex =
+        _device->findMemoryTypeIndex(memoryRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    vk_utils::checkVk(vkAllocateMemory(device, &allocateInfo, nullptr, &buffer.memory), "Failed to allocate a host-visible Vulkan buffer.");
+    vk_utils::checkVk(vkBindBufferMemory(device, buffer.buffer, buffer.memory, 0), "Failed to bind a host-visible Vulkan buffer.");
+
+    void* mappedData = nullptr;
+    vk_utils::checkVk(vkMapMemory(device, buffer.memory, 0, VK_WHOLE_SIZE, 0, &mappedData), "Failed to map a host-visible Vulkan buffer.");
+    buffer.mappedData = static_cast<uint8_t*>(mappedData);
+  } catch (...) {
+    destroyHostBuffer(buffer);
+    throw;
+  }
+  return buffer;
+}
+
+void HostResizerPipeline::destroyHostBuffer(HostBuffer& buffer) const noexcept {
+  const VkDevice device = _device->getDevice();
+  if (buffer.mappedData != nullptr) {
+    vkUnmapMemory(device, buffer.memory);
+  }
+  if (buffer.buffer != VK_NULL_HANDLE) {
+    vkDestroyBuffer(device, buffer.buffer, nullptr);
+  }
+  if (buffer.memory != VK_NULL_HANDLE) {
+    vkFreeMemory(device, buffer.memory, nullptr);
+  }
+  buffer = HostBuffer{};
+}
+
+void HostResizerPipeline::createInputImage(const cpu::CpuInputImage& input) {
+  const VkDevice device = _device->getDevice();
+  _isYcbcrInput = input.format == cpu::CpuInputImage::Format::YUV_420;
+  _isLumaInput = _isYcbcrInput && _options.channelOrder == ChannelOrder::GRAY;
+  if (_isYcbcrInput && !_device->supportsYcbcrInput()) [[unlikely]] {
+    throw std::runtime_error("This Vulkan device cannot sample 2-plane 4:2:0 YCbCr images.");
+  }
+  const VkFormat format = _isYcbcrInput ? VK_FORMAT_G8_B8R8_2PLANE_420_UNORM : VK_FORMAT_R8G8B8A8_UNORM;
+
+  VkSamplerYcbcrConversionInfo conversionInfo{};
+  conversionInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO;
+  if (_isYcbcrInput) {
+    // Camera buffers report BT.601 with chroma sited between luma samples, which is what the CPU kernel reconstructs as well.
+    VkSamplerYcbcrConversionCreateInfo conversionCreateInfo{};
+    conversionCreateInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_CREATE_INFO;
+    conversionCreateInfo.format = format;
+    conversionCreateInfo.ycbcrModel = _isLumaInput ? VK_SAMPLER_YCBCR_MODEL_CONVERSION_YCBCR_IDENTITY : VK_SAMPLER_YCBCR_MODEL_CONVERSION_YCBCR_601;
+    conversionCreateInfo.ycbcrRange = VK_SAMPLER_YCBCR_RANGE_ITU_FULL;
+    conversionCreateInfo.components = VkComponentMapping{
+        .r = VK_COMPONENT_SWIZZLE_IDENTITY,
+        .g = VK_COMPONENT_SWIZZLE_IDENTITY,
+        .b = VK_COMPONENT_SWIZZLE_IDENTITY,
+        .a = VK_COMPONENT_SWIZZLE_IDENTITY,
+    };
+    conversionCreateInfo.xChromaOffset = VK_CHROMA_LOCATION_MIDPOINT;
+    conversionCreateInfo.yChromaOffset = VK_CHROMA_LOCATION_MIDPOINT;
+    conversionCreateInfo.chromaFilter = VK_FILTER_LINEAR;
+    conversionCreateInfo.forceExplicitReconstruction = VK_FALSE;
+    vk_utils::checkVk(vkCreateSamplerYcbcrConversion(device, &conversionCreateInfo, nullptr, &_conversion),
+                      "Failed to create the Vulkan YCbCr conversion for the input image.");
+    conversionInfo.conversion = _conversion;
+  }
+
+  VkImageCreateInfo imageCreateInfo{};
+  imageCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+  imageCreateInfo.imageType = VK_IMAGE_TYPE_2D;
+  imageCreateInfo.format = format;
+  imageCreateInfo.extent = VkExtent3D{.width = input.width, .height = input.height, .depth = 1};
+  imageCreateInfo.mipLevels = 1;
+  imageCreateInfo.arrayLayers = 1;
+  imageCreateInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+  imageCreateInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+  imageCreateInfo.usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+  imageCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+  imageCreateInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+  vk_utils::checkVk(vkCreateImage(device, &imageCreateInfo, nullptr, &_inputImage), "Failed to create the Vulkan input image.");
+
+  VkMemoryRequirements memoryRequirements{};
+  vkGetImageMemoryRequirements(device, _inputImage, &memoryRequirements);
+  VkMemoryAllocateInfo allocateInfo{};
+  allocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+  allocateInfo.allocationSize = memoryRequirements.size;
+  allocateInfo.memoryTypeIndex = _device->findMemoryTypeIndex(memoryRequirements.memoryTypeBits, 0);
+  vk_utils::checkVk(vkAllocateMemory(device, &allocateInfo, nullptr, &_inputMemory), "Failed to allocate the Vulkan input image.");
+  vk_utils::checkVk(vkBindImageMemory(device, _inputImage, _inputMemory, 0), "Failed to bind the Vulkan input image.");
+
+  VkImageViewCreateInfo viewCreateInfo{};
+  viewCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+  viewCreateInfo.pNext = _isYcbcrInput ? &conversionInfo : nullptr;
+  viewCreateInfo.image = _inputImage;
+  viewCreateInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+  viewCreateInfo.format = format;
+  viewCreateInfo.components = VkComponentMapping{
+      .r = VK_COMPONENT_SWIZZLE_IDENTITY,
+      .g = VK_COMPONENT_SWIZZLE_IDENTITY,
+      .b = VK_COMPONENT_SWIZZLE_IDENTITY,
+      .a = VK_COMPONENT_SWIZZLE_IDENTITY,
+  };
+  viewCreateInfo.subresourceRange = VkImageSubresourceRange{
+      .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+      .baseMipLevel = 0,
+      .levelCount = 1,
+      .baseArrayLayer = 0,
+      .layerCount = 1,
+  };
+  vk_utils::checkVk(vkCreateImageView(device, &viewCreateInfo, nullptr, &_inputView), "Failed to create the Vulkan input image view.");
+
+  // Identical to the sampler of `VulkanResizerPipeline::createComputePipelines`.
+  VkSamplerCreateInfo samplerCreateInfo{};
+  samplerCreateInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+  samplerCreateInfo.pNext = _isYcbcrInput ? &conversionInfo : nullptr;
+  samplerCreateInfo.magFilter = VK_FILTER_LINEAR;
+  samplerCreateInfo.minFilter = VK_FILTER_LINEAR;
+  samplerCreateInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+  samplerCreateInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+  samplerCreateInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+  samplerCreateInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+  samplerCreateInfo.mipLodBias = 0.0f;
+  samplerCreateInfo.anisotropyEnable = VK_FALSE;
+  samplerCreateInfo.compareEnable = VK_FALSE;
+  samplerCreateInfo.minLod = 0.0f;
+  samplerCreateInfo.maxLod = 0.0f;
+  samplerCreateInfo.borderColor = VK_BORDER_COLOR_FLOAT_TRANSPARENT_BLACK;
+  samplerCreateInfo.unnormalizedCoordinates = VK_FALSE;
+  vk_utils::checkVk(vkCreateSampler(device, &samplerCreateInfo, nullptr, &_sampler), "Failed to create the Vulkan sampler for the input image.");
+}
+
+void HostResizerPipeline::uploadInputImage(const cpu::CpuInputImage& input) {
+  // Repack the planes tightly, so the copy does not depend on the input's row and pixel strides.
+  const uint32_t chromaWidth = getChromaSize(input.width);
+  const uint32_t chromaHeight = getChromaSize(input.height);
+  const VkDeviceSize firstPlaneByteCount = static_cast<VkDeviceSize>(input.width) * input.height * (_isYcbcrInput ? 1 : 4);
+  const VkDeviceSize secondPlaneOffset = alignUp(firstPlaneByteCount, kPlaneAlignment);
+  const VkDeviceSize stagingByteCount = _isYcbcrInput ? secondPlaneOffset + (static_cast<VkDeviceSize>(chromaWidth) * chromaHeight * 2) : firstPlaneByteCount;
+  HostBuffer staging = createHostBuffer(stagingByteCount, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+
+  if (_isYcbcrInput) {
+    for (uint32_t y = 0; y < input.height; y++) {
+      for (uint32_t x = 0; x < input.width; x++) {
+        staging.mappedData[(static_cast<size_t>(y) * input.width) + x] =
+            input.planes[0][(static_cast<size_t>(y) * input.rowStrides[0]) + (static_cast<size_t>(x) * input.pixelStrides[0])];
+      }
+    }
+    uint8_t* chroma = staging.mappedData + secondPlaneOffset;
+    for (uint32_t y = 0; y < chromaHeight; y++) {
+      for (uint32_t x = 0; x < chromaWidth; x++) {
+        const size_t index = ((static_cast<size_t>(y) * chromaWidth) + x) * 2;
+        chroma[index] = input.planes[1][(static_cast<size_t>(y) * input.rowStrides[1]) + (static_cast<size_t>(x) * input.pixelStrides[1])];
+        chroma[index + 1] = input.planes[2][(static_cast<size_t>(y) * input.rowStrides[2]) + (static_cast<size_t>(x) * input.pixelStrides[2])];
+      }
+    }
+  } else {
+    for (uint32_t y = 0; y < input.height; y++) {
+      std::memcpy(staging.mappedData + (static_cast<size_t>(y) * input.width * 4), input.planes[0] + (static_cast<size_t>(y) * input.rowStrides[0]),
+                  static_cast<size_t>(input.width) * 4);
+    }
+  }
+
+  std::vector<VkBufferImageCopy> copies;
+  copies.push_back(VkBufferImageCopy{
+      .bufferOffset = 0,
+      .bufferRowLength = 0,
+      .bufferImageHeight = 0,
+      .imageSubresource = {.aspectMask = _isYcbcrInput ? VK_IMAGE_ASPECT_PLANE_0_BIT : VK_IMAGE_ASPECT_COLOR_BIT, .mipLevel = 0, .baseArrayLayer = 0, .layerCount = 1},
+      .imageOffset = {0, 0, 0},
+      .imageExtent = {input.width, input.height, 1},
+  });
+  if (_isYcbcrInput) {
+    copies.push_back(VkBufferImageCopy{
+        .bufferOffset = secondPlaneOffset,
+        .bufferRowLength = 0,
+        .bufferImageHeight = 0,
+        .imageSubresource = {.aspectMask = VK_IMAGE_ASPECT_PLANE_1_BIT, .mipLevel = 0, .baseArrayLayer = 0, .layerCount = 1},
+        .imageOffset = {0, 0, 0},
+        .imageExtent = {chromaWidth, chromaHeight, 1},
+    });
+  }
+
+  try {
+    _device->submitAndWait([&](VkCommandBuffer commandBuffer) {
+      VkImageMemoryBarrier barrier{};
+      barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+      barrier.srcAccessMask = 0;
+      barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+      barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+      barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+      barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+      barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+      barrier.image = _inputImage;
+      barrier.subresourceRange = VkImageSubresourceRange{
+          .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+          .baseMipLevel = 0,
+          .levelCount = 1,
+          .baseArrayLayer = 0,
+          .layerCount = 1,
+      };
+      vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+      vkCmdCopyBufferToImage(commandBuffer, staging.buffer, _inputImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, static_cast<uint32_t>(copies.size()),
+                             copies.data());
+
+      barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+      barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+      barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+      barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+      vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+    });
+  } catch (...) {
+    destroyHostBuffer(staging);
+    throw;
+  }
+  destroyHostBuffer(staging);
+}
+
+void HostResizerPipeline::createComputePipeline(const vulkan::VulkanPipelineCache::WorkgroupSize& workgroupSize) {
+  const VkDevice device = _device->getDevice();
+
+  // Same bindings as `VulkanResizerPipeline::createComputePipelines`: input, output, regions and statistics.
+  std::array<VkDescriptorSetLayoutBinding, 4> bindings{};
+  for (uint32_t binding = 0; binding < bindings.size(); binding++) {
+    bindings[binding].binding = binding;
+    bindings[binding].descriptorType = binding == 0 ? VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER : VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    bindings[binding].descriptorCount = 1;
+    bindings[binding].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+  }
+  bindings[0].pImmutableSamplers = &_sampler;
+
+  VkDescriptorSetLayoutCreateInfo descriptorSetLayoutCreateInfo{};
+  descriptorSetLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+  descriptorSetLayoutCreateInfo.bindingCount = static_cast<uint32_t>(bindings.size());
+  descriptorSetLayoutCreateInfo.pBindings = bindings.data();
+  vk_utils::checkVk(vkCreateDescriptorSetLayout(device, &descriptorSetLayoutCreateInfo, nullptr, &_descriptorSetLayout),
+                    "Failed to create the Vulkan descriptor set layout for the resizer pipeline.");
+
+  VkPushConstantRange pushConstantRange{};
+  pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+  pushConstantRange.offset = 0;
+  pushConstantRange.size = sizeof(shader_config::ShaderPushConstants);
+
+  VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo{};
+  pipelineLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+  pipelineLayoutCreateInfo.setLayoutCount = 1;
+  pipelineLayoutCreateInfo.pSetLayouts = &_descriptorSetLayout;
+  pipelineLayoutCreateInfo.pushConstantRangeCount = 1;
+  pipelineLayoutCreateInfo.pPushConstantRanges = &pushConstantRange;
+  vk_utils::checkVk(vkCreatePipelineLayout(device, &pipelineLayoutCreateInfo, nullptr, &_pipelineLayout), "Failed to create the Vulkan resizer pipeline layout.");
+
+  const shader_config::ShaderSpecializationData specializationData = shader_config::ShaderSpecializationData::make(_options, workgroupSize, _isLumaInput);
+  const VkSpecializationInfo specializationInfo = specializationData.asVkInfo();
+
+  VkComputePipelineCreateInfo computePipelineCreateInfo{};
+  computePipelineCreateInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+  computePipelineCreateInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+  computePipelineCreateInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+  computePipelineCreateInfo.stage.module = _device->getShaderModule();
+  computePipelineCreateInfo.stage.pName = "main";
+  computePipelineCreateInfo.stage.pSpecializationInfo = &specializationInfo;
+  computePipelineCreateInfo.layout = _pipelineLayout;
+  vk_utils::checkVk(vkCreateComputePipelines(device, VK_NULL_HANDLE, 1, &computePipelineCreateInfo, nullptr, &_pipeline),
+                    "Failed to create the Vulkan resizer compute pipeline.");
+
+  const margelo::nitro::camera::resizer::utils::OutputSize maxOutputSize = margelo::nitro::camera::resizer::utils::getMaxOutputSize(_options);
+  const size_t outputByteCount =
+      margelo::nitro::camera::resizer::utils::getOutputTotalByteCount(_options.channelOrder, _options.dataType, maxOutputSize.width, maxOutputSize.height);
+  _outputBuffer = createHostBuffer(alignUp(outputByteCount, kStorageBufferAlignment), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+  _regionBuffer = createHostBuffer(sizeof(shader_config::ShaderRegion), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+  _statisticsBuffer = createHostBuffer(margelo::nitro::camera::resizer::utils::kFrameStatisticsCellCount * sizeof(uint32_t),
+                                       VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+  // A YCbCr sampler may take up more than one combined image sampler descriptor, so leave some headroom.
+  const std::array<VkDescriptorPoolSize, 2> poolSizes = {
+      VkDescriptorPoolSize{VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 4},
+      VkDescriptorPoolSize{VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 3},
+  };
+  VkDescriptorPoolCreateInfo descriptorPoolCreateInfo{};
+  descriptorPoolCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+  descriptorPoolCreateInfo.maxSets = 1;
+  descriptorPoolCreateInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
+  descriptorPoolCreateInfo.pPoolSizes = poolSizes.data();
+  vk_utils::checkVk(vkCreateDescriptorPool(device, &descriptorPoolCreateInfo, nullptr, &_descriptorPool),
+                    "Failed to create the Vulkan descriptor pool for the resizer pipeline.");
+
+  VkDescriptorSetAllocateInfo descriptorSetAllocateInfo{};
+  descriptorSetAllocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+  descriptorSetAllocateInfo.descriptorPool = _descriptorPool;
+  descriptorSetAllocateInfo.descriptorSetCount = 1;
+  descriptorSetAllocateInfo.pSetLayouts = &_descriptorSetLayout;
+  vk_utils::checkVk(vkAllocateDescriptorSets(device, &descriptorSetAllocateInfo, &_descriptorSet),
+                    "Failed to allocate the Vulkan descriptor set for the resizer pipeline.");
+
+  const VkDescriptorImageInfo imageInfo{
+      .sampler = VK_NULL_HANDLE,
+      .imageView = _inputView,
+      .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+  };
+  const std::array<VkDescriptorBufferInfo, 3> bufferInfos = {
+      VkDescriptorBufferInfo{.buffer = _outputBuffer.buffer, .offset = 0, .range = VK_WHOLE_SIZE},
+      VkDescriptorBufferInfo{.buffer = _regionBuffer.buffer, .offset = 0, .range = VK_WHOLE_SIZE},
+      VkDescriptorBufferInfo{.buffer = _statisticsBuffer.buffer, .offset = 0, .range = VK_WHOLE_SIZE},
+  };
+  std::array<VkWriteDescriptorSet, 4> writes{};
+  for (uint32_t binding = 0; binding < writes.size(); binding++) {
+    writes[binding].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    writes[binding].dstSet = _descriptorSet;
+    writes[binding].dstBinding = binding;
+    writes[binding].dstArrayElement = 0;
+    writes[binding].descriptorCount = 1;
+    writes[binding].descriptorType = bindings[binding].descriptorType;
+    if (binding == 0) {
+      writes[binding].pImageInfo = &imageInfo;
+    } else {
+      writes[binding].pBufferInfo = &bufferInfos[binding - 1];
+    }
+  }
+  vkUpdateDescriptorSets(device, static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
+
+  VkCommandBufferAllocateInfo commandBufferAllocateInfo{
+      .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+      .pNext = nullptr,
+      .commandPool = _device->getCommandPool(),
+      .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+      .commandBufferCount = 1,
+  };
+  vk_utils::checkVk(vkAllocateCommandBuffers(device, &commandBufferAllocateInfo, &_commandBuffer), "Failed to allocate the Vulkan resizer command buffer.");
+
+  VkFenceCreateInfo fenceCreateInfo{};
+  fenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+  vk_utils::checkVk(vkCreateFence(device, &fenceCreateInfo, nullptr, &_fence), "Failed to create the Vulkan resizer fence.");
+}
+
+void HostResizerPipeline::destroy() noexcept {
+  const VkDevice device = _device->getDevice();
+  if (_fence != VK_NULL_HANDLE) {
+    // A recorded resize may still be running if a test failed between `submit()` and `wait()`.
+    vkWaitForFences(device, 1, &_fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+    vkDestroyFence(device, _fence, nullptr);
+    _fence = VK_NULL_HANDLE;
+  }
+  if (_commandBuffer != VK_NULL_HANDLE) {
+    vkFreeCommandBuffers(device, _device->getCommandPool(), 1, &_commandBuffer);
+    _commandBuffer = VK_NULL_HANDLE;
+  }
+  if (_descriptorPool != VK_NULL_HANDLE) {
+    vkDestroyDescriptorPool(device, _descriptorPool, nullptr);
+    _descriptorPool = VK_NULL_HANDLE;
+    _descriptorSet = VK_NULL_HANDLE;
+  }
+  destroyHostBuffer(_outputBuffer);
+  destroyHostBuffer(_regionBuffer);
+  destroyHostBuffer(_statisticsBuffer);
+  if (_pipeline != VK_NULL_HANDLE) {
+    vkDestroyPipeline(device, _pipeline, nullptr);
+    _pipeline = VK_NULL_HANDLE;
+  }
+  if (_pipelineLayout != VK_NULL_HANDLE) {
+    vkDestroyPipelineLayout(device, _pipelineLayout, nullptr);
+    _pipelineLayout = VK_NULL_HANDLE;
+  }
+  if (_descriptorSetLayout != VK_NULL_HANDLE) {
+    vkDestroyDescriptorSetLayout(device, _descriptorSetLayout, nullptr);
+    _descriptorSetLayout = VK_NULL_HANDLE;
+  }
+  if (_sampler != VK_NULL_HANDLE) {
+    vkDestroySampler(device, _sampler, nullptr);
+    _sampler = VK_NULL_HANDLE;
+  }
+  if (_inputView != VK_NULL_HANDLE) {
+    vkDestroyImageView(device, _inputView, nullptr);
+    _inputView = VK_NULL_HANDLE;
+  }
+  if (_inputImage != VK_NULL_HANDLE) {
+    vkDestroyImage(device, _inputImage, nullptr);
+    _inputImage = VK_NULL_HANDLE;
+  }
+  if (_inputMemory != VK_NULL_HANDLE) {
+    vkFreeMemory(device, _inputMemory, nullptr);
+    _inputMemory = VK_NULL_HANDLE;
+  }
+  if (_conversion != VK_NULL_HANDLE) {
+    vkDestroySamplerYcbcrConversion(device, _conversion, nullptr);
+    _conversion = VK_NULL_HANDLE;
+  }
+}
+
+} // namespace margelo::nitro::camera::resizer::host_tests
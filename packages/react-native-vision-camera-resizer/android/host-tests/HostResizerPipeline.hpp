@@ -0,0 +1,112 @@
+///
+/// HostResizerPipeline.hpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include "HostVulkanDevice.hpp"
+#include "ResizerOptions.hpp"
+#include "cpu/CpuResizeKernel.hpp"
+#include "utils/CropRegion.hpp"
+#include "utils/OutputSize.hpp"
+#include "vulkan/VulkanPipelineCache.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+namespace margelo::nitro::camera::resizer::host_tests {
+
+/**
+ * Runs `Resizer.comp` for one `ResizerOptions` target on one input image, with the same descriptor set layout, specialization
+ * constants, push constants, region buffer and output buffer clears that `VulkanResizerPipeline` uses for a camera Frame.
+ *
+ * Instead of importing an `AHardwareBuffer`, the input is uploaded from CPU memory into a regular `VkImage`: `YUV_420` inputs
+ * become a 2-plane 4:2:0 image sampled through a BT.601 full range YCbCr conversion, `RGBA_8888` inputs an RGBA8 image.
+ */
+class HostResizerPipeline final {
+public:
+  /**
+   * Uploads `input` and builds the compute pipeline for `options`, sized for outputs up to `utils::getMaxOutputSize(options)`.
+   *
+   * @throws If the device cannot sample `input`, or any Vulkan object cannot be created.
+   */
+  HostResizerPipeline(std::shared_ptr<HostVulkanDevice> device, const cpu::CpuInputImage& input, const ResizerOptions& options,
+                      const vulkan::VulkanPipelineCache::WorkgroupSize& workgroupSize = {});
+  ~HostResizerPipeline();
+
+  HostResizerPipeline(const HostResizerPipeline&) = delete;
+  HostResizerPipeline& operator=(const HostResizerPipeline&) = delete;
+
+  /**
+   * Records one resize of `region` into an `outputSize` output, rotated by `rotationDegrees` and optionally mirrored.
+   * Output words that the shader has to write on its own are pre-filled with `kUnwrittenWord`, so any it misses stay visible.
+   */
+  void record(const margelo::nitro::camera::resizer::utils::OutputSize& outputSize, int rotationDegrees, bool isMirrored,
+              const margelo::nitro::camera::resizer::utils::CropRegion& region);
+  void submit();
+  void wait();
+  /**
+   * Makes the output written by the last submission visible to the host, like `VulkanResizerPipeline` does before JS reads it.
+   */
+  void invalidate();
+  /**
+   * Returns the tightly packed output of the last recorded resize.
+   */
+  [[nodiscard]] std::span<const uint8_t> getOutput() const noexcept;
+  /**
+   * Records, submits and waits for one resize, and returns a copy of its output.
+   */
+  [[nodiscard]] std::vector<uint8_t> resize(const margelo::nitro::camera::resizer::utils::OutputSize& outputSize, int rotationDegrees, bool isMirrored,
+                                            const margelo::nitro::camera::resizer::utils::CropRegion& region);
+
+public:
+  static constexpr uint32_t kUnwrittenWord = 0xCDCDCDCDu;
+
+private:
+  struct HostBuffer final {
+    VkBuffer buffer{VK_NULL_HANDLE};
+    VkDeviceMemory memory{VK_NULL_HANDLE};
+    uint8_t* mappedData{nullptr};
+    VkDeviceSize byteCount{0};
+  };
+
+  [[nodiscard]] HostBuffer createHostBuffer(VkDeviceSize byteCount, VkBufferUsageFlags usage) const;
+  void destroyHostBuffer(HostBuffer& buffer) const noexcept;
+  void createInputImage(const cpu::CpuInputImage& input);
+  void uploadInputImage(const cpu::CpuInputImage& input);
+  void createComputePipeline(const vulkan::VulkanPipelineCache::WorkgroupSize& workgroupSize);
+  void destroy() noexcept;
+
+private:
+  std::shared_ptr<HostVulkanDevice> _device;
+  ResizerOptions _options;
+  vulkan::VulkanPipelineCache::WorkgroupSize _workgroupSize;
+  bool _isYcbcrInput{false};
+  // Mirrors `VulkanResizerPipeline::samplesLuma(...)`: GRAY outputs of a YCbCr input sample Y through an identity conversion.
+  bool _isLumaInput{false};
+  VkImage _inputImage{VK_NULL_HANDLE};
+  VkDeviceMemory _inputMemory{VK_NULL_HANDLE};
+  VkImageView _inputView{VK_NULL_HANDLE};
+  VkSamplerYcbcrConversion _conversion{VK_NULL_HANDLE};
+  VkSampler _sampler{VK_NULL_HANDLE};
+  VkDescriptorSetLayout _descriptorSetLayout{VK_NULL_HANDLE};
+  VkPipelineLayout _pipelineLayout{VK_NULL_HANDLE};
+  VkPipeline _pipeline{VK_NULL_HANDLE};
+  VkDescriptorPool _descriptorPool{VK_NULL_HANDLE};
+  VkDescriptorSet _descriptorSet{VK_NULL_HANDLE};
+  VkCommandBuffer _commandBuffer{VK_NULL_HANDLE};
+  VkFence _fence{VK_NULL_HANDLE};
+  HostBuffer _outputBuffer{};
+  HostBuffer _regionBuffer{};
+  HostBuffer _statisticsBuffer{};
+  size_t _outputByteCount{0};
+};
+
+} // namespace margelo::nitro::camera::resizer::host_tests
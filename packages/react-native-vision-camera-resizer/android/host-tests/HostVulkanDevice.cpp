@@ -0,0 +1,295 @@
+///
+/// HostVulkanDevice.cpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#include "HostVulkanDevice.hpp"
+
+#include "vulkan/VulkanUtils.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace margelo::nitro::camera::resizer::host_tests {
+
+namespace {
+
+  namespace vk_utils = margelo::nitro::camera::resizer::vulkan::utils;
+
+  // Camera Frames are sampled as 4:2:0 YCbCr with bilinear chroma reconstruction, see `VulkanResizerPipeline::createComputePipelines`.
+  constexpr VkFormat kYcbcrInputFormat = VK_FORMAT_G8_B8R8_2PLANE_420_UNORM;
+  constexpr VkFormatFeatureFlags kRequiredYcbcrFormatFeatures =
+      VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT | VK_FORMAT_FEATURE_TRANSFER_DST_BIT | VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT |
+      VK_FORMAT_FEATURE_MIDPOINT_CHROMA_SAMPLES_BIT | VK_FORMAT_FEATURE_SAMPLED_IMAGE_YCBCR_CONVERSION_LINEAR_FILTER_BIT;
+
+} // namespace
+
+std::vector<uint32_t> readResizerShaderSpirv() {
+  const char* path = RESIZER_SHADER_SPIRV_PATH;
+  std::ifstream file(path, std::ios::binary);
+  if (!file) [[unlikely]] {
+    throw std::runtime_error(std::string("Failed to open the compiled Resizer shader `") + path + "`.");
+  }
+  const std::vector<char> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  if (bytes.empty() || bytes.size() % sizeof(uint32_t) != 0) [[unlikely]] {
+    throw std::runtime_error(std::string("The compiled Resizer shader `") + path + "` is not 4-byte aligned SPIR-V data.");
+  }
+  std::vector<uint32_t> words(bytes.size() / sizeof(uint32_t));
+  std::memcpy(words.data(), bytes.data(), bytes.size());
+  return words;
+}
+
+std::shared_ptr<HostVulkanDevice> HostVulkanDevice::getShared() {
+  static std::once_flag onceFlag;
+  static std::shared_ptr<HostVulkanDevice> sharedDevice;
+  std::call_once(onceFlag, []() {
+    try {
+      sharedDevice = std::make_shared<HostVulkanDevice>();
+    } catch (const std::exception& error) {
+      std::fprintf(stderr, "No usable Vulkan device on this host: %s\n", error.what());
+    }
+  });
+  return sharedDevice;
+}
+
+HostVulkanDevice::HostVulkanDevice() {
+  try {
+    createInstance();
+    createDevice();
+    createShaderModule();
+  } catch (...) {
+    destroy();
+    throw;
+  }
+}
+
+HostVulkanDevice::~HostVulkanDevice() {
+  destroy();
+}
+
+VkPhysicalDevice HostVulkanDevice::getPhysicalDevice() const noexcept {
+  return _physicalDevice;
+}
+
+VkDevice HostVulkanDevice::getDevice() const noexcept {
+  return _device;
+}
+
+VkQueue HostVulkanDevice::getQueue() const noexcept {
+  return _queue;
+}
+
+VkCommandPool HostVulkanDevice::getCommandPool() const noexcept {
+  return _commandPool;
+}
+
+VkShaderModule HostVulkanDevice::getShaderModule() const noexcept {
+  return _shaderModule;
+}
+
+bool HostVulkanDevice::supportsYcbcrInput() const noexcept {
+  return _supportsYcbcrInput;
+}
+
+uint32_t HostVulkanDevice::findMemoryTypeIndex(uint32_t memoryTypeBits, VkMemoryPropertyFlags requiredFlags) const {
+  VkPhysicalDeviceMemoryProperties memoryProperties{};
+  vkGetPhysicalDeviceMemoryProperties(_physicalDevice, &memoryProperties);
+  for (uint32_t index = 0; index < memoryProperties.memoryTypeCount; index++) {
+    const bool isAllowed = (memoryTypeBits & (1u << index)) != 0;
+    if (isAllowed && (memoryProperties.memoryTypes[index].propertyFlags & requiredFlags) == requiredFlags) {
+      return index;
+    }
+  }
+  throw std::runtime_error("No compatible Vulkan memory type found.");
+}
+
+void HostVulkanDevice::submitAndWait(const std::function<void(VkCommandBuffer)>& record) const {
+  VkCommandBufferAllocateInfo allocateInfo{
+      .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+      .pNext = nullptr,
+      .commandPool = _commandPool,
+      .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+      .commandBufferCount = 1,
+  };
+  VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+  vk_utils::checkVk(vkAllocateCommandBuffers(_device, &allocateInfo, &commandBuffer), "Failed to allocate a one-off Vulkan command buffer.");
+
+  try {
+    VkCommandBufferBeginInfo beginInfo{
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+        .pNext = nullptr,
+        .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+        .pInheritanceInfo = nullptr,
+    };
+    vk_utils::checkVk(vkBeginCommandBuffer(commandBuffer, &beginInfo), "Failed to begin a one-off Vulkan command buffer.");
+    record(commandBuffer);
+    vk_utils::checkVk(vkEndCommandBuffer(commandBuffer), "Failed to end a one-off Vulkan command buffer.");
+
+    VkSubmitInfo submitInfo{};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &commandBuffer;
+    vk_utils::checkVk(vkQueueSubmit(_queue, 1, &submitInfo, VK_NULL_HANDLE), "Failed to submit a one-off Vulkan command buffer.");
+    vk_utils::checkVk(vkQueueWaitIdle(_queue), "Failed to wait for a one-off Vulkan command buffer.");
+  } catch (...) {
+    vkFreeCommandBuffers(_device, _commandPool, 1, &commandBuffer);
+    throw;
+  }
+  vkFreeCommandBuffers(_device, _commandPool, 1, &commandBuffer);
+}
+
+void HostVulkanDevice::createInstance() {
+  VkApplicationInfo applicationInfo{
+      .sType = VK_STRUCTURE_TYPE_APPLICATION_INFO,
+      .pNext = nullptr,
+      .pApplicationName = "VisionCameraResizerHostTests",
+      .applicationVersion = 1,
+      .pEngineName = "VisionCameraResizer",
+      .engineVersion = 1,
+      .apiVersion = VK_API_VERSION_1_1,
+  };
+  VkInstanceCreateInfo instanceCreateInfo{
+      .sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO,
+      .pNext = nullptr,
+      .flags = 0,
+      .pApplicationInfo = &applicationInfo,
+      .enabledLayerCount = 0,
+      .ppEnabledLayerNames = nullptr,
+      .enabledExtensionCount = 0,
+      .ppEnabledExtensionNames = nullptr,
+  };
+  vk_utils::checkVk(vkCreateInstance(&instanceCreateInfo, nullptr, &_instance), "Failed to create a Vulkan instance.");
+}
+
+void HostVulkanDevice::createDevice() {
+  uint32_t physicalDeviceCount = 0;
+  vk_utils::checkVk(vkEnumeratePhysicalDevices(_instance, &physicalDeviceCount, nullptr), "Failed to enumerate Vulkan physical devices.");
+  std::vector<VkPhysicalDevice> physicalDevices(physicalDeviceCount);
+  vk_utils::checkVk(vkEnumeratePhysicalDevices(_instance, &physicalDeviceCount, physicalDevices.data()), "Failed to read Vulkan physical devices.");
+
+  // Pick the first Vulkan 1.1 device with a compute queue. Hosts usually only expose one software driver anyways.
+  for (VkPhysicalDevice physicalDevice : physicalDevices) {
+    VkPhysicalDeviceProperties properties{};
+    vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+    if (properties.apiVersion < VK_API_VERSION_1_1) {
+      continue;
+    }
+    uint32_t queueFamilyCount = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, nullptr);
+    std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, queueFamilies.data());
+    for (uint32_t index = 0; index < queueFamilyCount; index++) {
+      if ((queueFamilies[index].queueFlags & VK_QUEUE_COMPUTE_BIT) != 0) {
+        _physicalDevice = physicalDevice;
+        _queueFamilyIndex = index;
+        break;
+      }
+    }
+    if (_physicalDevice != VK_NULL_HANDLE) {
+      break;
+    }
+  }
+  if (_physicalDevice == VK_NULL_HANDLE) [[unlikely]] {
+    throw std::runtime_error("No Vulkan 1.1 device with a compute queue found.");
+  }
+
+  VkPhysicalDeviceSamplerYcbcrConversionFeatures supportedYcbcrFeatures{};
+  supportedYcbcrFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES;
+  VkPhysicalDeviceFeatures2 supportedFeatures{};
+  supportedFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+  supportedFeatures.pNext = &supportedYcbcrFeatures;
+  vkGetPhysicalDeviceFeatures2(_physicalDevice, &supportedFeatures);
+
+  VkFormatProperties ycbcrFormatProperties{};
+  vkGetPhysicalDeviceFormatProperties(_physicalDevice, kYcbcrInputFormat, &ycbcrFormatProperties);
+  _supportsYcbcrInput = supportedYcbcrFeatures.samplerYcbcrConversion == VK_TRUE &&
+                        (ycbcrFormatProperties.optimalTilingFeatures & kRequiredYcbcrFormatFeatures) == kRequiredYcbcrFormatFeatures;
+
+  float queuePriority = 1.0f;
+  VkDeviceQueueCreateInfo queueCreateInfo{
+      .sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
+      .pNext = nullptr,
+      .flags = 0,
+      .queueFamilyIndex = _queueFamilyIndex,
+      .queueCount = 1,
+      .pQueuePriorities = &queuePriority,
+  };
+
+  VkPhysicalDeviceSamplerYcbcrConversionFeatures ycbcrFeatures{};
+  ycbcrFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES;
+  ycbcrFeatures.samplerYcbcrConversion = _supportsYcbcrInput ? VK_TRUE : VK_FALSE;
+
+  VkPhysicalDeviceFeatures2 features2{
+      .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+      .pNext = &ycbcrFeatures,
+      .features = {},
+  };
+
+  VkDeviceCreateInfo deviceCreateInfo{
+      .sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
+      .pNext = &features2,
+      .flags = 0,
+      .queueCreateInfoCount = 1,
+      .pQueueCreateInfos = &queueCreateInfo,
+      .enabledLayerCount = 0,
+      .ppEnabledLayerNames = nullptr,
+      .enabledExtensionCount = 0,
+      .ppEnabledExtensionNames = nullptr,
+      .pEnabledFeatures = nullptr,
+  };
+  vk_utils::checkVk(vkCreateDevice(_physicalDevice, &deviceCreateInfo, nullptr, &_device), "Failed to create a Vulkan device.");
+  vkGetDeviceQueue(_device, _queueFamilyIndex, 0, &_queue);
+
+  VkCommandPoolCreateInfo commandPoolCreateInfo{
+      .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+      .pNext = nullptr,
+      .flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
+      .queueFamilyIndex = _queueFamilyIndex,
+  };
+  vk_utils::checkVk(vkCreateCommandPool(_device, &commandPoolCreateInfo, nullptr, &_commandPool), "Failed to create a Vulkan command pool.");
+}
+
+void HostVulkanDevice::createShaderModule() {
+  const std::vector<uint32_t> shaderWords = readResizerShaderSpirv();
+
+  VkShaderModuleCreateInfo shaderModuleCreateInfo{
+      .sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
+      .pNext = nullptr,
+      .flags = 0,
+      .codeSize = shaderWords.size() * sizeof(uint32_t),
+      .pCode = shaderWords.data(),
+  };
+  vk_utils::checkVk(vkCreateShaderModule(_device, &shaderModuleCreateInfo, nullptr, &_shaderModule), "Failed to create the Vulkan resizer shader module.");
+}
+
+void HostVulkanDevice::destroy() noexcept {
+  if (_device != VK_NULL_HANDLE) {
+    vkDeviceWaitIdle(_device);
+    if (_shaderModule != VK_NULL_HANDLE) {
+      vkDestroyShaderModule(_device, _shaderModule, nullptr);
+    }
+    if (_commandPool != VK_NULL_HANDLE) {
+      vkDestroyCommandPool(_device, _commandPool, nullptr);
+    }
+    vkDestroyDevice(_device, nullptr);
+  }
+  _shaderModule = VK_NULL_HANDLE;
+  _commandPool = VK_NULL_HANDLE;
+  _device = VK_NULL_HANDLE;
+  _queue = VK_NULL_HANDLE;
+  _physicalDevice = VK_NULL_HANDLE;
+
+  if (_instance != VK_NULL_HANDLE) {
+    vkDestroyInstance(_instance, nullptr);
+  }
+  _instance = VK_NULL_HANDLE;
+}
+
+} // namespace margelo::nitro::camera::resizer::host_tests
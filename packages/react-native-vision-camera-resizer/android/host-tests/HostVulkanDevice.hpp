@@ -0,0 +1,85 @@
+///
+/// HostVulkanDevice.hpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+namespace margelo::nitro::camera::resizer::host_tests {
+
+/**
+ * Reads the SPIR-V of `Resizer.comp`, as compiled by `glslc` at build time.
+ *
+ * @throws If the compiled shader cannot be read.
+ */
+[[nodiscard]] std::vector<uint32_t> readResizerShaderSpirv();
+
+/**
+ * A Vulkan 1.1 device on the host (e.g. lavapipe or SwiftShader) with one compute queue and the compiled `Resizer.comp`.
+ * Plays the role `VulkanContext` plays on Android, without any `AHardwareBuffer` interop.
+ */
+class HostVulkanDevice final {
+public:
+  /**
+   * Returns the device shared by every test and benchmark, or `nullptr` if this host has no usable Vulkan 1.1 device.
+   */
+  [[nodiscard]] static std::shared_ptr<HostVulkanDevice> getShared();
+
+  /**
+   * Creates the instance and device, and loads the SPIR-V of `Resizer.comp`.
+   *
+   * @throws If no Vulkan 1.1 device with a compute queue exists, or the shader cannot be loaded.
+   */
+  HostVulkanDevice();
+  ~HostVulkanDevice();
+
+  HostVulkanDevice(const HostVulkanDevice&) = delete;
+  HostVulkanDevice& operator=(const HostVulkanDevice&) = delete;
+
+  [[nodiscard]] VkPhysicalDevice getPhysicalDevice() const noexcept;
+  [[nodiscard]] VkDevice getDevice() const noexcept;
+  [[nodiscard]] VkQueue getQueue() const noexcept;
+  [[nodiscard]] VkCommandPool getCommandPool() const noexcept;
+  [[nodiscard]] VkShaderModule getShaderModule() const noexcept;
+  /**
+   * Reports whether 2-plane 4:2:0 (NV12) inputs can be sampled through a linear, midpoint-sited YCbCr conversion,
+   * like camera Frames are on Android.
+   */
+  [[nodiscard]] bool supportsYcbcrInput() const noexcept;
+  /**
+   * Finds a memory type of `memoryTypeBits` that has all `requiredFlags`.
+   *
+   * @throws If there is none.
+   */
+  [[nodiscard]] uint32_t findMemoryTypeIndex(uint32_t memoryTypeBits, VkMemoryPropertyFlags requiredFlags) const;
+  /**
+   * Records one-off commands with `record`, submits them and blocks until they finished.
+   */
+  void submitAndWait(const std::function<void(VkCommandBuffer)>& record) const;
+
+private:
+  void createInstance();
+  void createDevice();
+  void createShaderModule();
+  void destroy() noexcept;
+
+private:
+  VkInstance _instance{VK_NULL_HANDLE};
+  VkPhysicalDevice _physicalDevice{VK_NULL_HANDLE};
+  VkDevice _device{VK_NULL_HANDLE};
+  VkQueue _queue{VK_NULL_HANDLE};
+  uint32_t _queueFamilyIndex{0};
+  VkCommandPool _commandPool{VK_NULL_HANDLE};
+  VkShaderModule _shaderModule{VK_NULL_HANDLE};
+  bool _supportsYcbcrInput{false};
+};
+
+} // namespace margelo::nitro::camera::resizer::host_tests
@@ -0,0 +1,300 @@
+///
+/// ResizerTestSupport.cpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#include "ResizerTestSupport.hpp"
+
+#include "utils/OutputBufferLayout.hpp"
+#include "utils/OutputNormalization.hpp"
+#include "utils/ResizeTransformMapping.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+namespace margelo::nitro::camera::resizer::host_tests {
+
+namespace {
+
+  // Real camera buffers pad their rows, so the kernels must never assume `rowStride == width * pixelStride`.
+  constexpr uint32_t kRowPadding = 16;
+
+  struct Rgb final {
+    float r{0.0f};
+    float g{0.0f};
+    float b{0.0f};
+  };
+
+  [[nodiscard]] Rgb getGradientColor(uint32_t x, uint32_t y, uint32_t width, uint32_t height) noexcept {
+    const float u = width > 1 ? static_cast<float>(x) / static_cast<float>(width - 1) : 0.0f;
+    const float v = height > 1 ? static_cast<float>(y) / static_cast<float>(height - 1) : 0.0f;
+    return Rgb{.r = 255.0f * u, .g = 255.0f * v, .b = 255.0f * (1.0f - ((u + v) * 0.5f))};
+  }
+
+  [[nodiscard]] uint8_t toByte(float value) noexcept {
+    return static_cast<uint8_t>(std::clamp(std::lround(value), 0l, 255l));
+  }
+
+  [[nodiscard]] float getLuma(const Rgb& color) noexcept {
+    return (0.299f * color.r) + (0.587f * color.g) + (0.114f * color.b);
+  }
+
+  [[nodiscard]] float getCb(const Rgb& color) noexcept {
+    return 128.0f - (0.168736f * color.r) - (0.331264f * color.g) + (0.5f * color.b);
+  }
+
+  [[nodiscard]] float getCr(const Rgb& color) noexcept {
+    return 128.0f + (0.5f * color.r) - (0.418688f * color.g) - (0.081312f * color.b);
+  }
+
+  [[nodiscard]] float decodeHalf(uint16_t bits) noexcept {
+    const float sign = (bits & 0x8000u) != 0 ? -1.0f : 1.0f;
+    const int exponent = static_cast<int>((bits >> 10) & 0x1Fu);
+    const int mantissa = static_cast<int>(bits & 0x3FFu);
+    if (exponent == 0) {
+      return sign * std::ldexp(static_cast<float>(mantissa), -24);
+    }
+    if (exponent == 31) {
+      return mantissa == 0 ? sign * std::numeric_limits<float>::infinity() : std::numeric_limits<float>::quiet_NaN();
+    }
+    return sign * std::ldexp(static_cast<float>(1024 + mantissa), exponent - 25);
+  }
+
+} // namespace
+
+TestImage TestImage::makeGradient(TestImageLayout layout, uint32_t width, uint32_t height) {
+  TestImage testImage;
+  cpu::CpuInputImage& image = testImage._image;
+  image.width = width;
+  image.height = height;
+
+  if (layout == TestImageLayout::RGBA) {
+    image.format = cpu::CpuInputImage::Format::RGBA_8888;
+    image.rowStrides[0] = (width * 4) + kRowPadding;
+    image.pixelStrides[0] = 4;
+    testImage._data.assign(static_cast<size_t>(image.rowStrides[0]) * height, 0);
+    for (uint32_t y = 0; y < height; y++) {
+      for (uint32_t x = 0; x < width; x++) {
+        const Rgb color = getGradientColor(x, y, width, height);
+        uint8_t* pixel = testImage._data.data() + (static_cast<size_t>(y) * image.rowStrides[0]) + (static_cast<size_t>(x) * 4);
+        pixel[0] = toByte(color.r);
+        pixel[1] = toByte(color.g);
+        pixel[2] = toByte(color.b);
+        pixel[3] = 255;
+      }
+    }
+    image.planes[0] = testImage._data.data();
+    return testImage;
+  }
+
+  image.format = cpu::CpuInputImage::Format::YUV_420;
+  const uint32_t chromaWidth = (width + 1) / 2;
+  const uint32_t chromaHeight = (height + 1) / 2;
+  const bool isPlanar = layout == TestImageLayout::I420;
+  const uint32_t chromaPixelStride = isPlanar ? 1 : 2;
+  const uint32_t chromaRowStride = (chromaWidth * chromaPixelStride) + kRowPadding;
+  const size_t lumaByteCount = static_cast<size_t>(width + kRowPadding) * height;
+  const size_t chromaPlaneByteCount = static_cast<size_t>(chromaRowStride) * chromaHeight;
+  testImage._data.assign(lumaByteCount + (isPlanar ? 2 * chromaPlaneByteCount : chromaPlaneByteCount), 0);
+
+  uint8_t* data = testImage._data.data();
+  size_t uOffset = lumaByteCount;
+  size_t vOffset = lumaByteCount;
+  switch (layout) {
+    case TestImageLayout::NV12:
+      vOffset = uOffset + 1;
+      break;
+    case TestImageLayout::NV21:
+      uOffset = vOffset + 1;
+      break;
+    case TestImageLayout::I420:
+      vOffset = uOffset + chromaPlaneByteCount;
+      break;
+    case TestImageLayout::RGBA:
+      break;
+  }
+  image.planes[0] = data;
+  image.planes[1] = data + uOffset;
+  image.planes[2] = data + vOffset;
+  image.rowStrides[0] = width + kRowPadding;
+  image.rowStrides[1] = chromaRowStride;
+  image.rowStrides[2] = chromaRowStride;
+  image.pixelStrides[0] = 1;
+  image.pixelStrides[1] = chromaPixelStride;
+  image.pixelStrides[2] = chromaPixelStride;
+
+  for (uint32_t y = 0; y < height; y++) {
+    for (uint32_t x = 0; x < width; x++) {
+      data[(static_cast<size_t>(y) * image.rowStrides[0]) + x] = toByte(getLuma(getGradientColor(x, y, width, height)));
+    }
+  }
+  for (uint32_t chromaY = 0; chromaY < chromaHeight; chromaY++) {
+    for (uint32_t chromaX = 0; chromaX < chromaWidth; chromaX++) {
+      float cb = 0.0f;
+      float cr = 0.0f;
+      float sampleCount = 0.0f;
+      for (uint32_t y = chromaY * 2; y < std::min(height, (chromaY * 2) + 2); y++) {
+        for (uint32_t x = chromaX * 2; x < std::min(width, (chromaX * 2) + 2); x++) {
+          const Rgb color = getGradientColor(x, y, width, height);
+          cb += getCb(color);
+          cr += getCr(color);
+          sampleCount += 1.0f;
+        }
+      }
+      const size_t offset = (static_cast<size_t>(chromaY) * chromaRowStride) + (static_cast<size_t>(chromaX) * chromaPixelStride);
+      data[uOffset + offset] = toByte(cb / sampleCount);
+      data[vOffset + offset] = toByte(cr / sampleCount);
+    }
+  }
+  return testImage;
+}
+
+const cpu::CpuInputImage& TestImage::getImage() const noexcept {
+  return _image;
+}
+
+ResizerOptions makeOptions(uint32_t width, uint32_t height, ChannelOrder channelOrder, DataType dataType, ScaleMode scaleMode, PixelLayout pixelLayout,
+                           ResizeFilter filter) {
+  return ResizerOptions(width, height, channelOrder, dataType, scaleMode, pixelLayout, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt,
+                        std::nullopt, std::nullopt, std::nullopt, std::nullopt, filter, std::nullopt, std::nullopt);
+}
+
+std::string getDataTypeName(DataType dataType) {
+  switch (dataType) {
+    case DataType::INT8:
+      return "Int8";
+    case DataType::UINT8:
+      return "Uint8";
+    case DataType::FLOAT16:
+      return "Float16";
+    case DataType::FLOAT32:
+      return "Float32";
+  }
+  return "Unknown";
+}
+
+std::string getChannelOrderName(ChannelOrder channelOrder) {
+  switch (channelOrder) {
+    case ChannelOrder::RGB:
+      return "Rgb";
+    case ChannelOrder::BGR:
+      return "Bgr";
+    case ChannelOrder::GRAY:
+      return "Gray";
+    case ChannelOrder::RGBA:
+      return "Rgba";
+    case ChannelOrder::BGRA:
+      return "Bgra";
+    case ChannelOrder::ARGB:
+      return "Argb";
+  }
+  return "Unknown";
+}
+
+std::vector<uint8_t> resizeOnCpu(const cpu::CpuInputImage& input, const ResizerOptions& options,
+                                 const margelo::nitro::camera::resizer::utils::OutputSize& outputSize, int rotationDegrees, bool isMirrored,
+                                 const margelo::nitro::camera::resizer::utils::CropRegion& region) {
+  const ResizeTransform transform = margelo::nitro::camera::resizer::utils::getResizeTransform(
+      region, input.width, input.height, outputSize.width, outputSize.height, rotationDegrees, isMirrored, options.scaleMode);
+  std::vector<uint8_t> output(
+      margelo::nitro::camera::resizer::utils::getOutputTotalByteCount(options.channelOrder, options.dataType, outputSize.width, outputSize.height));
+
+  const cpu::CpuResizeJob job{
+      .input = input,
+      .outputToInput = margelo::nitro::camera::resizer::utils::getOutputToFrameMatrix(transform),
+      .cropLeft = static_cast<float>(transform.crop.left),
+      .cropTop = static_cast<float>(transform.crop.top),
+      .cropRight = static_cast<float>(transform.crop.right),
+      .cropBottom = static_cast<float>(transform.crop.bottom),
+      .isPaddedOutsideCrop = options.scaleMode == ScaleMode::CONTAIN,
+      .filter = options.filter.value_or(ResizeFilter::BILINEAR),
+      .normalization = margelo::nitro::camera::resizer::utils::getOutputNormalization(options),
+      .channelOrder = options.channelOrder,
+      .dataType = options.dataType,
+      .pixelLayout = options.pixelLayout,
+      .outputWidth = outputSize.width,
+      .outputHeight = outputSize.height,
+      .output = output.data(),
+      .cellLumaSums = nullptr,
+  };
+  cpu::resizeRows(job, 0, outputSize.height);
+  return output;
+}
+
+double readOutputValue(DataType dataType, std::span<const uint8_t> output, size_t index) {
+  switch (dataType) {
+    case DataType::INT8:
+      return static_cast<double>(static_cast<int8_t>(output[index]));
+    case DataType::UINT8:
+      return static_cast<double>(output[index]);
+    case DataType::FLOAT16: {
+      uint16_t bits = 0;
+      std::memcpy(&bits, output.data() + (index * sizeof(uint16_t)), sizeof(uint16_t));
+      return static_cast<double>(decodeHalf(bits));
+    }
+    case DataType::FLOAT32: {
+      float value = 0.0f;
+      std::memcpy(&value, output.data() + (index * sizeof(float)), sizeof(float));
+      return static_cast<double>(value);
+    }
+  }
+  throw std::runtime_error("Unknown Resizer DataType.");
+}
+
+double getOutputTolerance(const ResizerOptions& options, double steps) {
+  const margelo::nitro::camera::resizer::utils::OutputNormalization normalization = margelo::nitro::camera::resizer::utils::getOutputNormalization(options);
+  const uint32_t channelCount = margelo::nitro::camera::resizer::utils::getChannelsPerPixel(options.channelOrder);
+  float maxChannelScale = 0.0f;
+  for (uint32_t channel = 0; channel < channelCount; channel++) {
+    maxChannelScale = std::max(maxChannelScale, std::abs(normalization.channelScale[channel]));
+  }
+  const double normalizedTolerance = (steps / 255.0) * maxChannelScale;
+  switch (options.dataType) {
+    case DataType::INT8:
+    case DataType::UINT8:
+      return std::max(steps, std::ceil(normalizedTolerance * normalization.inverseQuantizationScale));
+    case DataType::FLOAT16:
+      // Half floats keep 11 significant bits, which is coarser than an 8-bit step for values above 8.
+      return normalizedTolerance + 1e-3 + (std::abs(normalization.channelBias[0]) + maxChannelScale) * 1e-3;
+    case DataType::FLOAT32:
+      return normalizedTolerance + 1e-4;
+  }
+  throw std::runtime_error("Unknown Resizer DataType.");
+}
+
+std::string OutputComparison::describe() const {
+  std::ostringstream stream;
+  stream << mismatchCount << " of " << valueCount << " values differ, worst at value " << worstIndex << ": expected " << worstExpected << ", got "
+         << worstActual << " (error " << maxError << ")";
+  return stream.str();
+}
+
+OutputComparison compareOutputs(DataType dataType, std::span<const uint8_t> expected, std::span<const uint8_t> actual, double tolerance) {
+  if (expected.size() != actual.size()) [[unlikely]] {
+    throw std::runtime_error("Compared Resizer outputs have different sizes.");
+  }
+  OutputComparison comparison{};
+  comparison.valueCount = expected.size() / margelo::nitro::camera::resizer::utils::getBytesPerChannel(dataType);
+  for (size_t index = 0; index < comparison.valueCount; index++) {
+    const double expectedValue = readOutputValue(dataType, expected, index);
+    const double actualValue = readOutputValue(dataType, actual, index);
+    const double error = std::isnan(expectedValue) || std::isnan(actualValue) ? std::numeric_limits<double>::infinity() : std::abs(expectedValue - actualValue);
+    if (error > tolerance) {
+      comparison.mismatchCount++;
+    }
+    if (error > comparison.maxError) {
+      comparison.maxError = error;
+      comparison.worstIndex = index;
+      comparison.worstExpected = expectedValue;
+      comparison.worstActual = actualValue;
+    }
+  }
+  return comparison;
+}
+
+} // namespace margelo::nitro::camera::resizer::host_tests
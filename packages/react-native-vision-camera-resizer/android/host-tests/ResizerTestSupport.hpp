@@ -0,0 +1,106 @@
+///
+/// ResizerTestSupport.hpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include "DataType.hpp"
+#include "ResizerOptions.hpp"
+#include "cpu/CpuResizeKernel.hpp"
+#include "utils/CropRegion.hpp"
+#include "utils/OutputSize.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace margelo::nitro::camera::resizer::host_tests {
+
+/**
+ * The memory layouts camera Frames arrive in. `YUV_420` Frames are NV12, NV21 or fully planar, depending on the device.
+ */
+enum class TestImageLayout { RGBA, NV12, NV21, I420 };
+
+/**
+ * A synthetic input image that owns its pixels, with padded rows like real camera buffers.
+ */
+class TestImage final {
+public:
+  /**
+   * Creates a smooth gradient (red along x, green along y, blue along the other diagonal) in `layout`.
+   * YCbCr layouts are converted with BT.601 full range, with each chroma sample averaged over its 2x2 luma block.
+   */
+  [[nodiscard]] static TestImage makeGradient(TestImageLayout layout, uint32_t width, uint32_t height);
+
+  TestImage(TestImage&&) noexcept = default;
+  TestImage& operator=(TestImage&&) noexcept = default;
+  TestImage(const TestImage&) = delete;
+  TestImage& operator=(const TestImage&) = delete;
+
+  [[nodiscard]] const cpu::CpuInputImage& getImage() const noexcept;
+
+private:
+  TestImage() = default;
+
+private:
+  std::vector<uint8_t> _data;
+  cpu::CpuInputImage _image{};
+};
+
+/**
+ * Creates `ResizerOptions` with every optional field unset, except `filter`.
+ */
+[[nodiscard]] ResizerOptions makeOptions(uint32_t width, uint32_t height, ChannelOrder channelOrder, DataType dataType, ScaleMode scaleMode,
+                                         PixelLayout pixelLayout, ResizeFilter filter);
+
+/**
+ * Names `dataType` for test names, e.g. `Uint8`.
+ */
+[[nodiscard]] std::string getDataTypeName(DataType dataType);
+/**
+ * Names `channelOrder` for test names, e.g. `Rgb`.
+ */
+[[nodiscard]] std::string getChannelOrderName(ChannelOrder channelOrder);
+
+/**
+ * Resizes `region` of `input` with `cpu::resizeRows(...)`, set up exactly like `CpuResizerPipeline` sets it up for a Frame.
+ */
+[[nodiscard]] std::vector<uint8_t> resizeOnCpu(const cpu::CpuInputImage& input, const ResizerOptions& options,
+                                               const margelo::nitro::camera::resizer::utils::OutputSize& outputSize, int rotationDegrees, bool isMirrored,
+                                               const margelo::nitro::camera::resizer::utils::CropRegion& region);
+
+/**
+ * Decodes output value `index` (not byte) of a tightly packed output of `dataType`.
+ */
+[[nodiscard]] double readOutputValue(DataType dataType, std::span<const uint8_t> output, size_t index);
+
+/**
+ * Returns the largest difference between two outputs of `options` that still counts as equal: `steps` 8-bit input steps after
+ * normalization, and `steps` quantization steps for 8-bit outputs.
+ */
+[[nodiscard]] double getOutputTolerance(const ResizerOptions& options, double steps);
+
+struct OutputComparison final {
+  size_t valueCount{0};
+  size_t mismatchCount{0};
+  double maxError{0.0};
+  size_t worstIndex{0};
+  double worstExpected{0.0};
+  double worstActual{0.0};
+
+  /**
+   * Describes the worst mismatch, for test failure messages.
+   */
+  [[nodiscard]] std::string describe() const;
+};
+
+/**
+ * Compares two equally sized outputs of `dataType` value by value.
+ */
+[[nodiscard]] OutputComparison compareOutputs(DataType dataType, std::span<const uint8_t> expected, std::span<const uint8_t> actual, double tolerance);
+
+} // namespace margelo::nitro::camera::resizer::host_tests
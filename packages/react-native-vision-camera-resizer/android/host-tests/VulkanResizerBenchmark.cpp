@@ -0,0 +1,141 @@
+///
+/// VulkanResizerBenchmark.cpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#include "HostResizerPipeline.hpp"
+#include "HostVulkanDevice.hpp"
+#include "ResizerTestSupport.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <utility>
+
+namespace margelo::nitro::camera::resizer::host_tests {
+
+namespace {
+
+  using OutputSize = margelo::nitro::camera::resizer::utils::OutputSize;
+  using CropRegion = margelo::nitro::camera::resizer::utils::CropRegion;
+
+  // A 1080p camera Frame into a typical detector input.
+  constexpr uint32_t kInputWidth = 1920;
+  constexpr uint32_t kInputHeight = 1080;
+  constexpr OutputSize kOutputSize{.width = 640, .height = 640};
+  constexpr CropRegion kFullRegion{};
+
+  /**
+   * The two outputs models usually ask for: packed 8-bit RGB, and normalized planar FLOAT32 RGB.
+   */
+  enum class BenchmarkTarget { RGB_UINT8_INTERLEAVED, RGB_FLOAT32_PLANAR };
+
+  struct BenchmarkFixture final {
+    BenchmarkFixture(std::shared_ptr<HostVulkanDevice> device, TestImageLayout layout, const ResizerOptions& options)
+        : testImage(TestImage::makeGradient(layout, kInputWidth, kInputHeight)), pipeline(std::move(device), testImage.getImage(), options) {}
+
+    TestImage testImage;
+    HostResizerPipeline pipeline;
+  };
+
+  /**
+   * Creates the pipeline for `state.range(0)` (a `BenchmarkTarget`), or skips `state` if this host has no Vulkan device.
+   */
+  [[nodiscard]] std::unique_ptr<BenchmarkFixture> makeFixture(benchmark::State& state) {
+    const std::shared_ptr<HostVulkanDevice> device = HostVulkanDevice::getShared();
+    if (device == nullptr) {
+      state.SkipWithError("No Vulkan device on this host.");
+      return nullptr;
+    }
+    const TestImageLayout layout = device->supportsYcbcrInput() ? TestImageLayout::NV12 : TestImageLayout::RGBA;
+    const bool isFloat = static_cast<BenchmarkTarget>(state.range(0)) == BenchmarkTarget::RGB_FLOAT32_PLANAR;
+    const ResizerOptions options = makeOptions(kOutputSize.width, kOutputSize.height, ChannelOrder::RGB, isFloat ? DataType::FLOAT32 : DataType::UINT8,
+                                               ScaleMode::COVER, isFloat ? PixelLayout::PLANAR : PixelLayout::INTERLEAVED, ResizeFilter::BILINEAR);
+
+    auto fixture = std::make_unique<BenchmarkFixture>(device, layout, options);
+    state.SetLabel(layout == TestImageLayout::NV12 ? "NV12 input" : "RGBA input");
+    return fixture;
+  }
+
+  void setBytesProcessed(benchmark::State& state, const HostResizerPipeline& pipeline) {
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(pipeline.getOutput().size()));
+  }
+
+} // namespace
+
+/**
+ * CPU cost of recording one resize into its command buffer.
+ */
+static void BM_Record(benchmark::State& state) {
+  const std::unique_ptr<BenchmarkFixture> fixture = makeFixture(state);
+  if (fixture == nullptr) {
+    return;
+  }
+  for (auto _ : state) {
+    fixture->pipeline.record(kOutputSize, 90, false, kFullRegion);
+  }
+}
+
+/**
+ * GPU time of one resize, as seen by the host: submit, then block on the fence.
+ */
+static void BM_SubmitAndWait(benchmark::State& state) {
+  const std::unique_ptr<BenchmarkFixture> fixture = makeFixture(state);
+  if (fixture == nullptr) {
+    return;
+  }
+  fixture->pipeline.record(kOutputSize, 90, false, kFullRegion);
+  for (auto _ : state) {
+    fixture->pipeline.submit();
+    fixture->pipeline.wait();
+  }
+  setBytesProcessed(state, fixture->pipeline);
+}
+
+/**
+ * Cost of making the output visible to the host, which `VulkanResizerPipeline` pays before every JS read.
+ */
+static void BM_Invalidate(benchmark::State& state) {
+  const std::unique_ptr<BenchmarkFixture> fixture = makeFixture(state);
+  if (fixture == nullptr) {
+    return;
+  }
+  static_cast<void>(fixture->pipeline.resize(kOutputSize, 90, false, kFullRegion));
+  for (auto _ : state) {
+    fixture->pipeline.invalidate();
+    benchmark::DoNotOptimize(fixture->pipeline.getOutput().data());
+  }
+}
+
+/**
+ * One full resize: record, submit, wait and invalidate.
+ */
+static void BM_EndToEnd(benchmark::State& state) {
+  const std::unique_ptr<BenchmarkFixture> fixture = makeFixture(state);
+  if (fixture == nullptr) {
+    return;
+  }
+  for (auto _ : state) {
+    fixture->pipeline.record(kOutputSize, 90, false, kFullRegion);
+    fixture->pipeline.submit();
+    fixture->pipeline.wait();
+    fixture->pipeline.invalidate();
+    benchmark::DoNotOptimize(fixture->pipeline.getOutput().data());
+  }
+  setBytesProcessed(state, fixture->pipeline);
+}
+
+#define RESIZER_BENCHMARK_TARGETS(benchmarkFunction)                                                                                                            \
+  BENCHMARK(benchmarkFunction)                                                                                                                                  \
+      ->ArgName("target")                                                                                                                                       \
+      ->Arg(static_cast<int64_t>(BenchmarkTarget::RGB_UINT8_INTERLEAVED))                                                                                       \
+      ->Arg(static_cast<int64_t>(BenchmarkTarget::RGB_FLOAT32_PLANAR))                                                                                          \
+      ->Unit(benchmark::kMicrosecond)
+
+RESIZER_BENCHMARK_TARGETS(BM_Record);
+RESIZER_BENCHMARK_TARGETS(BM_SubmitAndWait)->UseRealTime();
+RESIZER_BENCHMARK_TARGETS(BM_Invalidate);
+RESIZER_BENCHMARK_TARGETS(BM_EndToEnd)->UseRealTime();
+
+} // namespace margelo::nitro::camera::resizer::host_tests
@@ -0,0 +1,170 @@
+///
+/// VulkanResizerShaderSpecializationTest.cpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#include "HostVulkanDevice.hpp"
+#include "ResizerTestSupport.hpp"
+
+#include "vulkan/VulkanResizerShaderConfig.hpp"
+
+#include <gtest/gtest.h>
+#include <spirv-tools/libspirv.hpp>
+#include <spirv-tools/optimizer.hpp>
+
+#include <array>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace margelo::nitro::camera::resizer::host_tests {
+
+namespace {
+
+  using ShaderSpecializationData = vulkan::shader_config::ShaderSpecializationData;
+  using WorkgroupSize = vulkan::VulkanPipelineCache::WorkgroupSize;
+
+  // Android requires Vulkan 1.1, and `build.gradle` compiles the shader for it.
+  constexpr spv_target_env kTargetEnvironment = SPV_ENV_VULKAN_1_1;
+  // `48` pixel wide outputs take the packed 4 (8-bit) or 2 (FLOAT16) pixels per invocation path, `45` the 1 pixel per invocation path.
+  constexpr std::array<uint32_t, 2> kOutputWidths = {48, 45};
+  constexpr uint32_t kOutputHeight = 32;
+
+  using SpecializationTestParam = std::tuple<DataType, ChannelOrder, PixelLayout, ScaleMode, ResizeFilter>;
+
+  /**
+   * Gets every specialization constant of `data` by its `constant_id`, exactly as `asVkInfo()` hands them to the driver.
+   */
+  [[nodiscard]] std::unordered_map<uint32_t, std::vector<uint32_t>> getSpecializationValues(const ShaderSpecializationData& data) {
+    const VkSpecializationInfo info = data.asVkInfo();
+    std::unordered_map<uint32_t, std::vector<uint32_t>> values;
+    for (uint32_t index = 0; index < info.mapEntryCount; index++) {
+      const VkSpecializationMapEntry& entry = info.pMapEntries[index];
+      // Every constant of `Resizer.comp` is a 32-bit `uint` or `float`.
+      uint32_t word = 0;
+      std::memcpy(&word, static_cast<const uint8_t*>(info.pData) + entry.offset, sizeof(word));
+      values[entry.constantID] = {word};
+    }
+    return values;
+  }
+
+  /**
+   * The outcome of specializing `Resizer.comp`, with every message SPIRV-Tools reported on the way.
+   */
+  struct SpecializationResult final {
+    bool isValid{false};
+    std::string messages;
+  };
+
+  /**
+   * Specializes `spirv` for `data` the way a driver does at pipeline creation: every specialization constant is frozen to its
+   * value, everything derived from them is folded, and the branches they disable are removed. The result is then validated.
+   */
+  [[nodiscard]] SpecializationResult specializeAndValidate(const std::vector<uint32_t>& spirv, const ShaderSpecializationData& data) {
+    SpecializationResult result{};
+    const spvtools::MessageConsumer consumer = [&result](spv_message_level_t, const char*, const spv_position_t& position, const char* message) {
+      result.messages += "[word " + std::to_string(position.index) + "] " + message + "\n";
+    };
+
+    spvtools::Optimizer optimizer(kTargetEnvironment);
+    optimizer.SetMessageConsumer(consumer);
+    optimizer.RegisterPass(spvtools::CreateSetSpecConstantDefaultValuePass(getSpecializationValues(data)))
+        .RegisterPass(spvtools::CreateFreezeSpecConstantValuePass())
+        .RegisterPass(spvtools::CreateFoldSpecConstantOpAndCompositePass())
+        .RegisterPass(spvtools::CreateUnifyConstantPass())
+        .RegisterPass(spvtools::CreateDeadBranchElimPass())
+        .RegisterPass(spvtools::CreateAggressiveDCEPass())
+        .RegisterPass(spvtools::CreateEliminateDeadConstantPass());
+    std::vector<uint32_t> specialized;
+    // `Run(...)` validates its input first, so this also rejects an unspecialized shader that is invalid on its own.
+    if (!optimizer.Run(spirv.data(), spirv.size(), &specialized)) {
+      return result;
+    }
+
+    spvtools::SpirvTools tools(kTargetEnvironment);
+    tools.SetMessageConsumer(consumer);
+    result.isValid = tools.Validate(specialized);
+    return result;
+  }
+
+  [[nodiscard]] const std::vector<uint32_t>& getResizerShaderSpirv() {
+    static const std::vector<uint32_t> spirv = readResizerShaderSpirv();
+    return spirv;
+  }
+
+  [[nodiscard]] std::string getTestName(const testing::TestParamInfo<SpecializationTestParam>& info) {
+    const auto& [dataType, channelOrder, pixelLayout, scaleMode, filter] = info.param;
+    std::string name = getDataTypeName(dataType) + getChannelOrderName(channelOrder);
+    name += pixelLayout == PixelLayout::PLANAR ? "Planar" : "Interleaved";
+    switch (scaleMode) {
+      case ScaleMode::COVER:
+        name += "Cover";
+        break;
+      case ScaleMode::CONTAIN:
+        name += "Contain";
+        break;
+      case ScaleMode::STRETCH:
+        name += "Stretch";
+        break;
+    }
+    name += filter == ResizeFilter::AREA ? "Area" : "Bilinear";
+    return name;
+  }
+
+  class VulkanResizerShaderSpecializationTest : public testing::TestWithParam<SpecializationTestParam> {};
+
+} // namespace
+
+/**
+ * Every pipeline `VulkanResizerPipeline` may create must specialize into valid SPIR-V, without needing a Vulkan device.
+ */
+TEST_P(VulkanResizerShaderSpecializationTest, SpecializesToValidSpirv) {
+  const auto& [dataType, channelOrder, pixelLayout, scaleMode, filter] = GetParam();
+  // Only gray-only pipelines of YCbCr inputs sample luma directly, see `VulkanResizerPipeline::samplesLuma(...)`.
+  const std::vector<bool> lumaInputs = channelOrder == ChannelOrder::GRAY ? std::vector<bool>{false, true} : std::vector<bool>{false};
+
+  for (const uint32_t outputWidth : kOutputWidths) {
+    for (const bool isFrameStatisticsEnabled : {false, true}) {
+      ResizerOptions options = makeOptions(outputWidth, kOutputHeight, channelOrder, dataType, scaleMode, pixelLayout, filter);
+      options.enableFrameStatistics = isFrameStatisticsEnabled;
+      for (const bool isLumaInput : lumaInputs) {
+        SCOPED_TRACE(testing::Message() << outputWidth << " pixels wide" << (isFrameStatisticsEnabled ? ", with Frame statistics" : "")
+                                        << (isLumaInput ? ", sampling luma" : ""));
+        const ShaderSpecializationData data = ShaderSpecializationData::make(options, WorkgroupSize{}, isLumaInput);
+        const SpecializationResult result = specializeAndValidate(getResizerShaderSpirv(), data);
+        EXPECT_TRUE(result.isValid) << result.messages;
+      }
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(AllSpecializations, VulkanResizerShaderSpecializationTest,
+                         testing::Combine(testing::Values(DataType::INT8, DataType::UINT8, DataType::FLOAT16, DataType::FLOAT32),
+                                          testing::Values(ChannelOrder::RGB, ChannelOrder::BGR, ChannelOrder::GRAY, ChannelOrder::RGBA,
+                                                          ChannelOrder::BGRA, ChannelOrder::ARGB),
+                                          testing::Values(PixelLayout::INTERLEAVED, PixelLayout::PLANAR),
+                                          testing::Values(ScaleMode::COVER, ScaleMode::CONTAIN, ScaleMode::STRETCH),
+                                          testing::Values(ResizeFilter::BILINEAR, ResizeFilter::AREA)),
+                         getTestName);
+
+/**
+ * Every workgroup size the calibration may pick (and a subgroup-wide row on GPUs with more than 64 lanes) must specialize too.
+ */
+TEST(VulkanResizerWorkgroupSizeSpecializationTest, SpecializesAllCandidates) {
+  const std::array<WorkgroupSize, 5> workgroupSizes = {
+      WorkgroupSize{.x = 8, .y = 8},  WorkgroupSize{.x = 16, .y = 4}, WorkgroupSize{.x = 32, .y = 2},
+      WorkgroupSize{.x = 64, .y = 1}, WorkgroupSize{.x = 128, .y = 1},
+  };
+  const ResizerOptions options =
+      makeOptions(kOutputWidths[0], kOutputHeight, ChannelOrder::RGB, DataType::UINT8, ScaleMode::COVER, PixelLayout::INTERLEAVED, ResizeFilter::BILINEAR);
+  for (const WorkgroupSize& workgroupSize : workgroupSizes) {
+    SCOPED_TRACE(testing::Message() << "Workgroup size " << workgroupSize.x << "x" << workgroupSize.y);
+    const SpecializationResult result = specializeAndValidate(getResizerShaderSpirv(), ShaderSpecializationData::make(options, workgroupSize, false));
+    EXPECT_TRUE(result.isValid) << result.messages;
+  }
+}
+
+} // namespace margelo::nitro::camera::resizer::host_tests
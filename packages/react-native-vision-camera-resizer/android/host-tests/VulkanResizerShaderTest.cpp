@@ -0,0 +1,185 @@
+///
+/// VulkanResizerShaderTest.cpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#include "HostResizerPipeline.hpp"
+#include "HostVulkanDevice.hpp"
+#include "ResizerTestSupport.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace margelo::nitro::camera::resizer::host_tests {
+
+namespace {
+
+  using OutputSize = margelo::nitro::camera::resizer::utils::OutputSize;
+  using CropRegion = margelo::nitro::camera::resizer::utils::CropRegion;
+
+  // An odd-sized input, so chroma blocks and texel centers never line up with the output grid by accident.
+  constexpr uint32_t kInputWidth = 98;
+  constexpr uint32_t kInputHeight = 74;
+  // Outputs are compared against the CPU kernel within 2 steps. Pixels straddling a `ScaleMode.contain` letterbox edge or a
+  // crop edge may legitimately land on either side, so a small share of values is allowed to differ by more.
+  constexpr double kToleranceSteps = 2.0;
+  constexpr double kMaxMismatchRatio = 0.005;
+
+  constexpr std::array<int, 4> kRotations = {0, 90, 180, 270};
+  constexpr std::array<CropRegion, 2> kRegions = {
+      CropRegion{.x = 0.0f, .y = 0.0f, .width = 1.0f, .height = 1.0f},
+      CropRegion{.x = 0.25f, .y = 0.125f, .width = 0.5f, .height = 0.75f},
+  };
+
+  /**
+   * The configured output size, and the size each `resize(...)` requests. `48x32` outputs take the packed 4 (8-bit) or 2 (FLOAT16)
+   * pixels per invocation path, `45x31` the 1 pixel per invocation path, and a smaller requested size exercises `ResizeOptions`.
+   */
+  struct SizeCase final {
+    OutputSize configuredSize;
+    OutputSize requestedSize;
+  };
+
+  constexpr std::array<SizeCase, 3> kSizeCases = {
+      SizeCase{.configuredSize = {48, 32}, .requestedSize = {48, 32}},
+      SizeCase{.configuredSize = {45, 31}, .requestedSize = {45, 31}},
+      SizeCase{.configuredSize = {48, 32}, .requestedSize = {45, 31}},
+  };
+
+  using ShaderTestParam = std::tuple<DataType, ChannelOrder, PixelLayout, ScaleMode, ResizeFilter, TestImageLayout>;
+
+  [[nodiscard]] std::shared_ptr<HostVulkanDevice> getDeviceFor(TestImageLayout layout) {
+    std::shared_ptr<HostVulkanDevice> device = HostVulkanDevice::getShared();
+    if (device == nullptr || (layout != TestImageLayout::RGBA && !device->supportsYcbcrInput())) {
+      return nullptr;
+    }
+    return device;
+  }
+
+  /**
+   * Counts whole output words the shader left at `HostResizerPipeline::kUnwrittenWord`, although the CPU kernel wrote something else.
+   */
+  [[nodiscard]] size_t countUnwrittenWords(std::span<const uint8_t> expected, std::span<const uint8_t> actual) {
+    size_t unwrittenWordCount = 0;
+    for (size_t offset = 0; offset + sizeof(uint32_t) <= actual.size(); offset += sizeof(uint32_t)) {
+      uint32_t actualWord = 0;
+      uint32_t expectedWord = 0;
+      std::memcpy(&actualWord, actual.data() + offset, sizeof(uint32_t));
+      std::memcpy(&expectedWord, expected.data() + offset, sizeof(uint32_t));
+      if (actualWord == HostResizerPipeline::kUnwrittenWord && expectedWord != HostResizerPipeline::kUnwrittenWord) {
+        unwrittenWordCount++;
+      }
+    }
+    return unwrittenWordCount;
+  }
+
+  [[nodiscard]] std::string getTestName(const testing::TestParamInfo<ShaderTestParam>& info) {
+    const auto& [dataType, channelOrder, pixelLayout, scaleMode, filter, imageLayout] = info.param;
+    std::string name = getDataTypeName(dataType) + getChannelOrderName(channelOrder);
+    name += pixelLayout == PixelLayout::PLANAR ? "Planar" : "Interleaved";
+    switch (scaleMode) {
+      case ScaleMode::COVER:
+        name += "Cover";
+        break;
+      case ScaleMode::CONTAIN:
+        name += "Contain";
+        break;
+      case ScaleMode::STRETCH:
+        name += "Stretch";
+        break;
+    }
+    name += filter == ResizeFilter::AREA ? "Area" : "Bilinear";
+    name += imageLayout == TestImageLayout::RGBA ? "FromRgba" : "FromNv12";
+    return name;
+  }
+
+  class VulkanResizerShaderTest : public testing::TestWithParam<ShaderTestParam> {};
+
+} // namespace
+
+TEST_P(VulkanResizerShaderTest, MatchesCpuKernel) {
+  const auto& [dataType, channelOrder, pixelLayout, scaleMode, filter, imageLayout] = GetParam();
+  const std::shared_ptr<HostVulkanDevice> device = getDeviceFor(imageLayout);
+  if (device == nullptr) {
+    GTEST_SKIP() << "No Vulkan device on this host can sample this input.";
+  }
+  const TestImage testImage = TestImage::makeGradient(imageLayout, kInputWidth, kInputHeight);
+
+  for (const SizeCase& sizeCase : kSizeCases) {
+    const ResizerOptions options =
+        makeOptions(sizeCase.configuredSize.width, sizeCase.configuredSize.height, channelOrder, dataType, scaleMode, pixelLayout, filter);
+    const double tolerance = getOutputTolerance(options, kToleranceSteps);
+    HostResizerPipeline pipeline(device, testImage.getImage(), options);
+
+    for (const int rotationDegrees : kRotations) {
+      for (const bool isMirrored : {false, true}) {
+        for (const CropRegion& region : kRegions) {
+          SCOPED_TRACE(testing::Message() << sizeCase.requestedSize.width << "x" << sizeCase.requestedSize.height << " of a "
+                                          << sizeCase.configuredSize.width << "x" << sizeCase.configuredSize.height << " Resizer, rotated by "
+                                          << rotationDegrees << (isMirrored ? ", mirrored" : "") << ", region {" << region.x << ", " << region.y << ", "
+                                          << region.width << ", " << region.height << "}");
+          const std::vector<uint8_t> expected =
+              resizeOnCpu(testImage.getImage(), options, sizeCase.requestedSize, rotationDegrees, isMirrored, region);
+          const std::vector<uint8_t> actual = pipeline.resize(sizeCase.requestedSize, rotationDegrees, isMirrored, region);
+          ASSERT_EQ(actual.size(), expected.size());
+
+          EXPECT_EQ(countUnwrittenWords(expected, actual), 0u) << "The shader left output words unwritten.";
+          const OutputComparison comparison = compareOutputs(dataType, expected, actual, tolerance);
+          EXPECT_LE(static_cast<double>(comparison.mismatchCount), kMaxMismatchRatio * static_cast<double>(comparison.valueCount))
+              << comparison.describe();
+        }
+      }
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(AllSpecializations, VulkanResizerShaderTest,
+                         testing::Combine(testing::Values(DataType::INT8, DataType::UINT8, DataType::FLOAT16, DataType::FLOAT32),
+                                          testing::Values(ChannelOrder::RGB, ChannelOrder::BGR, ChannelOrder::GRAY, ChannelOrder::RGBA,
+                                                          ChannelOrder::BGRA, ChannelOrder::ARGB),
+                                          testing::Values(PixelLayout::INTERLEAVED, PixelLayout::PLANAR),
+                                          testing::Values(ScaleMode::COVER, ScaleMode::CONTAIN, ScaleMode::STRETCH),
+                                          testing::Values(ResizeFilter::BILINEAR, ResizeFilter::AREA),
+                                          testing::Values(TestImageLayout::RGBA, TestImageLayout::NV12)),
+                         getTestName);
+
+/**
+ * Every workgroup size the calibration may pick must produce the same output as the default 8x8.
+ */
+TEST(VulkanResizerWorkgroupSizeTest, AllCandidatesMatchDefault) {
+  const std::shared_ptr<HostVulkanDevice> device = getDeviceFor(TestImageLayout::NV12);
+  if (device == nullptr) {
+    GTEST_SKIP() << "No Vulkan device on this host can sample NV12 inputs.";
+  }
+  const TestImage testImage = TestImage::makeGradient(TestImageLayout::NV12, kInputWidth, kInputHeight);
+  const std::array<vulkan::VulkanPipelineCache::WorkgroupSize, 5> workgroupSizes = {
+      vulkan::VulkanPipelineCache::WorkgroupSize{.x = 16, .y = 4},  vulkan::VulkanPipelineCache::WorkgroupSize{.x = 32, .y = 2},
+      vulkan::VulkanPipelineCache::WorkgroupSize{.x = 64, .y = 1},  vulkan::VulkanPipelineCache::WorkgroupSize{.x = 4, .y = 16},
+      vulkan::VulkanPipelineCache::WorkgroupSize{.x = 128, .y = 1},
+  };
+
+  for (const DataType dataType : {DataType::UINT8, DataType::FLOAT32}) {
+    for (const SizeCase& sizeCase : kSizeCases) {
+      const ResizerOptions options = makeOptions(sizeCase.configuredSize.width, sizeCase.configuredSize.height, ChannelOrder::RGB, dataType,
+                                                 ScaleMode::COVER, PixelLayout::INTERLEAVED, ResizeFilter::BILINEAR);
+      HostResizerPipeline defaultPipeline(device, testImage.getImage(), options);
+      const std::vector<uint8_t> expected = defaultPipeline.resize(sizeCase.requestedSize, 90, true, kRegions[1]);
+
+      for (const vulkan::VulkanPipelineCache::WorkgroupSize& workgroupSize : workgroupSizes) {
+        SCOPED_TRACE(testing::Message() << "workgroup " << workgroupSize.x << "x" << workgroupSize.y << ", " << getDataTypeName(dataType) << ", "
+                                        << sizeCase.requestedSize.width << "x" << sizeCase.requestedSize.height);
+        HostResizerPipeline pipeline(device, testImage.getImage(), options, workgroupSize);
+        EXPECT_EQ(pipeline.resize(sizeCase.requestedSize, 90, true, kRegions[1]), expected);
+      }
+    }
+  }
+}
+
+} // namespace margelo::nitro::camera::resizer::host_tests
@@ -0,0 +1,132 @@
+///
+/// HybridCpuMultiResizer.cpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#include "HybridCpuMultiResizer.hpp"
+
+#include "HybridGPUFrame.hpp"
+#include "utils/FrameOrientation.hpp"
+#include "utils/ScopedNativeBuffer.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace margelo::nitro::camera::resizer {
+
+namespace {
+
+  /**
+   * Reject per-call output sizes, since every output of a MultiResizer has its own fixed size.
+   */
+  void validateResizeOptions(const std::optional<ResizeOptions>& options) {
+    if (options.has_value() && (options->width.has_value() || options->height.has_value())) [[unlikely]] {
+      throw std::runtime_error("MultiResizer does not support ResizeOptions.width/height, every output has its own fixed size.");
+    }
+  }
+
+  /**
+   * Resize `hardwareBuffer` with every pipeline in order, wrapping each output as a GPUFrame.
+   * If one target fails, the outputs of the previous targets are dropped and returned to their pools as the error propagates.
+   */
+  std::vector<std::shared_ptr<HybridGPUFrameSpec>> runAll(const std::vector<std::shared_ptr<cpu::CpuResizerPipeline>>& pipelines,
+                                                          AHardwareBuffer* hardwareBuffer, int rotationDegrees, bool isMirrored,
+                                                          const std::optional<ResizeOptions>& options) {
+    std::vector<std::shared_ptr<HybridGPUFrameSpec>> gpuFrames;
+    gpuFrames.reserve(pipelines.size());
+    for (const std::shared_ptr<cpu::CpuResizerPipeline>& pipeline : pipelines) {
+      std::shared_ptr<vulkan::VulkanBufferView> outputBufferView = pipeline->run(hardwareBuffer, rotationDegrees, isMirrored, options);
+      gpuFrames.push_back(std::make_shared<HybridGPUFrame>(std::move(outputBufferView)));
+    }
+    return gpuFrames;
+  }
+
+} // namespace
+
+HybridCpuMultiResizer::HybridCpuMultiResizer(const std::vector<ResizerOptions>& targets) : HybridObject(TAG) {
+  if (targets.empty()) [[unlikely]] {
+    throw std::runtime_error("MultiResizer requires at least one ResizerOptions.");
+  }
+
+  _pipelines.reserve(targets.size());
+  for (const ResizerOptions& options : targets) {
+    _pipelines.push_back(std::make_shared<cpu::CpuResizerPipeline>(options));
+  }
+}
+
+std::vector<std::shared_ptr<HybridGPUFrameSpec>> HybridCpuMultiResizer::resize(const std::shared_ptr<camera::HybridFrameSpec>& frame,
+                                                                               const std::optional<ResizeOptions>& options) {
+  if (_pipelines.empty()) [[unlikely]] {
+    throw std::runtime_error("This MultiResizer has already been disposed!");
+  }
+  validateResizeOptions(options);
+
+  // Keep the NativeBuffer alive while its AHardwareBuffer is locked for CPU reads.
+  ScopedNativeBuffer nativeBuffer(frame->getNativeBuffer());
+  AHardwareBuffer* hardwareBuffer = nativeBuffer.getHardwareBuffer();
+  if (hardwareBuffer == nullptr) [[unlikely]] {
+    throw std::runtime_error("Frame NativeBuffer pointer (AHardwareBuffer*) is null!");
+  }
+
+  const int rotationDegrees = utils::orientationToDegrees(frame->getOrientation());
+  const bool isMirrored = frame->getIsMirrored();
+  return runAll(_pipelines, hardwareBuffer, rotationDegrees, isMirrored, options);
+}
+
+std::shared_ptr<Promise<std::vector<std::shared_ptr<HybridGPUFrameSpec>>>>
+HybridCpuMultiResizer::resizeAsync(const std::shared_ptr<camera::HybridFrameSpec>& frame, const std::optional<ResizeOptions>& options) {
+  if (_pipelines.empty()) [[unlikely]] {
+    throw std::runtime_error("This MultiResizer has already been disposed!");
+  }
+  validateResizeOptions(options);
+
+  // The CPU reads the AHardwareBuffer after this method returns, so keep the NativeBuffer alive until the resize finished.
+  auto nativeBuffer = std::make_shared<ScopedNativeBuffer>(frame->getNativeBuffer());
+  if (nativeBuffer->getHardwareBuffer() == nullptr) [[unlikely]] {
+    throw std::runtime_error("Frame NativeBuffer pointer (AHardwareBuffer*) is null!");
+  }
+
+  // Read the Frame's metadata now, so the caller may release the Frame as soon as this returns.
+  const int rotationDegrees = utils::orientationToDegrees(frame->getOrientation());
+  const bool isMirrored = frame->getIsMirrored();
+
+  return Promise<std::vector<std::shared_ptr<HybridGPUFrameSpec>>>::async(
+      [pipelines = _pipelines, nativeBuffer = std::move(nativeBuffer), rotationDegrees, isMirrored,
+       options = options]() -> std::vector<std::shared_ptr<HybridGPUFrameSpec>> {
+        return runAll(pipelines, nativeBuffer->getHardwareBuffer(), rotationDegrees, isMirrored, options);
+      });
+}
+
+void HybridCpuMultiResizer::dispose() {
+  if (_pipelines.empty()) {
+    return;
+  }
+
+  const bool hasActiveOutputView = std::any_of(_pipelines.begin(), _pipelines.end(),
+                                               [](const std::shared_ptr<cpu::CpuResizerPipeline>& pipeline) { return pipeline->hasActiveOutputView(); });
+  if (hasActiveOutputView) [[unlikely]] {
+    throw std::runtime_error("Previous GPUFrame is still active. Dispose it before disposing the MultiResizer.");
+  }
+
+  _pipelines.clear();
+}
+
+ResizerStatistics HybridCpuMultiResizer::getStatistics() {
+  if (_pipelines.empty()) [[unlikely]] {
+    throw std::runtime_error("This MultiResizer has already been disposed!");
+  }
+
+  // Inputs are locked for CPU reads directly, so there is no import cache, and profiling only covers the Vulkan stages.
+  return ResizerStatistics(std::nullopt, std::nullopt);
+}
+
+size_t HybridCpuMultiResizer::getExternalMemorySize() noexcept {
+  size_t size = 0;
+  for (const std::shared_ptr<cpu::CpuResizerPipeline>& pipeline : _pipelines) {
+    size += pipeline->getOutputBufferAllocationSize();
+  }
+  return size;
+}
+
+} // namespace margelo::nitro::camera::resizer
@@ -0,0 +1,44 @@
+///
+/// HybridCpuMultiResizer.hpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include "HybridMultiResizerSpec.hpp"
+#include "ResizeOptions.hpp"
+#include "ResizerOptions.hpp"
+#include "ResizerStatistics.hpp"
+#include "cpu/CpuResizerPipeline.hpp"
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace margelo::nitro::camera::resizer {
+
+/**
+ * An implementation of `HybridMultiResizerSpec` that runs one `CpuResizerPipeline` per target, for devices without
+ * usable Vulkan support. Produces exactly the same outputs as `HybridMultiResizer`, just slower.
+ */
+class HybridCpuMultiResizer final : public HybridMultiResizerSpec {
+public:
+  explicit HybridCpuMultiResizer(const std::vector<ResizerOptions>& targets);
+  ~HybridCpuMultiResizer() override = default;
+
+  std::vector<std::shared_ptr<HybridGPUFrameSpec>> resize(const std::shared_ptr<camera::HybridFrameSpec>& frame,
+                                                          const std::optional<ResizeOptions>& options) override;
+  std::shared_ptr<Promise<std::vector<std::shared_ptr<HybridGPUFrameSpec>>>> resizeAsync(const std::shared_ptr<camera::HybridFrameSpec>& frame,
+                                                                                         const std::optional<ResizeOptions>& options) override;
+  void dispose() override;
+  ResizerStatistics getStatistics() override;
+  size_t getExternalMemorySize() noexcept override;
+
+private:
+  // One pipeline per target, in order. Shared so that pending resizeAsync() calls keep them alive until they finished.
+  // Empty once disposed.
+  std::vector<std::shared_ptr<cpu::CpuResizerPipeline>> _pipelines;
+};
+
+} // namespace margelo::nitro::camera::resizer
@@ -0,0 +1,107 @@
+///
+/// HybridCpuResizer.cpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#include "HybridCpuResizer.hpp"
+
+#include "HybridGPUFrame.hpp"
+#include "utils/FrameOrientation.hpp"
+#include "utils/ScopedNativeBuffer.hpp"
+
+#include <stdexcept>
+
+namespace margelo::nitro::camera::resizer {
+
+HybridCpuResizer::HybridCpuResizer(const ResizerOptions& options) : HybridObject(TAG), _pipeline(std::make_shared<cpu::CpuResizerPipeline>(options)) {}
+
+std::shared_ptr<HybridGPUFrameSpec> HybridCpuResizer::resize(const std::shared_ptr<camera::HybridFrameSpec>& frame,
+                                                             const std::optional<ResizeOptions>& options) {
+  if (_pipeline == nullptr) [[unlikely]] {
+    throw std::runtime_error("This Resizer has already been disposed!");
+  }
+
+  // Keep the NativeBuffer alive while its AHardwareBuffer is locked for CPU reads.
+  ScopedNativeBuffer nativeBuffer(frame->getNativeBuffer());
+  AHardwareBuffer* hardwareBuffer = nativeBuffer.getHardwareBuffer();
+  if (hardwareBuffer == nullptr) [[unlikely]] {
+    throw std::runtime_error("Frame NativeBuffer pointer (AHardwareBuffer*) is null!");
+  }
+
+  const int rotationDegrees = utils::orientationToDegrees(frame->getOrientation());
+  const bool isMirrored = frame->getIsMirrored();
+  std::shared_ptr<vulkan::VulkanBufferView> outputBufferView = _pipeline->run(hardwareBuffer, rotationDegrees, isMirrored, options);
+
+  return std::make_shared<HybridGPUFrame>(std::move(outputBufferView));
+}
+
+std::shared_ptr<HybridGPUFrameSpec> HybridCpuResizer::resizeBatch(const std::shared_ptr<camera::HybridFrameSpec>& frame, const std::vector<Rect>& regions) {
+  if (_pipeline == nullptr) [[unlikely]] {
+    throw std::runtime_error("This Resizer has already been disposed!");
+  }
+
+  // Keep the NativeBuffer alive while its AHardwareBuffer is locked for CPU reads.
+  ScopedNativeBuffer nativeBuffer(frame->getNativeBuffer());
+  AHardwareBuffer* hardwareBuffer = nativeBuffer.getHardwareBuffer();
+  if (hardwareBuffer == nullptr) [[unlikely]] {
+    throw std::runtime_error("Frame NativeBuffer pointer (AHardwareBuffer*) is null!");
+  }
+
+  const int rotationDegrees = utils::orientationToDegrees(frame->getOrientation());
+  const bool isMirrored = frame->getIsMirrored();
+  std::shared_ptr<vulkan::VulkanBufferView> outputBufferView = _pipeline->runBatch(hardwareBuffer, rotationDegrees, isMirrored, regions);
+
+  return std::make_shared<HybridGPUFrame>(std::move(outputBufferView));
+}
+
+std::shared_ptr<Promise<std::shared_ptr<HybridGPUFrameSpec>>> HybridCpuResizer::resizeAsync(const std::shared_ptr<camera::HybridFrameSpec>& frame,
+                                                                                             const std::optional<ResizeOptions>& options) {
+  if (_pipeline == nullptr) [[unlikely]] {
+    throw std::runtime_error("This Resizer has already been disposed!");
+  }
+
+  // The CPU reads the AHardwareBuffer after this method returns, so keep the NativeBuffer alive until the resize finished.
+  auto nativeBuffer = std::make_shared<ScopedNativeBuffer>(frame->getNativeBuffer());
+  if (nativeBuffer->getHardwareBuffer() == nullptr) [[unlikely]] {
+    throw std::runtime_error("Frame NativeBuffer pointer (AHardwareBuffer*) is null!");
+  }
+
+  // Read the Frame's metadata now, so the caller may release the Frame as soon as this returns.
+  const int rotationDegrees = utils::orientationToDegrees(frame->getOrientation());
+  const bool isMirrored = frame->getIsMirrored();
+
+  return Promise<std::shared_ptr<HybridGPUFrameSpec>>::async(
+      [pipeline = _pipeline, nativeBuffer = std::move(nativeBuffer), rotationDegrees, isMirrored,
+       options = options]() -> std::shared_ptr<HybridGPUFrameSpec> {
+        std::shared_ptr<vulkan::VulkanBufferView> outputBufferView = pipeline->run(nativeBuffer->getHardwareBuffer(), rotationDegrees, isMirrored, options);
+        return std::make_shared<HybridGPUFrame>(std::move(outputBufferView));
+      });
+}
+
+void HybridCpuResizer::dispose() {
+  if (_pipeline == nullptr) {
+    return;
+  }
+
+  if (_pipeline->hasActiveOutputView()) [[unlikely]] {
+    throw std::runtime_error("Previous GPUFrame is still active. Dispose it before disposing the Resizer.");
+  }
+
+  _pipeline = nullptr;
+}
+
+ResizerStatistics HybridCpuResizer::getStatistics() {
+  if (_pipeline == nullptr) [[unlikely]] {
+    throw std::runtime_error("This Resizer has already been disposed!");
+  }
+
+  // Inputs are locked for CPU reads directly, so there is no import cache, and profiling only covers the Vulkan stages.
+  return ResizerStatistics(std::nullopt, std::nullopt);
+}
+
+size_t HybridCpuResizer::getExternalMemorySize() noexcept {
+  return _pipeline != nullptr ? _pipeline->getOutputBufferAllocationSize() : 0;
+}
+
+} // namespace margelo::nitro::camera::resizer
@@ -0,0 +1,44 @@
+///
+/// HybridCpuResizer.hpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include "HybridResizerSpec.hpp"
+#include "ResizeOptions.hpp"
+#include "ResizerOptions.hpp"
+#include "ResizerStatistics.hpp"
+#include "cpu/CpuResizerPipeline.hpp"
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace margelo::nitro::camera::resizer {
+
+/**
+ * An implementation of `HybridResizerSpec` that resizes and converts on the CPU, for devices without usable Vulkan support.
+ * Produces exactly the same outputs as `HybridResizer`, just slower.
+ */
+class HybridCpuResizer final : public HybridResizerSpec {
+public:
+  explicit HybridCpuResizer(const ResizerOptions& options);
+  ~HybridCpuResizer() override = default;
+
+  std::shared_ptr<HybridGPUFrameSpec> resize(const std::shared_ptr<camera::HybridFrameSpec>& frame,
+                                             const std::optional<ResizeOptions>& options) override;
+  std::shared_ptr<HybridGPUFrameSpec> resizeBatch(const std::shared_ptr<camera::HybridFrameSpec>& frame, const std::vector<Rect>& regions) override;
+  std::shared_ptr<Promise<std::shared_ptr<HybridGPUFrameSpec>>> resizeAsync(const std::shared_ptr<camera::HybridFrameSpec>& frame,
+                                                                            const std::optional<ResizeOptions>& options) override;
+  void dispose() override;
+  ResizerStatistics getStatistics() override;
+  size_t getExternalMemorySize() noexcept override;
+
+private:
+  // Shared so that pending resizeAsync() calls keep the pipeline alive until they finished.
+  std::shared_ptr<cpu::CpuResizerPipeline> _pipeline;
+};
+
+} // namespace margelo::nitro::camera::resizer
@@ -6,11 +6,51 @@
 
 #include "HybridGPUFrame.hpp"
 
+#include "utils/ResizeTransformMapping.hpp"
+
+#include <android/hardware_buffer.h>
+#include <cmath>
+#include <cstdint>
 #include <stdexcept>
+#include <string>
 #include <utility>
 
 namespace margelo::nitro::camera::resizer {
 
+namespace {
+
+  /**
+   * Keeps a native output slot checked out, and its `AHardwareBuffer` referenced, until the consumer releases it.
+   * Releasing is idempotent, and also happens if the `NativeBuffer` is garbage-collected without being released.
+   */
+  class NativeBufferLease final {
+  public:
+    explicit NativeBufferLease(std::shared_ptr<vulkan::VulkanBufferView> bufferView) : _bufferView(std::move(bufferView)) {
+      AHardwareBuffer_acquire(_bufferView->getHardwareBuffer());
+    }
+    ~NativeBufferLease() {
+      release();
+    }
+
+    NativeBufferLease(const NativeBufferLease&) = delete;
+    NativeBufferLease& operator=(const NativeBufferLease&) = delete;
+
+    void release() noexcept {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (_bufferView == nullptr) {
+        return;
+      }
+      AHardwareBuffer_release(_bufferView->getHardwareBuffer());
+      _bufferView = nullptr;
+    }
+
+  private:
+    std::mutex _mutex;
+    std::shared_ptr<vulkan::VulkanBufferView> _bufferView;
+  };
+
+} // namespace
+
 HybridGPUFrame::HybridGPUFrame(std::shared_ptr<vulkan::VulkanBufferView> bufferView) : HybridObject(TAG), _bufferView(std::move(bufferView)) {
   if (_bufferView == nullptr) [[unlikely]] {
     throw std::runtime_error("GPUFrame buffer view is null.");
@@ -33,6 +73,14 @@ double HybridGPUFrame::getHeight() {
   return static_cast<double>(bufferView->getHeight());
 }
 
+double HybridGPUFrame::getBatchSize() {
+  const std::shared_ptr<vulkan::VulkanBufferView> bufferView = getBufferView();
+  if (bufferView == nullptr) {
+    return 0.0;
+  }
+  return static_cast<double>(bufferView->getBatchSize());
+}
+
 std::optional<ChannelOrder> HybridGPUFrame::getChannelOrder() {
   const std::shared_ptr<vulkan::VulkanBufferView> bufferView = getBufferView();
   if (bufferView == nullptr) {
@@ -57,15 +105,60 @@ std::optional<PixelLayout> HybridGPUFrame::getPixelLayout() {
   return bufferView->getPixelLayout();
 }
 
+std::optional<FrameStatistics> HybridGPUFrame::getFrameStatistics() {
+  const std::shared_ptr<vulkan::VulkanBufferView> bufferView = getBufferView();
+  if (bufferView == nullptr) {
+    return std::nullopt;
+  }
+  return bufferView->getFrameStatistics();
+}
+
 std::shared_ptr<margelo::nitro::ArrayBuffer> HybridGPUFrame::getPixelBuffer() {
   const std::shared_ptr<vulkan::VulkanBufferView> bufferView = getBufferView();
   if (bufferView == nullptr) {
     throw std::runtime_error("This GPUFrame has already been disposed.");
   }
+  if (bufferView->getData() == nullptr) [[unlikely]] {
+    throw std::runtime_error("This GPUFrame is stored in a native GPU buffer (`outputBufferType: 'native'`) - use getNativeBuffer() instead.");
+  }
   // Expose the mapped Vulkan output memory directly so JS can read it without an extra copy.
   return ArrayBuffer::wrap(bufferView->getData(), bufferView->getByteCount(), DeleteFn{});
 }
 
+NativeBuffer HybridGPUFrame::getNativeBuffer() {
+  std::shared_ptr<vulkan::VulkanBufferView> bufferView = getBufferView();
+  if (bufferView == nullptr) {
+    throw std::runtime_error("This GPUFrame has already been disposed.");
+  }
+  AHardwareBuffer* hardwareBuffer = bufferView->getHardwareBuffer();
+  if (hardwareBuffer == nullptr) [[unlikely]] {
+    throw std::runtime_error("This GPUFrame is stored in CPU memory - create the Resizer with `outputBufferType: 'native'` or `'texture'` to use getNativeBuffer().");
+  }
+  // The lease outlives dispose(), so the Resizer cannot write into this output slot again until the consumer releases it.
+  auto lease = std::make_shared<NativeBufferLease>(std::move(bufferView));
+  return NativeBuffer(reinterpret_cast<uint64_t>(hardwareBuffer), [lease]() { lease->release(); });
+}
+
+ResizeTransform HybridGPUFrame::getTransform(std::optional<double> batchIndex) {
+  return getTransformAt(batchIndex);
+}
+
+void HybridGPUFrame::convertOutputPointsToFramePoints(const std::shared_ptr<ArrayBuffer>& points, std::optional<double> batchIndex) {
+  const ResizeTransform transform = getTransformAt(batchIndex);
+  if (points == nullptr) [[unlikely]] {
+    throw std::runtime_error("convertOutputPointsToFramePoints() requires a points ArrayBuffer.");
+  }
+  const size_t byteCount = points->size();
+  if (byteCount % (sizeof(float) * 2) != 0) [[unlikely]] {
+    throw std::runtime_error("Points ArrayBuffer must contain interleaved float32 x, y pairs, but it is " + std::to_string(byteCount) + " bytes large.");
+  }
+  uint8_t* data = points->data();
+  if (reinterpret_cast<uintptr_t>(data) % alignof(float) != 0) [[unlikely]] {
+    throw std::runtime_error("Points ArrayBuffer is not aligned to 4 bytes - pass a Float32Array's underlying buffer.");
+  }
+  margelo::nitro::camera::resizer::utils::convertOutputPointsToFramePoints(transform, reinterpret_cast<float*>(data), byteCount / (sizeof(float) * 2));
+}
+
 void HybridGPUFrame::dispose() {
   // Dropping the last view reference releases the reusable output slot through RAII.
   std::lock_guard<std::mutex> lock(_bufferViewMutex);
@@ -82,4 +175,19 @@ std::shared_ptr<vulkan::VulkanBufferView> HybridGPUFrame::getBufferView() const
   return _bufferView;
 }
 
+ResizeTransform HybridGPUFrame::getTransformAt(std::optional<double> batchIndex) const {
+  const std::shared_ptr<vulkan::VulkanBufferView> bufferView = getBufferView();
+  if (bufferView == nullptr) {
+    throw std::runtime_error("This GPUFrame has already been disposed.");
+  }
+  const std::vector<ResizeTransform>& transforms = bufferView->getTransforms();
+  const double index = batchIndex.value_or(0.0);
+  // NaN fails every comparison, so checking `!(index >= 0)` also rejects non-finite indices.
+  if (!(index >= 0.0) || index >= static_cast<double>(transforms.size()) || std::floor(index) != index) [[unlikely]] {
+    throw std::runtime_error("Batch index " + std::to_string(index) + " is out of range for a GPUFrame with a batchSize of " +
+                             std::to_string(transforms.size()) + ".");
+  }
+  return transforms[static_cast<size_t>(index)];
+}
+
 } // namespace margelo::nitro::camera::resizer
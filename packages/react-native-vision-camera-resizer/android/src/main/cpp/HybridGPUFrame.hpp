@@ -24,10 +24,15 @@ public:
 
   double getWidth() override;
   double getHeight() override;
+  double getBatchSize() override;
   std::optional<ChannelOrder> getChannelOrder() override;
   std::optional<DataType> getDataType() override;
   std::optional<PixelLayout> getPixelLayout() override;
+  std::optional<FrameStatistics> getFrameStatistics() override;
   std::shared_ptr<margelo::nitro::ArrayBuffer> getPixelBuffer() override;
+  NativeBuffer getNativeBuffer() override;
+  ResizeTransform getTransform(std::optional<double> batchIndex) override;
+  void convertOutputPointsToFramePoints(const std::shared_ptr<ArrayBuffer>& points, std::optional<double> batchIndex) override;
   void dispose() override;
   size_t getExternalMemorySize() noexcept override;
 
@@ -36,6 +41,12 @@ private:
    * Copies the current buffer view reference so metadata can be queried without holding the lock.
    */
   [[nodiscard]] std::shared_ptr<vulkan::VulkanBufferView> getBufferView() const;
+  /**
+   * Returns the transform of the image at `batchIndex` (or the first image) of the current buffer view.
+   *
+   * @throws If this GPUFrame has been disposed, or `batchIndex` is not an index into the batch.
+   */
+  [[nodiscard]] ResizeTransform getTransformAt(std::optional<double> batchIndex) const;
 
 private:
   mutable std::mutex _bufferViewMutex;
@@ -0,0 +1,106 @@
+///
+/// HybridMultiResizer.cpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#include "HybridMultiResizer.hpp"
+
+#include "HybridGPUFrame.hpp"
+#include "utils/FrameOrientation.hpp"
+#include "utils/ScopedNativeBuffer.hpp"
+#include "vulkan/VulkanResizerStatistics.hpp"
+
+#include <stdexcept>
+
+namespace margelo::nitro::camera::resizer {
+
+namespace {
+
+  /**
+   * Wrap each output Vulkan GPU buffer as a zero-copy GPUFrame, keeping the order of the targets.
+   */
+  std::vector<std::shared_ptr<HybridGPUFrameSpec>> toGPUFrames(std::vector<std::shared_ptr<vulkan::VulkanBufferView>> outputBufferViews) {
+    std::vector<std::shared_ptr<HybridGPUFrameSpec>> gpuFrames;
+    gpuFrames.reserve(outputBufferViews.size());
+    for (std::shared_ptr<vulkan::VulkanBufferView>& outputBufferView : outputBufferViews) {
+      gpuFrames.push_back(std::make_shared<HybridGPUFrame>(std::move(outputBufferView)));
+    }
+    return gpuFrames;
+  }
+
+} // namespace
+
+HybridMultiResizer::HybridMultiResizer(std::shared_ptr<vulkan::VulkanContext> context, std::vector<ResizerOptions> targets)
+    : HybridObject(TAG), _pipeline(std::make_shared<vulkan::VulkanResizerPipeline>(std::move(context), std::move(targets))) {}
+
+std::vector<std::shared_ptr<HybridGPUFrameSpec>> HybridMultiResizer::resize(const std::shared_ptr<camera::HybridFrameSpec>& frame,
+                                                                            const std::optional<ResizeOptions>& options) {
+  if (_pipeline == nullptr) [[unlikely]] {
+    throw std::runtime_error("This MultiResizer has already been disposed!");
+  }
+
+  // Keep the NativeBuffer alive while Vulkan borrows the underlying AHardwareBuffer pointer.
+  ScopedNativeBuffer nativeBuffer(frame->getNativeBuffer());
+  AHardwareBuffer* hardwareBuffer = nativeBuffer.getHardwareBuffer();
+  if (hardwareBuffer == nullptr) [[unlikely]] {
+    throw std::runtime_error("Frame NativeBuffer pointer (AHardwareBuffer*) is null!");
+  }
+
+  // Import the Frame once and resize it into every target within a single submission.
+  const int rotationDegrees = utils::orientationToDegrees(frame->getOrientation());
+  const bool isMirrored = frame->getIsMirrored();
+  return toGPUFrames(_pipeline->run(hardwareBuffer, rotationDegrees, isMirrored, options));
+}
+
+std::shared_ptr<Promise<std::vector<std::shared_ptr<HybridGPUFrameSpec>>>>
+HybridMultiResizer::resizeAsync(const std::shared_ptr<camera::HybridFrameSpec>& frame, const std::optional<ResizeOptions>& options) {
+  if (_pipeline == nullptr) [[unlikely]] {
+    throw std::runtime_error("This MultiResizer has already been disposed!");
+  }
+
+  // The GPU samples the AHardwareBuffer after this method returns, so keep the NativeBuffer alive until the fence signals.
+  auto nativeBuffer = std::make_shared<ScopedNativeBuffer>(frame->getNativeBuffer());
+  AHardwareBuffer* hardwareBuffer = nativeBuffer->getHardwareBuffer();
+  if (hardwareBuffer == nullptr) [[unlikely]] {
+    throw std::runtime_error("Frame NativeBuffer pointer (AHardwareBuffer*) is null!");
+  }
+
+  // Record and submit synchronously so the caller may release the Frame as soon as this returns,
+  // then wait for the GPU on a separate C++ Thread (pooled).
+  const int rotationDegrees = utils::orientationToDegrees(frame->getOrientation());
+  const bool isMirrored = frame->getIsMirrored();
+  vulkan::VulkanResizerPipeline::Submission submission = _pipeline->submit(hardwareBuffer, rotationDegrees, isMirrored, options);
+
+  return Promise<std::vector<std::shared_ptr<HybridGPUFrameSpec>>>::async(
+      [pipeline = _pipeline, nativeBuffer = std::move(nativeBuffer),
+       submission = std::move(submission)]() -> std::vector<std::shared_ptr<HybridGPUFrameSpec>> {
+        return toGPUFrames(pipeline->waitForCompletion(submission));
+      });
+}
+
+void HybridMultiResizer::dispose() {
+  if (_pipeline == nullptr) {
+    return;
+  }
+
+  if (_pipeline->hasActiveOutputView()) [[unlikely]] {
+    throw std::runtime_error("Previous GPUFrame is still active. Dispose it before disposing the MultiResizer.");
+  }
+
+  _pipeline = nullptr;
+}
+
+ResizerStatistics HybridMultiResizer::getStatistics() {
+  if (_pipeline == nullptr) [[unlikely]] {
+    throw std::runtime_error("This MultiResizer has already been disposed!");
+  }
+
+  return vulkan::getResizerStatistics(*_pipeline);
+}
+
+size_t HybridMultiResizer::getExternalMemorySize() noexcept {
+  return _pipeline != nullptr ? _pipeline->getOutputBufferAllocationSize() : 0;
+}
+
+} // namespace margelo::nitro::camera::resizer
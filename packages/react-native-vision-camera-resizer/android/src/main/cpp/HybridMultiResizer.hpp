@@ -0,0 +1,44 @@
+///
+/// HybridMultiResizer.hpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include "HybridMultiResizerSpec.hpp"
+#include "ResizeOptions.hpp"
+#include "ResizerOptions.hpp"
+#include "ResizerStatistics.hpp"
+#include "vulkan/VulkanContext.hpp"
+#include "vulkan/VulkanResizerPipeline.hpp"
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace margelo::nitro::camera::resizer {
+
+/**
+ * An implementation of `HybridMultiResizerSpec` that records one Vulkan compute dispatch per output into a single
+ * command buffer, sharing the imported Frame and the submission between all outputs.
+ */
+class HybridMultiResizer final : public HybridMultiResizerSpec {
+public:
+  HybridMultiResizer(std::shared_ptr<vulkan::VulkanContext> context, std::vector<ResizerOptions> targets);
+  ~HybridMultiResizer() override = default;
+
+  std::vector<std::shared_ptr<HybridGPUFrameSpec>> resize(const std::shared_ptr<camera::HybridFrameSpec>& frame,
+                                                          const std::optional<ResizeOptions>& options) override;
+  std::shared_ptr<Promise<std::vector<std::shared_ptr<HybridGPUFrameSpec>>>> resizeAsync(const std::shared_ptr<camera::HybridFrameSpec>& frame,
+                                                                                         const std::optional<ResizeOptions>& options) override;
+  void dispose() override;
+  ResizerStatistics getStatistics() override;
+  size_t getExternalMemorySize() noexcept override;
+
+private:
+  // Shared so that pending resizeAsync() calls keep the pipeline alive until their fence signals.
+  std::shared_ptr<vulkan::VulkanResizerPipeline> _pipeline;
+};
+
+} // namespace margelo::nitro::camera::resizer
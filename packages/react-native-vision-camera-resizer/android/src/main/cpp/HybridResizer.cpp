@@ -7,37 +7,39 @@
 #include "HybridResizer.hpp"
 
 #include "HybridGPUFrame.hpp"
+#include "utils/FrameOrientation.hpp"
 #include "utils/ScopedNativeBuffer.hpp"
+#include "vulkan/VulkanResizerStatistics.hpp"
 
 #include <stdexcept>
 
 namespace margelo::nitro::camera::resizer {
 
-namespace {
-
-  /**
-   * Convert the camera orientation enum into the rotation contract expected by the shader.
-   */
-  int orientationToDegrees(camera::CameraOrientation orientation) {
-    switch (orientation) {
-      case camera::CameraOrientation::UP:
-        return 0;
-      case camera::CameraOrientation::RIGHT:
-        return 90;
-      case camera::CameraOrientation::DOWN:
-        return 180;
-      case camera::CameraOrientation::LEFT:
-        return 270;
-    }
-
-    throw std::runtime_error("Unknown Frame orientation: " + std::to_string(static_cast<int>(orientation)));
+HybridResizer::HybridResizer(std::shared_ptr<vulkan::VulkanContext> context, const ResizerOptions& options)
+    : HybridObject(TAG), _pipeline(std::make_shared<vulkan::VulkanResizerPipeline>(std::move(context), options)) {}
+
+std::shared_ptr<HybridGPUFrameSpec> HybridResizer::resize(const std::shared_ptr<camera::HybridFrameSpec>& frame, const std::optional<ResizeOptions>& options) {
+  if (_pipeline == nullptr) [[unlikely]] {
+    throw std::runtime_error("This Resizer has already been disposed!");
+  }
+
+  // Keep the NativeBuffer alive while Vulkan borrows the underlying AHardwareBuffer pointer.
+  ScopedNativeBuffer nativeBuffer(frame->getNativeBuffer());
+  AHardwareBuffer* hardwareBuffer = nativeBuffer.getHardwareBuffer();
+  if (hardwareBuffer == nullptr) [[unlikely]] {
+    throw std::runtime_error("Frame NativeBuffer pointer (AHardwareBuffer*) is null!");
   }
 
-} // namespace
+  // Run the Vulkan compute pipeline with the given Frame HardwareBuffer.
+  const int rotationDegrees = utils::orientationToDegrees(frame->getOrientation());
+  const bool isMirrored = frame->getIsMirrored();
+  const std::shared_ptr<vulkan::VulkanBufferView> outputBufferView = _pipeline->run(hardwareBuffer, rotationDegrees, isMirrored, options).front();
 
-HybridResizer::HybridResizer(const ResizerOptions& options) : HybridObject(TAG), _pipeline(std::make_unique<vulkan::VulkanResizerPipeline>(options)) {}
+  // Wrap the resulting Vulkan GPU buffer as a zero-copy GPUFrame.
+  return std::make_shared<HybridGPUFrame>(std::move(outputBufferView));
+}
 
-std::shared_ptr<HybridGPUFrameSpec> HybridResizer::resize(const std::shared_ptr<camera::HybridFrameSpec>& frame) {
+std::shared_ptr<HybridGPUFrameSpec> HybridResizer::resizeBatch(const std::shared_ptr<camera::HybridFrameSpec>& frame, const std::vector<Rect>& regions) {
   if (_pipeline == nullptr) [[unlikely]] {
     throw std::runtime_error("This Resizer has already been disposed!");
   }
@@ -49,15 +51,40 @@ std::shared_ptr<HybridGPUFrameSpec> HybridResizer::resize(const std::shared_ptr<
     throw std::runtime_error("Frame NativeBuffer pointer (AHardwareBuffer*) is null!");
   }
 
-  // Run the Vulkan compute pipeline with the given Frame HardwareBuffer.
-  const int rotationDegrees = orientationToDegrees(frame->getOrientation());
+  // Resize every region into one batched output buffer with a single dispatch.
+  const int rotationDegrees = utils::orientationToDegrees(frame->getOrientation());
   const bool isMirrored = frame->getIsMirrored();
-  const std::shared_ptr<vulkan::VulkanBufferView> outputBufferView = _pipeline->run(hardwareBuffer, rotationDegrees, isMirrored);
+  const std::shared_ptr<vulkan::VulkanBufferView> outputBufferView = _pipeline->runBatch(hardwareBuffer, rotationDegrees, isMirrored, regions).front();
 
-  // Wrap the resulting Vulkan GPU buffer as a zero-copy GPUFrame.
   return std::make_shared<HybridGPUFrame>(std::move(outputBufferView));
 }
 
+std::shared_ptr<Promise<std::shared_ptr<HybridGPUFrameSpec>>> HybridResizer::resizeAsync(const std::shared_ptr<camera::HybridFrameSpec>& frame,
+                                                                                          const std::optional<ResizeOptions>& options) {
+  if (_pipeline == nullptr) [[unlikely]] {
+    throw std::runtime_error("This Resizer has already been disposed!");
+  }
+
+  // The GPU samples the AHardwareBuffer after this method returns, so keep the NativeBuffer alive until the fence signals.
+  auto nativeBuffer = std::make_shared<ScopedNativeBuffer>(frame->getNativeBuffer());
+  AHardwareBuffer* hardwareBuffer = nativeBuffer->getHardwareBuffer();
+  if (hardwareBuffer == nullptr) [[unlikely]] {
+    throw std::runtime_error("Frame NativeBuffer pointer (AHardwareBuffer*) is null!");
+  }
+
+  // Record and submit synchronously so the caller may release the Frame as soon as this returns,
+  // then wait for the GPU on a separate C++ Thread (pooled).
+  const int rotationDegrees = utils::orientationToDegrees(frame->getOrientation());
+  const bool isMirrored = frame->getIsMirrored();
+  vulkan::VulkanResizerPipeline::Submission submission = _pipeline->submit(hardwareBuffer, rotationDegrees, isMirrored, options);
+
+  return Promise<std::shared_ptr<HybridGPUFrameSpec>>::async(
+      [pipeline = _pipeline, nativeBuffer = std::move(nativeBuffer), submission = std::move(submission)]() -> std::shared_ptr<HybridGPUFrameSpec> {
+        std::shared_ptr<vulkan::VulkanBufferView> outputBufferView = pipeline->waitForCompletion(submission).front();
+        return std::make_shared<HybridGPUFrame>(std::move(outputBufferView));
+      });
+}
+
 void HybridResizer::dispose() {
   if (_pipeline == nullptr) {
     return;
@@ -70,6 +97,14 @@ void HybridResizer::dispose() {
   _pipeline = nullptr;
 }
 
+ResizerStatistics HybridResizer::getStatistics() {
+  if (_pipeline == nullptr) [[unlikely]] {
+    throw std::runtime_error("This Resizer has already been disposed!");
+  }
+
+  return vulkan::getResizerStatistics(*_pipeline);
+}
+
 size_t HybridResizer::getExternalMemorySize() noexcept {
   return _pipeline != nullptr ? _pipeline->getOutputBufferAllocationSize() : 0;
 }
@@ -7,10 +7,15 @@
 #pragma once
 
 #include "HybridResizerSpec.hpp"
+#include "ResizeOptions.hpp"
 #include "ResizerOptions.hpp"
+#include "ResizerStatistics.hpp"
+#include "vulkan/VulkanContext.hpp"
 #include "vulkan/VulkanResizerPipeline.hpp"
 
 #include <memory>
+#include <optional>
+#include <vector>
 
 namespace margelo::nitro::camera::resizer {
 
@@ -20,15 +25,21 @@ namespace margelo::nitro::camera::resizer {
  */
 class HybridResizer final : public HybridResizerSpec {
 public:
-  HybridResizer(const ResizerOptions& options);
+  HybridResizer(std::shared_ptr<vulkan::VulkanContext> context, const ResizerOptions& options);
   ~HybridResizer() override = default;
 
-  std::shared_ptr<HybridGPUFrameSpec> resize(const std::shared_ptr<camera::HybridFrameSpec>& frame) override;
+  std::shared_ptr<HybridGPUFrameSpec> resize(const std::shared_ptr<camera::HybridFrameSpec>& frame,
+                                             const std::optional<ResizeOptions>& options) override;
+  std::shared_ptr<HybridGPUFrameSpec> resizeBatch(const std::shared_ptr<camera::HybridFrameSpec>& frame, const std::vector<Rect>& regions) override;
+  std::shared_ptr<Promise<std::shared_ptr<HybridGPUFrameSpec>>> resizeAsync(const std::shared_ptr<camera::HybridFrameSpec>& frame,
+                                                                            const std::optional<ResizeOptions>& options) override;
   void dispose() override;
+  ResizerStatistics getStatistics() override;
   size_t getExternalMemorySize() noexcept override;
 
 private:
-  std::unique_ptr<vulkan::VulkanResizerPipeline> _pipeline;
+  // Shared so that pending resizeAsync() calls keep the pipeline alive until their fence signals.
+  std::shared_ptr<vulkan::VulkanResizerPipeline> _pipeline;
 };
 
 } // namespace margelo::nitro::camera::resizer
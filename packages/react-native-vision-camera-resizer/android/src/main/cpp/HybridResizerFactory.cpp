@@ -6,21 +6,92 @@
 
 #include "HybridResizerFactory.hpp"
 
+#include "HybridCpuMultiResizer.hpp"
+#include "HybridCpuResizer.hpp"
+#include "vulkan/VulkanContext.hpp"
 #include "vulkan/VulkanResizerPipeline.hpp"
+#include "vulkan/VulkanWorkgroupSizeCalibration.hpp"
+
+#include <mutex>
+#include <stdexcept>
 
 namespace margelo::nitro::camera::resizer {
 
+namespace {
+
+  std::once_flag calibrationStartedOnceFlag;
+
+  /**
+   * Starts the workgroup size calibration on the first call, without waiting for it.
+   * It takes a few hundred milliseconds of GPU time, so it runs on its own pooled thread instead of delaying the first Resizer.
+   * Pipelines built until it has finished use the default 8x8, every later one uses the calibrated size.
+   */
+  void startWorkgroupSizeCalibration(const std::shared_ptr<vulkan::VulkanContext>& context) {
+    std::call_once(calibrationStartedOnceFlag, [&context]() {
+      // Holding on to `context` keeps the shared device alive until the calibration is done.
+      Promise<void>::async([context]() { vulkan::calibrateWorkgroupSizeIfNeeded(context); });
+    });
+  }
+
+} // namespace
+
 HybridResizerFactory::HybridResizerFactory() : HybridObject(TAG) {}
 
 bool HybridResizerFactory::isAvailable() {
-  return vulkan::VulkanResizerPipeline::isSupported();
+  return vulkan::VulkanContext::isSupported();
 }
 
 std::shared_ptr<Promise<std::shared_ptr<HybridResizerSpec>>> HybridResizerFactory::createResizer(const ResizerOptions& options) {
-  return Promise<std::shared_ptr<HybridResizerSpec>>::async([=]() {
+  return Promise<std::shared_ptr<HybridResizerSpec>>::async([=]() -> std::shared_ptr<HybridResizerSpec> {
+    if (!vulkan::VulkanContext::isSupported()) {
+      // Fall back to resizing on the CPU, which produces the same outputs on any device.
+      return std::make_shared<HybridCpuResizer>(options);
+    }
+
     // Create `HybridResizer` on a separate C++ Thread (pooled),
     // so that the Vulkan setup doesn't block the main JS Thread.
-    return std::make_shared<HybridResizer>(options);
+    // All Resizers share one Vulkan instance/device/queue, so only the first one pays for creating it.
+    std::shared_ptr<vulkan::VulkanContext> context = vulkan::VulkanContext::getShared();
+    // The first Resizer on a never-calibrated device also starts picking the fastest workgroup size for every later one.
+    startWorkgroupSizeCalibration(context);
+    return std::make_shared<HybridResizer>(std::move(context), options);
+  });
+}
+
+std::shared_ptr<Promise<std::shared_ptr<HybridMultiResizerSpec>>> HybridResizerFactory::createMultiResizer(const std::vector<ResizerOptions>& options) {
+  if (options.empty()) [[unlikely]] {
+    throw std::runtime_error("createMultiResizer() requires at least one ResizerOptions.");
+  }
+
+  return Promise<std::shared_ptr<HybridMultiResizerSpec>>::async([=]() -> std::shared_ptr<HybridMultiResizerSpec> {
+    if (!vulkan::VulkanContext::isSupported()) {
+      // Fall back to resizing on the CPU, which produces the same outputs on any device.
+      return std::make_shared<HybridCpuMultiResizer>(options);
+    }
+
+    // Compiles one pipeline variant per target off the JS Thread, sharing the Vulkan context with all other Resizers.
+    std::shared_ptr<vulkan::VulkanContext> context = vulkan::VulkanContext::getShared();
+    startWorkgroupSizeCalibration(context);
+    return std::make_shared<HybridMultiResizer>(std::move(context), options);
+  });
+}
+
+std::shared_ptr<Promise<void>> HybridResizerFactory::prewarm(const std::vector<ResizerOptions>& options) {
+  return Promise<void>::async([=]() {
+    if (!vulkan::VulkanContext::isSupported()) {
+      // The CPU fallback has nothing to compile ahead of time.
+      return;
+    }
+
+    // Creates the shared Vulkan context (if needed) and compiles every pipeline variant off the JS Thread.
+    // The context is released again at the end of this scope unless a Resizer is holding on to it.
+    std::shared_ptr<vulkan::VulkanContext> context = vulkan::VulkanContext::getShared();
+    // Pipelines are specialized for the calibrated workgroup size. On a never-calibrated device these prewarm the default one,
+    // and the next launch prewarms the calibrated one.
+    startWorkgroupSizeCalibration(context);
+    for (const ResizerOptions& resizerOptions : options) {
+      vulkan::VulkanResizerPipeline::prewarm(*context, resizerOptions);
+    }
   });
 }
 
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "HybridMultiResizer.hpp"
 #include "HybridResizer.hpp"
 #include "HybridResizerFactorySpec.hpp"
 
@@ -17,6 +18,8 @@ public:
 
   bool isAvailable() override;
   std::shared_ptr<Promise<std::shared_ptr<HybridResizerSpec>>> createResizer(const ResizerOptions& options) override;
+  std::shared_ptr<Promise<std::shared_ptr<HybridMultiResizerSpec>>> createMultiResizer(const std::vector<ResizerOptions>& options) override;
+  std::shared_ptr<Promise<void>> prewarm(const std::vector<ResizerOptions>& options) override;
 };
 
 } // namespace margelo::nitro::camera::resizer
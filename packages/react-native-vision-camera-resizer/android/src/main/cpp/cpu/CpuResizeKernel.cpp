@@ -0,0 +1,670 @@
+///
+/// CpuResizeKernel.cpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#include "cpu/CpuResizeKernel.hpp"
+
+#include "utils/FrameLumaStatistics.hpp"
+#include "utils/OutputBufferLayout.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#elif defined(__SSE4_1__)
+#include <smmintrin.h>
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace margelo::nitro::camera::resizer::cpu {
+
+namespace {
+
+  // 4-lane vectors, one lane per horizontally adjacent output pixel.
+  // Clang and GCC lower these to NEON on arm64 and to SSE on x86_64. Only rounding, gathers and byte shuffles, which vector
+  // extensions cannot express, use per-architecture intrinsics, each with a portable fallback.
+  using Float4 = float __attribute__((vector_size(16)));
+  using Int4 = int32_t __attribute__((vector_size(16)));
+  using Byte16 = uint8_t __attribute__((vector_size(16)));
+
+  constexpr uint32_t kLaneCount = 4;
+  // The most output channels of any ChannelOrder (RGBA, BGRA and ARGB).
+  constexpr uint32_t kMaxChannelCount = 4;
+  // The most bilinear taps per output axis of `ResizeFilter::AREA`. Matches `kMaxAreaTapsPerAxis` of `Resizer.comp`.
+  constexpr uint32_t kMaxAreaTapsPerAxis = 4;
+
+  /**
+   * Picks `a` in lanes where `mask` is set and `b` elsewhere. Lanes of `mask` are all-ones or all-zeros, like vector comparisons return.
+   */
+  [[nodiscard]] inline Float4 select(Int4 mask, Float4 a, Float4 b) noexcept {
+    return (Float4)(((Int4)a & mask) | ((Int4)b & ~mask));
+  }
+
+  [[nodiscard]] inline Int4 select(Int4 mask, Int4 a, Int4 b) noexcept {
+    return (a & mask) | (b & ~mask);
+  }
+
+  [[nodiscard]] inline Float4 clamp(Float4 value, float minimum, float maximum) noexcept {
+    value = select(value < minimum, Float4{} + minimum, value);
+    return select(value > maximum, Float4{} + maximum, value);
+  }
+
+  [[nodiscard]] inline Int4 clamp(Int4 value, int32_t minimum, int32_t maximum) noexcept {
+    value = select(value < minimum, Int4{} + minimum, value);
+    return select(value > maximum, Int4{} + maximum, value);
+  }
+
+  [[nodiscard]] inline Int4 floorToInt(Float4 value) noexcept {
+    // Conversion truncates towards zero, so step back by one (a `-1` comparison mask) where that rounded up.
+    const Int4 truncated = __builtin_convertvector(value, Int4);
+    return truncated + (Int4)(__builtin_convertvector(truncated, Float4) > value);
+  }
+
+  /**
+   * The four neighbouring texels and weights of a bilinear, clamp-to-edge sample.
+   */
+  struct BilinearTaps final {
+    Int4 left;
+    Int4 right;
+    Int4 top;
+    Int4 bottom;
+    Float4 weightX;
+    Float4 weightY;
+  };
+
+  /**
+   * Computes bilinear taps for sampling positions in pixels of a `width`x`height` plane, where texel centers sit at `+ 0.5`.
+   */
+  [[nodiscard]] inline BilinearTaps getBilinearTaps(Float4 x, Float4 y, uint32_t width, uint32_t height) noexcept {
+    const Float4 texelX = x - 0.5f;
+    const Float4 texelY = y - 0.5f;
+    const Int4 left = floorToInt(texelX);
+    const Int4 top = floorToInt(texelY);
+    const int32_t maxX = static_cast<int32_t>(width) - 1;
+    const int32_t maxY = static_cast<int32_t>(height) - 1;
+    return BilinearTaps{
+        .left = clamp(left, 0, maxX),
+        .right = clamp(left + 1, 0, maxX),
+        .top = clamp(top, 0, maxY),
+        .bottom = clamp(top + 1, 0, maxY),
+        .weightX = texelX - __builtin_convertvector(left, Float4),
+        .weightY = texelY - __builtin_convertvector(top, Float4),
+    };
+  }
+
+  /**
+   * Bilinearly interpolates four texels of 8-bit values per lane, normalized to `0.0` ... `1.0`.
+   */
+  [[nodiscard]] inline Float4 interpolate(Int4 topLeft, Int4 topRight, Int4 bottomLeft, Int4 bottomRight, Float4 weightX, Float4 weightY) noexcept {
+    const Float4 topLeftValue = __builtin_convertvector(topLeft, Float4);
+    const Float4 bottomLeftValue = __builtin_convertvector(bottomLeft, Float4);
+    const Float4 top = topLeftValue + ((__builtin_convertvector(topRight, Float4) - topLeftValue) * weightX);
+    const Float4 bottom = bottomLeftValue + ((__builtin_convertvector(bottomRight, Float4) - bottomLeftValue) * weightX);
+    return (top + ((bottom - top) * weightY)) * (1.0f / 255.0f);
+  }
+
+  /**
+   * Samples one 8-bit channel of a plane with the given taps, normalized to `0.0` ... `1.0`.
+   */
+  [[nodiscard]] inline Float4 sampleChannel(const uint8_t* plane, uint32_t rowStride, uint32_t pixelStride, const BilinearTaps& taps) noexcept {
+    Int4 topLeft;
+    Int4 topRight;
+    Int4 bottomLeft;
+    Int4 bottomRight;
+    // Arbitrary strides need one scalar load per texel, everything after them runs on all lanes at once.
+    for (uint32_t lane = 0; lane < kLaneCount; lane++) {
+      const uint8_t* topRow = plane + (static_cast<size_t>(taps.top[lane]) * rowStride);
+      const uint8_t* bottomRow = plane + (static_cast<size_t>(taps.bottom[lane]) * rowStride);
+      const size_t left = static_cast<size_t>(taps.left[lane]) * pixelStride;
+      const size_t right = static_cast<size_t>(taps.right[lane]) * pixelStride;
+      topLeft[lane] = topRow[left];
+      topRight[lane] = topRow[right];
+      bottomLeft[lane] = bottomRow[left];
+      bottomRight[lane] = bottomRow[right];
+    }
+    return interpolate(topLeft, topRight, bottomLeft, bottomRight, taps.weightX, taps.weightY);
+  }
+
+  /**
+   * Bilinear taps that read the left and right texel of a row with a single load: the pair starts at `pairStart`, and `weightX`
+   * is clamped so that pairs shifted inwards at the left and right edges still produce the clamp-to-edge result of `BilinearTaps`.
+   * Only valid for planes that are at least 2 texels wide.
+   */
+  struct PairedTaps final {
+    Int4 topOffset;
+    Int4 bottomOffset;
+    Float4 weightX;
+    Float4 weightY;
+  };
+
+  /**
+   * Computes paired taps for a plane of `width`x`height` texels that are `pixelStride` bytes apart, with rows `rowStride` bytes apart.
+   * The offsets point at the first byte of each pair.
+   */
+  [[nodiscard]] inline PairedTaps getPairedTaps(Float4 x, Float4 y, uint32_t width, uint32_t height, uint32_t rowStride, uint32_t pixelStride) noexcept {
+    const Float4 texelX = x - 0.5f;
+    const Float4 texelY = y - 0.5f;
+    const Int4 top = floorToInt(texelY);
+    const Int4 pairStart = clamp(floorToInt(texelX), 0, static_cast<int32_t>(width) - 2);
+    const int32_t maxY = static_cast<int32_t>(height) - 1;
+    const Int4 pairOffset = pairStart * static_cast<int32_t>(pixelStride);
+    return PairedTaps{
+        .topOffset = (clamp(top, 0, maxY) * static_cast<int32_t>(rowStride)) + pairOffset,
+        .bottomOffset = (clamp(top + 1, 0, maxY) * static_cast<int32_t>(rowStride)) + pairOffset,
+        .weightX = clamp(texelX - __builtin_convertvector(pairStart, Float4), 0.0f, 1.0f),
+        .weightY = texelY - __builtin_convertvector(top, Float4),
+    };
+  }
+
+  /**
+   * Loads the 2 bytes at each lane's offset into `base`, zero-extended.
+   */
+  [[nodiscard]] inline Int4 loadPairs(const uint8_t* base, Int4 offsets) noexcept {
+    Int4 pairs;
+    for (uint32_t lane = 0; lane < kLaneCount; lane++) {
+      uint16_t pair = 0;
+      std::memcpy(&pair, base + offsets[lane], sizeof(pair));
+      pairs[lane] = pair;
+    }
+    return pairs;
+  }
+
+  /**
+   * Loads the 4 bytes at each lane's offset into `base`.
+   */
+  [[nodiscard]] inline Int4 loadQuads(const uint8_t* base, Int4 offsets) noexcept {
+#if defined(__AVX2__)
+    return (Int4)_mm_i32gather_epi32(reinterpret_cast<const int*>(base), (__m128i)offsets, 1);
+#else
+    // Lowers to one load and one lane insert per lane (`ld1 {v.s}[n]` on arm64, `pinsrd` on SSE4.1).
+    Int4 quads;
+    for (uint32_t lane = 0; lane < kLaneCount; lane++) {
+      uint32_t quad = 0;
+      std::memcpy(&quad, base + offsets[lane], sizeof(quad));
+      quads[lane] = static_cast<int32_t>(quad);
+    }
+    return quads;
+#endif
+  }
+
+  /**
+   * Returns byte `index` (`0` is the lowest address) of each lane of little-endian words loaded by `loadPairs(...)` or `loadQuads(...)`.
+   */
+  [[nodiscard]] inline Int4 getByte(Int4 words, int32_t index) noexcept {
+    return (words >> (index * 8)) & 0xFF;
+  }
+
+  /**
+   * Samples the luma plane of a YUV input with one 2-byte load per row and lane. Requires a luma pixel stride of 1.
+   */
+  [[nodiscard]] inline Float4 sampleLumaPairs(const CpuInputImage& input, Float4 x, Float4 y) noexcept {
+    const PairedTaps taps = getPairedTaps(x, y, input.width, input.height, input.rowStrides[0], 1);
+    const Int4 top = loadPairs(input.planes[0], taps.topOffset);
+    const Int4 bottom = loadPairs(input.planes[0], taps.bottomOffset);
+    return interpolate(getByte(top, 0), getByte(top, 1), getByte(bottom, 0), getByte(bottom, 1), taps.weightX, taps.weightY);
+  }
+
+  struct Color final {
+    Float4 red;
+    Float4 green;
+    Float4 blue;
+  };
+
+  /**
+   * Converts BT.601 full range YCbCr, with chroma already centered on `0.0`, to RGB.
+   */
+  [[nodiscard]] inline Color convertYuvToRgb(Float4 luma, Float4 cb, Float4 cr) noexcept {
+    return Color{
+        .red = clamp(luma + (1.402f * cr), 0.0f, 1.0f),
+        .green = clamp(luma - (0.344136f * cb) - (0.714136f * cr), 0.0f, 1.0f),
+        .blue = clamp(luma + (1.772f * cb), 0.0f, 1.0f),
+    };
+  }
+
+  [[nodiscard]] inline Color sampleYuv(const CpuInputImage& input, Float4 x, Float4 y) noexcept {
+    const BilinearTaps lumaTaps = getBilinearTaps(x, y, input.width, input.height);
+    const Float4 luma = sampleChannel(input.planes[0], input.rowStrides[0], input.pixelStrides[0], lumaTaps);
+
+    // Chroma is subsampled 2x2, with each chroma texel centered on its 2x2 block of luma texels.
+    const BilinearTaps chromaTaps = getBilinearTaps(x * 0.5f, y * 0.5f, (input.width + 1) / 2, (input.height + 1) / 2);
+    const Float4 cb = sampleChannel(input.planes[1], input.rowStrides[1], input.pixelStrides[1], chromaTaps) - 0.5f;
+    const Float4 cr = sampleChannel(input.planes[2], input.rowStrides[2], input.pixelStrides[2], chromaTaps) - 0.5f;
+    return convertYuvToRgb(luma, cb, cr);
+  }
+
+  /**
+   * Samples an NV12 or NV21 input, where Cb and Cr share one interleaved plane. Luma is read with one 2-byte load per row and lane,
+   * and both chroma channels of a row's left and right texel with one 4-byte load, instead of one load per byte.
+   */
+  [[nodiscard]] inline Color sampleSemiPlanarYuv(const CpuInputImage& input, Float4 x, Float4 y) noexcept {
+    const Float4 luma = sampleLumaPairs(input, x, y);
+
+    const bool isCbFirst = input.planes[1] < input.planes[2];
+    const uint8_t* chromaPlane = isCbFirst ? input.planes[1] : input.planes[2];
+    const PairedTaps chromaTaps = getPairedTaps(x * 0.5f, y * 0.5f, (input.width + 1) / 2, (input.height + 1) / 2, input.rowStrides[1], 2);
+    // Each quad holds [first, second] of the left texel, then of the right texel.
+    const Int4 top = loadQuads(chromaPlane, chromaTaps.topOffset);
+    const Int4 bottom = loadQuads(chromaPlane, chromaTaps.bottomOffset);
+    const Float4 first = interpolate(getByte(top, 0), getByte(top, 2), getByte(bottom, 0), getByte(bottom, 2), chromaTaps.weightX, chromaTaps.weightY) - 0.5f;
+    const Float4 second = interpolate(getByte(top, 1), getByte(top, 3), getByte(bottom, 1), getByte(bottom, 3), chromaTaps.weightX, chromaTaps.weightY) - 0.5f;
+    return isCbFirst ? convertYuvToRgb(luma, first, second) : convertYuvToRgb(luma, second, first);
+  }
+
+  /**
+   * Samples only the luma plane of a YUV input, for `ChannelOrder::GRAY`. Skips the chroma taps and the YUV to RGB conversion.
+   */
+  [[nodiscard]] inline Color sampleYuvLuma(const CpuInputImage& input, Float4 x, Float4 y) noexcept {
+    const BilinearTaps lumaTaps = getBilinearTaps(x, y, input.width, input.height);
+    const Float4 luma = sampleChannel(input.planes[0], input.rowStrides[0], input.pixelStrides[0], lumaTaps);
+    return Color{
+        .red = luma,
+        .green = luma,
+        .blue = luma,
+    };
+  }
+
+  [[nodiscard]] inline Color sampleRgba(const CpuInputImage& input, Float4 x, Float4 y) noexcept {
+    const BilinearTaps taps = getBilinearTaps(x, y, input.width, input.height);
+    const uint8_t* plane = input.planes[0];
+    return Color{
+        .red = sampleChannel(plane + 0, input.rowStrides[0], input.pixelStrides[0], taps),
+        .green = sampleChannel(plane + 1, input.rowStrides[0], input.pixelStrides[0], taps),
+        .blue = sampleChannel(plane + 2, input.rowStrides[0], input.pixelStrides[0], taps),
+    };
+  }
+
+  /**
+   * How `sampleInput(...)` reads a job's input. Decided once per job, from the input's layout and the output `ChannelOrder`.
+   */
+  enum class InputSampling { RGBA, YUV, YUV_LUMA, SEMI_PLANAR_YUV, PAIRED_LUMA };
+
+  [[nodiscard]] InputSampling getInputSampling(const CpuResizeJob& job) noexcept {
+    const CpuInputImage& input = job.input;
+    if (input.format != CpuInputImage::Format::YUV_420) {
+      return InputSampling::RGBA;
+    }
+    // Paired loads need two texels per row, packed next to each other.
+    const bool canPairLuma = input.pixelStrides[0] == 1 && input.width >= 2;
+    if (job.channelOrder == ChannelOrder::GRAY) {
+      return canPairLuma ? InputSampling::PAIRED_LUMA : InputSampling::YUV_LUMA;
+    }
+    const bool isSemiPlanar = input.pixelStrides[1] == 2 && input.pixelStrides[2] == 2 && input.rowStrides[1] == input.rowStrides[2] &&
+                              std::abs(input.planes[1] - input.planes[2]) == 1 && (input.width + 1) / 2 >= 2;
+    return canPairLuma && isSemiPlanar ? InputSampling::SEMI_PLANAR_YUV : InputSampling::YUV;
+  }
+
+  /**
+   * Samples the input at the given input pixel positions, padding outside of the crop with black if the job requires it.
+   */
+  [[nodiscard]] inline Color sampleInput(const CpuResizeJob& job, InputSampling sampling, Float4 inputX, Float4 inputY) noexcept {
+    Color color;
+    switch (sampling) {
+      case InputSampling::RGBA:
+        color = sampleRgba(job.input, inputX, inputY);
+        break;
+      case InputSampling::YUV:
+        color = sampleYuv(job.input, inputX, inputY);
+        break;
+      case InputSampling::YUV_LUMA:
+        color = sampleYuvLuma(job.input, inputX, inputY);
+        break;
+      case InputSampling::SEMI_PLANAR_YUV:
+        color = sampleSemiPlanarYuv(job.input, inputX, inputY);
+        break;
+      case InputSampling::PAIRED_LUMA: {
+        const Float4 luma = sampleLumaPairs(job.input, inputX, inputY);
+        color = Color{.red = luma, .green = luma, .blue = luma};
+        break;
+      }
+    }
+    if (job.isPaddedOutsideCrop) {
+      // Contain mode pads outside the rendered source with black bars.
+      const Int4 isOutsideCrop = (inputX < job.cropLeft) | (inputX > job.cropRight) | (inputY < job.cropTop) | (inputY > job.cropBottom);
+      color.red = select(isOutsideCrop, Float4{}, color.red);
+      color.green = select(isOutsideCrop, Float4{}, color.green);
+      color.blue = select(isOutsideCrop, Float4{}, color.blue);
+    }
+    return color;
+  }
+
+  /**
+   * The number of bilinear taps `ResizeFilter::AREA` spreads over one output pixel along an output axis that covers `footprint`
+   * input pixels. Each tap already averages up to 2 input pixels per axis. Matches `areaTapCount(...)` of `Resizer.comp`.
+   */
+  [[nodiscard]] inline uint32_t getAreaTapCount(float footprint) noexcept {
+    const float tapCount = std::ceil(footprint * 0.5f);
+    return static_cast<uint32_t>(std::clamp(tapCount, 1.0f, static_cast<float>(kMaxAreaTapsPerAxis)));
+  }
+
+  /**
+   * Samples output pixels `column` ..< `column + 4` of `row` as the average of `tapCountX`x`tapCountY` bilinear taps spread evenly
+   * over each output pixel. One tap per axis samples the pixel centers.
+   */
+  [[nodiscard]] inline Color sampleOutputPixels(const CpuResizeJob& job, InputSampling sampling, uint32_t column, uint32_t row, uint32_t tapCountX,
+                                                uint32_t tapCountY) noexcept {
+    const margelo::nitro::camera::resizer::utils::OutputToFrameMatrix& matrix = job.outputToInput;
+    const Float4 laneColumns = Float4{0.0f, 1.0f, 2.0f, 3.0f} + static_cast<float>(column);
+    const float tapSpacingX = 1.0f / static_cast<float>(tapCountX);
+    const float tapSpacingY = 1.0f / static_cast<float>(tapCountY);
+
+    Color sum{};
+    for (uint32_t tapY = 0; tapY < tapCountY; tapY++) {
+      // The mapping is affine, so along one row the input position only depends linearly on the output column.
+      const float outputY = static_cast<float>(row) + ((static_cast<float>(tapY) + 0.5f) * tapSpacingY);
+      const float rowOriginX = (matrix.m01 * outputY) + matrix.tx;
+      const float rowOriginY = (matrix.m11 * outputY) + matrix.ty;
+      for (uint32_t tapX = 0; tapX < tapCountX; tapX++) {
+        const Float4 outputX = laneColumns + ((static_cast<float>(tapX) + 0.5f) * tapSpacingX);
+        const Float4 inputX = (outputX * matrix.m00) + rowOriginX;
+        const Float4 inputY = (outputX * matrix.m10) + rowOriginY;
+        const Color tap = sampleInput(job, sampling, inputX, inputY);
+        sum.red += tap.red;
+        sum.green += tap.green;
+        sum.blue += tap.blue;
+      }
+    }
+
+    const float weight = 1.0f / static_cast<float>(tapCountX * tapCountY);
+    return Color{
+        .red = sum.red * weight,
+        .green = sum.green * weight,
+        .blue = sum.blue * weight,
+    };
+  }
+
+  /**
+   * Converts a float to IEEE 754 half precision bits, rounding to nearest even like `packHalf2x16`.
+   */
+  [[nodiscard]] uint16_t floatToHalf(float value) noexcept {
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const uint32_t sign = (bits >> 16) & 0x8000u;
+    const uint32_t exponent = (bits >> 23) & 0xFFu;
+    uint32_t mantissa = bits & 0x7FFFFFu;
+
+    if (exponent == 0xFFu) {
+      // Infinity stays infinity, NaN stays a (quiet) NaN.
+      return static_cast<uint16_t>(sign | 0x7C00u | (mantissa != 0 ? 0x200u : 0u));
+    }
+    const int32_t halfExponent = static_cast<int32_t>(exponent) - 127 + 15;
+    if (halfExponent >= 31) {
+      return static_cast<uint16_t>(sign | 0x7C00u);
+    }
+    if (halfExponent <= 0) {
+      if (halfExponent < -10) {
+        return static_cast<uint16_t>(sign);
+      }
+      // Subnormal half: shift the mantissa (with its implicit leading one) into place, then round.
+      mantissa |= 0x800000u;
+      const uint32_t shift = static_cast<uint32_t>(14 - halfExponent);
+      uint32_t half = mantissa >> shift;
+      const uint32_t remainder = mantissa & ((1u << shift) - 1u);
+      const uint32_t halfway = 1u << (shift - 1u);
+      if (remainder > halfway || (remainder == halfway && (half & 1u) != 0)) {
+        half++;
+      }
+      return static_cast<uint16_t>(sign | half);
+    }
+
+    uint32_t half = (static_cast<uint32_t>(halfExponent) << 10) | (mantissa >> 13);
+    const uint32_t remainder = mantissa & 0x1FFFu;
+    // A carry out of the mantissa correctly bumps the exponent (and overflows into infinity).
+    if (remainder > 0x1000u || (remainder == 0x1000u && (half & 1u) != 0)) {
+      half++;
+    }
+    return static_cast<uint16_t>(sign | half);
+  }
+
+  template <DataType kDataType>
+  inline void writeValue(const CpuResizeJob& job, size_t valueIndex, float value) noexcept {
+    if constexpr (kDataType == DataType::INT8) {
+      const float quantized = std::nearbyint(value * job.normalization.inverseQuantizationScale) + job.normalization.quantizationZeroPoint;
+      reinterpret_cast<int8_t*>(job.output)[valueIndex] = static_cast<int8_t>(std::clamp(quantized, -128.0f, 127.0f));
+    } else if constexpr (kDataType == DataType::UINT8) {
+      const float quantized = std::nearbyint(value * job.normalization.inverseQuantizationScale) + job.normalization.quantizationZeroPoint;
+      job.output[valueIndex] = static_cast<uint8_t>(std::clamp(quantized, 0.0f, 255.0f));
+    } else if constexpr (kDataType == DataType::FLOAT16) {
+      reinterpret_cast<uint16_t*>(job.output)[valueIndex] = floatToHalf(value);
+    } else {
+      reinterpret_cast<float*>(job.output)[valueIndex] = value;
+    }
+  }
+
+  /**
+   * Rounds each lane to the nearest integer, ties to even, like `std::nearbyint(...)` in the default rounding mode.
+   */
+  [[nodiscard]] inline Float4 roundToNearestEven(Float4 value) noexcept {
+#if defined(__aarch64__)
+    return (Float4)vrndnq_f32((float32x4_t)value);
+#elif defined(__SSE4_1__)
+    return (Float4)_mm_round_ps((__m128)value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+#else
+    for (uint32_t lane = 0; lane < kLaneCount; lane++) {
+      value[lane] = std::nearbyint(value[lane]);
+    }
+    return value;
+#endif
+  }
+
+  /**
+   * Quantizes 4 values exactly like `writeValue(...)` does for 8-bit outputs, into the low byte of each lane (two's complement for INT8).
+   */
+  template <DataType kDataType>
+  [[nodiscard]] inline Int4 quantize(const CpuResizeJob& job, Float4 value) noexcept {
+    constexpr float kMinimum = kDataType == DataType::INT8 ? -128.0f : 0.0f;
+    constexpr float kMaximum = kDataType == DataType::INT8 ? 127.0f : 255.0f;
+    const Float4 quantized = roundToNearestEven(value * job.normalization.inverseQuantizationScale) + job.normalization.quantizationZeroPoint;
+    return __builtin_convertvector(clamp(quantized, kMinimum, kMaximum), Int4) & 0xFF;
+  }
+
+  /**
+   * Narrows the low bytes of 4 lanes of 4 channels into channel-major order, i.e. byte `channel * 4 + lane`.
+   */
+  [[nodiscard]] inline Byte16 packBytes(const Int4 (&channels)[kMaxChannelCount]) noexcept {
+#if defined(__aarch64__)
+    const uint16x8_t low = vcombine_u16(vmovn_u32((uint32x4_t)channels[0]), vmovn_u32((uint32x4_t)channels[1]));
+    const uint16x8_t high = vcombine_u16(vmovn_u32((uint32x4_t)channels[2]), vmovn_u32((uint32x4_t)channels[3]));
+    return (Byte16)vcombine_u8(vmovn_u16(low), vmovn_u16(high));
+#elif defined(__SSE4_1__)
+    // Lanes only hold 0 ... 255, so the saturating packs never saturate.
+    const __m128i low = _mm_packus_epi32((__m128i)channels[0], (__m128i)channels[1]);
+    const __m128i high = _mm_packus_epi32((__m128i)channels[2], (__m128i)channels[3]);
+    return (Byte16)_mm_packus_epi16(low, high);
+#else
+    Byte16 bytes;
+    for (uint32_t channel = 0; channel < kMaxChannelCount; channel++) {
+      for (uint32_t lane = 0; lane < kLaneCount; lane++) {
+        bytes[(channel * kLaneCount) + lane] = static_cast<uint8_t>(channels[channel][lane]);
+      }
+    }
+    return bytes;
+#endif
+  }
+
+  /**
+   * Reorders channel-major bytes of `packBytes(...)` into `channelCount` (3 or 4) interleaved bytes per pixel.
+   */
+  [[nodiscard]] inline Byte16 interleaveBytes(Byte16 bytes, uint32_t channelCount) noexcept {
+    // Source byte of every destination byte. `0x80` yields zero on SSSE3 and is out of range (also zero) on NEON.
+    alignas(16) static constexpr uint8_t kInterleave3[16] = {0, 4, 8, 1, 5, 9, 2, 6, 10, 3, 7, 11, 0x80, 0x80, 0x80, 0x80};
+    alignas(16) static constexpr uint8_t kInterleave4[16] = {0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15};
+    const uint8_t* indices = channelCount == 3 ? kInterleave3 : kInterleave4;
+#if defined(__aarch64__)
+    return (Byte16)vqtbl1q_u8((uint8x16_t)bytes, vld1q_u8(indices));
+#elif defined(__SSE4_1__)
+    return (Byte16)_mm_shuffle_epi8((__m128i)bytes, _mm_load_si128(reinterpret_cast<const __m128i*>(indices)));
+#else
+    Byte16 interleaved{};
+    for (uint32_t index = 0; index < 16; index++) {
+      if (indices[index] < 16) {
+        interleaved[index] = bytes[indices[index]];
+      }
+    }
+    return interleaved;
+#endif
+  }
+
+  /**
+   * Copies `byteCount` bytes. Full vector groups take one of the fixed sizes, which compile to plain stores instead of a `memcpy` call.
+   */
+  inline void storeBytes(uint8_t* destination, const uint8_t* source, size_t byteCount) noexcept {
+    switch (byteCount) {
+      case 16:
+        std::memcpy(destination, source, 16);
+        return;
+      case 12:
+        std::memcpy(destination, source, 12);
+        return;
+      case 4:
+        std::memcpy(destination, source, 4);
+        return;
+      default:
+        std::memcpy(destination, source, byteCount);
+        return;
+    }
+  }
+
+  /**
+   * Quantizes and stores `laneCount` pixels of an 8-bit output at once, instead of one `writeValue(...)` per value.
+   * Never writes past the group's own pixels, since neighbouring rows may be written concurrently.
+   */
+  template <DataType kDataType>
+  inline void writeQuantizedPixels(const CpuResizeJob& job, const Float4 (&values)[kMaxChannelCount], uint32_t channelCount, size_t firstPixelIndex,
+                                   uint32_t laneCount, size_t pixelCount) noexcept {
+    Int4 channels[kMaxChannelCount]{};
+    for (uint32_t channel = 0; channel < channelCount; channel++) {
+      channels[channel] = quantize<kDataType>(job, values[channel]);
+    }
+    const Byte16 packed = packBytes(channels);
+    if (job.pixelLayout == PixelLayout::PLANAR || channelCount == 1) {
+      for (uint32_t channel = 0; channel < channelCount; channel++) {
+        storeBytes(job.output + (channel * pixelCount) + firstPixelIndex, reinterpret_cast<const uint8_t*>(&packed) + (channel * kLaneCount), laneCount);
+      }
+      return;
+    }
+    const Byte16 interleaved = interleaveBytes(packed, channelCount);
+    storeBytes(job.output + (firstPixelIndex * channelCount), reinterpret_cast<const uint8_t*>(&interleaved), static_cast<size_t>(laneCount) * channelCount);
+  }
+
+  template <DataType kDataType>
+  void resizeRowsAs(const CpuResizeJob& job, uint32_t firstRow, uint32_t endRow) noexcept {
+    const margelo::nitro::camera::resizer::utils::OutputToFrameMatrix& matrix = job.outputToInput;
+    const size_t pixelCount = static_cast<size_t>(job.outputWidth) * job.outputHeight;
+    const uint32_t channelCount = margelo::nitro::camera::resizer::utils::getChannelsPerPixel(job.channelOrder);
+    // The mapping only rotates and scales, so one output pixel step covers the length of a matrix column in input pixels.
+    uint32_t tapCountX = 1;
+    uint32_t tapCountY = 1;
+    if (job.filter == ResizeFilter::AREA) {
+      tapCountX = getAreaTapCount(std::hypot(matrix.m00, matrix.m10));
+      tapCountY = getAreaTapCount(std::hypot(matrix.m01, matrix.m11));
+    }
+    const InputSampling sampling = getInputSampling(job);
+    // Rows run concurrently, so sum up this range locally and only publish the totals once.
+    std::array<uint32_t, margelo::nitro::camera::resizer::utils::kFrameStatisticsCellCount> cellLumaSums{};
+
+    for (uint32_t row = firstRow; row < endRow; row++) {
+      for (uint32_t column = 0; column < job.outputWidth; column += kLaneCount) {
+        const Color color = sampleOutputPixels(job, sampling, column, row, tapCountX, tapCountY);
+
+        // Alpha is always opaque.
+        const Float4 alpha = Float4{} + 1.0f;
+        Float4 values[kMaxChannelCount];
+        switch (job.channelOrder) {
+          case ChannelOrder::RGB:
+            values[0] = color.red;
+            values[1] = color.green;
+            values[2] = color.blue;
+            break;
+          case ChannelOrder::BGR:
+            values[0] = color.blue;
+            values[1] = color.green;
+            values[2] = color.red;
+            break;
+          case ChannelOrder::GRAY:
+            // BT.601 luma. For YUV inputs all three channels already hold the sampled Y, whose weights sum up to 1.
+            values[0] = (color.red * 0.299f) + (color.green * 0.587f) + (color.blue * 0.114f);
+            break;
+          case ChannelOrder::RGBA:
+            values[0] = color.red;
+            values[1] = color.green;
+            values[2] = color.blue;
+            values[3] = alpha;
+            break;
+          case ChannelOrder::BGRA:
+            values[0] = color.blue;
+            values[1] = color.green;
+            values[2] = color.red;
+            values[3] = alpha;
+            break;
+          case ChannelOrder::ARGB:
+            values[0] = alpha;
+            values[1] = color.red;
+            values[2] = color.green;
+            values[3] = color.blue;
+            break;
+        }
+        for (uint32_t channel = 0; channel < channelCount; channel++) {
+          values[channel] = (values[channel] * job.normalization.channelScale[channel]) + job.normalization.channelBias[channel];
+        }
+
+        const uint32_t laneCount = std::min(kLaneCount, job.outputWidth - column);
+        if (job.cellLumaSums != nullptr) {
+          const uint32_t cellRow = margelo::nitro::camera::resizer::utils::getFrameStatisticsCell(row, job.outputHeight);
+          for (uint32_t lane = 0; lane < laneCount; lane++) {
+            const uint32_t cellColumn = margelo::nitro::camera::resizer::utils::getFrameStatisticsCell(column + lane, job.outputWidth);
+            cellLumaSums[(cellRow * margelo::nitro::camera::resizer::utils::kFrameStatisticsGridSize) + cellColumn] +=
+                margelo::nitro::camera::resizer::utils::getPixelLuma(color.red[lane], color.green[lane], color.blue[lane]);
+          }
+        }
+        const size_t firstPixelIndex = (static_cast<size_t>(row) * job.outputWidth) + column;
+        if constexpr (kDataType == DataType::INT8 || kDataType == DataType::UINT8) {
+          writeQuantizedPixels<kDataType>(job, values, channelCount, firstPixelIndex, laneCount, pixelCount);
+          continue;
+        }
+        for (uint32_t lane = 0; lane < laneCount; lane++) {
+          const size_t pixelIndex = firstPixelIndex + lane;
+          for (uint32_t channel = 0; channel < channelCount; channel++) {
+            const size_t valueIndex =
+                job.pixelLayout == PixelLayout::PLANAR ? (channel * pixelCount) + pixelIndex : (pixelIndex * channelCount) + channel;
+            writeValue<kDataType>(job, valueIndex, values[channel][lane]);
+          }
+        }
+      }
+    }
+
+    if (job.cellLumaSums != nullptr) {
+      for (size_t cell = 0; cell < cellLumaSums.size(); cell++) {
+        if (cellLumaSums[cell] != 0) {
+          job.cellLumaSums[cell].fetch_add(cellLumaSums[cell], std::memory_order_relaxed);
+        }
+      }
+    }
+  }
+
+} // namespace
+
+void resizeRows(const CpuResizeJob& job, uint32_t firstRow, uint32_t endRow) noexcept {
+  switch (job.dataType) {
+    case DataType::INT8:
+      resizeRowsAs<DataType::INT8>(job, firstRow, endRow);
+      return;
+    case DataType::UINT8:
+      resizeRowsAs<DataType::UINT8>(job, firstRow, endRow);
+      return;
+    case DataType::FLOAT16:
+      resizeRowsAs<DataType::FLOAT16>(job, firstRow, endRow);
+      return;
+    case DataType::FLOAT32:
+      resizeRowsAs<DataType::FLOAT32>(job, firstRow, endRow);
+      return;
+  }
+}
+
+} // namespace margelo::nitro::camera::resizer::cpu
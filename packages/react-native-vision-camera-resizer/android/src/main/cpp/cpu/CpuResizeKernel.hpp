@@ -0,0 +1,71 @@
+///
+/// CpuResizeKernel.hpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include "ChannelOrder.hpp"
+#include "DataType.hpp"
+#include "PixelLayout.hpp"
+#include "ResizeFilter.hpp"
+#include "utils/OutputNormalization.hpp"
+#include "utils/ResizeTransformMapping.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace margelo::nitro::camera::resizer::cpu {
+
+/**
+ * One CPU-locked input buffer.
+ * YUV inputs address their Y, U and V planes separately, so NV12, NV21 and I420 only differ in their strides and plane pointers.
+ */
+struct CpuInputImage final {
+  enum class Format { YUV_420, RGBA_8888 };
+
+  Format format{Format::YUV_420};
+  uint32_t width{0};
+  uint32_t height{0};
+  // Y, U, V for `YUV_420`. Only the first plane is used for `RGBA_8888`.
+  const uint8_t* planes[3]{};
+  uint32_t rowStrides[3]{};
+  uint32_t pixelStrides[3]{};
+};
+
+/**
+ * Everything needed to fill one output image from one region of a `CpuInputImage`.
+ */
+struct CpuResizeJob final {
+  CpuInputImage input{};
+  // Maps output pixel coordinates to input pixel coordinates, see `utils::getOutputToFrameMatrix(...)`.
+  margelo::nitro::camera::resizer::utils::OutputToFrameMatrix outputToInput{};
+  // The crop in input pixels. Only used to pad outside of it with black for `ScaleMode.contain`.
+  float cropLeft{0.0f};
+  float cropTop{0.0f};
+  float cropRight{0.0f};
+  float cropBottom{0.0f};
+  bool isPaddedOutsideCrop{false};
+  ResizeFilter filter{ResizeFilter::BILINEAR};
+  margelo::nitro::camera::resizer::utils::OutputNormalization normalization{};
+  ChannelOrder channelOrder{ChannelOrder::RGB};
+  DataType dataType{DataType::UINT8};
+  PixelLayout pixelLayout{PixelLayout::INTERLEAVED};
+  uint32_t outputWidth{0};
+  uint32_t outputHeight{0};
+  // The first byte of this job's output image.
+  uint8_t* output{nullptr};
+  // If set, every pixel adds its luma to its cell of the `FrameStatistics` grid, see `utils::FrameLumaStatistics`.
+  std::atomic<uint32_t>* cellLumaSums{nullptr};
+};
+
+/**
+ * Converts, resizes, rotates, mirrors, normalizes and quantizes output rows `firstRow` ..< `endRow` of `job` in one pass,
+ * producing the same values as the `Resizer.comp` compute shader.
+ * Rows are independent, so disjoint row ranges of the same job may run concurrently.
+ */
+void resizeRows(const CpuResizeJob& job, uint32_t firstRow, uint32_t endRow) noexcept;
+
+} // namespace margelo::nitro::camera::resizer::cpu
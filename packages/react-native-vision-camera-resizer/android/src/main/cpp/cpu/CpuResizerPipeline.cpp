@@ -0,0 +1,303 @@
+///
+/// CpuResizerPipeline.cpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#include "cpu/CpuResizerPipeline.hpp"
+
+#include "cpu/CpuWorkerPool.hpp"
+#include "utils/FrameLumaStatistics.hpp"
+#include "utils/OutputBufferLayout.hpp"
+#include "utils/OutputNormalization.hpp"
+#include "utils/ResizeTransformMapping.hpp"
+#include "utils/TextureOutput.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <dlfcn.h>
+#include <stdexcept>
+#include <string>
+
+namespace margelo::nitro::camera::resizer::cpu {
+
+namespace {
+
+  // `AHardwareBuffer_lockPlanes` is only available on API 29+, but this library supports API 26, so it is resolved at runtime.
+  using LockPlanesFunction = int (*)(AHardwareBuffer*, uint64_t, int32_t, const ARect*, AHardwareBuffer_Planes*);
+
+  LockPlanesFunction getLockPlanesFunction() {
+    static const LockPlanesFunction lockPlanes = reinterpret_cast<LockPlanesFunction>(dlsym(RTLD_DEFAULT, "AHardwareBuffer_lockPlanes"));
+    return lockPlanes;
+  }
+
+  /**
+   * Locks an AHardwareBuffer for CPU reads for the lifetime of this object, and describes its planes.
+   */
+  class LockedInputBuffer final {
+  public:
+    LockedInputBuffer(AHardwareBuffer* hardwareBuffer, const AHardwareBuffer_Desc& description) : _hardwareBuffer(hardwareBuffer) {
+      _image.width = description.width;
+      _image.height = description.height;
+
+      if (description.format == AHARDWAREBUFFER_FORMAT_R8G8B8A8_UNORM || description.format == AHARDWAREBUFFER_FORMAT_R8G8B8X8_UNORM) {
+        void* data = nullptr;
+        const int result = AHardwareBuffer_lock(hardwareBuffer, AHARDWAREBUFFER_USAGE_CPU_READ_OFTEN, -1, nullptr, &data);
+        if (result != 0 || data == nullptr) [[unlikely]] {
+          throw std::runtime_error("Failed to lock the input AHardwareBuffer for CPU reads! Error: " + std::to_string(result));
+        }
+        _image.format = CpuInputImage::Format::RGBA_8888;
+        _image.planes[0] = static_cast<const uint8_t*>(data);
+        _image.rowStrides[0] = description.stride * 4;
+        _image.pixelStrides[0] = 4;
+        return;
+      }
+
+      // Camera buffers are YUV 4:2:0 in a vendor-specific layout, which only `lockPlanes` can describe.
+      const LockPlanesFunction lockPlanes = getLockPlanesFunction();
+      if (lockPlanes == nullptr) [[unlikely]] {
+        throw std::runtime_error("Resizing YUV Frames without Vulkan requires Android 10 (API 29) or higher.");
+      }
+      AHardwareBuffer_Planes planes{};
+      const int result = lockPlanes(hardwareBuffer, AHARDWAREBUFFER_USAGE_CPU_READ_OFTEN, -1, nullptr, &planes);
+      if (result != 0) [[unlikely]] {
+        throw std::runtime_error("Failed to lock the planes of the input AHardwareBuffer (format " + std::to_string(description.format) +
+                                 ") for CPU reads! Error: " + std::to_string(result));
+      }
+      if (planes.planeCount != 3) [[unlikely]] {
+        AHardwareBuffer_unlock(hardwareBuffer, nullptr);
+        throw std::runtime_error("Input AHardwareBuffer (format " + std::to_string(description.format) + ") has " + std::to_string(planes.planeCount) +
+                                 " planes, but the CPU Resizer only supports 3-plane YUV 4:2:0 inputs.");
+      }
+      _image.format = CpuInputImage::Format::YUV_420;
+      for (uint32_t i = 0; i < 3; i++) {
+        _image.planes[i] = static_cast<const uint8_t*>(planes.planes[i].data);
+        _image.rowStrides[i] = planes.planes[i].rowStride;
+        _image.pixelStrides[i] = planes.planes[i].pixelStride;
+      }
+    }
+
+    ~LockedInputBuffer() {
+      AHardwareBuffer_unlock(_hardwareBuffer, nullptr);
+    }
+
+    LockedInputBuffer(const LockedInputBuffer&) = delete;
+    LockedInputBuffer& operator=(const LockedInputBuffer&) = delete;
+
+    [[nodiscard]] const CpuInputImage& getImage() const noexcept {
+      return _image;
+    }
+
+  private:
+    AHardwareBuffer* _hardwareBuffer;
+    CpuInputImage _image{};
+  };
+
+} // namespace
+
+CpuResizerPipeline::CpuResizerPipeline(const ResizerOptions& options)
+    : _options(options), _normalization(margelo::nitro::camera::resizer::utils::getOutputNormalization(options)) {
+  if (_options.outputBufferType.value_or(OutputBufferType::CPU) == OutputBufferType::NATIVE) [[unlikely]] {
+    throw std::runtime_error("ResizerOptions.outputBufferType 'native' requires Vulkan, which is not supported on this device.");
+  }
+  if (margelo::nitro::camera::resizer::utils::isTextureOutput(_options)) [[unlikely]] {
+    throw std::runtime_error("ResizerOptions.outputBufferType 'texture' requires Vulkan, which is not supported on this device.");
+  }
+
+  (void)margelo::nitro::camera::resizer::utils::getMaxOutputSize(options);
+  // Start at the configured size, most Resizers never request a larger one.
+  const size_t byteCount = getOutputByteCount(margelo::nitro::camera::resizer::utils::getOutputSize(options)) * getMaxBatchSize();
+  const size_t outputBufferCount = getOutputBufferCount();
+  _outputSlots.reserve(outputBufferCount);
+  for (size_t i = 0; i < outputBufferCount; i++) {
+    auto slot = std::make_shared<OutputSlot>();
+    slot->data.resize(byteCount);
+    _outputSlots.push_back(std::move(slot));
+  }
+}
+
+std::shared_ptr<vulkan::VulkanBufferView> CpuResizerPipeline::run(AHardwareBuffer* hardwareBuffer, int rotationDegrees, bool isMirrored,
+                                                                  const std::optional<ResizeOptions>& resizeOptions) {
+  const margelo::nitro::camera::resizer::utils::OutputSize outputSize =
+      margelo::nitro::camera::resizer::utils::getRequestedOutputSize(_options, resizeOptions);
+  const AHardwareBuffer_Desc description = describeInputBuffer(hardwareBuffer);
+  const std::optional<Rect> crop = resizeOptions.has_value() ? resizeOptions->crop : std::nullopt;
+  const std::vector<margelo::nitro::camera::resizer::utils::CropRegion> cropRegions = {
+      margelo::nitro::camera::resizer::utils::getCropRegion(crop, description.width, description.height),
+  };
+  return resizeRegions(hardwareBuffer, description, rotationDegrees, isMirrored, cropRegions, outputSize);
+}
+
+std::shared_ptr<vulkan::VulkanBufferView> CpuResizerPipeline::runBatch(AHardwareBuffer* hardwareBuffer, int rotationDegrees, bool isMirrored,
+                                                                       const std::vector<Rect>& regions) {
+  if (regions.empty()) [[unlikely]] {
+    throw std::runtime_error("resizeBatch() requires at least one region.");
+  }
+  if (regions.size() > getMaxBatchSize()) [[unlikely]] {
+    throw std::runtime_error("resizeBatch() received " + std::to_string(regions.size()) + " regions, but this Resizer was created with a maxBatchSize of " +
+                             std::to_string(getMaxBatchSize()) + ". Increase `maxBatchSize`.");
+  }
+
+  const AHardwareBuffer_Desc description = describeInputBuffer(hardwareBuffer);
+  std::vector<margelo::nitro::camera::resizer::utils::CropRegion> cropRegions;
+  cropRegions.reserve(regions.size());
+  for (const Rect& region : regions) {
+    cropRegions.push_back(margelo::nitro::camera::resizer::utils::getCropRegion(region, description.width, description.height));
+  }
+  // Batches always use the configured output size.
+  return resizeRegions(hardwareBuffer, description, rotationDegrees, isMirrored, cropRegions,
+                       margelo::nitro::camera::resizer::utils::getOutputSize(_options));
+}
+
+bool CpuResizerPipeline::hasActiveOutputView() const noexcept {
+  return std::any_of(_outputSlots.begin(), _outputSlots.end(), [](const std::shared_ptr<OutputSlot>& slot) { return slot->isInUse.load(); });
+}
+
+size_t CpuResizerPipeline::getOutputBufferAllocationSize() const noexcept {
+  std::lock_guard<std::mutex> lock(_stateMutex);
+  size_t allocationSize = 0;
+  for (const std::shared_ptr<OutputSlot>& slot : _outputSlots) {
+    allocationSize += slot->data.size();
+  }
+  return allocationSize;
+}
+
+std::shared_ptr<vulkan::VulkanBufferView> CpuResizerPipeline::resizeRegions(
+    AHardwareBuffer* hardwareBuffer, const AHardwareBuffer_Desc& description, int rotationDegrees, bool isMirrored,
+    const std::vector<margelo::nitro::camera::resizer::utils::CropRegion>& cropRegions,
+    const margelo::nitro::camera::resizer::utils::OutputSize& outputSize) {
+  std::vector<ResizeTransform> transforms;
+  transforms.reserve(cropRegions.size());
+  for (const margelo::nitro::camera::resizer::utils::CropRegion& cropRegion : cropRegions) {
+    transforms.push_back(margelo::nitro::camera::resizer::utils::getResizeTransform(cropRegion, description.width, description.height, outputSize.width,
+                                                                                      outputSize.height, rotationDegrees, isMirrored, _options.scaleMode));
+  }
+
+  // Claim the output first, so a full ring fails before paying for the input lock.
+  std::shared_ptr<vulkan::VulkanBufferView> outputBufferView = acquireOutputView(transforms, outputSize);
+  const LockedInputBuffer input(hardwareBuffer, description);
+
+  // Only the first image of a batch is measured, like on the GPU.
+  const bool enableFrameStatistics = _options.enableFrameStatistics.value_or(false);
+  std::array<std::atomic<uint32_t>, margelo::nitro::camera::resizer::utils::kFrameStatisticsCellCount> cellLumaSums{};
+
+  std::vector<CpuResizeJob> jobs;
+  jobs.reserve(transforms.size());
+  for (size_t i = 0; i < transforms.size(); i++) {
+    const ResizeTransform& transform = transforms[i];
+    jobs.push_back(CpuResizeJob{
+        .input = input.getImage(),
+        .outputToInput = margelo::nitro::camera::resizer::utils::getOutputToFrameMatrix(transform),
+        .cropLeft = static_cast<float>(transform.crop.left),
+        .cropTop = static_cast<float>(transform.crop.top),
+        .cropRight = static_cast<float>(transform.crop.right),
+        .cropBottom = static_cast<float>(transform.crop.bottom),
+        .isPaddedOutsideCrop = _options.scaleMode == ScaleMode::CONTAIN,
+        .filter = _options.filter.value_or(ResizeFilter::BILINEAR),
+        .normalization = _normalization,
+        .channelOrder = _options.channelOrder,
+        .dataType = _options.dataType,
+        .pixelLayout = _options.pixelLayout,
+        .outputWidth = outputSize.width,
+        .outputHeight = outputSize.height,
+        .output = outputBufferView->getData() + (i * getOutputByteCount(outputSize)),
+        .cellLumaSums = enableFrameStatistics && i == 0 ? cellLumaSums.data() : nullptr,
+    });
+  }
+
+  // Split every image of the batch into bands of rows, and spread all bands across the worker pool.
+  const uint32_t bandsPerImage = (outputSize.height + kRowsPerTask - 1) / kRowsPerTask;
+  CpuWorkerPool::getShared().parallelFor(jobs.size() * bandsPerImage, [&](size_t task) {
+    const CpuResizeJob& job = jobs[task / bandsPerImage];
+    const uint32_t firstRow = static_cast<uint32_t>(task % bandsPerImage) * kRowsPerTask;
+    resizeRows(job, firstRow, std::min(firstRow + kRowsPerTask, job.outputHeight));
+  });
+
+  if (enableFrameStatistics) {
+    std::array<uint32_t, margelo::nitro::camera::resizer::utils::kFrameStatisticsCellCount> cellLumaSumValues{};
+    for (size_t cell = 0; cell < cellLumaSums.size(); cell++) {
+      cellLumaSumValues[cell] = cellLumaSums[cell].load(std::memory_order_relaxed);
+    }
+    std::lock_guard<std::mutex> lock(_stateMutex);
+    FrameStatistics frameStatistics =
+        margelo::nitro::camera::resizer::utils::makeFrameStatistics(cellLumaSumValues.data(), outputSize.width, outputSize.height, _previousThumbnail);
+    _previousThumbnail = frameStatistics.thumbnail;
+    outputBufferView->setFrameStatistics(std::move(frameStatistics));
+  }
+
+  return outputBufferView;
+}
+
+std::shared_ptr<vulkan::VulkanBufferView> CpuResizerPipeline::acquireOutputView(std::vector<ResizeTransform> transforms,
+                                                                                const margelo::nitro::camera::resizer::utils::OutputSize& outputSize) {
+  const size_t byteCount = getOutputByteCount(outputSize) * transforms.size();
+  std::lock_guard<std::mutex> lock(_stateMutex);
+  // Round-robin through the ring, starting after the most recently used slot.
+  for (size_t offset = 0; offset < _outputSlots.size(); offset++) {
+    const size_t slotIndex = (_nextSlotIndex + offset) % _outputSlots.size();
+    const std::shared_ptr<OutputSlot>& slot = _outputSlots[slotIndex];
+    bool isInUse = false;
+    if (!slot->isInUse.compare_exchange_strong(isInUse, true)) {
+      continue;
+    }
+
+    _nextSlotIndex = (slotIndex + 1) % _outputSlots.size();
+    if (slot->data.size() < byteCount) {
+      // The slot is claimed now, so nothing reads its old data anymore. Grow geometrically, but never beyond the largest size and batch.
+      const size_t maxByteCount = getOutputByteCount(margelo::nitro::camera::resizer::utils::getMaxOutputSize(_options)) * getMaxBatchSize();
+      slot->data = std::vector<uint8_t>(std::min(std::max(byteCount, slot->data.size() * 2), maxByteCount));
+    }
+    return std::make_shared<vulkan::VulkanBufferView>(outputSize.width, outputSize.height, std::move(transforms), _options.channelOrder, _options.dataType,
+                                                      _options.pixelLayout, slot->data.data(), byteCount, nullptr,
+                                                      [slot]() { slot->isInUse.store(false); });
+  }
+
+  if (_outputSlots.size() == 1) [[unlikely]] {
+    throw std::runtime_error("Previous GPUFrame is still active. Dispose it before calling resize() again.");
+  }
+  throw std::runtime_error("All " + std::to_string(_outputSlots.size()) +
+                           " GPUFrames are still active. Dispose one before calling resize() again, or increase `outputBufferCount`.");
+}
+
+AHardwareBuffer_Desc CpuResizerPipeline::describeInputBuffer(AHardwareBuffer* hardwareBuffer) {
+  if (hardwareBuffer == nullptr) [[unlikely]] {
+    throw std::runtime_error("Input AHardwareBuffer is null.");
+  }
+
+  AHardwareBuffer_Desc description{};
+  AHardwareBuffer_describe(hardwareBuffer, &description);
+  if (description.width == 0 || description.height == 0) [[unlikely]] {
+    throw std::runtime_error("Input AHardwareBuffer has invalid dimensions.");
+  }
+  if (description.format == AHARDWAREBUFFER_FORMAT_BLOB) [[unlikely]] {
+    throw std::runtime_error("AHardwareBuffer format BLOB cannot be resized.");
+  }
+  return description;
+}
+
+size_t CpuResizerPipeline::getOutputBufferCount() const {
+  const double outputBufferCount = _options.outputBufferCount.value_or(1);
+  if (outputBufferCount < 1 || outputBufferCount > static_cast<double>(kMaxOutputBufferCount) || std::floor(outputBufferCount) != outputBufferCount)
+      [[unlikely]] {
+    throw std::runtime_error("ResizerOptions.outputBufferCount must be an integer between 1 and " + std::to_string(kMaxOutputBufferCount) + ", but was " +
+                             std::to_string(outputBufferCount) + ".");
+  }
+  return static_cast<size_t>(outputBufferCount);
+}
+
+size_t CpuResizerPipeline::getMaxBatchSize() const {
+  const double maxBatchSize = _options.maxBatchSize.value_or(1);
+  if (maxBatchSize < 1 || maxBatchSize > static_cast<double>(kMaxBatchSize) || std::floor(maxBatchSize) != maxBatchSize) [[unlikely]] {
+    throw std::runtime_error("ResizerOptions.maxBatchSize must be an integer between 1 and " + std::to_string(kMaxBatchSize) + ", but was " +
+                             std::to_string(maxBatchSize) + ".");
+  }
+  return static_cast<size_t>(maxBatchSize);
+}
+
+size_t CpuResizerPipeline::getOutputByteCount(const margelo::nitro::camera::resizer::utils::OutputSize& outputSize) const {
+  // `pixelLayout` only changes how channel values are arranged in memory, not the total byte count.
+  return margelo::nitro::camera::resizer::utils::getOutputTotalByteCount(_options.channelOrder, _options.dataType, outputSize.width, outputSize.height);
+}
+
+} // namespace margelo::nitro::camera::resizer::cpu
@@ -0,0 +1,111 @@
+///
+/// CpuResizerPipeline.hpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include "Rect.hpp"
+#include "ResizeOptions.hpp"
+#include "ResizeTransform.hpp"
+#include "ResizerOptions.hpp"
+#include "cpu/CpuResizeKernel.hpp"
+#include "utils/CropRegion.hpp"
+#include "utils/OutputSize.hpp"
+#include "vulkan/VulkanBufferView.hpp"
+
+#include <android/hardware_buffer.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace margelo::nitro::camera::resizer::cpu {
+
+/**
+ * Resizes and converts frames on the CPU into a ring of reusable output buffers, for devices without usable Vulkan support.
+ * Produces the same output layout as `VulkanResizerPipeline`, so the results are wrapped in the same `VulkanBufferView`.
+ */
+class CpuResizerPipeline final {
+public:
+  /**
+   * Validates `options` and allocates every output buffer up-front, for the configured output size.
+   * An output buffer only grows once a larger `ResizeOptions.width`/`ResizeOptions.height` is requested.
+   *
+   * @throws If `options` are invalid, or request a `'native'` output, which requires Vulkan.
+   */
+  explicit CpuResizerPipeline(const ResizerOptions& options);
+  ~CpuResizerPipeline() = default;
+
+  CpuResizerPipeline(const CpuResizerPipeline&) = delete;
+  CpuResizerPipeline& operator=(const CpuResizerPipeline&) = delete;
+
+  /**
+   * Locks one AHardwareBuffer for CPU reads, resizes it, and returns a view over the next free output buffer.
+   * If `ResizeOptions.crop` is set, only that region of the input (in input pixels, before rotation and mirroring) is resized.
+   * If `ResizeOptions.width` or `ResizeOptions.height` is set, this call resizes to that size instead of the configured one.
+   *
+   * @throws If the input buffer cannot be read by the CPU, every output buffer is still held by a GPUFrame, or the requested size is
+   * larger than `ResizerOptions.maxWidth` x `ResizerOptions.maxHeight`.
+   */
+  [[nodiscard]] std::shared_ptr<vulkan::VulkanBufferView> run(AHardwareBuffer* hardwareBuffer, int rotationDegrees, bool isMirrored,
+                                                              const std::optional<ResizeOptions>& resizeOptions);
+  /**
+   * Resizes every region of one AHardwareBuffer into consecutive images of one output buffer.
+   * Each region is in input pixels, before rotation and mirroring.
+   *
+   * @throws If `regions` is empty or larger than `ResizerOptions.maxBatchSize`, or for the same reasons as `run(...)`.
+   */
+  [[nodiscard]] std::shared_ptr<vulkan::VulkanBufferView> runBatch(AHardwareBuffer* hardwareBuffer, int rotationDegrees, bool isMirrored,
+                                                                   const std::vector<Rect>& regions);
+  /**
+   * Reports whether a live GPU frame is still holding any of the reusable output buffers.
+   */
+  [[nodiscard]] bool hasActiveOutputView() const noexcept;
+  /**
+   * Reports how much native memory is pinned by the output buffers.
+   */
+  [[nodiscard]] size_t getOutputBufferAllocationSize() const noexcept;
+
+private:
+  static inline constexpr size_t kMaxOutputBufferCount = 8;
+  static inline constexpr size_t kMaxBatchSize = 64;
+  // Rows per task handed to the worker pool. Small enough to balance, large enough to amortize the hand-off.
+  static inline constexpr uint32_t kRowsPerTask = 16;
+
+  /**
+   * One entry of the output ring. Shared with the release callback of its view, so it outlives a disposed Resizer.
+   */
+  struct OutputSlot final {
+    std::vector<uint8_t> data;
+    std::atomic<bool> isInUse{false};
+  };
+
+  [[nodiscard]] std::shared_ptr<vulkan::VulkanBufferView> resizeRegions(AHardwareBuffer* hardwareBuffer, const AHardwareBuffer_Desc& description,
+                                                                        int rotationDegrees, bool isMirrored,
+                                                                        const std::vector<margelo::nitro::camera::resizer::utils::CropRegion>& cropRegions,
+                                                                        const margelo::nitro::camera::resizer::utils::OutputSize& outputSize);
+  [[nodiscard]] std::shared_ptr<vulkan::VulkanBufferView> acquireOutputView(std::vector<ResizeTransform> transforms,
+                                                                            const margelo::nitro::camera::resizer::utils::OutputSize& outputSize);
+  [[nodiscard]] static AHardwareBuffer_Desc describeInputBuffer(AHardwareBuffer* hardwareBuffer);
+
+  [[nodiscard]] size_t getOutputBufferCount() const;
+  [[nodiscard]] size_t getMaxBatchSize() const;
+  [[nodiscard]] size_t getOutputByteCount(const margelo::nitro::camera::resizer::utils::OutputSize& outputSize) const;
+
+private:
+  // Protects the round-robin position and the allocation sizes of the output ring, and the previous thumbnail.
+  mutable std::mutex _stateMutex;
+  ResizerOptions _options{};
+  margelo::nitro::camera::resizer::utils::OutputNormalization _normalization{};
+  std::vector<std::shared_ptr<OutputSlot>> _outputSlots{};
+  size_t _nextSlotIndex{0};
+  // The thumbnail of the last resize, to measure `FrameStatistics.motion` against. Empty until the first one.
+  std::vector<double> _previousThumbnail{};
+};
+
+} // namespace margelo::nitro::camera::resizer::cpu
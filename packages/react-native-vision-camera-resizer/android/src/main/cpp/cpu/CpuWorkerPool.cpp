@@ -0,0 +1,113 @@
+///
+/// CpuWorkerPool.cpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#include "cpu/CpuWorkerPool.hpp"
+
+#include <algorithm>
+
+namespace margelo::nitro::camera::resizer::cpu {
+
+namespace {
+
+  // Resizing is memory-bound, so more than a handful of threads mostly adds wake-up latency.
+  constexpr size_t kMaxConcurrency = 4;
+
+} // namespace
+
+CpuWorkerPool::CpuWorkerPool(size_t workerCount) {
+  _workers.reserve(workerCount);
+  for (size_t i = 0; i < workerCount; i++) {
+    _workers.emplace_back([this]() { workerLoop(); });
+  }
+}
+
+CpuWorkerPool::~CpuWorkerPool() {
+  {
+    std::lock_guard<std::mutex> lock(_stateMutex);
+    _isStopping = true;
+  }
+  _jobStarted.notify_all();
+  for (std::thread& worker : _workers) {
+    worker.join();
+  }
+}
+
+CpuWorkerPool& CpuWorkerPool::getShared() {
+  // The calling thread always participates, so start one worker less than the target concurrency.
+  static CpuWorkerPool pool(std::clamp<size_t>(std::thread::hardware_concurrency(), 1, kMaxConcurrency) - 1);
+  return pool;
+}
+
+size_t CpuWorkerPool::getConcurrency() const noexcept {
+  return _workers.size() + 1;
+}
+
+void CpuWorkerPool::parallelFor(size_t taskCount, const std::function<void(size_t)>& task) {
+  if (taskCount == 0) {
+    return;
+  }
+  if (_workers.empty() || taskCount == 1) {
+    // Not worth waking anyone up, and doesn't touch the shared job state.
+    for (size_t index = 0; index < taskCount; index++) {
+      task(index);
+    }
+    return;
+  }
+
+  std::lock_guard<std::mutex> jobLock(_jobMutex);
+  {
+    std::lock_guard<std::mutex> lock(_stateMutex);
+    _task = &task;
+    _taskCount = taskCount;
+    _nextTask.store(0, std::memory_order_relaxed);
+    _runningWorkerCount = _workers.size();
+    _jobGeneration++;
+  }
+  _jobStarted.notify_all();
+
+  runTasks(task, taskCount);
+
+  // `task` lives on this stack frame, so wait until no worker can still be calling it.
+  std::unique_lock<std::mutex> lock(_stateMutex);
+  _jobFinished.wait(lock, [this]() { return _runningWorkerCount == 0; });
+  _task = nullptr;
+}
+
+void CpuWorkerPool::workerLoop() {
+  uint64_t lastJobGeneration = 0;
+  while (true) {
+    const std::function<void(size_t)>* task = nullptr;
+    size_t taskCount = 0;
+    {
+      std::unique_lock<std::mutex> lock(_stateMutex);
+      _jobStarted.wait(lock, [&]() { return _isStopping || _jobGeneration != lastJobGeneration; });
+      if (_isStopping) {
+        return;
+      }
+      lastJobGeneration = _jobGeneration;
+      task = _task;
+      taskCount = _taskCount;
+    }
+
+    runTasks(*task, taskCount);
+
+    std::lock_guard<std::mutex> lock(_stateMutex);
+    _runningWorkerCount--;
+    if (_runningWorkerCount == 0) {
+      _jobFinished.notify_one();
+    }
+  }
+}
+
+void CpuWorkerPool::runTasks(const std::function<void(size_t)>& task, size_t taskCount) noexcept {
+  // Tasks are handed out one at a time, so a thread that was scheduled late simply picks up fewer of them.
+  for (size_t index = _nextTask.fetch_add(1, std::memory_order_relaxed); index < taskCount;
+       index = _nextTask.fetch_add(1, std::memory_order_relaxed)) {
+    task(index);
+  }
+}
+
+} // namespace margelo::nitro::camera::resizer::cpu
@@ -0,0 +1,70 @@
+///
+/// CpuWorkerPool.hpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace margelo::nitro::camera::resizer::cpu {
+
+/**
+ * A small, fixed pool of worker threads that splits one job into independent tasks (e.g. row bands of an output image).
+ * The calling thread works on the job too, and only one job runs at a time.
+ */
+class CpuWorkerPool final {
+public:
+  /**
+   * Starts `workerCount` background threads. With `0`, every job runs on the calling thread.
+   */
+  explicit CpuWorkerPool(size_t workerCount);
+  ~CpuWorkerPool();
+
+  CpuWorkerPool(const CpuWorkerPool&) = delete;
+  CpuWorkerPool& operator=(const CpuWorkerPool&) = delete;
+
+  /**
+   * Returns the process-wide pool shared by every CPU Resizer, sized for the device's cores.
+   */
+  [[nodiscard]] static CpuWorkerPool& getShared();
+
+  /**
+   * Returns how many threads (including the calling thread) work on one job.
+   */
+  [[nodiscard]] size_t getConcurrency() const noexcept;
+
+  /**
+   * Runs `task(0)` ... `task(taskCount - 1)` across the pool and blocks until all of them returned.
+   * Tasks run in no particular order and must not throw.
+   */
+  void parallelFor(size_t taskCount, const std::function<void(size_t)>& task);
+
+private:
+  void workerLoop();
+  void runTasks(const std::function<void(size_t)>& task, size_t taskCount) noexcept;
+
+private:
+  // Serializes jobs, so the shared job state below only ever describes one of them.
+  std::mutex _jobMutex;
+  std::mutex _stateMutex;
+  std::condition_variable _jobStarted;
+  std::condition_variable _jobFinished;
+  const std::function<void(size_t)>* _task{nullptr};
+  size_t _taskCount{0};
+  std::atomic<size_t> _nextTask{0};
+  size_t _runningWorkerCount{0};
+  uint64_t _jobGeneration{0};
+  bool _isStopping{false};
+  std::vector<std::thread> _workers{};
+};
+
+} // namespace margelo::nitro::camera::resizer::cpu
@@ -0,0 +1,31 @@
+///
+/// AndroidCacheDirectory.cpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#include "AndroidCacheDirectory.hpp"
+
+#include <mutex>
+#include <optional>
+
+namespace margelo::nitro::camera::resizer::utils {
+
+std::string JCacheDirectoryFactory::getCacheDirectory() {
+  static const auto method = javaClassStatic()->getStaticMethod<facebook::jni::local_ref<facebook::jni::JString>()>("getCacheDirectory");
+  return method(javaClassStatic())->toStdString();
+}
+
+const std::string& getAppCacheDirectory() {
+  static std::mutex mutex;
+  static std::optional<std::string> cacheDirectory;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  if (!cacheDirectory.has_value()) {
+    // Resizers are created on pooled C++ threads, which need the app class loader to find our Kotlin class.
+    facebook::jni::ThreadScope::WithClassLoader([&]() { cacheDirectory = JCacheDirectoryFactory::getCacheDirectory(); });
+  }
+  return cacheDirectory.value();
+}
+
+} // namespace margelo::nitro::camera::resizer::utils
@@ -0,0 +1,28 @@
+///
+/// AndroidCacheDirectory.hpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include <fbjni/fbjni.h>
+#include <string>
+
+namespace margelo::nitro::camera::resizer::utils {
+
+struct JCacheDirectoryFactory final : public facebook::jni::JavaClass<JCacheDirectoryFactory> {
+  static constexpr auto kJavaDescriptor = "Lcom/margelo/nitro/camera/resizer/CacheDirectoryFactory;";
+
+  [[nodiscard]] static std::string getCacheDirectory();
+};
+
+/**
+ * Returns the absolute path of the app's cache directory (`Context.getCacheDir()`).
+ * The path is resolved once over JNI and cached afterwards.
+ *
+ * @throws If the Android application context is not available yet.
+ */
+[[nodiscard]] const std::string& getAppCacheDirectory();
+
+} // namespace margelo::nitro::camera::resizer::utils
@@ -0,0 +1,41 @@
+///
+/// CropRegion.cpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#include "CropRegion.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace margelo::nitro::camera::resizer::utils {
+
+CropRegion getCropRegion(const std::optional<Rect>& crop, uint32_t inputWidth, uint32_t inputHeight) {
+  if (!crop.has_value()) {
+    return CropRegion{};
+  }
+
+  const double width = static_cast<double>(inputWidth);
+  const double height = static_cast<double>(inputHeight);
+  const double left = std::clamp(crop->left, 0.0, width);
+  const double right = std::clamp(crop->right, 0.0, width);
+  const double top = std::clamp(crop->top, 0.0, height);
+  const double bottom = std::clamp(crop->bottom, 0.0, height);
+  // NaN fails every comparison, so checking `!(a < b)` also rejects non-finite Rects.
+  if (!(left < right) || !(top < bottom)) [[unlikely]] {
+    throw std::runtime_error("Crop Rect (left: " + std::to_string(crop->left) + ", top: " + std::to_string(crop->top) +
+                             ", right: " + std::to_string(crop->right) + ", bottom: " + std::to_string(crop->bottom) +
+                             ") does not overlap the " + std::to_string(inputWidth) + "x" + std::to_string(inputHeight) + " Frame.");
+  }
+
+  return CropRegion{
+      .x = static_cast<float>(left / width),
+      .y = static_cast<float>(top / height),
+      .width = static_cast<float>((right - left) / width),
+      .height = static_cast<float>((bottom - top) / height),
+  };
+}
+
+} // namespace margelo::nitro::camera::resizer::utils
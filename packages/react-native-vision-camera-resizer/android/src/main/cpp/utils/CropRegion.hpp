@@ -0,0 +1,34 @@
+///
+/// CropRegion.hpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include "Rect.hpp"
+
+#include <cstdint>
+#include <optional>
+
+namespace margelo::nitro::camera::resizer::utils {
+
+/**
+ * A region of the input buffer in normalized texture coordinates (`0.0` ... `1.0`), before rotation and mirroring.
+ */
+struct CropRegion final {
+  float x{0.0f};
+  float y{0.0f};
+  float width{1.0f};
+  float height{1.0f};
+};
+
+/**
+ * Converts an optional crop `Rect` in input pixel coordinates into a normalized `CropRegion`.
+ * The `Rect` is clamped to the input bounds, and a missing `Rect` selects the full input.
+ *
+ * @throws If the clamped `Rect` is empty.
+ */
+[[nodiscard]] CropRegion getCropRegion(const std::optional<Rect>& crop, uint32_t inputWidth, uint32_t inputHeight);
+
+} // namespace margelo::nitro::camera::resizer::utils
@@ -0,0 +1,75 @@
+///
+/// FrameLumaStatistics.cpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#include "FrameLumaStatistics.hpp"
+
+#include <array>
+#include <cmath>
+
+namespace margelo::nitro::camera::resizer::utils {
+
+namespace {
+
+  /**
+   * Counts the pixels of an output axis `size` pixels long that fall into each grid cell.
+   */
+  std::array<uint32_t, kFrameStatisticsGridSize> getCellPixelCounts(uint32_t size) {
+    std::array<uint32_t, kFrameStatisticsGridSize> counts{};
+    for (uint32_t position = 0; position < size; position++) {
+      counts[getFrameStatisticsCell(position, size)]++;
+    }
+    return counts;
+  }
+
+  /**
+   * Maps every grid cell to the cell its value is read from. Outputs smaller than the grid leave some cells empty,
+   * which repeat the cell of the pixel below them instead.
+   */
+  std::array<uint32_t, kFrameStatisticsGridSize> getSourceCells(const std::array<uint32_t, kFrameStatisticsGridSize>& counts, uint32_t size) {
+    std::array<uint32_t, kFrameStatisticsGridSize> sourceCells{};
+    for (uint32_t cell = 0; cell < kFrameStatisticsGridSize; cell++) {
+      sourceCells[cell] = counts[cell] > 0 ? cell : getFrameStatisticsCell((cell * size) / kFrameStatisticsGridSize, size);
+    }
+    return sourceCells;
+  }
+
+} // namespace
+
+FrameStatistics makeFrameStatistics(const uint32_t* cellLumaSums, uint32_t width, uint32_t height, const std::vector<double>& previousThumbnail) {
+  const std::array<uint32_t, kFrameStatisticsGridSize> columnCounts = getCellPixelCounts(width);
+  const std::array<uint32_t, kFrameStatisticsGridSize> rowCounts = getCellPixelCounts(height);
+  const std::array<uint32_t, kFrameStatisticsGridSize> sourceColumns = getSourceCells(columnCounts, width);
+  const std::array<uint32_t, kFrameStatisticsGridSize> sourceRows = getSourceCells(rowCounts, height);
+
+  FrameStatistics statistics{};
+  statistics.thumbnail.resize(kFrameStatisticsCellCount);
+  uint64_t lumaSum = 0;
+  for (uint32_t row = 0; row < kFrameStatisticsGridSize; row++) {
+    for (uint32_t column = 0; column < kFrameStatisticsGridSize; column++) {
+      const size_t cellIndex = (row * kFrameStatisticsGridSize) + column;
+      const uint32_t sourceRow = sourceRows[row];
+      const uint32_t sourceColumn = sourceColumns[column];
+      const uint32_t cellSum = cellLumaSums[(sourceRow * kFrameStatisticsGridSize) + sourceColumn];
+      const double pixelCount = static_cast<double>(rowCounts[sourceRow]) * static_cast<double>(columnCounts[sourceColumn]);
+      statistics.thumbnail[cellIndex] = static_cast<double>(cellSum) / pixelCount;
+      if (sourceRow == row && sourceColumn == column) {
+        lumaSum += cellSum;
+      }
+    }
+  }
+  statistics.meanLuma = static_cast<double>(lumaSum) / (static_cast<double>(width) * static_cast<double>(height));
+
+  if (previousThumbnail.size() == kFrameStatisticsCellCount) {
+    double difference = 0.0;
+    for (size_t cellIndex = 0; cellIndex < kFrameStatisticsCellCount; cellIndex++) {
+      difference += std::abs(statistics.thumbnail[cellIndex] - previousThumbnail[cellIndex]);
+    }
+    statistics.motion = difference / static_cast<double>(kFrameStatisticsCellCount);
+  }
+  return statistics;
+}
+
+} // namespace margelo::nitro::camera::resizer::utils
@@ -0,0 +1,46 @@
+///
+/// FrameLumaStatistics.hpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include "FrameStatistics.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace margelo::nitro::camera::resizer::utils {
+
+/**
+ * `FrameStatistics` are accumulated over a `kFrameStatisticsGridSize` x `kFrameStatisticsGridSize` grid laid over the output.
+ * Every output pixel adds its luma (`0` ... `255`, see `getPixelLuma(...)`) to the sum of the cell it falls into.
+ */
+inline constexpr uint32_t kFrameStatisticsGridSize = 16;
+inline constexpr size_t kFrameStatisticsCellCount = kFrameStatisticsGridSize * kFrameStatisticsGridSize;
+
+/**
+ * Returns the grid column (or row) that output column (or row) `position` of an output `size` pixels wide (or high) falls into.
+ * Matches `frameStatisticsCell(...)` in `Resizer.comp`.
+ */
+[[nodiscard]] inline uint32_t getFrameStatisticsCell(uint32_t position, uint32_t size) noexcept {
+  return static_cast<uint32_t>((static_cast<uint64_t>(position) * kFrameStatisticsGridSize) / size);
+}
+
+/**
+ * Returns the BT.601 luma of a pixel with `0.0` ... `1.0` channels, rounded to `0` ... `255`. Matches `pixelLuma(...)` in `Resizer.comp`.
+ */
+[[nodiscard]] inline uint32_t getPixelLuma(float red, float green, float blue) noexcept {
+  return static_cast<uint32_t>((((0.299f * red) + (0.587f * green) + (0.114f * blue)) * 255.0f) + 0.5f);
+}
+
+/**
+ * Turns the per-cell luma sums of one `width` x `height` output image into `FrameStatistics`.
+ * `motion` is measured against `previousThumbnail`, and left unset if it is empty (i.e. for the first frame).
+ */
+[[nodiscard]] FrameStatistics makeFrameStatistics(const uint32_t* cellLumaSums, uint32_t width, uint32_t height,
+                                                  const std::vector<double>& previousThumbnail);
+
+} // namespace margelo::nitro::camera::resizer::utils
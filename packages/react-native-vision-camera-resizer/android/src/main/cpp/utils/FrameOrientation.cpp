@@ -0,0 +1,29 @@
+///
+/// FrameOrientation.cpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#include "FrameOrientation.hpp"
+
+#include <stdexcept>
+#include <string>
+
+namespace margelo::nitro::camera::resizer::utils {
+
+int orientationToDegrees(camera::CameraOrientation orientation) {
+  switch (orientation) {
+    case camera::CameraOrientation::UP:
+      return 0;
+    case camera::CameraOrientation::RIGHT:
+      return 90;
+    case camera::CameraOrientation::DOWN:
+      return 180;
+    case camera::CameraOrientation::LEFT:
+      return 270;
+  }
+
+  throw std::runtime_error("Unknown Frame orientation: " + std::to_string(static_cast<int>(orientation)));
+}
+
+} // namespace margelo::nitro::camera::resizer::utils
@@ -0,0 +1,20 @@
+///
+/// FrameOrientation.hpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include <VisionCamera/CameraOrientation.hpp>
+
+namespace margelo::nitro::camera::resizer::utils {
+
+/**
+ * Converts a Frame's orientation into the clockwise rotation (in degrees) the resizer applies to make it upright.
+ *
+ * @throws If `orientation` is not a known `CameraOrientation`.
+ */
+[[nodiscard]] int orientationToDegrees(camera::CameraOrientation orientation);
+
+} // namespace margelo::nitro::camera::resizer::utils
@@ -12,9 +12,15 @@ namespace margelo::nitro::camera::resizer::utils {
 
 uint32_t getChannelsPerPixel(ChannelOrder channelOrder) {
   switch (channelOrder) {
+    case ChannelOrder::GRAY:
+      return 1;
     case ChannelOrder::RGB:
     case ChannelOrder::BGR:
       return 3;
+    case ChannelOrder::RGBA:
+    case ChannelOrder::BGRA:
+    case ChannelOrder::ARGB:
+      return 4;
   }
 
   throw std::runtime_error("Unsupported Resizer ChannelOrder.");
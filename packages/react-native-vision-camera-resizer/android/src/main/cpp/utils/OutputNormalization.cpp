@@ -0,0 +1,108 @@
+///
+/// OutputNormalization.cpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#include "OutputNormalization.hpp"
+
+#include "OutputBufferLayout.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace margelo::nitro::camera::resizer::utils {
+
+namespace {
+
+  constexpr float kDefaultQuantizationScale = 1.0f / 255.0f;
+
+  /**
+   * Expands a per-channel option to one value per output channel, broadcasting a single value to every channel.
+   */
+  std::array<double, OutputNormalization::kMaxChannelCount> getPerChannelValues(const std::optional<std::vector<double>>& values, double defaultValue,
+                                                                                 uint32_t channelCount, const char* name) {
+    std::array<double, OutputNormalization::kMaxChannelCount> result{};
+    result.fill(defaultValue);
+    if (!values.has_value()) {
+      return result;
+    }
+
+    if (values->size() != 1 && values->size() != channelCount) [[unlikely]] {
+      throw std::runtime_error("ResizerOptions." + std::string(name) + " must contain 1 or " + std::to_string(channelCount) + " values, but contained " +
+                               std::to_string(values->size()) + ".");
+    }
+    for (uint32_t channel = 0; channel < channelCount; channel++) {
+      const double value = values->size() == 1 ? values->front() : values->at(channel);
+      if (!std::isfinite(value)) [[unlikely]] {
+        throw std::runtime_error("ResizerOptions." + std::string(name) + " must only contain finite values.");
+      }
+      result[channel] = value;
+    }
+    return result;
+  }
+
+  std::pair<double, double> getQuantizationRange(DataType dataType) {
+    switch (dataType) {
+      case DataType::INT8:
+        return {-128.0, 127.0};
+      case DataType::UINT8:
+        return {0.0, 255.0};
+      case DataType::FLOAT16:
+      case DataType::FLOAT32:
+        break;
+    }
+    throw std::runtime_error("Resizer DataType is not quantized.");
+  }
+
+} // namespace
+
+OutputNormalization getOutputNormalization(const ResizerOptions& options) {
+  const uint32_t channelCount = getChannelsPerPixel(options.channelOrder);
+  if (channelCount > OutputNormalization::kMaxChannelCount) [[unlikely]] {
+    throw std::runtime_error("Resizer output has more channels than the normalization stage supports.");
+  }
+
+  const auto mean = getPerChannelValues(options.mean, 0.0, channelCount, "mean");
+  const auto standardDeviation = getPerChannelValues(options.standardDeviation, 1.0, channelCount, "standardDeviation");
+
+  OutputNormalization normalization{};
+  for (uint32_t channel = 0; channel < channelCount; channel++) {
+    if (standardDeviation[channel] == 0.0) [[unlikely]] {
+      throw std::runtime_error("ResizerOptions.standardDeviation must not contain zero.");
+    }
+    // (x - mean) / std == x * (1 / std) + (-mean / std), which the shader evaluates as a single fma.
+    normalization.channelScale[channel] = static_cast<float>(1.0 / standardDeviation[channel]);
+    normalization.channelBias[channel] = static_cast<float>(-mean[channel] / standardDeviation[channel]);
+  }
+
+  const bool isQuantized = options.dataType == DataType::INT8 || options.dataType == DataType::UINT8;
+  if (!isQuantized) {
+    if (options.quantizationScale.has_value() || options.quantizationZeroPoint.has_value()) [[unlikely]] {
+      throw std::runtime_error("ResizerOptions.quantizationScale and ResizerOptions.quantizationZeroPoint are only supported for 'int8' and 'uint8' outputs.");
+    }
+    return normalization;
+  }
+
+  // Defaults reproduce the plain [0, 1] -> [0, 255] (uint8) or [-128, 127] (int8) mapping.
+  const auto [minValue, maxValue] = getQuantizationRange(options.dataType);
+  const double quantizationScale = options.quantizationScale.value_or(kDefaultQuantizationScale);
+  const double quantizationZeroPoint = options.quantizationZeroPoint.value_or(minValue);
+  if (!std::isfinite(quantizationScale) || quantizationScale <= 0.0) [[unlikely]] {
+    throw std::runtime_error("ResizerOptions.quantizationScale must be greater than zero, but was " + std::to_string(quantizationScale) + ".");
+  }
+  if (std::trunc(quantizationZeroPoint) != quantizationZeroPoint || quantizationZeroPoint < minValue || quantizationZeroPoint > maxValue) [[unlikely]] {
+    throw std::runtime_error("ResizerOptions.quantizationZeroPoint must be an integer between " + std::to_string(static_cast<int>(minValue)) + " and " +
+                             std::to_string(static_cast<int>(maxValue)) + ", but was " + std::to_string(quantizationZeroPoint) + ".");
+  }
+  normalization.inverseQuantizationScale = static_cast<float>(1.0 / quantizationScale);
+  normalization.quantizationZeroPoint = static_cast<float>(quantizationZeroPoint);
+  return normalization;
+}
+
+} // namespace margelo::nitro::camera::resizer::utils
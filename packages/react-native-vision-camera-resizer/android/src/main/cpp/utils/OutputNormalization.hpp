@@ -0,0 +1,38 @@
+///
+/// OutputNormalization.hpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include "ResizerOptions.hpp"
+
+#include <array>
+#include <cstddef>
+
+namespace margelo::nitro::camera::resizer::utils {
+
+/**
+ * The fused per-channel normalization and quantization applied to every output value.
+ * Channels are in output `ChannelOrder`, and each value is written as `x * channelScale + channelBias`,
+ * i.e. `(x - mean) / standardDeviation`, before 8-bit outputs are quantized with `round(value * inverseQuantizationScale) + quantizationZeroPoint`.
+ */
+struct OutputNormalization final {
+  static inline constexpr size_t kMaxChannelCount = 4;
+
+  std::array<float, kMaxChannelCount> channelScale{};
+  std::array<float, kMaxChannelCount> channelBias{};
+  float inverseQuantizationScale{0.0f};
+  float quantizationZeroPoint{0.0f};
+};
+
+/**
+ * Validates the normalization options of `options` and folds them into per-channel multiply-add factors.
+ *
+ * @throws If `mean`/`standardDeviation` don't have 1 or channel-count entries, a standard deviation is zero, or the
+ * quantization options are invalid or set for a float output.
+ */
+[[nodiscard]] OutputNormalization getOutputNormalization(const ResizerOptions& options);
+
+} // namespace margelo::nitro::camera::resizer::utils
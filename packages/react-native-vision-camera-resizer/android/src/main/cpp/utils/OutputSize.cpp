@@ -0,0 +1,57 @@
+///
+/// OutputSize.cpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#include "OutputSize.hpp"
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace margelo::nitro::camera::resizer::utils {
+
+namespace {
+
+  uint32_t getDimension(const std::optional<double>& value, uint32_t minValue, uint32_t maxValue, const char* name) {
+    const double dimension = value.value_or(static_cast<double>(maxValue));
+    if (dimension < static_cast<double>(minValue) || dimension > static_cast<double>(maxValue) || std::floor(dimension) != dimension) [[unlikely]] {
+      throw std::runtime_error(std::string(name) + " must be an integer between " + std::to_string(minValue) + " and " + std::to_string(maxValue) +
+                               ", but was " + std::to_string(dimension) + ".");
+    }
+    return static_cast<uint32_t>(dimension);
+  }
+
+} // namespace
+
+OutputSize getOutputSize(const ResizerOptions& options) noexcept {
+  return OutputSize{
+      .width = static_cast<uint32_t>(std::lround(options.width)),
+      .height = static_cast<uint32_t>(std::lround(options.height)),
+  };
+}
+
+OutputSize getMaxOutputSize(const ResizerOptions& options) {
+  // Bounds the output allocation: 16384 is the largest texture size any supported GPU can sample into anyways.
+  static constexpr uint32_t kMaxDimension = 16384;
+  const OutputSize size = getOutputSize(options);
+  return OutputSize{
+      .width = getDimension(options.maxWidth.value_or(static_cast<double>(size.width)), size.width, kMaxDimension, "ResizerOptions.maxWidth"),
+      .height = getDimension(options.maxHeight.value_or(static_cast<double>(size.height)), size.height, kMaxDimension, "ResizerOptions.maxHeight"),
+  };
+}
+
+OutputSize getRequestedOutputSize(const ResizerOptions& options, const std::optional<ResizeOptions>& resizeOptions) {
+  const OutputSize size = getOutputSize(options);
+  if (!resizeOptions.has_value() || (!resizeOptions->width.has_value() && !resizeOptions->height.has_value())) {
+    return size;
+  }
+  const OutputSize maxSize = getMaxOutputSize(options);
+  return OutputSize{
+      .width = resizeOptions->width.has_value() ? getDimension(resizeOptions->width, 1, maxSize.width, "ResizeOptions.width") : size.width,
+      .height = resizeOptions->height.has_value() ? getDimension(resizeOptions->height, 1, maxSize.height, "ResizeOptions.height") : size.height,
+  };
+}
+
+} // namespace margelo::nitro::camera::resizer::utils
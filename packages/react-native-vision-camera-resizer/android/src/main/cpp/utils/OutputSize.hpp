@@ -0,0 +1,44 @@
+///
+/// OutputSize.hpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include "ResizeOptions.hpp"
+#include "ResizerOptions.hpp"
+
+#include <cstdint>
+#include <optional>
+
+namespace margelo::nitro::camera::resizer::utils {
+
+/**
+ * The size of one output image, in output pixels.
+ */
+struct OutputSize final {
+  uint32_t width{0};
+  uint32_t height{0};
+};
+
+/**
+ * Returns the output size the Resizer was created with, which every `resize(...)` uses unless it requests its own.
+ */
+[[nodiscard]] OutputSize getOutputSize(const ResizerOptions& options) noexcept;
+
+/**
+ * Returns the largest output size a single `resize(...)` may request, which the output buffers can grow to.
+ *
+ * @throws If `ResizerOptions.maxWidth` or `ResizerOptions.maxHeight` is not an integer at least as large as the configured size.
+ */
+[[nodiscard]] OutputSize getMaxOutputSize(const ResizerOptions& options);
+
+/**
+ * Returns the output size of one `resize(...)` call. Each axis of `resizeOptions` falls back to the configured size on its own.
+ *
+ * @throws If `ResizeOptions.width` or `ResizeOptions.height` is not an integer between `1` and the maximum output size.
+ */
+[[nodiscard]] OutputSize getRequestedOutputSize(const ResizerOptions& options, const std::optional<ResizeOptions>& resizeOptions);
+
+} // namespace margelo::nitro::camera::resizer::utils
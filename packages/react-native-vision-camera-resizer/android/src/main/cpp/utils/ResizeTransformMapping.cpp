@@ -0,0 +1,127 @@
+///
+/// ResizeTransformMapping.cpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#include "ResizeTransformMapping.hpp"
+
+#include <algorithm>
+
+namespace margelo::nitro::camera::resizer::utils {
+
+namespace {
+
+  struct Point final {
+    double x{0.0};
+    double y{0.0};
+  };
+
+  [[nodiscard]] int normalizeRotation(int rotationDegrees) noexcept {
+    const int rotation = rotationDegrees % 360;
+    return rotation < 0 ? rotation + 360 : rotation;
+  }
+
+  [[nodiscard]] bool isSideways(int rotationDegrees) noexcept {
+    return rotationDegrees == 90 || rotationDegrees == 270;
+  }
+
+  /**
+   * Mirrors `outputToInputCoordinate(...)` in `Resizer.comp`: output pixel -> input pixel, without clamping to the crop.
+   */
+  [[nodiscard]] Point outputToInputPoint(const ResizeTransform& transform, Point output) noexcept {
+    const int rotation = normalizeRotation(static_cast<int>(transform.rotationDegrees));
+    const double cropWidth = transform.crop.right - transform.crop.left;
+    const double cropHeight = transform.crop.bottom - transform.crop.top;
+    const double uprightWidth = isSideways(rotation) ? cropHeight : cropWidth;
+    const double uprightHeight = isSideways(rotation) ? cropWidth : cropHeight;
+
+    // Undo the scale and letterbox offset, normalized to the upright crop.
+    Point coordinate{
+        .x = ((output.x - transform.offsetX) / transform.scaleX) / uprightWidth,
+        .y = ((output.y - transform.offsetY) / transform.scaleY) / uprightHeight,
+    };
+    // Undo rotation before mirroring, exactly like the shader.
+    switch ((360 - rotation) % 360) {
+      case 90:
+        coordinate = Point{.x = 1.0 - coordinate.y, .y = coordinate.x};
+        break;
+      case 180:
+        coordinate = Point{.x = 1.0 - coordinate.x, .y = 1.0 - coordinate.y};
+        break;
+      case 270:
+        coordinate = Point{.x = coordinate.y, .y = 1.0 - coordinate.x};
+        break;
+      default:
+        break;
+    }
+    if (transform.isMirrored) {
+      coordinate.x = 1.0 - coordinate.x;
+    }
+
+    return Point{
+        .x = transform.crop.left + (coordinate.x * cropWidth),
+        .y = transform.crop.top + (coordinate.y * cropHeight),
+    };
+  }
+
+} // namespace
+
+ResizeTransform getResizeTransform(const CropRegion& cropRegion, uint32_t inputWidth, uint32_t inputHeight, uint32_t outputWidth,
+                                   uint32_t outputHeight, int rotationDegrees, bool isMirrored, ScaleMode scaleMode) {
+  const double left = static_cast<double>(cropRegion.x) * inputWidth;
+  const double top = static_cast<double>(cropRegion.y) * inputHeight;
+  const double cropWidth = static_cast<double>(cropRegion.width) * inputWidth;
+  const double cropHeight = static_cast<double>(cropRegion.height) * inputHeight;
+  const Rect crop(left, left + cropWidth, top, top + cropHeight);
+
+  const int rotation = normalizeRotation(rotationDegrees);
+  const double uprightWidth = isSideways(rotation) ? cropHeight : cropWidth;
+  const double uprightHeight = isSideways(rotation) ? cropWidth : cropHeight;
+  const double width = static_cast<double>(outputWidth);
+  const double height = static_cast<double>(outputHeight);
+
+  double scaleX = width / uprightWidth;
+  double scaleY = height / uprightHeight;
+  switch (scaleMode) {
+    case ScaleMode::COVER:
+      scaleX = scaleY = std::max(scaleX, scaleY);
+      break;
+    case ScaleMode::CONTAIN:
+      scaleX = scaleY = std::min(scaleX, scaleY);
+      break;
+    case ScaleMode::STRETCH:
+      break;
+  }
+
+  return ResizeTransform(crop, static_cast<double>(rotation), isMirrored, scaleX, scaleY, (width - (uprightWidth * scaleX)) * 0.5,
+                         (height - (uprightHeight * scaleY)) * 0.5);
+}
+
+OutputToFrameMatrix getOutputToFrameMatrix(const ResizeTransform& transform) noexcept {
+  // Every step of the mapping is affine, so it is fully described by where the origin and both unit vectors land.
+  const Point origin = outputToInputPoint(transform, Point{.x = 0.0, .y = 0.0});
+  const Point unitX = outputToInputPoint(transform, Point{.x = 1.0, .y = 0.0});
+  const Point unitY = outputToInputPoint(transform, Point{.x = 0.0, .y = 1.0});
+  return OutputToFrameMatrix{
+      .m00 = static_cast<float>(unitX.x - origin.x),
+      .m01 = static_cast<float>(unitY.x - origin.x),
+      .m10 = static_cast<float>(unitX.y - origin.y),
+      .m11 = static_cast<float>(unitY.y - origin.y),
+      .tx = static_cast<float>(origin.x),
+      .ty = static_cast<float>(origin.y),
+  };
+}
+
+void convertOutputPointsToFramePoints(const ResizeTransform& transform, float* points, size_t pointCount) noexcept {
+  // Fold the mapping into one matrix once to keep the per-point loop branch-free.
+  const OutputToFrameMatrix matrix = getOutputToFrameMatrix(transform);
+  for (size_t i = 0; i < pointCount; i++) {
+    const float x = points[(i * 2) + 0];
+    const float y = points[(i * 2) + 1];
+    points[(i * 2) + 0] = (matrix.m00 * x) + (matrix.m01 * y) + matrix.tx;
+    points[(i * 2) + 1] = (matrix.m10 * x) + (matrix.m11 * y) + matrix.ty;
+  }
+}
+
+} // namespace margelo::nitro::camera::resizer::utils
@@ -0,0 +1,48 @@
+///
+/// ResizeTransformMapping.hpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include "CropRegion.hpp"
+#include "ResizeTransform.hpp"
+#include "ScaleMode.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace margelo::nitro::camera::resizer::utils {
+
+/**
+ * A 2x3 affine matrix that maps `x, y` output pixel coordinates to input (Frame) pixel coordinates:
+ * `input = (m00 * x + m01 * y + tx, m10 * x + m11 * y + ty)`.
+ */
+struct OutputToFrameMatrix final {
+  float m00{1.0f};
+  float m01{0.0f};
+  float m10{0.0f};
+  float m11{1.0f};
+  float tx{0.0f};
+  float ty{0.0f};
+};
+
+/**
+ * Describes how the resize shader placed `cropRegion` of a `inputWidth`x`inputHeight` buffer into the output:
+ * the crop in input pixels, plus the scale and letterbox offset applied to the rotated and mirrored crop.
+ */
+[[nodiscard]] ResizeTransform getResizeTransform(const CropRegion& cropRegion, uint32_t inputWidth, uint32_t inputHeight, uint32_t outputWidth,
+                                                 uint32_t outputHeight, int rotationDegrees, bool isMirrored, ScaleMode scaleMode);
+
+/**
+ * Folds the mapping of `transform` from output pixels back into input (Frame) pixels into one affine matrix.
+ */
+[[nodiscard]] OutputToFrameMatrix getOutputToFrameMatrix(const ResizeTransform& transform) noexcept;
+
+/**
+ * Maps `pointCount` interleaved `x, y` output pixel coordinates back into input (Frame) pixel coordinates, in-place.
+ */
+void convertOutputPointsToFramePoints(const ResizeTransform& transform, float* points, size_t pointCount) noexcept;
+
+} // namespace margelo::nitro::camera::resizer::utils
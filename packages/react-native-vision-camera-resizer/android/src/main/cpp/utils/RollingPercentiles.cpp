@@ -0,0 +1,56 @@
+///
+/// RollingPercentiles.cpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#include "RollingPercentiles.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace margelo::nitro::camera::resizer::utils {
+
+namespace {
+
+  double getPercentile(const std::vector<double>& sortedSamples, double percentile) {
+    // Nearest-rank, so every reported value is an actually observed sample.
+    const size_t rank = static_cast<size_t>(std::ceil(percentile * static_cast<double>(sortedSamples.size())));
+    return sortedSamples[std::clamp<size_t>(rank, 1, sortedSamples.size()) - 1];
+  }
+
+} // namespace
+
+RollingPercentiles::RollingPercentiles(size_t capacity) : _capacity(capacity) {
+  if (capacity == 0) [[unlikely]] {
+    throw std::runtime_error("RollingPercentiles requires a capacity of at least 1.");
+  }
+  _samples.reserve(capacity);
+}
+
+void RollingPercentiles::addSample(double value) {
+  if (_samples.size() < _capacity) {
+    _samples.push_back(value);
+  } else {
+    _samples[_nextIndex] = value;
+  }
+  _nextIndex = (_nextIndex + 1) % _capacity;
+}
+
+RollingPercentiles::Summary RollingPercentiles::getSummary() const {
+  if (_samples.empty()) {
+    return {};
+  }
+
+  std::vector<double> sortedSamples = _samples;
+  std::sort(sortedSamples.begin(), sortedSamples.end());
+  return Summary{
+      .sampleCount = sortedSamples.size(),
+      .p50 = getPercentile(sortedSamples, 0.50),
+      .p95 = getPercentile(sortedSamples, 0.95),
+      .p99 = getPercentile(sortedSamples, 0.99),
+  };
+}
+
+} // namespace margelo::nitro::camera::resizer::utils
@@ -0,0 +1,44 @@
+///
+/// RollingPercentiles.hpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace margelo::nitro::camera::resizer::utils {
+
+/**
+ * Keeps the most recent `capacity` samples of a measurement and computes percentiles over them.
+ * Adding a sample is O(1), only `getSummary()` sorts.
+ */
+class RollingPercentiles final {
+public:
+  struct Summary final {
+    size_t sampleCount{0};
+    double p50{0.0};
+    double p95{0.0};
+    double p99{0.0};
+  };
+
+  explicit RollingPercentiles(size_t capacity);
+
+  /**
+   * Adds one sample, replacing the oldest one once `capacity` samples have been added.
+   */
+  void addSample(double value);
+  /**
+   * Computes the nearest-rank percentiles of the current samples, or an empty summary if there are none.
+   */
+  [[nodiscard]] Summary getSummary() const;
+
+private:
+  std::vector<double> _samples{};
+  size_t _capacity{0};
+  size_t _nextIndex{0};
+};
+
+} // namespace margelo::nitro::camera::resizer::utils
@@ -0,0 +1,37 @@
+///
+/// TextureOutput.cpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#include "TextureOutput.hpp"
+
+#include "utils/OutputSize.hpp"
+
+#include <stdexcept>
+
+namespace margelo::nitro::camera::resizer::utils {
+
+bool isTextureOutput(const ResizerOptions& options) noexcept {
+  return options.outputBufferType.value_or(OutputBufferType::CPU) == OutputBufferType::TEXTURE;
+}
+
+void validateTextureOutput(const ResizerOptions& options) {
+  if (!isTextureOutput(options)) {
+    return;
+  }
+  // Every pixel is copied as-is into an RGBA8 texel, so the output must already have that exact layout.
+  if (options.dataType != DataType::UINT8 || options.pixelLayout != PixelLayout::INTERLEAVED || options.channelOrder != ChannelOrder::RGBA) [[unlikely]] {
+    throw std::runtime_error("ResizerOptions.outputBufferType 'texture' requires dataType 'uint8', pixelLayout 'interleaved' and channelOrder 'rgba'.");
+  }
+  if (options.maxBatchSize.value_or(1) != 1) [[unlikely]] {
+    throw std::runtime_error("ResizerOptions.outputBufferType 'texture' holds a single image, so it requires a maxBatchSize of 1.");
+  }
+  const OutputSize size = getOutputSize(options);
+  const OutputSize maxSize = getMaxOutputSize(options);
+  if (maxSize.width != size.width || maxSize.height != size.height) [[unlikely]] {
+    throw std::runtime_error("ResizerOptions.outputBufferType 'texture' has a fixed size, so it does not support ResizerOptions.maxWidth/maxHeight.");
+  }
+}
+
+} // namespace margelo::nitro::camera::resizer::utils
@@ -0,0 +1,27 @@
+///
+/// TextureOutput.hpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include "ResizerOptions.hpp"
+
+namespace margelo::nitro::camera::resizer::utils {
+
+/**
+ * Returns whether the Resizer copies its output into an image-format `AHardwareBuffer` (`outputBufferType: 'texture'`).
+ */
+[[nodiscard]] bool isTextureOutput(const ResizerOptions& options) noexcept;
+
+/**
+ * Checks that a texture output can be stored in an `AHARDWAREBUFFER_FORMAT_R8G8B8A8_UNORM` buffer of the configured size as-is.
+ * Does nothing for any other `OutputBufferType`.
+ *
+ * @throws If the output is not `'uint8'` `'interleaved'` `'rgba'`, `ResizerOptions.maxBatchSize` is not `1`, or
+ * `ResizerOptions.maxWidth`/`ResizerOptions.maxHeight` allow a size other than the configured one.
+ */
+void validateTextureOutput(const ResizerOptions& options);
+
+} // namespace margelo::nitro::camera::resizer::utils
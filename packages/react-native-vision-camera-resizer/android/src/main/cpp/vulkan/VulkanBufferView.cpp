@@ -10,10 +10,11 @@
 
 namespace margelo::nitro::camera::resizer::vulkan {
 
-VulkanBufferView::VulkanBufferView(uint32_t width, uint32_t height, ChannelOrder channelOrder, DataType dataType, PixelLayout pixelLayout, uint8_t* data,
-                                   size_t byteCount, std::function<void()>&& onRelease)
-    : _width(width), _height(height), _channelOrder(channelOrder), _dataType(dataType), _pixelLayout(pixelLayout), _data(data), _byteCount(byteCount),
-      _onRelease(std::move(onRelease)) {}
+VulkanBufferView::VulkanBufferView(uint32_t width, uint32_t height, std::vector<ResizeTransform> transforms, ChannelOrder channelOrder, DataType dataType,
+                                   PixelLayout pixelLayout, uint8_t* data, size_t byteCount, AHardwareBuffer* hardwareBuffer,
+                                   std::function<void()>&& onRelease)
+    : _width(width), _height(height), _transforms(std::move(transforms)), _channelOrder(channelOrder), _dataType(dataType), _pixelLayout(pixelLayout), _data(data), _byteCount(byteCount),
+      _hardwareBuffer(hardwareBuffer), _onRelease(std::move(onRelease)) {}
 
 VulkanBufferView::~VulkanBufferView() {
   if (_onRelease != nullptr) {
@@ -30,6 +31,10 @@ uint32_t VulkanBufferView::getHeight() const noexcept {
   return _height;
 }
 
+uint32_t VulkanBufferView::getBatchSize() const noexcept {
+  return static_cast<uint32_t>(_transforms.size());
+}
+
 ChannelOrder VulkanBufferView::getChannelOrder() const noexcept {
   return _channelOrder;
 }
@@ -50,4 +55,20 @@ size_t VulkanBufferView::getByteCount() const noexcept {
   return _byteCount;
 }
 
+AHardwareBuffer* VulkanBufferView::getHardwareBuffer() const noexcept {
+  return _hardwareBuffer;
+}
+
+const std::vector<ResizeTransform>& VulkanBufferView::getTransforms() const noexcept {
+  return _transforms;
+}
+
+const std::optional<FrameStatistics>& VulkanBufferView::getFrameStatistics() const noexcept {
+  return _frameStatistics;
+}
+
+void VulkanBufferView::setFrameStatistics(FrameStatistics frameStatistics) {
+  _frameStatistics = std::move(frameStatistics);
+}
+
 } // namespace margelo::nitro::camera::resizer::vulkan
@@ -8,23 +8,31 @@
 
 #include "ChannelOrder.hpp"
 #include "DataType.hpp"
+#include "FrameStatistics.hpp"
 #include "PixelLayout.hpp"
+#include "ResizeTransform.hpp"
+#include <android/hardware_buffer.h>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <optional>
+#include <vector>
 
 namespace margelo::nitro::camera::resizer::vulkan {
 
 /**
- * Exposes one zero-copy view over the mapped Vulkan output buffer.
+ * Exposes one zero-copy view over the mapped Vulkan output buffer, or over the `AHardwareBuffer` backing a native output.
+ * The CPU fallback (`CpuResizerPipeline`) hands out the same views over its own output memory.
  */
 class VulkanBufferView final {
 public:
   /**
-   * Wraps the mapped output memory and the callback that releases the reusable output slot.
+   * Wraps the output memory and the callback that releases the reusable output slot.
+   * `data` is `nullptr` for native outputs, which are only reachable through `hardwareBuffer`. Texture outputs have both.
+   * `transforms` holds one entry per image of the batch.
    */
-  VulkanBufferView(uint32_t width, uint32_t height, ChannelOrder channelOrder, DataType dataType, PixelLayout pixelLayout, uint8_t* data, size_t byteCount,
-                   std::function<void()>&& onRelease);
+  VulkanBufferView(uint32_t width, uint32_t height, std::vector<ResizeTransform> transforms, ChannelOrder channelOrder, DataType dataType, PixelLayout pixelLayout,
+                   uint8_t* data, size_t byteCount, AHardwareBuffer* hardwareBuffer, std::function<void()>&& onRelease);
   ~VulkanBufferView();
 
   VulkanBufferView(const VulkanBufferView&) = delete;
@@ -32,21 +40,35 @@ public:
 
   [[nodiscard]] uint32_t getWidth() const noexcept;
   [[nodiscard]] uint32_t getHeight() const noexcept;
+  [[nodiscard]] uint32_t getBatchSize() const noexcept;
   [[nodiscard]] ChannelOrder getChannelOrder() const noexcept;
   [[nodiscard]] DataType getDataType() const noexcept;
   [[nodiscard]] PixelLayout getPixelLayout() const noexcept;
   [[nodiscard]] uint8_t* getData() const noexcept;
   [[nodiscard]] size_t getByteCount() const noexcept;
+  [[nodiscard]] AHardwareBuffer* getHardwareBuffer() const noexcept;
+  [[nodiscard]] const std::vector<ResizeTransform>& getTransforms() const noexcept;
+  /**
+   * Returns the `FrameStatistics` of the first image, or `std::nullopt` if the Resizer was not created with `ResizerOptions.enableFrameStatistics`.
+   */
+  [[nodiscard]] const std::optional<FrameStatistics>& getFrameStatistics() const noexcept;
+  /**
+   * Attaches the `FrameStatistics` computed alongside this output. Must be called before the view is handed out to JS.
+   */
+  void setFrameStatistics(FrameStatistics frameStatistics);
 
 private:
   const uint32_t _width;
   const uint32_t _height;
+  const std::vector<ResizeTransform> _transforms;
   const ChannelOrder _channelOrder;
   const DataType _dataType;
   const PixelLayout _pixelLayout;
   uint8_t* const _data;
   const size_t _byteCount;
+  AHardwareBuffer* const _hardwareBuffer;
   std::function<void()> _onRelease;
+  std::optional<FrameStatistics> _frameStatistics{};
 };
 
 } // namespace margelo::nitro::camera::resizer::vulkan
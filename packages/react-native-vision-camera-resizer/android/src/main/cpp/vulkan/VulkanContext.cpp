@@ -0,0 +1,246 @@
+///
+/// VulkanContext.cpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#include "vulkan/VulkanContext.hpp"
+
+#include "utils/AndroidCacheDirectory.hpp"
+#include "vulkan/VulkanPhysicalDeviceSelector.hpp"
+#include "vulkan/VulkanShaderAssetLoader.hpp"
+#include "vulkan/VulkanUtils.hpp"
+
+#include <android/log.h>
+#include <exception>
+#include <string>
+#include <vector>
+
+namespace margelo::nitro::camera::resizer::vulkan {
+
+namespace {
+
+  VkApplicationInfo makeApplicationInfo() noexcept {
+    return VkApplicationInfo{
+        .sType = VK_STRUCTURE_TYPE_APPLICATION_INFO,
+        .pNext = nullptr,
+        .pApplicationName = "VisionCameraResizer",
+        .applicationVersion = VK_MAKE_VERSION(1, 0, 0),
+        .pEngineName = "VisionCameraResizer",
+        .engineVersion = VK_MAKE_VERSION(1, 0, 0),
+        .apiVersion = VK_API_VERSION_1_1,
+    };
+  }
+
+  VkResult createVkInstance(VkInstance* instance) noexcept {
+    const VkApplicationInfo applicationInfo = makeApplicationInfo();
+    VkInstanceCreateInfo instanceCreateInfo{
+        .sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .pApplicationInfo = &applicationInfo,
+        .enabledLayerCount = 0,
+        .ppEnabledLayerNames = nullptr,
+        .enabledExtensionCount = 0,
+        .ppEnabledExtensionNames = nullptr,
+    };
+    return vkCreateInstance(&instanceCreateInfo, nullptr, instance);
+  }
+
+  // Guards the weak reference below. Only the shared context itself is ref-counted by its owners.
+  std::mutex sharedContextMutex;
+  std::weak_ptr<VulkanContext> sharedContext;
+
+} // namespace
+
+std::shared_ptr<VulkanContext> VulkanContext::getShared() {
+  std::lock_guard<std::mutex> lock(sharedContextMutex);
+  if (std::shared_ptr<VulkanContext> context = sharedContext.lock()) {
+    // A Resizer is still alive - reuse its instance, device and queue.
+    return context;
+  }
+
+  auto context = std::make_shared<VulkanContext>();
+  sharedContext = context;
+  return context;
+}
+
+bool VulkanContext::isSupported() noexcept {
+  {
+    std::lock_guard<std::mutex> lock(sharedContextMutex);
+    if (!sharedContext.expired()) {
+      // We already created a device with all required extensions.
+      return true;
+    }
+  }
+
+  VkInstance instance = VK_NULL_HANDLE;
+  try {
+    utils::checkVk(createVkInstance(&instance), "Failed to create a Vulkan instance.");
+    const VulkanInstanceDispatch instanceDispatch = VulkanInstanceDispatch::load(instance);
+    const physical_device_selector::Selection selection = physical_device_selector::select(instance, instanceDispatch, kRequiredDeviceExtensions);
+    vkDestroyInstance(instance, nullptr);
+    return selection.physicalDevice != VK_NULL_HANDLE;
+  } catch (...) {
+    if (instance != VK_NULL_HANDLE) {
+      vkDestroyInstance(instance, nullptr);
+    }
+    return false;
+  }
+}
+
+VulkanContext::VulkanContext() {
+  try {
+    createInstance();
+    createDevice();
+    createShaderModule();
+    createPipelineCache();
+  } catch (...) {
+    destroy();
+    throw;
+  }
+}
+
+VulkanContext::~VulkanContext() {
+  destroy();
+}
+
+void VulkanContext::submit(const VkSubmitInfo& submitInfo, VkFence fence) {
+  std::lock_guard<std::mutex> lock(_queueMutex);
+  utils::checkVk(vkQueueSubmit(_queue, 1, &submitInfo, fence), "Failed to submit the Vulkan resizer command buffer.");
+}
+
+VkPhysicalDevice VulkanContext::getPhysicalDevice() const noexcept {
+  return _physicalDevice;
+}
+
+VkDevice VulkanContext::getDevice() const noexcept {
+  return _device;
+}
+
+const VulkanInstanceDispatch& VulkanContext::getInstanceDispatch() const noexcept {
+  return _instanceDispatch;
+}
+
+const VulkanDeviceDispatch& VulkanContext::getDeviceDispatch() const noexcept {
+  return _deviceDispatch;
+}
+
+uint32_t VulkanContext::getQueueFamilyIndex() const noexcept {
+  return _queueFamilyIndex;
+}
+
+VkShaderModule VulkanContext::getShaderModule() const noexcept {
+  return _shaderModule;
+}
+
+VulkanPipelineCache& VulkanContext::getPipelineCache() const noexcept {
+  return *_pipelineCache;
+}
+
+void VulkanContext::createInstance() {
+  utils::checkVk(createVkInstance(&_instance), "Failed to create a Vulkan instance.");
+  _instanceDispatch = VulkanInstanceDispatch::load(_instance);
+}
+
+void VulkanContext::createDevice() {
+  const physical_device_selector::Selection selection = physical_device_selector::select(_instance, _instanceDispatch, kRequiredDeviceExtensions);
+  _physicalDevice = selection.physicalDevice;
+  _queueFamilyIndex = selection.queueFamilyIndex;
+
+  float queuePriority = 1.0f;
+  VkDeviceQueueCreateInfo queueCreateInfo{
+      .sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
+      .pNext = nullptr,
+      .flags = 0,
+      .queueFamilyIndex = _queueFamilyIndex,
+      .queueCount = 1,
+      .pQueuePriorities = &queuePriority,
+  };
+
+  VkPhysicalDeviceVulkan11Features vulkan11Features{};
+  vulkan11Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES;
+  vulkan11Features.samplerYcbcrConversion = VK_TRUE;
+
+  VkPhysicalDeviceFeatures2 features2{
+      .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+      .pNext = &vulkan11Features,
+      .features = {},
+  };
+
+  VkDeviceCreateInfo deviceCreateInfo{
+      .sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
+      .pNext = &features2,
+      .flags = 0,
+      .queueCreateInfoCount = 1,
+      .pQueueCreateInfos = &queueCreateInfo,
+      .enabledLayerCount = 0,
+      .ppEnabledLayerNames = nullptr,
+      .enabledExtensionCount = static_cast<uint32_t>(kRequiredDeviceExtensions.size()),
+      .ppEnabledExtensionNames = kRequiredDeviceExtensions.data(),
+      .pEnabledFeatures = nullptr,
+  };
+
+  utils::checkVk(vkCreateDevice(_physicalDevice, &deviceCreateInfo, nullptr, &_device), "Failed to create a Vulkan device.");
+  _deviceDispatch = VulkanDeviceDispatch::load(_device);
+  vkGetDeviceQueue(_device, _queueFamilyIndex, 0, &_queue);
+}
+
+void VulkanContext::createShaderModule() {
+  const std::vector<uint32_t>& shaderWords = getResizerComputeShaderSpirv();
+
+  VkShaderModuleCreateInfo shaderModuleCreateInfo{
+      .sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
+      .pNext = nullptr,
+      .flags = 0,
+      .codeSize = shaderWords.size() * sizeof(uint32_t),
+      .pCode = shaderWords.data(),
+  };
+
+  utils::checkVk(vkCreateShaderModule(_device, &shaderModuleCreateInfo, nullptr, &_shaderModule), "Failed to create the Vulkan resizer shader module.");
+}
+
+void VulkanContext::createPipelineCache() {
+  std::string cacheDirectory;
+  try {
+    cacheDirectory = margelo::nitro::camera::resizer::utils::getAppCacheDirectory();
+  } catch (const std::exception& error) {
+    // Without a cache directory we still get an in-memory cache shared by all Resizers of this process.
+    __android_log_print(ANDROID_LOG_WARN, "VisionCameraResizer", "Vulkan pipeline cache will not be persisted: %s", error.what());
+  }
+  _pipelineCache = std::make_unique<VulkanPipelineCache>(_physicalDevice, _device, cacheDirectory);
+}
+
+void VulkanContext::destroy() noexcept {
+  if (_device != VK_NULL_HANDLE) {
+    // Every pipeline has already drained its own submissions, but stay safe against driver-internal work.
+    vkDeviceWaitIdle(_device);
+  }
+
+  if (_pipelineCache != nullptr) {
+    _pipelineCache->saveIfNeeded();
+    _pipelineCache.reset();
+  }
+
+  if (_device != VK_NULL_HANDLE && _shaderModule != VK_NULL_HANDLE) {
+    vkDestroyShaderModule(_device, _shaderModule, nullptr);
+  }
+  _shaderModule = VK_NULL_HANDLE;
+
+  if (_device != VK_NULL_HANDLE) {
+    vkDestroyDevice(_device, nullptr);
+  }
+  _device = VK_NULL_HANDLE;
+  _deviceDispatch = VulkanDeviceDispatch{};
+  _queueFamilyIndex = std::numeric_limits<uint32_t>::max();
+  _queue = VK_NULL_HANDLE;
+  _physicalDevice = VK_NULL_HANDLE;
+
+  if (_instance != VK_NULL_HANDLE) {
+    vkDestroyInstance(_instance, nullptr);
+  }
+  _instance = VK_NULL_HANDLE;
+  _instanceDispatch = VulkanInstanceDispatch{};
+}
+
+} // namespace margelo::nitro::camera::resizer::vulkan
@@ -0,0 +1,91 @@
+///
+/// VulkanContext.hpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include "vulkan/VulkanDynamicDispatch.hpp"
+#include "vulkan/VulkanPipelineCache.hpp"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+
+#include <vulkan/vulkan.h>
+#include <vulkan/vulkan_android.h>
+
+namespace margelo::nitro::camera::resizer::vulkan {
+
+/**
+ * Owns the process-wide Vulkan instance, device, queue, pipeline cache and resizer shader module.
+ * Every `VulkanResizerPipeline` holds a strong reference, so the context lives as long as at least one Resizer does.
+ */
+class VulkanContext final {
+public:
+  /**
+   * Creates one Vulkan instance + device for the resizer. Prefer `getShared()` instead.
+   */
+  VulkanContext();
+  ~VulkanContext();
+
+  VulkanContext(const VulkanContext&) = delete;
+  VulkanContext& operator=(const VulkanContext&) = delete;
+
+  /**
+   * Returns the process-wide context, creating it if no Resizer currently holds one.
+   *
+   * @throws If no Vulkan device with the required capabilities is available.
+   */
+  [[nodiscard]] static std::shared_ptr<VulkanContext> getShared();
+  /**
+   * Returns whether the required Vulkan capabilities for the GPU resizer pipeline
+   * are available on this device.
+   */
+  [[nodiscard]] static bool isSupported() noexcept;
+
+  /**
+   * Submits command buffers to the shared queue.
+   * `VkQueue` requires external synchronization, so every pipeline must submit through here.
+   */
+  void submit(const VkSubmitInfo& submitInfo, VkFence fence);
+
+  [[nodiscard]] VkPhysicalDevice getPhysicalDevice() const noexcept;
+  [[nodiscard]] VkDevice getDevice() const noexcept;
+  [[nodiscard]] const VulkanInstanceDispatch& getInstanceDispatch() const noexcept;
+  [[nodiscard]] const VulkanDeviceDispatch& getDeviceDispatch() const noexcept;
+  [[nodiscard]] uint32_t getQueueFamilyIndex() const noexcept;
+  [[nodiscard]] VkShaderModule getShaderModule() const noexcept;
+  [[nodiscard]] VulkanPipelineCache& getPipelineCache() const noexcept;
+
+private:
+  static inline constexpr std::array<const char*, 2> kRequiredDeviceExtensions = {
+      VK_ANDROID_EXTERNAL_MEMORY_ANDROID_HARDWARE_BUFFER_EXTENSION_NAME,
+      VK_EXT_QUEUE_FAMILY_FOREIGN_EXTENSION_NAME,
+  };
+
+  void createInstance();
+  void createDevice();
+  void createShaderModule();
+  void createPipelineCache();
+  void destroy() noexcept;
+
+private:
+  // Protects `_queue`, which may be used by multiple pipelines on different threads.
+  std::mutex _queueMutex;
+
+  VkInstance _instance{VK_NULL_HANDLE};
+  VkPhysicalDevice _physicalDevice{VK_NULL_HANDLE};
+  VkDevice _device{VK_NULL_HANDLE};
+  VulkanInstanceDispatch _instanceDispatch{};
+  VulkanDeviceDispatch _deviceDispatch{};
+  uint32_t _queueFamilyIndex{std::numeric_limits<uint32_t>::max()};
+  VkQueue _queue{VK_NULL_HANDLE};
+  VkShaderModule _shaderModule{VK_NULL_HANDLE};
+  std::unique_ptr<VulkanPipelineCache> _pipelineCache;
+};
+
+} // namespace margelo::nitro::camera::resizer::vulkan
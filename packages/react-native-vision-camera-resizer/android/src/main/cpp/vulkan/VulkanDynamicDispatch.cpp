@@ -37,6 +37,7 @@ namespace {
 VulkanInstanceDispatch VulkanInstanceDispatch::load(VkInstance instance) {
   VulkanInstanceDispatch dispatch{};
   dispatch.getPhysicalDeviceFeatures2 = loadInstanceProc<PFN_vkGetPhysicalDeviceFeatures2>(instance, "vkGetPhysicalDeviceFeatures2");
+  dispatch.getPhysicalDeviceProperties2 = loadInstanceProc<PFN_vkGetPhysicalDeviceProperties2>(instance, "vkGetPhysicalDeviceProperties2");
   return dispatch;
 }
 
@@ -16,6 +16,7 @@ namespace margelo::nitro::camera::resizer::vulkan {
  */
 struct VulkanInstanceDispatch final {
   PFN_vkGetPhysicalDeviceFeatures2 getPhysicalDeviceFeatures2{nullptr};
+  PFN_vkGetPhysicalDeviceProperties2 getPhysicalDeviceProperties2{nullptr};
 
   /**
    * Loads the required instance-level Vulkan functions for this pipeline.
@@ -9,10 +9,24 @@
 #include "vulkan/VulkanReusableBuffer.hpp"
 #include "vulkan/VulkanUtils.hpp"
 
+#include <algorithm>
+#include <dlfcn.h>
 #include <stdexcept>
 
 namespace margelo::nitro::camera::resizer::vulkan {
 
+namespace {
+
+  // `AHardwareBuffer_getId` is only available on API 31+, but this library supports API 26, so it is resolved at runtime.
+  using GetIdFunction = int (*)(const AHardwareBuffer*, uint64_t*);
+
+  GetIdFunction getGetIdFunction() {
+    static const GetIdFunction getId = reinterpret_cast<GetIdFunction>(dlsym(RTLD_DEFAULT, "AHardwareBuffer_getId"));
+    return getId;
+  }
+
+} // namespace
+
 VulkanHardwareBufferInterop::VulkanHardwareBufferInterop(VkPhysicalDevice physicalDevice, VkDevice device, const VulkanDeviceDispatch& deviceDispatch)
     : _physicalDevice(physicalDevice), _device(device), _deviceDispatch(&deviceDispatch) {}
 
@@ -47,52 +61,85 @@ VulkanHardwareBufferInterop::Properties VulkanHardwareBufferInterop::queryProper
 
 const VulkanHardwareBufferInterop::ImportedImage& VulkanHardwareBufferInterop::importImage(AHardwareBuffer* hardwareBuffer,
                                                                                            const AHardwareBuffer_Desc& description,
-                                                                                           const Properties& properties, VkSamplerYcbcrConversion conversion) {
+                                                                                           const Properties& properties, VkSamplerYcbcrConversion conversion,
+                                                                                           uint64_t submissionSerial) {
   if (description.layers != 1) [[unlikely]] {
     throw std::runtime_error("Only single-layer AHardwareBuffers are supported by the Vulkan resizer.");
   }
 
   // Camera streaming tends to recycle a small set of AHardwareBuffer objects, so cache their Vulkan wrappers by
-  // buffer address and reuse them across frames instead of recreating the import/image-view state every time.
-  for (auto iterator = _cachedImages.begin(); iterator != _cachedImages.end();) {
-    if (iterator->hardwareBuffer != hardwareBuffer) {
-      // Different AHardwareBuffer* - look into next cached image...
-      ++iterator;
-      continue;
-    }
+  // buffer ID and reuse them across frames instead of recreating the import/image-view state every time.
+  const uint64_t bufferId = getBufferId(hardwareBuffer);
+  const uint64_t importIndex = ++_importCount;
+  if ((importIndex % kPoolSizeWindow) == 0) {
+    _previousWindowPoolSize = _currentWindowPoolSize;
+    _currentWindowPoolSize = 0;
+  }
 
+  const auto cachedEntry = _cachedImagesById.find(bufferId);
+  if (cachedEntry != _cachedImagesById.end()) {
+    const auto iterator = cachedEntry->second;
     const bool canReuseImage = iterator->externalFormat == properties.formatProperties.externalFormat && iterator->conversion == conversion &&
                                iterator->width == description.width && iterator->height == description.height && iterator->format == description.format;
     if (canReuseImage) {
       // We can re-use this Vulkan ImportedImage because it's the same AHardwareBuffer + config as before!
+      // Move it to the front, so the least recently used image is always at the back.
+      observeReuseDistance(importIndex - iterator->lastImportIndex);
+      iterator->lastSubmissionSerial = submissionSerial;
+      iterator->lastImportIndex = importIndex;
+      _cachedImages.splice(_cachedImages.begin(), _cachedImages, iterator);
+      _statistics.hits++;
       return iterator->importedImage;
     }
 
-    // We can not re-use this Vulkan ImportedImage because the config has changed. Destroy it from cache.
-    destroyImportedImage(iterator->importedImage);
-    iterator = _cachedImages.erase(iterator);
+    // We can not re-use this Vulkan ImportedImage because the config has changed. Retire it from cache.
+    retireImage(*iterator);
+    _cachedImages.erase(iterator);
+    _cachedImagesById.erase(cachedEntry);
+  } else {
+    // A miss on a recently evicted buffer means the producers cycle through more buffers than the cache holds.
+    const auto evictedBuffer =
+        std::find_if(_evictedBuffers.begin(), _evictedBuffers.end(), [bufferId](const EvictedBuffer& buffer) { return buffer.bufferId == bufferId; });
+    if (evictedBuffer != _evictedBuffers.end()) {
+      observeReuseDistance(importIndex - evictedBuffer->lastImportIndex);
+      _evictedBuffers.erase(evictedBuffer);
+    }
   }
+  _statistics.misses++;
 
-  // Evict the oldest entries before inserting so old camera sessions' buffers get released.
-  // Safe to destroy here: run() holds _stateMutex across import -> dispatch -> submit-and-wait,
-  // so no imported image is in flight on the GPU at this point.
-  while (_cachedImages.size() >= kMaxCachedImages) {
-    destroyImportedImage(_cachedImages.front().importedImage);
-    _cachedImages.erase(_cachedImages.begin());
+  // Evict the least recently used entries before inserting so old camera sessions' buffers get released.
+  // Earlier submissions may still be sampling them, so they are only destroyed in releaseRetiredImages().
+  while (!_cachedImages.empty() && _cachedImages.size() >= _capacity) {
+    evictLeastRecentlyUsedImage();
   }
 
   // No suitable ImportedImage was found in our cache - we have to create a new one.
-  CachedImage cachedImage{
-      .hardwareBuffer = hardwareBuffer,
+  _cachedImages.push_front(CachedImage{
+      .bufferId = bufferId,
       .externalFormat = properties.formatProperties.externalFormat,
       .conversion = conversion,
       .width = description.width,
       .height = description.height,
       .format = description.format,
+      .lastSubmissionSerial = submissionSerial,
+      .lastImportIndex = importIndex,
       .importedImage = createImportedImage(hardwareBuffer, description, properties, conversion),
-  };
-  _cachedImages.push_back(std::move(cachedImage));
-  return _cachedImages.back().importedImage;
+  });
+  _cachedImagesById[bufferId] = _cachedImages.begin();
+  return _cachedImages.front().importedImage;
+}
+
+void VulkanHardwareBufferInterop::releaseRetiredImages(uint64_t completedSerial) noexcept {
+  for (auto iterator = _retiredImages.begin(); iterator != _retiredImages.end();) {
+    if (iterator->lastSubmissionSerial > completedSerial) {
+      // Still referenced by a submission that has not finished yet.
+      ++iterator;
+      continue;
+    }
+
+    destroyImportedImage(iterator->importedImage);
+    iterator = _retiredImages.erase(iterator);
+  }
 }
 
 void VulkanHardwareBufferInterop::clearCachedImages() noexcept {
@@ -100,6 +147,60 @@ void VulkanHardwareBufferInterop::clearCachedImages() noexcept {
     destroyImportedImage(cachedImage.importedImage);
   }
   _cachedImages.clear();
+  _cachedImagesById.clear();
+  _evictedBuffers.clear();
+  for (RetiredImage& retiredImage : _retiredImages) {
+    destroyImportedImage(retiredImage.importedImage);
+  }
+  _retiredImages.clear();
+}
+
+VulkanHardwareBufferInterop::CacheStatistics VulkanHardwareBufferInterop::getCacheStatistics() const noexcept {
+  CacheStatistics statistics = _statistics;
+  statistics.size = _cachedImages.size();
+  statistics.capacity = _capacity;
+  return statistics;
+}
+
+void VulkanHardwareBufferInterop::evictLeastRecentlyUsedImage() {
+  CachedImage& cachedImage = _cachedImages.back();
+  _evictedBuffers.push_back(EvictedBuffer{
+      .bufferId = cachedImage.bufferId,
+      .lastImportIndex = cachedImage.lastImportIndex,
+  });
+  if (_evictedBuffers.size() > kMaxCachedImages) {
+    _evictedBuffers.pop_front();
+  }
+
+  retireImage(cachedImage);
+  _cachedImagesById.erase(cachedImage.bufferId);
+  _cachedImages.pop_back();
+  _statistics.evictions++;
+}
+
+void VulkanHardwareBufferInterop::observeReuseDistance(uint64_t reuseDistance) noexcept {
+  // A buffer that comes back after N imports means the producers cycle through (at least) N buffers.
+  _currentWindowPoolSize = std::max(_currentWindowPoolSize, reuseDistance);
+  const uint64_t poolSize = std::max(_currentWindowPoolSize, _previousWindowPoolSize);
+  _capacity = std::clamp(static_cast<size_t>(poolSize) + kCachedImagesSlack, kMinCachedImages, kMaxCachedImages);
+}
+
+uint64_t VulkanHardwareBufferInterop::getBufferId(AHardwareBuffer* hardwareBuffer) noexcept {
+  // Buffer IDs are unique for the lifetime of the process, while addresses may be reused once a buffer is freed.
+  const GetIdFunction getId = getGetIdFunction();
+  uint64_t bufferId = 0;
+  if (getId != nullptr && getId(hardwareBuffer, &bufferId) == 0) {
+    return bufferId;
+  }
+  return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(hardwareBuffer));
+}
+
+void VulkanHardwareBufferInterop::retireImage(CachedImage& cachedImage) {
+  _retiredImages.push_back(RetiredImage{
+      .lastSubmissionSerial = cachedImage.lastSubmissionSerial,
+      .importedImage = cachedImage.importedImage,
+  });
+  cachedImage.importedImage = ImportedImage{};
 }
 
 VulkanHardwareBufferInterop::ImportedImage VulkanHardwareBufferInterop::createImportedImage(AHardwareBuffer* hardwareBuffer,
@@ -10,6 +10,11 @@
 
 #include <android/hardware_buffer.h>
 
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <unordered_map>
 #include <vector>
 
 #include <vulkan/vulkan.h>
@@ -19,7 +24,7 @@ namespace margelo::nitro::camera::resizer::vulkan {
 
 /**
  * Owns the Vulkan-side Android HardwareBuffer import helpers used by the resizer pipeline.
- * Internally it caches imported image wrappers by AHardwareBuffer* address so camera frames can reuse them across
+ * Internally it caches imported image wrappers by AHardwareBuffer ID in an LRU cache so camera frames can reuse them across
  * realtime dispatches instead of recreating the Vulkan import objects every frame.
  */
 class VulkanHardwareBufferInterop final {
@@ -41,6 +46,17 @@ public:
     VkImageView view{VK_NULL_HANDLE};
   };
 
+  /**
+   * Cumulative counters of the imported image cache, plus its current size and adaptive capacity.
+   */
+  struct CacheStatistics final {
+    uint64_t hits{0};
+    uint64_t misses{0};
+    uint64_t evictions{0};
+    size_t size{0};
+    size_t capacity{0};
+  };
+
   VulkanHardwareBufferInterop(VkPhysicalDevice physicalDevice, VkDevice device, const VulkanDeviceDispatch& deviceDispatch);
   ~VulkanHardwareBufferInterop();
 
@@ -50,34 +66,69 @@ public:
   [[nodiscard]] Properties queryProperties(AHardwareBuffer* hardwareBuffer) const;
   /**
    * Imports one sampled image wrapper for the current hardware buffer.
-   * Internally this reuses cached Vulkan import objects keyed by AHardwareBuffer* address for streaming camera input.
+   * Internally this reuses cached Vulkan import objects keyed by AHardwareBuffer ID for streaming camera input, in O(1).
+   * `submissionSerial` identifies the GPU submission that will sample the image, so evicted entries are only destroyed
+   * once that submission has completed.
    */
   [[nodiscard]] const ImportedImage& importImage(AHardwareBuffer* hardwareBuffer, const AHardwareBuffer_Desc& description, const Properties& properties,
-                                                 VkSamplerYcbcrConversion conversion);
+                                                 VkSamplerYcbcrConversion conversion, uint64_t submissionSerial);
   /**
-   * Destroys every cached imported-image wrapper.
+   * Destroys evicted imported-image wrappers whose last submission is at or below `completedSerial`.
+   */
+  void releaseRetiredImages(uint64_t completedSerial) noexcept;
+  /**
+   * Destroys every cached and retired imported-image wrapper.
+   * The caller must make sure no submission still samples any of them.
    */
   void clearCachedImages() noexcept;
+  /**
+   * Returns the hit, miss and eviction counters of the imported image cache.
+   */
+  [[nodiscard]] CacheStatistics getCacheStatistics() const noexcept;
 
 private:
   struct CachedImage final {
-    AHardwareBuffer* hardwareBuffer{nullptr};
+    uint64_t bufferId{0};
     uint64_t externalFormat{0};
     VkSamplerYcbcrConversion conversion{VK_NULL_HANDLE};
     uint32_t width{0};
     uint32_t height{0};
     uint32_t format{0};
+    uint64_t lastSubmissionSerial{0};
+    // Value of `_importCount` when this image was last imported or reused.
+    uint64_t lastImportIndex{0};
     ImportedImage importedImage{};
   };
 
   /**
-   * Upper bound on cached imported images (oldest-inserted evicted first).
+   * A buffer that was recently evicted, remembered so that importing it again reveals a too small cache capacity.
+   */
+  struct EvictedBuffer final {
+    uint64_t bufferId{0};
+    uint64_t lastImportIndex{0};
+  };
+
+  struct RetiredImage final {
+    uint64_t lastSubmissionSerial{0};
+    ImportedImage importedImage{};
+  };
+
+  /**
+   * Bounds of the adaptive cache capacity.
    * Importing an AHardwareBuffer into Vulkan acquires a reference on it, so every cached entry
    * pins a whole camera buffer - each camera session restart allocates a fresh buffer set, and
-   * an unbounded cache pins the old sets forever. A streaming session cycles through ~4-6
-   * buffers, so 12 leaves plenty of slack.
+   * an unbounded cache pins the old sets forever. The capacity follows the number of buffers the
+   * producers actually cycle through (~4-6 per camera stream), plus some slack.
+   */
+  static inline constexpr size_t kMinCachedImages = 4;
+  static inline constexpr size_t kMaxCachedImages = 32;
+  static inline constexpr size_t kInitialCachedImages = 12;
+  static inline constexpr size_t kCachedImagesSlack = 2;
+  /**
+   * Number of imports after which the observed producer pool size starts over, so the capacity can shrink again
+   * once e.g. a second camera stream stopped.
    */
-  static inline constexpr size_t kMaxCachedImages = 12;
+  static inline constexpr uint64_t kPoolSizeWindow = 64;
 
   static inline constexpr VkFormatFeatureFlags kRequiredExternalFormatFeatures = VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT;
   static inline constexpr VkFormatFeatureFlags kLinearFilterFeatureMask =
@@ -86,12 +137,28 @@ private:
   [[nodiscard]] ImportedImage createImportedImage(AHardwareBuffer* hardwareBuffer, const AHardwareBuffer_Desc& description, const Properties& properties,
                                                   VkSamplerYcbcrConversion conversion) const;
   void destroyImportedImage(ImportedImage& image) const noexcept;
+  void retireImage(CachedImage& cachedImage);
+  void evictLeastRecentlyUsedImage();
+  void observeReuseDistance(uint64_t reuseDistance) noexcept;
+  [[nodiscard]] static uint64_t getBufferId(AHardwareBuffer* hardwareBuffer) noexcept;
 
 private:
   VkPhysicalDevice _physicalDevice{VK_NULL_HANDLE};
   VkDevice _device{VK_NULL_HANDLE};
   const VulkanDeviceDispatch* _deviceDispatch{nullptr};
-  std::vector<CachedImage> _cachedImages{};
+  // Most recently used first. List iterators stay valid on splice and erase of other entries, so the map can index into it.
+  std::list<CachedImage> _cachedImages{};
+  std::unordered_map<uint64_t, std::list<CachedImage>::iterator> _cachedImagesById{};
+  // Most recently evicted last, at most `kMaxCachedImages` entries.
+  std::deque<EvictedBuffer> _evictedBuffers{};
+  size_t _capacity{kInitialCachedImages};
+  uint64_t _importCount{0};
+  // The largest number of imports between two uses of the same buffer, in the current and the previous window.
+  uint64_t _currentWindowPoolSize{0};
+  uint64_t _previousWindowPoolSize{0};
+  CacheStatistics _statistics{};
+  // Evicted images that may still be sampled by an in-flight submission.
+  std::vector<RetiredImage> _retiredImages{};
 };
 
 } // namespace margelo::nitro::camera::resizer::vulkan
@@ -0,0 +1,311 @@
+///
+/// VulkanPipelineCache.cpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#include "VulkanPipelineCache.hpp"
+
+#include "vulkan/VulkanUtils.hpp"
+
+#include <algorithm>
+#include <android/log.h>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+namespace margelo::nitro::camera::resizer::vulkan {
+
+namespace {
+
+  constexpr auto kLogTag = "VisionCameraResizer";
+  // Bump this if the layout of `InputFormat` or the sidecar file changes.
+  constexpr uint32_t kInputFormatsFileVersion = 1;
+  // Bump this if the layout of `WorkgroupSize` or its sidecar file changes, or if the shader changes enough to need a new calibration.
+  constexpr uint32_t kWorkgroupSizeFileVersion = 1;
+
+  static_assert(std::is_trivially_copyable_v<VulkanPipelineCache::InputFormat>, "InputFormat is written to disk as raw bytes.");
+  static_assert(std::is_trivially_copyable_v<VulkanPipelineCache::WorkgroupSize>, "WorkgroupSize is written to disk as raw bytes.");
+
+  std::string makeFileKey(const VkPhysicalDeviceProperties& properties) {
+    std::string key = "VisionCameraResizer-" + std::to_string(properties.vendorID) + "-" + std::to_string(properties.deviceID) + "-" +
+                      std::to_string(properties.driverVersion) + "-";
+    constexpr char kHexDigits[] = "0123456789abcdef";
+    for (uint8_t byte : properties.pipelineCacheUUID) {
+      key += kHexDigits[byte >> 4];
+      key += kHexDigits[byte & 0x0F];
+    }
+    return key;
+  }
+
+  bool readFile(const std::string& path, std::vector<uint8_t>& data) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+      return false;
+    }
+    data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return !file.bad();
+  }
+
+  bool writeFileAtomically(const std::string& path, const void* data, size_t size) {
+    // Write to a temporary file first, so a crash mid-write never leaves a truncated cache behind.
+    const std::string temporaryPath = path + ".tmp";
+    {
+      std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+      if (!file.is_open()) {
+        return false;
+      }
+      file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+      if (!file.good()) {
+        return false;
+      }
+    }
+    return std::rename(temporaryPath.c_str(), path.c_str()) == 0;
+  }
+
+} // namespace
+
+VulkanPipelineCache::InputFormat VulkanPipelineCache::InputFormat::make(const VkAndroidHardwareBufferFormatPropertiesANDROID& formatProperties) noexcept {
+  return InputFormat{
+      .externalFormat = formatProperties.externalFormat,
+      .ycbcrModel = formatProperties.suggestedYcbcrModel,
+      .ycbcrRange = formatProperties.suggestedYcbcrRange,
+      .components = formatProperties.samplerYcbcrConversionComponents,
+      .xChromaOffset = formatProperties.suggestedXChromaOffset,
+      .yChromaOffset = formatProperties.suggestedYChromaOffset,
+  };
+}
+
+bool VulkanPipelineCache::InputFormat::operator==(const InputFormat& other) const noexcept {
+  return externalFormat == other.externalFormat && ycbcrModel == other.ycbcrModel && ycbcrRange == other.ycbcrRange &&
+         components.r == other.components.r && components.g == other.components.g && components.b == other.components.b &&
+         components.a == other.components.a && xChromaOffset == other.xChromaOffset && yChromaOffset == other.yChromaOffset;
+}
+
+bool VulkanPipelineCache::WorkgroupSize::operator==(const WorkgroupSize& other) const noexcept {
+  return x == other.x && y == other.y;
+}
+
+VulkanPipelineCache::VulkanPipelineCache(VkPhysicalDevice physicalDevice, VkDevice device, const std::string& directory) : _device(device) {
+  vkGetPhysicalDeviceProperties(physicalDevice, &_deviceProperties);
+  if (!directory.empty()) {
+    const std::string basePath = directory + "/" + makeFileKey(_deviceProperties);
+    _cacheFilePath = basePath + ".vkcache";
+    _inputFormatsFilePath = basePath + ".formats";
+    _workgroupSizeFilePath = basePath + ".workgroup";
+  }
+
+  std::vector<uint8_t> initialData;
+  loadCacheData(initialData);
+  loadKnownInputFormats();
+  loadWorkgroupSize();
+
+  VkPipelineCacheCreateInfo pipelineCacheCreateInfo{
+      .sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+      .pNext = nullptr,
+      .flags = 0,
+      .initialDataSize = initialData.size(),
+      .pInitialData = initialData.empty() ? nullptr : initialData.data(),
+  };
+
+  if (vkCreatePipelineCache(_device, &pipelineCacheCreateInfo, nullptr, &_pipelineCache) != VK_SUCCESS && !initialData.empty()) [[unlikely]] {
+    // The driver rejected our blob even though the header matched - start with an empty cache instead.
+    __android_log_print(ANDROID_LOG_WARN, kLogTag, "Discarding incompatible Vulkan pipeline cache at %s", _cacheFilePath.c_str());
+    pipelineCacheCreateInfo.initialDataSize = 0;
+    pipelineCacheCreateInfo.pInitialData = nullptr;
+    utils::checkVk(vkCreatePipelineCache(_device, &pipelineCacheCreateInfo, nullptr, &_pipelineCache), "Failed to create the Vulkan pipeline cache.");
+  } else if (_pipelineCache == VK_NULL_HANDLE) [[unlikely]] {
+    throw std::runtime_error("Failed to create the Vulkan pipeline cache.");
+  }
+}
+
+VulkanPipelineCache::~VulkanPipelineCache() {
+  {
+    std::lock_guard<std::mutex> lock(_saverMutex);
+    _isStopping = true;
+  }
+  _saveRequested.notify_one();
+  // The owner saves synchronously before destroying the cache, so a still pending request can be dropped.
+  if (_saverThread.joinable()) {
+    _saverThread.join();
+  }
+
+  if (_device != VK_NULL_HANDLE && _pipelineCache != VK_NULL_HANDLE) {
+    vkDestroyPipelineCache(_device, _pipelineCache, nullptr);
+  }
+  _pipelineCache = VK_NULL_HANDLE;
+}
+
+VkPipelineCache VulkanPipelineCache::get() const noexcept {
+  return _pipelineCache;
+}
+
+void VulkanPipelineCache::markDirty() noexcept {
+  std::lock_guard<std::mutex> lock(_stateMutex);
+  _isDirty = true;
+}
+
+void VulkanPipelineCache::rememberInputFormat(const InputFormat& inputFormat) {
+  std::lock_guard<std::mutex> lock(_stateMutex);
+  if (std::find(_knownInputFormats.begin(), _knownInputFormats.end(), inputFormat) != _knownInputFormats.end()) {
+    return;
+  }
+
+  // Keep the most recent formats only, so a device that once streamed many formats does not prewarm all of them forever.
+  if (_knownInputFormats.size() >= kMaxKnownInputFormats) {
+    _knownInputFormats.erase(_knownInputFormats.begin());
+  }
+  _knownInputFormats.push_back(inputFormat);
+  _isDirty = true;
+}
+
+std::vector<VulkanPipelineCache::InputFormat> VulkanPipelineCache::getKnownInputFormats() const {
+  std::lock_guard<std::mutex> lock(_stateMutex);
+  return _knownInputFormats;
+}
+
+void VulkanPipelineCache::rememberWorkgroupSize(const WorkgroupSize& workgroupSize) {
+  std::lock_guard<std::mutex> lock(_stateMutex);
+  if (_workgroupSize == workgroupSize) {
+    return;
+  }
+  _workgroupSize = workgroupSize;
+  _isDirty = true;
+}
+
+std::optional<VulkanPipelineCache::WorkgroupSize> VulkanPipelineCache::getWorkgroupSize() const {
+  std::lock_guard<std::mutex> lock(_stateMutex);
+  return _workgroupSize;
+}
+
+void VulkanPipelineCache::saveIfNeeded() noexcept {
+  std::lock_guard<std::mutex> lock(_stateMutex);
+  if (!_isDirty || _cacheFilePath.empty()) {
+    return;
+  }
+
+  try {
+    size_t dataSize = 0;
+    utils::checkVk(vkGetPipelineCacheData(_device, _pipelineCache, &dataSize, nullptr), "Failed to query the Vulkan pipeline cache size.");
+    std::vector<uint8_t> data(dataSize);
+    utils::checkVk(vkGetPipelineCacheData(_device, _pipelineCache, &dataSize, data.data()), "Failed to read the Vulkan pipeline cache.");
+    data.resize(dataSize);
+
+    if (!writeFileAtomically(_cacheFilePath, data.data(), data.size())) [[unlikely]] {
+      throw std::runtime_error("Failed to write " + _cacheFilePath);
+    }
+
+    std::vector<uint8_t> inputFormatsData(sizeof(uint32_t) + _knownInputFormats.size() * sizeof(InputFormat));
+    std::memcpy(inputFormatsData.data(), &kInputFormatsFileVersion, sizeof(uint32_t));
+    if (!_knownInputFormats.empty()) {
+      std::memcpy(inputFormatsData.data() + sizeof(uint32_t), _knownInputFormats.data(), _knownInputFormats.size() * sizeof(InputFormat));
+    }
+    if (!writeFileAtomically(_inputFormatsFilePath, inputFormatsData.data(), inputFormatsData.size())) [[unlikely]] {
+      throw std::runtime_error("Failed to write " + _inputFormatsFilePath);
+    }
+
+    if (_workgroupSize.has_value()) {
+      std::array<uint8_t, sizeof(uint32_t) + sizeof(WorkgroupSize)> workgroupSizeData{};
+      std::memcpy(workgroupSizeData.data(), &kWorkgroupSizeFileVersion, sizeof(uint32_t));
+      std::memcpy(workgroupSizeData.data() + sizeof(uint32_t), &_workgroupSize.value(), sizeof(WorkgroupSize));
+      if (!writeFileAtomically(_workgroupSizeFilePath, workgroupSizeData.data(), workgroupSizeData.size())) [[unlikely]] {
+        throw std::runtime_error("Failed to write " + _workgroupSizeFilePath);
+      }
+    }
+
+    _isDirty = false;
+  } catch (const std::exception& error) {
+    __android_log_print(ANDROID_LOG_WARN, kLogTag, "Failed to persist the Vulkan pipeline cache: %s", error.what());
+  }
+}
+
+void VulkanPipelineCache::saveInBackground() {
+  {
+    std::lock_guard<std::mutex> lock(_saverMutex);
+    if (_isStopping || _cacheFilePath.empty()) {
+      return;
+    }
+    _isSaveRequested = true;
+    if (!_saverThread.joinable()) {
+      _saverThread = std::thread([this]() { saverLoop(); });
+    }
+  }
+  _saveRequested.notify_one();
+}
+
+void VulkanPipelineCache::saverLoop() {
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(_saverMutex);
+      _saveRequested.wait(lock, [this]() { return _isStopping || _isSaveRequested; });
+      if (_isStopping) {
+        return;
+      }
+      _isSaveRequested = false;
+    }
+    saveIfNeeded();
+  }
+}
+
+void VulkanPipelineCache::loadCacheData(std::vector<uint8_t>& data) const {
+  if (_cacheFilePath.empty() || !readFile(_cacheFilePath, data)) {
+    data.clear();
+    return;
+  }
+  if (!isCompatibleCacheData(data)) {
+    // Written by a different GPU or driver build (e.g. restored from a backup) - never hand that to the driver.
+    data.clear();
+  }
+}
+
+void VulkanPipelineCache::loadKnownInputFormats() {
+  std::vector<uint8_t> data;
+  if (_inputFormatsFilePath.empty() || !readFile(_inputFormatsFilePath, data) || data.size() < sizeof(uint32_t)) {
+    return;
+  }
+
+  uint32_t version = 0;
+  std::memcpy(&version, data.data(), sizeof(uint32_t));
+  const size_t payloadSize = data.size() - sizeof(uint32_t);
+  if (version != kInputFormatsFileVersion || payloadSize % sizeof(InputFormat) != 0) {
+    return;
+  }
+
+  const size_t count = std::min(payloadSize / sizeof(InputFormat), kMaxKnownInputFormats);
+  _knownInputFormats.resize(count);
+  std::memcpy(_knownInputFormats.data(), data.data() + sizeof(uint32_t), count * sizeof(InputFormat));
+}
+
+void VulkanPipelineCache::loadWorkgroupSize() {
+  std::vector<uint8_t> data;
+  if (_workgroupSizeFilePath.empty() || !readFile(_workgroupSizeFilePath, data) || data.size() != sizeof(uint32_t) + sizeof(WorkgroupSize)) {
+    return;
+  }
+
+  uint32_t version = 0;
+  std::memcpy(&version, data.data(), sizeof(uint32_t));
+  if (version != kWorkgroupSizeFileVersion) {
+    return;
+  }
+
+  WorkgroupSize workgroupSize{};
+  std::memcpy(&workgroupSize, data.data() + sizeof(uint32_t), sizeof(WorkgroupSize));
+  _workgroupSize = workgroupSize;
+}
+
+bool VulkanPipelineCache::isCompatibleCacheData(const std::vector<uint8_t>& data) const noexcept {
+  VkPipelineCacheHeaderVersionOne header{};
+  if (data.size() < sizeof(header)) {
+    return false;
+  }
+  std::memcpy(&header, data.data(), sizeof(header));
+  return header.headerSize >= sizeof(header) && header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+         header.vendorID == _deviceProperties.vendorID && header.deviceID == _deviceProperties.deviceID &&
+         std::memcmp(header.pipelineCacheUUID, _deviceProperties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
+} // namespace margelo::nitro::camera::resizer::vulkan
@@ -0,0 +1,131 @@
+///
+/// VulkanPipelineCache.hpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+#include <vulkan/vulkan_android.h>
+
+namespace margelo::nitro::camera::resizer::vulkan {
+
+/**
+ * Owns a `VkPipelineCache` that is persisted to disk so driver shader compilation does not land on the frame path.
+ * Next to the cache blob it also remembers every camera input format (YCbCr conversion) pipelines were built for,
+ * so they can be prewarmed on the next launch before the first Frame arrives, and the compute workgroup size that was
+ * calibrated as the fastest one for this device.
+ *
+ * Files are keyed by the device's pipeline cache UUID and driver version, so a driver update starts from scratch.
+ * Saves requested from the frame path run on one background thread owned by the cache, which is joined on destruction.
+ */
+class VulkanPipelineCache final {
+public:
+  /**
+   * The parts of `VkAndroidHardwareBufferFormatPropertiesANDROID` that the compute pipeline is specialized for.
+   */
+  struct InputFormat final {
+    uint64_t externalFormat{0};
+    VkSamplerYcbcrModelConversion ycbcrModel{VK_SAMPLER_YCBCR_MODEL_CONVERSION_RGB_IDENTITY};
+    VkSamplerYcbcrRange ycbcrRange{VK_SAMPLER_YCBCR_RANGE_ITU_FULL};
+    VkComponentMapping components{};
+    VkChromaLocation xChromaOffset{VK_CHROMA_LOCATION_COSITED_EVEN};
+    VkChromaLocation yChromaOffset{VK_CHROMA_LOCATION_COSITED_EVEN};
+
+    [[nodiscard]] static InputFormat make(const VkAndroidHardwareBufferFormatPropertiesANDROID& formatProperties) noexcept;
+    [[nodiscard]] bool operator==(const InputFormat& other) const noexcept;
+  };
+
+  /**
+   * The `local_size_x` x `local_size_y` the resizer compute shader is specialized for.
+   */
+  struct WorkgroupSize final {
+    uint32_t x{8};
+    uint32_t y{8};
+
+    [[nodiscard]] bool operator==(const WorkgroupSize& other) const noexcept;
+  };
+
+  /**
+   * Creates the pipeline cache, seeded from `directory` if a compatible cache file exists there.
+   * An empty `directory` creates an in-memory cache that is never persisted.
+   */
+  VulkanPipelineCache(VkPhysicalDevice physicalDevice, VkDevice device, const std::string& directory);
+  ~VulkanPipelineCache();
+
+  VulkanPipelineCache(const VulkanPipelineCache&) = delete;
+  VulkanPipelineCache& operator=(const VulkanPipelineCache&) = delete;
+
+  [[nodiscard]] VkPipelineCache get() const noexcept;
+  /**
+   * Marks the cache as changed after a pipeline was created through it.
+   */
+  void markDirty() noexcept;
+  /**
+   * Remembers an input format so a later `prewarm` can build pipelines for it.
+   */
+  void rememberInputFormat(const InputFormat& inputFormat);
+  /**
+   * Returns every input format pipelines have been built for, on this or a previous launch.
+   */
+  [[nodiscard]] std::vector<InputFormat> getKnownInputFormats() const;
+  /**
+   * Remembers the workgroup size that was calibrated as the fastest one for this device.
+   */
+  void rememberWorkgroupSize(const WorkgroupSize& workgroupSize);
+  /**
+   * Returns the workgroup size calibrated on this or a previous launch, or `std::nullopt` if this device was never calibrated.
+   */
+  [[nodiscard]] std::optional<WorkgroupSize> getWorkgroupSize() const;
+  /**
+   * Writes the cache blob, known input formats and calibrated workgroup size to disk if anything changed since the last save.
+   * Failures are logged and ignored - the cache is only an optimization.
+   */
+  void saveIfNeeded() noexcept;
+  /**
+   * Runs `saveIfNeeded()` on the cache's background saver thread, so persisting never blocks the calling thread.
+   * Requests that arrive while a save is pending are coalesced into it.
+   */
+  void saveInBackground();
+
+private:
+  static inline constexpr size_t kMaxKnownInputFormats = 16;
+
+  void loadCacheData(std::vector<uint8_t>& data) const;
+  void loadKnownInputFormats();
+  void loadWorkgroupSize();
+  [[nodiscard]] bool isCompatibleCacheData(const std::vector<uint8_t>& data) const noexcept;
+  void saverLoop();
+
+private:
+  // Protects the dirty flag, the known input formats, the workgroup size and file I/O. The VkPipelineCache itself is internally synchronized.
+  mutable std::mutex _stateMutex;
+  VkDevice _device{VK_NULL_HANDLE};
+  VkPhysicalDeviceProperties _deviceProperties{};
+  VkPipelineCache _pipelineCache{VK_NULL_HANDLE};
+  std::string _cacheFilePath;
+  std::string _inputFormatsFilePath;
+  std::string _workgroupSizeFilePath;
+  std::vector<InputFormat> _knownInputFormats{};
+  std::optional<WorkgroupSize> _workgroupSize{};
+  bool _isDirty{false};
+
+  // Protects the saver thread and its request flags.
+  std::mutex _saverMutex;
+  std::condition_variable _saveRequested;
+  bool _isSaveRequested{false};
+  bool _isStopping{false};
+  // Started on the first `saveInBackground()` call.
+  std::thread _saverThread;
+};
+
+} // namespace margelo::nitro::camera::resizer::vulkan
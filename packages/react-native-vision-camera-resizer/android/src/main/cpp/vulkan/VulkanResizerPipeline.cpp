@@ -6,66 +6,64 @@
 
 #include "vulkan/VulkanResizerPipeline.hpp"
 
+#include "utils/OutputNormalization.hpp"
+#include "utils/ResizeTransformMapping.hpp"
+#include "utils/TextureOutput.hpp"
 #include "vulkan/VulkanResizerShaderConfig.hpp"
-#include "vulkan/VulkanShaderAssetLoader.hpp"
 #include "vulkan/VulkanUtils.hpp"
+#include "vulkan/VulkanWorkgroupSizeCalibration.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <stdexcept>
+#include <string>
 
 namespace margelo::nitro::camera::resizer::vulkan {
 
-bool VulkanResizerPipeline::isSupported() noexcept {
-  VkInstance instance = VK_NULL_HANDLE;
-  try {
-    VkApplicationInfo applicationInfo{
-        .sType = VK_STRUCTURE_TYPE_APPLICATION_INFO,
-        .pNext = nullptr,
-        .pApplicationName = "VisionCameraResizer",
-        .applicationVersion = VK_MAKE_VERSION(1, 0, 0),
-        .pEngineName = "VisionCameraResizer",
-        .engineVersion = VK_MAKE_VERSION(1, 0, 0),
-        .apiVersion = VK_API_VERSION_1_1,
-    };
+VulkanResizerPipeline::VulkanResizerPipeline(std::shared_ptr<VulkanContext> context, const ResizerOptions& options)
+    : VulkanResizerPipeline(std::move(context), std::vector<ResizerOptions>{options}) {}
 
-    VkInstanceCreateInfo instanceCreateInfo{
-        .sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO,
-        .pNext = nullptr,
-        .flags = 0,
-        .pApplicationInfo = &applicationInfo,
-        .enabledLayerCount = 0,
-        .ppEnabledLayerNames = nullptr,
-        .enabledExtensionCount = 0,
-        .ppEnabledExtensionNames = nullptr,
-    };
+VulkanResizerPipeline::VulkanResizerPipeline(std::shared_ptr<VulkanContext> context, std::vector<ResizerOptions> targets)
+    : VulkanResizerPipeline(context, std::move(targets), context != nullptr ? getPersistedWorkgroupSize(*context) : VulkanPipelineCache::WorkgroupSize{},
+                            true) {}
 
-    utils::checkVk(vkCreateInstance(&instanceCreateInfo, nullptr, &instance), "Failed to create a Vulkan instance.");
-    const VulkanInstanceDispatch instanceDispatch = VulkanInstanceDispatch::load(instance);
-    const physical_device_selector::Selection selection = physical_device_selector::select(instance, instanceDispatch, kRequiredDeviceExtensions);
-    if (selection.physicalDevice == VK_NULL_HANDLE) {
-      return false;
-    }
+VulkanResizerPipeline::VulkanResizerPipeline(std::shared_ptr<VulkanContext> context, std::vector<ResizerOptions> targets,
+                                             const VulkanPipelineCache::WorkgroupSize& workgroupSize)
+    : VulkanResizerPipeline(std::move(context), std::move(targets), workgroupSize, false) {}
 
-    vkDestroyInstance(instance, nullptr);
-    return true;
-  } catch (...) {
-    if (instance != VK_NULL_HANDLE) {
-      vkDestroyInstance(instance, nullptr);
-    }
-    return false;
+VulkanResizerPipeline::VulkanResizerPipeline(std::shared_ptr<VulkanContext> context, std::vector<ResizerOptions> targets,
+                                             const VulkanPipelineCache::WorkgroupSize& workgroupSize, bool isPersistent)
+    : _targets(std::move(targets)), _workgroupSize(workgroupSize), _isPersistent(isPersistent), _context(std::move(context)) {
+  if (_context == nullptr) [[unlikely]] {
+    throw std::runtime_error("VulkanResizerPipeline requires a VulkanContext.");
+  }
+  if (_targets.empty()) [[unlikely]] {
+    throw std::runtime_error("VulkanResizerPipeline requires at least one ResizerOptions.");
+  }
+  if (!isSupportedWorkgroupSize(_context->getPhysicalDevice(), _workgroupSize)) [[unlikely]] {
+    throw std::runtime_error("The workgroup size " + std::to_string(_workgroupSize.x) + "x" + std::to_string(_workgroupSize.y) +
+                             " is not supported by this Vulkan device.");
+  }
+  _device = _context->getDevice();
+  // Compute pipelines are only built once the first Frame arrives, so reject invalid normalization and size options right away.
+  for (const ResizerOptions& options : _targets) {
+    (void)margelo::nitro::camera::resizer::utils::getOutputNormalization(options);
+    (void)margelo::nitro::camera::resizer::utils::getMaxOutputSize(options);
+    margelo::nitro::camera::resizer::utils::validateTextureOutput(options);
   }
-}
 
-VulkanResizerPipeline::VulkanResizerPipeline(const ResizerOptions& options) : _options(options) {
   try {
     std::lock_guard<std::mutex> lock(_stateMutex);
-    // Build the reusable Vulkan objects once. Per-frame input imports happen later in run().
-    createInstance();
-    createDevice();
+    // Build the per-Resizer Vulkan objects once. Per-frame input imports happen later in run().
+    _hardwareBufferInterop = std::make_unique<VulkanHardwareBufferInterop>(_context->getPhysicalDevice(), _device, _context->getDeviceDispatch());
     createCommandResources();
-    createShaderModule();
-    createOutputBuffer();
+    createOutputBuffers();
+    const bool enableProfiling =
+        std::any_of(_targets.begin(), _targets.end(), [](const ResizerOptions& options) { return options.enableProfiling.value_or(false); });
+    if (enableProfiling) {
+      _profiler = std::make_unique<VulkanResizerProfiler>(_context->getPhysicalDevice(), _device, _context->getQueueFamilyIndex(), _outputSlots.size());
+    }
   } catch (...) {
     std::lock_guard<std::mutex> lock(_stateMutex);
     destroyLocked();
@@ -73,12 +71,85 @@ VulkanResizerPipeline::VulkanResizerPipeline(const ResizerOptions& options) : _o
   }
 }
 
+void VulkanResizerPipeline::prewarm(VulkanContext& context, const ResizerOptions& options) {
+  // The compute pipeline bakes in the YCbCr conversion of the camera format, which is only known once a Frame arrives.
+  // Build one for every format seen on previous launches, so the real pipeline is a cache hit on the first Frame.
+  const VulkanPipelineCache::WorkgroupSize workgroupSize = getPersistedWorkgroupSize(context);
+  for (const VulkanPipelineCache::InputFormat& inputFormat : context.getPipelineCache().getKnownInputFormats()) {
+    ComputeResources resources{};
+    try {
+      createComputePipelines(context, {options}, inputFormat, workgroupSize, context.getPipelineCache().get(), resources);
+    } catch (...) {
+      destroyComputeResources(context, resources);
+      throw;
+    }
+    destroyComputeResources(context, resources);
+  }
+  context.getPipelineCache().saveIfNeeded();
+}
+
 VulkanResizerPipeline::~VulkanResizerPipeline() {
   std::lock_guard<std::mutex> lock(_stateMutex);
   destroyLocked();
 }
 
-std::shared_ptr<VulkanBufferView> VulkanResizerPipeline::run(AHardwareBuffer* hardwareBuffer, int rotationDegrees, bool isMirrored) {
+std::vector<std::shared_ptr<VulkanBufferView>> VulkanResizerPipeline::run(AHardwareBuffer* hardwareBuffer, int rotationDegrees, bool isMirrored,
+                                                                          const std::optional<ResizeOptions>& resizeOptions) {
+  const Submission submission = submit(hardwareBuffer, rotationDegrees, isMirrored, resizeOptions);
+  return waitForCompletion(submission);
+}
+
+VulkanResizerPipeline::Submission VulkanResizerPipeline::submit(AHardwareBuffer* hardwareBuffer, int rotationDegrees, bool isMirrored,
+                                                                 const std::optional<ResizeOptions>& resizeOptions) {
+  const bool requestsOutputSize = resizeOptions.has_value() && (resizeOptions->width.has_value() || resizeOptions->height.has_value());
+  if (requestsOutputSize && _targets.size() > 1) [[unlikely]] {
+    throw std::runtime_error("MultiResizer does not support ResizeOptions.width/height, every output has its own fixed size.");
+  }
+  if (requestsOutputSize && margelo::nitro::camera::resizer::utils::isTextureOutput(_targets.front())) [[unlikely]] {
+    throw std::runtime_error("ResizeOptions.width/height is not supported with outputBufferType 'texture', its texture has a fixed size.");
+  }
+  std::vector<margelo::nitro::camera::resizer::utils::OutputSize> outputSizes;
+  outputSizes.reserve(_targets.size());
+  for (const ResizerOptions& options : _targets) {
+    outputSizes.push_back(margelo::nitro::camera::resizer::utils::getRequestedOutputSize(options, resizeOptions));
+  }
+
+  const AHardwareBuffer_Desc description = describeInputBuffer(hardwareBuffer);
+  const std::optional<Rect> crop = resizeOptions.has_value() ? resizeOptions->crop : std::nullopt;
+  const std::vector<margelo::nitro::camera::resizer::utils::CropRegion> cropRegions = {
+      margelo::nitro::camera::resizer::utils::getCropRegion(crop, description.width, description.height),
+  };
+  return submitRegions(hardwareBuffer, description, rotationDegrees, isMirrored, cropRegions, outputSizes);
+}
+
+std::vector<std::shared_ptr<VulkanBufferView>> VulkanResizerPipeline::runBatch(AHardwareBuffer* hardwareBuffer, int rotationDegrees, bool isMirrored,
+                                                                               const std::vector<Rect>& regions) {
+  if (regions.empty()) [[unlikely]] {
+    throw std::runtime_error("resizeBatch() requires at least one region.");
+  }
+  if (regions.size() > getMaxBatchSize()) [[unlikely]] {
+    throw std::runtime_error("resizeBatch() received " + std::to_string(regions.size()) + " regions, but this Resizer was created with a maxBatchSize of " +
+                             std::to_string(getMaxBatchSize()) + ". Increase `maxBatchSize`.");
+  }
+
+  const AHardwareBuffer_Desc description = describeInputBuffer(hardwareBuffer);
+  std::vector<margelo::nitro::camera::resizer::utils::CropRegion> cropRegions;
+  cropRegions.reserve(regions.size());
+  for (const Rect& region : regions) {
+    cropRegions.push_back(margelo::nitro::camera::resizer::utils::getCropRegion(region, description.width, description.height));
+  }
+  // Batches always use the configured output size.
+  std::vector<margelo::nitro::camera::resizer::utils::OutputSize> outputSizes;
+  outputSizes.reserve(_targets.size());
+  for (const ResizerOptions& options : _targets) {
+    outputSizes.push_back(margelo::nitro::camera::resizer::utils::getOutputSize(options));
+  }
+
+  const Submission submission = submitRegions(hardwareBuffer, description, rotationDegrees, isMirrored, cropRegions, outputSizes);
+  return waitForCompletion(submission);
+}
+
+AHardwareBuffer_Desc VulkanResizerPipeline::describeInputBuffer(AHardwareBuffer* hardwareBuffer) {
   if (hardwareBuffer == nullptr) [[unlikely]] {
     throw std::runtime_error("Input AHardwareBuffer is null.");
   }
@@ -91,117 +162,150 @@ std::shared_ptr<VulkanBufferView> VulkanResizerPipeline::run(AHardwareBuffer* ha
   if (description.format == AHARDWAREBUFFER_FORMAT_BLOB) [[unlikely]] {
     throw std::runtime_error("AHardwareBuffer format BLOB cannot be sampled from Vulkan.");
   }
+  return description;
+}
+
+VulkanResizerPipeline::Submission VulkanResizerPipeline::submitRegions(AHardwareBuffer* hardwareBuffer, const AHardwareBuffer_Desc& description,
+                                                                        int rotationDegrees, bool isMirrored,
+                                                                        const std::vector<margelo::nitro::camera::resizer::utils::CropRegion>& cropRegions,
+                                                                        const std::vector<margelo::nitro::camera::resizer::utils::OutputSize>& outputSizes) {
+  const uint32_t batchSize = static_cast<uint32_t>(cropRegions.size());
+  // Record where each region lands in each target's output, so detections can be mapped back into Frame coordinates later.
+  std::vector<std::vector<ResizeTransform>> transforms(_targets.size());
+  for (size_t targetIndex = 0; targetIndex < _targets.size(); targetIndex++) {
+    const ResizerOptions& options = _targets[targetIndex];
+    transforms[targetIndex].reserve(cropRegions.size());
+    for (const margelo::nitro::camera::resizer::utils::CropRegion& cropRegion : cropRegions) {
+      transforms[targetIndex].push_back(margelo::nitro::camera::resizer::utils::getResizeTransform(
+          cropRegion, description.width, description.height, outputSizes[targetIndex].width, outputSizes[targetIndex].height, rotationDegrees,
+          isMirrored, options.scaleMode));
+    }
+  }
 
   std::lock_guard<std::mutex> lock(_stateMutex);
-  if (_instance == VK_NULL_HANDLE) [[unlikely]] {
+  if (_context == nullptr) [[unlikely]] {
     throw std::runtime_error("This Resizer has already been disposed.");
   }
 
-  // The pipeline reuses one mapped output buffer, so only one GPUFrame may be alive at a time.
-  std::shared_ptr<VulkanBufferView> outputBufferView =
-      _outputBuffer->acquireView(getOutputWidth(), getOutputHeight(), _options.channelOrder, _options.dataType, _options.pixelLayout, getOutputByteCount());
+  // Each output slot backs at most one live GPUFrame. If its view is dropped early, the slot may still be in flight.
+  Submission submission = acquireOutputSlotLocked(transforms, outputSizes);
+  OutputSlot& slot = _outputSlots[submission.slotIndex];
+  waitForSlotLocked(slot);
+  retireThumbnailsLocked(slot);
+  // The slot is idle now, so its region buffer can be rewritten for this dispatch.
+  writeRegionsLocked(slot, cropRegions);
 
+  VulkanResizerProfiler::ScopedStage queryPropertiesStage(_profiler.get(), VulkanResizerProfiler::Stage::QUERY_PROPERTIES);
   const VulkanHardwareBufferInterop::Properties properties = _hardwareBufferInterop->queryProperties(hardwareBuffer);
+  queryPropertiesStage.end();
   // Rebuild the sampler and descriptor state if this input uses a different external Vulkan format.
   createComputeResourcesLocked(properties);
 
-  // Wrap this frame's AHardwareBuffer in temporary Vulkan image objects for a single compute dispatch.
+  // Wrap this frame's AHardwareBuffer in Vulkan image objects, tagged with this submission so eviction is deferred until it completes.
+  submission.serial = _lastSubmissionSerial + 1;
+  VulkanResizerProfiler::ScopedStage importImageStage(_profiler.get(), VulkanResizerProfiler::Stage::IMPORT_IMAGE);
   const VulkanHardwareBufferInterop::ImportedImage& inputImage =
-      _hardwareBufferInterop->importImage(hardwareBuffer, description, properties, _computeResources.conversion);
+      _hardwareBufferInterop->importImage(hardwareBuffer, description, properties, _computeResources.conversion, submission.serial);
+  importImageStage.end();
+
+  VulkanResizerProfiler::ScopedStage recordStage(_profiler.get(), VulkanResizerProfiler::Stage::RECORD);
+  updateInputDescriptorsLocked(submission.slotIndex, inputImage);
+  recordCommandBufferLocked(submission.slotIndex, inputImage, rotationDegrees, isMirrored, batchSize, outputSizes);
+  recordStage.end();
+
+  VulkanResizerProfiler::ScopedStage submitStage(_profiler.get(), VulkanResizerProfiler::Stage::SUBMIT);
+  submitLocked(slot, submission.serial);
+  submitStage.end();
+  slot.outputSizes = outputSizes;
+  slot.hasUncollectedThumbnails = std::any_of(_targets.begin(), _targets.end(), isFrameStatisticsEnabled);
+  _lastSubmissionSerial = submission.serial;
+  _nextSlotIndex = (submission.slotIndex + 1) % _outputSlots.size();
+
+  return submission;
+}
+
+std::vector<std::shared_ptr<VulkanBufferView>> VulkanResizerPipeline::waitForCompletion(const Submission& submission) {
+  VkFence fence = VK_NULL_HANDLE;
+  VulkanResizerProfiler* profiler = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(_stateMutex);
+    if (_context == nullptr) [[unlikely]] {
+      throw std::runtime_error("This Resizer has already been disposed.");
+    }
+    fence = _outputSlots[submission.slotIndex].fence;
+    profiler = _profiler.get();
+  }
+
+  // Wait without holding _stateMutex so other slots can be submitted meanwhile.
+  // The fence cannot be reset under us: the slot stays checked out while `submission` holds its view.
+  VulkanResizerProfiler::ScopedStage waitStage(profiler, VulkanResizerProfiler::Stage::WAIT);
+  utils::checkVk(vkWaitForFences(_device, 1, &fence, VK_TRUE, std::numeric_limits<uint64_t>::max()),
+                 "Failed to wait for the Vulkan resizer command buffer to complete.");
+  waitStage.end();
 
-  updateInputDescriptorLocked(inputImage);
-  recordCommandBufferLocked(inputImage, rotationDegrees, isMirrored);
-  submitAndWaitLocked();
-  invalidateOutputBufferIfNeededLocked();
+  std::unique_lock<std::mutex> lock(_stateMutex);
+  OutputSlot& slot = _outputSlots[submission.slotIndex];
+  if (slot.isPending && slot.submissionSerial == submission.serial) {
+    slot.isPending = false;
+  }
+  if (_profiler != nullptr) {
+    _profiler->collectTimestamps(submission.slotIndex);
+  }
+  invalidateOutputBuffersIfNeededLocked(slot);
+  attachFrameStatisticsLocked(lock, slot, submission);
+  releaseRetiredImagesLocked();
 
-  return outputBufferView;
+  return submission.outputBufferViews;
 }
 
 bool VulkanResizerPipeline::hasActiveOutputView() const noexcept {
   std::lock_guard<std::mutex> lock(_stateMutex);
-  if (_instance == VK_NULL_HANDLE || _outputBuffer == nullptr) {
+  if (_context == nullptr) {
     return false;
   }
-  return _outputBuffer->isInUse();
+  return std::any_of(_outputSlots.begin(), _outputSlots.end(), [](const OutputSlot& slot) {
+    return std::any_of(slot.outputBuffers.begin(), slot.outputBuffers.end(),
+                       [](const std::shared_ptr<VulkanReusableBuffer>& outputBuffer) { return outputBuffer != nullptr && outputBuffer->isInUse(); });
+  });
 }
 
 size_t VulkanResizerPipeline::getOutputBufferAllocationSize() const noexcept {
   std::lock_guard<std::mutex> lock(_stateMutex);
-  if (_instance == VK_NULL_HANDLE || _outputBuffer == nullptr) {
+  if (_context == nullptr) {
     return 0;
   }
-  return _outputBuffer->getAllocationSize();
-}
 
-void VulkanResizerPipeline::createInstance() {
-  VkApplicationInfo applicationInfo{
-      .sType = VK_STRUCTURE_TYPE_APPLICATION_INFO,
-      .pNext = nullptr,
-      .pApplicationName = "VisionCameraResizer",
-      .applicationVersion = VK_MAKE_VERSION(1, 0, 0),
-      .pEngineName = "VisionCameraResizer",
-      .engineVersion = VK_MAKE_VERSION(1, 0, 0),
-      .apiVersion = VK_API_VERSION_1_1,
-  };
-
-  VkInstanceCreateInfo instanceCreateInfo{
-      .sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO,
-      .pNext = nullptr,
-      .flags = 0,
-      .pApplicationInfo = &applicationInfo,
-      .enabledLayerCount = 0,
-      .ppEnabledLayerNames = nullptr,
-      .enabledExtensionCount = 0,
-      .ppEnabledExtensionNames = nullptr,
-  };
-
-  utils::checkVk(vkCreateInstance(&instanceCreateInfo, nullptr, &_instance), "Failed to create a Vulkan instance.");
-  _instanceDispatch = VulkanInstanceDispatch::load(_instance);
+  size_t allocationSize = 0;
+  for (const OutputSlot& slot : _outputSlots) {
+    for (const std::shared_ptr<VulkanReusableBuffer>& outputBuffer : slot.outputBuffers) {
+      if (outputBuffer != nullptr) {
+        allocationSize += outputBuffer->getAllocationSize();
+      }
+    }
+    if (slot.regionBuffer != nullptr) {
+      allocationSize += slot.regionBuffer->getAllocationSize();
+    }
+    if (slot.statisticsBuffer != nullptr) {
+      allocationSize += slot.statisticsBuffer->getAllocationSize();
+    }
+  }
+  return allocationSize;
 }
 
-void VulkanResizerPipeline::createDevice() {
-  const physical_device_selector::Selection selection = physical_device_selector::select(_instance, _instanceDispatch, kRequiredDeviceExtensions);
-  _physicalDevice = selection.physicalDevice;
-  _queueFamilyIndex = selection.queueFamilyIndex;
-
-  float queuePriority = 1.0f;
-  VkDeviceQueueCreateInfo queueCreateInfo{
-      .sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
-      .pNext = nullptr,
-      .flags = 0,
-      .queueFamilyIndex = _queueFamilyIndex,
-      .queueCount = 1,
-      .pQueuePriorities = &queuePriority,
-  };
-
-  VkPhysicalDeviceVulkan11Features vulkan11Features{};
-  vulkan11Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES;
-  vulkan11Features.samplerYcbcrConversion = VK_TRUE;
-
-  VkPhysicalDeviceFeatures2 features2{
-      .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
-      .pNext = &vulkan11Features,
-      .features = {},
-  };
-
-  VkDeviceCreateInfo deviceCreateInfo{
-      .sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
-      .pNext = &features2,
-      .flags = 0,
-      .queueCreateInfoCount = 1,
-      .pQueueCreateInfos = &queueCreateInfo,
-      .enabledLayerCount = 0,
-      .ppEnabledLayerNames = nullptr,
-      .enabledExtensionCount = static_cast<uint32_t>(kRequiredDeviceExtensions.size()),
-      .ppEnabledExtensionNames = kRequiredDeviceExtensions.data(),
-      .pEnabledFeatures = nullptr,
-  };
-
-  utils::checkVk(vkCreateDevice(_physicalDevice, &deviceCreateInfo, nullptr, &_device), "Failed to create a Vulkan device.");
-  _deviceDispatch = VulkanDeviceDispatch::load(_device);
-  vkGetDeviceQueue(_device, _queueFamilyIndex, 0, &_queue);
+VulkanHardwareBufferInterop::CacheStatistics VulkanResizerPipeline::getImportCacheStatistics() const noexcept {
+  std::lock_guard<std::mutex> lock(_stateMutex);
+  if (_hardwareBufferInterop == nullptr) {
+    return {};
+  }
+  return _hardwareBufferInterop->getCacheStatistics();
+}
 
-  _hardwareBufferInterop = std::make_unique<VulkanHardwareBufferInterop>(_physicalDevice, _device, _deviceDispatch);
+std::optional<VulkanResizerProfiler::Statistics> VulkanResizerPipeline::getTimingStatistics() const {
+  std::lock_guard<std::mutex> lock(_stateMutex);
+  if (_profiler == nullptr) {
+    return std::nullopt;
+  }
+  return _profiler->getStatistics();
 }
 
 void VulkanResizerPipeline::createCommandResources() {
@@ -209,47 +313,62 @@ void VulkanResizerPipeline::createCommandResources() {
       .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
       .pNext = nullptr,
       .flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
-      .queueFamilyIndex = _queueFamilyIndex,
+      .queueFamilyIndex = _context->getQueueFamilyIndex(),
   };
 
   utils::checkVk(vkCreateCommandPool(_device, &commandPoolCreateInfo, nullptr, &_commandPool), "Failed to create a Vulkan command pool.");
 
-  VkCommandBufferAllocateInfo commandBufferAllocateInfo{
-      .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
-      .pNext = nullptr,
-      .commandPool = _commandPool,
-      .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
-      .commandBufferCount = 1,
-  };
+  // Every output slot records and fences its own submission, so slots can be in flight concurrently.
+  _outputSlots.resize(getOutputSlotCount());
+  for (OutputSlot& slot : _outputSlots) {
+    VkCommandBufferAllocateInfo commandBufferAllocateInfo{
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+        .pNext = nullptr,
+        .commandPool = _commandPool,
+        .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+        .commandBufferCount = 1,
+    };
 
-  utils::checkVk(vkAllocateCommandBuffers(_device, &commandBufferAllocateInfo, &_commandBuffer), "Failed to allocate a Vulkan command buffer.");
+    utils::checkVk(vkAllocateCommandBuffers(_device, &commandBufferAllocateInfo, &slot.commandBuffer), "Failed to allocate a Vulkan command buffer.");
 
-  VkFenceCreateInfo fenceCreateInfo{
-      .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
-      .pNext = nullptr,
-      .flags = 0,
-  };
+    VkFenceCreateInfo fenceCreateInfo{
+        .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+    };
 
-  utils::checkVk(vkCreateFence(_device, &fenceCreateInfo, nullptr, &_fence), "Failed to create a Vulkan fence.");
+    utils::checkVk(vkCreateFence(_device, &fenceCreateInfo, nullptr, &slot.fence), "Failed to create a Vulkan fence.");
+  }
 }
 
-void VulkanResizerPipeline::createShaderModule() {
-  const std::vector<uint32_t>& shaderWords = getResizerComputeShaderSpirv();
-
-  VkShaderModuleCreateInfo shaderModuleCreateInfo{
-      .sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
-      .pNext = nullptr,
-      .flags = 0,
-      .codeSize = shaderWords.size() * sizeof(uint32_t),
-      .pCode = shaderWords.data(),
-  };
-
-  utils::checkVk(vkCreateShaderModule(_device, &shaderModuleCreateInfo, nullptr, &_shaderModule), "Failed to create the Vulkan resizer shader module.");
+void VulkanResizerPipeline::createOutputBuffers() {
+  // Every output buffer is sized for the largest batch, so any batch can be dispatched into any slot.
+  const size_t maxBatchSize = getMaxBatchSize();
+  const size_t regionBufferByteCount = maxBatchSize * sizeof(shader_config::ShaderRegion);
+  for (OutputSlot& slot : _outputSlots) {
+    for (const ResizerOptions& options : _targets) {
+      // Start at the configured size, most Resizers never request a larger one.
+      const size_t storageBufferByteCount =
+          getStorageBufferByteCount(options, margelo::nitro::camera::resizer::utils::getOutputSize(options), maxBatchSize);
+      slot.outputBuffers.push_back(createOutputBuffer(options, storageBufferByteCount));
+      slot.outputBufferByteCounts.push_back(storageBufferByteCount);
+    }
+    // Regions are in input pixels, so every target of a slot reads the same region buffer.
+    slot.regionBuffer = std::make_unique<VulkanReusableBuffer>(_context->getPhysicalDevice(), _device, regionBufferByteCount);
+    slot.statisticsBuffer = std::make_unique<VulkanReusableBuffer>(_context->getPhysicalDevice(), _device, _targets.size() * kStatisticsBufferStride);
+  }
 }
 
-void VulkanResizerPipeline::createOutputBuffer() {
-  const size_t storageBufferByteCount = getStorageBufferByteCount();
-  _outputBuffer = std::make_unique<VulkanReusableBuffer>(_physicalDevice, _device, storageBufferByteCount);
+std::shared_ptr<VulkanReusableBuffer> VulkanResizerPipeline::createOutputBuffer(const ResizerOptions& options, size_t byteCount) const {
+  if (margelo::nitro::camera::resizer::utils::isTextureOutput(options)) {
+    // Texture outputs have a fixed size and a single image (see `utils::validateTextureOutput`), so they never grow.
+    const margelo::nitro::camera::resizer::utils::OutputSize size = margelo::nitro::camera::resizer::utils::getOutputSize(options);
+    return std::make_shared<VulkanReusableBuffer>(_context->getPhysicalDevice(), _device, _context->getDeviceDispatch(), size.width, size.height);
+  }
+  if (isNativeOutput(options)) {
+    return std::make_shared<VulkanReusableBuffer>(_context->getPhysicalDevice(), _device, _context->getDeviceDispatch(), byteCount);
+  }
+  return std::make_shared<VulkanReusableBuffer>(_context->getPhysicalDevice(), _device, byteCount);
 }
 
 void VulkanResizerPipeline::createComputeResourcesLocked(const VulkanHardwareBufferInterop::Properties& properties) {
@@ -259,185 +378,373 @@ void VulkanResizerPipeline::createComputeResourcesLocked(const VulkanHardwareBuf
   }
 
   // Cached imported image views are tied to the previous conversion object and must be rebuilt with the new one.
+  // In-flight submissions still sample them through the old pipeline, so drain every slot first.
+  waitForAllSlotsLocked();
   _hardwareBufferInterop->clearCachedImages();
   destroyComputeResourcesLocked();
 
   try {
-    VkExternalFormatANDROID externalFormatInfo{};
-    externalFormatInfo.sType = VK_STRUCTURE_TYPE_EXTERNAL_FORMAT_ANDROID;
-    externalFormatInfo.externalFormat = properties.formatProperties.externalFormat;
-
-    VkSamplerYcbcrConversionCreateInfo conversionCreateInfo{};
-    conversionCreateInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_CREATE_INFO;
-    conversionCreateInfo.pNext = &externalFormatInfo;
-    conversionCreateInfo.format = VK_FORMAT_UNDEFINED;
-    conversionCreateInfo.ycbcrModel = properties.formatProperties.suggestedYcbcrModel;
-    conversionCreateInfo.ycbcrRange = properties.formatProperties.suggestedYcbcrRange;
-    conversionCreateInfo.components = properties.formatProperties.samplerYcbcrConversionComponents;
-    conversionCreateInfo.xChromaOffset = properties.formatProperties.suggestedXChromaOffset;
-    conversionCreateInfo.yChromaOffset = properties.formatProperties.suggestedYChromaOffset;
-    conversionCreateInfo.chromaFilter = VK_FILTER_LINEAR;
-    conversionCreateInfo.forceExplicitReconstruction = VK_FALSE;
-
-    utils::checkVk(_deviceDispatch.createSamplerYcbcrConversion(_device, &conversionCreateInfo, nullptr, &_computeResources.conversion),
-                   "Failed to create the Vulkan YCbCr conversion for the input AHardwareBuffer.");
-
-    VkSamplerYcbcrConversionInfo samplerConversionInfo{};
-    samplerConversionInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO;
-    samplerConversionInfo.conversion = _computeResources.conversion;
-
-    VkSamplerCreateInfo samplerCreateInfo{};
-    samplerCreateInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
-    samplerCreateInfo.pNext = &samplerConversionInfo;
-    samplerCreateInfo.magFilter = VK_FILTER_LINEAR;
-    samplerCreateInfo.minFilter = VK_FILTER_LINEAR;
-    samplerCreateInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
-    samplerCreateInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
-    samplerCreateInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
-    samplerCreateInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
-    samplerCreateInfo.mipLodBias = 0.0f;
-    samplerCreateInfo.anisotropyEnable = VK_FALSE;
-    samplerCreateInfo.compareEnable = VK_FALSE;
-    samplerCreateInfo.minLod = 0.0f;
-    samplerCreateInfo.maxLod = 0.0f;
-    samplerCreateInfo.borderColor = VK_BORDER_COLOR_FLOAT_TRANSPARENT_BLACK;
-    samplerCreateInfo.unnormalizedCoordinates = VK_FALSE;
-
-    utils::checkVk(vkCreateSampler(_device, &samplerCreateInfo, nullptr, &_computeResources.sampler),
-                   "Failed to create the Vulkan sampler for the input AHardwareBuffer.");
-
-    VkDescriptorSetLayoutBinding inputBinding{};
-    inputBinding.binding = 0;
-    inputBinding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-    inputBinding.descriptorCount = 1;
-    inputBinding.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
-    inputBinding.pImmutableSamplers = &_computeResources.sampler;
-
-    VkDescriptorSetLayoutBinding outputBinding{};
-    outputBinding.binding = 1;
-    outputBinding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-    outputBinding.descriptorCount = 1;
-    outputBinding.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
-
-    const std::array<VkDescriptorSetLayoutBinding, 2> bindings = {inputBinding, outputBinding};
-
-    VkDescriptorSetLayoutCreateInfo descriptorSetLayoutCreateInfo{};
-    descriptorSetLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
-    descriptorSetLayoutCreateInfo.bindingCount = static_cast<uint32_t>(bindings.size());
-    descriptorSetLayoutCreateInfo.pBindings = bindings.data();
-
-    utils::checkVk(vkCreateDescriptorSetLayout(_device, &descriptorSetLayoutCreateInfo, nullptr, &_computeResources.descriptorSetLayout),
-                   "Failed to create the Vulkan descriptor set layout for the resizer pipeline.");
-
-    VkPushConstantRange pushConstantRange{};
-    pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
-    pushConstantRange.offset = 0;
-    pushConstantRange.size = sizeof(shader_config::ShaderPushConstants);
-
-    VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo{};
-    pipelineLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-    pipelineLayoutCreateInfo.setLayoutCount = 1;
-    pipelineLayoutCreateInfo.pSetLayouts = &_computeResources.descriptorSetLayout;
-    pipelineLayoutCreateInfo.pushConstantRangeCount = 1;
-    pipelineLayoutCreateInfo.pPushConstantRanges = &pushConstantRange;
-
-    utils::checkVk(vkCreatePipelineLayout(_device, &pipelineLayoutCreateInfo, nullptr, &_computeResources.pipelineLayout),
-                   "Failed to create the Vulkan resizer pipeline layout.");
-
-    VkPipelineShaderStageCreateInfo shaderStageCreateInfo{};
-    shaderStageCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    shaderStageCreateInfo.stage = VK_SHADER_STAGE_COMPUTE_BIT;
-    shaderStageCreateInfo.module = _shaderModule;
-    shaderStageCreateInfo.pName = "main";
-    const shader_config::ShaderSpecializationData specializationData = shader_config::ShaderSpecializationData::make(_options);
-    const VkSpecializationInfo vkSpecializationInfo = specializationData.asVkInfo();
-    // ResizerOptions are fixed for the lifetime of this VulkanResizerPipeline, so specialize the shader once when building the pipeline.
-    shaderStageCreateInfo.pSpecializationInfo = &vkSpecializationInfo;
-
-    VkComputePipelineCreateInfo computePipelineCreateInfo{};
-    computePipelineCreateInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
-    computePipelineCreateInfo.stage = shaderStageCreateInfo;
-    computePipelineCreateInfo.layout = _computeResources.pipelineLayout;
-
-    utils::checkVk(vkCreateComputePipelines(_device, VK_NULL_HANDLE, 1, &computePipelineCreateInfo, nullptr, &_computeResources.pipeline),
-                   "Failed to create the Vulkan resizer compute pipeline.");
+    const VulkanPipelineCache::InputFormat inputFormat = VulkanPipelineCache::InputFormat::make(properties.formatProperties);
+    createComputePipelines(*_context, _targets, inputFormat, _workgroupSize, _isPersistent ? _context->getPipelineCache().get() : VK_NULL_HANDLE,
+                           _computeResources);
+    if (_isPersistent) {
+      // Remember this camera format so the next launch can prewarm its pipeline before the first Frame arrives.
+      _context->getPipelineCache().rememberInputFormat(inputFormat);
+    }
 
+    const uint32_t setCount = static_cast<uint32_t>(_outputSlots.size() * _targets.size());
     const std::array<VkDescriptorPoolSize, 2> poolSizes = {
-        VkDescriptorPoolSize{VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1},
-        VkDescriptorPoolSize{VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},
+        VkDescriptorPoolSize{VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, setCount},
+        // One output buffer, one region buffer and one statistics buffer per set.
+        VkDescriptorPoolSize{VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, setCount * 3},
     };
 
     VkDescriptorPoolCreateInfo descriptorPoolCreateInfo{};
     descriptorPoolCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
-    descriptorPoolCreateInfo.maxSets = 1;
+    descriptorPoolCreateInfo.maxSets = setCount;
     descriptorPoolCreateInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
     descriptorPoolCreateInfo.pPoolSizes = poolSizes.data();
 
     utils::checkVk(vkCreateDescriptorPool(_device, &descriptorPoolCreateInfo, nullptr, &_computeResources.descriptorPool),
                    "Failed to create the Vulkan descriptor pool for the resizer pipeline.");
 
+    const std::vector<VkDescriptorSetLayout> descriptorSetLayouts(setCount, _computeResources.descriptorSetLayout);
+    _computeResources.descriptorSets.resize(setCount, VK_NULL_HANDLE);
+
     VkDescriptorSetAllocateInfo descriptorSetAllocateInfo{};
     descriptorSetAllocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
     descriptorSetAllocateInfo.descriptorPool = _computeResources.descriptorPool;
-    descriptorSetAllocateInfo.descriptorSetCount = 1;
-    descriptorSetAllocateInfo.pSetLayouts = &_computeResources.descriptorSetLayout;
-
-    utils::checkVk(vkAllocateDescriptorSets(_device, &descriptorSetAllocateInfo, &_computeResources.descriptorSet),
-                   "Failed to allocate the Vulkan descriptor set for the resizer pipeline.");
+    descriptorSetAllocateInfo.descriptorSetCount = setCount;
+    descriptorSetAllocateInfo.pSetLayouts = descriptorSetLayouts.data();
 
-    VkDescriptorBufferInfo outputBufferInfo{
-        .buffer = _outputBuffer->getBuffer(),
-        .offset = 0,
-        .range = getStorageBufferByteCount(),
-    };
+    utils::checkVk(vkAllocateDescriptorSets(_device, &descriptorSetAllocateInfo, _computeResources.descriptorSets.data()),
+                   "Failed to allocate the Vulkan descriptor sets for the resizer pipeline.");
 
-    VkWriteDescriptorSet outputBufferWrite{
-        .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
-        .pNext = nullptr,
-        .dstSet = _computeResources.descriptorSet,
-        .dstBinding = 1,
-        .dstArrayElement = 0,
-        .descriptorCount = 1,
-        .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
-        .pImageInfo = nullptr,
-        .pBufferInfo = &outputBufferInfo,
-        .pTexelBufferView = nullptr,
-    };
-
-    vkUpdateDescriptorSets(_device, 1, &outputBufferWrite, 0, nullptr);
+    // The output, region and statistics bindings only change per slot and target when an output buffer grows, so write them once here.
+    for (size_t slotIndex = 0; slotIndex < _outputSlots.size(); slotIndex++) {
+      for (size_t targetIndex = 0; targetIndex < _targets.size(); targetIndex++) {
+        writeBufferDescriptorsLocked(slotIndex, targetIndex);
+      }
+    }
     _computeResources.externalFormat = properties.formatProperties.externalFormat;
   } catch (...) {
     destroyComputeResourcesLocked();
     throw;
   }
+
+  if (_isPersistent) {
+    // Persist the new pipeline off the frame path.
+    _context->getPipelineCache().saveInBackground();
+  }
 }
 
-void VulkanResizerPipeline::updateInputDescriptorLocked(const VulkanHardwareBufferInterop::ImportedImage& inputImage) {
-  // Point the reusable descriptor set at this frame's imported image view.
-  VkDescriptorImageInfo imageInfo{
-      .sampler = VK_NULL_HANDLE,
-      .imageView = inputImage.view,
-      .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+void VulkanResizerPipeline::createComputePipelines(VulkanContext& context, const std::vector<ResizerOptions>& targets,
+                                                   const VulkanPipelineCache::InputFormat& inputFormat,
+                                                   const VulkanPipelineCache::WorkgroupSize& workgroupSize, VkPipelineCache pipelineCache,
+                                                   ComputeResources& resources) {
+  const VkDevice device = context.getDevice();
+
+  VkExternalFormatANDROID externalFormatInfo{};
+  externalFormatInfo.sType = VK_STRUCTURE_TYPE_EXTERNAL_FORMAT_ANDROID;
+  externalFormatInfo.externalFormat = inputFormat.externalFormat;
+
+  // GRAY outputs read Y itself, so skip the conversion to RGB (and the range expansion) if no target needs color.
+  const bool isLumaInput = samplesLuma(targets, inputFormat);
+
+  VkSamplerYcbcrConversionCreateInfo conversionCreateInfo{};
+  conversionCreateInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_CREATE_INFO;
+  conversionCreateInfo.pNext = &externalFormatInfo;
+  conversionCreateInfo.format = VK_FORMAT_UNDEFINED;
+  conversionCreateInfo.ycbcrModel = isLumaInput ? VK_SAMPLER_YCBCR_MODEL_CONVERSION_YCBCR_IDENTITY : inputFormat.ycbcrModel;
+  conversionCreateInfo.ycbcrRange = isLumaInput ? VK_SAMPLER_YCBCR_RANGE_ITU_FULL : inputFormat.ycbcrRange;
+  conversionCreateInfo.components = inputFormat.components;
+  conversionCreateInfo.xChromaOffset = inputFormat.xChromaOffset;
+  conversionCreateInfo.yChromaOffset = inputFormat.yChromaOffset;
+  conversionCreateInfo.chromaFilter = VK_FILTER_LINEAR;
+  conversionCreateInfo.forceExplicitReconstruction = VK_FALSE;
+
+  utils::checkVk(context.getDeviceDispatch().createSamplerYcbcrConversion(device, &conversionCreateInfo, nullptr, &resources.conversion),
+                 "Failed to create the Vulkan YCbCr conversion for the input AHardwareBuffer.");
+
+  VkSamplerYcbcrConversionInfo samplerConversionInfo{};
+  samplerConversionInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO;
+  samplerConversionInfo.conversion = resources.conversion;
+
+  VkSamplerCreateInfo samplerCreateInfo{};
+  samplerCreateInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+  samplerCreateInfo.pNext = &samplerConversionInfo;
+  samplerCreateInfo.magFilter = VK_FILTER_LINEAR;
+  samplerCreateInfo.minFilter = VK_FILTER_LINEAR;
+  samplerCreateInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+  samplerCreateInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+  samplerCreateInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+  samplerCreateInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+  samplerCreateInfo.mipLodBias = 0.0f;
+  samplerCreateInfo.anisotropyEnable = VK_FALSE;
+  samplerCreateInfo.compareEnable = VK_FALSE;
+  samplerCreateInfo.minLod = 0.0f;
+  samplerCreateInfo.maxLod = 0.0f;
+  samplerCreateInfo.borderColor = VK_BORDER_COLOR_FLOAT_TRANSPARENT_BLACK;
+  samplerCreateInfo.unnormalizedCoordinates = VK_FALSE;
+
+  utils::checkVk(vkCreateSampler(device, &samplerCreateInfo, nullptr, &resources.sampler),
+                 "Failed to create the Vulkan sampler for the input AHardwareBuffer.");
+
+  VkDescriptorSetLayoutBinding inputBinding{};
+  inputBinding.binding = 0;
+  inputBinding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+  inputBinding.descriptorCount = 1;
+  inputBinding.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+  inputBinding.pImmutableSamplers = &resources.sampler;
+
+  VkDescriptorSetLayoutBinding outputBinding{};
+  outputBinding.binding = 1;
+  outputBinding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+  outputBinding.descriptorCount = 1;
+  outputBinding.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+
+  VkDescriptorSetLayoutBinding regionBinding{};
+  regionBinding.binding = 2;
+  regionBinding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+  regionBinding.descriptorCount = 1;
+  regionBinding.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+
+  VkDescriptorSetLayoutBinding statisticsBinding{};
+  statisticsBinding.binding = 3;
+  statisticsBinding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+  statisticsBinding.descriptorCount = 1;
+  statisticsBinding.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+
+  const std::array<VkDescriptorSetLayoutBinding, 4> bindings = {inputBinding, outputBinding, regionBinding, statisticsBinding};
+
+  VkDescriptorSetLayoutCreateInfo descriptorSetLayoutCreateInfo{};
+  descriptorSetLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+  descriptorSetLayoutCreateInfo.bindingCount = static_cast<uint32_t>(bindings.size());
+  descriptorSetLayoutCreateInfo.pBindings = bindings.data();
+
+  utils::checkVk(vkCreateDescriptorSetLayout(device, &descriptorSetLayoutCreateInfo, nullptr, &resources.descriptorSetLayout),
+                 "Failed to create the Vulkan descriptor set layout for the resizer pipeline.");
+
+  VkPushConstantRange pushConstantRange{};
+  pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+  pushConstantRange.offset = 0;
+  pushConstantRange.size = sizeof(shader_config::ShaderPushConstants);
+
+  VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo{};
+  pipelineLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+  pipelineLayoutCreateInfo.setLayoutCount = 1;
+  pipelineLayoutCreateInfo.pSetLayouts = &resources.descriptorSetLayout;
+  pipelineLayoutCreateInfo.pushConstantRangeCount = 1;
+  pipelineLayoutCreateInfo.pPushConstantRanges = &pushConstantRange;
+
+  utils::checkVk(vkCreatePipelineLayout(device, &pipelineLayoutCreateInfo, nullptr, &resources.pipelineLayout),
+                 "Failed to create the Vulkan resizer pipeline layout.");
+
+  // ResizerOptions are fixed for the lifetime of a VulkanResizerPipeline, so specialize the shader once per target when building its pipeline.
+  std::vector<shader_config::ShaderSpecializationData> specializationData;
+  specializationData.reserve(targets.size());
+  for (const ResizerOptions& options : targets) {
+    specializationData.push_back(shader_config::ShaderSpecializationData::make(options, workgroupSize, isLumaInput));
+  }
+  std::vector<VkSpecializationInfo> vkSpecializationInfos;
+  vkSpecializationInfos.reserve(targets.size());
+  for (const shader_config::ShaderSpecializationData& data : specializationData) {
+    vkSpecializationInfos.push_back(data.asVkInfo());
+  }
+
+  std::vector<VkComputePipelineCreateInfo> computePipelineCreateInfos(targets.size());
+  for (size_t targetIndex = 0; targetIndex < targets.size(); targetIndex++) {
+    VkPipelineShaderStageCreateInfo shaderStageCreateInfo{};
+    shaderStageCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    shaderStageCreateInfo.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    shaderStageCreateInfo.module = context.getShaderModule();
+    shaderStageCreateInfo.pName = "main";
+    shaderStageCreateInfo.pSpecializationInfo = &vkSpecializationInfos[targetIndex];
+
+    VkComputePipelineCreateInfo& computePipelineCreateInfo = computePipelineCreateInfos[targetIndex];
+    computePipelineCreateInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+    computePipelineCreateInfo.stage = shaderStageCreateInfo;
+    computePipelineCreateInfo.layout = resources.pipelineLayout;
+  }
+
+  // Build every target's pipeline in one call. Routed through the persistent cache (if any), drivers can skip recompiling shaders seen on a previous launch.
+  resources.pipelines.resize(targets.size(), VK_NULL_HANDLE);
+  utils::checkVk(vkCreateComputePipelines(device, pipelineCache, static_cast<uint32_t>(computePipelineCreateInfos.size()),
+                                          computePipelineCreateInfos.data(), nullptr, resources.pipelines.data()),
+                 "Failed to create the Vulkan resizer compute pipeline.");
+  context.getPipelineCache().markDirty();
+}
+
+VulkanResizerPipeline::Submission VulkanResizerPipeline::acquireOutputSlotLocked(
+    const std::vector<std::vector<ResizeTransform>>& transforms, const std::vector<margelo::nitro::camera::resizer::utils::OutputSize>& outputSizes) {
+  // Round-robin through the ring, starting after the most recently submitted slot.
+  for (size_t offset = 0; offset < _outputSlots.size(); offset++) {
+    const size_t slotIndex = (_nextSlotIndex + offset) % _outputSlots.size();
+    // A slot is only usable if every target's output buffer in it is free. Views acquired before a busy one release themselves again.
+    std::vector<std::shared_ptr<VulkanBufferView>> outputBufferViews;
+    outputBufferViews.reserve(_targets.size());
+    for (size_t targetIndex = 0; targetIndex < _targets.size(); targetIndex++) {
+      const ResizerOptions& options = _targets[targetIndex];
+      const margelo::nitro::camera::resizer::utils::OutputSize& outputSize = outputSizes[targetIndex];
+      growOutputBufferIfNeededLocked(slotIndex, targetIndex, getStorageBufferByteCount(options, outputSize, transforms[targetIndex].size()));
+      const size_t byteCount = getOutputByteCount(options, outputSize) * transforms[targetIndex].size();
+      std::shared_ptr<VulkanBufferView> outputBufferView = _outputSlots[slotIndex].outputBuffers[targetIndex]->tryAcquireView(
+          outputSize.width, outputSize.height, transforms[targetIndex], options.channelOrder, options.dataType, options.pixelLayout, byteCount, _context);
+      if (outputBufferView == nullptr) {
+        break;
+      }
+      outputBufferViews.push_back(std::move(outputBufferView));
+    }
+    if (outputBufferViews.size() == _targets.size()) {
+      return Submission{
+          .outputBufferViews = std::move(outputBufferViews),
+          .slotIndex = slotIndex,
+          .serial = 0,
+      };
+    }
+  }
+
+  if (_outputSlots.size() == 1) [[unlikely]] {
+    throw std::runtime_error("Previous GPUFrame is still active. Dispose it before calling resize() again.");
+  }
+  throw std::runtime_error("All " + std::to_string(_outputSlots.size()) +
+                           " GPUFrames are still active. Dispose one before calling resize() again, or increase `outputBufferCount`.");
+}
+
+void VulkanResizerPipeline::growOutputBufferIfNeededLocked(size_t slotIndex, size_t targetIndex, size_t byteCount) {
+  OutputSlot& slot = _outputSlots[slotIndex];
+  // A buffer still held by a GPUFrame cannot be replaced, but then this slot is skipped anyways.
+  if (byteCount <= slot.outputBufferByteCounts[targetIndex] || slot.outputBuffers[targetIndex]->isInUse()) {
+    return;
+  }
+
+  // Grow geometrically so a slowly increasing size does not re-allocate on every call, but never beyond the largest size and batch.
+  const ResizerOptions& options = _targets[targetIndex];
+  const size_t maxByteCount =
+      getStorageBufferByteCount(options, margelo::nitro::camera::resizer::utils::getMaxOutputSize(options), getMaxBatchSize());
+  const size_t grownByteCount = std::min(std::max(byteCount, slot.outputBufferByteCounts[targetIndex] * 2), maxByteCount);
+  // A previous dispatch may still be writing into the old buffer.
+  waitForSlotLocked(slot);
+  slot.outputBuffers[targetIndex] = createOutputBuffer(options, grownByteCount);
+  slot.outputBufferByteCounts[targetIndex] = grownByteCount;
+  if (!_computeResources.descriptorSets.empty()) {
+    writeBufferDescriptorsLocked(slotIndex, targetIndex);
+  }
+}
+
+void VulkanResizerPipeline::writeBufferDescriptorsLocked(size_t slotIndex, size_t targetIndex) {
+  const VkDescriptorSet descriptorSet = getDescriptorSetLocked(slotIndex, targetIndex);
+  VkDescriptorBufferInfo outputBufferInfo{
+      .buffer = _outputSlots[slotIndex].outputBuffers[targetIndex]->getBuffer(),
+      .offset = 0,
+      .range = _outputSlots[slotIndex].outputBufferByteCounts[targetIndex],
+  };
+  VkDescriptorBufferInfo regionBufferInfo{
+      .buffer = _outputSlots[slotIndex].regionBuffer->getBuffer(),
+      .offset = 0,
+      .range = getMaxBatchSize() * sizeof(shader_config::ShaderRegion),
+  };
+  VkDescriptorBufferInfo statisticsBufferInfo{
+      .buffer = _outputSlots[slotIndex].statisticsBuffer->getBuffer(),
+      .offset = targetIndex * kStatisticsBufferStride,
+      .range = kStatisticsBufferStride,
+  };
+
+  VkWriteDescriptorSet outputBufferWrite{
+      .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+      .pNext = nullptr,
+      .dstSet = descriptorSet,
+      .dstBinding = 1,
+      .dstArrayElement = 0,
+      .descriptorCount = 1,
+      .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+      .pImageInfo = nullptr,
+      .pBufferInfo = &outputBufferInfo,
+      .pTexelBufferView = nullptr,
+  };
+
+  VkWriteDescriptorSet regionBufferWrite{
+      .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+      .pNext = nullptr,
+      .dstSet = descriptorSet,
+      .dstBinding = 2,
+      .dstArrayElement = 0,
+      .descriptorCount = 1,
+      .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+      .pImageInfo = nullptr,
+      .pBufferInfo = &regionBufferInfo,
+      .pTexelBufferView = nullptr,
   };
 
-  VkWriteDescriptorSet inputWrite{
+  VkWriteDescriptorSet statisticsBufferWrite{
       .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
       .pNext = nullptr,
-      .dstSet = _computeResources.descriptorSet,
-      .dstBinding = 0,
+      .dstSet = descriptorSet,
+      .dstBinding = 3,
       .dstArrayElement = 0,
       .descriptorCount = 1,
-      .descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
-      .pImageInfo = &imageInfo,
-      .pBufferInfo = nullptr,
+      .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+      .pImageInfo = nullptr,
+      .pBufferInfo = &statisticsBufferInfo,
       .pTexelBufferView = nullptr,
   };
 
-  vkUpdateDescriptorSets(_device, 1, &inputWrite, 0, nullptr);
+  const std::array<VkWriteDescriptorSet, 3> bufferWrites = {outputBufferWrite, regionBufferWrite, statisticsBufferWrite};
+  vkUpdateDescriptorSets(_device, static_cast<uint32_t>(bufferWrites.size()), bufferWrites.data(), 0, nullptr);
 }
 
-void VulkanResizerPipeline::recordCommandBufferLocked(const VulkanHardwareBufferInterop::ImportedImage& inputImage, int rotationDegrees, bool isMirrored) {
-  utils::checkVk(vkResetCommandBuffer(_commandBuffer, 0), "Failed to reset the Vulkan resizer command buffer.");
+void VulkanResizerPipeline::writeRegionsLocked(const OutputSlot& slot,
+                                               const std::vector<margelo::nitro::camera::resizer::utils::CropRegion>& cropRegions) {
+  std::copy(cropRegions.begin(), cropRegions.end(), reinterpret_cast<shader_config::ShaderRegion*>(slot.regionBuffer->getMappedData()));
+
+  // Host writes are made visible to the device by vkQueueSubmit, but non-coherent mappings still need an explicit flush first.
+  if (!slot.regionBuffer->isHostCoherent()) {
+    VkMappedMemoryRange mappedMemoryRange{
+        .sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,
+        .pNext = nullptr,
+        .memory = slot.regionBuffer->getMemory(),
+        .offset = 0,
+        .size = VK_WHOLE_SIZE,
+    };
+
+    utils::checkVk(vkFlushMappedMemoryRanges(_device, 1, &mappedMemoryRange), "Failed to flush the Vulkan resizer region buffer mapping.");
+  }
+}
+
+void VulkanResizerPipeline::updateInputDescriptorsLocked(size_t slotIndex, const VulkanHardwareBufferInterop::ImportedImage& inputImage) {
+  // Point this slot's descriptor sets at this frame's imported image view. Every target samples the same import.
+  VkDescriptorImageInfo imageInfo{
+      .sampler = VK_NULL_HANDLE,
+      .imageView = inputImage.view,
+      .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+  };
+
+  std::vector<VkWriteDescriptorSet> inputWrites;
+  inputWrites.reserve(_targets.size());
+  for (size_t targetIndex = 0; targetIndex < _targets.size(); targetIndex++) {
+    inputWrites.push_back(VkWriteDescriptorSet{
+        .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+        .pNext = nullptr,
+        .dstSet = getDescriptorSetLocked(slotIndex, targetIndex),
+        .dstBinding = 0,
+        .dstArrayElement = 0,
+        .descriptorCount = 1,
+        .descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+        .pImageInfo = &imageInfo,
+        .pBufferInfo = nullptr,
+        .pTexelBufferView = nullptr,
+    });
+  }
+
+  vkUpdateDescriptorSets(_device, static_cast<uint32_t>(inputWrites.size()), inputWrites.data(), 0, nullptr);
+}
+
+void VulkanResizerPipeline::recordCommandBufferLocked(size_t slotIndex, const VulkanHardwareBufferInterop::ImportedImage& inputImage, int rotationDegrees,
+                                                      bool isMirrored, uint32_t batchSize,
+                                                      const std::vector<margelo::nitro::camera::resizer::utils::OutputSize>& outputSizes) {
+  const OutputSlot& slot = _outputSlots[slotIndex];
+  const VkCommandBuffer commandBuffer = slot.commandBuffer;
+  utils::checkVk(vkResetCommandBuffer(commandBuffer, 0), "Failed to reset the Vulkan resizer command buffer.");
 
   VkCommandBufferBeginInfo beginInfo{
       .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
@@ -446,9 +753,95 @@ void VulkanResizerPipeline::recordCommandBufferLocked(const VulkanHardwareBuffer
       .pInheritanceInfo = nullptr,
   };
 
-  utils::checkVk(vkBeginCommandBuffer(_commandBuffer, &beginInfo), "Failed to begin recording the Vulkan resizer command buffer.");
+  utils::checkVk(vkBeginCommandBuffer(commandBuffer, &beginInfo), "Failed to begin recording the Vulkan resizer command buffer.");
+
+  // Only the images of this batch are written, so only that prefix of each output buffer needs to be cleared and synchronized.
+  std::vector<VkBufferMemoryBarrier> nativeAcquireBarriers;
+  std::vector<VkBufferMemoryBarrier> fillBarriers;
+  std::vector<VkBufferMemoryBarrier> nativeReleaseBarriers;
+  std::vector<VkBufferMemoryBarrier> hostReadBarriers;
+  for (size_t targetIndex = 0; targetIndex < _targets.size(); targetIndex++) {
+    const ResizerOptions& options = _targets[targetIndex];
+    const VkBuffer outputBuffer = slot.outputBuffers[targetIndex]->getBuffer();
+    const VkDeviceSize outputByteCount = getStorageBufferByteCount(options, outputSizes[targetIndex], batchSize);
+
+    // Zero the output buffer so sub-word atomicOr writes from adjacent pixels combine correctly.
+    // Outputs written with whole-word stores only do not need this.
+    if (shader_config::requiresZeroedOutputBuffer(options, outputSizes[targetIndex].width)) {
+      VkBufferMemoryBarrier fillBarrier{};
+      fillBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+      fillBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+      fillBarrier.dstAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+      fillBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+      fillBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+      fillBarrier.buffer = outputBuffer;
+      fillBarrier.offset = 0;
+      fillBarrier.size = outputByteCount;
+      fillBarriers.push_back(fillBarrier);
+    }
 
-  // Acquire the camera buffer from its foreign owner before the compute shader samples it.
+    VkBufferMemoryBarrier outputBarrier{};
+    outputBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    outputBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    outputBarrier.buffer = outputBuffer;
+    outputBarrier.offset = 0;
+    outputBarrier.size = outputByteCount;
+
+    if (isNativeOutput(options)) {
+      // A native output buffer was released to its consumer after the previous dispatch, so take it back before writing.
+      VkBufferMemoryBarrier outputAcquireBarrier{};
+      outputAcquireBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+      outputAcquireBarrier.srcAccessMask = 0;
+      outputAcquireBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+      outputAcquireBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_FOREIGN_EXT;
+      outputAcquireBarrier.dstQueueFamilyIndex = _context->getQueueFamilyIndex();
+      outputAcquireBarrier.buffer = outputBuffer;
+      outputAcquireBarrier.offset = 0;
+      outputAcquireBarrier.size = outputByteCount;
+      nativeAcquireBarriers.push_back(outputAcquireBarrier);
+
+      // Release the native output buffer to its foreign consumer (e.g. an inference delegate) once the shader is done.
+      outputBarrier.dstAccessMask = 0;
+      outputBarrier.srcQueueFamilyIndex = _context->getQueueFamilyIndex();
+      outputBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_FOREIGN_EXT;
+      nativeReleaseBarriers.push_back(outputBarrier);
+    } else {
+      // Make the shader writes visible before JS reads the mapped output buffer.
+      outputBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+      outputBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+      outputBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+      hostReadBarriers.push_back(outputBarrier);
+    }
+  }
+
+  if (std::any_of(_targets.begin(), _targets.end(), isFrameStatisticsEnabled)) {
+    // The shader atomically adds into the luma sums, so they start at zero and are read back on the CPU.
+    const VkBuffer statisticsBuffer = slot.statisticsBuffer->getBuffer();
+    const VkDeviceSize statisticsByteCount = _targets.size() * kStatisticsBufferStride;
+
+    VkBufferMemoryBarrier fillBarrier{};
+    fillBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    fillBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    fillBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    fillBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    fillBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    fillBarrier.buffer = statisticsBuffer;
+    fillBarrier.offset = 0;
+    fillBarrier.size = statisticsByteCount;
+    fillBarriers.push_back(fillBarrier);
+
+    VkBufferMemoryBarrier hostReadBarrier = fillBarrier;
+    hostReadBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    hostReadBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+    hostReadBarriers.push_back(hostReadBarrier);
+  }
+
+  if (_profiler != nullptr) {
+    // Query resets must be recorded before the timestamps they reset, so do it first.
+    _profiler->resetTimestamps(commandBuffer, slotIndex, !fillBarriers.empty());
+  }
+
+  // Acquire the camera buffer from its foreign owner once, before any target's compute shader samples it.
   VkImageMemoryBarrier acquireBarrier{};
   acquireBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
   acquireBarrier.srcAccessMask = 0;
@@ -456,7 +849,7 @@ void VulkanResizerPipeline::recordCommandBufferLocked(const VulkanHardwareBuffer
   acquireBarrier.oldLayout = VK_IMAGE_LAYOUT_GENERAL;
   acquireBarrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
   acquireBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_FOREIGN_EXT;
-  acquireBarrier.dstQueueFamilyIndex = _queueFamilyIndex;
+  acquireBarrier.dstQueueFamilyIndex = _context->getQueueFamilyIndex();
   acquireBarrier.image = inputImage.image;
   acquireBarrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
   acquireBarrier.subresourceRange.baseMipLevel = 0;
@@ -464,59 +857,75 @@ void VulkanResizerPipeline::recordCommandBufferLocked(const VulkanHardwareBuffer
   acquireBarrier.subresourceRange.baseArrayLayer = 0;
   acquireBarrier.subresourceRange.layerCount = 1;
 
-  vkCmdPipelineBarrier(_commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &acquireBarrier);
+  vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &acquireBarrier);
 
-  vkCmdBindPipeline(_commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, _computeResources.pipeline);
-  vkCmdBindDescriptorSets(_commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, _computeResources.pipelineLayout, 0, 1, &_computeResources.descriptorSet, 0, nullptr);
-
-  // Push only the per-frame transform inputs; the fixed output contract is already specialized into the pipeline.
-  const shader_config::ShaderPushConstants shaderPushConstants =
-      shader_config::ShaderPushConstants::make(getOutputWidth(), getOutputHeight(), rotationDegrees, isMirrored);
+  if (!nativeAcquireBarriers.empty()) {
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0,
+                         nullptr, static_cast<uint32_t>(nativeAcquireBarriers.size()), nativeAcquireBarriers.data(), 0, nullptr);
+  }
 
-  vkCmdPushConstants(_commandBuffer, _computeResources.pipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(shader_config::ShaderPushConstants),
-                     &shaderPushConstants);
+  if (_profiler != nullptr) {
+    _profiler->writeTimestamp(commandBuffer, slotIndex, VulkanResizerProfiler::Timestamp::FILL_START, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT);
+  }
+  // Clear every output that needs it up-front, so all dispatches wait on a single barrier.
+  if (!fillBarriers.empty()) {
+    for (const VkBufferMemoryBarrier& fillBarrier : fillBarriers) {
+      vkCmdFillBuffer(commandBuffer, fillBarrier.buffer, 0, fillBarrier.size, 0);
+    }
 
-  // Zero the output buffer so sub-word atomicOr writes from adjacent pixels combine correctly.
-  // FLOAT32 uses direct word stores and does not need this.
-  if (_options.dataType != DataType::FLOAT32) {
-    vkCmdFillBuffer(_commandBuffer, _outputBuffer->getBuffer(), 0, getStorageBufferByteCount(), 0);
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr,
+                         static_cast<uint32_t>(fillBarriers.size()), fillBarriers.data(), 0, nullptr);
+  }
 
-    VkBufferMemoryBarrier fillBarrier{};
-    fillBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
-    fillBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-    fillBarrier.dstAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
-    fillBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-    fillBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-    fillBarrier.buffer = _outputBuffer->getBuffer();
-    fillBarrier.offset = 0;
-    fillBarrier.size = getStorageBufferByteCount();
+  if (_profiler != nullptr) {
+    // Written once the fill has finished, so it splits the GPU time between the fill and the dispatch.
+    _profiler->writeTimestamp(commandBuffer, slotIndex, VulkanResizerProfiler::Timestamp::DISPATCH_START, VK_PIPELINE_STAGE_TRANSFER_BIT);
+  }
 
-    vkCmdPipelineBarrier(_commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr, 1, &fillBarrier, 0, nullptr);
+  // Every target shares the pipeline layout, so only the pipeline, its descriptor set and the output size change between dispatches.
+  for (size_t targetIndex = 0; targetIndex < _targets.size(); targetIndex++) {
+    const ResizerOptions& options = _targets[targetIndex];
+    const VkDescriptorSet descriptorSet = getDescriptorSetLocked(slotIndex, targetIndex);
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, _computeResources.pipelines[targetIndex]);
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, _computeResources.pipelineLayout, 0, 1, &descriptorSet, 0, nullptr);
+
+    // Push only the per-frame transform inputs; the fixed output contract is already specialized into the pipeline.
+    const margelo::nitro::camera::resizer::utils::OutputSize& outputSize = outputSizes[targetIndex];
+    const shader_config::ShaderPushConstants shaderPushConstants =
+        shader_config::ShaderPushConstants::make(outputSize.width, outputSize.height, rotationDegrees, isMirrored);
+
+    vkCmdPushConstants(commandBuffer, _computeResources.pipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(shader_config::ShaderPushConstants),
+                       &shaderPushConstants);
+
+    // One z-slice per image of the batch, each sampling its own entry of `regions[]`.
+    const uint32_t invocationsPerRow = utils::divideRoundUp(outputSize.width, shader_config::getPixelsPerInvocation(options));
+    vkCmdDispatch(commandBuffer, utils::divideRoundUp(invocationsPerRow, _workgroupSize.x), utils::divideRoundUp(outputSize.height, _workgroupSize.y),
+                  batchSize);
   }
 
-  vkCmdDispatch(_commandBuffer, utils::divideRoundUp(getOutputWidth(), kWorkgroupSizeX), utils::divideRoundUp(getOutputHeight(), kWorkgroupSizeY), 1);
+  if (_profiler != nullptr) {
+    _profiler->writeTimestamp(commandBuffer, slotIndex, VulkanResizerProfiler::Timestamp::DISPATCH_END, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+  }
 
-  // Make the shader writes visible before JS reads the mapped output buffer.
-  VkBufferMemoryBarrier outputBarrier{};
-  outputBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
-  outputBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
-  outputBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
-  outputBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-  outputBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-  outputBarrier.buffer = _outputBuffer->getBuffer();
-  outputBarrier.offset = 0;
-  outputBarrier.size = getStorageBufferByteCount();
+  recordTextureCopiesLocked(slot, outputSizes);
 
-  vkCmdPipelineBarrier(_commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 0, nullptr, 1, &outputBarrier, 0, nullptr);
+  if (!nativeReleaseBarriers.empty()) {
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr,
+                         static_cast<uint32_t>(nativeReleaseBarriers.size()), nativeReleaseBarriers.data(), 0, nullptr);
+  }
+  if (!hostReadBarriers.empty()) {
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 0, nullptr,
+                         static_cast<uint32_t>(hostReadBarriers.size()), hostReadBarriers.data(), 0, nullptr);
+  }
 
-  // Release the imported image back to the foreign owner once sampling is finished.
+  // Release the imported image back to the foreign owner once every target has finished sampling it.
   VkImageMemoryBarrier releaseBarrier{};
   releaseBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
   releaseBarrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
   releaseBarrier.dstAccessMask = 0;
   releaseBarrier.oldLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
   releaseBarrier.newLayout = VK_IMAGE_LAYOUT_GENERAL;
-  releaseBarrier.srcQueueFamilyIndex = _queueFamilyIndex;
+  releaseBarrier.srcQueueFamilyIndex = _context->getQueueFamilyIndex();
   releaseBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_FOREIGN_EXT;
   releaseBarrier.image = inputImage.image;
   releaseBarrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
@@ -525,14 +934,93 @@ void VulkanResizerPipeline::recordCommandBufferLocked(const VulkanHardwareBuffer
   releaseBarrier.subresourceRange.baseArrayLayer = 0;
   releaseBarrier.subresourceRange.layerCount = 1;
 
-  vkCmdPipelineBarrier(_commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1,
+  vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1,
                        &releaseBarrier);
 
-  utils::checkVk(vkEndCommandBuffer(_commandBuffer), "Failed to finish recording the Vulkan resizer command buffer.");
+  utils::checkVk(vkEndCommandBuffer(commandBuffer), "Failed to finish recording the Vulkan resizer command buffer.");
+}
+
+void VulkanResizerPipeline::recordTextureCopiesLocked(const OutputSlot& slot,
+                                                      const std::vector<margelo::nitro::camera::resizer::utils::OutputSize>& outputSizes) {
+  std::vector<VkBufferMemoryBarrier> copySourceBarriers;
+  std::vector<VkImageMemoryBarrier> acquireBarriers;
+  std::vector<VkImageMemoryBarrier> releaseBarriers;
+  for (size_t targetIndex = 0; targetIndex < _targets.size(); targetIndex++) {
+    if (!margelo::nitro::camera::resizer::utils::isTextureOutput(_targets[targetIndex])) {
+      continue;
+    }
+    const VulkanReusableBuffer& outputBuffer = *slot.outputBuffers[targetIndex];
+
+    VkBufferMemoryBarrier copySourceBarrier{};
+    copySourceBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    copySourceBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    copySourceBarrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    copySourceBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    copySourceBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    copySourceBarrier.buffer = outputBuffer.getBuffer();
+    copySourceBarrier.offset = 0;
+    copySourceBarrier.size = VK_WHOLE_SIZE;
+    copySourceBarriers.push_back(copySourceBarrier);
+
+    // The texture was released to its consumer (e.g. Skia) after the previous copy. Its old contents are overwritten entirely, so discard them.
+    VkImageMemoryBarrier acquireBarrier{};
+    acquireBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    acquireBarrier.srcAccessMask = 0;
+    acquireBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    acquireBarrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    acquireBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    acquireBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_FOREIGN_EXT;
+    acquireBarrier.dstQueueFamilyIndex = _context->getQueueFamilyIndex();
+    acquireBarrier.image = outputBuffer.getImage();
+    acquireBarrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    acquireBarrier.subresourceRange.baseMipLevel = 0;
+    acquireBarrier.subresourceRange.levelCount = 1;
+    acquireBarrier.subresourceRange.baseArrayLayer = 0;
+    acquireBarrier.subresourceRange.layerCount = 1;
+    acquireBarriers.push_back(acquireBarrier);
+
+    VkImageMemoryBarrier releaseBarrier = acquireBarrier;
+    releaseBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    releaseBarrier.dstAccessMask = 0;
+    releaseBarrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    releaseBarrier.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+    releaseBarrier.srcQueueFamilyIndex = _context->getQueueFamilyIndex();
+    releaseBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_FOREIGN_EXT;
+    releaseBarriers.push_back(releaseBarrier);
+  }
+  if (acquireBarriers.empty()) {
+    return;
+  }
+
+  vkCmdPipelineBarrier(slot.commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr,
+                       static_cast<uint32_t>(copySourceBarriers.size()), copySourceBarriers.data(), static_cast<uint32_t>(acquireBarriers.size()),
+                       acquireBarriers.data());
+
+  // The output is tightly packed RGBA8, and the driver handles the row stride of the AHardwareBuffer.
+  for (size_t targetIndex = 0; targetIndex < _targets.size(); targetIndex++) {
+    if (!margelo::nitro::camera::resizer::utils::isTextureOutput(_targets[targetIndex])) {
+      continue;
+    }
+    const VulkanReusableBuffer& outputBuffer = *slot.outputBuffers[targetIndex];
+    VkBufferImageCopy copyRegion{};
+    copyRegion.bufferOffset = 0;
+    copyRegion.bufferRowLength = 0;
+    copyRegion.bufferImageHeight = 0;
+    copyRegion.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    copyRegion.imageSubresource.mipLevel = 0;
+    copyRegion.imageSubresource.baseArrayLayer = 0;
+    copyRegion.imageSubresource.layerCount = 1;
+    copyRegion.imageOffset = VkOffset3D{.x = 0, .y = 0, .z = 0};
+    copyRegion.imageExtent = VkExtent3D{.width = outputSizes[targetIndex].width, .height = outputSizes[targetIndex].height, .depth = 1};
+    vkCmdCopyBufferToImage(slot.commandBuffer, outputBuffer.getBuffer(), outputBuffer.getImage(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &copyRegion);
+  }
+
+  vkCmdPipelineBarrier(slot.commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr,
+                       static_cast<uint32_t>(releaseBarriers.size()), releaseBarriers.data());
 }
 
-void VulkanResizerPipeline::submitAndWaitLocked() {
-  utils::checkVk(vkResetFences(_device, 1, &_fence), "Failed to reset the Vulkan resizer fence.");
+void VulkanResizerPipeline::submitLocked(OutputSlot& slot, uint64_t serial) {
+  utils::checkVk(vkResetFences(_device, 1, &slot.fence), "Failed to reset the Vulkan resizer fence.");
 
   VkSubmitInfo submitInfo{
       .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
@@ -541,121 +1029,322 @@ void VulkanResizerPipeline::submitAndWaitLocked() {
       .pWaitSemaphores = nullptr,
       .pWaitDstStageMask = nullptr,
       .commandBufferCount = 1,
-      .pCommandBuffers = &_commandBuffer,
+      .pCommandBuffers = &slot.commandBuffer,
       .signalSemaphoreCount = 0,
       .pSignalSemaphores = nullptr,
   };
 
-  utils::checkVk(vkQueueSubmit(_queue, 1, &submitInfo, _fence), "Failed to submit the Vulkan resizer command buffer.");
-  utils::checkVk(vkWaitForFences(_device, 1, &_fence, VK_TRUE, std::numeric_limits<uint64_t>::max()),
+  _context->submit(submitInfo, slot.fence);
+  slot.submissionSerial = serial;
+  slot.isPending = true;
+}
+
+void VulkanResizerPipeline::waitForSlotLocked(OutputSlot& slot) {
+  if (!slot.isPending) {
+    return;
+  }
+
+  utils::checkVk(vkWaitForFences(_device, 1, &slot.fence, VK_TRUE, std::numeric_limits<uint64_t>::max()),
                  "Failed to wait for the Vulkan resizer command buffer to complete.");
+  slot.isPending = false;
+  releaseRetiredImagesLocked();
 }
 
-void VulkanResizerPipeline::invalidateOutputBufferIfNeededLocked() {
-  if (!_outputBuffer->isHostCoherent()) {
-    // Non-coherent mappings require an explicit invalidate before CPU or JS reads the finished pixels.
-    VkMappedMemoryRange mappedMemoryRange{
-        .sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,
-        .pNext = nullptr,
-        .memory = _outputBuffer->getMemory(),
-        .offset = 0,
-        .size = VK_WHOLE_SIZE,
-    };
+void VulkanResizerPipeline::waitForAllSlotsLocked() {
+  for (OutputSlot& slot : _outputSlots) {
+    waitForSlotLocked(slot);
+  }
+}
 
-    utils::checkVk(vkInvalidateMappedMemoryRanges(_device, 1, &mappedMemoryRange), "Failed to invalidate the Vulkan resizer output buffer mapping.");
+void VulkanResizerPipeline::releaseRetiredImagesLocked() noexcept {
+  // Every submission up to (but excluding) the oldest still-running one has finished.
+  uint64_t completedSerial = _lastSubmissionSerial;
+  for (OutputSlot& slot : _outputSlots) {
+    if (slot.isPending && vkGetFenceStatus(_device, slot.fence) == VK_SUCCESS) {
+      slot.isPending = false;
+    }
+    if (slot.isPending) {
+      completedSerial = std::min(completedSerial, slot.submissionSerial - 1);
+    }
   }
+  _hardwareBufferInterop->releaseRetiredImages(completedSerial);
+}
+
+void VulkanResizerPipeline::invalidateOutputBuffersIfNeededLocked(const OutputSlot& slot) {
+  for (const std::shared_ptr<VulkanReusableBuffer>& outputBuffer : slot.outputBuffers) {
+    if (outputBuffer->getMappedData() == nullptr) {
+      // Native outputs are never mapped, their consumer synchronizes with the queue family release instead.
+      continue;
+    }
+    if (!outputBuffer->isHostCoherent()) {
+      // Non-coherent mappings require an explicit invalidate before CPU or JS reads the finished pixels.
+      VkMappedMemoryRange mappedMemoryRange{
+          .sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,
+          .pNext = nullptr,
+          .memory = outputBuffer->getMemory(),
+          .offset = 0,
+          .size = VK_WHOLE_SIZE,
+      };
+
+      utils::checkVk(vkInvalidateMappedMemoryRanges(_device, 1, &mappedMemoryRange), "Failed to invalidate the Vulkan resizer output buffer mapping.");
+    }
+  }
+}
+
+void VulkanResizerPipeline::invalidateStatisticsBufferLocked(const OutputSlot& slot) {
+  if (slot.statisticsBuffer->isHostCoherent()) {
+    return;
+  }
+  VkMappedMemoryRange mappedMemoryRange{
+      .sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,
+      .pNext = nullptr,
+      .memory = slot.statisticsBuffer->getMemory(),
+      .offset = 0,
+      .size = VK_WHOLE_SIZE,
+  };
+
+  utils::checkVk(vkInvalidateMappedMemoryRanges(_device, 1, &mappedMemoryRange), "Failed to invalidate the Vulkan resizer statistics buffer mapping.");
+}
+
+void VulkanResizerPipeline::attachFrameStatisticsLocked(std::unique_lock<std::mutex>& lock, OutputSlot& slot, const Submission& submission) {
+  if (!std::any_of(_targets.begin(), _targets.end(), isFrameStatisticsEnabled)) {
+    return;
+  }
+  // Look up the baseline first, it may have to be collected from a submission that is awaited after this one.
+  const std::vector<std::vector<double>>* previousThumbnails = getThumbnailsLocked(lock, submission.serial - 1);
+  invalidateStatisticsBufferLocked(slot);
+
+  // The GPU only reduced the pixels into 256 cell sums, finishing them up here is cheaper than a second dispatch.
+  const uint32_t* cellLumaSums = reinterpret_cast<const uint32_t*>(slot.statisticsBuffer->getMappedData());
+  std::vector<std::vector<double>> thumbnails(_targets.size());
+  for (size_t targetIndex = 0; targetIndex < _targets.size(); targetIndex++) {
+    const ResizerOptions& options = _targets[targetIndex];
+    if (!isFrameStatisticsEnabled(options)) {
+      continue;
+    }
+    const std::shared_ptr<VulkanBufferView>& outputBufferView = submission.outputBufferViews[targetIndex];
+    FrameStatistics frameStatistics = margelo::nitro::camera::resizer::utils::makeFrameStatistics(
+        cellLumaSums + (targetIndex * margelo::nitro::camera::resizer::utils::kFrameStatisticsCellCount), outputBufferView->getWidth(),
+        outputBufferView->getHeight(), previousThumbnails != nullptr ? (*previousThumbnails)[targetIndex] : std::vector<double>{});
+    thumbnails[targetIndex] = frameStatistics.thumbnail;
+    outputBufferView->setFrameStatistics(std::move(frameStatistics));
+  }
+
+  // A later submission that was awaited first may have collected this one's thumbnails already (and consumed them).
+  if (slot.hasUncollectedThumbnails) {
+    _thumbnailsBySerial[submission.serial] = std::move(thumbnails);
+    slot.hasUncollectedThumbnails = false;
+  }
+  // Only this submission measures against its predecessor.
+  _thumbnailsBySerial.erase(submission.serial - 1);
+}
+
+void VulkanResizerPipeline::collectThumbnailsLocked(OutputSlot& slot) {
+  if (!slot.hasUncollectedThumbnails) {
+    return;
+  }
+  invalidateStatisticsBufferLocked(slot);
+  const uint32_t* cellLumaSums = reinterpret_cast<const uint32_t*>(slot.statisticsBuffer->getMappedData());
+  std::vector<std::vector<double>> thumbnails(_targets.size());
+  for (size_t targetIndex = 0; targetIndex < _targets.size(); targetIndex++) {
+    if (!isFrameStatisticsEnabled(_targets[targetIndex])) {
+      continue;
+    }
+    const margelo::nitro::camera::resizer::utils::OutputSize& outputSize = slot.outputSizes[targetIndex];
+    thumbnails[targetIndex] = margelo::nitro::camera::resizer::utils::makeFrameStatistics(
+                                  cellLumaSums + (targetIndex * margelo::nitro::camera::resizer::utils::kFrameStatisticsCellCount), outputSize.width,
+                                  outputSize.height, {})
+                                  .thumbnail;
+  }
+  _thumbnailsBySerial[slot.submissionSerial] = std::move(thumbnails);
+  slot.hasUncollectedThumbnails = false;
+}
+
+void VulkanResizerPipeline::retireThumbnailsLocked(OutputSlot& slot) {
+  if (!slot.hasUncollectedThumbnails) {
+    return;
+  }
+  // The slot's last submission was never awaited, and cannot be anymore once the slot is reused.
+  // Keep its thumbnails as the next submission's baseline, but its own baseline is not needed anymore.
+  collectThumbnailsLocked(slot);
+  _thumbnailsBySerial.erase(slot.submissionSerial - 1);
+}
+
+const std::vector<std::vector<double>>* VulkanResizerPipeline::getThumbnailsLocked(std::unique_lock<std::mutex>& lock, uint64_t serial) {
+  const auto iterator = _thumbnailsBySerial.find(serial);
+  if (iterator != _thumbnailsBySerial.end()) {
+    return &iterator->second;
+  }
+  // Not awaited yet. Its slot cannot have been reused (that collects it), and it was submitted to the same queue earlier,
+  // so its fence is signaled already, or about to be.
+  const auto slot = std::find_if(_outputSlots.begin(), _outputSlots.end(), [=](const OutputSlot& candidate) {
+    return candidate.hasUncollectedThumbnails && candidate.submissionSerial == serial;
+  });
+  if (slot == _outputSlots.end()) {
+    // The first submission, or statistics were not enabled for it.
+    return nullptr;
+  }
+  if (slot->isPending && vkGetFenceStatus(_device, slot->fence) != VK_SUCCESS) {
+    // Wait without holding _stateMutex so other slots can be submitted meanwhile.
+    // If the slot is reused in the meantime, its next submission waits for the same fence and collects the thumbnails first.
+    const VkFence fence = slot->fence;
+    lock.unlock();
+    utils::checkVk(vkWaitForFences(_device, 1, &fence, VK_TRUE, std::numeric_limits<uint64_t>::max()),
+                   "Failed to wait for the Vulkan resizer command buffer to complete.");
+    lock.lock();
+    if (_context == nullptr) [[unlikely]] {
+      throw std::runtime_error("This Resizer has already been disposed.");
+    }
+    // Look it up again, it may have been collected while the lock was released.
+    return getThumbnailsLocked(lock, serial);
+  }
+  waitForSlotLocked(*slot);
+  collectThumbnailsLocked(*slot);
+  return &_thumbnailsBySerial[serial];
 }
 
 void VulkanResizerPipeline::destroyComputeResourcesLocked() noexcept {
-  if (_device == VK_NULL_HANDLE) {
-    // The device is already destroyed, so these handles can only be reset locally.
+  if (_context == nullptr) {
+    // The context was already released, so these handles can only be reset locally.
     _computeResources = ComputeResources{};
     return;
   }
+  destroyComputeResources(*_context, _computeResources);
+}
 
-  if (_computeResources.pipeline != VK_NULL_HANDLE) {
-    vkDestroyPipeline(_device, _computeResources.pipeline, nullptr);
+void VulkanResizerPipeline::destroyComputeResources(VulkanContext& context, ComputeResources& resources) noexcept {
+  const VkDevice device = context.getDevice();
+  for (VkPipeline pipeline : resources.pipelines) {
+    if (pipeline != VK_NULL_HANDLE) {
+      vkDestroyPipeline(device, pipeline, nullptr);
+    }
   }
-  if (_computeResources.pipelineLayout != VK_NULL_HANDLE) {
-    vkDestroyPipelineLayout(_device, _computeResources.pipelineLayout, nullptr);
+  if (resources.pipelineLayout != VK_NULL_HANDLE) {
+    vkDestroyPipelineLayout(device, resources.pipelineLayout, nullptr);
   }
-  if (_computeResources.descriptorPool != VK_NULL_HANDLE) {
-    vkDestroyDescriptorPool(_device, _computeResources.descriptorPool, nullptr);
+  if (resources.descriptorPool != VK_NULL_HANDLE) {
+    vkDestroyDescriptorPool(device, resources.descriptorPool, nullptr);
   }
-  if (_computeResources.descriptorSetLayout != VK_NULL_HANDLE) {
-    vkDestroyDescriptorSetLayout(_device, _computeResources.descriptorSetLayout, nullptr);
+  if (resources.descriptorSetLayout != VK_NULL_HANDLE) {
+    vkDestroyDescriptorSetLayout(device, resources.descriptorSetLayout, nullptr);
   }
-  if (_computeResources.sampler != VK_NULL_HANDLE) {
-    vkDestroySampler(_device, _computeResources.sampler, nullptr);
+  if (resources.sampler != VK_NULL_HANDLE) {
+    vkDestroySampler(device, resources.sampler, nullptr);
   }
-  if (_computeResources.conversion != VK_NULL_HANDLE && _deviceDispatch.destroySamplerYcbcrConversion != nullptr) {
-    _deviceDispatch.destroySamplerYcbcrConversion(_device, _computeResources.conversion, nullptr);
+  if (resources.conversion != VK_NULL_HANDLE && context.getDeviceDispatch().destroySamplerYcbcrConversion != nullptr) {
+    context.getDeviceDispatch().destroySamplerYcbcrConversion(device, resources.conversion, nullptr);
   }
-  _computeResources = ComputeResources{};
+  resources = ComputeResources{};
 }
 
-void VulkanResizerPipeline::destroyOutputBufferLocked() noexcept {
-  _outputBuffer.reset();
+void VulkanResizerPipeline::destroyOutputBuffersLocked() noexcept {
+  for (OutputSlot& slot : _outputSlots) {
+    slot.outputBuffers.clear();
+    slot.regionBuffer.reset();
+    slot.statisticsBuffer.reset();
+  }
 }
 
 void VulkanResizerPipeline::destroyLocked() noexcept {
   if (_device != VK_NULL_HANDLE) {
-    // Stop in-flight work before tearing down shared Vulkan objects in reverse ownership order.
-    vkDeviceWaitIdle(_device);
+    // The device is shared with other Resizers, so only drain this pipeline's own submissions.
+    for (OutputSlot& slot : _outputSlots) {
+      if (slot.isPending) {
+        vkWaitForFences(_device, 1, &slot.fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+        slot.isPending = false;
+      }
+    }
   }
 
   destroyComputeResourcesLocked();
-  destroyOutputBufferLocked();
+  destroyOutputBuffersLocked();
   _hardwareBufferInterop.reset();
+  _profiler.reset();
 
-  if (_device != VK_NULL_HANDLE && _shaderModule != VK_NULL_HANDLE) {
-    vkDestroyShaderModule(_device, _shaderModule, nullptr);
-  }
-  _shaderModule = VK_NULL_HANDLE;
-
-  if (_device != VK_NULL_HANDLE && _fence != VK_NULL_HANDLE) {
-    vkDestroyFence(_device, _fence, nullptr);
+  for (OutputSlot& slot : _outputSlots) {
+    if (_device != VK_NULL_HANDLE && slot.fence != VK_NULL_HANDLE) {
+      vkDestroyFence(_device, slot.fence, nullptr);
+    }
   }
-  _fence = VK_NULL_HANDLE;
+  // Command buffers are freed together with their pool below.
+  _outputSlots.clear();
+  _nextSlotIndex = 0;
+  _thumbnailsBySerial.clear();
 
   if (_device != VK_NULL_HANDLE && _commandPool != VK_NULL_HANDLE) {
     vkDestroyCommandPool(_device, _commandPool, nullptr);
   }
   _commandPool = VK_NULL_HANDLE;
-  _commandBuffer = VK_NULL_HANDLE;
 
-  if (_device != VK_NULL_HANDLE) {
-    vkDestroyDevice(_device, nullptr);
-  }
+  // Drop our reference last. The shared device is destroyed once no other Resizer holds it anymore.
   _device = VK_NULL_HANDLE;
-  _deviceDispatch = VulkanDeviceDispatch{};
-  _queueFamilyIndex = std::numeric_limits<uint32_t>::max();
-  _queue = VK_NULL_HANDLE;
-  _physicalDevice = VK_NULL_HANDLE;
+  _context = nullptr;
+}
+
+VkDescriptorSet VulkanResizerPipeline::getDescriptorSetLocked(size_t slotIndex, size_t targetIndex) const noexcept {
+  return _computeResources.descriptorSets[slotIndex * _targets.size() + targetIndex];
+}
 
-  if (_instance != VK_NULL_HANDLE) {
-    vkDestroyInstance(_instance, nullptr);
+size_t VulkanResizerPipeline::getOutputSlotCount() const {
+  size_t outputSlotCount = 0;
+  for (const ResizerOptions& options : _targets) {
+    outputSlotCount = std::max(outputSlotCount, getOutputBufferCount(options));
   }
-  _instance = VK_NULL_HANDLE;
-  _instanceDispatch = VulkanInstanceDispatch{};
+  return outputSlotCount;
 }
 
-uint32_t VulkanResizerPipeline::getOutputWidth() const noexcept {
-  return static_cast<uint32_t>(std::lround(_options.width));
+size_t VulkanResizerPipeline::getMaxBatchSize() const {
+  size_t maxBatchSize = kMaxBatchSize;
+  for (const ResizerOptions& options : _targets) {
+    maxBatchSize = std::min(maxBatchSize, getMaxBatchSize(options));
+  }
+  return maxBatchSize;
 }
 
-uint32_t VulkanResizerPipeline::getOutputHeight() const noexcept {
-  return static_cast<uint32_t>(std::lround(_options.height));
+size_t VulkanResizerPipeline::getOutputBufferCount(const ResizerOptions& options) {
+  const double outputBufferCount = options.outputBufferCount.value_or(1);
+  if (outputBufferCount < 1 || outputBufferCount > static_cast<double>(kMaxOutputBufferCount) || std::floor(outputBufferCount) != outputBufferCount)
+      [[unlikely]] {
+    throw std::runtime_error("ResizerOptions.outputBufferCount must be an integer between 1 and " + std::to_string(kMaxOutputBufferCount) + ", but was " +
+                             std::to_string(outputBufferCount) + ".");
+  }
+  return static_cast<size_t>(outputBufferCount);
 }
 
-size_t VulkanResizerPipeline::getOutputByteCount() const {
+size_t VulkanResizerPipeline::getMaxBatchSize(const ResizerOptions& options) {
+  const double maxBatchSize = options.maxBatchSize.value_or(1);
+  if (maxBatchSize < 1 || maxBatchSize > static_cast<double>(kMaxBatchSize) || std::floor(maxBatchSize) != maxBatchSize) [[unlikely]] {
+    throw std::runtime_error("ResizerOptions.maxBatchSize must be an integer between 1 and " + std::to_string(kMaxBatchSize) + ", but was " +
+                             std::to_string(maxBatchSize) + ".");
+  }
+  return static_cast<size_t>(maxBatchSize);
+}
+
+size_t VulkanResizerPipeline::getOutputByteCount(const ResizerOptions& options, const margelo::nitro::camera::resizer::utils::OutputSize& outputSize) {
   // `pixelLayout` only changes how channel values are arranged in memory, not the total byte count.
-  return margelo::nitro::camera::resizer::utils::getOutputTotalByteCount(_options.channelOrder, _options.dataType, getOutputWidth(), getOutputHeight());
+  return margelo::nitro::camera::resizer::utils::getOutputTotalByteCount(options.channelOrder, options.dataType, outputSize.width, outputSize.height);
 }
 
-size_t VulkanResizerPipeline::getStorageBufferByteCount() const {
-  const size_t byteCount = getOutputByteCount();
+size_t VulkanResizerPipeline::getStorageBufferByteCount(const ResizerOptions& options, const margelo::nitro::camera::resizer::utils::OutputSize& outputSize,
+                                                        size_t batchSize) {
+  // Images of a batch are packed back-to-back, so only the end of the whole batch is padded to a full word.
+  const size_t byteCount = getOutputByteCount(options, outputSize) * batchSize;
   return ((byteCount + kStorageBufferAlignment - 1) / kStorageBufferAlignment) * kStorageBufferAlignment;
 }
 
+bool VulkanResizerPipeline::isNativeOutput(const ResizerOptions& options) noexcept {
+  return options.outputBufferType.value_or(OutputBufferType::CPU) == OutputBufferType::NATIVE;
+}
+
+bool VulkanResizerPipeline::isFrameStatisticsEnabled(const ResizerOptions& options) noexcept {
+  return options.enableFrameStatistics.value_or(false);
+}
+
+bool VulkanResizerPipeline::samplesLuma(const std::vector<ResizerOptions>& targets, const VulkanPipelineCache::InputFormat& inputFormat) noexcept {
+  if (inputFormat.ycbcrModel == VK_SAMPLER_YCBCR_MODEL_CONVERSION_RGB_IDENTITY) {
+    return false;
+  }
+  return std::all_of(targets.begin(), targets.end(), [](const ResizerOptions& options) { return options.channelOrder == ChannelOrder::GRAY; });
+}
+
 } // namespace margelo::nitro::camera::resizer::vulkan
@@ -6,21 +6,28 @@
 
 #pragma once
 
+#include "Rect.hpp"
+#include "ResizeOptions.hpp"
+#include "ResizeTransform.hpp"
 #include "ResizerOptions.hpp"
+#include "utils/CropRegion.hpp"
+#include "utils/FrameLumaStatistics.hpp"
 #include "utils/OutputBufferLayout.hpp"
+#include "utils/OutputSize.hpp"
 #include "vulkan/VulkanBufferView.hpp"
-#include "vulkan/VulkanDynamicDispatch.hpp"
+#include "vulkan/VulkanContext.hpp"
 #include "vulkan/VulkanHardwareBufferInterop.hpp"
-#include "vulkan/VulkanPhysicalDeviceSelector.hpp"
+#include "vulkan/VulkanResizerProfiler.hpp"
 #include "vulkan/VulkanReusableBuffer.hpp"
 
 #include <android/hardware_buffer.h>
-#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <limits>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <vector>
 
 #include <vulkan/vulkan.h>
 #include <vulkan/vulkan_android.h>
@@ -32,50 +39,114 @@
 namespace margelo::nitro::camera::resizer::vulkan {
 
 /**
- * Owns the Vulkan resources needed to resize and convert frames into one reusable output buffer.
+ * Owns the per-Resizer Vulkan resources needed to resize and convert frames into a ring of reusable output buffers.
+ * The instance, device, queue and shader module are borrowed from a shared `VulkanContext`.
+ *
+ * A pipeline can have multiple targets (one per `ResizerOptions`). Every target gets its own specialized compute pipeline and
+ * output buffers, but all targets share one import of the input buffer, one command buffer and one fence per frame.
  */
 class VulkanResizerPipeline final {
 public:
   /**
-   * Builds a Vulkan pipeline for one fixed output size and output layout.
+   * One in-flight dispatch into an output slot.
+   * The view must not be read until `waitForCompletion(...)` has returned.
    */
-  explicit VulkanResizerPipeline(const ResizerOptions& options);
+  struct Submission final {
+    // One view per target, in the order of the targets.
+    std::vector<std::shared_ptr<VulkanBufferView>> outputBufferViews;
+    size_t slotIndex{0};
+    uint64_t serial{0};
+  };
+
+  /**
+   * Builds a Vulkan pipeline for one output layout on top of the given context.
+   * Its output buffers start at the configured size and grow on demand, up to `ResizerOptions.maxWidth` x `ResizerOptions.maxHeight`.
+   *
+   * @throws If `ResizerOptions.maxWidth` or `ResizerOptions.maxHeight` is invalid.
+   */
+  VulkanResizerPipeline(std::shared_ptr<VulkanContext> context, const ResizerOptions& options);
+  /**
+   * Builds a Vulkan pipeline that resizes every frame once per target, recording all dispatches into a single submission.
+   *
+   * @throws If `targets` is empty, or any of them is invalid.
+   */
+  VulkanResizerPipeline(std::shared_ptr<VulkanContext> context, std::vector<ResizerOptions> targets);
+  /**
+   * Builds a Vulkan pipeline whose compute shader runs with the given workgroup size instead of the one calibrated for this device.
+   * It is only meant for measuring (see `VulkanWorkgroupSizeCalibration`), so it leaves no trace in the persistent pipeline cache:
+   * its compute pipelines are built without the cache, its input formats are not remembered for prewarming, and it never triggers a save.
+   *
+   * @throws If `targets` is empty, any of them is invalid, or `workgroupSize` exceeds the device's limits.
+   */
+  VulkanResizerPipeline(std::shared_ptr<VulkanContext> context, std::vector<ResizerOptions> targets, const VulkanPipelineCache::WorkgroupSize& workgroupSize);
   ~VulkanResizerPipeline();
 
   VulkanResizerPipeline(const VulkanResizerPipeline&) = delete;
   VulkanResizerPipeline& operator=(const VulkanResizerPipeline&) = delete;
 
   /**
-   * Imports one AHardwareBuffer, runs the compute shader, and returns a view over the reusable output buffer.
+   * Imports one AHardwareBuffer, runs the compute shader of every target, and returns one view over each target's reusable output buffer.
+   * Targets with `outputBufferType: 'texture'` are also copied into their image-format `AHardwareBuffer` in the same submission.
+   * If `ResizeOptions.crop` is set, only that region of the input (in input pixels, before rotation and mirroring) is resized.
+   * If `ResizeOptions.width` or `ResizeOptions.height` is set, this call resizes to that size instead of the configured one.
+   *
+   * @throws If the input buffer is invalid, Vulkan support is incomplete, a previous output view is still alive, the requested size is
+   * larger than `ResizerOptions.maxWidth` x `ResizerOptions.maxHeight`, or a size is requested from a pipeline with multiple targets or a
+   * texture output.
+   */
+  [[nodiscard]] std::vector<std::shared_ptr<VulkanBufferView>> run(AHardwareBuffer* hardwareBuffer, int rotationDegrees, bool isMirrored,
+                                                                   const std::optional<ResizeOptions>& resizeOptions);
+  /**
+   * Imports one AHardwareBuffer into the next free output slot and submits the compute shader without waiting for it.
+   * The caller must keep `hardwareBuffer` alive until `waitForCompletion(...)` has returned.
+   *
+   * @throws If the input buffer is invalid, Vulkan support is incomplete, or every output slot is still held by a GPUFrame.
+   */
+  [[nodiscard]] Submission submit(AHardwareBuffer* hardwareBuffer, int rotationDegrees, bool isMirrored, const std::optional<ResizeOptions>& resizeOptions);
+  /**
+   * Imports one AHardwareBuffer and resizes every region of it into consecutive images of one output buffer per target, using a single
+   * dispatch per target. Each region is in input pixels, before rotation and mirroring.
    *
-   * @throws If the input buffer is invalid, Vulkan support is incomplete, or a previous output view is still alive.
+   * @throws If `regions` is empty or larger than `ResizerOptions.maxBatchSize`, or for the same reasons as `run(...)`.
+   */
+  [[nodiscard]] std::vector<std::shared_ptr<VulkanBufferView>> runBatch(AHardwareBuffer* hardwareBuffer, int rotationDegrees, bool isMirrored,
+                                                                        const std::vector<Rect>& regions);
+  /**
+   * Blocks until the given submission has finished on the GPU and returns its now-readable output views.
    */
-  [[nodiscard]] std::shared_ptr<VulkanBufferView> run(AHardwareBuffer* hardwareBuffer, int rotationDegrees, bool isMirrored);
+  [[nodiscard]] std::vector<std::shared_ptr<VulkanBufferView>> waitForCompletion(const Submission& submission);
   /**
-   * Reports whether a live GPU frame is still holding the reusable output buffer.
+   * Reports whether a live GPU frame is still holding any of the reusable output buffers.
    */
   [[nodiscard]] bool hasActiveOutputView() const noexcept;
   /**
-   * Reports how much native memory is pinned by the persistent Vulkan output allocation.
+   * Reports how much native memory is pinned by the persistent Vulkan output allocations.
    */
   [[nodiscard]] size_t getOutputBufferAllocationSize() const noexcept;
   /**
-   * Returns whether the required Vulkan capabilities for the GPU resizer pipeline
-   * are available on this device.
+   * Reports how well the AHardwareBuffer import cache is re-using Vulkan images across frames.
+   */
+  [[nodiscard]] VulkanHardwareBufferInterop::CacheStatistics getImportCacheStatistics() const noexcept;
+  /**
+   * Reports the rolling per-stage timings, or `std::nullopt` if no target was created with `ResizerOptions.enableProfiling`.
+   */
+  [[nodiscard]] std::optional<VulkanResizerProfiler::Statistics> getTimingStatistics() const;
+  /**
+   * Builds the compute pipelines for `options` for every camera input format seen on a previous launch and persists
+   * them in the context's pipeline cache, so the first `run(...)` does not stall on driver shader compilation.
    */
-  [[nodiscard]] static bool isSupported() noexcept;
+  static void prewarm(VulkanContext& context, const ResizerOptions& options);
 
 private:
-  static inline constexpr uint32_t kWorkgroupSizeX = 8;
-  static inline constexpr uint32_t kWorkgroupSizeY = 8;
   static inline constexpr size_t kStorageBufferAlignment = sizeof(uint32_t);
-  static inline constexpr std::array<const char*, 2> kRequiredDeviceExtensions = {
-      VK_ANDROID_EXTERNAL_MEMORY_ANDROID_HARDWARE_BUFFER_EXTENSION_NAME,
-      VK_EXT_QUEUE_FAMILY_FOREIGN_EXTENSION_NAME,
-  };
+  static inline constexpr size_t kMaxOutputBufferCount = 8;
+  static inline constexpr size_t kMaxBatchSize = 64;
+  // Every target's `cellLumaSums[]` of a slot's statistics buffer. 1 KiB is a multiple of every `minStorageBufferOffsetAlignment` (at most 256).
+  static inline constexpr size_t kStatisticsBufferStride = margelo::nitro::camera::resizer::utils::kFrameStatisticsCellCount * sizeof(uint32_t);
 
   /**
    * Vulkan objects that depend on the sampled external format of the current input buffer.
+   * The sampler and layouts are shared by all targets, only the specialized pipelines differ.
    */
   struct ComputeResources final {
     uint64_t externalFormat{0};
@@ -83,50 +154,113 @@ private:
     VkSampler sampler{VK_NULL_HANDLE};
     VkDescriptorSetLayout descriptorSetLayout{VK_NULL_HANDLE};
     VkPipelineLayout pipelineLayout{VK_NULL_HANDLE};
-    VkPipeline pipeline{VK_NULL_HANDLE};
+    // One pipeline per target.
+    std::vector<VkPipeline> pipelines{};
     VkDescriptorPool descriptorPool{VK_NULL_HANDLE};
-    VkDescriptorSet descriptorSet{VK_NULL_HANDLE};
+    // One descriptor set per output slot and target (at `slotIndex * targetCount + targetIndex`), so a pending submission's sets are never rewritten.
+    std::vector<VkDescriptorSet> descriptorSets{};
   };
 
-  void createInstance();
-  void createDevice();
+  /**
+   * One entry of the output ring: one output buffer per target, plus its own region buffer, command buffer and fence.
+   */
+  struct OutputSlot final {
+    std::vector<std::shared_ptr<VulkanReusableBuffer>> outputBuffers;
+    // The bytes each output buffer can hold. Starts at the configured output size, and only grows once a larger one is requested.
+    std::vector<size_t> outputBufferByteCounts;
+    // Host-written `regions[]` of the slot's next dispatch, one per image of the batch.
+    std::unique_ptr<VulkanReusableBuffer> regionBuffer;
+    // Device-written `cellLumaSums[]` of the slot's next dispatch, one `kStatisticsBufferStride` block per target.
+    // Always allocated since every descriptor set binds it, but only cleared and read if a target enables `ResizerOptions.enableFrameStatistics`.
+    std::unique_ptr<VulkanReusableBuffer> statisticsBuffer;
+    VkCommandBuffer commandBuffer{VK_NULL_HANDLE};
+    VkFence fence{VK_NULL_HANDLE};
+    uint64_t submissionSerial{0};
+    // The output size of every target in the slot's last submission, to turn its `statisticsBuffer` into thumbnails.
+    std::vector<margelo::nitro::camera::resizer::utils::OutputSize> outputSizes;
+    bool isPending{false};
+    // Whether the thumbnails of the slot's last submission still have to be read from its `statisticsBuffer`.
+    bool hasUncollectedThumbnails{false};
+  };
+
+  VulkanResizerPipeline(std::shared_ptr<VulkanContext> context, std::vector<ResizerOptions> targets, const VulkanPipelineCache::WorkgroupSize& workgroupSize,
+                        bool isPersistent);
+
   void createCommandResources();
-  void createShaderModule();
-  void createOutputBuffer();
+  void createOutputBuffers();
+  [[nodiscard]] std::shared_ptr<VulkanReusableBuffer> createOutputBuffer(const ResizerOptions& options, size_t byteCount) const;
   void createComputeResourcesLocked(const VulkanHardwareBufferInterop::Properties& formatProperties);
-  void updateInputDescriptorLocked(const VulkanHardwareBufferInterop::ImportedImage& inputImage);
-  void recordCommandBufferLocked(const VulkanHardwareBufferInterop::ImportedImage& inputImage, int rotationDegrees, bool isMirrored);
-  void submitAndWaitLocked();
-  void invalidateOutputBufferIfNeededLocked();
+  static void createComputePipelines(VulkanContext& context, const std::vector<ResizerOptions>& targets, const VulkanPipelineCache::InputFormat& inputFormat,
+                                     const VulkanPipelineCache::WorkgroupSize& workgroupSize, VkPipelineCache pipelineCache, ComputeResources& resources);
+  static void destroyComputeResources(VulkanContext& context, ComputeResources& resources) noexcept;
+  [[nodiscard]] static AHardwareBuffer_Desc describeInputBuffer(AHardwareBuffer* hardwareBuffer);
+  [[nodiscard]] Submission submitRegions(AHardwareBuffer* hardwareBuffer, const AHardwareBuffer_Desc& description, int rotationDegrees, bool isMirrored,
+                                         const std::vector<margelo::nitro::camera::resizer::utils::CropRegion>& cropRegions,
+                                         const std::vector<margelo::nitro::camera::resizer::utils::OutputSize>& outputSizes);
+  [[nodiscard]] Submission acquireOutputSlotLocked(const std::vector<std::vector<ResizeTransform>>& transforms,
+                                                   const std::vector<margelo::nitro::camera::resizer::utils::OutputSize>& outputSizes);
+  void growOutputBufferIfNeededLocked(size_t slotIndex, size_t targetIndex, size_t byteCount);
+  void writeBufferDescriptorsLocked(size_t slotIndex, size_t targetIndex);
+  void writeRegionsLocked(const OutputSlot& slot, const std::vector<margelo::nitro::camera::resizer::utils::CropRegion>& cropRegions);
+  void updateInputDescriptorsLocked(size_t slotIndex, const VulkanHardwareBufferInterop::ImportedImage& inputImage);
+  void recordCommandBufferLocked(size_t slotIndex, const VulkanHardwareBufferInterop::ImportedImage& inputImage, int rotationDegrees, bool isMirrored,
+                                 uint32_t batchSize, const std::vector<margelo::nitro::camera::resizer::utils::OutputSize>& outputSizes);
+  void recordTextureCopiesLocked(const OutputSlot& slot, const std::vector<margelo::nitro::camera::resizer::utils::OutputSize>& outputSizes);
+  void submitLocked(OutputSlot& slot, uint64_t serial);
+  void waitForSlotLocked(OutputSlot& slot);
+  void waitForAllSlotsLocked();
+  void releaseRetiredImagesLocked() noexcept;
+  void invalidateOutputBuffersIfNeededLocked(const OutputSlot& slot);
+  void invalidateStatisticsBufferLocked(const OutputSlot& slot);
+  // May release `lock` while it waits for the previous submission, see `getThumbnailsLocked(...)`.
+  void attachFrameStatisticsLocked(std::unique_lock<std::mutex>& lock, OutputSlot& slot, const Submission& submission);
+  void collectThumbnailsLocked(OutputSlot& slot);
+  void retireThumbnailsLocked(OutputSlot& slot);
+  // Releases `lock` while it waits for the submission's fence, so concurrent `resize()` calls are not blocked meanwhile.
+  [[nodiscard]] const std::vector<std::vector<double>>* getThumbnailsLocked(std::unique_lock<std::mutex>& lock, uint64_t serial);
   void destroyComputeResourcesLocked() noexcept;
-  void destroyOutputBufferLocked() noexcept;
+  void destroyOutputBuffersLocked() noexcept;
   void destroyLocked() noexcept;
 
-  [[nodiscard]] uint32_t getOutputWidth() const noexcept;
-  [[nodiscard]] uint32_t getOutputHeight() const noexcept;
-  [[nodiscard]] size_t getOutputByteCount() const;
-  [[nodiscard]] size_t getStorageBufferByteCount() const;
+  [[nodiscard]] VkDescriptorSet getDescriptorSetLocked(size_t slotIndex, size_t targetIndex) const noexcept;
+  // The ring is as large as the largest `outputBufferCount` of any target.
+  [[nodiscard]] size_t getOutputSlotCount() const;
+  // A batch has to fit into the output buffers of every target, so this is the smallest `maxBatchSize` of any target.
+  [[nodiscard]] size_t getMaxBatchSize() const;
+
+  [[nodiscard]] static size_t getOutputBufferCount(const ResizerOptions& options);
+  [[nodiscard]] static size_t getMaxBatchSize(const ResizerOptions& options);
+  [[nodiscard]] static size_t getOutputByteCount(const ResizerOptions& options, const margelo::nitro::camera::resizer::utils::OutputSize& outputSize);
+  [[nodiscard]] static size_t getStorageBufferByteCount(const ResizerOptions& options, const margelo::nitro::camera::resizer::utils::OutputSize& outputSize,
+                                                        size_t batchSize);
+  [[nodiscard]] static bool isNativeOutput(const ResizerOptions& options) noexcept;
+  [[nodiscard]] static bool isFrameStatisticsEnabled(const ResizerOptions& options) noexcept;
+  // Whether every target is `ChannelOrder.GRAY` and `inputFormat` is YCbCr, so the sampler can return Y as is.
+  [[nodiscard]] static bool samplesLuma(const std::vector<ResizerOptions>& targets, const VulkanPipelineCache::InputFormat& inputFormat) noexcept;
 
 private:
-  // Protects the reused Vulkan execution state: queue, command buffer, descriptors, compute resources, and output buffer.
+  // Protects the reused Vulkan execution state: queue, output slots, descriptors, compute resources, and the import cache.
   mutable std::mutex _stateMutex;
-  ResizerOptions _options{};
+  std::vector<ResizerOptions> _targets{};
+  VulkanPipelineCache::WorkgroupSize _workgroupSize{};
+  // Whether this pipeline reads and writes the persistent pipeline cache, see the constructor with an explicit workgroup size.
+  bool _isPersistent{true};
 
-  VkInstance _instance{VK_NULL_HANDLE};
-  VkPhysicalDevice _physicalDevice{VK_NULL_HANDLE};
+  // Shared with every other pipeline. Reset on dispose, which also marks this pipeline as destroyed.
+  std::shared_ptr<VulkanContext> _context;
   VkDevice _device{VK_NULL_HANDLE};
-  VulkanInstanceDispatch _instanceDispatch{};
-  VulkanDeviceDispatch _deviceDispatch{};
-  uint32_t _queueFamilyIndex{std::numeric_limits<uint32_t>::max()};
-  VkQueue _queue{VK_NULL_HANDLE};
   VkCommandPool _commandPool{VK_NULL_HANDLE};
-  VkCommandBuffer _commandBuffer{VK_NULL_HANDLE};
-  VkFence _fence{VK_NULL_HANDLE};
-  VkShaderModule _shaderModule{VK_NULL_HANDLE};
 
-  std::unique_ptr<VulkanReusableBuffer> _outputBuffer;
+  std::vector<OutputSlot> _outputSlots{};
+  size_t _nextSlotIndex{0};
+  uint64_t _lastSubmissionSerial{0};
   std::unique_ptr<VulkanHardwareBufferInterop> _hardwareBufferInterop;
   ComputeResources _computeResources{};
+  // The thumbnails (one per target) of completed submissions, keyed by their serial. `FrameStatistics.motion` of submission `n` is always
+  // measured against submission `n - 1`, even if `resizeAsync()` results are awaited out of order. Entries are dropped once `n` consumed them.
+  std::map<uint64_t, std::vector<std::vector<double>>> _thumbnailsBySerial{};
+  // Only created if any target enables `ResizerOptions.enableProfiling`, every stage measurement is a no-op otherwise.
+  std::unique_ptr<VulkanResizerProfiler> _profiler;
 };
 
 } // namespace margelo::nitro::camera::resizer::vulkan
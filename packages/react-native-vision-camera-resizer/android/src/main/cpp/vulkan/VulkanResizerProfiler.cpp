@@ -0,0 +1,179 @@
+///
+/// VulkanResizerProfiler.cpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#include "vulkan/VulkanResizerProfiler.hpp"
+
+#include "vulkan/VulkanUtils.hpp"
+
+#include <android/trace.h>
+
+namespace margelo::nitro::camera::resizer::vulkan {
+
+namespace {
+
+  const char* getTraceSectionName(VulkanResizerProfiler::Stage stage) noexcept {
+    switch (stage) {
+      case VulkanResizerProfiler::Stage::QUERY_PROPERTIES:
+        return "Resizer.queryProperties";
+      case VulkanResizerProfiler::Stage::IMPORT_IMAGE:
+        return "Resizer.importImage";
+      case VulkanResizerProfiler::Stage::RECORD:
+        return "Resizer.record";
+      case VulkanResizerProfiler::Stage::SUBMIT:
+        return "Resizer.submit";
+      case VulkanResizerProfiler::Stage::WAIT:
+        return "Resizer.wait";
+      case VulkanResizerProfiler::Stage::GPU_FILL:
+        return "Resizer.gpuFill";
+      case VulkanResizerProfiler::Stage::GPU_DISPATCH:
+        return "Resizer.gpuDispatch";
+    }
+    return "Resizer";
+  }
+
+} // namespace
+
+VulkanResizerProfiler::ScopedStage::ScopedStage(VulkanResizerProfiler* profiler, Stage stage) noexcept : _profiler(profiler), _stage(stage) {
+  if (_profiler == nullptr) {
+    return;
+  }
+  _isTracing = ATrace_isEnabled();
+  if (_isTracing) {
+    ATrace_beginSection(getTraceSectionName(_stage));
+  }
+  _start = std::chrono::steady_clock::now();
+}
+
+VulkanResizerProfiler::ScopedStage::~ScopedStage() {
+  end();
+}
+
+void VulkanResizerProfiler::ScopedStage::end() noexcept {
+  if (_profiler == nullptr) {
+    return;
+  }
+  const std::chrono::steady_clock::duration duration = std::chrono::steady_clock::now() - _start;
+  if (_isTracing) {
+    ATrace_endSection();
+  }
+  try {
+    _profiler->addSample(_stage, duration);
+  } catch (...) {
+    // A lost sample is not worth failing a resize over.
+  }
+  _profiler = nullptr;
+}
+
+VulkanResizerProfiler::VulkanResizerProfiler(VkPhysicalDevice physicalDevice, VkDevice device, uint32_t queueFamilyIndex, size_t slotCount)
+    : _device(device), _slotTimestamps(slotCount) {
+  _samples.reserve(kStageCount);
+  for (size_t i = 0; i < kStageCount; i++) {
+    _samples.emplace_back(kSampleWindow);
+  }
+
+  uint32_t queueFamilyCount = 0;
+  vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, nullptr);
+  std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+  vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, queueFamilies.data());
+  const uint32_t timestampValidBits = queueFamilyIndex < queueFamilyCount ? queueFamilies[queueFamilyIndex].timestampValidBits : 0;
+  if (timestampValidBits == 0) {
+    // This queue cannot write timestamps, so GPU stages are simply never sampled.
+    return;
+  }
+
+  VkPhysicalDeviceProperties properties{};
+  vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+  _nanosecondsPerTick = static_cast<double>(properties.limits.timestampPeriod);
+  _timestampMask = timestampValidBits >= 64 ? ~uint64_t{0} : (uint64_t{1} << timestampValidBits) - 1;
+
+  VkQueryPoolCreateInfo queryPoolCreateInfo{
+      .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+      .pNext = nullptr,
+      .flags = 0,
+      .queryType = VK_QUERY_TYPE_TIMESTAMP,
+      .queryCount = static_cast<uint32_t>(slotCount) * kTimestampsPerSlot,
+      .pipelineStatistics = 0,
+  };
+
+  utils::checkVk(vkCreateQueryPool(_device, &queryPoolCreateInfo, nullptr, &_queryPool), "Failed to create the Vulkan resizer timestamp query pool.");
+}
+
+VulkanResizerProfiler::~VulkanResizerProfiler() {
+  if (_queryPool != VK_NULL_HANDLE) {
+    vkDestroyQueryPool(_device, _queryPool, nullptr);
+  }
+}
+
+void VulkanResizerProfiler::resetTimestamps(VkCommandBuffer commandBuffer, size_t slotIndex, bool hasFill) {
+  if (_queryPool == VK_NULL_HANDLE) {
+    return;
+  }
+  vkCmdResetQueryPool(commandBuffer, _queryPool, getQueryIndex(slotIndex, Timestamp::FILL_START), kTimestampsPerSlot);
+  _slotTimestamps[slotIndex] = SlotTimestamps{
+      .isRecorded = true,
+      .hasFill = hasFill,
+  };
+}
+
+void VulkanResizerProfiler::writeTimestamp(VkCommandBuffer commandBuffer, size_t slotIndex, Timestamp timestamp, VkPipelineStageFlagBits pipelineStage) {
+  if (_queryPool == VK_NULL_HANDLE) {
+    return;
+  }
+  vkCmdWriteTimestamp(commandBuffer, pipelineStage, _queryPool, getQueryIndex(slotIndex, timestamp));
+}
+
+void VulkanResizerProfiler::collectTimestamps(size_t slotIndex) {
+  if (_queryPool == VK_NULL_HANDLE || !_slotTimestamps[slotIndex].isRecorded) {
+    return;
+  }
+  const SlotTimestamps slotTimestamps = _slotTimestamps[slotIndex];
+  _slotTimestamps[slotIndex].isRecorded = false;
+
+  std::array<uint64_t, kTimestampsPerSlot> ticks{};
+  const VkResult result = vkGetQueryPoolResults(_device, _queryPool, getQueryIndex(slotIndex, Timestamp::FILL_START), kTimestampsPerSlot,
+                                                sizeof(ticks), ticks.data(), sizeof(uint64_t), VK_QUERY_RESULT_64_BIT);
+  if (result != VK_SUCCESS) {
+    // VK_NOT_READY if the submission never ran, which only loses this one sample.
+    return;
+  }
+
+  // Timestamps only have `timestampValidBits` bits, so differences are taken modulo that range to survive a wrap-around.
+  const auto getMilliseconds = [this](uint64_t startTicks, uint64_t endTicks) {
+    const uint64_t elapsedTicks = (endTicks - startTicks) & _timestampMask;
+    return static_cast<double>(elapsedTicks) * _nanosecondsPerTick / 1'000'000.0;
+  };
+  const uint64_t fillStart = ticks[static_cast<size_t>(Timestamp::FILL_START)];
+  const uint64_t dispatchStart = ticks[static_cast<size_t>(Timestamp::DISPATCH_START)];
+  const uint64_t dispatchEnd = ticks[static_cast<size_t>(Timestamp::DISPATCH_END)];
+  if (slotTimestamps.hasFill) {
+    addSampleMilliseconds(Stage::GPU_FILL, getMilliseconds(fillStart, dispatchStart));
+  }
+  addSampleMilliseconds(Stage::GPU_DISPATCH, getMilliseconds(dispatchStart, dispatchEnd));
+}
+
+void VulkanResizerProfiler::addSample(Stage stage, std::chrono::steady_clock::duration duration) {
+  addSampleMilliseconds(stage, std::chrono::duration<double, std::milli>(duration).count());
+}
+
+void VulkanResizerProfiler::addSampleMilliseconds(Stage stage, double milliseconds) {
+  std::lock_guard<std::mutex> lock(_samplesMutex);
+  _samples[static_cast<size_t>(stage)].addSample(milliseconds);
+}
+
+VulkanResizerProfiler::Statistics VulkanResizerProfiler::getStatistics() const {
+  std::lock_guard<std::mutex> lock(_samplesMutex);
+  Statistics statistics{};
+  for (size_t i = 0; i < kStageCount; i++) {
+    statistics.stages[i] = _samples[i].getSummary();
+  }
+  return statistics;
+}
+
+uint32_t VulkanResizerProfiler::getQueryIndex(size_t slotIndex, Timestamp timestamp) const noexcept {
+  return static_cast<uint32_t>(slotIndex) * kTimestampsPerSlot + static_cast<uint32_t>(timestamp);
+}
+
+} // namespace margelo::nitro::camera::resizer::vulkan
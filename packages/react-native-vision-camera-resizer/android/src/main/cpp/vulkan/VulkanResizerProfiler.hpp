@@ -0,0 +1,125 @@
+///
+/// VulkanResizerProfiler.hpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include "utils/RollingPercentiles.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+namespace margelo::nitro::camera::resizer::vulkan {
+
+/**
+ * Measures how long each stage of a `VulkanResizerPipeline` dispatch takes, as rolling percentiles.
+ * CPU stages are timed with a steady clock (and emitted as ATrace sections while tracing), GPU stages with timestamp queries.
+ * Samples are guarded by an internal mutex, so stages may be measured on any thread.
+ */
+class VulkanResizerProfiler final {
+public:
+  enum class Stage { QUERY_PROPERTIES, IMPORT_IMAGE, RECORD, SUBMIT, WAIT, GPU_FILL, GPU_DISPATCH };
+  static inline constexpr size_t kStageCount = static_cast<size_t>(Stage::GPU_DISPATCH) + 1;
+
+  /**
+   * The timestamps written into each output slot's command buffer, in submission order.
+   */
+  enum class Timestamp { FILL_START, DISPATCH_START, DISPATCH_END };
+
+  struct Statistics final {
+    std::array<margelo::nitro::camera::resizer::utils::RollingPercentiles::Summary, kStageCount> stages{};
+
+    [[nodiscard]] const margelo::nitro::camera::resizer::utils::RollingPercentiles::Summary& get(Stage stage) const noexcept {
+      return stages[static_cast<size_t>(stage)];
+    }
+  };
+
+  /**
+   * Times one CPU stage from construction until `end()` or destruction. A `nullptr` profiler makes this a no-op.
+   */
+  class ScopedStage final {
+  public:
+    ScopedStage(VulkanResizerProfiler* profiler, Stage stage) noexcept;
+    ~ScopedStage();
+
+    ScopedStage(const ScopedStage&) = delete;
+    ScopedStage& operator=(const ScopedStage&) = delete;
+
+    /**
+     * Stops timing and records the sample. Calling it more than once has no effect.
+     */
+    void end() noexcept;
+
+  private:
+    VulkanResizerProfiler* _profiler{nullptr};
+    Stage _stage{Stage::QUERY_PROPERTIES};
+    std::chrono::steady_clock::time_point _start{};
+    bool _isTracing{false};
+  };
+
+  /**
+   * Creates a timestamp query pool for `slotCount` output slots, if the queue family supports timestamps.
+   * Otherwise only CPU stages are measured.
+   */
+  VulkanResizerProfiler(VkPhysicalDevice physicalDevice, VkDevice device, uint32_t queueFamilyIndex, size_t slotCount);
+  ~VulkanResizerProfiler();
+
+  VulkanResizerProfiler(const VulkanResizerProfiler&) = delete;
+  VulkanResizerProfiler& operator=(const VulkanResizerProfiler&) = delete;
+
+  /**
+   * Records the reset of one slot's timestamp queries into its command buffer. Must precede every `writeTimestamp(...)` of that slot.
+   */
+  void resetTimestamps(VkCommandBuffer commandBuffer, size_t slotIndex, bool hasFill);
+  /**
+   * Records writing one timestamp once every previous command of the slot's command buffer has passed `pipelineStage`.
+   */
+  void writeTimestamp(VkCommandBuffer commandBuffer, size_t slotIndex, Timestamp timestamp, VkPipelineStageFlagBits pipelineStage);
+  /**
+   * Reads back one slot's timestamps into GPU stage samples. Must only be called once the slot's fence has signaled.
+   */
+  void collectTimestamps(size_t slotIndex);
+  /**
+   * Records one sample of a stage that was timed by the caller.
+   */
+  void addSample(Stage stage, std::chrono::steady_clock::duration duration);
+
+  [[nodiscard]] Statistics getStatistics() const;
+
+private:
+  static inline constexpr size_t kSampleWindow = 256;
+  static inline constexpr uint32_t kTimestampsPerSlot = 3;
+
+  /**
+   * Whether a slot has timestamps waiting to be read back, and whether its dispatch cleared the output first.
+   */
+  struct SlotTimestamps final {
+    bool isRecorded{false};
+    bool hasFill{false};
+  };
+
+  void addSampleMilliseconds(Stage stage, double milliseconds);
+  [[nodiscard]] uint32_t getQueryIndex(size_t slotIndex, Timestamp timestamp) const noexcept;
+
+private:
+  VkDevice _device{VK_NULL_HANDLE};
+  // `VK_NULL_HANDLE` if the queue family does not support timestamps.
+  VkQueryPool _queryPool{VK_NULL_HANDLE};
+  double _nanosecondsPerTick{0.0};
+  uint64_t _timestampMask{0};
+  std::vector<SlotTimestamps> _slotTimestamps{};
+
+  // Protects `_samples`.
+  mutable std::mutex _samplesMutex;
+  std::vector<margelo::nitro::camera::resizer::utils::RollingPercentiles> _samples{};
+};
+
+} // namespace margelo::nitro::camera::resizer::vulkan
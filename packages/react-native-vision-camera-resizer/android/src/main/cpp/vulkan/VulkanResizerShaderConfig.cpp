@@ -7,7 +7,9 @@
 #include "vulkan/VulkanResizerShaderConfig.hpp"
 
 #include "utils/OutputBufferLayout.hpp"
+#include "utils/OutputNormalization.hpp"
 
+#include <cmath>
 #include <cstddef>
 #include <stdexcept>
 
@@ -15,7 +17,7 @@ namespace margelo::nitro::camera::resizer::vulkan::shader_config {
 
 namespace {
 
-  const std::array<VkSpecializationMapEntry, 5> kShaderSpecializationMapEntries = {
+  const std::array<VkSpecializationMapEntry, 21> kShaderSpecializationMapEntries = {
       VkSpecializationMapEntry{
           .constantID = 0,
           .offset = offsetof(ShaderSpecializationData, dataType),
@@ -41,17 +43,116 @@ namespace {
           .offset = offsetof(ShaderSpecializationData, scaleMode),
           .size = sizeof(uint32_t),
       },
+      VkSpecializationMapEntry{
+          .constantID = 5,
+          .offset = offsetof(ShaderSpecializationData, channelScale0),
+          .size = sizeof(float),
+      },
+      VkSpecializationMapEntry{
+          .constantID = 6,
+          .offset = offsetof(ShaderSpecializationData, channelScale1),
+          .size = sizeof(float),
+      },
+      VkSpecializationMapEntry{
+          .constantID = 7,
+          .offset = offsetof(ShaderSpecializationData, channelScale2),
+          .size = sizeof(float),
+      },
+      VkSpecializationMapEntry{
+          .constantID = 8,
+          .offset = offsetof(ShaderSpecializationData, channelBias0),
+          .size = sizeof(float),
+      },
+      VkSpecializationMapEntry{
+          .constantID = 9,
+          .offset = offsetof(ShaderSpecializationData, channelBias1),
+          .size = sizeof(float),
+      },
+      VkSpecializationMapEntry{
+          .constantID = 10,
+          .offset = offsetof(ShaderSpecializationData, channelBias2),
+          .size = sizeof(float),
+      },
+      VkSpecializationMapEntry{
+          .constantID = 11,
+          .offset = offsetof(ShaderSpecializationData, inverseQuantizationScale),
+          .size = sizeof(float),
+      },
+      VkSpecializationMapEntry{
+          .constantID = 12,
+          .offset = offsetof(ShaderSpecializationData, quantizationZeroPoint),
+          .size = sizeof(float),
+      },
+      VkSpecializationMapEntry{
+          .constantID = 13,
+          .offset = offsetof(ShaderSpecializationData, pixelsPerInvocation),
+          .size = sizeof(uint32_t),
+      },
+      VkSpecializationMapEntry{
+          .constantID = 14,
+          .offset = offsetof(ShaderSpecializationData, frameStatistics),
+          .size = sizeof(uint32_t),
+      },
+      VkSpecializationMapEntry{
+          .constantID = 15,
+          .offset = offsetof(ShaderSpecializationData, filter),
+          .size = sizeof(uint32_t),
+      },
+      VkSpecializationMapEntry{
+          .constantID = 16,
+          .offset = offsetof(ShaderSpecializationData, channelScale3),
+          .size = sizeof(float),
+      },
+      VkSpecializationMapEntry{
+          .constantID = 17,
+          .offset = offsetof(ShaderSpecializationData, channelBias3),
+          .size = sizeof(float),
+      },
+      VkSpecializationMapEntry{
+          .constantID = 18,
+          .offset = offsetof(ShaderSpecializationData, workgroupSizeX),
+          .size = sizeof(uint32_t),
+      },
+      VkSpecializationMapEntry{
+          .constantID = 19,
+          .offset = offsetof(ShaderSpecializationData, workgroupSizeY),
+          .size = sizeof(uint32_t),
+      },
+      VkSpecializationMapEntry{
+          .constantID = 20,
+          .offset = offsetof(ShaderSpecializationData, lumaInput),
+          .size = sizeof(uint32_t),
+      },
   };
 
 } // namespace
 
-ShaderSpecializationData ShaderSpecializationData::make(const ResizerOptions& options) {
+ShaderSpecializationData ShaderSpecializationData::make(const ResizerOptions& options, const VulkanPipelineCache::WorkgroupSize& workgroupSize,
+                                                        bool isLumaInput) {
+  const margelo::nitro::camera::resizer::utils::OutputNormalization normalization =
+      margelo::nitro::camera::resizer::utils::getOutputNormalization(options);
   return ShaderSpecializationData{
       .dataType = getDataTypeOrdinal(options.dataType),
       .channelOrder = getChannelOrderOrdinal(options.channelOrder),
       .pixelLayout = getPixelLayoutOrdinal(options.pixelLayout),
       .channelCount = margelo::nitro::camera::resizer::utils::getChannelsPerPixel(options.channelOrder),
       .scaleMode = getScaleModeOrdinal(options.scaleMode),
+      .channelScale0 = normalization.channelScale[0],
+      .channelScale1 = normalization.channelScale[1],
+      .channelScale2 = normalization.channelScale[2],
+      .channelBias0 = normalization.channelBias[0],
+      .channelBias1 = normalization.channelBias[1],
+      .channelBias2 = normalization.channelBias[2],
+      .inverseQuantizationScale = normalization.inverseQuantizationScale,
+      .quantizationZeroPoint = normalization.quantizationZeroPoint,
+      .pixelsPerInvocation = getPixelsPerInvocation(options),
+      .frameStatistics = options.enableFrameStatistics.value_or(false) ? 1u : 0u,
+      .filter = getFilterOrdinal(options.filter.value_or(ResizeFilter::BILINEAR)),
+      .channelScale3 = normalization.channelScale[3],
+      .channelBias3 = normalization.channelBias[3],
+      .workgroupSizeX = workgroupSize.x,
+      .workgroupSizeY = workgroupSize.y,
+      .lumaInput = isLumaInput ? 1u : 0u,
   };
 }
 
@@ -85,6 +186,14 @@ uint32_t ShaderSpecializationData::getChannelOrderOrdinal(ChannelOrder channelOr
       return 0u;
     case ChannelOrder::BGR:
       return 1u;
+    case ChannelOrder::GRAY:
+      return 2u;
+    case ChannelOrder::RGBA:
+      return 3u;
+    case ChannelOrder::BGRA:
+      return 4u;
+    case ChannelOrder::ARGB:
+      return 5u;
   }
 
   throw std::runtime_error("Unsupported Resizer ChannelOrder.");
@@ -113,6 +222,54 @@ uint32_t ShaderSpecializationData::getScaleModeOrdinal(ScaleMode scaleMode) {
 
   throw std::runtime_error("Unsupported Resizer ScaleMode.");
 }
+
+uint32_t ShaderSpecializationData::getFilterOrdinal(ResizeFilter filter) {
+  switch (filter) {
+    case ResizeFilter::BILINEAR:
+      return 0u;
+    case ResizeFilter::AREA:
+      return 1u;
+  }
+
+  throw std::runtime_error("Unsupported Resizer ResizeFilter.");
+}
+
+uint32_t getPixelsPerInvocation(const ResizerOptions& options) {
+  uint32_t pixelsPerWord = 1;
+  switch (options.dataType) {
+    case DataType::INT8:
+    case DataType::UINT8:
+      pixelsPerWord = 4;
+      break;
+    case DataType::FLOAT16:
+      pixelsPerWord = 2;
+      break;
+    case DataType::FLOAT32:
+      pixelsPerWord = 1;
+      break;
+  }
+
+  // Every row (and with it every plane and every image of a batch) must start on a word boundary for whole-word stores.
+  const uint32_t outputWidth = static_cast<uint32_t>(std::lround(options.width));
+  if (outputWidth % pixelsPerWord != 0) {
+    return 1;
+  }
+  return pixelsPerWord;
+}
+
+bool requiresZeroedOutputBuffer(const ResizerOptions& options, uint32_t outputWidth) {
+  if (options.dataType == DataType::FLOAT32) {
+    return false;
+  }
+  const uint32_t pixelsPerInvocation = getPixelsPerInvocation(options);
+  if (pixelsPerInvocation > 1 && outputWidth % pixelsPerInvocation == 0) {
+    return false;
+  }
+  // One interleaved pixel of 4 channels spans 4 bytes (8-bit) or 8 bytes (16-bit), so each pixel owns whole words.
+  const bool isInterleaved = options.pixelLayout == PixelLayout::INTERLEAVED;
+  return !(isInterleaved && utils::getChannelsPerPixel(options.channelOrder) == 4);
+}
+
 ShaderPushConstants ShaderPushConstants::make(uint32_t outputWidth, uint32_t outputHeight, int32_t rotationDegrees, bool isMirrored) {
   return ShaderPushConstants{
       .outputWidth = outputWidth,
@@ -7,6 +7,8 @@
 #pragma once
 
 #include "ResizerOptions.hpp"
+#include "utils/CropRegion.hpp"
+#include "vulkan/VulkanPipelineCache.hpp"
 
 #include <array>
 #include <cstdint>
@@ -24,8 +26,34 @@ struct ShaderSpecializationData final {
   uint32_t pixelLayout;
   uint32_t channelCount;
   uint32_t scaleMode;
+  // Fused `(x - mean) / standardDeviation` per output channel, see `utils::OutputNormalization`.
+  float channelScale0;
+  float channelScale1;
+  float channelScale2;
+  float channelBias0;
+  float channelBias1;
+  float channelBias2;
+  float inverseQuantizationScale;
+  float quantizationZeroPoint;
+  // Output pixels written per invocation, see `getPixelsPerInvocation(...)`.
+  uint32_t pixelsPerInvocation;
+  // 1 if the shader accumulates the luma sums of `FrameStatistics`, see `utils::FrameLumaStatistics`.
+  uint32_t frameStatistics;
+  uint32_t filter;
+  // The fourth channel of `channelScale`/`channelBias`, only used by 4-channel `ChannelOrder`s.
+  float channelScale3;
+  float channelBias3;
+  // `local_size_x`/`local_size_y` of the compute shader, see `VulkanWorkgroupSizeCalibration`.
+  uint32_t workgroupSizeX;
+  uint32_t workgroupSizeY;
+  // 1 if the input sampler's YCbCr conversion is `YCBCR_IDENTITY` (full range), so `.g` of every sample is the raw luma.
+  uint32_t lumaInput;
 
-  [[nodiscard]] static ShaderSpecializationData make(const ResizerOptions& options);
+  /**
+   * Specializes the shader for `options`. Pass `isLumaInput` only if the sampler's conversion is `YCBCR_IDENTITY`, see `lumaInput`.
+   */
+  [[nodiscard]] static ShaderSpecializationData make(const ResizerOptions& options, const VulkanPipelineCache::WorkgroupSize& workgroupSize,
+                                                     bool isLumaInput);
   [[nodiscard]] VkSpecializationInfo asVkInfo() const noexcept;
 
 private:
@@ -33,8 +61,28 @@ private:
   [[nodiscard]] static uint32_t getChannelOrderOrdinal(ChannelOrder channelOrder);
   [[nodiscard]] static uint32_t getPixelLayoutOrdinal(PixelLayout pixelLayout);
   [[nodiscard]] static uint32_t getScaleModeOrdinal(ScaleMode scaleMode);
+  [[nodiscard]] static uint32_t getFilterOrdinal(ResizeFilter filter);
 };
-static_assert(sizeof(ShaderSpecializationData) == 20, "ShaderSpecializationData must stay tightly packed.");
+static_assert(sizeof(ShaderSpecializationData) == 84, "ShaderSpecializationData must stay tightly packed.");
+
+/**
+ * Returns how many horizontally adjacent output pixels one shader invocation writes.
+ *
+ * For 8-bit (4) and 16-bit (2) outputs whose width is a multiple of that count, every invocation fills whole 32-bit words
+ * with plain stores, so the output buffer needs no pre-zeroing and no atomics. Every other output (including FLOAT32, which
+ * is always word-sized) uses 1, the generic per-pixel path.
+ */
+[[nodiscard]] uint32_t getPixelsPerInvocation(const ResizerOptions& options);
+
+/**
+ * Returns whether the output buffer must be zeroed before a dispatch of `outputWidth` pixel wide images, because sub-word
+ * values are combined with `atomicOr`.
+ *
+ * Outputs written with whole-word stores only (FLOAT32, the packed path of `getPixelsPerInvocation(...)`, and interleaved
+ * 4-channel outputs whose pixels are always word-sized) skip the fill. The packed path is only taken if `outputWidth`
+ * is still a multiple of the pixels per invocation, which a per-call `ResizeOptions.width` may not be.
+ */
+[[nodiscard]] bool requiresZeroedOutputBuffer(const ResizerOptions& options, uint32_t outputWidth);
 
 /**
  * Packed per-dispatch inputs that vary frame to frame while the pipeline stays fixed.
@@ -49,4 +97,10 @@ struct ShaderPushConstants final {
 };
 static_assert(sizeof(ShaderPushConstants) == 16, "ShaderPushConstants must stay tightly packed.");
 
+/**
+ * One entry of the shader's `regions[]` storage buffer: the sampled input region of one output image, as a std430 `vec4`.
+ */
+using ShaderRegion = margelo::nitro::camera::resizer::utils::CropRegion;
+static_assert(sizeof(ShaderRegion) == 16, "ShaderRegion must match the std430 layout of a vec4.");
+
 } // namespace margelo::nitro::camera::resizer::vulkan::shader_config
@@ -0,0 +1,50 @@
+///
+/// VulkanResizerStatistics.cpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#include "vulkan/VulkanResizerStatistics.hpp"
+
+#include "utils/RollingPercentiles.hpp"
+
+#include <optional>
+
+namespace margelo::nitro::camera::resizer::vulkan {
+
+namespace {
+
+  StageTimingStatistics toStageTimingStatistics(const margelo::nitro::camera::resizer::utils::RollingPercentiles::Summary& summary) {
+    return StageTimingStatistics(static_cast<double>(summary.sampleCount), summary.p50, summary.p95, summary.p99);
+  }
+
+  /**
+   * GPU stages are only reported once they have been sampled, which requires timestamp support on the compute queue.
+   */
+  std::optional<StageTimingStatistics> toOptionalStageTimingStatistics(const margelo::nitro::camera::resizer::utils::RollingPercentiles::Summary& summary) {
+    if (summary.sampleCount == 0) {
+      return std::nullopt;
+    }
+    return toStageTimingStatistics(summary);
+  }
+
+  ResizerTimingStatistics toResizerTimingStatistics(const VulkanResizerProfiler::Statistics& statistics) {
+    using Stage = VulkanResizerProfiler::Stage;
+    return ResizerTimingStatistics(toStageTimingStatistics(statistics.get(Stage::QUERY_PROPERTIES)), toStageTimingStatistics(statistics.get(Stage::IMPORT_IMAGE)),
+                                   toStageTimingStatistics(statistics.get(Stage::RECORD)), toStageTimingStatistics(statistics.get(Stage::SUBMIT)),
+                                   toStageTimingStatistics(statistics.get(Stage::WAIT)), toOptionalStageTimingStatistics(statistics.get(Stage::GPU_FILL)),
+                                   toOptionalStageTimingStatistics(statistics.get(Stage::GPU_DISPATCH)));
+  }
+
+} // namespace
+
+ResizerStatistics getResizerStatistics(const VulkanResizerPipeline& pipeline) {
+  const VulkanHardwareBufferInterop::CacheStatistics importCache = pipeline.getImportCacheStatistics();
+  const std::optional<VulkanResizerProfiler::Statistics> timings = pipeline.getTimingStatistics();
+  return ResizerStatistics(ImportCacheStatistics(static_cast<double>(importCache.hits), static_cast<double>(importCache.misses),
+                                                 static_cast<double>(importCache.evictions), static_cast<double>(importCache.size),
+                                                 static_cast<double>(importCache.capacity)),
+                           timings.has_value() ? std::make_optional(toResizerTimingStatistics(*timings)) : std::nullopt);
+}
+
+} // namespace margelo::nitro::camera::resizer::vulkan
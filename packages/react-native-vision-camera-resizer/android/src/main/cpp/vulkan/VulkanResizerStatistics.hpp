@@ -0,0 +1,20 @@
+///
+/// VulkanResizerStatistics.hpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include "ResizerStatistics.hpp"
+#include "vulkan/VulkanResizerPipeline.hpp"
+
+namespace margelo::nitro::camera::resizer::vulkan {
+
+/**
+ * Snapshots the import cache counters and (if profiling is enabled) the stage timings of `pipeline`
+ * into the JS-facing `ResizerStatistics`.
+ */
+[[nodiscard]] ResizerStatistics getResizerStatistics(const VulkanResizerPipeline& pipeline);
+
+} // namespace margelo::nitro::camera::resizer::vulkan
@@ -6,8 +6,11 @@
 
 #include "VulkanReusableBuffer.hpp"
 
+#include "vulkan/VulkanUtils.hpp"
+
 #include <optional>
 #include <stdexcept>
+#include <utility>
 
 namespace margelo::nitro::camera::resizer::vulkan {
 
@@ -52,7 +55,8 @@ VulkanReusableBuffer::VulkanReusableBuffer(VkPhysicalDevice physicalDevice, VkDe
       .pNext = nullptr,
       .flags = 0,
       .size = bufferSize,
-      .usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+      // TRANSFER_SRC so a texture output can be copied into its image.
+      .usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
       .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
       .queueFamilyIndexCount = 0,
       .pQueueFamilyIndices = nullptr,
@@ -95,53 +99,225 @@ VulkanReusableBuffer::VulkanReusableBuffer(VkPhysicalDevice physicalDevice, VkDe
     _allocationSize = memoryRequirements.size;
     _isHostCoherent = (memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0;
   } catch (...) {
+    destroy();
+    throw;
+  }
+}
+
+VulkanReusableBuffer::VulkanReusableBuffer(VkPhysicalDevice physicalDevice, VkDevice device, const VulkanDeviceDispatch& deviceDispatch,
+                                           size_t bufferSize)
+    : _device(device) {
+  try {
+    // A BLOB buffer is a plain linear byte range, which is what GPU and NNAPI delegates bind as an input tensor.
+    AHardwareBuffer_Desc description{
+        .width = static_cast<uint32_t>(bufferSize),
+        .height = 1,
+        .layers = 1,
+        .format = AHARDWAREBUFFER_FORMAT_BLOB,
+        .usage = AHARDWAREBUFFER_USAGE_GPU_DATA_BUFFER,
+        .stride = 0,
+        .rfu0 = 0,
+        .rfu1 = 0,
+    };
+    if (AHardwareBuffer_allocate(&description, &_hardwareBuffer) != 0 || _hardwareBuffer == nullptr) [[unlikely]] {
+      _hardwareBuffer = nullptr;
+      throw std::runtime_error("Failed to allocate the AHardwareBuffer for the native resizer output.");
+    }
+
+    VkExternalMemoryBufferCreateInfo externalMemoryBufferCreateInfo{
+        .sType = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO,
+        .pNext = nullptr,
+        .handleTypes = VK_EXTERNAL_MEMORY_HANDLE_TYPE_ANDROID_HARDWARE_BUFFER_BIT_ANDROID,
+    };
+
+    VkBufferCreateInfo bufferCreateInfo{
+        .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+        .pNext = &externalMemoryBufferCreateInfo,
+        .flags = 0,
+        .size = bufferSize,
+        .usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+        .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+        .queueFamilyIndexCount = 0,
+        .pQueueFamilyIndices = nullptr,
+    };
+
+    utils::checkVk(vkCreateBuffer(_device, &bufferCreateInfo, nullptr, &_buffer), "Failed to create the Vulkan buffer for the native resizer output.");
+
+    VkAndroidHardwareBufferPropertiesANDROID hardwareBufferProperties{
+        .sType = VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_PROPERTIES_ANDROID,
+        .pNext = nullptr,
+        .allocationSize = 0,
+        .memoryTypeBits = 0,
+    };
+    utils::checkVk(deviceDispatch.getAndroidHardwareBufferPropertiesANDROID(_device, _hardwareBuffer, &hardwareBufferProperties),
+                   "Failed to query Vulkan properties for the native resizer output AHardwareBuffer.");
+
+    // The memory is never mapped, so any memory type the driver allows for this AHardwareBuffer will do.
+    const uint32_t memoryTypeIndex = findMemoryTypeIndex(physicalDevice, hardwareBufferProperties.memoryTypeBits, 0, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+    VkImportAndroidHardwareBufferInfoANDROID importInfo{
+        .sType = VK_STRUCTURE_TYPE_IMPORT_ANDROID_HARDWARE_BUFFER_INFO_ANDROID,
+        .pNext = nullptr,
+        .buffer = _hardwareBuffer,
+    };
+
+    VkMemoryDedicatedAllocateInfo dedicatedAllocateInfo{
+        .sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO,
+        .pNext = &importInfo,
+        .image = VK_NULL_HANDLE,
+        .buffer = _buffer,
+    };
+
+    VkMemoryAllocateInfo memoryAllocateInfo{
+        .sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+        .pNext = &dedicatedAllocateInfo,
+        .allocationSize = hardwareBufferProperties.allocationSize,
+        .memoryTypeIndex = memoryTypeIndex,
+    };
+
+    utils::checkVk(vkAllocateMemory(_device, &memoryAllocateInfo, nullptr, &_memory),
+                   "Failed to import the native resizer output AHardwareBuffer into Vulkan memory.");
+    utils::checkVk(vkBindBufferMemory(_device, _buffer, _memory, 0), "Failed to bind Vulkan memory to the native resizer output buffer.");
+
+    _allocationSize = hardwareBufferProperties.allocationSize;
+  } catch (...) {
+    destroy();
+    throw;
+  }
+}
+
+VulkanReusableBuffer::VulkanReusableBuffer(VkPhysicalDevice physicalDevice, VkDevice device, const VulkanDeviceDispatch& deviceDispatch,
+                                           uint32_t textureWidth, uint32_t textureHeight)
+    : VulkanReusableBuffer(physicalDevice, device, static_cast<size_t>(textureWidth) * textureHeight * 4) {
+  // The delegated constructor has finished, so `~VulkanReusableBuffer()` cleans up if anything below throws.
+  // GPU_SAMPLED_IMAGE is what Skia (and any other GL/Vulkan consumer) needs to sample the buffer as a texture.
+  AHardwareBuffer_Desc description{
+      .width = textureWidth,
+      .height = textureHeight,
+      .layers = 1,
+      .format = AHARDWAREBUFFER_FORMAT_R8G8B8A8_UNORM,
+      .usage = AHARDWAREBUFFER_USAGE_GPU_SAMPLED_IMAGE,
+      .stride = 0,
+      .rfu0 = 0,
+      .rfu1 = 0,
+  };
+  if (AHardwareBuffer_allocate(&description, &_hardwareBuffer) != 0 || _hardwareBuffer == nullptr) [[unlikely]] {
+    _hardwareBuffer = nullptr;
+    throw std::runtime_error("Failed to allocate the AHardwareBuffer for the texture resizer output.");
+  }
+
+  VkExternalMemoryImageCreateInfo externalMemoryImageCreateInfo{
+      .sType = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO,
+      .pNext = nullptr,
+      .handleTypes = VK_EXTERNAL_MEMORY_HANDLE_TYPE_ANDROID_HARDWARE_BUFFER_BIT_ANDROID,
+  };
+
+  // Only ever written by vkCmdCopyBufferToImage, which needs no AHardwareBuffer usage flag of its own.
+  VkImageCreateInfo imageCreateInfo{};
+  imageCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+  imageCreateInfo.pNext = &externalMemoryImageCreateInfo;
+  imageCreateInfo.imageType = VK_IMAGE_TYPE_2D;
+  imageCreateInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+  imageCreateInfo.extent = VkExtent3D{.width = textureWidth, .height = textureHeight, .depth = 1};
+  imageCreateInfo.mipLevels = 1;
+  imageCreateInfo.arrayLayers = 1;
+  imageCreateInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+  imageCreateInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+  imageCreateInfo.usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+  imageCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+  imageCreateInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+  utils::checkVk(vkCreateImage(_device, &imageCreateInfo, nullptr, &_image), "Failed to create the Vulkan image for the texture resizer output.");
+
+  VkAndroidHardwareBufferPropertiesANDROID hardwareBufferProperties{
+      .sType = VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_PROPERTIES_ANDROID,
+      .pNext = nullptr,
+      .allocationSize = 0,
+      .memoryTypeBits = 0,
+  };
+  utils::checkVk(deviceDispatch.getAndroidHardwareBufferPropertiesANDROID(_device, _hardwareBuffer, &hardwareBufferProperties),
+                 "Failed to query Vulkan properties for the texture resizer output AHardwareBuffer.");
+
+  const uint32_t memoryTypeIndex = findMemoryTypeIndex(physicalDevice, hardwareBufferProperties.memoryTypeBits, 0, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+  VkImportAndroidHardwareBufferInfoANDROID importInfo{
+      .sType = VK_STRUCTURE_TYPE_IMPORT_ANDROID_HARDWARE_BUFFER_INFO_ANDROID,
+      .pNext = nullptr,
+      .buffer = _hardwareBuffer,
+  };
+
+  VkMemoryDedicatedAllocateInfo dedicatedAllocateInfo{
+      .sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO,
+      .pNext = &importInfo,
+      .image = _image,
+      .buffer = VK_NULL_HANDLE,
+  };
+
+  VkMemoryAllocateInfo memoryAllocateInfo{
+      .sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+      .pNext = &dedicatedAllocateInfo,
+      .allocationSize = hardwareBufferProperties.allocationSize,
+      .memoryTypeIndex = memoryTypeIndex,
+  };
+
+  utils::checkVk(vkAllocateMemory(_device, &memoryAllocateInfo, nullptr, &_imageMemory),
+                 "Failed to import the texture resizer output AHardwareBuffer into Vulkan memory.");
+  utils::checkVk(vkBindImageMemory(_device, _image, _imageMemory, 0), "Failed to bind Vulkan memory to the texture resizer output image.");
+
+  _allocationSize += hardwareBufferProperties.allocationSize;
+}
+
+VulkanReusableBuffer::~VulkanReusableBuffer() {
+  destroy();
+}
+
+void VulkanReusableBuffer::destroy() noexcept {
+  if (_device != VK_NULL_HANDLE) {
     if (_mappedData != nullptr) {
       vkUnmapMemory(_device, _memory);
       _mappedData = nullptr;
     }
+    if (_buffer != VK_NULL_HANDLE) {
+      vkDestroyBuffer(_device, _buffer, nullptr);
+      _buffer = VK_NULL_HANDLE;
+    }
     if (_memory != VK_NULL_HANDLE) {
       vkFreeMemory(_device, _memory, nullptr);
       _memory = VK_NULL_HANDLE;
     }
-    if (_buffer != VK_NULL_HANDLE) {
-      vkDestroyBuffer(_device, _buffer, nullptr);
-      _buffer = VK_NULL_HANDLE;
+    if (_image != VK_NULL_HANDLE) {
+      vkDestroyImage(_device, _image, nullptr);
+      _image = VK_NULL_HANDLE;
+    }
+    if (_imageMemory != VK_NULL_HANDLE) {
+      vkFreeMemory(_device, _imageMemory, nullptr);
+      _imageMemory = VK_NULL_HANDLE;
     }
-    throw;
-  }
-}
-
-VulkanReusableBuffer::~VulkanReusableBuffer() {
-  if (_device == VK_NULL_HANDLE) {
-    // The device is already gone, so there is nothing left to free through Vulkan.
-    return;
-  }
-
-  if (_mappedData != nullptr) {
-    vkUnmapMemory(_device, _memory);
-    _mappedData = nullptr;
-  }
-  if (_buffer != VK_NULL_HANDLE) {
-    vkDestroyBuffer(_device, _buffer, nullptr);
-    _buffer = VK_NULL_HANDLE;
   }
-  if (_memory != VK_NULL_HANDLE) {
-    vkFreeMemory(_device, _memory, nullptr);
-    _memory = VK_NULL_HANDLE;
+  // The imported Vulkan memory holds its own reference, so this only drops ours. Consumers may still hold theirs.
+  if (_hardwareBuffer != nullptr) {
+    AHardwareBuffer_release(_hardwareBuffer);
+    _hardwareBuffer = nullptr;
   }
   _allocationSize = 0;
   _isHostCoherent = false;
 }
 
-std::shared_ptr<VulkanBufferView> VulkanReusableBuffer::acquireView(uint32_t width, uint32_t height, ChannelOrder channelOrder, DataType dataType,
-                                                                    PixelLayout pixelLayout, size_t byteCount) {
+std::shared_ptr<VulkanBufferView> VulkanReusableBuffer::tryAcquireView(uint32_t width, uint32_t height, std::vector<ResizeTransform> transforms, ChannelOrder channelOrder,
+                                                                       DataType dataType, PixelLayout pixelLayout, size_t byteCount,
+                                                                       std::shared_ptr<const void> deviceOwner) {
   std::lock_guard<std::mutex> lock(_stateMutex);
-  if (_isInUse) [[unlikely]] {
-    throw std::runtime_error("Previous GPUFrame is still active. Dispose it before calling resize() again.");
+  if (_isInUse) {
+    return nullptr;
   }
 
   _isInUse = true;
-  return std::make_shared<VulkanBufferView>(width, height, channelOrder, dataType, pixelLayout, _mappedData, byteCount, [this]() { releaseView(); });
+  // The buffer is dropped inside the callback, so if this was its last owner it is destroyed while `deviceOwner` still keeps the device alive.
+  return std::make_shared<VulkanBufferView>(width, height, std::move(transforms), channelOrder, dataType, pixelLayout, _mappedData, byteCount, _hardwareBuffer,
+                                            [buffer = shared_from_this(), deviceOwner = std::move(deviceOwner)]() mutable {
+                                              buffer->releaseView();
+                                              buffer = nullptr;
+                                            });
 }
 
 bool VulkanReusableBuffer::isInUse() const noexcept {
@@ -157,10 +333,18 @@ VkDeviceMemory VulkanReusableBuffer::getMemory() const noexcept {
   return _memory;
 }
 
+VkImage VulkanReusableBuffer::getImage() const noexcept {
+  return _image;
+}
+
 uint8_t* VulkanReusableBuffer::getMappedData() const noexcept {
   return _mappedData;
 }
 
+AHardwareBuffer* VulkanReusableBuffer::getHardwareBuffer() const noexcept {
+  return _hardwareBuffer;
+}
+
 size_t VulkanReusableBuffer::getAllocationSize() const noexcept {
   return _allocationSize;
 }
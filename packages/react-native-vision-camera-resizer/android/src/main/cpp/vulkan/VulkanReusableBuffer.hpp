@@ -9,12 +9,16 @@
 #include "ChannelOrder.hpp"
 #include "DataType.hpp"
 #include "PixelLayout.hpp"
+#include "ResizeTransform.hpp"
 #include "vulkan/VulkanBufferView.hpp"
+#include "vulkan/VulkanDynamicDispatch.hpp"
 
+#include <android/hardware_buffer.h>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include <vulkan/vulkan.h>
 
@@ -22,23 +26,39 @@ namespace margelo::nitro::camera::resizer::vulkan {
 
 /**
  * Owns the persistent Vulkan output allocation and enforces that only one live buffer view can hold it at a time.
+ * Must be owned by a `std::shared_ptr`, because every view keeps its buffer alive until it is released.
  */
-class VulkanReusableBuffer final {
+class VulkanReusableBuffer final : public std::enable_shared_from_this<VulkanReusableBuffer> {
 public:
   /**
    * Allocates and maps one host-visible Vulkan storage buffer for the resizer output.
    */
   VulkanReusableBuffer(VkPhysicalDevice physicalDevice, VkDevice device, size_t bufferSize);
+  /**
+   * Allocates one BLOB `AHardwareBuffer` and imports it as a Vulkan storage buffer, so the resizer output can be handed to
+   * other GPU consumers without ever being mapped into CPU memory.
+   */
+  VulkanReusableBuffer(VkPhysicalDevice physicalDevice, VkDevice device, const VulkanDeviceDispatch& deviceDispatch, size_t bufferSize);
+  /**
+   * Allocates one host-visible Vulkan storage buffer for a `textureWidth` x `textureHeight` RGBA8 output, plus one
+   * `AHARDWAREBUFFER_FORMAT_R8G8B8A8_UNORM` `AHardwareBuffer` imported as a Vulkan image that the output is copied into,
+   * so other GPU consumers (e.g. Skia) can sample it as a texture.
+   */
+  VulkanReusableBuffer(VkPhysicalDevice physicalDevice, VkDevice device, const VulkanDeviceDispatch& deviceDispatch, uint32_t textureWidth,
+                       uint32_t textureHeight);
   ~VulkanReusableBuffer();
 
   VulkanReusableBuffer(const VulkanReusableBuffer&) = delete;
   VulkanReusableBuffer& operator=(const VulkanReusableBuffer&) = delete;
 
   /**
-   * Returns one live view over the reusable Vulkan output allocation.
+   * Returns one live view over the reusable Vulkan output allocation, or `nullptr` if a previous view is still alive.
+   * The view keeps this buffer and `deviceOwner` (the owner of the `VkDevice` it was allocated on) alive until it is released,
+   * so a view (or a native buffer lease holding it) may outlive the pipeline that produced it.
    */
-  [[nodiscard]] std::shared_ptr<VulkanBufferView> acquireView(uint32_t width, uint32_t height, ChannelOrder channelOrder, DataType dataType,
-                                                              PixelLayout pixelLayout, size_t byteCount);
+  [[nodiscard]] std::shared_ptr<VulkanBufferView> tryAcquireView(uint32_t width, uint32_t height, std::vector<ResizeTransform> transforms, ChannelOrder channelOrder,
+                                                                 DataType dataType, PixelLayout pixelLayout, size_t byteCount,
+                                                                 std::shared_ptr<const void> deviceOwner);
   /**
    * Finds a compatible Vulkan memory type for the reusable output allocation or imported hardware buffers.
    */
@@ -50,19 +70,31 @@ public:
   [[nodiscard]] bool isInUse() const noexcept;
   [[nodiscard]] VkBuffer getBuffer() const noexcept;
   [[nodiscard]] VkDeviceMemory getMemory() const noexcept;
+  /**
+   * Returns the Vulkan image imported from the texture `AHardwareBuffer`, or `VK_NULL_HANDLE` if this is not a texture output.
+   */
+  [[nodiscard]] VkImage getImage() const noexcept;
   [[nodiscard]] uint8_t* getMappedData() const noexcept;
+  /**
+   * Returns the `AHardwareBuffer` backing this allocation (or its texture), or `nullptr` if it is a mapped host-visible buffer only.
+   */
+  [[nodiscard]] AHardwareBuffer* getHardwareBuffer() const noexcept;
   [[nodiscard]] size_t getAllocationSize() const noexcept;
   [[nodiscard]] bool isHostCoherent() const noexcept;
 
 private:
   void releaseView() noexcept;
+  void destroy() noexcept;
 
 private:
   mutable std::mutex _stateMutex;
   VkDevice _device{VK_NULL_HANDLE};
   VkBuffer _buffer{VK_NULL_HANDLE};
   VkDeviceMemory _memory{VK_NULL_HANDLE};
+  VkImage _image{VK_NULL_HANDLE};
+  VkDeviceMemory _imageMemory{VK_NULL_HANDLE};
   uint8_t* _mappedData{nullptr};
+  AHardwareBuffer* _hardwareBuffer{nullptr};
   size_t _allocationSize{0};
   bool _isHostCoherent{false};
   bool _isInUse{false};
@@ -0,0 +1,189 @@
+///
+/// VulkanWorkgroupSizeCalibration.cpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#include "vulkan/VulkanWorkgroupSizeCalibration.hpp"
+
+#include "ResizerOptions.hpp"
+#include "vulkan/VulkanResizerPipeline.hpp"
+#include "vulkan/VulkanResizerProfiler.hpp"
+
+#include <android/hardware_buffer.h>
+#include <android/log.h>
+#include <array>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace margelo::nitro::camera::resizer::vulkan {
+
+namespace {
+
+  constexpr auto kLogTag = "VisionCameraResizer";
+  // Every candidate has 64 invocations, which fits the minimum `maxComputeWorkGroupInvocations` (128) of every Vulkan device.
+  constexpr std::array<VulkanPipelineCache::WorkgroupSize, 4> kCandidateWorkgroupSizes = {
+      VulkanPipelineCache::WorkgroupSize{.x = 8, .y = 8},
+      VulkanPipelineCache::WorkgroupSize{.x = 16, .y = 4},
+      VulkanPipelineCache::WorkgroupSize{.x = 32, .y = 2},
+      VulkanPipelineCache::WorkgroupSize{.x = 64, .y = 1},
+  };
+  // A typical camera stream resized into a typical model input, so the winner reflects real workloads.
+  constexpr uint32_t kInputWidth = 1920;
+  constexpr uint32_t kInputHeight = 1080;
+  constexpr double kOutputSize = 640;
+  // Timed runs per candidate. Pipeline creation happens before the first submission, so it never lands in the GPU timings.
+  constexpr size_t kIterationCount = 12;
+
+  std::once_flag calibrationOnceFlag;
+
+  /**
+   * Owns the synthetic input buffer of a calibration.
+   */
+  class SyntheticInputBuffer final {
+  public:
+    SyntheticInputBuffer() {
+      const AHardwareBuffer_Desc description{
+          .width = kInputWidth,
+          .height = kInputHeight,
+          .layers = 1,
+          .format = AHARDWAREBUFFER_FORMAT_Y8Cb8Cr8_420,
+          .usage = AHARDWAREBUFFER_USAGE_GPU_SAMPLED_IMAGE,
+          .stride = 0,
+          .rfu0 = 0,
+          .rfu1 = 0,
+      };
+      if (AHardwareBuffer_allocate(&description, &_hardwareBuffer) != 0 || _hardwareBuffer == nullptr) [[unlikely]] {
+        throw std::runtime_error("Failed to allocate the synthetic input AHardwareBuffer for the workgroup size calibration.");
+      }
+    }
+    ~SyntheticInputBuffer() {
+      if (_hardwareBuffer != nullptr) {
+        AHardwareBuffer_release(_hardwareBuffer);
+      }
+    }
+
+    SyntheticInputBuffer(const SyntheticInputBuffer&) = delete;
+    SyntheticInputBuffer& operator=(const SyntheticInputBuffer&) = delete;
+
+    [[nodiscard]] AHardwareBuffer* get() const noexcept {
+      return _hardwareBuffer;
+    }
+
+  private:
+    AHardwareBuffer* _hardwareBuffer{nullptr};
+  };
+
+  ResizerOptions makeCalibrationOptions() {
+    ResizerOptions options{};
+    options.width = kOutputSize;
+    options.height = kOutputSize;
+    options.channelOrder = ChannelOrder::RGB;
+    options.dataType = DataType::UINT8;
+    options.scaleMode = ScaleMode::COVER;
+    options.pixelLayout = PixelLayout::INTERLEAVED;
+    options.enableProfiling = true;
+    return options;
+  }
+
+  std::vector<VulkanPipelineCache::WorkgroupSize> getCandidateWorkgroupSizes(VulkanContext& context) {
+    std::vector<VulkanPipelineCache::WorkgroupSize> candidates(kCandidateWorkgroupSizes.begin(), kCandidateWorkgroupSizes.end());
+
+    // GPUs that execute wider subgroups than 64 (e.g. Adreno's 128-wide waves) leave lanes idle with 64 invocations, so also try one full subgroup per row.
+    VkPhysicalDeviceSubgroupProperties subgroupProperties{};
+    subgroupProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES;
+
+    VkPhysicalDeviceProperties2 properties2{
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2,
+        .pNext = &subgroupProperties,
+        .properties = {},
+    };
+    context.getInstanceDispatch().getPhysicalDeviceProperties2(context.getPhysicalDevice(), &properties2);
+    const VulkanPipelineCache::WorkgroupSize subgroupRow{.x = subgroupProperties.subgroupSize, .y = 1};
+    if (subgroupProperties.subgroupSize > 64 && isSupportedWorkgroupSize(context.getPhysicalDevice(), subgroupRow)) {
+      candidates.push_back(subgroupRow);
+    }
+    return candidates;
+  }
+
+  /**
+   * Returns the median time of one dispatch with `workgroupSize`, in GPU time if the queue supports timestamps and in CPU wait time otherwise.
+   */
+  double measureWorkgroupSize(const std::shared_ptr<VulkanContext>& context, const SyntheticInputBuffer& input,
+                              const VulkanPipelineCache::WorkgroupSize& workgroupSize) {
+    VulkanResizerPipeline pipeline(context, {makeCalibrationOptions()}, workgroupSize);
+    for (size_t iteration = 0; iteration < kIterationCount; iteration++) {
+      // Drop the output views right away, the next run reuses their buffers.
+      (void)pipeline.run(input.get(), 0, false, std::nullopt);
+    }
+
+    const std::optional<VulkanResizerProfiler::Statistics> statistics = pipeline.getTimingStatistics();
+    if (!statistics.has_value()) [[unlikely]] {
+      throw std::runtime_error("The workgroup size calibration pipeline did not collect any timings.");
+    }
+    const auto& gpuDispatch = statistics->get(VulkanResizerProfiler::Stage::GPU_DISPATCH);
+    if (gpuDispatch.sampleCount > 0) {
+      return gpuDispatch.p50;
+    }
+    return statistics->get(VulkanResizerProfiler::Stage::WAIT).p50;
+  }
+
+  VulkanPipelineCache::WorkgroupSize calibrateWorkgroupSize(const std::shared_ptr<VulkanContext>& context) {
+    const SyntheticInputBuffer input;
+    VulkanPipelineCache::WorkgroupSize fastestWorkgroupSize{};
+    double fastestTime = std::numeric_limits<double>::max();
+    for (const VulkanPipelineCache::WorkgroupSize& workgroupSize : getCandidateWorkgroupSizes(*context)) {
+      const double time = measureWorkgroupSize(context, input, workgroupSize);
+      __android_log_print(ANDROID_LOG_DEBUG, kLogTag, "Workgroup size %ux%u took %.3f ms per dispatch.", workgroupSize.x, workgroupSize.y, time);
+      if (time < fastestTime) {
+        fastestTime = time;
+        fastestWorkgroupSize = workgroupSize;
+      }
+    }
+    return fastestWorkgroupSize;
+  }
+
+} // namespace
+
+bool isSupportedWorkgroupSize(VkPhysicalDevice physicalDevice, const VulkanPipelineCache::WorkgroupSize& workgroupSize) {
+  if (workgroupSize.x == 0 || workgroupSize.y == 0) {
+    return false;
+  }
+  VkPhysicalDeviceProperties properties{};
+  vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+  return workgroupSize.x <= properties.limits.maxComputeWorkGroupSize[0] && workgroupSize.y <= properties.limits.maxComputeWorkGroupSize[1] &&
+         static_cast<uint64_t>(workgroupSize.x) * workgroupSize.y <= properties.limits.maxComputeWorkGroupInvocations;
+}
+
+VulkanPipelineCache::WorkgroupSize getPersistedWorkgroupSize(VulkanContext& context) {
+  const std::optional<VulkanPipelineCache::WorkgroupSize> workgroupSize = context.getPipelineCache().getWorkgroupSize();
+  // A size from a damaged file (or a different shader version that slipped through) must never reach `vkCmdDispatch`.
+  if (workgroupSize.has_value() && isSupportedWorkgroupSize(context.getPhysicalDevice(), *workgroupSize)) {
+    return *workgroupSize;
+  }
+  return VulkanPipelineCache::WorkgroupSize{};
+}
+
+void calibrateWorkgroupSizeIfNeeded(const std::shared_ptr<VulkanContext>& context) noexcept {
+  // Concurrent callers wait for the first calibration, so every pipeline they build afterwards already uses its result.
+  std::call_once(calibrationOnceFlag, [&context]() noexcept {
+    const std::optional<VulkanPipelineCache::WorkgroupSize> persistedWorkgroupSize = context->getPipelineCache().getWorkgroupSize();
+    if (persistedWorkgroupSize.has_value() && isSupportedWorkgroupSize(context->getPhysicalDevice(), *persistedWorkgroupSize)) {
+      return;
+    }
+
+    try {
+      const VulkanPipelineCache::WorkgroupSize workgroupSize = calibrateWorkgroupSize(context);
+      __android_log_print(ANDROID_LOG_INFO, kLogTag, "Calibrated the Resizer workgroup size to %ux%u.", workgroupSize.x, workgroupSize.y);
+      context->getPipelineCache().rememberWorkgroupSize(workgroupSize);
+      context->getPipelineCache().saveIfNeeded();
+    } catch (const std::exception& error) {
+      __android_log_print(ANDROID_LOG_WARN, kLogTag, "Failed to calibrate the Resizer workgroup size, using the default: %s", error.what());
+    }
+  });
+}
+
+} // namespace margelo::nitro::camera::resizer::vulkan
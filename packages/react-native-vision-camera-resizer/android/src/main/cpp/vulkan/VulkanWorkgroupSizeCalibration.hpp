@@ -0,0 +1,39 @@
+///
+/// VulkanWorkgroupSizeCalibration.hpp
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include "vulkan/VulkanContext.hpp"
+#include "vulkan/VulkanPipelineCache.hpp"
+
+#include <memory>
+
+#include <vulkan/vulkan.h>
+
+namespace margelo::nitro::camera::resizer::vulkan {
+
+/**
+ * Returns whether the resizer compute shader can run with `workgroupSize` on `physicalDevice`.
+ */
+[[nodiscard]] bool isSupportedWorkgroupSize(VkPhysicalDevice physicalDevice, const VulkanPipelineCache::WorkgroupSize& workgroupSize);
+
+/**
+ * Returns the workgroup size calibrated for this device on this or a previous launch, or the default 8x8 if it was never calibrated.
+ */
+[[nodiscard]] VulkanPipelineCache::WorkgroupSize getPersistedWorkgroupSize(VulkanContext& context);
+
+/**
+ * Times the resizer compute shader with every candidate workgroup size (8x8, 16x4, 32x2, 64x1, plus one row of a full subgroup on
+ * GPUs with subgroups wider than 64) on a synthetic camera-sized input, and persists the fastest one in the context's pipeline cache.
+ *
+ * Only runs once per device: if a size was already calibrated (on this or a previous launch), this returns right away.
+ * Otherwise this blocks until the calibration is done, so call it off the frame and JS threads.
+ * The candidate pipelines are built without the pipeline cache and never persist anything but the winning size.
+ * Calibration failures are logged and ignored, pipelines then keep using the default 8x8.
+ */
+void calibrateWorkgroupSizeIfNeeded(const std::shared_ptr<VulkanContext>& context) noexcept;
+
+} // namespace margelo::nitro::camera::resizer::vulkan
@@ -0,0 +1,24 @@
+package com.margelo.nitro.camera.resizer
+
+import androidx.annotation.Keep
+import com.facebook.proguard.annotations.DoNotStrip
+import com.margelo.nitro.NitroModules
+
+/**
+ * Exposes the app cache directory to native code that persists GPU pipeline caches.
+ */
+@Keep
+@DoNotStrip
+class CacheDirectoryFactory private constructor() {
+  companion object {
+    @Keep
+    @DoNotStrip
+    @JvmStatic
+    fun getCacheDirectory(): String {
+      val context =
+        NitroModules.applicationContext
+          ?: throw IllegalStateException("NitroModules.applicationContext is null. CacheDirectoryFactory cannot resolve the cache directory.")
+      return context.cacheDir.absolutePath
+    }
+  }
+}
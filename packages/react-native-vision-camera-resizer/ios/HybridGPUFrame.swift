@@ -5,7 +5,10 @@
 //  Created by Marc Rousavy on 29.10.25.
 //
 
+import CoreVideo
+import Foundation
 import NitroModules
+import VisionCamera
 
 /// JS-facing wrapper around one live Metal output-buffer view, zero-copy.
 final class HybridGPUFrame: HybridGPUFrameSpec {
@@ -30,6 +33,13 @@ final class HybridGPUFrame: HybridGPUFrameSpec {
     return Double(outputBufferView.height)
   }
 
+  var batchSize: Double {
+    guard let outputBufferView else {
+      return 0.0
+    }
+    return Double(outputBufferView.batchSize)
+  }
+
   var channelOrder: ChannelOrder? {
     return outputBufferView?.channelOrder
   }
@@ -42,6 +52,10 @@ final class HybridGPUFrame: HybridGPUFrameSpec {
     return outputBufferView?.pixelLayout
   }
 
+  var frameStatistics: FrameStatistics? {
+    return outputBufferView?.frameStatistics
+  }
+
   var memorySize: Int {
     return outputBufferView?.buffer.length ?? 0
   }
@@ -55,7 +69,7 @@ final class HybridGPUFrame: HybridGPUFrameSpec {
       throw RuntimeError.error(withMessage: "This GPUFrame has already been disposed!")
     }
     let pointer = outputBufferView.buffer.contents()
-    let size = outputBufferView.buffer.length
+    let size = outputBufferView.byteCount
 
     return ArrayBuffer.wrap(
       dataWithoutCopy: pointer,
@@ -65,4 +79,87 @@ final class HybridGPUFrame: HybridGPUFrameSpec {
       }
     )
   }
+
+  func getNativeBuffer() throws -> NativeBuffer {
+    guard let outputBufferView else {
+      throw RuntimeError.error(withMessage: "This GPUFrame has already been disposed!")
+    }
+    guard let textureOutput = outputBufferView.textureOutput else {
+      throw RuntimeError.error(
+        withMessage:
+          "This GPUFrame is stored in CPU memory - create the Resizer with `outputBufferType: 'texture'` to use getNativeBuffer().")
+    }
+    // The lease outlives dispose(), so the Resizer cannot write into this output buffer again until the consumer releases it.
+    let lease = NativeBufferLease(outputBufferView: outputBufferView, pixelBuffer: textureOutput.pixelBuffer)
+    return NativeBuffer(
+      pointer: lease.pointer,
+      release: { lease.release() })
+  }
+
+  func getTransform(batchIndex: Double?) throws -> ResizeTransform {
+    return try transform(at: batchIndex)
+  }
+
+  func convertOutputPointsToFramePoints(points: ArrayBuffer, batchIndex: Double?) throws {
+    let transform = try transform(at: batchIndex)
+    let pairSize = MemoryLayout<Float>.size * 2
+    guard points.size % pairSize == 0 else {
+      throw RuntimeError.error(
+        withMessage:
+          "Points ArrayBuffer must contain interleaved float32 x, y pairs, but it is \(points.size) bytes large."
+      )
+    }
+    let data = UnsafeMutableRawPointer(points.data)
+    guard Int(bitPattern: data) % MemoryLayout<Float>.alignment == 0 else {
+      throw RuntimeError.error(
+        withMessage:
+          "Points ArrayBuffer is not aligned to 4 bytes - pass a Float32Array's underlying buffer.")
+    }
+    transform.convertOutputPointsToFramePoints(
+      data.assumingMemoryBound(to: Float.self), pointCount: points.size / pairSize)
+  }
+
+  private func transform(at batchIndex: Double?) throws -> ResizeTransform {
+    guard let outputBufferView else {
+      throw RuntimeError.error(withMessage: "This GPUFrame has already been disposed!")
+    }
+    let transforms = outputBufferView.transforms
+    let index = batchIndex ?? 0
+    // NaN fails every comparison, so this also rejects non-finite indices.
+    guard index >= 0, index < Double(transforms.count), index.rounded(.down) == index else {
+      throw RuntimeError.error(
+        withMessage:
+          "Batch index \(index) is out of range for a GPUFrame with a batchSize of \(transforms.count).")
+    }
+    return transforms[Int(index)]
+  }
+}
+
+/// Keeps a texture output checked out, and its `CVPixelBuffer` retained, until the consumer releases it.
+/// Releasing is idempotent, and also happens if the `NativeBuffer` is garbage-collected without being released.
+private final class NativeBufferLease {
+  private let lock = NSLock()
+  private var outputBufferView: MetalBufferView?
+  private let rawPointer: UnsafeMutableRawPointer
+  let pointer: UInt64
+
+  init(outputBufferView: MetalBufferView, pixelBuffer: CVPixelBuffer) {
+    self.outputBufferView = outputBufferView
+    self.rawPointer = Unmanaged.passRetained(pixelBuffer).toOpaque()  // +1 retain
+    self.pointer = UInt64(UInt(bitPattern: rawPointer))
+  }
+
+  deinit {
+    release()
+  }
+
+  func release() {
+    lock.lock()
+    defer { lock.unlock() }
+    guard outputBufferView != nil else {
+      return
+    }
+    Unmanaged<CVPixelBuffer>.fromOpaque(rawPointer).release()  // -1 retain
+    outputBufferView = nil
+  }
 }
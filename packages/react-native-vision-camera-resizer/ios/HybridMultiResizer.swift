@@ -0,0 +1,74 @@
+//
+//  HybridMultiResizer.swift
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 12.03.26.
+//
+
+import CoreVideo
+import NitroModules
+import VisionCamera
+
+/// iOS resizer that turns one camera frame into several GPU-backed JS-visible output frames with a single command buffer.
+final class HybridMultiResizer: HybridMultiResizerSpec {
+  private var pipeline: MetalResizerPipeline?
+
+  init(options: [ResizerOptions]) throws {
+    self.pipeline = try MetalResizerPipeline(targets: options)
+    super.init()
+  }
+
+  var memorySize: Int {
+    return pipeline?.allocatedByteCount ?? 0
+  }
+
+  func dispose() {
+    pipeline = nil
+  }
+
+  func resize(frame: any HybridFrameSpec, options: ResizeOptions?) throws -> [any HybridGPUFrameSpec] {
+    guard let pipeline else {
+      throw RuntimeError.error(withMessage: "This MultiResizer has already been disposed!")
+    }
+    let pixelBuffer = try frame.getPixelBuffer()
+    let outputBufferViews = try pipeline.run(
+      pixelBuffer: pixelBuffer,
+      rotationDegrees: frame.orientation.shaderRotationDegrees,
+      isMirrored: frame.isMirrored,
+      options: options)
+
+    return outputBufferViews.map { HybridGPUFrame(outputBufferView: $0) }
+  }
+
+  func resizeAsync(frame: any HybridFrameSpec, options: ResizeOptions?) throws -> Promise<[any HybridGPUFrameSpec]> {
+    guard let pipeline else {
+      throw RuntimeError.error(withMessage: "This MultiResizer has already been disposed!")
+    }
+    let pixelBuffer = try frame.getPixelBuffer()
+
+    // Encode and commit synchronously, then resolve from Metal's completion handler.
+    let promise = Promise<[any HybridGPUFrameSpec]>()
+    try pipeline.runAsync(
+      pixelBuffer: pixelBuffer,
+      rotationDegrees: frame.orientation.shaderRotationDegrees,
+      isMirrored: frame.isMirrored,
+      options: options
+    ) { result in
+      switch result {
+      case .success(let outputBufferViews):
+        promise.resolve(withResult: outputBufferViews.map { HybridGPUFrame(outputBufferView: $0) })
+      case .failure(let error):
+        promise.reject(withError: error)
+      }
+    }
+    return promise
+  }
+
+  func getStatistics() throws -> ResizerStatistics {
+    guard pipeline != nil else {
+      throw RuntimeError.error(withMessage: "This MultiResizer has already been disposed!")
+    }
+    // Same as `HybridResizer` - there are no import cache statistics or timings on Metal.
+    return ResizerStatistics(importCache: nil, timings: nil)
+  }
+}
@@ -20,44 +20,77 @@ final class HybridResizer: HybridResizerSpec {
   }
 
   var memorySize: Int {
-    return pipeline?.outputByteCount ?? 0
+    return pipeline?.allocatedByteCount ?? 0
   }
 
   func dispose() {
     pipeline = nil
   }
 
-  func resize(frame: any HybridFrameSpec) throws -> any HybridGPUFrameSpec {
+  func resize(frame: any HybridFrameSpec, options: ResizeOptions?) throws -> any HybridGPUFrameSpec {
     guard let pipeline else {
       throw RuntimeError.error(withMessage: "This Resizer has already been disposed!")
     }
-    let sampleBuffer = try sampleBuffer(from: frame)
-    let pixelBuffer = try pixelBuffer(from: sampleBuffer)
+    let pixelBuffer = try frame.getPixelBuffer()
     let rotationDegrees = frame.orientation.shaderRotationDegrees
     let isMirrored = frame.isMirrored
-    let outputBufferView = try pipeline.run(
+    let outputBufferViews = try pipeline.run(
       pixelBuffer: pixelBuffer,
       rotationDegrees: rotationDegrees,
-      isMirrored: isMirrored)
+      isMirrored: isMirrored,
+      options: options)
 
-    return HybridGPUFrame(outputBufferView: outputBufferView)
+    return HybridGPUFrame(outputBufferView: outputBufferViews[0])
   }
 
-  private func sampleBuffer(from frame: any HybridFrameSpec) throws -> CMSampleBuffer {
-    guard let nativeFrame = frame as? any NativeFrame else {
-      throw RuntimeError.error(withMessage: "The given Frame is not of type `NativeFrame`!")
+  func resizeBatch(frame: any HybridFrameSpec, regions: [Rect]) throws -> any HybridGPUFrameSpec {
+    guard let pipeline else {
+      throw RuntimeError.error(withMessage: "This Resizer has already been disposed!")
+    }
+    let pixelBuffer = try frame.getPixelBuffer()
+    let rotationDegrees = frame.orientation.shaderRotationDegrees
+    let isMirrored = frame.isMirrored
+    let outputBufferViews = try pipeline.runBatch(
+      pixelBuffer: pixelBuffer,
+      rotationDegrees: rotationDegrees,
+      isMirrored: isMirrored,
+      regions: regions)
+
+    return HybridGPUFrame(outputBufferView: outputBufferViews[0])
+  }
+
+  func resizeAsync(frame: any HybridFrameSpec, options: ResizeOptions?) throws -> Promise<any HybridGPUFrameSpec> {
+    guard let pipeline else {
+      throw RuntimeError.error(withMessage: "This Resizer has already been disposed!")
     }
-    guard let sampleBuffer = nativeFrame.sampleBuffer else {
-      throw RuntimeError.error(withMessage: "The given Frame's `sampleBuffer` is no longer valid!")
+    let pixelBuffer = try frame.getPixelBuffer()
+    let rotationDegrees = frame.orientation.shaderRotationDegrees
+    let isMirrored = frame.isMirrored
+
+    // Encode and commit synchronously, then resolve from Metal's completion handler.
+    let promise = Promise<any HybridGPUFrameSpec>()
+    try pipeline.runAsync(
+      pixelBuffer: pixelBuffer,
+      rotationDegrees: rotationDegrees,
+      isMirrored: isMirrored,
+      options: options
+    ) { result in
+      switch result {
+      case .success(let outputBufferViews):
+        promise.resolve(withResult: HybridGPUFrame(outputBufferView: outputBufferViews[0]))
+      case .failure(let error):
+        promise.reject(withError: error)
+      }
     }
-    return sampleBuffer
+    return promise
   }
 
-  private func pixelBuffer(from sampleBuffer: CMSampleBuffer) throws -> CVPixelBuffer {
-    guard let pixelBuffer = CMSampleBufferGetImageBuffer(sampleBuffer) else {
-      throw RuntimeError.error(
-        withMessage: "The given Frame does not contain a valid image buffer!")
+  func getStatistics() throws -> ResizerStatistics {
+    guard pipeline != nil else {
+      throw RuntimeError.error(withMessage: "This Resizer has already been disposed!")
     }
-    return pixelBuffer
+    // CVMetalTextureCache manages texture re-use internally and does not expose any statistics,
+    // and profiling is not implemented for Metal yet.
+    return ResizerStatistics(importCache: nil, timings: nil)
   }
 }
@@ -20,4 +20,29 @@ class HybridResizerFactory: HybridResizerFactorySpec {
       return try HybridResizer(options: options)
     }
   }
+
+  func createMultiResizer(options: [ResizerOptions]) throws -> Promise<any HybridMultiResizerSpec> {
+    guard !options.isEmpty else {
+      throw RuntimeError.error(withMessage: "createMultiResizer() requires at least one ResizerOptions.")
+    }
+    return Promise.async {
+      // Compiles one pipeline state per output asynchronously
+      return try HybridMultiResizer(options: options)
+    }
+  }
+
+  func prewarm(options: [ResizerOptions]) throws -> Promise<Void> {
+    return Promise.async {
+      // Metal persists compiled pipeline variants in its system shader cache,
+      // so compiling each variant once ahead of time is enough.
+      guard let device = MTLCreateSystemDefaultDevice() else {
+        throw RuntimeError.error(
+          withMessage: "Failed to initialize Metal - no MTLDevice is available.")
+      }
+      for resizerOptions in options {
+        _ = try MetalResizerShaderLibrary.createPipelineState(
+          device: device, options: resizerOptions)
+      }
+    }
+  }
 }
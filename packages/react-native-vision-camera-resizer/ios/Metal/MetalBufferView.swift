@@ -11,31 +11,54 @@ import Metal
 final class MetalBufferView {
   let width: Int
   let height: Int
+  /// Where each image of the batch came from in the input, in batch order.
+  let transforms: [ResizeTransform]
   let channelOrder: ChannelOrder
   let dataType: DataType
   let pixelLayout: PixelLayout
   let buffer: MTLBuffer
+  /// The per-cell luma sums the kernel accumulates into, if frame statistics are enabled.
+  let statisticsBuffer: MTLBuffer?
+  /// The `CVPixelBuffer` the output is copied into, if this is a `'texture'` output.
+  let textureOutput: MetalTextureOutput?
+  /// The number of bytes of `buffer` holding this view's images. The buffer itself may be larger.
+  let byteCount: Int
+  /// The statistics of the first image, set once the GPU has finished writing `statisticsBuffer`.
+  var frameStatistics: FrameStatistics?
 
   private let onRelease: () -> Void
 
   init(
     width: Int,
     height: Int,
+    transforms: [ResizeTransform],
     channelOrder: ChannelOrder,
     dataType: DataType,
     pixelLayout: PixelLayout,
     buffer: MTLBuffer,
+    statisticsBuffer: MTLBuffer?,
+    textureOutput: MetalTextureOutput?,
+    byteCount: Int,
     onRelease: @escaping () -> Void
   ) {
     self.width = width
     self.height = height
+    self.transforms = transforms
     self.channelOrder = channelOrder
     self.dataType = dataType
     self.pixelLayout = pixelLayout
     self.buffer = buffer
+    self.statisticsBuffer = statisticsBuffer
+    self.textureOutput = textureOutput
+    self.byteCount = byteCount
     self.onRelease = onRelease
   }
 
+  /// The number of images stored back-to-back in `buffer`.
+  var batchSize: Int {
+    return transforms.count
+  }
+
   deinit {
     onRelease()
   }
@@ -9,19 +9,78 @@ import CoreVideo
 import Metal
 import NitroModules
 
-/// Owns the Metal runtime objects needed to run the resize kernel for one fixed output layout.
+/// Owns the Metal runtime objects needed to run the resize kernel for one or more fixed output layouts.
+/// All targets share the input textures and one command buffer per Frame, each with its own pipeline state and output ring.
 final class MetalResizerPipeline {
-  private let options: ResizerOptions
+  private static let maxOutputBufferCount = 8
+  private static let maxBatchSizeLimit = 64
+
+  /// The per-output state of one `ResizerOptions`.
+  private final class Target {
+    let options: ResizerOptions
+    let pipelineState: MTLComputePipelineState
+    let threadsPerThreadgroup: MTLSize
+    /// The largest size a single `resize(...)` may request, which every output buffer can grow to.
+    let maxOutputSize: OutputSize
+    let outputBuffers: [MetalReusableBuffer]
+    var nextOutputBufferIndex = 0
+    /// The thumbnail of the last finished frame, which `FrameStatistics.motion` is measured against.
+    var previousThumbnail: [Double]?
+
+    init(
+      options: ResizerOptions,
+      pipelineState: MTLComputePipelineState,
+      threadsPerThreadgroup: MTLSize,
+      maxOutputSize: OutputSize,
+      outputBuffers: [MetalReusableBuffer]
+    ) {
+      self.options = options
+      self.pipelineState = pipelineState
+      self.threadsPerThreadgroup = threadsPerThreadgroup
+      self.maxOutputSize = maxOutputSize
+      self.outputBuffers = outputBuffers
+    }
+
+    /// The byte count of one `size` large output image of this target.
+    /// `pixelLayout` only changes how channel values are arranged in memory, not how many are stored.
+    func outputImageByteCount(size: OutputSize) -> Int {
+      return options.channelOrder.getOutputTotalByteCount(
+        dataType: options.dataType,
+        width: size.width,
+        height: size.height)
+    }
+  }
+
   private let commandQueue: MTLCommandQueue
   private let textureCache: CVMetalTextureCache
-  private let pipelineState: MTLComputePipelineState
-  private let threadsPerThreadgroup: MTLSize
-  private let outputBuffer: MetalReusableBuffer
+  private let targets: [Target]
+  private let maxBatchSize: Int
+  private let stateLock = NSLock()
+
+  /**
+   * Builds the Metal pipeline for one output layout.
+   * Its output buffers start at the configured size and grow on demand, up to `maxWidth` x `maxHeight`.
+   */
+  convenience init(options: ResizerOptions) throws {
+    try self.init(targets: [options])
+  }
 
   /**
-   * Builds the Metal pipeline for one fixed output size and output layout.
+   * Builds the Metal pipeline for several fixed output sizes and output layouts, that are all resized from the same input.
+   * Batches are limited to the smallest `maxBatchSize` of all targets.
    */
-  init(options: ResizerOptions) throws {
+  init(targets targetOptions: [ResizerOptions]) throws {
+    guard !targetOptions.isEmpty else {
+      throw RuntimeError.error(withMessage: "MetalResizerPipeline requires at least one ResizerOptions.")
+    }
+    if targetOptions.contains(where: { $0.outputBufferType == .native }) {
+      throw RuntimeError.error(
+        withMessage:
+          "ResizerOptions.outputBufferType 'native' is currently only supported on Android - use 'texture' to get a CVPixelBuffer instead.")
+    }
+    for options in targetOptions {
+      try options.validateTextureOutput()
+    }
     guard let device = MTLCreateSystemDefaultDevice() else {
       throw RuntimeError.error(
         withMessage: "Failed to initialize Metal - no MTLDevice is available.")
@@ -30,17 +89,6 @@ final class MetalResizerPipeline {
       throw RuntimeError.error(withMessage: "Failed to initialize Metal command queue.")
     }
 
-    let outputWidth = Int(options.width)
-    let outputHeight = Int(options.height)
-    // `pixelLayout` only changes how channel values are arranged in memory, not how many are stored.
-    let outputBufferLength = options.channelOrder.getOutputTotalByteCount(
-      dataType: options.dataType,
-      width: outputWidth,
-      height: outputHeight)
-    let pipelineState = try MetalResizerShaderLibrary.createPipelineState(
-      device: device, options: options)
-    let threadsPerThreadgroup = MetalResizerShaderLibrary.optimalThreadgroupSize(for: pipelineState)
-
     var textureCache: CVMetalTextureCache?
     let cacheStatus = CVMetalTextureCacheCreate(
       kCFAllocatorDefault, nil, device, nil, &textureCache)
@@ -49,39 +97,82 @@ final class MetalResizerPipeline {
         withMessage: "Failed to create CVMetalTextureCache (status \(cacheStatus)).")
     }
 
-    let outputBuffer = try MetalReusableBuffer(device: device, bufferLength: outputBufferLength)
+    // Every output buffer is sized for the largest batch, so any batch can be written into any buffer.
+    let maxBatchSize = try targetOptions.map { try Self.maxBatchSize(for: $0) }.min() ?? 1
+    let targets = try targetOptions.map { options in
+      // Start at the configured size, most Resizers never request a larger one.
+      let maxOutputSize = try options.maxOutputSize()
+      let outputBufferLength =
+        options.channelOrder.getOutputTotalByteCount(
+          dataType: options.dataType,
+          width: options.outputSize.width,
+          height: options.outputSize.height) * maxBatchSize
+      let pipelineState = try MetalResizerShaderLibrary.createPipelineState(
+        device: device, options: options)
+      let outputBufferCount = try Self.outputBufferCount(for: options)
+      let statisticsBufferLength =
+        options.enableFrameStatistics == true
+        ? FrameStatistics.cellCount * MemoryLayout<UInt32>.stride : 0
+      let outputBuffers = try (0..<outputBufferCount).map { _ in
+        try MetalReusableBuffer(
+          device: device,
+          bufferLength: outputBufferLength,
+          statisticsBufferLength: statisticsBufferLength,
+          textureSize: options.isTextureOutput ? options.outputSize : nil)
+      }
+      return Target(
+        options: options,
+        pipelineState: pipelineState,
+        threadsPerThreadgroup: MetalResizerShaderLibrary.optimalThreadgroupSize(for: pipelineState),
+        maxOutputSize: maxOutputSize,
+        outputBuffers: outputBuffers)
+    }
 
-    self.options = options
     self.commandQueue = commandQueue
     self.textureCache = textureCache
-    self.pipelineState = pipelineState
-    self.threadsPerThreadgroup = threadsPerThreadgroup
-    self.outputBuffer = outputBuffer
+    self.targets = targets
+    self.maxBatchSize = maxBatchSize
   }
 
   /**
-   * The fixed output width for this pipeline instance.
+   * Validates `ResizerOptions.outputBufferCount` and returns the ring size.
    */
-  private var outputWidth: Int {
-    return Int(options.width)
+  private static func outputBufferCount(for options: ResizerOptions) throws -> Int {
+    let outputBufferCount = options.outputBufferCount ?? 1
+    guard outputBufferCount >= 1,
+      outputBufferCount <= Double(maxOutputBufferCount),
+      outputBufferCount.rounded() == outputBufferCount
+    else {
+      throw RuntimeError.error(
+        withMessage:
+          "ResizerOptions.outputBufferCount must be an integer between 1 and \(maxOutputBufferCount), but was \(outputBufferCount).")
+    }
+    return Int(outputBufferCount)
   }
 
   /**
-   * The fixed output height for this pipeline instance.
+   * Validates `ResizerOptions.maxBatchSize` and returns the number of images each output buffer holds.
    */
-  private var outputHeight: Int {
-    return Int(options.height)
+  private static func maxBatchSize(for options: ResizerOptions) throws -> Int {
+    let maxBatchSize = options.maxBatchSize ?? 1
+    guard maxBatchSize >= 1,
+      maxBatchSize <= Double(maxBatchSizeLimit),
+      maxBatchSize.rounded() == maxBatchSize
+    else {
+      throw RuntimeError.error(
+        withMessage:
+          "ResizerOptions.maxBatchSize must be an integer between 1 and \(maxBatchSizeLimit), but was \(maxBatchSize).")
+    }
+    return Int(maxBatchSize)
   }
 
   /**
-   * The exact packed output size for one resized frame.
+   * The total size of every output buffer in the rings of all targets.
    */
-  var outputByteCount: Int {
-    // `pixelLayout` only changes how channel values are arranged in memory, not the total byte count.
-    return options.channelOrder.getOutputTotalByteCount(
-      dataType: options.dataType,
-      width: outputWidth,
-      height: outputHeight)
+  var allocatedByteCount: Int {
+    return targets.reduce(0) { total, target in
+      total + target.outputBuffers.reduce(0) { $0 + $1.allocatedSize }
+    }
   }
 
   deinit {
@@ -89,84 +180,378 @@ final class MetalResizerPipeline {
   }
 
   /**
-   * Runs the resize shader for one camera frame and returns a live view over the reusable output buffer.
+   * Runs the resize shader for one camera frame and returns one live view over the next free output buffer per target.
+   * If `options.crop` is set, only that region of the input (in input pixels, before rotation and mirroring) is resized.
+   * If `options.width` or `options.height` is set, this call resizes to that size instead of the configured one.
    */
   func run(
     pixelBuffer: CVPixelBuffer,
     rotationDegrees: Int32,
-    isMirrored: Bool
-  ) throws -> MetalBufferView {
-    let outputBufferView = try outputBuffer.acquireView(
-      width: outputWidth,
-      height: outputHeight,
-      channelOrder: options.channelOrder,
-      dataType: options.dataType,
-      pixelLayout: options.pixelLayout)
-    let uniforms = makeUniforms(
+    isMirrored: Bool,
+    options: ResizeOptions?
+  ) throws -> [MetalBufferView] {
+    let outputSizes = try requestedOutputSizes(for: options)
+    let cropRegion = try CropRegion(
+      crop: options?.crop,
+      inputWidth: CVPixelBufferGetWidth(pixelBuffer),
+      inputHeight: CVPixelBufferGetHeight(pixelBuffer))
+    return try runSynchronously(
+      pixelBuffer: pixelBuffer,
       rotationDegrees: rotationDegrees,
-      isMirrored: isMirrored)
-    let inputTextures = try MetalResizerInputTextures.make(
-      from: pixelBuffer,
-      textureCache: textureCache)
-    try encodeAndRun(
-      inputTextures: inputTextures,
-      outputBuffer: outputBufferView.buffer,
-      uniforms: uniforms)
-    return outputBufferView
+      isMirrored: isMirrored,
+      cropRegions: [cropRegion],
+      outputSizes: outputSizes)
+  }
+
+  /**
+   * Returns the output size of every target for one `resize(...)` call.
+   * Every target of a `MultiResizer` has its own fixed size, so only a single target can be resized to a per-call size.
+   */
+  private func requestedOutputSizes(for options: ResizeOptions?) throws -> [OutputSize] {
+    if targets.count > 1, options?.width != nil || options?.height != nil {
+      throw RuntimeError.error(
+        withMessage: "MultiResizer does not support ResizeOptions.width/height, every output has its own fixed size.")
+    }
+    if targets.contains(where: { $0.options.isTextureOutput }), options?.width != nil || options?.height != nil {
+      throw RuntimeError.error(
+        withMessage:
+          "ResizeOptions.width/height is not supported with outputBufferType 'texture', its texture has a fixed size.")
+    }
+    return try targets.map { try $0.options.requestedOutputSize(for: options) }
+  }
+
+  /**
+   * Resizes every region of one camera frame into consecutive images of the next free output buffer, using a single dispatch per target.
+   * Each region is in input pixels, before rotation and mirroring.
+   */
+  func runBatch(
+    pixelBuffer: CVPixelBuffer,
+    rotationDegrees: Int32,
+    isMirrored: Bool,
+    regions: [Rect]
+  ) throws -> [MetalBufferView] {
+    guard !regions.isEmpty else {
+      throw RuntimeError.error(withMessage: "resizeBatch() requires at least one region.")
+    }
+    guard regions.count <= maxBatchSize else {
+      throw RuntimeError.error(
+        withMessage:
+          "resizeBatch() received \(regions.count) regions, but this Resizer was created with a maxBatchSize of \(maxBatchSize). Increase `maxBatchSize`."
+      )
+    }
+    let inputWidth = CVPixelBufferGetWidth(pixelBuffer)
+    let inputHeight = CVPixelBufferGetHeight(pixelBuffer)
+    let cropRegions = try regions.map { region in
+      try CropRegion(crop: region, inputWidth: inputWidth, inputHeight: inputHeight)
+    }
+    // Batches always use the configured output size.
+    return try runSynchronously(
+      pixelBuffer: pixelBuffer,
+      rotationDegrees: rotationDegrees,
+      isMirrored: isMirrored,
+      cropRegions: cropRegions,
+      outputSizes: targets.map { $0.options.outputSize })
+  }
+
+  /**
+   * Encodes, commits and waits for one command buffer that writes one image per crop region into every target.
+   */
+  private func runSynchronously(
+    pixelBuffer: CVPixelBuffer,
+    rotationDegrees: Int32,
+    isMirrored: Bool,
+    cropRegions: [CropRegion],
+    outputSizes: [OutputSize]
+  ) throws -> [MetalBufferView] {
+    let outputBufferViews = try acquireOutputBufferViews(
+      pixelBuffer: pixelBuffer,
+      rotationDegrees: rotationDegrees,
+      isMirrored: isMirrored,
+      cropRegions: cropRegions,
+      outputSizes: outputSizes)
+    let commandBuffer = try encode(
+      pixelBuffer: pixelBuffer,
+      outputBufferViews: outputBufferViews,
+      rotationDegrees: rotationDegrees,
+      isMirrored: isMirrored,
+      cropRegions: cropRegions)
+    commandBuffer.commit()
+    commandBuffer.waitUntilCompleted()
+    try Self.checkStatus(of: commandBuffer)
+    attachFrameStatistics(to: outputBufferViews)
+    return outputBufferViews
+  }
+
+  /**
+   * Encodes and commits the resize shader for one camera frame without waiting for the GPU.
+   * `completion` is called from Metal's completion thread once every output buffer is readable.
+   */
+  func runAsync(
+    pixelBuffer: CVPixelBuffer,
+    rotationDegrees: Int32,
+    isMirrored: Bool,
+    options: ResizeOptions?,
+    completion: @escaping (Result<[MetalBufferView], Error>) -> Void
+  ) throws {
+    let outputSizes = try requestedOutputSizes(for: options)
+    let cropRegion = try CropRegion(
+      crop: options?.crop,
+      inputWidth: CVPixelBufferGetWidth(pixelBuffer),
+      inputHeight: CVPixelBufferGetHeight(pixelBuffer))
+    let outputBufferViews = try acquireOutputBufferViews(
+      pixelBuffer: pixelBuffer,
+      rotationDegrees: rotationDegrees,
+      isMirrored: isMirrored,
+      cropRegions: [cropRegion],
+      outputSizes: outputSizes)
+    let commandBuffer = try encode(
+      pixelBuffer: pixelBuffer,
+      outputBufferViews: outputBufferViews,
+      rotationDegrees: rotationDegrees,
+      isMirrored: isMirrored,
+      cropRegions: [cropRegion])
+    commandBuffer.addCompletedHandler { commandBuffer in
+      do {
+        try Self.checkStatus(of: commandBuffer)
+        self.attachFrameStatistics(to: outputBufferViews)
+        completion(.success(outputBufferViews))
+      } catch {
+        completion(.failure(error))
+      }
+    }
+    commandBuffer.commit()
+  }
+
+  /**
+   * Records where each crop region lands in the `outputSize` large output of `target`, so detections can be mapped back into Frame coordinates later.
+   */
+  private func makeTransforms(
+    target: Target,
+    outputSize: OutputSize,
+    pixelBuffer: CVPixelBuffer,
+    rotationDegrees: Int32,
+    isMirrored: Bool,
+    cropRegions: [CropRegion]
+  ) -> [ResizeTransform] {
+    let inputWidth = CVPixelBufferGetWidth(pixelBuffer)
+    let inputHeight = CVPixelBufferGetHeight(pixelBuffer)
+    return cropRegions.map { cropRegion in
+      ResizeTransform(
+        cropRegion: cropRegion,
+        inputWidth: inputWidth,
+        inputHeight: inputHeight,
+        outputWidth: outputSize.width,
+        outputHeight: outputSize.height,
+        rotationDegrees: rotationDegrees,
+        isMirrored: isMirrored,
+        scaleMode: target.options.scaleMode)
+    }
   }
 
   /**
-   * Builds the shader uniforms for one dispatch.
+   * Checks out the next free output buffer of every target's ring, in target order.
+   * If one target has no free buffer, the views acquired so far are released again when they go out of scope.
    */
-  private func makeUniforms(rotationDegrees: Int32, isMirrored: Bool) -> MetalResizerUniforms {
+  private func acquireOutputBufferViews(
+    pixelBuffer: CVPixelBuffer,
+    rotationDegrees: Int32,
+    isMirrored: Bool,
+    cropRegions: [CropRegion],
+    outputSizes: [OutputSize]
+  ) throws -> [MetalBufferView] {
+    stateLock.lock()
+    defer { stateLock.unlock() }
+
+    return try zip(targets, outputSizes).map { target, outputSize in
+      try acquireOutputBufferViewLocked(
+        target: target,
+        outputSize: outputSize,
+        transforms: makeTransforms(
+          target: target,
+          outputSize: outputSize,
+          pixelBuffer: pixelBuffer,
+          rotationDegrees: rotationDegrees,
+          isMirrored: isMirrored,
+          cropRegions: cropRegions))
+    }
+  }
+
+  /**
+   * Checks out the next free output buffer of `target`'s ring, round-robin, growing it to fit `outputSize` if needed.
+   * Must be called while holding `stateLock`.
+   */
+  private func acquireOutputBufferViewLocked(
+    target: Target,
+    outputSize: OutputSize,
+    transforms: [ResizeTransform]
+  ) throws -> MetalBufferView {
+    let outputBuffers = target.outputBuffers
+    for offset in 0..<outputBuffers.count {
+      let index = (target.nextOutputBufferIndex + offset) % outputBuffers.count
+      let view = try outputBuffers[index].tryAcquireView(
+        width: outputSize.width,
+        height: outputSize.height,
+        transforms: transforms,
+        channelOrder: target.options.channelOrder,
+        dataType: target.options.dataType,
+        pixelLayout: target.options.pixelLayout,
+        byteCount: target.outputImageByteCount(size: outputSize) * transforms.count,
+        maxBufferLength: target.outputImageByteCount(size: target.maxOutputSize) * maxBatchSize)
+      if let view {
+        target.nextOutputBufferIndex = (index + 1) % outputBuffers.count
+        return view
+      }
+    }
+
+    if outputBuffers.count == 1 {
+      throw RuntimeError.error(
+        withMessage: "Previous GPUFrame is still in-use. Dispose it before calling resize() again.")
+    }
+    throw RuntimeError.error(
+      withMessage:
+        "All \(outputBuffers.count) GPUFrames are still in-use. Dispose one before calling resize() again, or increase `outputBufferCount`."
+    )
+  }
+
+  /**
+   * Builds the shader uniforms for one dispatch into `outputBufferView`.
+   */
+  private func makeUniforms(
+    outputBufferView: MetalBufferView,
+    rotationDegrees: Int32,
+    isMirrored: Bool
+  ) -> MetalResizerUniforms {
     return MetalResizerUniforms(
-      outputWidth: UInt32(outputWidth),
-      outputHeight: UInt32(outputHeight),
+      outputWidth: UInt32(outputBufferView.width),
+      outputHeight: UInt32(outputBufferView.height),
       rotationDegrees: rotationDegrees,
       isMirrored: isMirrored ? 1 : 0)
   }
 
   /**
-   * The threadgroup grid that covers the full output image, rounded up.
+   * The threadgroup grid of `target` that covers the full image of `outputBufferView`, rounded up, once per image of the batch.
    * The kernels bounds-check `gid`, so this also works on GPUs that do not
    * support non-uniform threadgroups.
    */
-  private func threadgroupsPerGrid(threadsPerThreadgroup: MTLSize) -> MTLSize {
+  private func threadgroupsPerGrid(target: Target, outputBufferView: MetalBufferView, batchSize: Int) -> MTLSize {
+    let threadsPerThreadgroup = target.threadsPerThreadgroup
     return MTLSize(
-      width: (outputWidth + threadsPerThreadgroup.width - 1) / threadsPerThreadgroup.width,
-      height: (outputHeight + threadsPerThreadgroup.height - 1) / threadsPerThreadgroup.height,
-      depth: 1)
+      width: (outputBufferView.width + threadsPerThreadgroup.width - 1) / threadsPerThreadgroup.width,
+      height: (outputBufferView.height + threadsPerThreadgroup.height - 1) / threadsPerThreadgroup.height,
+      depth: batchSize)
   }
 
-  private func encodeAndRun(
-    inputTextures: MetalResizerInputTextures,
-    outputBuffer: MTLBuffer,
-    uniforms: MetalResizerUniforms
-  ) throws {
+  /**
+   * Encodes one dispatch per target into a new command buffer, all sampling the same input textures. The caller commits it.
+   */
+  private func encode(
+    pixelBuffer: CVPixelBuffer,
+    outputBufferViews: [MetalBufferView],
+    rotationDegrees: Int32,
+    isMirrored: Bool,
+    cropRegions: [CropRegion]
+  ) throws -> MTLCommandBuffer {
+    let inputTextures = try MetalResizerInputTextures.make(
+      from: pixelBuffer,
+      textureCache: textureCache)
+    // At most `maxBatchSizeLimit` regions of 16 bytes, well below the 4 KB `setBytes` limit.
+    var regions = cropRegions.map { $0.shaderRegion }
+
     guard let commandBuffer = commandQueue.makeCommandBuffer() else {
       throw RuntimeError.error(withMessage: "Failed to create Metal command buffer.")
     }
     guard let encoder = commandBuffer.makeComputeCommandEncoder() else {
       throw RuntimeError.error(withMessage: "Failed to create Metal compute command encoder.")
     }
-    var uniforms = uniforms
 
-    encoder.setComputePipelineState(pipelineState)
+    // Inputs and regions are shared by every target, so they are only bound once.
     encoder.setTexture(inputTextures.yPlane.texture, index: 0)
     encoder.setTexture(inputTextures.uvPlane.texture, index: 1)
-    encoder.setBuffer(outputBuffer, offset: 0, index: 0)
-    encoder.setBytes(&uniforms, length: MemoryLayout<MetalResizerUniforms>.stride, index: 1)
-    encoder.dispatchThreadgroups(
-      threadgroupsPerGrid(threadsPerThreadgroup: threadsPerThreadgroup),
-      threadsPerThreadgroup: threadsPerThreadgroup)
+    encoder.setBytes(&regions, length: MemoryLayout<SIMD4<Float>>.stride * regions.count, index: 2)
+    for (target, outputBufferView) in zip(targets, outputBufferViews) {
+      var uniforms = makeUniforms(
+        outputBufferView: outputBufferView,
+        rotationDegrees: rotationDegrees,
+        isMirrored: isMirrored)
+      encoder.setComputePipelineState(target.pipelineState)
+      encoder.setBuffer(outputBufferView.buffer, offset: 0, index: 0)
+      encoder.setBytes(&uniforms, length: MemoryLayout<MetalResizerUniforms>.stride, index: 1)
+      if let statisticsBuffer = outputBufferView.statisticsBuffer {
+        // The view is checked out exclusively, so the GPU is not reading its statistics buffer right now.
+        memset(statisticsBuffer.contents(), 0, statisticsBuffer.length)
+        encoder.setBuffer(statisticsBuffer, offset: 0, index: 3)
+      }
+      encoder.dispatchThreadgroups(
+        threadgroupsPerGrid(target: target, outputBufferView: outputBufferView, batchSize: regions.count),
+        threadsPerThreadgroup: target.threadsPerThreadgroup)
+    }
     encoder.endEncoding()
+    try encodeTextureCopies(commandBuffer: commandBuffer, outputBufferViews: outputBufferViews)
 
-    commandBuffer.commit()
-    commandBuffer.waitUntilCompleted()
+    // Keep the CoreVideo-backed textures (and their CVPixelBuffer) alive until GPU execution has finished.
+    commandBuffer.addCompletedHandler { _ in
+      withExtendedLifetime(inputTextures) {}
+    }
+    return commandBuffer
+  }
 
-    // Keep the CoreVideo-backed textures alive until GPU execution has finished.
-    withExtendedLifetime(inputTextures) {}
+  /**
+   * Copies every `'texture'` output buffer into its `CVPixelBuffer`, after the resize dispatches of the same command buffer.
+   * Texture outputs are validated to be 32BGRA with a single image of a fixed size, so each copy is one tightly packed image.
+   */
+  private func encodeTextureCopies(
+    commandBuffer: MTLCommandBuffer,
+    outputBufferViews: [MetalBufferView]
+  ) throws {
+    let textureCopies = outputBufferViews.compactMap { outputBufferView in
+      outputBufferView.textureOutput.map { (outputBufferView, $0) }
+    }
+    guard !textureCopies.isEmpty else {
+      return
+    }
+    guard let blitEncoder = commandBuffer.makeBlitCommandEncoder() else {
+      throw RuntimeError.error(withMessage: "Failed to create Metal blit command encoder.")
+    }
+    for (outputBufferView, textureOutput) in textureCopies {
+      let bytesPerRow = outputBufferView.width * 4
+      blitEncoder.copy(
+        from: outputBufferView.buffer,
+        sourceOffset: 0,
+        sourceBytesPerRow: bytesPerRow,
+        sourceBytesPerImage: bytesPerRow * outputBufferView.height,
+        sourceSize: MTLSize(width: outputBufferView.width, height: outputBufferView.height, depth: 1),
+        to: textureOutput.texture,
+        destinationSlice: 0,
+        destinationLevel: 0,
+        destinationOrigin: MTLOrigin(x: 0, y: 0, z: 0))
+    }
+    blitEncoder.endEncoding()
+  }
+
+  /**
+   * Finalizes the luma sums of every view with a statistics buffer into its `frameStatistics`, once the GPU has finished writing them.
+   */
+  private func attachFrameStatistics(to outputBufferViews: [MetalBufferView]) {
+    stateLock.lock()
+    defer { stateLock.unlock() }
+
+    for (target, outputBufferView) in zip(targets, outputBufferViews) {
+      guard let statisticsBuffer = outputBufferView.statisticsBuffer else {
+        continue
+      }
+      let cellLumaSums = statisticsBuffer.contents().bindMemory(
+        to: UInt32.self, capacity: FrameStatistics.cellCount)
+      let frameStatistics = FrameStatistics(
+        cellLumaSums: cellLumaSums,
+        width: outputBufferView.width,
+        height: outputBufferView.height,
+        previousThumbnail: target.previousThumbnail)
+      target.previousThumbnail = frameStatistics.thumbnail
+      outputBufferView.frameStatistics = frameStatistics
+    }
+  }
 
+  private static func checkStatus(of commandBuffer: MTLCommandBuffer) throws {
     guard commandBuffer.status == .completed else {
       let message =
         commandBuffer.error?.localizedDescription ?? "Unknown Metal command buffer error."
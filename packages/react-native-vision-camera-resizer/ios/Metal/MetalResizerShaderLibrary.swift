@@ -20,11 +20,19 @@ struct MetalResizerUniforms {
 /// Loads the precompiled Metal shader bundle and resolves the compute pipeline used by the resizer.
 enum MetalResizerShaderLibrary {
   private static let shaderBundleName = "VisionCameraResizerShaders"
+  // Matches the 256 cells of the FrameStatistics grid, so clearing and flushing them takes one pass per thread.
+  private static let maxThreadsPerThreadgroup = 256
   private enum FunctionConstantIndex: Int {
     case channelOrder = 0
     case pixelLayout = 1
     case channelCount = 2
     case scaleMode = 3
+    case channelScale = 4
+    case channelBias = 5
+    case inverseQuantizationScale = 6
+    case quantizationZeroPoint = 7
+    case frameStatistics = 8
+    case filter = 9
   }
 
   /**
@@ -35,7 +43,9 @@ enum MetalResizerShaderLibrary {
     options: ResizerOptions
   ) throws -> MTLComputePipelineState {
     let functionName = functionName(for: options.dataType)
-    let functionConstantValues = makeFunctionConstantValues(options: options)
+    let normalization = try ResizerNormalization(options: options)
+    let functionConstantValues = makeFunctionConstantValues(
+      options: options, normalization: normalization)
     do {
       let library = try loadPrecompiledLibrary(device: device)
       let function = try makeFunction(
@@ -51,11 +61,14 @@ enum MetalResizerShaderLibrary {
   }
 
   /**
-   * Chooses a threadgroup size that matches the device's compute limits.
+   * Chooses a threadgroup size that matches the device's compute limits, used for every `DataType` kernel.
+   * Each row is one full SIMD-group, so its threads write adjacent output pixels, and at most
+   * `maxThreadsPerThreadgroup` threads are stacked into rows.
    */
   static func optimalThreadgroupSize(for pipelineState: MTLComputePipelineState) -> MTLSize {
-    let width = min(pipelineState.threadExecutionWidth, 16)
-    let height = max(1, min(16, pipelineState.maxTotalThreadsPerThreadgroup / max(width, 1)))
+    let width = max(1, pipelineState.threadExecutionWidth)
+    let threadCount = min(pipelineState.maxTotalThreadsPerThreadgroup, maxThreadsPerThreadgroup)
+    let height = max(1, threadCount / width)
     return MTLSize(width: width, height: height, depth: 1)
   }
 
@@ -83,14 +96,21 @@ enum MetalResizerShaderLibrary {
   /**
    * Bakes the fixed output layout into the Metal function so only per-frame transform inputs stay dynamic.
    */
-  private static func makeFunctionConstantValues(options: ResizerOptions)
-    -> MTLFunctionConstantValues
-  {
+  private static func makeFunctionConstantValues(
+    options: ResizerOptions,
+    normalization: ResizerNormalization
+  ) -> MTLFunctionConstantValues {
     let functionConstantValues = MTLFunctionConstantValues()
     var channelOrder = options.channelOrder.shaderOrdinal
     var pixelLayout = options.pixelLayout.shaderOrdinal
     var channelCount = UInt32(options.channelOrder.channelsPerPixel)
     var scaleMode = options.scaleMode.shaderOrdinal
+    var channelScale = normalization.channelScale
+    var channelBias = normalization.channelBias
+    var inverseQuantizationScale = normalization.inverseQuantizationScale
+    var quantizationZeroPoint = normalization.quantizationZeroPoint
+    var frameStatistics = options.enableFrameStatistics ?? false
+    var filter = (options.filter ?? .bilinear).shaderOrdinal
 
     functionConstantValues.setConstantValue(
       &channelOrder, type: .uint, index: FunctionConstantIndex.channelOrder.rawValue)
@@ -100,6 +120,20 @@ enum MetalResizerShaderLibrary {
       &channelCount, type: .uint, index: FunctionConstantIndex.channelCount.rawValue)
     functionConstantValues.setConstantValue(
       &scaleMode, type: .uint, index: FunctionConstantIndex.scaleMode.rawValue)
+    functionConstantValues.setConstantValue(
+      &channelScale, type: .float4, index: FunctionConstantIndex.channelScale.rawValue)
+    functionConstantValues.setConstantValue(
+      &channelBias, type: .float4, index: FunctionConstantIndex.channelBias.rawValue)
+    functionConstantValues.setConstantValue(
+      &inverseQuantizationScale, type: .float,
+      index: FunctionConstantIndex.inverseQuantizationScale.rawValue)
+    functionConstantValues.setConstantValue(
+      &quantizationZeroPoint, type: .float,
+      index: FunctionConstantIndex.quantizationZeroPoint.rawValue)
+    functionConstantValues.setConstantValue(
+      &frameStatistics, type: .bool, index: FunctionConstantIndex.frameStatistics.rawValue)
+    functionConstantValues.setConstantValue(
+      &filter, type: .uint, index: FunctionConstantIndex.filter.rawValue)
 
     return functionConstantValues
   }
@@ -5,55 +5,144 @@
 //  Created by Marc Rousavy on 11.03.26.
 //
 
+import CoreVideo
 import Foundation
 import Metal
 import NitroModules
 
-/// Owns the single reusable Metal output buffer and enforces that only one GPU frame can hold it at a time.
+/// The IOSurface-backed 32BGRA `CVPixelBuffer` of a `'texture'` output, and the Metal texture the output buffer is copied into.
+struct MetalTextureOutput {
+  let pixelBuffer: CVPixelBuffer
+  let texture: MTLTexture
+}
+
+/// Owns one reusable Metal output buffer and enforces that only one GPU frame can hold it at a time.
 final class MetalReusableBuffer {
   private let stateLock = NSLock()
-  private let buffer: MTLBuffer
+  private let device: MTLDevice
+  /// Replaced by a larger one while no view holds it, once a view needs more than `buffer.length` bytes.
+  private var buffer: MTLBuffer
+  private let statisticsBuffer: MTLBuffer?
+  private let textureOutput: MetalTextureOutput?
   private var isInUse = false
 
-  init(device: MTLDevice, bufferLength: Int) throws {
-    guard let buffer = device.makeBuffer(length: bufferLength, options: .storageModeShared) else {
-      throw RuntimeError.error(withMessage: "Failed to allocate Metal output buffer.")
+  /**
+   * Allocates the output buffer, plus a `statisticsBufferLength` bytes large buffer for frame statistics if it is non-zero.
+   * If `textureSize` is set, this also allocates a `textureSize` large 32BGRA `CVPixelBuffer` that the output is copied into.
+   */
+  init(
+    device: MTLDevice,
+    bufferLength: Int,
+    statisticsBufferLength: Int = 0,
+    textureSize: OutputSize? = nil
+  ) throws {
+    self.device = device
+    self.buffer = try Self.makeOutputBuffer(device: device, length: bufferLength)
+    self.textureOutput = try textureSize.map { try Self.makeTextureOutput(device: device, size: $0) }
+
+    if statisticsBufferLength > 0 {
+      guard
+        let statisticsBuffer = device.makeBuffer(
+          length: statisticsBufferLength, options: .storageModeShared)
+      else {
+        throw RuntimeError.error(withMessage: "Failed to allocate Metal frame statistics buffer.")
+      }
+      statisticsBuffer.label = "VisionCameraResizer.FrameStatistics"
+      self.statisticsBuffer = statisticsBuffer
+    } else {
+      self.statisticsBuffer = nil
     }
-    buffer.label = "VisionCameraResizer.Output"
-    self.buffer = buffer
   }
 
   /**
-   * Returns one live view over the shared output allocation.
+   * The size of the shared output allocation (and its statistics buffer), in bytes.
+   */
+  var allocatedSize: Int {
+    stateLock.lock()
+    defer { stateLock.unlock() }
+    let textureLength = textureOutput.map { CVPixelBufferGetDataSize($0.pixelBuffer) } ?? 0
+    return buffer.length + (statisticsBuffer?.length ?? 0) + textureLength
+  }
+
+  /**
+   * Returns one live view over the shared output allocation,
+   * or `nil` if a previous view is still alive.
+   * If the allocation is smaller than `byteCount`, it is replaced with a larger one first, which is at most `maxBufferLength` bytes.
    */
-  func acquireView(
+  func tryAcquireView(
     width: Int,
     height: Int,
+    transforms: [ResizeTransform],
     channelOrder: ChannelOrder,
     dataType: DataType,
-    pixelLayout: PixelLayout
-  ) throws
-    -> MetalBufferView
-  {
+    pixelLayout: PixelLayout,
+    byteCount: Int,
+    maxBufferLength: Int
+  ) throws -> MetalBufferView? {
     stateLock.lock()
     defer { stateLock.unlock() }
 
     guard !isInUse else {
-      throw RuntimeError.error(
-        withMessage: "Previous GPUFrame is still in-use. Dispose it before calling resize() again.")
+      return nil
+    }
+    if buffer.length < byteCount {
+      // No view holds the old buffer anymore, and a view keeps its buffer alive until the GPU has finished with it.
+      // Grow geometrically so a slowly increasing size does not re-allocate on every call.
+      buffer = try Self.makeOutputBuffer(
+        device: device, length: min(max(byteCount, buffer.length * 2), maxBufferLength))
     }
 
     isInUse = true
     return MetalBufferView(
       width: width,
       height: height,
+      transforms: transforms,
       channelOrder: channelOrder,
       dataType: dataType,
       pixelLayout: pixelLayout,
       buffer: buffer,
+      statisticsBuffer: statisticsBuffer,
+      textureOutput: textureOutput,
+      byteCount: byteCount,
       onRelease: { [self] in releaseView() })
   }
 
+  private static func makeOutputBuffer(device: MTLDevice, length: Int) throws -> MTLBuffer {
+    guard let buffer = device.makeBuffer(length: length, options: .storageModeShared) else {
+      throw RuntimeError.error(withMessage: "Failed to allocate Metal output buffer.")
+    }
+    buffer.label = "VisionCameraResizer.Output"
+    return buffer
+  }
+
+  private static func makeTextureOutput(device: MTLDevice, size: OutputSize) throws -> MetalTextureOutput {
+    // An IOSurface backing is what lets other frameworks (and other Metal devices) wrap the same memory without a copy.
+    let attributes: [CFString: Any] = [
+      kCVPixelBufferIOSurfacePropertiesKey: [:] as [CFString: Any],
+      kCVPixelBufferMetalCompatibilityKey: true,
+    ]
+    var pixelBuffer: CVPixelBuffer?
+    let status = CVPixelBufferCreate(
+      kCFAllocatorDefault, size.width, size.height, kCVPixelFormatType_32BGRA,
+      attributes as CFDictionary, &pixelBuffer)
+    guard status == kCVReturnSuccess, let pixelBuffer,
+      let ioSurface = CVPixelBufferGetIOSurface(pixelBuffer)?.takeUnretainedValue()
+    else {
+      throw RuntimeError.error(
+        withMessage: "Failed to allocate the CVPixelBuffer for the texture resizer output (status \(status)).")
+    }
+
+    let descriptor = MTLTextureDescriptor.texture2DDescriptor(
+      pixelFormat: .bgra8Unorm, width: size.width, height: size.height, mipmapped: false)
+    descriptor.usage = [.shaderRead]
+    descriptor.storageMode = .shared
+    guard let texture = device.makeTexture(descriptor: descriptor, iosurface: ioSurface, plane: 0) else {
+      throw RuntimeError.error(withMessage: "Failed to create the Metal texture for the texture resizer output.")
+    }
+    texture.label = "VisionCameraResizer.Texture"
+    return MetalTextureOutput(pixelBuffer: pixelBuffer, texture: texture)
+  }
+
   private func releaseView() {
     stateLock.lock()
     defer { stateLock.unlock() }
@@ -10,14 +10,32 @@ struct ResizeUniforms {
 
 constexpr sampler resizeSampler(coord::normalized, address::clamp_to_edge, filter::linear);
 
-// 0u == ChannelOrder::RGB, 1u == ChannelOrder::BGR
+// 0u == ChannelOrder::RGB, 1u == ChannelOrder::BGR, 2u == ChannelOrder::GRAY,
+// 3u == ChannelOrder::RGBA, 4u == ChannelOrder::BGRA, 5u == ChannelOrder::ARGB
 constant uint kChannelOrder [[function_constant(0)]];
 // 0u == PixelLayout::INTERLEAVED == HWC / NHWC, 1u == PixelLayout::PLANAR == CHW / NCHW
 constant uint kPixelLayout [[function_constant(1)]];
-// Number of channels per pixel. e.g. for RGB/BGR, this is 3u.
+// Number of channels per pixel. e.g. for RGB/BGR, this is 3u, for GRAY 1u and for RGBA/BGRA/ARGB 4u.
 constant uint kChannelCount [[function_constant(2)]];
 // 0u == ScaleMode::COVER, 1u == ScaleMode::CONTAIN, 2u == ScaleMode::STRETCH
 constant uint kScaleMode [[function_constant(3)]];
+// Fused `(x - mean) / std` per output channel, folded into `x * kChannelScale + kChannelBias`.
+// Only the first kChannelCount components are used.
+constant float4 kChannelScale [[function_constant(4)]];
+constant float4 kChannelBias [[function_constant(5)]];
+// 8-bit outputs are written as `round(value * kInverseQuantizationScale) + kQuantizationZeroPoint`.
+constant float kInverseQuantizationScale [[function_constant(6)]];
+constant float kQuantizationZeroPoint [[function_constant(7)]];
+// Whether to sum the luma of the first image of the batch per cell of a 16x16 grid into `cellLumaSums`.
+constant bool kFrameStatistics [[function_constant(8)]];
+// 0u == ResizeFilter::BILINEAR, 1u == ResizeFilter::AREA
+constant uint kFilter [[function_constant(9)]];
+
+// The most bilinear taps per output axis of ResizeFilter::AREA.
+constant uint kMaxAreaTapsPerAxis = 4u;
+
+constant uint kFrameStatisticsGridSize = 16u;
+constant uint kFrameStatisticsCellCount = kFrameStatisticsGridSize * kFrameStatisticsGridSize;
 
 inline float3 yuvToRgb(float y, float2 uv) {
   float cb = uv.x - 0.5f;
@@ -30,27 +48,40 @@ inline float3 yuvToRgb(float y, float2 uv) {
   return clamp(float3(r, g, b), 0.0f, 1.0f);
 }
 
-inline float3 sampleRgb(
-  texture2d<float, access::sample> yTexture,
-  texture2d<float, access::sample> uvTexture,
-  uint2 gid,
-  constant ResizeUniforms& uniforms
-) {
-  float2 outputSize = float2(uniforms.outputWidth, uniforms.outputHeight);
-  float2 sourceSize = float2(yTexture.get_width(), yTexture.get_height());
-  float2 outputCoordinate = (float2(gid) + 0.5f) / outputSize;
-
+inline int normalizedRotationDegrees(constant ResizeUniforms& uniforms) {
   int normalizedRotation = uniforms.rotationDegrees % 360;
   if (normalizedRotation < 0) {
     normalizedRotation += 360;
   }
+  return normalizedRotation;
+}
 
+// The size of the cropped region (or the full texture if no crop is set) in input pixels, as presented upright.
+inline float2 uprightSourceSize(
+  texture2d<float, access::sample> yTexture,
+  float4 region,
+  int normalizedRotation
+) {
+  float2 sourceSize = float2(yTexture.get_width(), yTexture.get_height()) * region.zw;
   // Scale modes fit the upright content into the output. For buffers that
   // need a 90°/270° rotation, the upright dimensions are swapped.
   bool isSideways = normalizedRotation == 90 || normalizedRotation == 270;
-  if (isSideways) {
-    sourceSize = sourceSize.yx;
-  }
+  return isSideways ? sourceSize.yx : sourceSize;
+}
+
+// Takes one bilinear sample at a position in output pixels.
+inline float3 sampleInputRgb(
+  texture2d<float, access::sample> yTexture,
+  texture2d<float, access::sample> uvTexture,
+  float2 outputPosition,
+  float4 region,
+  constant ResizeUniforms& uniforms
+) {
+  float2 outputSize = float2(uniforms.outputWidth, uniforms.outputHeight);
+  float2 outputCoordinate = outputPosition / outputSize;
+  int normalizedRotation = normalizedRotationDegrees(uniforms);
+  // Scale modes fit the cropped region (or the full texture if no crop is set) into the output.
+  float2 sourceSize = uprightSourceSize(yTexture, region, normalizedRotation);
 
   float2 coordinate;
   switch (kScaleMode) {
@@ -106,51 +137,166 @@ inline float3 sampleRgb(
     coordinate.x = 1.0f - coordinate.x;
   }
 
+  // Map crop-relative coordinates into the full input texture.
+  coordinate = region.xy + (coordinate * region.zw);
+
   float y = yTexture.sample(resizeSampler, coordinate).r;
+  if (kChannelOrder == 2u) { // 2u == ChannelOrder::GRAY
+    // Gray only needs luma, so skip the chroma sample and the YUV to RGB conversion.
+    return float3(y);
+  }
   float2 uv = uvTexture.sample(resizeSampler, coordinate).rg;
   return yuvToRgb(y, uv);
 }
 
-inline float3 orderedColor(
+// The number of bilinear taps per output axis that ResizeFilter::AREA spreads over one output pixel.
+// Each tap already averages up to 2x2 input pixels, so one tap per 2 input pixels covers the whole footprint.
+// Beyond kMaxAreaTapsPerAxis, taps are spread evenly over the footprint instead.
+inline uint2 areaTapCount(
+  texture2d<float, access::sample> yTexture,
+  float4 region,
+  constant ResizeUniforms& uniforms
+) {
+  float2 outputSize = float2(uniforms.outputWidth, uniforms.outputHeight);
+  float2 sourceSize = uprightSourceSize(yTexture, region, normalizedRotationDegrees(uniforms));
+  // The number of input pixels one output pixel covers, per output axis.
+  float2 footprint;
+  switch (kScaleMode) {
+    case 0u: // 0u == ScaleMode::COVER
+      footprint = float2(1.0f / max(outputSize.x / sourceSize.x, outputSize.y / sourceSize.y));
+      break;
+    case 1u: // 1u == ScaleMode::CONTAIN
+      footprint = float2(1.0f / min(outputSize.x / sourceSize.x, outputSize.y / sourceSize.y));
+      break;
+    default: // 2u == ScaleMode::STRETCH
+      footprint = sourceSize / outputSize;
+      break;
+  }
+  return clamp(uint2(ceil(footprint * 0.5f)), uint2(1u), uint2(kMaxAreaTapsPerAxis));
+}
+
+// Samples one output pixel with the configured ResizeFilter.
+inline float3 sampleRgb(
+  texture2d<float, access::sample> yTexture,
+  texture2d<float, access::sample> uvTexture,
+  uint2 gid,
+  float4 region,
+  constant ResizeUniforms& uniforms
+) {
+  if (kFilter != 1u) { // 0u == ResizeFilter::BILINEAR
+    return sampleInputRgb(yTexture, uvTexture, float2(gid) + 0.5f, region, uniforms);
+  }
+
+  // 1u == ResizeFilter::AREA: average a grid of taps spread evenly over the output pixel.
+  uint2 tapCount = areaTapCount(yTexture, region, uniforms);
+  float2 tapSpacing = 1.0f / float2(tapCount);
+  float3 sum = float3(0.0f);
+  for (uint tapY = 0u; tapY < tapCount.y; tapY++) {
+    for (uint tapX = 0u; tapX < tapCount.x; tapX++) {
+      float2 outputPosition = float2(gid) + ((float2(tapX, tapY) + 0.5f) * tapSpacing);
+      sum += sampleInputRgb(yTexture, uvTexture, outputPosition, region, uniforms);
+    }
+  }
+  return sum / float(tapCount.x * tapCount.y);
+}
+
+// Arranges the output channels of one pixel. Only the first kChannelCount components are written, alpha is always opaque.
+inline float4 orderedColor(
   float3 rgb
 ) {
   switch (kChannelOrder) {
     case 0u: // 0u == ChannelOrder::RGB
-      return rgb;
+      return float4(rgb, 0.0f);
     case 1u: // 1u == ChannelOrder::BGR
-      return rgb.bgr;
+      return float4(rgb.bgr, 0.0f);
+    case 2u: // 2u == ChannelOrder::GRAY
+      // `sampleInputRgb` already returns the sampled luma in every channel.
+      return float4(rgb.r, 0.0f, 0.0f, 0.0f);
+    case 3u: // 3u == ChannelOrder::RGBA
+      return float4(rgb, 1.0f);
+    case 4u: // 4u == ChannelOrder::BGRA
+      return float4(rgb.bgr, 1.0f);
+    case 5u: // 5u == ChannelOrder::ARGB
+      return float4(1.0f, rgb);
     default:
       // Unsupported ChannelOrder ordinal. Fall back to black so broken channel orders fail visibly at runtime.
-      return float3(0.0f);
+      return float4(0.0f);
   }
 }
 
 inline uint outputIndex(
-  uint2 gid,
+  uint3 gid,
   uint channelIndex,
   constant ResizeUniforms& uniforms
 ) {
   uint pixelIndex = (gid.y * uniforms.outputWidth) + gid.x;
   uint pixelCount = uniforms.outputWidth * uniforms.outputHeight;
+  // Images of a batch are stored back-to-back, one per `gid.z`.
+  uint imageOffset = gid.z * pixelCount * kChannelCount;
 
   switch (kPixelLayout) {
     case 0u: // 0u == PixelLayout::INTERLEAVED == HWC / NHWC
-      return (pixelIndex * kChannelCount) + channelIndex;
+      return imageOffset + (pixelIndex * kChannelCount) + channelIndex;
     case 1u: // 1u == PixelLayout::PLANAR == CHW / NCHW
-      return (channelIndex * pixelCount) + pixelIndex;
+      return imageOffset + (channelIndex * pixelCount) + pixelIndex;
     default:
       // Unsupported PixelLayout ordinal. Fall back to index 0 so broken layouts fail visibly at runtime.
       return 0u;
   }
 }
 
+inline float4 normalizedColor(
+  float4 ordered
+) {
+  return fma(ordered, kChannelScale, kChannelBias);
+}
+
+// BT.601 luma of one output pixel, in 0..255.
+inline uint pixelLuma(float3 rgb) {
+  return uint(dot(rgb, float3(0.299f, 0.587f, 0.114f)) * 255.0f + 0.5f);
+}
+
+// The 16x16 grid cell one output pixel falls into, row-major.
+inline uint frameStatisticsCell(uint2 gid, constant ResizeUniforms& uniforms) {
+  uint column = (gid.x * kFrameStatisticsGridSize) / uniforms.outputWidth;
+  uint row = (gid.y * kFrameStatisticsGridSize) / uniforms.outputHeight;
+  return (row * kFrameStatisticsGridSize) + column;
+}
+
+inline void clearThreadgroupCellLumaSums(
+  threadgroup atomic_uint* threadgroupCellLumaSums,
+  uint threadIndex,
+  uint threadCount
+) {
+  for (uint cell = threadIndex; cell < kFrameStatisticsCellCount; cell += threadCount) {
+    atomic_store_explicit(&threadgroupCellLumaSums[cell], 0u, memory_order_relaxed);
+  }
+  threadgroup_barrier(mem_flags::mem_threadgroup);
+}
+
+// Adds the per-threadgroup sums to the global sums, so only one global atomic per touched cell is issued per threadgroup.
+inline void flushThreadgroupCellLumaSums(
+  threadgroup atomic_uint* threadgroupCellLumaSums,
+  device atomic_uint* cellLumaSums,
+  uint threadIndex,
+  uint threadCount
+) {
+  threadgroup_barrier(mem_flags::mem_threadgroup);
+  for (uint cell = threadIndex; cell < kFrameStatisticsCellCount; cell += threadCount) {
+    uint sum = atomic_load_explicit(&threadgroupCellLumaSums[cell], memory_order_relaxed);
+    if (sum != 0u) {
+      atomic_fetch_add_explicit(&cellLumaSums[cell], sum, memory_order_relaxed);
+    }
+  }
+}
+
 inline uchar quantizeUInt8(float value) {
-  int quantized = int(rint(value * 255.0f));
+  int quantized = int(rint(value * kInverseQuantizationScale) + kQuantizationZeroPoint);
   return uchar(clamp(quantized, 0, 255));
 }
 
 inline char quantizeInt8(float value) {
-  int quantized = int(rint(value * 255.0f)) - 128;
+  int quantized = int(rint(value * kInverseQuantizationScale) + kQuantizationZeroPoint);
   return char(clamp(quantized, -128, 127));
 }
 
@@ -159,18 +305,38 @@ kernel void resize_uint8(
   texture2d<float, access::sample> uvTexture [[texture(1)]],
   device uchar* output [[buffer(0)]],
   constant ResizeUniforms& uniforms [[buffer(1)]],
-  uint2 gid [[thread_position_in_grid]]
+  // One sampled input region per output image (`gid.z`): `xy` is the origin and `zw` is the size.
+  constant float4* regions [[buffer(2)]],
+  // Per-cell luma sums of the first image, only bound if `kFrameStatistics` is set.
+  device atomic_uint* cellLumaSums [[buffer(3), function_constant(kFrameStatistics)]],
+  uint3 gid [[thread_position_in_grid]],
+  uint threadIndex [[thread_index_in_threadgroup]],
+  uint3 threadsPerThreadgroup [[threads_per_threadgroup]]
 ) {
-  if (gid.x >= uniforms.outputWidth || gid.y >= uniforms.outputHeight) {
-    return;
+  threadgroup atomic_uint threadgroupCellLumaSums[kFrameStatisticsCellCount];
+  uint threadCount = threadsPerThreadgroup.x * threadsPerThreadgroup.y * threadsPerThreadgroup.z;
+  // Every thread of a threadgroup shares `gid.z`, so all of them take the same branches around the barriers.
+  bool accumulatesStatistics = kFrameStatistics && gid.z == 0u;
+  if (accumulatesStatistics) {
+    clearThreadgroupCellLumaSums(threadgroupCellLumaSums, threadIndex, threadCount);
   }
 
-  float3 rgb = sampleRgb(yTexture, uvTexture, gid, uniforms);
-  float3 ordered = orderedColor(rgb);
+  if (gid.x < uniforms.outputWidth && gid.y < uniforms.outputHeight) {
+    float3 rgb = sampleRgb(yTexture, uvTexture, gid.xy, regions[gid.z], uniforms);
+    if (accumulatesStatistics) {
+      atomic_fetch_add_explicit(
+        &threadgroupCellLumaSums[frameStatisticsCell(gid.xy, uniforms)], pixelLuma(rgb), memory_order_relaxed);
+    }
+    float4 normalized = normalizedColor(orderedColor(rgb));
+
+    for (uint channelIndex = 0u; channelIndex < kChannelCount; channelIndex++) {
+      uint index = outputIndex(gid, channelIndex, uniforms);
+      output[index] = quantizeUInt8(normalized[channelIndex]);
+    }
+  }
 
-  for (uint channelIndex = 0u; channelIndex < kChannelCount; channelIndex++) {
-    uint index = outputIndex(gid, channelIndex, uniforms);
-    output[index] = quantizeUInt8(ordered[channelIndex]);
+  if (accumulatesStatistics) {
+    flushThreadgroupCellLumaSums(threadgroupCellLumaSums, cellLumaSums, threadIndex, threadCount);
   }
 }
 
@@ -179,18 +345,38 @@ kernel void resize_int8(
   texture2d<float, access::sample> uvTexture [[texture(1)]],
   device char* output [[buffer(0)]],
   constant ResizeUniforms& uniforms [[buffer(1)]],
-  uint2 gid [[thread_position_in_grid]]
+  // One sampled input region per output image (`gid.z`): `xy` is the origin and `zw` is the size.
+  constant float4* regions [[buffer(2)]],
+  // Per-cell luma sums of the first image, only bound if `kFrameStatistics` is set.
+  device atomic_uint* cellLumaSums [[buffer(3), function_constant(kFrameStatistics)]],
+  uint3 gid [[thread_position_in_grid]],
+  uint threadIndex [[thread_index_in_threadgroup]],
+  uint3 threadsPerThreadgroup [[threads_per_threadgroup]]
 ) {
-  if (gid.x >= uniforms.outputWidth || gid.y >= uniforms.outputHeight) {
-    return;
+  threadgroup atomic_uint threadgroupCellLumaSums[kFrameStatisticsCellCount];
+  uint threadCount = threadsPerThreadgroup.x * threadsPerThreadgroup.y * threadsPerThreadgroup.z;
+  // Every thread of a threadgroup shares `gid.z`, so all of them take the same branches around the barriers.
+  bool accumulatesStatistics = kFrameStatistics && gid.z == 0u;
+  if (accumulatesStatistics) {
+    clearThreadgroupCellLumaSums(threadgroupCellLumaSums, threadIndex, threadCount);
   }
 
-  float3 rgb = sampleRgb(yTexture, uvTexture, gid, uniforms);
-  float3 ordered = orderedColor(rgb);
+  if (gid.x < uniforms.outputWidth && gid.y < uniforms.outputHeight) {
+    float3 rgb = sampleRgb(yTexture, uvTexture, gid.xy, regions[gid.z], uniforms);
+    if (accumulatesStatistics) {
+      atomic_fetch_add_explicit(
+        &threadgroupCellLumaSums[frameStatisticsCell(gid.xy, uniforms)], pixelLuma(rgb), memory_order_relaxed);
+    }
+    float4 normalized = normalizedColor(orderedColor(rgb));
+
+    for (uint channelIndex = 0u; channelIndex < kChannelCount; channelIndex++) {
+      uint index = outputIndex(gid, channelIndex, uniforms);
+      output[index] = quantizeInt8(normalized[channelIndex]);
+    }
+  }
 
-  for (uint channelIndex = 0u; channelIndex < kChannelCount; channelIndex++) {
-    uint index = outputIndex(gid, channelIndex, uniforms);
-    output[index] = quantizeInt8(ordered[channelIndex]);
+  if (accumulatesStatistics) {
+    flushThreadgroupCellLumaSums(threadgroupCellLumaSums, cellLumaSums, threadIndex, threadCount);
   }
 }
 
@@ -199,18 +385,38 @@ kernel void resize_float16(
   texture2d<float, access::sample> uvTexture [[texture(1)]],
   device half* output [[buffer(0)]],
   constant ResizeUniforms& uniforms [[buffer(1)]],
-  uint2 gid [[thread_position_in_grid]]
+  // One sampled input region per output image (`gid.z`): `xy` is the origin and `zw` is the size.
+  constant float4* regions [[buffer(2)]],
+  // Per-cell luma sums of the first image, only bound if `kFrameStatistics` is set.
+  device atomic_uint* cellLumaSums [[buffer(3), function_constant(kFrameStatistics)]],
+  uint3 gid [[thread_position_in_grid]],
+  uint threadIndex [[thread_index_in_threadgroup]],
+  uint3 threadsPerThreadgroup [[threads_per_threadgroup]]
 ) {
-  if (gid.x >= uniforms.outputWidth || gid.y >= uniforms.outputHeight) {
-    return;
+  threadgroup atomic_uint threadgroupCellLumaSums[kFrameStatisticsCellCount];
+  uint threadCount = threadsPerThreadgroup.x * threadsPerThreadgroup.y * threadsPerThreadgroup.z;
+  // Every thread of a threadgroup shares `gid.z`, so all of them take the same branches around the barriers.
+  bool accumulatesStatistics = kFrameStatistics && gid.z == 0u;
+  if (accumulatesStatistics) {
+    clearThreadgroupCellLumaSums(threadgroupCellLumaSums, threadIndex, threadCount);
   }
 
-  float3 rgb = sampleRgb(yTexture, uvTexture, gid, uniforms);
-  float3 ordered = orderedColor(rgb);
+  if (gid.x < uniforms.outputWidth && gid.y < uniforms.outputHeight) {
+    float3 rgb = sampleRgb(yTexture, uvTexture, gid.xy, regions[gid.z], uniforms);
+    if (accumulatesStatistics) {
+      atomic_fetch_add_explicit(
+        &threadgroupCellLumaSums[frameStatisticsCell(gid.xy, uniforms)], pixelLuma(rgb), memory_order_relaxed);
+    }
+    float4 normalized = normalizedColor(orderedColor(rgb));
+
+    for (uint channelIndex = 0u; channelIndex < kChannelCount; channelIndex++) {
+      uint index = outputIndex(gid, channelIndex, uniforms);
+      output[index] = half(normalized[channelIndex]);
+    }
+  }
 
-  for (uint channelIndex = 0u; channelIndex < kChannelCount; channelIndex++) {
-    uint index = outputIndex(gid, channelIndex, uniforms);
-    output[index] = half(ordered[channelIndex]);
+  if (accumulatesStatistics) {
+    flushThreadgroupCellLumaSums(threadgroupCellLumaSums, cellLumaSums, threadIndex, threadCount);
   }
 }
 
@@ -219,17 +425,37 @@ kernel void resize_float32(
   texture2d<float, access::sample> uvTexture [[texture(1)]],
   device float* output [[buffer(0)]],
   constant ResizeUniforms& uniforms [[buffer(1)]],
-  uint2 gid [[thread_position_in_grid]]
+  // One sampled input region per output image (`gid.z`): `xy` is the origin and `zw` is the size.
+  constant float4* regions [[buffer(2)]],
+  // Per-cell luma sums of the first image, only bound if `kFrameStatistics` is set.
+  device atomic_uint* cellLumaSums [[buffer(3), function_constant(kFrameStatistics)]],
+  uint3 gid [[thread_position_in_grid]],
+  uint threadIndex [[thread_index_in_threadgroup]],
+  uint3 threadsPerThreadgroup [[threads_per_threadgroup]]
 ) {
-  if (gid.x >= uniforms.outputWidth || gid.y >= uniforms.outputHeight) {
-    return;
+  threadgroup atomic_uint threadgroupCellLumaSums[kFrameStatisticsCellCount];
+  uint threadCount = threadsPerThreadgroup.x * threadsPerThreadgroup.y * threadsPerThreadgroup.z;
+  // Every thread of a threadgroup shares `gid.z`, so all of them take the same branches around the barriers.
+  bool accumulatesStatistics = kFrameStatistics && gid.z == 0u;
+  if (accumulatesStatistics) {
+    clearThreadgroupCellLumaSums(threadgroupCellLumaSums, threadIndex, threadCount);
   }
 
-  float3 rgb = sampleRgb(yTexture, uvTexture, gid, uniforms);
-  float3 ordered = orderedColor(rgb);
+  if (gid.x < uniforms.outputWidth && gid.y < uniforms.outputHeight) {
+    float3 rgb = sampleRgb(yTexture, uvTexture, gid.xy, regions[gid.z], uniforms);
+    if (accumulatesStatistics) {
+      atomic_fetch_add_explicit(
+        &threadgroupCellLumaSums[frameStatisticsCell(gid.xy, uniforms)], pixelLuma(rgb), memory_order_relaxed);
+    }
+    float4 normalized = normalizedColor(orderedColor(rgb));
+
+    for (uint channelIndex = 0u; channelIndex < kChannelCount; channelIndex++) {
+      uint index = outputIndex(gid, channelIndex, uniforms);
+      output[index] = normalized[channelIndex];
+    }
+  }
 
-  for (uint channelIndex = 0u; channelIndex < kChannelCount; channelIndex++) {
-    uint index = outputIndex(gid, channelIndex, uniforms);
-    output[index] = ordered[channelIndex];
+  if (accumulatesStatistics) {
+    flushThreadgroupCellLumaSums(threadgroupCellLumaSums, cellLumaSums, threadIndex, threadCount);
   }
 }
@@ -0,0 +1,54 @@
+//
+//  CropRegion.swift
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 17.10.26.
+//
+
+import NitroModules
+
+/// A region of the input buffer in normalized texture coordinates (`0.0` ... `1.0`), before rotation and mirroring.
+struct CropRegion {
+  let origin: SIMD2<Float>
+  let size: SIMD2<Float>
+
+  /// Selects the full input buffer.
+  static let full = CropRegion(origin: SIMD2(0, 0), size: SIMD2(1, 1))
+
+  private init(origin: SIMD2<Float>, size: SIMD2<Float>) {
+    self.origin = origin
+    self.size = size
+  }
+
+  /// The region as the kernel's `float4`: `xy` is the origin and `zw` is the size.
+  var shaderRegion: SIMD4<Float> {
+    return SIMD4(lowHalf: origin, highHalf: size)
+  }
+
+  /// Converts an optional crop `Rect` in input pixel coordinates into a normalized `CropRegion`.
+  /// The `Rect` is clamped to the input bounds, and a missing `Rect` selects the full input.
+  init(crop: Rect?, inputWidth: Int, inputHeight: Int) throws {
+    guard let crop else {
+      self = .full
+      return
+    }
+
+    let width = Double(inputWidth)
+    let height = Double(inputHeight)
+    let left = min(max(crop.left, 0), width)
+    let right = min(max(crop.right, 0), width)
+    let top = min(max(crop.top, 0), height)
+    let bottom = min(max(crop.bottom, 0), height)
+    // NaN fails every comparison, so this also rejects non-finite Rects.
+    guard left < right, top < bottom else {
+      throw RuntimeError.error(
+        withMessage:
+          "Crop Rect (left: \(crop.left), top: \(crop.top), right: \(crop.right), bottom: \(crop.bottom)) "
+          + "does not overlap the \(inputWidth)x\(inputHeight) Frame.")
+    }
+
+    self.init(
+      origin: SIMD2(Float(left / width), Float(top / height)),
+      size: SIMD2(Float((right - left) / width), Float((bottom - top) / height)))
+  }
+}
@@ -0,0 +1,67 @@
+//
+//  FrameStatistics+cellLumaSums.swift
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 17.10.26.
+//
+
+extension FrameStatistics {
+  /// The number of cells per axis of the thumbnail grid.
+  static let gridSize = 16
+  /// The number of cells of the thumbnail grid, and the number of sums the kernel writes.
+  static let cellCount = gridSize * gridSize
+
+  /// Finalizes the per-cell luma sums of one `width`x`height` output image into its statistics.
+  /// `motion` is only set if `previousThumbnail` is a full thumbnail of the previous frame.
+  init(cellLumaSums: UnsafePointer<UInt32>, width: Int, height: Int, previousThumbnail: [Double]?) {
+    let columnCounts = Self.cellPixelCounts(size: width)
+    let rowCounts = Self.cellPixelCounts(size: height)
+    let sourceColumns = Self.sourceCells(counts: columnCounts, size: width)
+    let sourceRows = Self.sourceCells(counts: rowCounts, size: height)
+
+    var thumbnail = [Double](repeating: 0, count: Self.cellCount)
+    var lumaSum: UInt64 = 0
+    for row in 0..<Self.gridSize {
+      for column in 0..<Self.gridSize {
+        let sourceRow = sourceRows[row]
+        let sourceColumn = sourceColumns[column]
+        let cellSum = cellLumaSums[sourceRow * Self.gridSize + sourceColumn]
+        let pixelCount = Double(rowCounts[sourceRow]) * Double(columnCounts[sourceColumn])
+        thumbnail[row * Self.gridSize + column] = Double(cellSum) / pixelCount
+        if sourceRow == row && sourceColumn == column {
+          lumaSum += UInt64(cellSum)
+        }
+      }
+    }
+    let meanLuma = Double(lumaSum) / (Double(width) * Double(height))
+
+    var motion: Double?
+    if let previousThumbnail, previousThumbnail.count == Self.cellCount {
+      let difference = zip(thumbnail, previousThumbnail).reduce(0.0) { $0 + abs($1.0 - $1.1) }
+      motion = difference / Double(Self.cellCount)
+    }
+    self.init(meanLuma: meanLuma, thumbnail: thumbnail, motion: motion)
+  }
+
+  /// The grid cell a pixel at `position` of an output axis `size` pixels long falls into.
+  private static func cell(position: Int, size: Int) -> Int {
+    return (position * gridSize) / size
+  }
+
+  /// Counts the pixels of an output axis `size` pixels long that fall into each grid cell.
+  private static func cellPixelCounts(size: Int) -> [Int] {
+    var counts = [Int](repeating: 0, count: gridSize)
+    for position in 0..<size {
+      counts[cell(position: position, size: size)] += 1
+    }
+    return counts
+  }
+
+  /// Maps every grid cell to the cell its value is read from. Outputs smaller than the grid leave some cells empty,
+  /// which repeat the cell of the pixel below them instead.
+  private static func sourceCells(counts: [Int], size: Int) -> [Int] {
+    return (0..<gridSize).map { cell in
+      counts[cell] > 0 ? cell : Self.cell(position: (cell * size) / gridSize, size: size)
+    }
+  }
+}
@@ -0,0 +1,30 @@
+//
+//  HybridFrameSpec+pixelBuffer.swift
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 29.10.25.
+//
+
+import CoreMedia
+import CoreVideo
+import NitroModules
+import VisionCamera
+
+extension HybridFrameSpec_protocol {
+  /**
+   * Returns the `CVPixelBuffer` backing this Frame, or throws if it is not a `NativeFrame` or has already been released.
+   */
+  func getPixelBuffer() throws -> CVPixelBuffer {
+    guard let nativeFrame = self as? any NativeFrame else {
+      throw RuntimeError.error(withMessage: "The given Frame is not of type `NativeFrame`!")
+    }
+    guard let sampleBuffer = nativeFrame.sampleBuffer else {
+      throw RuntimeError.error(withMessage: "The given Frame's `sampleBuffer` is no longer valid!")
+    }
+    guard let pixelBuffer = CMSampleBufferGetImageBuffer(sampleBuffer) else {
+      throw RuntimeError.error(
+        withMessage: "The given Frame does not contain a valid image buffer!")
+    }
+    return pixelBuffer
+  }
+}
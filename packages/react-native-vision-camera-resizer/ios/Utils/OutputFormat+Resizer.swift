@@ -14,14 +14,26 @@ extension ChannelOrder {
       return 0
     case .bgr:
       return 1
+    case .gray:
+      return 2
+    case .rgba:
+      return 3
+    case .bgra:
+      return 4
+    case .argb:
+      return 5
     }
   }
 
   /// Returns the number of packed output channels written for each pixel in this output layout.
   var channelsPerPixel: Int {
     switch self {
+    case .gray:
+      return 1
     case .rgb, .bgr:
       return 3
+    case .rgba, .bgra, .argb:
+      return 4
     }
   }
 
@@ -70,3 +82,15 @@ extension ScaleMode {
     }
   }
 }
+
+extension ResizeFilter {
+  /// Returns the integer ordinal expected by the GPU shaders for this filter.
+  var shaderOrdinal: UInt32 {
+    switch self {
+    case .bilinear:
+      return 0
+    case .area:
+      return 1
+    }
+  }
+}
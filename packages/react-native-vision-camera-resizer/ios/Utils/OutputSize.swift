@@ -0,0 +1,61 @@
+//
+//  OutputSize.swift
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 17.10.26.
+//
+
+import NitroModules
+
+/// The size of one output image, in output pixels.
+struct OutputSize: Equatable {
+  let width: Int
+  let height: Int
+}
+
+extension ResizerOptions {
+  /// Bounds the output allocation: 16384 is the largest texture size any supported GPU can sample into anyways.
+  private static let maxOutputDimension = 16384
+
+  /// The output size the Resizer was created with, which every `resize(...)` uses unless it requests its own.
+  var outputSize: OutputSize {
+    return OutputSize(width: Int(width), height: Int(height))
+  }
+
+  /// Validates `maxWidth`/`maxHeight` and returns the largest output size a single `resize(...)` may request.
+  func maxOutputSize() throws -> OutputSize {
+    let size = outputSize
+    return OutputSize(
+      width: try Self.dimension(
+        maxWidth ?? Double(size.width), min: size.width, max: Self.maxOutputDimension, name: "ResizerOptions.maxWidth"),
+      height: try Self.dimension(
+        maxHeight ?? Double(size.height), min: size.height, max: Self.maxOutputDimension, name: "ResizerOptions.maxHeight"))
+  }
+
+  /// Returns the output size of one `resize(...)` call. Each axis of `resizeOptions` falls back to the configured size on its own.
+  func requestedOutputSize(for resizeOptions: ResizeOptions?) throws -> OutputSize {
+    let size = outputSize
+    guard let resizeOptions, resizeOptions.width != nil || resizeOptions.height != nil else {
+      return size
+    }
+    let maxSize = try maxOutputSize()
+    return OutputSize(
+      width: try resizeOptions.width.map {
+        try Self.dimension($0, min: 1, max: maxSize.width, name: "ResizeOptions.width")
+      } ?? size.width,
+      height: try resizeOptions.height.map {
+        try Self.dimension($0, min: 1, max: maxSize.height, name: "ResizeOptions.height")
+      } ?? size.height)
+  }
+
+  private static func dimension(_ value: Double, min: Int, max: Int, name: String) throws -> Int {
+    guard value >= Double(min),
+      value <= Double(max),
+      value.rounded() == value
+    else {
+      throw RuntimeError.error(
+        withMessage: "\(name) must be an integer between \(min) and \(max), but was \(value).")
+    }
+    return Int(value)
+  }
+}
@@ -0,0 +1,102 @@
+//
+//  ResizeTransform+Resizer.swift
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 17.10.26.
+//
+
+import simd
+
+extension ResizeTransform {
+  /// Describes how the resize kernel placed `cropRegion` of a `inputWidth`x`inputHeight` buffer into the output:
+  /// the crop in input pixels, plus the scale and letterbox offset applied to the rotated and mirrored crop.
+  init(
+    cropRegion: CropRegion,
+    inputWidth: Int,
+    inputHeight: Int,
+    outputWidth: Int,
+    outputHeight: Int,
+    rotationDegrees: Int32,
+    isMirrored: Bool,
+    scaleMode: ScaleMode
+  ) {
+    let inputSize = SIMD2(Double(inputWidth), Double(inputHeight))
+    let origin = SIMD2<Double>(cropRegion.origin) * inputSize
+    let cropSize = SIMD2<Double>(cropRegion.size) * inputSize
+    let rotation = Self.normalizeRotation(rotationDegrees)
+    let uprightSize = Self.isSideways(rotation) ? SIMD2(cropSize.y, cropSize.x) : cropSize
+    let outputSize = SIMD2(Double(outputWidth), Double(outputHeight))
+
+    var scale = outputSize / uprightSize
+    switch scaleMode {
+    case .cover:
+      scale = SIMD2(repeating: scale.max())
+    case .contain:
+      scale = SIMD2(repeating: scale.min())
+    case .stretch:
+      break
+    }
+    let offset = (outputSize - uprightSize * scale) * 0.5
+
+    self.init(
+      crop: Rect(
+        left: origin.x, right: origin.x + cropSize.x, top: origin.y, bottom: origin.y + cropSize.y),
+      rotationDegrees: Double(rotation),
+      isMirrored: isMirrored,
+      scaleX: scale.x,
+      scaleY: scale.y,
+      offsetX: offset.x,
+      offsetY: offset.y)
+  }
+
+  /// Maps `pointCount` interleaved `x, y` output pixel coordinates back into input (Frame) pixel coordinates, in-place.
+  func convertOutputPointsToFramePoints(_ points: UnsafeMutablePointer<Float>, pointCount: Int) {
+    // Every step of the mapping is affine, so fold it into one 2x3 matrix and keep the per-point loop branch-free.
+    let origin = outputToInputPoint(SIMD2(0, 0))
+    let unitX = SIMD2<Float>(outputToInputPoint(SIMD2(1, 0)) - origin)
+    let unitY = SIMD2<Float>(outputToInputPoint(SIMD2(0, 1)) - origin)
+    let translation = SIMD2<Float>(origin)
+
+    points.withMemoryRebound(to: SIMD2<Float>.self, capacity: pointCount) { pairs in
+      for i in 0..<pointCount {
+        let point = pairs[i]
+        pairs[i] = unitX * point.x + unitY * point.y + translation
+      }
+    }
+  }
+
+  /// Mirrors the coordinate mapping of `sampleRgb(...)` in `ResizerKernels.metal`: output pixel -> input pixel, without clamping to the crop.
+  private func outputToInputPoint(_ output: SIMD2<Double>) -> SIMD2<Double> {
+    let rotation = Self.normalizeRotation(Int32(rotationDegrees))
+    let cropOrigin = SIMD2(crop.left, crop.top)
+    let cropSize = SIMD2(crop.right - crop.left, crop.bottom - crop.top)
+    let uprightSize = Self.isSideways(rotation) ? SIMD2(cropSize.y, cropSize.x) : cropSize
+
+    // Undo the scale and letterbox offset, normalized to the upright crop.
+    var coordinate = (output - SIMD2(offsetX, offsetY)) / SIMD2(scaleX, scaleY) / uprightSize
+    // Undo rotation before mirroring, exactly like the kernel.
+    switch (360 - rotation) % 360 {
+    case 90:
+      coordinate = SIMD2(1 - coordinate.y, coordinate.x)
+    case 180:
+      coordinate = SIMD2(1 - coordinate.x, 1 - coordinate.y)
+    case 270:
+      coordinate = SIMD2(coordinate.y, 1 - coordinate.x)
+    default:
+      break
+    }
+    if isMirrored {
+      coordinate.x = 1 - coordinate.x
+    }
+    return cropOrigin + coordinate * cropSize
+  }
+
+  private static func normalizeRotation(_ rotationDegrees: Int32) -> Int32 {
+    let rotation = rotationDegrees % 360
+    return rotation < 0 ? rotation + 360 : rotation
+  }
+
+  private static func isSideways(_ rotationDegrees: Int32) -> Bool {
+    return rotationDegrees == 90 || rotationDegrees == 270
+  }
+}
@@ -0,0 +1,99 @@
+//
+//  ResizerNormalization.swift
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 17.10.26.
+//
+
+import NitroModules
+
+/// The fused per-channel normalization and quantization applied to every output value.
+///
+/// Channels are in output `ChannelOrder`, and each value is written as `x * channelScale + channelBias`,
+/// i.e. `(x - mean) / standardDeviation`, before 8-bit outputs are quantized with
+/// `round(value * inverseQuantizationScale) + quantizationZeroPoint`.
+struct ResizerNormalization {
+  /// Channels beyond the `ChannelOrder`'s channel count are unused, and stay an identity scale.
+  let channelScale: SIMD4<Float>
+  let channelBias: SIMD4<Float>
+  let inverseQuantizationScale: Float
+  let quantizationZeroPoint: Float
+
+  /// Validates the normalization options of `options` and folds them into per-channel multiply-add factors.
+  init(options: ResizerOptions) throws {
+    let channelCount = options.channelOrder.channelsPerPixel
+    let mean = try Self.perChannelValues(
+      options.mean, defaultValue: 0, channelCount: channelCount, name: "mean")
+    let standardDeviation = try Self.perChannelValues(
+      options.standardDeviation, defaultValue: 1, channelCount: channelCount,
+      name: "standardDeviation")
+    if standardDeviation.contains(0) {
+      throw RuntimeError.error(withMessage: "ResizerOptions.standardDeviation must not contain zero.")
+    }
+    // (x - mean) / std == x * (1 / std) + (-mean / std), which the kernel evaluates as a single fma.
+    var channelScale = SIMD4<Float>(repeating: 1)
+    var channelBias = SIMD4<Float>(repeating: 0)
+    for channel in 0..<channelCount {
+      channelScale[channel] = Float(1.0 / standardDeviation[channel])
+      channelBias[channel] = Float(-mean[channel] / standardDeviation[channel])
+    }
+    self.channelScale = channelScale
+    self.channelBias = channelBias
+
+    let quantizationRange: ClosedRange<Double>
+    switch options.dataType {
+    case .uint8:
+      quantizationRange = 0...255
+    case .int8:
+      quantizationRange = -128...127
+    case .float16, .float32:
+      if options.quantizationScale != nil || options.quantizationZeroPoint != nil {
+        throw RuntimeError.error(
+          withMessage:
+            "ResizerOptions.quantizationScale and ResizerOptions.quantizationZeroPoint are only supported for 'int8' and 'uint8' outputs."
+        )
+      }
+      inverseQuantizationScale = 0
+      quantizationZeroPoint = 0
+      return
+    }
+
+    // Defaults reproduce the plain [0, 1] -> [0, 255] (uint8) or [-128, 127] (int8) mapping.
+    let quantizationScale = options.quantizationScale ?? (1.0 / 255.0)
+    let zeroPoint = options.quantizationZeroPoint ?? quantizationRange.lowerBound
+    guard quantizationScale.isFinite, quantizationScale > 0 else {
+      throw RuntimeError.error(
+        withMessage:
+          "ResizerOptions.quantizationScale must be greater than zero, but was \(quantizationScale).")
+    }
+    guard zeroPoint.rounded() == zeroPoint, quantizationRange.contains(zeroPoint) else {
+      throw RuntimeError.error(
+        withMessage:
+          "ResizerOptions.quantizationZeroPoint must be an integer between \(Int(quantizationRange.lowerBound)) and \(Int(quantizationRange.upperBound)), but was \(zeroPoint)."
+      )
+    }
+    inverseQuantizationScale = Float(1.0 / quantizationScale)
+    quantizationZeroPoint = Float(zeroPoint)
+  }
+
+  /// Expands a per-channel option to one value per output channel, broadcasting a single value to every channel.
+  private static func perChannelValues(
+    _ values: [Double]?,
+    defaultValue: Double,
+    channelCount: Int,
+    name: String
+  ) throws -> [Double] {
+    guard let values else {
+      return Array(repeating: defaultValue, count: channelCount)
+    }
+    guard values.count == 1 || values.count == channelCount else {
+      throw RuntimeError.error(
+        withMessage:
+          "ResizerOptions.\(name) must contain 1 or \(channelCount) values, but contained \(values.count).")
+    }
+    guard values.allSatisfy({ $0.isFinite }) else {
+      throw RuntimeError.error(withMessage: "ResizerOptions.\(name) must only contain finite values.")
+    }
+    return values.count == 1 ? Array(repeating: values[0], count: channelCount) : values
+  }
+}
@@ -0,0 +1,37 @@
+//
+//  ResizerOptions+TextureOutput.swift
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 17.10.26.
+//
+
+import NitroModules
+
+extension ResizerOptions {
+  /// Whether this output is also copied into a `CVPixelBuffer` that other GPU consumers (e.g. Skia) can sample.
+  var isTextureOutput: Bool {
+    return outputBufferType == .texture
+  }
+
+  /// Validates that a `'texture'` output can be copied as-is into a 32BGRA `CVPixelBuffer`. Does nothing for other outputs.
+  func validateTextureOutput() throws {
+    guard isTextureOutput else {
+      return
+    }
+    guard dataType == .uint8, pixelLayout == .interleaved, channelOrder == .bgra else {
+      throw RuntimeError.error(
+        withMessage:
+          "ResizerOptions.outputBufferType 'texture' requires dataType 'uint8', pixelLayout 'interleaved' and channelOrder 'bgra'.")
+    }
+    guard (maxBatchSize ?? 1) == 1 else {
+      throw RuntimeError.error(
+        withMessage:
+          "ResizerOptions.outputBufferType 'texture' holds a single image, so it requires a maxBatchSize of 1.")
+    }
+    guard try maxOutputSize() == outputSize else {
+      throw RuntimeError.error(
+        withMessage:
+          "ResizerOptions.outputBufferType 'texture' has a fixed size, so it does not support ResizerOptions.maxWidth/maxHeight.")
+    }
+  }
+}
@@ -34,6 +34,7 @@ target_sources(
   ../nitrogen/generated/android/VisionCameraResizerOnLoad.cpp
   # Shared Nitrogen C++ sources
   ../nitrogen/generated/shared/c++/HybridGPUFrameSpec.cpp
+  ../nitrogen/generated/shared/c++/HybridMultiResizerSpec.cpp
   ../nitrogen/generated/shared/c++/HybridResizerSpec.cpp
   ../nitrogen/generated/shared/c++/HybridResizerFactorySpec.cpp
   # Android-specific Nitrogen C++ sources
@@ -9,6 +9,7 @@
 
 // Include C++ implementation defined types
 #include "HybridGPUFrameSpecSwift.hpp"
+#include "HybridMultiResizerSpecSwift.hpp"
 #include "HybridResizerFactorySpecSwift.hpp"
 #include "HybridResizerSpecSwift.hpp"
 #include "VisionCameraResizer-Swift-Cxx-Umbrella.hpp"
@@ -59,10 +60,10 @@ namespace margelo::nitro::camera::resizer::bridge::swift {
     return swiftPart.toUnsafe();
   }
   
-  // pragma MARK: std::function<void(const std::shared_ptr<HybridResizerSpec>& /* result */)>
-  Func_void_std__shared_ptr_HybridResizerSpec_ create_Func_void_std__shared_ptr_HybridResizerSpec_(void* NON_NULL swiftClosureWrapper) noexcept {
-    auto swiftClosure = VisionCameraResizer::Func_void_std__shared_ptr_HybridResizerSpec_::fromUnsafe(swiftClosureWrapper);
-    return [swiftClosure = std::move(swiftClosure)](const std::shared_ptr<HybridResizerSpec>& result) mutable -> void {
+  // pragma MARK: std::function<void(const std::shared_ptr<HybridGPUFrameSpec>& /* result */)>
+  Func_void_std__shared_ptr_HybridGPUFrameSpec_ create_Func_void_std__shared_ptr_HybridGPUFrameSpec_(void* NON_NULL swiftClosureWrapper) noexcept {
+    auto swiftClosure = VisionCameraResizer::Func_void_std__shared_ptr_HybridGPUFrameSpec_::fromUnsafe(swiftClosureWrapper);
+    return [swiftClosure = std::move(swiftClosure)](const std::shared_ptr<HybridGPUFrameSpec>& result) mutable -> void {
       swiftClosure.call(result);
     };
   }
@@ -75,6 +76,54 @@ namespace margelo::nitro::camera::resizer::bridge::swift {
     };
   }
   
+  // pragma MARK: std::shared_ptr<HybridMultiResizerSpec>
+  std::shared_ptr<HybridMultiResizerSpec> create_std__shared_ptr_HybridMultiResizerSpec_(void* NON_NULL swiftUnsafePointer) noexcept {
+    VisionCameraResizer::HybridMultiResizerSpec_cxx swiftPart = VisionCameraResizer::HybridMultiResizerSpec_cxx::fromUnsafe(swiftUnsafePointer);
+    return std::make_shared<margelo::nitro::camera::resizer::HybridMultiResizerSpecSwift>(swiftPart);
+  }
+  void* NON_NULL get_std__shared_ptr_HybridMultiResizerSpec_(std__shared_ptr_HybridMultiResizerSpec_ cppType) {
+    std::shared_ptr<margelo::nitro::camera::resizer::HybridMultiResizerSpecSwift> swiftWrapper = std::dynamic_pointer_cast<margelo::nitro::camera::resizer::HybridMultiResizerSpecSwift>(cppType);
+    #ifdef NITRO_DEBUG
+    if (swiftWrapper == nullptr) [[unlikely]] {
+      throw std::runtime_error("Class \"HybridMultiResizerSpec\" is not implemented in Swift!");
+    }
+    #endif
+    VisionCameraResizer::HybridMultiResizerSpec_cxx& swiftPart = swiftWrapper->getSwiftPart();
+    return swiftPart.toUnsafe();
+  }
+  
+  // pragma MARK: std::function<void(const std::vector<std::shared_ptr<HybridGPUFrameSpec>>& /* result */)>
+  Func_void_std__vector_std__shared_ptr_HybridGPUFrameSpec__ create_Func_void_std__vector_std__shared_ptr_HybridGPUFrameSpec__(void* NON_NULL swiftClosureWrapper) noexcept {
+    auto swiftClosure = VisionCameraResizer::Func_void_std__vector_std__shared_ptr_HybridGPUFrameSpec__::fromUnsafe(swiftClosureWrapper);
+    return [swiftClosure = std::move(swiftClosure)](const std::vector<std::shared_ptr<HybridGPUFrameSpec>>& result) mutable -> void {
+      swiftClosure.call(result);
+    };
+  }
+  
+  // pragma MARK: std::function<void(const std::shared_ptr<HybridResizerSpec>& /* result */)>
+  Func_void_std__shared_ptr_HybridResizerSpec_ create_Func_void_std__shared_ptr_HybridResizerSpec_(void* NON_NULL swiftClosureWrapper) noexcept {
+    auto swiftClosure = VisionCameraResizer::Func_void_std__shared_ptr_HybridResizerSpec_::fromUnsafe(swiftClosureWrapper);
+    return [swiftClosure = std::move(swiftClosure)](const std::shared_ptr<HybridResizerSpec>& result) mutable -> void {
+      swiftClosure.call(result);
+    };
+  }
+  
+  // pragma MARK: std::function<void(const std::shared_ptr<HybridMultiResizerSpec>& /* result */)>
+  Func_void_std__shared_ptr_HybridMultiResizerSpec_ create_Func_void_std__shared_ptr_HybridMultiResizerSpec_(void* NON_NULL swiftClosureWrapper) noexcept {
+    auto swiftClosure = VisionCameraResizer::Func_void_std__shared_ptr_HybridMultiResizerSpec_::fromUnsafe(swiftClosureWrapper);
+    return [swiftClosure = std::move(swiftClosure)](const std::shared_ptr<HybridMultiResizerSpec>& result) mutable -> void {
+      swiftClosure.call(result);
+    };
+  }
+  
+  // pragma MARK: std::function<void()>
+  Func_void create_Func_void(void* NON_NULL swiftClosureWrapper) noexcept {
+    auto swiftClosure = VisionCameraResizer::Func_void::fromUnsafe(swiftClosureWrapper);
+    return [swiftClosure = std::move(swiftClosure)]() mutable -> void {
+      swiftClosure.call();
+    };
+  }
+  
   // pragma MARK: std::shared_ptr<HybridResizerFactorySpec>
   std::shared_ptr<HybridResizerFactorySpec> create_std__shared_ptr_HybridResizerFactorySpec_(void* NON_NULL swiftUnsafePointer) noexcept {
     VisionCameraResizer::HybridResizerFactorySpec_cxx swiftPart = VisionCameraResizer::HybridResizerFactorySpec_cxx::fromUnsafe(swiftUnsafePointer);
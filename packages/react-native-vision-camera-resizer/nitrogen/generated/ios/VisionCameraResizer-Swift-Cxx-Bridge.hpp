@@ -12,22 +12,52 @@
 namespace margelo::nitro::camera::resizer { enum class ChannelOrder; }
 // Forward declaration of `DataType` to properly resolve imports.
 namespace margelo::nitro::camera::resizer { enum class DataType; }
+// Forward declaration of `FrameStatistics` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct FrameStatistics; }
 // Forward declaration of `HybridFrameSpec` to properly resolve imports.
 namespace margelo::nitro::camera { class HybridFrameSpec; }
 // Forward declaration of `HybridGPUFrameSpec` to properly resolve imports.
 namespace margelo::nitro::camera::resizer { class HybridGPUFrameSpec; }
+// Forward declaration of `HybridMultiResizerSpec` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { class HybridMultiResizerSpec; }
 // Forward declaration of `HybridResizerFactorySpec` to properly resolve imports.
 namespace margelo::nitro::camera::resizer { class HybridResizerFactorySpec; }
 // Forward declaration of `HybridResizerSpec` to properly resolve imports.
 namespace margelo::nitro::camera::resizer { class HybridResizerSpec; }
+// Forward declaration of `ImportCacheStatistics` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct ImportCacheStatistics; }
+// Forward declaration of `NativeBuffer` to properly resolve imports.
+namespace margelo::nitro::camera { struct NativeBuffer; }
+// Forward declaration of `OutputBufferType` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { enum class OutputBufferType; }
 // Forward declaration of `PixelLayout` to properly resolve imports.
 namespace margelo::nitro::camera::resizer { enum class PixelLayout; }
+// Forward declaration of `Rect` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct Rect; }
+// Forward declaration of `ResizeFilter` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { enum class ResizeFilter; }
+// Forward declaration of `ResizeOptions` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct ResizeOptions; }
+// Forward declaration of `ResizeTransform` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct ResizeTransform; }
+// Forward declaration of `ResizerOptions` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct ResizerOptions; }
+// Forward declaration of `ResizerStatistics` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct ResizerStatistics; }
+// Forward declaration of `ResizerTimingStatistics` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct ResizerTimingStatistics; }
+// Forward declaration of `ScaleMode` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { enum class ScaleMode; }
+// Forward declaration of `StageTimingStatistics` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct StageTimingStatistics; }
 
 // Forward declarations of Swift defined types
 // Forward declaration of `HybridFrameSpec_cxx` to properly resolve imports.
 namespace VisionCamera { class HybridFrameSpec_cxx; }
 // Forward declaration of `HybridGPUFrameSpec_cxx` to properly resolve imports.
 namespace VisionCameraResizer { class HybridGPUFrameSpec_cxx; }
+// Forward declaration of `HybridMultiResizerSpec_cxx` to properly resolve imports.
+namespace VisionCameraResizer { class HybridMultiResizerSpec_cxx; }
 // Forward declaration of `HybridResizerFactorySpec_cxx` to properly resolve imports.
 namespace VisionCameraResizer { class HybridResizerFactorySpec_cxx; }
 // Forward declaration of `HybridResizerSpec_cxx` to properly resolve imports.
@@ -36,19 +66,34 @@ namespace VisionCameraResizer { class HybridResizerSpec_cxx; }
 // Include C++ defined types
 #include "ChannelOrder.hpp"
 #include "DataType.hpp"
+#include "FrameStatistics.hpp"
 #include "HybridGPUFrameSpec.hpp"
+#include "HybridMultiResizerSpec.hpp"
 #include "HybridResizerFactorySpec.hpp"
 #include "HybridResizerSpec.hpp"
+#include "ImportCacheStatistics.hpp"
+#include "OutputBufferType.hpp"
 #include "PixelLayout.hpp"
+#include "Rect.hpp"
+#include "ResizeFilter.hpp"
+#include "ResizeOptions.hpp"
+#include "ResizeTransform.hpp"
+#include "ResizerOptions.hpp"
+#include "ResizerStatistics.hpp"
+#include "ResizerTimingStatistics.hpp"
+#include "ScaleMode.hpp"
+#include "StageTimingStatistics.hpp"
 #include <NitroModules/ArrayBuffer.hpp>
 #include <NitroModules/Promise.hpp>
 #include <NitroModules/PromiseHolder.hpp>
 #include <NitroModules/Result.hpp>
 #include <VisionCamera/HybridFrameSpec.hpp>
+#include <VisionCamera/NativeBuffer.hpp>
 #include <exception>
 #include <functional>
 #include <memory>
 #include <optional>
+#include <vector>
 
 /**
  * Contains specialized versions of C++ templated types so they can be accessed from Swift,
@@ -101,6 +146,107 @@ namespace margelo::nitro::camera::resizer::bridge::swift {
     return optional.value();
   }
   
+  // pragma MARK: std::optional<OutputBufferType>
+  /**
+   * Specialized version of `std::optional<OutputBufferType>`.
+   */
+  using std__optional_OutputBufferType_ = std::optional<OutputBufferType>;
+  inline std::optional<OutputBufferType> create_std__optional_OutputBufferType_(const OutputBufferType& value) noexcept {
+    return std::optional<OutputBufferType>(value);
+  }
+  inline bool has_value_std__optional_OutputBufferType_(const std::optional<OutputBufferType>& optional) noexcept {
+    return optional.has_value();
+  }
+  inline OutputBufferType get_std__optional_OutputBufferType_(const std::optional<OutputBufferType>& optional) noexcept {
+    return optional.value();
+  }
+  
+  // pragma MARK: std::optional<double>
+  /**
+   * Specialized version of `std::optional<double>`.
+   */
+  using std__optional_double_ = std::optional<double>;
+  inline std::optional<double> create_std__optional_double_(const double& value) noexcept {
+    return std::optional<double>(value);
+  }
+  inline bool has_value_std__optional_double_(const std::optional<double>& optional) noexcept {
+    return optional.has_value();
+  }
+  inline double get_std__optional_double_(const std::optional<double>& optional) noexcept {
+    return optional.value();
+  }
+  
+  // pragma MARK: std::vector<double>
+  /**
+   * Specialized version of `std::vector<double>`.
+   */
+  using std__vector_double_ = std::vector<double>;
+  inline std::vector<double> create_std__vector_double_(size_t size) noexcept {
+    std::vector<double> vector;
+    vector.reserve(size);
+    return vector;
+  }
+  
+  // pragma MARK: std::optional<std::vector<double>>
+  /**
+   * Specialized version of `std::optional<std::vector<double>>`.
+   */
+  using std__optional_std__vector_double__ = std::optional<std::vector<double>>;
+  inline std::optional<std::vector<double>> create_std__optional_std__vector_double__(const std::vector<double>& value) noexcept {
+    return std::optional<std::vector<double>>(value);
+  }
+  inline bool has_value_std__optional_std__vector_double__(const std::optional<std::vector<double>>& optional) noexcept {
+    return optional.has_value();
+  }
+  inline std::vector<double> get_std__optional_std__vector_double__(const std::optional<std::vector<double>>& optional) noexcept {
+    return optional.value();
+  }
+  
+  // pragma MARK: std::optional<bool>
+  /**
+   * Specialized version of `std::optional<bool>`.
+   */
+  using std__optional_bool_ = std::optional<bool>;
+  inline std::optional<bool> create_std__optional_bool_(const bool& value) noexcept {
+    return std::optional<bool>(value);
+  }
+  inline bool has_value_std__optional_bool_(const std::optional<bool>& optional) noexcept {
+    return optional.has_value();
+  }
+  inline bool get_std__optional_bool_(const std::optional<bool>& optional) noexcept {
+    return optional.value();
+  }
+  
+  // pragma MARK: std::optional<ResizeFilter>
+  /**
+   * Specialized version of `std::optional<ResizeFilter>`.
+   */
+  using std__optional_ResizeFilter_ = std::optional<ResizeFilter>;
+  inline std::optional<ResizeFilter> create_std__optional_ResizeFilter_(const ResizeFilter& value) noexcept {
+    return std::optional<ResizeFilter>(value);
+  }
+  inline bool has_value_std__optional_ResizeFilter_(const std::optional<ResizeFilter>& optional) noexcept {
+    return optional.has_value();
+  }
+  inline ResizeFilter get_std__optional_ResizeFilter_(const std::optional<ResizeFilter>& optional) noexcept {
+    return optional.value();
+  }
+  
+  // pragma MARK: std::optional<FrameStatistics>
+  /**
+   * Specialized version of `std::optional<FrameStatistics>`.
+   */
+  using std__optional_FrameStatistics_ = std::optional<FrameStatistics>;
+  inline std::optional<FrameStatistics> create_std__optional_FrameStatistics_(const FrameStatistics& value) noexcept {
+    return std::optional<FrameStatistics>(value);
+  }
+  inline bool has_value_std__optional_FrameStatistics_(const std::optional<FrameStatistics>& optional) noexcept {
+    return optional.has_value();
+  }
+  inline FrameStatistics get_std__optional_FrameStatistics_(const std::optional<FrameStatistics>& optional) noexcept {
+    return optional.value();
+  }
+  
   // pragma MARK: std::shared_ptr<HybridGPUFrameSpec>
   /**
    * Specialized version of `std::shared_ptr<HybridGPUFrameSpec>`.
@@ -122,6 +268,33 @@ namespace margelo::nitro::camera::resizer::bridge::swift {
     return Result<std::shared_ptr<ArrayBuffer>>::withError(error);
   }
   
+  // pragma MARK: Result<NativeBuffer>
+  using Result_NativeBuffer_ = Result<NativeBuffer>;
+  inline Result_NativeBuffer_ create_Result_NativeBuffer_(const NativeBuffer& value) noexcept {
+    return Result<NativeBuffer>::withValue(value);
+  }
+  inline Result_NativeBuffer_ create_Result_NativeBuffer_(const std::exception_ptr& error) noexcept {
+    return Result<NativeBuffer>::withError(error);
+  }
+  
+  // pragma MARK: Result<ResizeTransform>
+  using Result_ResizeTransform_ = Result<ResizeTransform>;
+  inline Result_ResizeTransform_ create_Result_ResizeTransform_(const ResizeTransform& value) noexcept {
+    return Result<ResizeTransform>::withValue(value);
+  }
+  inline Result_ResizeTransform_ create_Result_ResizeTransform_(const std::exception_ptr& error) noexcept {
+    return Result<ResizeTransform>::withError(error);
+  }
+  
+  // pragma MARK: Result<void>
+  using Result_void_ = Result<void>;
+  inline Result_void_ create_Result_void_() noexcept {
+    return Result<void>::withValue();
+  }
+  inline Result_void_ create_Result_void_(const std::exception_ptr& error) noexcept {
+    return Result<void>::withError(error);
+  }
+  
   // pragma MARK: std::shared_ptr<margelo::nitro::camera::HybridFrameSpec>
   /**
    * Specialized version of `std::shared_ptr<margelo::nitro::camera::HybridFrameSpec>`.
@@ -146,6 +319,47 @@ namespace margelo::nitro::camera::resizer::bridge::swift {
   using std__weak_ptr_HybridResizerSpec_ = std::weak_ptr<HybridResizerSpec>;
   inline std__weak_ptr_HybridResizerSpec_ weakify_std__shared_ptr_HybridResizerSpec_(const std::shared_ptr<HybridResizerSpec>& strong) noexcept { return strong; }
   
+  // pragma MARK: std::optional<Rect>
+  /**
+   * Specialized version of `std::optional<Rect>`.
+   */
+  using std__optional_Rect_ = std::optional<Rect>;
+  inline std::optional<Rect> create_std__optional_Rect_(const Rect& value) noexcept {
+    return std::optional<Rect>(value);
+  }
+  inline bool has_value_std__optional_Rect_(const std::optional<Rect>& optional) noexcept {
+    return optional.has_value();
+  }
+  inline Rect get_std__optional_Rect_(const std::optional<Rect>& optional) noexcept {
+    return optional.value();
+  }
+  
+  // pragma MARK: std::vector<Rect>
+  /**
+   * Specialized version of `std::vector<Rect>`.
+   */
+  using std__vector_Rect_ = std::vector<Rect>;
+  inline std::vector<Rect> create_std__vector_Rect_(size_t size) noexcept {
+    std::vector<Rect> vector;
+    vector.reserve(size);
+    return vector;
+  }
+  
+  // pragma MARK: std::optional<ResizeOptions>
+  /**
+   * Specialized version of `std::optional<ResizeOptions>`.
+   */
+  using std__optional_ResizeOptions_ = std::optional<ResizeOptions>;
+  inline std::optional<ResizeOptions> create_std__optional_ResizeOptions_(const ResizeOptions& value) noexcept {
+    return std::optional<ResizeOptions>(value);
+  }
+  inline bool has_value_std__optional_ResizeOptions_(const std::optional<ResizeOptions>& optional) noexcept {
+    return optional.has_value();
+  }
+  inline ResizeOptions get_std__optional_ResizeOptions_(const std::optional<ResizeOptions>& optional) noexcept {
+    return optional.value();
+  }
+  
   // pragma MARK: Result<std::shared_ptr<HybridGPUFrameSpec>>
   using Result_std__shared_ptr_HybridGPUFrameSpec__ = Result<std::shared_ptr<HybridGPUFrameSpec>>;
   inline Result_std__shared_ptr_HybridGPUFrameSpec__ create_Result_std__shared_ptr_HybridGPUFrameSpec__(const std::shared_ptr<HybridGPUFrameSpec>& value) noexcept {
@@ -155,38 +369,38 @@ namespace margelo::nitro::camera::resizer::bridge::swift {
     return Result<std::shared_ptr<HybridGPUFrameSpec>>::withError(error);
   }
   
-  // pragma MARK: std::shared_ptr<Promise<std::shared_ptr<HybridResizerSpec>>>
+  // pragma MARK: std::shared_ptr<Promise<std::shared_ptr<HybridGPUFrameSpec>>>
   /**
-   * Specialized version of `std::shared_ptr<Promise<std::shared_ptr<HybridResizerSpec>>>`.
+   * Specialized version of `std::shared_ptr<Promise<std::shared_ptr<HybridGPUFrameSpec>>>`.
    */
-  using std__shared_ptr_Promise_std__shared_ptr_HybridResizerSpec___ = std::shared_ptr<Promise<std::shared_ptr<HybridResizerSpec>>>;
-  inline std::shared_ptr<Promise<std::shared_ptr<HybridResizerSpec>>> create_std__shared_ptr_Promise_std__shared_ptr_HybridResizerSpec___() noexcept {
-    return Promise<std::shared_ptr<HybridResizerSpec>>::create();
+  using std__shared_ptr_Promise_std__shared_ptr_HybridGPUFrameSpec___ = std::shared_ptr<Promise<std::shared_ptr<HybridGPUFrameSpec>>>;
+  inline std::shared_ptr<Promise<std::shared_ptr<HybridGPUFrameSpec>>> create_std__shared_ptr_Promise_std__shared_ptr_HybridGPUFrameSpec___() noexcept {
+    return Promise<std::shared_ptr<HybridGPUFrameSpec>>::create();
   }
-  inline PromiseHolder<std::shared_ptr<HybridResizerSpec>> wrap_std__shared_ptr_Promise_std__shared_ptr_HybridResizerSpec___(std::shared_ptr<Promise<std::shared_ptr<HybridResizerSpec>>> promise) noexcept {
-    return PromiseHolder<std::shared_ptr<HybridResizerSpec>>(std::move(promise));
+  inline PromiseHolder<std::shared_ptr<HybridGPUFrameSpec>> wrap_std__shared_ptr_Promise_std__shared_ptr_HybridGPUFrameSpec___(std::shared_ptr<Promise<std::shared_ptr<HybridGPUFrameSpec>>> promise) noexcept {
+    return PromiseHolder<std::shared_ptr<HybridGPUFrameSpec>>(std::move(promise));
   }
   
-  // pragma MARK: std::function<void(const std::shared_ptr<HybridResizerSpec>& /* result */)>
+  // pragma MARK: std::function<void(const std::shared_ptr<HybridGPUFrameSpec>& /* result */)>
   /**
-   * Specialized version of `std::function<void(const std::shared_ptr<HybridResizerSpec>&)>`.
+   * Specialized version of `std::function<void(const std::shared_ptr<HybridGPUFrameSpec>&)>`.
    */
-  using Func_void_std__shared_ptr_HybridResizerSpec_ = std::function<void(const std::shared_ptr<HybridResizerSpec>& /* result */)>;
+  using Func_void_std__shared_ptr_HybridGPUFrameSpec_ = std::function<void(const std::shared_ptr<HybridGPUFrameSpec>& /* result */)>;
   /**
-   * Wrapper class for a `std::function<void(const std::shared_ptr<HybridResizerSpec>& / * result * /)>`, this can be used from Swift.
+   * Wrapper class for a `std::function<void(const std::shared_ptr<HybridGPUFrameSpec>& / * result * /)>`, this can be used from Swift.
    */
-  class Func_void_std__shared_ptr_HybridResizerSpec__Wrapper final {
+  class Func_void_std__shared_ptr_HybridGPUFrameSpec__Wrapper final {
   public:
-    explicit Func_void_std__shared_ptr_HybridResizerSpec__Wrapper(std::function<void(const std::shared_ptr<HybridResizerSpec>& /* result */)>&& func): _function(std::make_unique<std::function<void(const std::shared_ptr<HybridResizerSpec>& /* result */)>>(std::move(func))) {}
-    inline void call(std::shared_ptr<HybridResizerSpec> result) const noexcept {
+    explicit Func_void_std__shared_ptr_HybridGPUFrameSpec__Wrapper(std::function<void(const std::shared_ptr<HybridGPUFrameSpec>& /* result */)>&& func): _function(std::make_unique<std::function<void(const std::shared_ptr<HybridGPUFrameSpec>& /* result */)>>(std::move(func))) {}
+    inline void call(std::shared_ptr<HybridGPUFrameSpec> result) const noexcept {
       _function->operator()(result);
     }
   private:
-    std::unique_ptr<std::function<void(const std::shared_ptr<HybridResizerSpec>& /* result */)>> _function;
+    std::unique_ptr<std::function<void(const std::shared_ptr<HybridGPUFrameSpec>& /* result */)>> _function;
   } SWIFT_NONCOPYABLE;
-  Func_void_std__shared_ptr_HybridResizerSpec_ create_Func_void_std__shared_ptr_HybridResizerSpec_(void* NON_NULL swiftClosureWrapper) noexcept;
-  inline Func_void_std__shared_ptr_HybridResizerSpec__Wrapper wrap_Func_void_std__shared_ptr_HybridResizerSpec_(Func_void_std__shared_ptr_HybridResizerSpec_ value) noexcept {
-    return Func_void_std__shared_ptr_HybridResizerSpec__Wrapper(std::move(value));
+  Func_void_std__shared_ptr_HybridGPUFrameSpec_ create_Func_void_std__shared_ptr_HybridGPUFrameSpec_(void* NON_NULL swiftClosureWrapper) noexcept;
+  inline Func_void_std__shared_ptr_HybridGPUFrameSpec__Wrapper wrap_Func_void_std__shared_ptr_HybridGPUFrameSpec_(Func_void_std__shared_ptr_HybridGPUFrameSpec_ value) noexcept {
+    return Func_void_std__shared_ptr_HybridGPUFrameSpec__Wrapper(std::move(value));
   }
   
   // pragma MARK: std::function<void(const std::exception_ptr& /* error */)>
@@ -211,6 +425,178 @@ namespace margelo::nitro::camera::resizer::bridge::swift {
     return Func_void_std__exception_ptr_Wrapper(std::move(value));
   }
   
+  // pragma MARK: Result<std::shared_ptr<Promise<std::shared_ptr<HybridGPUFrameSpec>>>>
+  using Result_std__shared_ptr_Promise_std__shared_ptr_HybridGPUFrameSpec____ = Result<std::shared_ptr<Promise<std::shared_ptr<HybridGPUFrameSpec>>>>;
+  inline Result_std__shared_ptr_Promise_std__shared_ptr_HybridGPUFrameSpec____ create_Result_std__shared_ptr_Promise_std__shared_ptr_HybridGPUFrameSpec____(const std::shared_ptr<Promise<std::shared_ptr<HybridGPUFrameSpec>>>& value) noexcept {
+    return Result<std::shared_ptr<Promise<std::shared_ptr<HybridGPUFrameSpec>>>>::withValue(value);
+  }
+  inline Result_std__shared_ptr_Promise_std__shared_ptr_HybridGPUFrameSpec____ create_Result_std__shared_ptr_Promise_std__shared_ptr_HybridGPUFrameSpec____(const std::exception_ptr& error) noexcept {
+    return Result<std::shared_ptr<Promise<std::shared_ptr<HybridGPUFrameSpec>>>>::withError(error);
+  }
+  
+  // pragma MARK: std::optional<ImportCacheStatistics>
+  /**
+   * Specialized version of `std::optional<ImportCacheStatistics>`.
+   */
+  using std__optional_ImportCacheStatistics_ = std::optional<ImportCacheStatistics>;
+  inline std::optional<ImportCacheStatistics> create_std__optional_ImportCacheStatistics_(const ImportCacheStatistics& value) noexcept {
+    return std::optional<ImportCacheStatistics>(value);
+  }
+  inline bool has_value_std__optional_ImportCacheStatistics_(const std::optional<ImportCacheStatistics>& optional) noexcept {
+    return optional.has_value();
+  }
+  inline ImportCacheStatistics get_std__optional_ImportCacheStatistics_(const std::optional<ImportCacheStatistics>& optional) noexcept {
+    return optional.value();
+  }
+  
+  // pragma MARK: std::optional<StageTimingStatistics>
+  /**
+   * Specialized version of `std::optional<StageTimingStatistics>`.
+   */
+  using std__optional_StageTimingStatistics_ = std::optional<StageTimingStatistics>;
+  inline std::optional<StageTimingStatistics> create_std__optional_StageTimingStatistics_(const StageTimingStatistics& value) noexcept {
+    return std::optional<StageTimingStatistics>(value);
+  }
+  inline bool has_value_std__optional_StageTimingStatistics_(const std::optional<StageTimingStatistics>& optional) noexcept {
+    return optional.has_value();
+  }
+  inline StageTimingStatistics get_std__optional_StageTimingStatistics_(const std::optional<StageTimingStatistics>& optional) noexcept {
+    return optional.value();
+  }
+  
+  // pragma MARK: std::optional<ResizerTimingStatistics>
+  /**
+   * Specialized version of `std::optional<ResizerTimingStatistics>`.
+   */
+  using std__optional_ResizerTimingStatistics_ = std::optional<ResizerTimingStatistics>;
+  inline std::optional<ResizerTimingStatistics> create_std__optional_ResizerTimingStatistics_(const ResizerTimingStatistics& value) noexcept {
+    return std::optional<ResizerTimingStatistics>(value);
+  }
+  inline bool has_value_std__optional_ResizerTimingStatistics_(const std::optional<ResizerTimingStatistics>& optional) noexcept {
+    return optional.has_value();
+  }
+  inline ResizerTimingStatistics get_std__optional_ResizerTimingStatistics_(const std::optional<ResizerTimingStatistics>& optional) noexcept {
+    return optional.value();
+  }
+  
+  // pragma MARK: Result<ResizerStatistics>
+  using Result_ResizerStatistics_ = Result<ResizerStatistics>;
+  inline Result_ResizerStatistics_ create_Result_ResizerStatistics_(const ResizerStatistics& value) noexcept {
+    return Result<ResizerStatistics>::withValue(value);
+  }
+  inline Result_ResizerStatistics_ create_Result_ResizerStatistics_(const std::exception_ptr& error) noexcept {
+    return Result<ResizerStatistics>::withError(error);
+  }
+  
+  // pragma MARK: std::shared_ptr<HybridMultiResizerSpec>
+  /**
+   * Specialized version of `std::shared_ptr<HybridMultiResizerSpec>`.
+   */
+  using std__shared_ptr_HybridMultiResizerSpec_ = std::shared_ptr<HybridMultiResizerSpec>;
+  std::shared_ptr<HybridMultiResizerSpec> create_std__shared_ptr_HybridMultiResizerSpec_(void* NON_NULL swiftUnsafePointer) noexcept;
+  void* NON_NULL get_std__shared_ptr_HybridMultiResizerSpec_(std__shared_ptr_HybridMultiResizerSpec_ cppType);
+  
+  // pragma MARK: std::weak_ptr<HybridMultiResizerSpec>
+  using std__weak_ptr_HybridMultiResizerSpec_ = std::weak_ptr<HybridMultiResizerSpec>;
+  inline std__weak_ptr_HybridMultiResizerSpec_ weakify_std__shared_ptr_HybridMultiResizerSpec_(const std::shared_ptr<HybridMultiResizerSpec>& strong) noexcept { return strong; }
+  
+  // pragma MARK: std::vector<std::shared_ptr<HybridGPUFrameSpec>>
+  /**
+   * Specialized version of `std::vector<std::shared_ptr<HybridGPUFrameSpec>>`.
+   */
+  using std__vector_std__shared_ptr_HybridGPUFrameSpec__ = std::vector<std::shared_ptr<HybridGPUFrameSpec>>;
+  inline std::vector<std::shared_ptr<HybridGPUFrameSpec>> create_std__vector_std__shared_ptr_HybridGPUFrameSpec__(size_t size) noexcept {
+    std::vector<std::shared_ptr<HybridGPUFrameSpec>> vector;
+    vector.reserve(size);
+    return vector;
+  }
+  
+  // pragma MARK: Result<std::vector<std::shared_ptr<HybridGPUFrameSpec>>>
+  using Result_std__vector_std__shared_ptr_HybridGPUFrameSpec___ = Result<std::vector<std::shared_ptr<HybridGPUFrameSpec>>>;
+  inline Result_std__vector_std__shared_ptr_HybridGPUFrameSpec___ create_Result_std__vector_std__shared_ptr_HybridGPUFrameSpec___(const std::vector<std::shared_ptr<HybridGPUFrameSpec>>& value) noexcept {
+    return Result<std::vector<std::shared_ptr<HybridGPUFrameSpec>>>::withValue(value);
+  }
+  inline Result_std__vector_std__shared_ptr_HybridGPUFrameSpec___ create_Result_std__vector_std__shared_ptr_HybridGPUFrameSpec___(const std::exception_ptr& error) noexcept {
+    return Result<std::vector<std::shared_ptr<HybridGPUFrameSpec>>>::withError(error);
+  }
+  
+  // pragma MARK: std::shared_ptr<Promise<std::vector<std::shared_ptr<HybridGPUFrameSpec>>>>
+  /**
+   * Specialized version of `std::shared_ptr<Promise<std::vector<std::shared_ptr<HybridGPUFrameSpec>>>>`.
+   */
+  using std__shared_ptr_Promise_std__vector_std__shared_ptr_HybridGPUFrameSpec____ = std::shared_ptr<Promise<std::vector<std::shared_ptr<HybridGPUFrameSpec>>>>;
+  inline std::shared_ptr<Promise<std::vector<std::shared_ptr<HybridGPUFrameSpec>>>> create_std__shared_ptr_Promise_std__vector_std__shared_ptr_HybridGPUFrameSpec____() noexcept {
+    return Promise<std::vector<std::shared_ptr<HybridGPUFrameSpec>>>::create();
+  }
+  inline PromiseHolder<std::vector<std::shared_ptr<HybridGPUFrameSpec>>> wrap_std__shared_ptr_Promise_std__vector_std__shared_ptr_HybridGPUFrameSpec____(std::shared_ptr<Promise<std::vector<std::shared_ptr<HybridGPUFrameSpec>>>> promise) noexcept {
+    return PromiseHolder<std::vector<std::shared_ptr<HybridGPUFrameSpec>>>(std::move(promise));
+  }
+  
+  // pragma MARK: std::function<void(const std::vector<std::shared_ptr<HybridGPUFrameSpec>>& /* result */)>
+  /**
+   * Specialized version of `std::function<void(const std::vector<std::shared_ptr<HybridGPUFrameSpec>>&)>`.
+   */
+  using Func_void_std__vector_std__shared_ptr_HybridGPUFrameSpec__ = std::function<void(const std::vector<std::shared_ptr<HybridGPUFrameSpec>>& /* result */)>;
+  /**
+   * Wrapper class for a `std::function<void(const std::vector<std::shared_ptr<HybridGPUFrameSpec>>& / * result * /)>`, this can be used from Swift.
+   */
+  class Func_void_std__vector_std__shared_ptr_HybridGPUFrameSpec___Wrapper final {
+  public:
+    explicit Func_void_std__vector_std__shared_ptr_HybridGPUFrameSpec___Wrapper(std::function<void(const std::vector<std::shared_ptr<HybridGPUFrameSpec>>& /* result */)>&& func): _function(std::make_unique<std::function<void(const std::vector<std::shared_ptr<HybridGPUFrameSpec>>& /* result */)>>(std::move(func))) {}
+    inline void call(std::vector<std::shared_ptr<HybridGPUFrameSpec>> result) const noexcept {
+      _function->operator()(result);
+    }
+  private:
+    std::unique_ptr<std::function<void(const std::vector<std::shared_ptr<HybridGPUFrameSpec>>& /* result */)>> _function;
+  } SWIFT_NONCOPYABLE;
+  Func_void_std__vector_std__shared_ptr_HybridGPUFrameSpec__ create_Func_void_std__vector_std__shared_ptr_HybridGPUFrameSpec__(void* NON_NULL swiftClosureWrapper) noexcept;
+  inline Func_void_std__vector_std__shared_ptr_HybridGPUFrameSpec___Wrapper wrap_Func_void_std__vector_std__shared_ptr_HybridGPUFrameSpec__(Func_void_std__vector_std__shared_ptr_HybridGPUFrameSpec__ value) noexcept {
+    return Func_void_std__vector_std__shared_ptr_HybridGPUFrameSpec___Wrapper(std::move(value));
+  }
+  
+  // pragma MARK: Result<std::shared_ptr<Promise<std::vector<std::shared_ptr<HybridGPUFrameSpec>>>>>
+  using Result_std__shared_ptr_Promise_std__vector_std__shared_ptr_HybridGPUFrameSpec_____ = Result<std::shared_ptr<Promise<std::vector<std::shared_ptr<HybridGPUFrameSpec>>>>>;
+  inline Result_std__shared_ptr_Promise_std__vector_std__shared_ptr_HybridGPUFrameSpec_____ create_Result_std__shared_ptr_Promise_std__vector_std__shared_ptr_HybridGPUFrameSpec_____(const std::shared_ptr<Promise<std::vector<std::shared_ptr<HybridGPUFrameSpec>>>>& value) noexcept {
+    return Result<std::shared_ptr<Promise<std::vector<std::shared_ptr<HybridGPUFrameSpec>>>>>::withValue(value);
+  }
+  inline Result_std__shared_ptr_Promise_std__vector_std__shared_ptr_HybridGPUFrameSpec_____ create_Result_std__shared_ptr_Promise_std__vector_std__shared_ptr_HybridGPUFrameSpec_____(const std::exception_ptr& error) noexcept {
+    return Result<std::shared_ptr<Promise<std::vector<std::shared_ptr<HybridGPUFrameSpec>>>>>::withError(error);
+  }
+  
+  // pragma MARK: std::shared_ptr<Promise<std::shared_ptr<HybridResizerSpec>>>
+  /**
+   * Specialized version of `std::shared_ptr<Promise<std::shared_ptr<HybridResizerSpec>>>`.
+   */
+  using std__shared_ptr_Promise_std__shared_ptr_HybridResizerSpec___ = std::shared_ptr<Promise<std::shared_ptr<HybridResizerSpec>>>;
+  inline std::shared_ptr<Promise<std::shared_ptr<HybridResizerSpec>>> create_std__shared_ptr_Promise_std__shared_ptr_HybridResizerSpec___() noexcept {
+    return Promise<std::shared_ptr<HybridResizerSpec>>::create();
+  }
+  inline PromiseHolder<std::shared_ptr<HybridResizerSpec>> wrap_std__shared_ptr_Promise_std__shared_ptr_HybridResizerSpec___(std::shared_ptr<Promise<std::shared_ptr<HybridResizerSpec>>> promise) noexcept {
+    return PromiseHolder<std::shared_ptr<HybridResizerSpec>>(std::move(promise));
+  }
+  
+  // pragma MARK: std::function<void(const std::shared_ptr<HybridResizerSpec>& /* result */)>
+  /**
+   * Specialized version of `std::function<void(const std::shared_ptr<HybridResizerSpec>&)>`.
+   */
+  using Func_void_std__shared_ptr_HybridResizerSpec_ = std::function<void(const std::shared_ptr<HybridResizerSpec>& /* result */)>;
+  /**
+   * Wrapper class for a `std::function<void(const std::shared_ptr<HybridResizerSpec>& / * result * /)>`, this can be used from Swift.
+   */
+  class Func_void_std__shared_ptr_HybridResizerSpec__Wrapper final {
+  public:
+    explicit Func_void_std__shared_ptr_HybridResizerSpec__Wrapper(std::function<void(const std::shared_ptr<HybridResizerSpec>& /* result */)>&& func): _function(std::make_unique<std::function<void(const std::shared_ptr<HybridResizerSpec>& /* result */)>>(std::move(func))) {}
+    inline void call(std::shared_ptr<HybridResizerSpec> result) const noexcept {
+      _function->operator()(result);
+    }
+  private:
+    std::unique_ptr<std::function<void(const std::shared_ptr<HybridResizerSpec>& /* result */)>> _function;
+  } SWIFT_NONCOPYABLE;
+  Func_void_std__shared_ptr_HybridResizerSpec_ create_Func_void_std__shared_ptr_HybridResizerSpec_(void* NON_NULL swiftClosureWrapper) noexcept;
+  inline Func_void_std__shared_ptr_HybridResizerSpec__Wrapper wrap_Func_void_std__shared_ptr_HybridResizerSpec_(Func_void_std__shared_ptr_HybridResizerSpec_ value) noexcept {
+    return Func_void_std__shared_ptr_HybridResizerSpec__Wrapper(std::move(value));
+  }
+  
   // pragma MARK: std::shared_ptr<HybridResizerFactorySpec>
   /**
    * Specialized version of `std::shared_ptr<HybridResizerFactorySpec>`.
@@ -240,5 +626,102 @@ namespace margelo::nitro::camera::resizer::bridge::swift {
   inline Result_std__shared_ptr_Promise_std__shared_ptr_HybridResizerSpec____ create_Result_std__shared_ptr_Promise_std__shared_ptr_HybridResizerSpec____(const std::exception_ptr& error) noexcept {
     return Result<std::shared_ptr<Promise<std::shared_ptr<HybridResizerSpec>>>>::withError(error);
   }
+  
+  // pragma MARK: std::shared_ptr<Promise<std::shared_ptr<HybridMultiResizerSpec>>>
+  /**
+   * Specialized version of `std::shared_ptr<Promise<std::shared_ptr<HybridMultiResizerSpec>>>`.
+   */
+  using std__shared_ptr_Promise_std__shared_ptr_HybridMultiResizerSpec___ = std::shared_ptr<Promise<std::shared_ptr<HybridMultiResizerSpec>>>;
+  inline std::shared_ptr<Promise<std::shared_ptr<HybridMultiResizerSpec>>> create_std__shared_ptr_Promise_std__shared_ptr_HybridMultiResizerSpec___() noexcept {
+    return Promise<std::shared_ptr<HybridMultiResizerSpec>>::create();
+  }
+  inline PromiseHolder<std::shared_ptr<HybridMultiResizerSpec>> wrap_std__shared_ptr_Promise_std__shared_ptr_HybridMultiResizerSpec___(std::shared_ptr<Promise<std::shared_ptr<HybridMultiResizerSpec>>> promise) noexcept {
+    return PromiseHolder<std::shared_ptr<HybridMultiResizerSpec>>(std::move(promise));
+  }
+  
+  // pragma MARK: std::function<void(const std::shared_ptr<HybridMultiResizerSpec>& /* result */)>
+  /**
+   * Specialized version of `std::function<void(const std::shared_ptr<HybridMultiResizerSpec>&)>`.
+   */
+  using Func_void_std__shared_ptr_HybridMultiResizerSpec_ = std::function<void(const std::shared_ptr<HybridMultiResizerSpec>& /* result */)>;
+  /**
+   * Wrapper class for a `std::function<void(const std::shared_ptr<HybridMultiResizerSpec>& / * result * /)>`, this can be used from Swift.
+   */
+  class Func_void_std__shared_ptr_HybridMultiResizerSpec__Wrapper final {
+  public:
+    explicit Func_void_std__shared_ptr_HybridMultiResizerSpec__Wrapper(std::function<void(const std::shared_ptr<HybridMultiResizerSpec>& /* result */)>&& func): _function(std::make_unique<std::function<void(const std::shared_ptr<HybridMultiResizerSpec>& /* result */)>>(std::move(func))) {}
+    inline void call(std::shared_ptr<HybridMultiResizerSpec> result) const noexcept {
+      _function->operator()(result);
+    }
+  private:
+    std::unique_ptr<std::function<void(const std::shared_ptr<HybridMultiResizerSpec>& /* result */)>> _function;
+  } SWIFT_NONCOPYABLE;
+  Func_void_std__shared_ptr_HybridMultiResizerSpec_ create_Func_void_std__shared_ptr_HybridMultiResizerSpec_(void* NON_NULL swiftClosureWrapper) noexcept;
+  inline Func_void_std__shared_ptr_HybridMultiResizerSpec__Wrapper wrap_Func_void_std__shared_ptr_HybridMultiResizerSpec_(Func_void_std__shared_ptr_HybridMultiResizerSpec_ value) noexcept {
+    return Func_void_std__shared_ptr_HybridMultiResizerSpec__Wrapper(std::move(value));
+  }
+  
+  // pragma MARK: Result<std::shared_ptr<Promise<std::shared_ptr<HybridMultiResizerSpec>>>>
+  using Result_std__shared_ptr_Promise_std__shared_ptr_HybridMultiResizerSpec____ = Result<std::shared_ptr<Promise<std::shared_ptr<HybridMultiResizerSpec>>>>;
+  inline Result_std__shared_ptr_Promise_std__shared_ptr_HybridMultiResizerSpec____ create_Result_std__shared_ptr_Promise_std__shared_ptr_HybridMultiResizerSpec____(const std::shared_ptr<Promise<std::shared_ptr<HybridMultiResizerSpec>>>& value) noexcept {
+    return Result<std::shared_ptr<Promise<std::shared_ptr<HybridMultiResizerSpec>>>>::withValue(value);
+  }
+  inline Result_std__shared_ptr_Promise_std__shared_ptr_HybridMultiResizerSpec____ create_Result_std__shared_ptr_Promise_std__shared_ptr_HybridMultiResizerSpec____(const std::exception_ptr& error) noexcept {
+    return Result<std::shared_ptr<Promise<std::shared_ptr<HybridMultiResizerSpec>>>>::withError(error);
+  }
+  
+  // pragma MARK: std::shared_ptr<Promise<void>>
+  /**
+   * Specialized version of `std::shared_ptr<Promise<void>>`.
+   */
+  using std__shared_ptr_Promise_void__ = std::shared_ptr<Promise<void>>;
+  inline std::shared_ptr<Promise<void>> create_std__shared_ptr_Promise_void__() noexcept {
+    return Promise<void>::create();
+  }
+  inline PromiseHolder<void> wrap_std__shared_ptr_Promise_void__(std::shared_ptr<Promise<void>> promise) noexcept {
+    return PromiseHolder<void>(std::move(promise));
+  }
+  
+  // pragma MARK: std::function<void()>
+  /**
+   * Specialized version of `std::function<void()>`.
+   */
+  using Func_void = std::function<void()>;
+  /**
+   * Wrapper class for a `std::function<void()>`, this can be used from Swift.
+   */
+  class Func_void_Wrapper final {
+  public:
+    explicit Func_void_Wrapper(std::function<void()>&& func): _function(std::make_unique<std::function<void()>>(std::move(func))) {}
+    inline void call() const noexcept {
+      _function->operator()();
+    }
+  private:
+    std::unique_ptr<std::function<void()>> _function;
+  } SWIFT_NONCOPYABLE;
+  Func_void create_Func_void(void* NON_NULL swiftClosureWrapper) noexcept;
+  inline Func_void_Wrapper wrap_Func_void(Func_void value) noexcept {
+    return Func_void_Wrapper(std::move(value));
+  }
+  
+  // pragma MARK: std::vector<ResizerOptions>
+  /**
+   * Specialized version of `std::vector<ResizerOptions>`.
+   */
+  using std__vector_ResizerOptions_ = std::vector<ResizerOptions>;
+  inline std::vector<ResizerOptions> create_std__vector_ResizerOptions_(size_t size) noexcept {
+    std::vector<ResizerOptions> vector;
+    vector.reserve(size);
+    return vector;
+  }
+  
+  // pragma MARK: Result<std::shared_ptr<Promise<void>>>
+  using Result_std__shared_ptr_Promise_void___ = Result<std::shared_ptr<Promise<void>>>;
+  inline Result_std__shared_ptr_Promise_void___ create_Result_std__shared_ptr_Promise_void___(const std::shared_ptr<Promise<void>>& value) noexcept {
+    return Result<std::shared_ptr<Promise<void>>>::withValue(value);
+  }
+  inline Result_std__shared_ptr_Promise_void___ create_Result_std__shared_ptr_Promise_void___(const std::exception_ptr& error) noexcept {
+    return Result<std::shared_ptr<Promise<void>>>::withError(error);
+  }
 
 } // namespace margelo::nitro::camera::resizer::bridge::swift
@@ -12,37 +12,74 @@
 namespace margelo::nitro::camera::resizer { enum class ChannelOrder; }
 // Forward declaration of `DataType` to properly resolve imports.
 namespace margelo::nitro::camera::resizer { enum class DataType; }
+// Forward declaration of `FrameStatistics` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct FrameStatistics; }
 // Forward declaration of `HybridFrameSpec` to properly resolve imports.
 namespace margelo::nitro::camera { class HybridFrameSpec; }
 // Forward declaration of `HybridGPUFrameSpec` to properly resolve imports.
 namespace margelo::nitro::camera::resizer { class HybridGPUFrameSpec; }
+// Forward declaration of `HybridMultiResizerSpec` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { class HybridMultiResizerSpec; }
 // Forward declaration of `HybridResizerFactorySpec` to properly resolve imports.
 namespace margelo::nitro::camera::resizer { class HybridResizerFactorySpec; }
 // Forward declaration of `HybridResizerSpec` to properly resolve imports.
 namespace margelo::nitro::camera::resizer { class HybridResizerSpec; }
+// Forward declaration of `ImportCacheStatistics` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct ImportCacheStatistics; }
+// Forward declaration of `NativeBuffer` to properly resolve imports.
+namespace margelo::nitro::camera { struct NativeBuffer; }
+// Forward declaration of `OutputBufferType` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { enum class OutputBufferType; }
 // Forward declaration of `PixelLayout` to properly resolve imports.
 namespace margelo::nitro::camera::resizer { enum class PixelLayout; }
+// Forward declaration of `Rect` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct Rect; }
+// Forward declaration of `ResizeFilter` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { enum class ResizeFilter; }
+// Forward declaration of `ResizeOptions` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct ResizeOptions; }
+// Forward declaration of `ResizeTransform` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct ResizeTransform; }
 // Forward declaration of `ResizerOptions` to properly resolve imports.
 namespace margelo::nitro::camera::resizer { struct ResizerOptions; }
+// Forward declaration of `ResizerStatistics` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct ResizerStatistics; }
+// Forward declaration of `ResizerTimingStatistics` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct ResizerTimingStatistics; }
 // Forward declaration of `ScaleMode` to properly resolve imports.
 namespace margelo::nitro::camera::resizer { enum class ScaleMode; }
+// Forward declaration of `StageTimingStatistics` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct StageTimingStatistics; }
 
 // Include C++ defined types
 #include "ChannelOrder.hpp"
 #include "DataType.hpp"
+#include "FrameStatistics.hpp"
 #include "HybridGPUFrameSpec.hpp"
+#include "HybridMultiResizerSpec.hpp"
 #include "HybridResizerFactorySpec.hpp"
 #include "HybridResizerSpec.hpp"
+#include "ImportCacheStatistics.hpp"
+#include "OutputBufferType.hpp"
 #include "PixelLayout.hpp"
+#include "Rect.hpp"
+#include "ResizeFilter.hpp"
+#include "ResizeOptions.hpp"
+#include "ResizeTransform.hpp"
 #include "ResizerOptions.hpp"
+#include "ResizerStatistics.hpp"
+#include "ResizerTimingStatistics.hpp"
 #include "ScaleMode.hpp"
+#include "StageTimingStatistics.hpp"
 #include <NitroModules/ArrayBuffer.hpp>
 #include <NitroModules/Promise.hpp>
 #include <NitroModules/Result.hpp>
 #include <VisionCamera/HybridFrameSpec.hpp>
+#include <VisionCamera/NativeBuffer.hpp>
 #include <exception>
 #include <memory>
 #include <optional>
+#include <vector>
 
 // C++ helpers for Swift
 #include "VisionCameraResizer-Swift-Cxx-Bridge.hpp"
@@ -58,6 +95,8 @@ namespace margelo::nitro::camera::resizer { enum class ScaleMode; }
 namespace VisionCamera { class HybridFrameSpec_cxx; }
 // Forward declaration of `HybridGPUFrameSpec_cxx` to properly resolve imports.
 namespace VisionCameraResizer { class HybridGPUFrameSpec_cxx; }
+// Forward declaration of `HybridMultiResizerSpec_cxx` to properly resolve imports.
+namespace VisionCameraResizer { class HybridMultiResizerSpec_cxx; }
 // Forward declaration of `HybridResizerFactorySpec_cxx` to properly resolve imports.
 namespace VisionCameraResizer { class HybridResizerFactorySpec_cxx; }
 // Forward declaration of `HybridResizerSpec_cxx` to properly resolve imports.
@@ -18,6 +18,12 @@ namespace margelo::nitro::camera::resizer { enum class ChannelOrder; }
 namespace margelo::nitro::camera::resizer { enum class DataType; }
 // Forward declaration of `PixelLayout` to properly resolve imports.
 namespace margelo::nitro::camera::resizer { enum class PixelLayout; }
+// Forward declaration of `FrameStatistics` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct FrameStatistics; }
+// Forward declaration of `NativeBuffer` to properly resolve imports.
+namespace margelo::nitro::camera { struct NativeBuffer; }
+// Forward declaration of `ResizeTransform` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct ResizeTransform; }
 // Forward declaration of `ArrayBufferHolder` to properly resolve imports.
 namespace NitroModules { class ArrayBufferHolder; }
 
@@ -25,8 +31,12 @@ namespace NitroModules { class ArrayBufferHolder; }
 #include <optional>
 #include "DataType.hpp"
 #include "PixelLayout.hpp"
+#include "FrameStatistics.hpp"
 #include <NitroModules/ArrayBuffer.hpp>
 #include <NitroModules/ArrayBufferHolder.hpp>
+#include <VisionCamera/NativeBuffer.hpp>
+#include "ResizeTransform.hpp"
+#include <functional>
 
 #include "VisionCameraResizer-Swift-Cxx-Umbrella.hpp"
 
@@ -80,6 +90,9 @@ namespace margelo::nitro::camera::resizer {
     inline double getHeight() noexcept override {
       return _swiftPart.getHeight();
     }
+    inline double getBatchSize() noexcept override {
+      return _swiftPart.getBatchSize();
+    }
     inline std::optional<ChannelOrder> getChannelOrder() noexcept override {
       auto __result = _swiftPart.getChannelOrder();
       return __result;
@@ -92,6 +105,10 @@ namespace margelo::nitro::camera::resizer {
       auto __result = _swiftPart.getPixelLayout();
       return __result;
     }
+    inline std::optional<FrameStatistics> getFrameStatistics() noexcept override {
+      auto __result = _swiftPart.getFrameStatistics();
+      return __result;
+    }
 
   public:
     // Methods
@@ -103,6 +120,28 @@ namespace margelo::nitro::camera::resizer {
       auto __value = std::move(__result.value());
       return __value;
     }
+    inline NativeBuffer getNativeBuffer() override {
+      auto __result = _swiftPart.getNativeBuffer();
+      if (__result.hasError()) [[unlikely]] {
+        std::rethrow_exception(__result.error());
+      }
+      auto __value = std::move(__result.value());
+      return __value;
+    }
+    inline ResizeTransform getTransform(std::optional<double> batchIndex) override {
+      auto __result = _swiftPart.getTransform(batchIndex);
+      if (__result.hasError()) [[unlikely]] {
+        std::rethrow_exception(__result.error());
+      }
+      auto __value = std::move(__result.value());
+      return __value;
+    }
+    inline void convertOutputPointsToFramePoints(const std::shared_ptr<ArrayBuffer>& points, std::optional<double> batchIndex) override {
+      auto __result = _swiftPart.convertOutputPointsToFramePoints(ArrayBufferHolder(points), batchIndex);
+      if (__result.hasError()) [[unlikely]] {
+        std::rethrow_exception(__result.error());
+      }
+    }
 
   private:
     VisionCameraResizer::HybridGPUFrameSpec_cxx _swiftPart;
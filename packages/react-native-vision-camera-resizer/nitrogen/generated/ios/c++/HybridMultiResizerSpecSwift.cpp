@@ -0,0 +1,11 @@
+///
+/// HybridMultiResizerSpecSwift.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#include "HybridMultiResizerSpecSwift.hpp"
+
+namespace margelo::nitro::camera::resizer {
+} // namespace margelo::nitro::camera::resizer
@@ -0,0 +1,112 @@
+///
+/// HybridMultiResizerSpecSwift.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include "HybridMultiResizerSpec.hpp"
+
+// Forward declaration of `HybridMultiResizerSpec_cxx` to properly resolve imports.
+namespace VisionCameraResizer { class HybridMultiResizerSpec_cxx; }
+
+// Forward declaration of `HybridGPUFrameSpec` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { class HybridGPUFrameSpec; }
+// Forward declaration of `HybridFrameSpec` to properly resolve imports.
+namespace margelo::nitro::camera { class HybridFrameSpec; }
+// Forward declaration of `ResizeOptions` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct ResizeOptions; }
+// Forward declaration of `ResizerStatistics` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct ResizerStatistics; }
+
+#include <memory>
+#include "HybridGPUFrameSpec.hpp"
+#include <VisionCamera/HybridFrameSpec.hpp>
+#include "ResizeOptions.hpp"
+#include <optional>
+#include <vector>
+#include <NitroModules/Promise.hpp>
+#include "ResizerStatistics.hpp"
+
+#include "VisionCameraResizer-Swift-Cxx-Umbrella.hpp"
+
+namespace margelo::nitro::camera::resizer {
+
+  /**
+   * The C++ part of HybridMultiResizerSpec_cxx.swift.
+   *
+   * HybridMultiResizerSpecSwift (C++) accesses HybridMultiResizerSpec_cxx (Swift), and might
+   * contain some additional bridging code for C++ <> Swift interop.
+   *
+   * Since this obviously introduces an overhead, I hope at some point in
+   * the future, HybridMultiResizerSpec_cxx can directly inherit from the C++ class HybridMultiResizerSpec
+   * to simplify the whole structure and memory management.
+   */
+  class HybridMultiResizerSpecSwift: public virtual HybridMultiResizerSpec {
+  public:
+    // Constructor from a Swift instance
+    explicit HybridMultiResizerSpecSwift(const VisionCameraResizer::HybridMultiResizerSpec_cxx& swiftPart):
+      HybridObject(HybridMultiResizerSpec::TAG),
+      _swiftPart(swiftPart) { }
+
+  public:
+    // Get the Swift part
+    inline VisionCameraResizer::HybridMultiResizerSpec_cxx& getSwiftPart() noexcept {
+      return _swiftPart;
+    }
+
+  public:
+    inline size_t getExternalMemorySize() noexcept override {
+      return _swiftPart.getMemorySize();
+    }
+    bool equals(const std::shared_ptr<HybridObject>& other) override {
+      if (auto otherCast = std::dynamic_pointer_cast<HybridMultiResizerSpecSwift>(other)) {
+        return _swiftPart.equals(otherCast->_swiftPart);
+      }
+      return false;
+    }
+    void dispose() noexcept override {
+      _swiftPart.dispose();
+    }
+    std::string toString() override {
+      return _swiftPart.toString();
+    }
+
+  public:
+    // Properties
+    
+
+  public:
+    // Methods
+    inline std::vector<std::shared_ptr<HybridGPUFrameSpec>> resize(const std::shared_ptr<margelo::nitro::camera::HybridFrameSpec>& frame, const std::optional<ResizeOptions>& options) override {
+      auto __result = _swiftPart.resize(frame, options);
+      if (__result.hasError()) [[unlikely]] {
+        std::rethrow_exception(__result.error());
+      }
+      auto __value = std::move(__result.value());
+      return __value;
+    }
+    inline std::shared_ptr<Promise<std::vector<std::shared_ptr<HybridGPUFrameSpec>>>> resizeAsync(const std::shared_ptr<margelo::nitro::camera::HybridFrameSpec>& frame, const std::optional<ResizeOptions>& options) override {
+      auto __result = _swiftPart.resizeAsync(frame, options);
+      if (__result.hasError()) [[unlikely]] {
+        std::rethrow_exception(__result.error());
+      }
+      auto __value = std::move(__result.value());
+      return __value;
+    }
+    inline ResizerStatistics getStatistics() override {
+      auto __result = _swiftPart.getStatistics();
+      if (__result.hasError()) [[unlikely]] {
+        std::rethrow_exception(__result.error());
+      }
+      auto __value = std::move(__result.value());
+      return __value;
+    }
+
+  private:
+    VisionCameraResizer::HybridMultiResizerSpec_cxx _swiftPart;
+  };
+
+} // namespace margelo::nitro::camera::resizer
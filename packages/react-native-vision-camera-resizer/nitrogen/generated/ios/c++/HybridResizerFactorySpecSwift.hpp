@@ -24,6 +24,8 @@ namespace margelo::nitro::camera::resizer { enum class DataType; }
 namespace margelo::nitro::camera::resizer { enum class ScaleMode; }
 // Forward declaration of `PixelLayout` to properly resolve imports.
 namespace margelo::nitro::camera::resizer { enum class PixelLayout; }
+// Forward declaration of `HybridMultiResizerSpec` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { class HybridMultiResizerSpec; }
 
 #include <memory>
 #include "HybridResizerSpec.hpp"
@@ -33,6 +35,8 @@ namespace margelo::nitro::camera::resizer { enum class PixelLayout; }
 #include "DataType.hpp"
 #include "ScaleMode.hpp"
 #include "PixelLayout.hpp"
+#include "HybridMultiResizerSpec.hpp"
+#include <vector>
 
 #include "VisionCameraResizer-Swift-Cxx-Umbrella.hpp"
 
@@ -100,6 +104,22 @@ namespace margelo::nitro::camera::resizer {
       auto __value = std::move(__result.value());
       return __value;
     }
+    inline std::shared_ptr<Promise<std::shared_ptr<HybridMultiResizerSpec>>> createMultiResizer(const std::vector<ResizerOptions>& options) override {
+      auto __result = _swiftPart.createMultiResizer(options);
+      if (__result.hasError()) [[unlikely]] {
+        std::rethrow_exception(__result.error());
+      }
+      auto __value = std::move(__result.value());
+      return __value;
+    }
+    inline std::shared_ptr<Promise<void>> prewarm(const std::vector<ResizerOptions>& options) override {
+      auto __result = _swiftPart.prewarm(options);
+      if (__result.hasError()) [[unlikely]] {
+        std::rethrow_exception(__result.error());
+      }
+      auto __value = std::move(__result.value());
+      return __value;
+    }
 
   private:
     VisionCameraResizer::HybridResizerFactorySpec_cxx _swiftPart;
@@ -16,10 +16,22 @@ namespace VisionCameraResizer { class HybridResizerSpec_cxx; }
 namespace margelo::nitro::camera::resizer { class HybridGPUFrameSpec; }
 // Forward declaration of `HybridFrameSpec` to properly resolve imports.
 namespace margelo::nitro::camera { class HybridFrameSpec; }
+// Forward declaration of `ResizeOptions` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct ResizeOptions; }
+// Forward declaration of `Rect` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct Rect; }
+// Forward declaration of `ResizerStatistics` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct ResizerStatistics; }
 
 #include <memory>
 #include "HybridGPUFrameSpec.hpp"
 #include <VisionCamera/HybridFrameSpec.hpp>
+#include "ResizeOptions.hpp"
+#include <optional>
+#include "Rect.hpp"
+#include <vector>
+#include <NitroModules/Promise.hpp>
+#include "ResizerStatistics.hpp"
 
 #include "VisionCameraResizer-Swift-Cxx-Umbrella.hpp"
 
@@ -71,8 +83,32 @@ namespace margelo::nitro::camera::resizer {
 
   public:
     // Methods
-    inline std::shared_ptr<HybridGPUFrameSpec> resize(const std::shared_ptr<margelo::nitro::camera::HybridFrameSpec>& frame) override {
-      auto __result = _swiftPart.resize(frame);
+    inline std::shared_ptr<HybridGPUFrameSpec> resize(const std::shared_ptr<margelo::nitro::camera::HybridFrameSpec>& frame, const std::optional<ResizeOptions>& options) override {
+      auto __result = _swiftPart.resize(frame, options);
+      if (__result.hasError()) [[unlikely]] {
+        std::rethrow_exception(__result.error());
+      }
+      auto __value = std::move(__result.value());
+      return __value;
+    }
+    inline std::shared_ptr<HybridGPUFrameSpec> resizeBatch(const std::shared_ptr<margelo::nitro::camera::HybridFrameSpec>& frame, const std::vector<Rect>& regions) override {
+      auto __result = _swiftPart.resizeBatch(frame, regions);
+      if (__result.hasError()) [[unlikely]] {
+        std::rethrow_exception(__result.error());
+      }
+      auto __value = std::move(__result.value());
+      return __value;
+    }
+    inline std::shared_ptr<Promise<std::shared_ptr<HybridGPUFrameSpec>>> resizeAsync(const std::shared_ptr<margelo::nitro::camera::HybridFrameSpec>& frame, const std::optional<ResizeOptions>& options) override {
+      auto __result = _swiftPart.resizeAsync(frame, options);
+      if (__result.hasError()) [[unlikely]] {
+        std::rethrow_exception(__result.error());
+      }
+      auto __value = std::move(__result.value());
+      return __value;
+    }
+    inline ResizerStatistics getStatistics() override {
+      auto __result = _swiftPart.getStatistics();
       if (__result.hasError()) [[unlikely]] {
         std::rethrow_exception(__result.error());
       }
@@ -21,6 +21,14 @@ public extension ChannelOrder {
         self = .rgb
       case "bgr":
         self = .bgr
+      case "gray":
+        self = .gray
+      case "rgba":
+        self = .rgba
+      case "bgra":
+        self = .bgra
+      case "argb":
+        self = .argb
       default:
         return nil
     }
@@ -35,6 +43,14 @@ public extension ChannelOrder {
         return "rgb"
       case .bgr:
         return "bgr"
+      case .gray:
+        return "gray"
+      case .rgba:
+        return "rgba"
+      case .bgra:
+        return "bgra"
+      case .argb:
+        return "argb"
     }
   }
 }
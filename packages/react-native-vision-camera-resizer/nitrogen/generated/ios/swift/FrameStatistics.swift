@@ -0,0 +1,58 @@
+///
+/// FrameStatistics.swift
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+import NitroModules
+
+/**
+ * Represents an instance of `FrameStatistics`, backed by a C++ struct.
+ */
+public typealias FrameStatistics = margelo.nitro.camera.resizer.FrameStatistics
+
+public extension FrameStatistics {
+  private typealias bridge = margelo.nitro.camera.resizer.bridge.swift
+
+  /**
+   * Create a new instance of `FrameStatistics`.
+   */
+  init(meanLuma: Double, thumbnail: [Double], motion: Double?) {
+    self.init(meanLuma, { () -> bridge.std__vector_double_ in
+      var __vector = bridge.create_std__vector_double_(thumbnail.count)
+      for __item in thumbnail {
+        __vector.push_back(__item)
+      }
+      return __vector
+    }(), { () -> bridge.std__optional_double_ in
+      if let __unwrappedValue = motion {
+        return bridge.create_std__optional_double_(__unwrappedValue)
+      } else {
+        return .init()
+      }
+    }())
+  }
+
+  @inline(__always)
+  var meanLuma: Double {
+    return self.__meanLuma
+  }
+  
+  @inline(__always)
+  var thumbnail: [Double] {
+    return self.__thumbnail.map({ __item in __item })
+  }
+  
+  @inline(__always)
+  var motion: Double? {
+    return { () -> Double? in
+      if bridge.has_value_std__optional_double_(self.__motion) {
+        let __unwrapped = bridge.get_std__optional_double_(self.__motion)
+        return __unwrapped
+      } else {
+        return nil
+      }
+    }()
+  }
+}
@@ -0,0 +1,50 @@
+///
+/// Func_void_std__shared_ptr_HybridMultiResizerSpec_.swift
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+import NitroModules
+
+/**
+ * Wraps a Swift `(_ value: (any HybridMultiResizerSpec)) -> Void` as a class.
+ * This class can be used from C++, e.g. to wrap the Swift closure as a `std::function`.
+ */
+public final class Func_void_std__shared_ptr_HybridMultiResizerSpec_ {
+  public typealias bridge = margelo.nitro.camera.resizer.bridge.swift
+
+  private let closure: (_ value: (any HybridMultiResizerSpec)) -> Void
+
+  public init(_ closure: @escaping (_ value: (any HybridMultiResizerSpec)) -> Void) {
+    self.closure = closure
+  }
+
+  @inline(__always)
+  public func call(value: bridge.std__shared_ptr_HybridMultiResizerSpec_) -> Void {
+    self.closure({ () -> any HybridMultiResizerSpec in
+      let __unsafePointer = bridge.get_std__shared_ptr_HybridMultiResizerSpec_(value)
+      let __instance = HybridMultiResizerSpec_cxx.fromUnsafe(__unsafePointer)
+      return __instance.getHybridMultiResizerSpec()
+    }())
+  }
+
+  /**
+   * Casts this instance to a retained unsafe raw pointer.
+   * This acquires one additional strong reference on the object!
+   */
+  @inline(__always)
+  public func toUnsafe() -> UnsafeMutableRawPointer {
+    return Unmanaged.passRetained(self).toOpaque()
+  }
+
+  /**
+   * Casts an unsafe pointer to a `Func_void_std__shared_ptr_HybridMultiResizerSpec_`.
+   * The pointer has to be a retained opaque `Unmanaged<Func_void_std__shared_ptr_HybridMultiResizerSpec_>`.
+   * This removes one strong reference from the object!
+   */
+  @inline(__always)
+  public static func fromUnsafe(_ pointer: UnsafeMutableRawPointer) -> Func_void_std__shared_ptr_HybridMultiResizerSpec_ {
+    return Unmanaged<Func_void_std__shared_ptr_HybridMultiResizerSpec_>.fromOpaque(pointer).takeRetainedValue()
+  }
+}
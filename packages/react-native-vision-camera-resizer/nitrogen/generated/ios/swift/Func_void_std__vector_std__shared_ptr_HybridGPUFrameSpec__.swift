@@ -0,0 +1,50 @@
+///
+/// Func_void_std__vector_std__shared_ptr_HybridGPUFrameSpec__.swift
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+import NitroModules
+
+/**
+ * Wraps a Swift `(_ value: [(any HybridGPUFrameSpec)]) -> Void` as a class.
+ * This class can be used from C++, e.g. to wrap the Swift closure as a `std::function`.
+ */
+public final class Func_void_std__vector_std__shared_ptr_HybridGPUFrameSpec__ {
+  public typealias bridge = margelo.nitro.camera.resizer.bridge.swift
+
+  private let closure: (_ value: [(any HybridGPUFrameSpec)]) -> Void
+
+  public init(_ closure: @escaping (_ value: [(any HybridGPUFrameSpec)]) -> Void) {
+    self.closure = closure
+  }
+
+  @inline(__always)
+  public func call(value: bridge.std__vector_std__shared_ptr_HybridGPUFrameSpec__) -> Void {
+    self.closure(value.map({ __item in { () -> any HybridGPUFrameSpec in
+      let __unsafePointer = bridge.get_std__shared_ptr_HybridGPUFrameSpec_(__item)
+      let __instance = HybridGPUFrameSpec_cxx.fromUnsafe(__unsafePointer)
+      return __instance.getHybridGPUFrameSpec()
+    }() }))
+  }
+
+  /**
+   * Casts this instance to a retained unsafe raw pointer.
+   * This acquires one additional strong reference on the object!
+   */
+  @inline(__always)
+  public func toUnsafe() -> UnsafeMutableRawPointer {
+    return Unmanaged.passRetained(self).toOpaque()
+  }
+
+  /**
+   * Casts an unsafe pointer to a `Func_void_std__vector_std__shared_ptr_HybridGPUFrameSpec__`.
+   * The pointer has to be a retained opaque `Unmanaged<Func_void_std__vector_std__shared_ptr_HybridGPUFrameSpec__>`.
+   * This removes one strong reference from the object!
+   */
+  @inline(__always)
+  public static func fromUnsafe(_ pointer: UnsafeMutableRawPointer) -> Func_void_std__vector_std__shared_ptr_HybridGPUFrameSpec__ {
+    return Unmanaged<Func_void_std__vector_std__shared_ptr_HybridGPUFrameSpec__>.fromOpaque(pointer).takeRetainedValue()
+  }
+}
@@ -12,12 +12,17 @@ public protocol HybridGPUFrameSpec_protocol: HybridObject {
   // Properties
   var width: Double { get }
   var height: Double { get }
+  var batchSize: Double { get }
   var channelOrder: ChannelOrder? { get }
   var dataType: DataType? { get }
   var pixelLayout: PixelLayout? { get }
+  var frameStatistics: FrameStatistics? { get }
 
   // Methods
   func getPixelBuffer() throws -> ArrayBuffer
+  func getNativeBuffer() throws -> NativeBuffer
+  func getTransform(batchIndex: Double?) throws -> ResizeTransform
+  func convertOutputPointsToFramePoints(points: ArrayBuffer, batchIndex: Double?) throws -> Void
 }
 
 public extension HybridGPUFrameSpec_protocol {
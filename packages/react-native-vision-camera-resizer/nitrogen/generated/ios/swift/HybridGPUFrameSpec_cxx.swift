@@ -135,6 +135,13 @@ open class HybridGPUFrameSpec_cxx {
     }
   }
   
+  public final var batchSize: Double {
+    @inline(__always)
+    get {
+      return self.__implementation.batchSize
+    }
+  }
+  
   public final var channelOrder: bridge.std__optional_ChannelOrder_ {
     @inline(__always)
     get {
@@ -173,6 +180,19 @@ open class HybridGPUFrameSpec_cxx {
       }()
     }
   }
+  
+  public final var frameStatistics: bridge.std__optional_FrameStatistics_ {
+    @inline(__always)
+    get {
+      return { () -> bridge.std__optional_FrameStatistics_ in
+        if let __unwrappedValue = self.__implementation.frameStatistics {
+          return bridge.create_std__optional_FrameStatistics_(__unwrappedValue)
+        } else {
+          return .init()
+        }
+      }()
+    }
+  }
 
   // Methods
   @inline(__always)
@@ -186,4 +206,53 @@ open class HybridGPUFrameSpec_cxx {
       return bridge.create_Result_std__shared_ptr_ArrayBuffer__(__exceptionPtr)
     }
   }
+  
+  @inline(__always)
+  public final func getNativeBuffer() -> bridge.Result_NativeBuffer_ {
+    do {
+      let __result = try self.__implementation.getNativeBuffer()
+      let __resultCpp = __result
+      return bridge.create_Result_NativeBuffer_(__resultCpp)
+    } catch (let __error) {
+      let __exceptionPtr = __error.toCpp()
+      return bridge.create_Result_NativeBuffer_(__exceptionPtr)
+    }
+  }
+  
+  @inline(__always)
+  public final func getTransform(batchIndex: bridge.std__optional_double_) -> bridge.Result_ResizeTransform_ {
+    do {
+      let __result = try self.__implementation.getTransform(batchIndex: { () -> Double? in
+        if bridge.has_value_std__optional_double_(batchIndex) {
+          let __unwrapped = bridge.get_std__optional_double_(batchIndex)
+          return __unwrapped
+        } else {
+          return nil
+        }
+      }())
+      let __resultCpp = __result
+      return bridge.create_Result_ResizeTransform_(__resultCpp)
+    } catch (let __error) {
+      let __exceptionPtr = __error.toCpp()
+      return bridge.create_Result_ResizeTransform_(__exceptionPtr)
+    }
+  }
+  
+  @inline(__always)
+  public final func convertOutputPointsToFramePoints(points: ArrayBuffer, batchIndex: bridge.std__optional_double_) -> bridge.Result_void_ {
+    do {
+      try self.__implementation.convertOutputPointsToFramePoints(points: points, batchIndex: { () -> Double? in
+        if bridge.has_value_std__optional_double_(batchIndex) {
+          let __unwrapped = bridge.get_std__optional_double_(batchIndex)
+          return __unwrapped
+        } else {
+          return nil
+        }
+      }())
+      return bridge.create_Result_void_()
+    } catch (let __error) {
+      let __exceptionPtr = __error.toCpp()
+      return bridge.create_Result_void_(__exceptionPtr)
+    }
+  }
 }
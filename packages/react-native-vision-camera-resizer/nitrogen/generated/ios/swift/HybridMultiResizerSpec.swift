@@ -0,0 +1,58 @@
+///
+/// HybridMultiResizerSpec.swift
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+import VisionCamera
+import NitroModules
+
+/// See ``HybridMultiResizerSpec``
+public protocol HybridMultiResizerSpec_protocol: HybridObject {
+  // Properties
+  
+
+  // Methods
+  func resize(frame: (any HybridFrameSpec), options: ResizeOptions?) throws -> [(any HybridGPUFrameSpec)]
+  func resizeAsync(frame: (any HybridFrameSpec), options: ResizeOptions?) throws -> Promise<[(any HybridGPUFrameSpec)]>
+  func getStatistics() throws -> ResizerStatistics
+}
+
+public extension HybridMultiResizerSpec_protocol {
+  /// Default implementation of ``HybridObject.toString``
+  func toString() -> String {
+    return "[HybridObject MultiResizer]"
+  }
+}
+
+/// See ``HybridMultiResizerSpec``
+open class HybridMultiResizerSpec_base {
+  private weak var cxxWrapper: HybridMultiResizerSpec_cxx? = nil
+  public init() { }
+  public func getCxxWrapper() -> HybridMultiResizerSpec_cxx {
+  #if DEBUG
+    guard self is any HybridMultiResizerSpec else {
+      fatalError("`self` is not a `HybridMultiResizerSpec`! Did you accidentally inherit from `HybridMultiResizerSpec_base` instead of `HybridMultiResizerSpec`?")
+    }
+  #endif
+    if let cxxWrapper = self.cxxWrapper {
+      return cxxWrapper
+    } else {
+      let cxxWrapper = HybridMultiResizerSpec_cxx(self as! any HybridMultiResizerSpec)
+      self.cxxWrapper = cxxWrapper
+      return cxxWrapper
+    }
+  }
+}
+
+/**
+ * A Swift base-protocol representing the MultiResizer HybridObject.
+ * Implement this protocol to create Swift-based instances of MultiResizer.
+ * ```swift
+ * class HybridMultiResizer : HybridMultiResizerSpec {
+ *   // ...
+ * }
+ * ```
+ */
+public typealias HybridMultiResizerSpec = HybridMultiResizerSpec_protocol & HybridMultiResizerSpec_base
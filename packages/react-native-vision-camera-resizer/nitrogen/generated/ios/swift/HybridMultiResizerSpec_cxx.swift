@@ -0,0 +1,210 @@
+///
+/// HybridMultiResizerSpec_cxx.swift
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+import NitroModules
+import VisionCamera
+
+/**
+ * A class implementation that bridges HybridMultiResizerSpec over to C++.
+ * In C++, we cannot use Swift protocols - so we need to wrap it in a class to make it strongly defined.
+ *
+ * Also, some Swift types need to be bridged with special handling:
+ * - Enums need to be wrapped in Structs, otherwise they cannot be accessed bi-directionally (Swift bug: https://github.com/swiftlang/swift/issues/75330)
+ * - Other HybridObjects need to be wrapped/unwrapped from the Swift TCxx wrapper
+ * - Throwing methods need to be wrapped with a Result<T, Error> type, as exceptions cannot be propagated to C++
+ */
+open class HybridMultiResizerSpec_cxx {
+  /**
+   * The Swift <> C++ bridge's namespace (`margelo::nitro::camera::resizer::bridge::swift`)
+   * from `VisionCameraResizer-Swift-Cxx-Bridge.hpp`.
+   * This contains specialized C++ templates, and C++ helper functions that can be accessed from Swift.
+   */
+  public typealias bridge = margelo.nitro.camera.resizer.bridge.swift
+
+  /**
+   * Holds an instance of the `HybridMultiResizerSpec` Swift protocol.
+   */
+  private var __implementation: any HybridMultiResizerSpec
+
+  /**
+   * Holds a weak pointer to the C++ class that wraps the Swift class.
+   */
+  private var __cxxPart: bridge.std__weak_ptr_HybridMultiResizerSpec_
+
+  /**
+   * Create a new `HybridMultiResizerSpec_cxx` that wraps the given `HybridMultiResizerSpec`.
+   * All properties and methods bridge to C++ types.
+   */
+  public init(_ implementation: any HybridMultiResizerSpec) {
+    self.__implementation = implementation
+    self.__cxxPart = .init()
+    /* no base class */
+  }
+
+  /**
+   * Get the actual `HybridMultiResizerSpec` instance this class wraps.
+   */
+  @inline(__always)
+  public func getHybridMultiResizerSpec() -> any HybridMultiResizerSpec {
+    return __implementation
+  }
+
+  /**
+   * Casts this instance to a retained unsafe raw pointer.
+   * This acquires one additional strong reference on the object!
+   */
+  public func toUnsafe() -> UnsafeMutableRawPointer {
+    return Unmanaged.passRetained(self).toOpaque()
+  }
+
+  /**
+   * Casts an unsafe pointer to a `HybridMultiResizerSpec_cxx`.
+   * The pointer has to be a retained opaque `Unmanaged<HybridMultiResizerSpec_cxx>`.
+   * This removes one strong reference from the object!
+   */
+  public class func fromUnsafe(_ pointer: UnsafeMutableRawPointer) -> HybridMultiResizerSpec_cxx {
+    return Unmanaged<HybridMultiResizerSpec_cxx>.fromOpaque(pointer).takeRetainedValue()
+  }
+
+  /**
+   * Gets (or creates) the C++ part of this Hybrid Object.
+   * The C++ part is a `std::shared_ptr<HybridMultiResizerSpec>`.
+   */
+  public func getCxxPart() -> bridge.std__shared_ptr_HybridMultiResizerSpec_ {
+    let cachedCxxPart = self.__cxxPart.lock()
+    if Bool(fromCxx: cachedCxxPart) {
+      return cachedCxxPart
+    } else {
+      let newCxxPart = bridge.create_std__shared_ptr_HybridMultiResizerSpec_(self.toUnsafe())
+      __cxxPart = bridge.weakify_std__shared_ptr_HybridMultiResizerSpec_(newCxxPart)
+      return newCxxPart
+    }
+  }
+
+  
+
+  /**
+   * Get the memory size of the Swift class (plus size of any other allocations)
+   * so the JS VM can properly track it and garbage-collect the JS object if needed.
+   */
+  @inline(__always)
+  public var memorySize: Int {
+    return MemoryHelper.getSizeOf(self.__implementation) + self.__implementation.memorySize
+  }
+
+  /**
+   * Compares this object with the given [other] object for reference equality.
+   */
+  @inline(__always)
+  public func equals(other: HybridMultiResizerSpec_cxx) -> Bool {
+    return self.__implementation === other.__implementation
+  }
+
+  /**
+   * Call dispose() on the Swift class.
+   * This _may_ be called manually from JS.
+   */
+  @inline(__always)
+  public func dispose() {
+    self.__implementation.dispose()
+  }
+
+  /**
+   * Call toString() on the Swift class.
+   */
+  @inline(__always)
+  public func toString() -> String {
+    return self.__implementation.toString()
+  }
+
+  // Properties
+  
+
+  // Methods
+  @inline(__always)
+  public final func resize(frame: bridge.std__shared_ptr_margelo__nitro__camera__HybridFrameSpec_, options: bridge.std__optional_ResizeOptions_) -> bridge.Result_std__vector_std__shared_ptr_HybridGPUFrameSpec___ {
+    do {
+      let __result = try self.__implementation.resize(frame: { () -> any HybridFrameSpec in
+        let __unsafePointer = bridge.get_std__shared_ptr_margelo__nitro__camera__HybridFrameSpec_(frame)
+        let __instance = HybridFrameSpec_cxx.fromUnsafe(__unsafePointer)
+        return __instance.getHybridFrameSpec()
+      }(), options: { () -> ResizeOptions? in
+        if bridge.has_value_std__optional_ResizeOptions_(options) {
+          let __unwrapped = bridge.get_std__optional_ResizeOptions_(options)
+          return __unwrapped
+        } else {
+          return nil
+        }
+      }())
+      let __resultCpp = { () -> bridge.std__vector_std__shared_ptr_HybridGPUFrameSpec__ in
+        var __vector = bridge.create_std__vector_std__shared_ptr_HybridGPUFrameSpec__(__result.count)
+        for __item in __result {
+          __vector.push_back({ () -> bridge.std__shared_ptr_HybridGPUFrameSpec_ in
+            let __cxxWrapped = __item.getCxxWrapper()
+            return __cxxWrapped.getCxxPart()
+          }())
+        }
+        return __vector
+      }()
+      return bridge.create_Result_std__vector_std__shared_ptr_HybridGPUFrameSpec___(__resultCpp)
+    } catch (let __error) {
+      let __exceptionPtr = __error.toCpp()
+      return bridge.create_Result_std__vector_std__shared_ptr_HybridGPUFrameSpec___(__exceptionPtr)
+    }
+  }
+  
+  @inline(__always)
+  public final func resizeAsync(frame: bridge.std__shared_ptr_margelo__nitro__camera__HybridFrameSpec_, options: bridge.std__optional_ResizeOptions_) -> bridge.Result_std__shared_ptr_Promise_std__vector_std__shared_ptr_HybridGPUFrameSpec_____ {
+    do {
+      let __result = try self.__implementation.resizeAsync(frame: { () -> any HybridFrameSpec in
+        let __unsafePointer = bridge.get_std__shared_ptr_margelo__nitro__camera__HybridFrameSpec_(frame)
+        let __instance = HybridFrameSpec_cxx.fromUnsafe(__unsafePointer)
+        return __instance.getHybridFrameSpec()
+      }(), options: { () -> ResizeOptions? in
+        if bridge.has_value_std__optional_ResizeOptions_(options) {
+          let __unwrapped = bridge.get_std__optional_ResizeOptions_(options)
+          return __unwrapped
+        } else {
+          return nil
+        }
+      }())
+      let __resultCpp = { () -> bridge.std__shared_ptr_Promise_std__vector_std__shared_ptr_HybridGPUFrameSpec____ in
+        let __promise = bridge.create_std__shared_ptr_Promise_std__vector_std__shared_ptr_HybridGPUFrameSpec____()
+        let __promiseHolder = bridge.wrap_std__shared_ptr_Promise_std__vector_std__shared_ptr_HybridGPUFrameSpec____(__promise)
+        __result
+          .then({ __result in __promiseHolder.resolve({ () -> bridge.std__vector_std__shared_ptr_HybridGPUFrameSpec__ in
+              var __vector = bridge.create_std__vector_std__shared_ptr_HybridGPUFrameSpec__(__result.count)
+              for __item in __result {
+                __vector.push_back({ () -> bridge.std__shared_ptr_HybridGPUFrameSpec_ in
+                  let __cxxWrapped = __item.getCxxWrapper()
+                  return __cxxWrapped.getCxxPart()
+                }())
+              }
+              return __vector
+            }()) })
+          .catch({ __error in __promiseHolder.reject(__error.toCpp()) })
+        return __promise
+      }()
+      return bridge.create_Result_std__shared_ptr_Promise_std__vector_std__shared_ptr_HybridGPUFrameSpec_____(__resultCpp)
+    } catch (let __error) {
+      let __exceptionPtr = __error.toCpp()
+      return bridge.create_Result_std__shared_ptr_Promise_std__vector_std__shared_ptr_HybridGPUFrameSpec_____(__exceptionPtr)
+    }
+  }
+  
+  @inline(__always)
+  public final func getStatistics() -> bridge.Result_ResizerStatistics_ {
+    do {
+      let __result = try self.__implementation.getStatistics()
+      let __resultCpp = __result
+      return bridge.create_Result_ResizerStatistics_(__resultCpp)
+    } catch (let __error) {
+      let __exceptionPtr = __error.toCpp()
+      return bridge.create_Result_ResizerStatistics_(__exceptionPtr)
+    }
+  }
+}
@@ -15,6 +15,8 @@ public protocol HybridResizerFactorySpec_protocol: HybridObject {
   // Methods
   func isAvailable() throws -> Bool
   func createResizer(options: ResizerOptions) throws -> Promise<(any HybridResizerSpec)>
+  func createMultiResizer(options: [ResizerOptions]) throws -> Promise<(any HybridMultiResizerSpec)>
+  func prewarm(options: [ResizerOptions]) throws -> Promise<Void>
 }
 
 public extension HybridResizerFactorySpec_protocol {
@@ -157,4 +157,45 @@ open class HybridResizerFactorySpec_cxx {
       return bridge.create_Result_std__shared_ptr_Promise_std__shared_ptr_HybridResizerSpec____(__exceptionPtr)
     }
   }
+  
+  @inline(__always)
+  public final func createMultiResizer(options: bridge.std__vector_ResizerOptions_) -> bridge.Result_std__shared_ptr_Promise_std__shared_ptr_HybridMultiResizerSpec____ {
+    do {
+      let __result = try self.__implementation.createMultiResizer(options: options.map({ __item in __item }))
+      let __resultCpp = { () -> bridge.std__shared_ptr_Promise_std__shared_ptr_HybridMultiResizerSpec___ in
+        let __promise = bridge.create_std__shared_ptr_Promise_std__shared_ptr_HybridMultiResizerSpec___()
+        let __promiseHolder = bridge.wrap_std__shared_ptr_Promise_std__shared_ptr_HybridMultiResizerSpec___(__promise)
+        __result
+          .then({ __result in __promiseHolder.resolve({ () -> bridge.std__shared_ptr_HybridMultiResizerSpec_ in
+              let __cxxWrapped = __result.getCxxWrapper()
+              return __cxxWrapped.getCxxPart()
+            }()) })
+          .catch({ __error in __promiseHolder.reject(__error.toCpp()) })
+        return __promise
+      }()
+      return bridge.create_Result_std__shared_ptr_Promise_std__shared_ptr_HybridMultiResizerSpec____(__resultCpp)
+    } catch (let __error) {
+      let __exceptionPtr = __error.toCpp()
+      return bridge.create_Result_std__shared_ptr_Promise_std__shared_ptr_HybridMultiResizerSpec____(__exceptionPtr)
+    }
+  }
+  
+  @inline(__always)
+  public final func prewarm(options: bridge.std__vector_ResizerOptions_) -> bridge.Result_std__shared_ptr_Promise_void___ {
+    do {
+      let __result = try self.__implementation.prewarm(options: options.map({ __item in __item }))
+      let __resultCpp = { () -> bridge.std__shared_ptr_Promise_void__ in
+        let __promise = bridge.create_std__shared_ptr_Promise_void__()
+        let __promiseHolder = bridge.wrap_std__shared_ptr_Promise_void__(__promise)
+        __result
+          .then({ __result in __promiseHolder.resolve() })
+          .catch({ __error in __promiseHolder.reject(__error.toCpp()) })
+        return __promise
+      }()
+      return bridge.create_Result_std__shared_ptr_Promise_void___(__resultCpp)
+    } catch (let __error) {
+      let __exceptionPtr = __error.toCpp()
+      return bridge.create_Result_std__shared_ptr_Promise_void___(__exceptionPtr)
+    }
+  }
 }
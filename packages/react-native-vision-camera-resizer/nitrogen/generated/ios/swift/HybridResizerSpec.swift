@@ -14,7 +14,10 @@ public protocol HybridResizerSpec_protocol: HybridObject {
   
 
   // Methods
-  func resize(frame: (any HybridFrameSpec)) throws -> (any HybridGPUFrameSpec)
+  func resize(frame: (any HybridFrameSpec), options: ResizeOptions?) throws -> (any HybridGPUFrameSpec)
+  func resizeBatch(frame: (any HybridFrameSpec), regions: [Rect]) throws -> (any HybridGPUFrameSpec)
+  func resizeAsync(frame: (any HybridFrameSpec), options: ResizeOptions?) throws -> Promise<(any HybridGPUFrameSpec)>
+  func getStatistics() throws -> ResizerStatistics
 }
 
 public extension HybridResizerSpec_protocol {
@@ -126,12 +126,19 @@ open class HybridResizerSpec_cxx {
 
   // Methods
   @inline(__always)
-  public final func resize(frame: bridge.std__shared_ptr_margelo__nitro__camera__HybridFrameSpec_) -> bridge.Result_std__shared_ptr_HybridGPUFrameSpec__ {
+  public final func resize(frame: bridge.std__shared_ptr_margelo__nitro__camera__HybridFrameSpec_, options: bridge.std__optional_ResizeOptions_) -> bridge.Result_std__shared_ptr_HybridGPUFrameSpec__ {
     do {
       let __result = try self.__implementation.resize(frame: { () -> any HybridFrameSpec in
         let __unsafePointer = bridge.get_std__shared_ptr_margelo__nitro__camera__HybridFrameSpec_(frame)
         let __instance = HybridFrameSpec_cxx.fromUnsafe(__unsafePointer)
         return __instance.getHybridFrameSpec()
+      }(), options: { () -> ResizeOptions? in
+        if bridge.has_value_std__optional_ResizeOptions_(options) {
+          let __unwrapped = bridge.get_std__optional_ResizeOptions_(options)
+          return __unwrapped
+        } else {
+          return nil
+        }
       }())
       let __resultCpp = { () -> bridge.std__shared_ptr_HybridGPUFrameSpec_ in
         let __cxxWrapped = __result.getCxxWrapper()
@@ -143,4 +150,68 @@ open class HybridResizerSpec_cxx {
       return bridge.create_Result_std__shared_ptr_HybridGPUFrameSpec__(__exceptionPtr)
     }
   }
+  
+  @inline(__always)
+  public final func resizeBatch(frame: bridge.std__shared_ptr_margelo__nitro__camera__HybridFrameSpec_, regions: bridge.std__vector_Rect_) -> bridge.Result_std__shared_ptr_HybridGPUFrameSpec__ {
+    do {
+      let __result = try self.__implementation.resizeBatch(frame: { () -> any HybridFrameSpec in
+        let __unsafePointer = bridge.get_std__shared_ptr_margelo__nitro__camera__HybridFrameSpec_(frame)
+        let __instance = HybridFrameSpec_cxx.fromUnsafe(__unsafePointer)
+        return __instance.getHybridFrameSpec()
+      }(), regions: regions.map({ __item in __item }))
+      let __resultCpp = { () -> bridge.std__shared_ptr_HybridGPUFrameSpec_ in
+        let __cxxWrapped = __result.getCxxWrapper()
+        return __cxxWrapped.getCxxPart()
+      }()
+      return bridge.create_Result_std__shared_ptr_HybridGPUFrameSpec__(__resultCpp)
+    } catch (let __error) {
+      let __exceptionPtr = __error.toCpp()
+      return bridge.create_Result_std__shared_ptr_HybridGPUFrameSpec__(__exceptionPtr)
+    }
+  }
+  
+  @inline(__always)
+  public final func resizeAsync(frame: bridge.std__shared_ptr_margelo__nitro__camera__HybridFrameSpec_, options: bridge.std__optional_ResizeOptions_) -> bridge.Result_std__shared_ptr_Promise_std__shared_ptr_HybridGPUFrameSpec____ {
+    do {
+      let __result = try self.__implementation.resizeAsync(frame: { () -> any HybridFrameSpec in
+        let __unsafePointer = bridge.get_std__shared_ptr_margelo__nitro__camera__HybridFrameSpec_(frame)
+        let __instance = HybridFrameSpec_cxx.fromUnsafe(__unsafePointer)
+        return __instance.getHybridFrameSpec()
+      }(), options: { () -> ResizeOptions? in
+        if bridge.has_value_std__optional_ResizeOptions_(options) {
+          let __unwrapped = bridge.get_std__optional_ResizeOptions_(options)
+          return __unwrapped
+        } else {
+          return nil
+        }
+      }())
+      let __resultCpp = { () -> bridge.std__shared_ptr_Promise_std__shared_ptr_HybridGPUFrameSpec___ in
+        let __promise = bridge.create_std__shared_ptr_Promise_std__shared_ptr_HybridGPUFrameSpec___()
+        let __promiseHolder = bridge.wrap_std__shared_ptr_Promise_std__shared_ptr_HybridGPUFrameSpec___(__promise)
+        __result
+          .then({ __result in __promiseHolder.resolve({ () -> bridge.std__shared_ptr_HybridGPUFrameSpec_ in
+              let __cxxWrapped = __result.getCxxWrapper()
+              return __cxxWrapped.getCxxPart()
+            }()) })
+          .catch({ __error in __promiseHolder.reject(__error.toCpp()) })
+        return __promise
+      }()
+      return bridge.create_Result_std__shared_ptr_Promise_std__shared_ptr_HybridGPUFrameSpec____(__resultCpp)
+    } catch (let __error) {
+      let __exceptionPtr = __error.toCpp()
+      return bridge.create_Result_std__shared_ptr_Promise_std__shared_ptr_HybridGPUFrameSpec____(__exceptionPtr)
+    }
+  }
+  
+  @inline(__always)
+  public final func getStatistics() -> bridge.Result_ResizerStatistics_ {
+    do {
+      let __result = try self.__implementation.getStatistics()
+      let __resultCpp = __result
+      return bridge.create_Result_ResizerStatistics_(__resultCpp)
+    } catch (let __error) {
+      let __exceptionPtr = __error.toCpp()
+      return bridge.create_Result_ResizerStatistics_(__exceptionPtr)
+    }
+  }
 }
@@ -0,0 +1,49 @@
+///
+/// ImportCacheStatistics.swift
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+import NitroModules
+
+/**
+ * Represents an instance of `ImportCacheStatistics`, backed by a C++ struct.
+ */
+public typealias ImportCacheStatistics = margelo.nitro.camera.resizer.ImportCacheStatistics
+
+public extension ImportCacheStatistics {
+  private typealias bridge = margelo.nitro.camera.resizer.bridge.swift
+
+  /**
+   * Create a new instance of `ImportCacheStatistics`.
+   */
+  init(hits: Double, misses: Double, evictions: Double, size: Double, capacity: Double) {
+    self.init(hits, misses, evictions, size, capacity)
+  }
+
+  @inline(__always)
+  var hits: Double {
+    return self.__hits
+  }
+  
+  @inline(__always)
+  var misses: Double {
+    return self.__misses
+  }
+  
+  @inline(__always)
+  var evictions: Double {
+    return self.__evictions
+  }
+  
+  @inline(__always)
+  var size: Double {
+    return self.__size
+  }
+  
+  @inline(__always)
+  var capacity: Double {
+    return self.__capacity
+  }
+}
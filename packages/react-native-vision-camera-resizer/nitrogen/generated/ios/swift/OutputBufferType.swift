@@ -0,0 +1,44 @@
+///
+/// OutputBufferType.swift
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+/**
+ * Represents the JS union `OutputBufferType`, backed by a C++ enum.
+ */
+public typealias OutputBufferType = margelo.nitro.camera.resizer.OutputBufferType
+
+public extension OutputBufferType {
+  /**
+   * Get a OutputBufferType for the given String value, or
+   * return `nil` if the given value was invalid/unknown.
+   */
+  init?(fromString string: String) {
+    switch string {
+      case "cpu":
+        self = .cpu
+      case "native":
+        self = .native
+      case "texture":
+        self = .texture
+      default:
+        return nil
+    }
+  }
+
+  /**
+   * Get the String value this OutputBufferType represents.
+   */
+  var stringValue: String {
+    switch self {
+      case .cpu:
+        return "cpu"
+      case .native:
+        return "native"
+      case .texture:
+        return "texture"
+    }
+  }
+}
@@ -0,0 +1,44 @@
+///
+/// Rect.swift
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+import NitroModules
+
+/**
+ * Represents an instance of `Rect`, backed by a C++ struct.
+ */
+public typealias Rect = margelo.nitro.camera.resizer.Rect
+
+public extension Rect {
+  private typealias bridge = margelo.nitro.camera.resizer.bridge.swift
+
+  /**
+   * Create a new instance of `Rect`.
+   */
+  init(left: Double, right: Double, top: Double, bottom: Double) {
+    self.init(left, right, top, bottom)
+  }
+
+  @inline(__always)
+  var left: Double {
+    return self.__left
+  }
+  
+  @inline(__always)
+  var right: Double {
+    return self.__right
+  }
+  
+  @inline(__always)
+  var top: Double {
+    return self.__top
+  }
+  
+  @inline(__always)
+  var bottom: Double {
+    return self.__bottom
+  }
+}
@@ -0,0 +1,40 @@
+///
+/// ResizeFilter.swift
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+/**
+ * Represents the JS union `ResizeFilter`, backed by a C++ enum.
+ */
+public typealias ResizeFilter = margelo.nitro.camera.resizer.ResizeFilter
+
+public extension ResizeFilter {
+  /**
+   * Get a ResizeFilter for the given String value, or
+   * return `nil` if the given value was invalid/unknown.
+   */
+  init?(fromString string: String) {
+    switch string {
+      case "bilinear":
+        self = .bilinear
+      case "area":
+        self = .area
+      default:
+        return nil
+    }
+  }
+
+  /**
+   * Get the String value this ResizeFilter represents.
+   */
+  var stringValue: String {
+    switch self {
+      case .bilinear:
+        return "bilinear"
+      case .area:
+        return "area"
+    }
+  }
+}
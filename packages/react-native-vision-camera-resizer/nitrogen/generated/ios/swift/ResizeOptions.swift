@@ -0,0 +1,78 @@
+///
+/// ResizeOptions.swift
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+import NitroModules
+
+/**
+ * Represents an instance of `ResizeOptions`, backed by a C++ struct.
+ */
+public typealias ResizeOptions = margelo.nitro.camera.resizer.ResizeOptions
+
+public extension ResizeOptions {
+  private typealias bridge = margelo.nitro.camera.resizer.bridge.swift
+
+  /**
+   * Create a new instance of `ResizeOptions`.
+   */
+  init(crop: Rect?, width: Double?, height: Double?) {
+    self.init({ () -> bridge.std__optional_Rect_ in
+      if let __unwrappedValue = crop {
+        return bridge.create_std__optional_Rect_(__unwrappedValue)
+      } else {
+        return .init()
+      }
+    }(), { () -> bridge.std__optional_double_ in
+      if let __unwrappedValue = width {
+        return bridge.create_std__optional_double_(__unwrappedValue)
+      } else {
+        return .init()
+      }
+    }(), { () -> bridge.std__optional_double_ in
+      if let __unwrappedValue = height {
+        return bridge.create_std__optional_double_(__unwrappedValue)
+      } else {
+        return .init()
+      }
+    }())
+  }
+
+  @inline(__always)
+  var crop: Rect? {
+    return { () -> Rect? in
+      if bridge.has_value_std__optional_Rect_(self.__crop) {
+        let __unwrapped = bridge.get_std__optional_Rect_(self.__crop)
+        return __unwrapped
+      } else {
+        return nil
+      }
+    }()
+  }
+  
+  @inline(__always)
+  var width: Double? {
+    return { () -> Double? in
+      if bridge.has_value_std__optional_double_(self.__width) {
+        let __unwrapped = bridge.get_std__optional_double_(self.__width)
+        return __unwrapped
+      } else {
+        return nil
+      }
+    }()
+  }
+  
+  @inline(__always)
+  var height: Double? {
+    return { () -> Double? in
+      if bridge.has_value_std__optional_double_(self.__height) {
+        let __unwrapped = bridge.get_std__optional_double_(self.__height)
+        return __unwrapped
+      } else {
+        return nil
+      }
+    }()
+  }
+}
@@ -0,0 +1,59 @@
+///
+/// ResizeTransform.swift
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+import NitroModules
+
+/**
+ * Represents an instance of `ResizeTransform`, backed by a C++ struct.
+ */
+public typealias ResizeTransform = margelo.nitro.camera.resizer.ResizeTransform
+
+public extension ResizeTransform {
+  private typealias bridge = margelo.nitro.camera.resizer.bridge.swift
+
+  /**
+   * Create a new instance of `ResizeTransform`.
+   */
+  init(crop: Rect, rotationDegrees: Double, isMirrored: Bool, scaleX: Double, scaleY: Double, offsetX: Double, offsetY: Double) {
+    self.init(crop, rotationDegrees, isMirrored, scaleX, scaleY, offsetX, offsetY)
+  }
+
+  @inline(__always)
+  var crop: Rect {
+    return self.__crop
+  }
+  
+  @inline(__always)
+  var rotationDegrees: Double {
+    return self.__rotationDegrees
+  }
+  
+  @inline(__always)
+  var isMirrored: Bool {
+    return self.__isMirrored
+  }
+  
+  @inline(__always)
+  var scaleX: Double {
+    return self.__scaleX
+  }
+  
+  @inline(__always)
+  var scaleY: Double {
+    return self.__scaleY
+  }
+  
+  @inline(__always)
+  var offsetX: Double {
+    return self.__offsetX
+  }
+  
+  @inline(__always)
+  var offsetY: Double {
+    return self.__offsetY
+  }
+}
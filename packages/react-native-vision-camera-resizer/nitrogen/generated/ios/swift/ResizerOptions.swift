@@ -18,8 +18,92 @@ public extension ResizerOptions {
   /**
    * Create a new instance of `ResizerOptions`.
    */
-  init(width: Double, height: Double, channelOrder: ChannelOrder, dataType: DataType, scaleMode: ScaleMode, pixelLayout: PixelLayout) {
-    self.init(width, height, channelOrder, dataType, scaleMode, pixelLayout)
+  init(width: Double, height: Double, channelOrder: ChannelOrder, dataType: DataType, scaleMode: ScaleMode, pixelLayout: PixelLayout, outputBufferCount: Double?, maxBatchSize: Double?, mean: [Double]?, standardDeviation: [Double]?, quantizationScale: Double?, quantizationZeroPoint: Double?, outputBufferType: OutputBufferType?, enableProfiling: Bool?, enableFrameStatistics: Bool?, filter: ResizeFilter?, maxWidth: Double?, maxHeight: Double?) {
+    self.init(width, height, channelOrder, dataType, scaleMode, pixelLayout, { () -> bridge.std__optional_double_ in
+      if let __unwrappedValue = outputBufferCount {
+        return bridge.create_std__optional_double_(__unwrappedValue)
+      } else {
+        return .init()
+      }
+    }(), { () -> bridge.std__optional_double_ in
+      if let __unwrappedValue = maxBatchSize {
+        return bridge.create_std__optional_double_(__unwrappedValue)
+      } else {
+        return .init()
+      }
+    }(), { () -> bridge.std__optional_std__vector_double__ in
+      if let __unwrappedValue = mean {
+        return bridge.create_std__optional_std__vector_double__({ () -> bridge.std__vector_double_ in
+          var __vector = bridge.create_std__vector_double_(__unwrappedValue.count)
+          for __item in __unwrappedValue {
+            __vector.push_back(__item)
+          }
+          return __vector
+        }())
+      } else {
+        return .init()
+      }
+    }(), { () -> bridge.std__optional_std__vector_double__ in
+      if let __unwrappedValue = standardDeviation {
+        return bridge.create_std__optional_std__vector_double__({ () -> bridge.std__vector_double_ in
+          var __vector = bridge.create_std__vector_double_(__unwrappedValue.count)
+          for __item in __unwrappedValue {
+            __vector.push_back(__item)
+          }
+          return __vector
+        }())
+      } else {
+        return .init()
+      }
+    }(), { () -> bridge.std__optional_double_ in
+      if let __unwrappedValue = quantizationScale {
+        return bridge.create_std__optional_double_(__unwrappedValue)
+      } else {
+        return .init()
+      }
+    }(), { () -> bridge.std__optional_double_ in
+      if let __unwrappedValue = quantizationZeroPoint {
+        return bridge.create_std__optional_double_(__unwrappedValue)
+      } else {
+        return .init()
+      }
+    }(), { () -> bridge.std__optional_OutputBufferType_ in
+      if let __unwrappedValue = outputBufferType {
+        return bridge.create_std__optional_OutputBufferType_(__unwrappedValue)
+      } else {
+        return .init()
+      }
+    }(), { () -> bridge.std__optional_bool_ in
+      if let __unwrappedValue = enableProfiling {
+        return bridge.create_std__optional_bool_(__unwrappedValue)
+      } else {
+        return .init()
+      }
+    }(), { () -> bridge.std__optional_bool_ in
+      if let __unwrappedValue = enableFrameStatistics {
+        return bridge.create_std__optional_bool_(__unwrappedValue)
+      } else {
+        return .init()
+      }
+    }(), { () -> bridge.std__optional_ResizeFilter_ in
+      if let __unwrappedValue = filter {
+        return bridge.create_std__optional_ResizeFilter_(__unwrappedValue)
+      } else {
+        return .init()
+      }
+    }(), { () -> bridge.std__optional_double_ in
+      if let __unwrappedValue = maxWidth {
+        return bridge.create_std__optional_double_(__unwrappedValue)
+      } else {
+        return .init()
+      }
+    }(), { () -> bridge.std__optional_double_ in
+      if let __unwrappedValue = maxHeight {
+        return bridge.create_std__optional_double_(__unwrappedValue)
+      } else {
+        return .init()
+      }
+    }())
   }
 
   @inline(__always)
@@ -51,4 +135,134 @@ public extension ResizerOptions {
   var pixelLayout: PixelLayout {
     return self.__pixelLayout
   }
+  
+  @inline(__always)
+  var outputBufferCount: Double? {
+    return { () -> Double? in
+      if bridge.has_value_std__optional_double_(self.__outputBufferCount) {
+        let __unwrapped = bridge.get_std__optional_double_(self.__outputBufferCount)
+        return __unwrapped
+      } else {
+        return nil
+      }
+    }()
+  }
+  
+  @inline(__always)
+  var maxBatchSize: Double? {
+    return { () -> Double? in
+      if bridge.has_value_std__optional_double_(self.__maxBatchSize) {
+        let __unwrapped = bridge.get_std__optional_double_(self.__maxBatchSize)
+        return __unwrapped
+      } else {
+        return nil
+      }
+    }()
+  }
+  
+  @inline(__always)
+  var mean: [Double]? {
+    return { () -> [Double]? in
+      if bridge.has_value_std__optional_std__vector_double__(self.__mean) {
+        let __unwrapped = bridge.get_std__optional_std__vector_double__(self.__mean)
+        return __unwrapped.map({ __item in __item })
+      } else {
+        return nil
+      }
+    }()
+  }
+  
+  @inline(__always)
+  var standardDeviation: [Double]? {
+    return { () -> [Double]? in
+      if bridge.has_value_std__optional_std__vector_double__(self.__standardDeviation) {
+        let __unwrapped = bridge.get_std__optional_std__vector_double__(self.__standardDeviation)
+        return __unwrapped.map({ __item in __item })
+      } else {
+        return nil
+      }
+    }()
+  }
+  
+  @inline(__always)
+  var quantizationScale: Double? {
+    return { () -> Double? in
+      if bridge.has_value_std__optional_double_(self.__quantizationScale) {
+        let __unwrapped = bridge.get_std__optional_double_(self.__quantizationScale)
+        return __unwrapped
+      } else {
+        return nil
+      }
+    }()
+  }
+  
+  @inline(__always)
+  var quantizationZeroPoint: Double? {
+    return { () -> Double? in
+      if bridge.has_value_std__optional_double_(self.__quantizationZeroPoint) {
+        let __unwrapped = bridge.get_std__optional_double_(self.__quantizationZeroPoint)
+        return __unwrapped
+      } else {
+        return nil
+      }
+    }()
+  }
+  
+  @inline(__always)
+  var outputBufferType: OutputBufferType? {
+    return self.__outputBufferType.value
+  }
+  
+  @inline(__always)
+  var enableProfiling: Bool? {
+    return { () -> Bool? in
+      if bridge.has_value_std__optional_bool_(self.__enableProfiling) {
+        let __unwrapped = bridge.get_std__optional_bool_(self.__enableProfiling)
+        return __unwrapped
+      } else {
+        return nil
+      }
+    }()
+  }
+  
+  @inline(__always)
+  var enableFrameStatistics: Bool? {
+    return { () -> Bool? in
+      if bridge.has_value_std__optional_bool_(self.__enableFrameStatistics) {
+        let __unwrapped = bridge.get_std__optional_bool_(self.__enableFrameStatistics)
+        return __unwrapped
+      } else {
+        return nil
+      }
+    }()
+  }
+  
+  @inline(__always)
+  var filter: ResizeFilter? {
+    return self.__filter.value
+  }
+  
+  @inline(__always)
+  var maxWidth: Double? {
+    return { () -> Double? in
+      if bridge.has_value_std__optional_double_(self.__maxWidth) {
+        let __unwrapped = bridge.get_std__optional_double_(self.__maxWidth)
+        return __unwrapped
+      } else {
+        return nil
+      }
+    }()
+  }
+  
+  @inline(__always)
+  var maxHeight: Double? {
+    return { () -> Double? in
+      if bridge.has_value_std__optional_double_(self.__maxHeight) {
+        let __unwrapped = bridge.get_std__optional_double_(self.__maxHeight)
+        return __unwrapped
+      } else {
+        return nil
+      }
+    }()
+  }
 }
@@ -0,0 +1,60 @@
+///
+/// ResizerStatistics.swift
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+import NitroModules
+
+/**
+ * Represents an instance of `ResizerStatistics`, backed by a C++ struct.
+ */
+public typealias ResizerStatistics = margelo.nitro.camera.resizer.ResizerStatistics
+
+public extension ResizerStatistics {
+  private typealias bridge = margelo.nitro.camera.resizer.bridge.swift
+
+  /**
+   * Create a new instance of `ResizerStatistics`.
+   */
+  init(importCache: ImportCacheStatistics?, timings: ResizerTimingStatistics?) {
+    self.init({ () -> bridge.std__optional_ImportCacheStatistics_ in
+      if let __unwrappedValue = importCache {
+        return bridge.create_std__optional_ImportCacheStatistics_(__unwrappedValue)
+      } else {
+        return .init()
+      }
+    }(), { () -> bridge.std__optional_ResizerTimingStatistics_ in
+      if let __unwrappedValue = timings {
+        return bridge.create_std__optional_ResizerTimingStatistics_(__unwrappedValue)
+      } else {
+        return .init()
+      }
+    }())
+  }
+
+  @inline(__always)
+  var importCache: ImportCacheStatistics? {
+    return { () -> ImportCacheStatistics? in
+      if bridge.has_value_std__optional_ImportCacheStatistics_(self.__importCache) {
+        let __unwrapped = bridge.get_std__optional_ImportCacheStatistics_(self.__importCache)
+        return __unwrapped
+      } else {
+        return nil
+      }
+    }()
+  }
+  
+  @inline(__always)
+  var timings: ResizerTimingStatistics? {
+    return { () -> ResizerTimingStatistics? in
+      if bridge.has_value_std__optional_ResizerTimingStatistics_(self.__timings) {
+        let __unwrapped = bridge.get_std__optional_ResizerTimingStatistics_(self.__timings)
+        return __unwrapped
+      } else {
+        return nil
+      }
+    }()
+  }
+}
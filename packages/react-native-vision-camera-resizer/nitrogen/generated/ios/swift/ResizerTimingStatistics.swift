@@ -0,0 +1,85 @@
+///
+/// ResizerTimingStatistics.swift
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+import NitroModules
+
+/**
+ * Represents an instance of `ResizerTimingStatistics`, backed by a C++ struct.
+ */
+public typealias ResizerTimingStatistics = margelo.nitro.camera.resizer.ResizerTimingStatistics
+
+public extension ResizerTimingStatistics {
+  private typealias bridge = margelo.nitro.camera.resizer.bridge.swift
+
+  /**
+   * Create a new instance of `ResizerTimingStatistics`.
+   */
+  init(queryProperties: StageTimingStatistics, importImage: StageTimingStatistics, record: StageTimingStatistics, submit: StageTimingStatistics, wait: StageTimingStatistics, gpuFill: StageTimingStatistics?, gpuDispatch: StageTimingStatistics?) {
+    self.init(queryProperties, importImage, record, submit, wait, { () -> bridge.std__optional_StageTimingStatistics_ in
+      if let __unwrappedValue = gpuFill {
+        return bridge.create_std__optional_StageTimingStatistics_(__unwrappedValue)
+      } else {
+        return .init()
+      }
+    }(), { () -> bridge.std__optional_StageTimingStatistics_ in
+      if let __unwrappedValue = gpuDispatch {
+        return bridge.create_std__optional_StageTimingStatistics_(__unwrappedValue)
+      } else {
+        return .init()
+      }
+    }())
+  }
+
+  @inline(__always)
+  var queryProperties: StageTimingStatistics {
+    return self.__queryProperties
+  }
+  
+  @inline(__always)
+  var importImage: StageTimingStatistics {
+    return self.__importImage
+  }
+  
+  @inline(__always)
+  var record: StageTimingStatistics {
+    return self.__record
+  }
+  
+  @inline(__always)
+  var submit: StageTimingStatistics {
+    return self.__submit
+  }
+  
+  @inline(__always)
+  var wait: StageTimingStatistics {
+    return self.__wait
+  }
+  
+  @inline(__always)
+  var gpuFill: StageTimingStatistics? {
+    return { () -> StageTimingStatistics? in
+      if bridge.has_value_std__optional_StageTimingStatistics_(self.__gpuFill) {
+        let __unwrapped = bridge.get_std__optional_StageTimingStatistics_(self.__gpuFill)
+        return __unwrapped
+      } else {
+        return nil
+      }
+    }()
+  }
+  
+  @inline(__always)
+  var gpuDispatch: StageTimingStatistics? {
+    return { () -> StageTimingStatistics? in
+      if bridge.has_value_std__optional_StageTimingStatistics_(self.__gpuDispatch) {
+        let __unwrapped = bridge.get_std__optional_StageTimingStatistics_(self.__gpuDispatch)
+        return __unwrapped
+      } else {
+        return nil
+      }
+    }()
+  }
+}
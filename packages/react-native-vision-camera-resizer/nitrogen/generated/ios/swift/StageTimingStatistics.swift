@@ -0,0 +1,44 @@
+///
+/// StageTimingStatistics.swift
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+import NitroModules
+
+/**
+ * Represents an instance of `StageTimingStatistics`, backed by a C++ struct.
+ */
+public typealias StageTimingStatistics = margelo.nitro.camera.resizer.StageTimingStatistics
+
+public extension StageTimingStatistics {
+  private typealias bridge = margelo.nitro.camera.resizer.bridge.swift
+
+  /**
+   * Create a new instance of `StageTimingStatistics`.
+   */
+  init(sampleCount: Double, p50: Double, p95: Double, p99: Double) {
+    self.init(sampleCount, p50, p95, p99)
+  }
+
+  @inline(__always)
+  var sampleCount: Double {
+    return self.__sampleCount
+  }
+  
+  @inline(__always)
+  var p50: Double {
+    return self.__p50
+  }
+  
+  @inline(__always)
+  var p95: Double {
+    return self.__p95
+  }
+  
+  @inline(__always)
+  var p99: Double {
+    return self.__p99
+  }
+}
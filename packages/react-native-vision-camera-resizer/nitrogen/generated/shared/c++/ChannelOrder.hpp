@@ -31,6 +31,10 @@ namespace margelo::nitro::camera::resizer {
   enum class ChannelOrder {
     RGB      SWIFT_NAME(rgb) = 0,
     BGR      SWIFT_NAME(bgr) = 1,
+    GRAY      SWIFT_NAME(gray) = 2,
+    RGBA      SWIFT_NAME(rgba) = 3,
+    BGRA      SWIFT_NAME(bgra) = 4,
+    ARGB      SWIFT_NAME(argb) = 5,
   } CLOSED_ENUM;
 
 } // namespace margelo::nitro::camera::resizer
@@ -45,6 +49,10 @@ namespace margelo::nitro {
       switch (hashString(unionValue.c_str(), unionValue.size())) {
         case hashString("rgb"): return margelo::nitro::camera::resizer::ChannelOrder::RGB;
         case hashString("bgr"): return margelo::nitro::camera::resizer::ChannelOrder::BGR;
+        case hashString("gray"): return margelo::nitro::camera::resizer::ChannelOrder::GRAY;
+        case hashString("rgba"): return margelo::nitro::camera::resizer::ChannelOrder::RGBA;
+        case hashString("bgra"): return margelo::nitro::camera::resizer::ChannelOrder::BGRA;
+        case hashString("argb"): return margelo::nitro::camera::resizer::ChannelOrder::ARGB;
         default: [[unlikely]]
           throw std::invalid_argument("Cannot convert \"" + unionValue + "\" to enum ChannelOrder - invalid value!");
       }
@@ -53,6 +61,10 @@ namespace margelo::nitro {
       switch (arg) {
         case margelo::nitro::camera::resizer::ChannelOrder::RGB: return JSIConverter<std::string>::toJSI(runtime, "rgb");
         case margelo::nitro::camera::resizer::ChannelOrder::BGR: return JSIConverter<std::string>::toJSI(runtime, "bgr");
+        case margelo::nitro::camera::resizer::ChannelOrder::GRAY: return JSIConverter<std::string>::toJSI(runtime, "gray");
+        case margelo::nitro::camera::resizer::ChannelOrder::RGBA: return JSIConverter<std::string>::toJSI(runtime, "rgba");
+        case margelo::nitro::camera::resizer::ChannelOrder::BGRA: return JSIConverter<std::string>::toJSI(runtime, "bgra");
+        case margelo::nitro::camera::resizer::ChannelOrder::ARGB: return JSIConverter<std::string>::toJSI(runtime, "argb");
         default: [[unlikely]]
           throw std::invalid_argument("Cannot convert ChannelOrder to JS - invalid value: "
                                     + std::to_string(static_cast<int>(arg)) + "!");
@@ -66,6 +78,10 @@ namespace margelo::nitro {
       switch (hashString(unionValue.c_str(), unionValue.size())) {
         case hashString("rgb"):
         case hashString("bgr"):
+        case hashString("gray"):
+        case hashString("rgba"):
+        case hashString("bgra"):
+        case hashString("argb"):
           return true;
         default:
           return false;
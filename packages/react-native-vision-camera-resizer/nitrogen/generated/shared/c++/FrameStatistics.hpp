@@ -0,0 +1,92 @@
+///
+/// FrameStatistics.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <vector>
+#include <optional>
+
+namespace margelo::nitro::camera::resizer {
+
+  /**
+   * A struct which can be represented as a JavaScript object (FrameStatistics).
+   */
+  struct FrameStatistics final {
+  public:
+    double meanLuma     SWIFT_PRIVATE;
+    std::vector<double> thumbnail     SWIFT_PRIVATE;
+    std::optional<double> motion     SWIFT_PRIVATE;
+
+  public:
+    FrameStatistics() = default;
+    explicit FrameStatistics(double meanLuma, std::vector<double> thumbnail, std::optional<double> motion): meanLuma(meanLuma), thumbnail(thumbnail), motion(motion) {}
+
+  public:
+    friend bool operator==(const FrameStatistics& lhs, const FrameStatistics& rhs) = default;
+  };
+
+} // namespace margelo::nitro::camera::resizer
+
+namespace margelo::nitro {
+
+  // C++ FrameStatistics <> JS FrameStatistics (object)
+  template <>
+  struct JSIConverter<margelo::nitro::camera::resizer::FrameStatistics> final {
+    static inline margelo::nitro::camera::resizer::FrameStatistics fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::camera::resizer::FrameStatistics(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "meanLuma"))),
+        JSIConverter<std::vector<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "thumbnail"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "motion")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::camera::resizer::FrameStatistics& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "meanLuma"), JSIConverter<double>::toJSI(runtime, arg.meanLuma));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "thumbnail"), JSIConverter<std::vector<double>>::toJSI(runtime, arg.thumbnail));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "motion"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.motion));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "meanLuma")))) return false;
+      if (!JSIConverter<std::vector<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "thumbnail")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "motion")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -16,10 +16,15 @@ namespace margelo::nitro::camera::resizer {
     registerHybrids(this, [](Prototype& prototype) {
       prototype.registerHybridGetter("width", &HybridGPUFrameSpec::getWidth);
       prototype.registerHybridGetter("height", &HybridGPUFrameSpec::getHeight);
+      prototype.registerHybridGetter("batchSize", &HybridGPUFrameSpec::getBatchSize);
       prototype.registerHybridGetter("channelOrder", &HybridGPUFrameSpec::getChannelOrder);
       prototype.registerHybridGetter("dataType", &HybridGPUFrameSpec::getDataType);
       prototype.registerHybridGetter("pixelLayout", &HybridGPUFrameSpec::getPixelLayout);
+      prototype.registerHybridGetter("frameStatistics", &HybridGPUFrameSpec::getFrameStatistics);
       prototype.registerHybridMethod("getPixelBuffer", &HybridGPUFrameSpec::getPixelBuffer);
+      prototype.registerHybridMethod("getNativeBuffer", &HybridGPUFrameSpec::getNativeBuffer);
+      prototype.registerHybridMethod("getTransform", &HybridGPUFrameSpec::getTransform);
+      prototype.registerHybridMethod("convertOutputPointsToFramePoints", &HybridGPUFrameSpec::convertOutputPointsToFramePoints);
     });
   }
 
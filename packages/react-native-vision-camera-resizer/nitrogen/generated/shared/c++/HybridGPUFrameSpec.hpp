@@ -19,12 +19,21 @@ namespace margelo::nitro::camera::resizer { enum class ChannelOrder; }
 namespace margelo::nitro::camera::resizer { enum class DataType; }
 // Forward declaration of `PixelLayout` to properly resolve imports.
 namespace margelo::nitro::camera::resizer { enum class PixelLayout; }
+// Forward declaration of `FrameStatistics` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct FrameStatistics; }
+// Forward declaration of `NativeBuffer` to properly resolve imports.
+namespace margelo::nitro::camera { struct NativeBuffer; }
+// Forward declaration of `ResizeTransform` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct ResizeTransform; }
 
 #include "ChannelOrder.hpp"
 #include <optional>
 #include "DataType.hpp"
 #include "PixelLayout.hpp"
+#include "FrameStatistics.hpp"
 #include <NitroModules/ArrayBuffer.hpp>
+#include <VisionCamera/NativeBuffer.hpp>
+#include "ResizeTransform.hpp"
 
 namespace margelo::nitro::camera::resizer {
 
@@ -55,13 +64,18 @@ namespace margelo::nitro::camera::resizer {
       // Properties
       virtual double getWidth() = 0;
       virtual double getHeight() = 0;
+      virtual double getBatchSize() = 0;
       virtual std::optional<ChannelOrder> getChannelOrder() = 0;
       virtual std::optional<DataType> getDataType() = 0;
       virtual std::optional<PixelLayout> getPixelLayout() = 0;
+      virtual std::optional<FrameStatistics> getFrameStatistics() = 0;
 
     public:
       // Methods
       virtual std::shared_ptr<ArrayBuffer> getPixelBuffer() = 0;
+      virtual NativeBuffer getNativeBuffer() = 0;
+      virtual ResizeTransform getTransform(std::optional<double> batchIndex) = 0;
+      virtual void convertOutputPointsToFramePoints(const std::shared_ptr<ArrayBuffer>& points, std::optional<double> batchIndex) = 0;
 
     protected:
       // Hybrid Setup
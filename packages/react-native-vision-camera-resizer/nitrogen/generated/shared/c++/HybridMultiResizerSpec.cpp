@@ -0,0 +1,23 @@
+///
+/// HybridMultiResizerSpec.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#include "HybridMultiResizerSpec.hpp"
+
+namespace margelo::nitro::camera::resizer {
+
+  void HybridMultiResizerSpec::loadHybridMethods() {
+    // load base methods/properties
+    HybridObject::loadHybridMethods();
+    // load custom methods/properties
+    registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridMethod("resize", &HybridMultiResizerSpec::resize);
+      prototype.registerHybridMethod("resizeAsync", &HybridMultiResizerSpec::resizeAsync);
+      prototype.registerHybridMethod("getStatistics", &HybridMultiResizerSpec::getStatistics);
+    });
+  }
+
+} // namespace margelo::nitro::camera::resizer
@@ -0,0 +1,78 @@
+///
+/// HybridMultiResizerSpec.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/HybridObject.hpp>)
+#include <NitroModules/HybridObject.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `HybridGPUFrameSpec` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { class HybridGPUFrameSpec; }
+// Forward declaration of `HybridFrameSpec` to properly resolve imports.
+namespace margelo::nitro::camera { class HybridFrameSpec; }
+// Forward declaration of `ResizeOptions` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct ResizeOptions; }
+// Forward declaration of `ResizerStatistics` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct ResizerStatistics; }
+
+#include <memory>
+#include "HybridGPUFrameSpec.hpp"
+#include <VisionCamera/HybridFrameSpec.hpp>
+#include "ResizeOptions.hpp"
+#include <optional>
+#include <vector>
+#include <NitroModules/Promise.hpp>
+#include "ResizerStatistics.hpp"
+
+namespace margelo::nitro::camera::resizer {
+
+  using namespace margelo::nitro;
+
+  /**
+   * An abstract base class for `MultiResizer`
+   * Inherit this class to create instances of `HybridMultiResizerSpec` in C++.
+   * You must explicitly call `HybridObject`'s constructor yourself, because it is virtual.
+   * @example
+   * ```cpp
+   * class HybridMultiResizer: public HybridMultiResizerSpec {
+   * public:
+   *   HybridMultiResizer(...): HybridObject(TAG) { ... }
+   *   // ...
+   * };
+   * ```
+   */
+  class HybridMultiResizerSpec: public virtual HybridObject {
+    public:
+      // Constructor
+      explicit HybridMultiResizerSpec(): HybridObject(TAG) { }
+
+      // Destructor
+      ~HybridMultiResizerSpec() override = default;
+
+    public:
+      // Properties
+      
+
+    public:
+      // Methods
+      virtual std::vector<std::shared_ptr<HybridGPUFrameSpec>> resize(const std::shared_ptr<margelo::nitro::camera::HybridFrameSpec>& frame, const std::optional<ResizeOptions>& options) = 0;
+      virtual std::shared_ptr<Promise<std::vector<std::shared_ptr<HybridGPUFrameSpec>>>> resizeAsync(const std::shared_ptr<margelo::nitro::camera::HybridFrameSpec>& frame, const std::optional<ResizeOptions>& options) = 0;
+      virtual ResizerStatistics getStatistics() = 0;
+
+    protected:
+      // Hybrid Setup
+      void loadHybridMethods() override;
+
+    protected:
+      // Tag for logging
+      static constexpr auto TAG = "MultiResizer";
+  };
+
+} // namespace margelo::nitro::camera::resizer
@@ -16,6 +16,8 @@ namespace margelo::nitro::camera::resizer {
     registerHybrids(this, [](Prototype& prototype) {
       prototype.registerHybridMethod("isAvailable", &HybridResizerFactorySpec::isAvailable);
       prototype.registerHybridMethod("createResizer", &HybridResizerFactorySpec::createResizer);
+      prototype.registerHybridMethod("createMultiResizer", &HybridResizerFactorySpec::createMultiResizer);
+      prototype.registerHybridMethod("prewarm", &HybridResizerFactorySpec::prewarm);
     });
   }
 
@@ -15,6 +15,8 @@
 
 // Forward declaration of `HybridResizerSpec` to properly resolve imports.
 namespace margelo::nitro::camera::resizer { class HybridResizerSpec; }
+// Forward declaration of `HybridMultiResizerSpec` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { class HybridMultiResizerSpec; }
 // Forward declaration of `ResizerOptions` to properly resolve imports.
 namespace margelo::nitro::camera::resizer { struct ResizerOptions; }
 
@@ -22,6 +24,8 @@ namespace margelo::nitro::camera::resizer { struct ResizerOptions; }
 #include "HybridResizerSpec.hpp"
 #include <NitroModules/Promise.hpp>
 #include "ResizerOptions.hpp"
+#include "HybridMultiResizerSpec.hpp"
+#include <vector>
 
 namespace margelo::nitro::camera::resizer {
 
@@ -56,6 +60,8 @@ namespace margelo::nitro::camera::resizer {
       // Methods
       virtual bool isAvailable() = 0;
       virtual std::shared_ptr<Promise<std::shared_ptr<HybridResizerSpec>>> createResizer(const ResizerOptions& options) = 0;
+      virtual std::shared_ptr<Promise<std::shared_ptr<HybridMultiResizerSpec>>> createMultiResizer(const std::vector<ResizerOptions>& options) = 0;
+      virtual std::shared_ptr<Promise<void>> prewarm(const std::vector<ResizerOptions>& options) = 0;
 
     protected:
       // Hybrid Setup
@@ -15,6 +15,9 @@ namespace margelo::nitro::camera::resizer {
     // load custom methods/properties
     registerHybrids(this, [](Prototype& prototype) {
       prototype.registerHybridMethod("resize", &HybridResizerSpec::resize);
+      prototype.registerHybridMethod("resizeBatch", &HybridResizerSpec::resizeBatch);
+      prototype.registerHybridMethod("resizeAsync", &HybridResizerSpec::resizeAsync);
+      prototype.registerHybridMethod("getStatistics", &HybridResizerSpec::getStatistics);
     });
   }
 
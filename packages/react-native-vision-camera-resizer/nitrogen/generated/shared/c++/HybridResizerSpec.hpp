@@ -17,10 +17,22 @@
 namespace margelo::nitro::camera::resizer { class HybridGPUFrameSpec; }
 // Forward declaration of `HybridFrameSpec` to properly resolve imports.
 namespace margelo::nitro::camera { class HybridFrameSpec; }
+// Forward declaration of `ResizeOptions` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct ResizeOptions; }
+// Forward declaration of `Rect` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct Rect; }
+// Forward declaration of `ResizerStatistics` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct ResizerStatistics; }
 
 #include <memory>
 #include "HybridGPUFrameSpec.hpp"
 #include <VisionCamera/HybridFrameSpec.hpp>
+#include "ResizeOptions.hpp"
+#include <optional>
+#include "Rect.hpp"
+#include <vector>
+#include <NitroModules/Promise.hpp>
+#include "ResizerStatistics.hpp"
 
 namespace margelo::nitro::camera::resizer {
 
@@ -53,7 +65,10 @@ namespace margelo::nitro::camera::resizer {
 
     public:
       // Methods
-      virtual std::shared_ptr<HybridGPUFrameSpec> resize(const std::shared_ptr<margelo::nitro::camera::HybridFrameSpec>& frame) = 0;
+      virtual std::shared_ptr<HybridGPUFrameSpec> resize(const std::shared_ptr<margelo::nitro::camera::HybridFrameSpec>& frame, const std::optional<ResizeOptions>& options) = 0;
+      virtual std::shared_ptr<HybridGPUFrameSpec> resizeBatch(const std::shared_ptr<margelo::nitro::camera::HybridFrameSpec>& frame, const std::vector<Rect>& regions) = 0;
+      virtual std::shared_ptr<Promise<std::shared_ptr<HybridGPUFrameSpec>>> resizeAsync(const std::shared_ptr<margelo::nitro::camera::HybridFrameSpec>& frame, const std::optional<ResizeOptions>& options) = 0;
+      virtual ResizerStatistics getStatistics() = 0;
 
     protected:
       // Hybrid Setup
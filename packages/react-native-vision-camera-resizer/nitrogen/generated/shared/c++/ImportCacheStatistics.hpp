@@ -0,0 +1,99 @@
+///
+/// ImportCacheStatistics.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+
+
+namespace margelo::nitro::camera::resizer {
+
+  /**
+   * A struct which can be represented as a JavaScript object (ImportCacheStatistics).
+   */
+  struct ImportCacheStatistics final {
+  public:
+    double hits     SWIFT_PRIVATE;
+    double misses     SWIFT_PRIVATE;
+    double evictions     SWIFT_PRIVATE;
+    double size     SWIFT_PRIVATE;
+    double capacity     SWIFT_PRIVATE;
+
+  public:
+    ImportCacheStatistics() = default;
+    explicit ImportCacheStatistics(double hits, double misses, double evictions, double size, double capacity): hits(hits), misses(misses), evictions(evictions), size(size), capacity(capacity) {}
+
+  public:
+    friend bool operator==(const ImportCacheStatistics& lhs, const ImportCacheStatistics& rhs) = default;
+  };
+
+} // namespace margelo::nitro::camera::resizer
+
+namespace margelo::nitro {
+
+  // C++ ImportCacheStatistics <> JS ImportCacheStatistics (object)
+  template <>
+  struct JSIConverter<margelo::nitro::camera::resizer::ImportCacheStatistics> final {
+    static inline margelo::nitro::camera::resizer::ImportCacheStatistics fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::camera::resizer::ImportCacheStatistics(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "hits"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "misses"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "evictions"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "size"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "capacity")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::camera::resizer::ImportCacheStatistics& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "hits"), JSIConverter<double>::toJSI(runtime, arg.hits));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "misses"), JSIConverter<double>::toJSI(runtime, arg.misses));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "evictions"), JSIConverter<double>::toJSI(runtime, arg.evictions));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "size"), JSIConverter<double>::toJSI(runtime, arg.size));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "capacity"), JSIConverter<double>::toJSI(runtime, arg.capacity));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "hits")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "misses")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "evictions")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "size")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "capacity")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,80 @@
+///
+/// OutputBufferType.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/NitroHash.hpp>)
+#include <NitroModules/NitroHash.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+namespace margelo::nitro::camera::resizer {
+
+  /**
+   * An enum which can be represented as a JavaScript union (OutputBufferType).
+   */
+  enum class OutputBufferType {
+    CPU      SWIFT_NAME(cpu) = 0,
+    NATIVE      SWIFT_NAME(native) = 1,
+    TEXTURE      SWIFT_NAME(texture) = 2,
+  } CLOSED_ENUM;
+
+} // namespace margelo::nitro::camera::resizer
+
+namespace margelo::nitro {
+
+  // C++ OutputBufferType <> JS OutputBufferType (union)
+  template <>
+  struct JSIConverter<margelo::nitro::camera::resizer::OutputBufferType> final {
+    static inline margelo::nitro::camera::resizer::OutputBufferType fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      std::string unionValue = JSIConverter<std::string>::fromJSI(runtime, arg);
+      switch (hashString(unionValue.c_str(), unionValue.size())) {
+        case hashString("cpu"): return margelo::nitro::camera::resizer::OutputBufferType::CPU;
+        case hashString("native"): return margelo::nitro::camera::resizer::OutputBufferType::NATIVE;
+        case hashString("texture"): return margelo::nitro::camera::resizer::OutputBufferType::TEXTURE;
+        default: [[unlikely]]
+          throw std::invalid_argument("Cannot convert \"" + unionValue + "\" to enum OutputBufferType - invalid value!");
+      }
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, margelo::nitro::camera::resizer::OutputBufferType arg) {
+      switch (arg) {
+        case margelo::nitro::camera::resizer::OutputBufferType::CPU: return JSIConverter<std::string>::toJSI(runtime, "cpu");
+        case margelo::nitro::camera::resizer::OutputBufferType::NATIVE: return JSIConverter<std::string>::toJSI(runtime, "native");
+        case margelo::nitro::camera::resizer::OutputBufferType::TEXTURE: return JSIConverter<std::string>::toJSI(runtime, "texture");
+        default: [[unlikely]]
+          throw std::invalid_argument("Cannot convert OutputBufferType to JS - invalid value: "
+                                    + std::to_string(static_cast<int>(arg)) + "!");
+      }
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isString()) {
+        return false;
+      }
+      std::string unionValue = JSIConverter<std::string>::fromJSI(runtime, value);
+      switch (hashString(unionValue.c_str(), unionValue.size())) {
+        case hashString("cpu"):
+        case hashString("native"):
+        case hashString("texture"):
+          return true;
+        default:
+          return false;
+      }
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,76 @@
+///
+/// ResizeFilter.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/NitroHash.hpp>)
+#include <NitroModules/NitroHash.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+namespace margelo::nitro::camera::resizer {
+
+  /**
+   * An enum which can be represented as a JavaScript union (ResizeFilter).
+   */
+  enum class ResizeFilter {
+    BILINEAR      SWIFT_NAME(bilinear) = 0,
+    AREA      SWIFT_NAME(area) = 1,
+  } CLOSED_ENUM;
+
+} // namespace margelo::nitro::camera::resizer
+
+namespace margelo::nitro {
+
+  // C++ ResizeFilter <> JS ResizeFilter (union)
+  template <>
+  struct JSIConverter<margelo::nitro::camera::resizer::ResizeFilter> final {
+    static inline margelo::nitro::camera::resizer::ResizeFilter fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      std::string unionValue = JSIConverter<std::string>::fromJSI(runtime, arg);
+      switch (hashString(unionValue.c_str(), unionValue.size())) {
+        case hashString("bilinear"): return margelo::nitro::camera::resizer::ResizeFilter::BILINEAR;
+        case hashString("area"): return margelo::nitro::camera::resizer::ResizeFilter::AREA;
+        default: [[unlikely]]
+          throw std::invalid_argument("Cannot convert \"" + unionValue + "\" to enum ResizeFilter - invalid value!");
+      }
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, margelo::nitro::camera::resizer::ResizeFilter arg) {
+      switch (arg) {
+        case margelo::nitro::camera::resizer::ResizeFilter::BILINEAR: return JSIConverter<std::string>::toJSI(runtime, "bilinear");
+        case margelo::nitro::camera::resizer::ResizeFilter::AREA: return JSIConverter<std::string>::toJSI(runtime, "area");
+        default: [[unlikely]]
+          throw std::invalid_argument("Cannot convert ResizeFilter to JS - invalid value: "
+                                    + std::to_string(static_cast<int>(arg)) + "!");
+      }
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isString()) {
+        return false;
+      }
+      std::string unionValue = JSIConverter<std::string>::fromJSI(runtime, value);
+      switch (hashString(unionValue.c_str(), unionValue.size())) {
+        case hashString("bilinear"):
+        case hashString("area"):
+          return true;
+        default:
+          return false;
+      }
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,93 @@
+///
+/// ResizeOptions.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `Rect` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct Rect; }
+
+#include "Rect.hpp"
+#include <optional>
+
+namespace margelo::nitro::camera::resizer {
+
+  /**
+   * A struct which can be represented as a JavaScript object (ResizeOptions).
+   */
+  struct ResizeOptions final {
+  public:
+    std::optional<Rect> crop     SWIFT_PRIVATE;
+    std::optional<double> width     SWIFT_PRIVATE;
+    std::optional<double> height     SWIFT_PRIVATE;
+
+  public:
+    ResizeOptions() = default;
+    explicit ResizeOptions(std::optional<Rect> crop, std::optional<double> width, std::optional<double> height): crop(crop), width(width), height(height) {}
+
+  public:
+    friend bool operator==(const ResizeOptions& lhs, const ResizeOptions& rhs) = default;
+  };
+
+} // namespace margelo::nitro::camera::resizer
+
+namespace margelo::nitro {
+
+  // C++ ResizeOptions <> JS ResizeOptions (object)
+  template <>
+  struct JSIConverter<margelo::nitro::camera::resizer::ResizeOptions> final {
+    static inline margelo::nitro::camera::resizer::ResizeOptions fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::camera::resizer::ResizeOptions(
+        JSIConverter<std::optional<margelo::nitro::camera::resizer::Rect>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "crop"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "width"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "height")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::camera::resizer::ResizeOptions& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "crop"), JSIConverter<std::optional<margelo::nitro::camera::resizer::Rect>>::toJSI(runtime, arg.crop));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "width"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.width));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "height"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.height));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<std::optional<margelo::nitro::camera::resizer::Rect>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "crop")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "width")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "height")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
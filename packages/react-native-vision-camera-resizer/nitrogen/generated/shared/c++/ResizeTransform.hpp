@@ -0,0 +1,108 @@
+///
+/// ResizeTransform.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `Rect` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct Rect; }
+
+#include "Rect.hpp"
+
+namespace margelo::nitro::camera::resizer {
+
+  /**
+   * A struct which can be represented as a JavaScript object (ResizeTransform).
+   */
+  struct ResizeTransform final {
+  public:
+    Rect crop     SWIFT_PRIVATE;
+    double rotationDegrees     SWIFT_PRIVATE;
+    bool isMirrored     SWIFT_PRIVATE;
+    double scaleX     SWIFT_PRIVATE;
+    double scaleY     SWIFT_PRIVATE;
+    double offsetX     SWIFT_PRIVATE;
+    double offsetY     SWIFT_PRIVATE;
+
+  public:
+    ResizeTransform() = default;
+    explicit ResizeTransform(Rect crop, double rotationDegrees, bool isMirrored, double scaleX, double scaleY, double offsetX, double offsetY): crop(crop), rotationDegrees(rotationDegrees), isMirrored(isMirrored), scaleX(scaleX), scaleY(scaleY), offsetX(offsetX), offsetY(offsetY) {}
+
+  public:
+    friend bool operator==(const ResizeTransform& lhs, const ResizeTransform& rhs) = default;
+  };
+
+} // namespace margelo::nitro::camera::resizer
+
+namespace margelo::nitro {
+
+  // C++ ResizeTransform <> JS ResizeTransform (object)
+  template <>
+  struct JSIConverter<margelo::nitro::camera::resizer::ResizeTransform> final {
+    static inline margelo::nitro::camera::resizer::ResizeTransform fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::camera::resizer::ResizeTransform(
+        JSIConverter<margelo::nitro::camera::resizer::Rect>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "crop"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "rotationDegrees"))),
+        JSIConverter<bool>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "isMirrored"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "scaleX"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "scaleY"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "offsetX"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "offsetY")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::camera::resizer::ResizeTransform& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "crop"), JSIConverter<margelo::nitro::camera::resizer::Rect>::toJSI(runtime, arg.crop));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "rotationDegrees"), JSIConverter<double>::toJSI(runtime, arg.rotationDegrees));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "isMirrored"), JSIConverter<bool>::toJSI(runtime, arg.isMirrored));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "scaleX"), JSIConverter<double>::toJSI(runtime, arg.scaleX));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "scaleY"), JSIConverter<double>::toJSI(runtime, arg.scaleY));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "offsetX"), JSIConverter<double>::toJSI(runtime, arg.offsetX));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "offsetY"), JSIConverter<double>::toJSI(runtime, arg.offsetY));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<margelo::nitro::camera::resizer::Rect>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "crop")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "rotationDegrees")))) return false;
+      if (!JSIConverter<bool>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "isMirrored")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "scaleX")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "scaleY")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "offsetX")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "offsetY")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
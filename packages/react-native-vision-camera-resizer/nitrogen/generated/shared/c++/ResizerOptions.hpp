@@ -36,11 +36,19 @@ namespace margelo::nitro::camera::resizer { enum class DataType; }
 namespace margelo::nitro::camera::resizer { enum class ScaleMode; }
 // Forward declaration of `PixelLayout` to properly resolve imports.
 namespace margelo::nitro::camera::resizer { enum class PixelLayout; }
+// Forward declaration of `OutputBufferType` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { enum class OutputBufferType; }
+// Forward declaration of `ResizeFilter` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { enum class ResizeFilter; }
 
 #include "ChannelOrder.hpp"
 #include "DataType.hpp"
 #include "ScaleMode.hpp"
 #include "PixelLayout.hpp"
+#include "OutputBufferType.hpp"
+#include "ResizeFilter.hpp"
+#include <optional>
+#include <vector>
 
 namespace margelo::nitro::camera::resizer {
 
@@ -55,10 +63,22 @@ namespace margelo::nitro::camera::resizer {
     DataType dataType     SWIFT_PRIVATE;
     ScaleMode scaleMode     SWIFT_PRIVATE;
     PixelLayout pixelLayout     SWIFT_PRIVATE;
+    std::optional<double> outputBufferCount     SWIFT_PRIVATE;
+    std::optional<double> maxBatchSize     SWIFT_PRIVATE;
+    std::optional<std::vector<double>> mean     SWIFT_PRIVATE;
+    std::optional<std::vector<double>> standardDeviation     SWIFT_PRIVATE;
+    std::optional<double> quantizationScale     SWIFT_PRIVATE;
+    std::optional<double> quantizationZeroPoint     SWIFT_PRIVATE;
+    std::optional<OutputBufferType> outputBufferType     SWIFT_PRIVATE;
+    std::optional<bool> enableProfiling     SWIFT_PRIVATE;
+    std::optional<bool> enableFrameStatistics     SWIFT_PRIVATE;
+    std::optional<ResizeFilter> filter     SWIFT_PRIVATE;
+    std::optional<double> maxWidth     SWIFT_PRIVATE;
+    std::optional<double> maxHeight     SWIFT_PRIVATE;
 
   public:
     ResizerOptions() = default;
-    explicit ResizerOptions(double width, double height, ChannelOrder channelOrder, DataType dataType, ScaleMode scaleMode, PixelLayout pixelLayout): width(width), height(height), channelOrder(channelOrder), dataType(dataType), scaleMode(scaleMode), pixelLayout(pixelLayout) {}
+    explicit ResizerOptions(double width, double height, ChannelOrder channelOrder, DataType dataType, ScaleMode scaleMode, PixelLayout pixelLayout, std::optional<double> outputBufferCount, std::optional<double> maxBatchSize, std::optional<std::vector<double>> mean, std::optional<std::vector<double>> standardDeviation, std::optional<double> quantizationScale, std::optional<double> quantizationZeroPoint, std::optional<OutputBufferType> outputBufferType, std::optional<bool> enableProfiling, std::optional<bool> enableFrameStatistics, std::optional<ResizeFilter> filter, std::optional<double> maxWidth, std::optional<double> maxHeight): width(width), height(height), channelOrder(channelOrder), dataType(dataType), scaleMode(scaleMode), pixelLayout(pixelLayout), outputBufferCount(outputBufferCount), maxBatchSize(maxBatchSize), mean(mean), standardDeviation(standardDeviation), quantizationScale(quantizationScale), quantizationZeroPoint(quantizationZeroPoint), outputBufferType(outputBufferType), enableProfiling(enableProfiling), enableFrameStatistics(enableFrameStatistics), filter(filter), maxWidth(maxWidth), maxHeight(maxHeight) {}
 
   public:
     friend bool operator==(const ResizerOptions& lhs, const ResizerOptions& rhs) = default;
@@ -79,7 +99,19 @@ namespace margelo::nitro {
         JSIConverter<margelo::nitro::camera::resizer::ChannelOrder>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "channelOrder"))),
         JSIConverter<margelo::nitro::camera::resizer::DataType>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "dataType"))),
         JSIConverter<margelo::nitro::camera::resizer::ScaleMode>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "scaleMode"))),
-        JSIConverter<margelo::nitro::camera::resizer::PixelLayout>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "pixelLayout")))
+        JSIConverter<margelo::nitro::camera::resizer::PixelLayout>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "pixelLayout"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "outputBufferCount"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "maxBatchSize"))),
+        JSIConverter<std::optional<std::vector<double>>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "mean"))),
+        JSIConverter<std::optional<std::vector<double>>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "standardDeviation"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "quantizationScale"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "quantizationZeroPoint"))),
+        JSIConverter<std::optional<margelo::nitro::camera::resizer::OutputBufferType>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "outputBufferType"))),
+        JSIConverter<std::optional<bool>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "enableProfiling"))),
+        JSIConverter<std::optional<bool>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "enableFrameStatistics"))),
+        JSIConverter<std::optional<margelo::nitro::camera::resizer::ResizeFilter>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "filter"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "maxWidth"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "maxHeight")))
       );
     }
     static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::camera::resizer::ResizerOptions& arg) {
@@ -90,6 +122,18 @@ namespace margelo::nitro {
       obj.setProperty(runtime, PropNameIDCache::get(runtime, "dataType"), JSIConverter<margelo::nitro::camera::resizer::DataType>::toJSI(runtime, arg.dataType));
       obj.setProperty(runtime, PropNameIDCache::get(runtime, "scaleMode"), JSIConverter<margelo::nitro::camera::resizer::ScaleMode>::toJSI(runtime, arg.scaleMode));
       obj.setProperty(runtime, PropNameIDCache::get(runtime, "pixelLayout"), JSIConverter<margelo::nitro::camera::resizer::PixelLayout>::toJSI(runtime, arg.pixelLayout));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "outputBufferCount"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.outputBufferCount));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "maxBatchSize"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.maxBatchSize));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "mean"), JSIConverter<std::optional<std::vector<double>>>::toJSI(runtime, arg.mean));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "standardDeviation"), JSIConverter<std::optional<std::vector<double>>>::toJSI(runtime, arg.standardDeviation));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "quantizationScale"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.quantizationScale));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "quantizationZeroPoint"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.quantizationZeroPoint));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "outputBufferType"), JSIConverter<std::optional<margelo::nitro::camera::resizer::OutputBufferType>>::toJSI(runtime, arg.outputBufferType));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "enableProfiling"), JSIConverter<std::optional<bool>>::toJSI(runtime, arg.enableProfiling));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "enableFrameStatistics"), JSIConverter<std::optional<bool>>::toJSI(runtime, arg.enableFrameStatistics));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "filter"), JSIConverter<std::optional<margelo::nitro::camera::resizer::ResizeFilter>>::toJSI(runtime, arg.filter));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "maxWidth"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.maxWidth));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "maxHeight"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.maxHeight));
       return obj;
     }
     static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
@@ -106,6 +150,18 @@ namespace margelo::nitro {
       if (!JSIConverter<margelo::nitro::camera::resizer::DataType>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "dataType")))) return false;
       if (!JSIConverter<margelo::nitro::camera::resizer::ScaleMode>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "scaleMode")))) return false;
       if (!JSIConverter<margelo::nitro::camera::resizer::PixelLayout>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "pixelLayout")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "outputBufferCount")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "maxBatchSize")))) return false;
+      if (!JSIConverter<std::optional<std::vector<double>>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "mean")))) return false;
+      if (!JSIConverter<std::optional<std::vector<double>>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "standardDeviation")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "quantizationScale")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "quantizationZeroPoint")))) return false;
+      if (!JSIConverter<std::optional<margelo::nitro::camera::resizer::OutputBufferType>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "outputBufferType")))) return false;
+      if (!JSIConverter<std::optional<bool>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "enableProfiling")))) return false;
+      if (!JSIConverter<std::optional<bool>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "enableFrameStatistics")))) return false;
+      if (!JSIConverter<std::optional<margelo::nitro::camera::resizer::ResizeFilter>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "filter")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "maxWidth")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "maxHeight")))) return false;
       return true;
     }
   };
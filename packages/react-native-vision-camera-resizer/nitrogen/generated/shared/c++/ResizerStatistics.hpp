@@ -0,0 +1,92 @@
+///
+/// ResizerStatistics.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `ImportCacheStatistics` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct ImportCacheStatistics; }
+// Forward declaration of `ResizerTimingStatistics` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct ResizerTimingStatistics; }
+
+#include "ImportCacheStatistics.hpp"
+#include "ResizerTimingStatistics.hpp"
+#include <optional>
+
+namespace margelo::nitro::camera::resizer {
+
+  /**
+   * A struct which can be represented as a JavaScript object (ResizerStatistics).
+   */
+  struct ResizerStatistics final {
+  public:
+    std::optional<ImportCacheStatistics> importCache     SWIFT_PRIVATE;
+    std::optional<ResizerTimingStatistics> timings     SWIFT_PRIVATE;
+
+  public:
+    ResizerStatistics() = default;
+    explicit ResizerStatistics(std::optional<ImportCacheStatistics> importCache, std::optional<ResizerTimingStatistics> timings): importCache(importCache), timings(timings) {}
+
+  public:
+    friend bool operator==(const ResizerStatistics& lhs, const ResizerStatistics& rhs) = default;
+  };
+
+} // namespace margelo::nitro::camera::resizer
+
+namespace margelo::nitro {
+
+  // C++ ResizerStatistics <> JS ResizerStatistics (object)
+  template <>
+  struct JSIConverter<margelo::nitro::camera::resizer::ResizerStatistics> final {
+    static inline margelo::nitro::camera::resizer::ResizerStatistics fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::camera::resizer::ResizerStatistics(
+        JSIConverter<std::optional<margelo::nitro::camera::resizer::ImportCacheStatistics>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "importCache"))),
+        JSIConverter<std::optional<margelo::nitro::camera::resizer::ResizerTimingStatistics>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "timings")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::camera::resizer::ResizerStatistics& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "importCache"), JSIConverter<std::optional<margelo::nitro::camera::resizer::ImportCacheStatistics>>::toJSI(runtime, arg.importCache));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "timings"), JSIConverter<std::optional<margelo::nitro::camera::resizer::ResizerTimingStatistics>>::toJSI(runtime, arg.timings));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<std::optional<margelo::nitro::camera::resizer::ImportCacheStatistics>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "importCache")))) return false;
+      if (!JSIConverter<std::optional<margelo::nitro::camera::resizer::ResizerTimingStatistics>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "timings")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,109 @@
+///
+/// ResizerTimingStatistics.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `StageTimingStatistics` to properly resolve imports.
+namespace margelo::nitro::camera::resizer { struct StageTimingStatistics; }
+
+#include "StageTimingStatistics.hpp"
+#include <optional>
+
+namespace margelo::nitro::camera::resizer {
+
+  /**
+   * A struct which can be represented as a JavaScript object (ResizerTimingStatistics).
+   */
+  struct ResizerTimingStatistics final {
+  public:
+    StageTimingStatistics queryProperties     SWIFT_PRIVATE;
+    StageTimingStatistics importImage     SWIFT_PRIVATE;
+    StageTimingStatistics record     SWIFT_PRIVATE;
+    StageTimingStatistics submit     SWIFT_PRIVATE;
+    StageTimingStatistics wait     SWIFT_PRIVATE;
+    std::optional<StageTimingStatistics> gpuFill     SWIFT_PRIVATE;
+    std::optional<StageTimingStatistics> gpuDispatch     SWIFT_PRIVATE;
+
+  public:
+    ResizerTimingStatistics() = default;
+    explicit ResizerTimingStatistics(StageTimingStatistics queryProperties, StageTimingStatistics importImage, StageTimingStatistics record, StageTimingStatistics submit, StageTimingStatistics wait, std::optional<StageTimingStatistics> gpuFill, std::optional<StageTimingStatistics> gpuDispatch): queryProperties(queryProperties), importImage(importImage), record(record), submit(submit), wait(wait), gpuFill(gpuFill), gpuDispatch(gpuDispatch) {}
+
+  public:
+    friend bool operator==(const ResizerTimingStatistics& lhs, const ResizerTimingStatistics& rhs) = default;
+  };
+
+} // namespace margelo::nitro::camera::resizer
+
+namespace margelo::nitro {
+
+  // C++ ResizerTimingStatistics <> JS ResizerTimingStatistics (object)
+  template <>
+  struct JSIConverter<margelo::nitro::camera::resizer::ResizerTimingStatistics> final {
+    static inline margelo::nitro::camera::resizer::ResizerTimingStatistics fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::camera::resizer::ResizerTimingStatistics(
+        JSIConverter<margelo::nitro::camera::resizer::StageTimingStatistics>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "queryProperties"))),
+        JSIConverter<margelo::nitro::camera::resizer::StageTimingStatistics>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "importImage"))),
+        JSIConverter<margelo::nitro::camera::resizer::StageTimingStatistics>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "record"))),
+        JSIConverter<margelo::nitro::camera::resizer::StageTimingStatistics>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "submit"))),
+        JSIConverter<margelo::nitro::camera::resizer::StageTimingStatistics>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "wait"))),
+        JSIConverter<std::optional<margelo::nitro::camera::resizer::StageTimingStatistics>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "gpuFill"))),
+        JSIConverter<std::optional<margelo::nitro::camera::resizer::StageTimingStatistics>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "gpuDispatch")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::camera::resizer::ResizerTimingStatistics& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "queryProperties"), JSIConverter<margelo::nitro::camera::resizer::StageTimingStatistics>::toJSI(runtime, arg.queryProperties));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "importImage"), JSIConverter<margelo::nitro::camera::resizer::StageTimingStatistics>::toJSI(runtime, arg.importImage));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "record"), JSIConverter<margelo::nitro::camera::resizer::StageTimingStatistics>::toJSI(runtime, arg.record));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "submit"), JSIConverter<margelo::nitro::camera::resizer::StageTimingStatistics>::toJSI(runtime, arg.submit));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "wait"), JSIConverter<margelo::nitro::camera::resizer::StageTimingStatistics>::toJSI(runtime, arg.wait));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "gpuFill"), JSIConverter<std::optional<margelo::nitro::camera::resizer::StageTimingStatistics>>::toJSI(runtime, arg.gpuFill));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "gpuDispatch"), JSIConverter<std::optional<margelo::nitro::camera::resizer::StageTimingStatistics>>::toJSI(runtime, arg.gpuDispatch));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<margelo::nitro::camera::resizer::StageTimingStatistics>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "queryProperties")))) return false;
+      if (!JSIConverter<margelo::nitro::camera::resizer::StageTimingStatistics>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "importImage")))) return false;
+      if (!JSIConverter<margelo::nitro::camera::resizer::StageTimingStatistics>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "record")))) return false;
+      if (!JSIConverter<margelo::nitro::camera::resizer::StageTimingStatistics>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "submit")))) return false;
+      if (!JSIConverter<margelo::nitro::camera::resizer::StageTimingStatistics>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "wait")))) return false;
+      if (!JSIConverter<std::optional<margelo::nitro::camera::resizer::StageTimingStatistics>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "gpuFill")))) return false;
+      if (!JSIConverter<std::optional<margelo::nitro::camera::resizer::StageTimingStatistics>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "gpuDispatch")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
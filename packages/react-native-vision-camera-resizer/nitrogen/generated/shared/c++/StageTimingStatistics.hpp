@@ -0,0 +1,95 @@
+///
+/// StageTimingStatistics.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+
+
+namespace margelo::nitro::camera::resizer {
+
+  /**
+   * A struct which can be represented as a JavaScript object (StageTimingStatistics).
+   */
+  struct StageTimingStatistics final {
+  public:
+    double sampleCount     SWIFT_PRIVATE;
+    double p50     SWIFT_PRIVATE;
+    double p95     SWIFT_PRIVATE;
+    double p99     SWIFT_PRIVATE;
+
+  public:
+    StageTimingStatistics() = default;
+    explicit StageTimingStatistics(double sampleCount, double p50, double p95, double p99): sampleCount(sampleCount), p50(p50), p95(p95), p99(p99) {}
+
+  public:
+    friend bool operator==(const StageTimingStatistics& lhs, const StageTimingStatistics& rhs) = default;
+  };
+
+} // namespace margelo::nitro::camera::resizer
+
+namespace margelo::nitro {
+
+  // C++ StageTimingStatistics <> JS StageTimingStatistics (object)
+  template <>
+  struct JSIConverter<margelo::nitro::camera::resizer::StageTimingStatistics> final {
+    static inline margelo::nitro::camera::resizer::StageTimingStatistics fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::camera::resizer::StageTimingStatistics(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "sampleCount"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "p50"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "p95"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "p99")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::camera::resizer::StageTimingStatistics& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "sampleCount"), JSIConverter<double>::toJSI(runtime, arg.sampleCount));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "p50"), JSIConverter<double>::toJSI(runtime, arg.p50));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "p95"), JSIConverter<double>::toJSI(runtime, arg.p95));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "p99"), JSIConverter<double>::toJSI(runtime, arg.p99));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "sampleCount")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "p50")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "p95")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "p99")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -1,4 +1,5 @@
 import { NitroModules } from 'react-native-nitro-modules'
+import type { MultiResizer } from './specs/MultiResizer.nitro'
 import type { Resizer } from './specs/Resizer.nitro'
 import type {
   ResizerFactory,
@@ -26,6 +27,39 @@ export function createResizer(options: ResizerOptions): Promise<Resizer> {
   return factory.createResizer(options)
 }
 
+/**
+ * Create a new {@linkcode MultiResizer} that resizes each {@linkcode Frame}
+ * into one output per given {@linkcode ResizerOptions}, in a single
+ * GPU submission.
+ * @example
+ * ```ts
+ * const multiResizer = await createMultiResizer([
+ *   detectorOptions, // e.g. 320x320
+ *   classifierOptions, // e.g. 224x224
+ * ])
+ * const [detectorInput, classifierInput] = multiResizer.resize(frame)
+ * ```
+ */
+export function createMultiResizer(
+  options: ResizerOptions[],
+): Promise<MultiResizer> {
+  return factory.createMultiResizer(options)
+}
+
+/**
+ * Compiles the GPU pipelines for the given {@linkcode ResizerOptions}
+ * ahead of time, so that the first {@linkcode Resizer.resize | resize(...)}
+ * call does not stall on shader compilation.
+ * @example
+ * ```ts
+ * // e.g. during app startup
+ * await prewarmResizers([detectorOptions, classifierOptions])
+ * ```
+ */
+export function prewarmResizers(options: ResizerOptions[]): Promise<void> {
+  return factory.prewarm(options)
+}
+
 /**
  * Returns whether the GPU-accelerated Resizer pipeline is available on this device.
  *
@@ -33,18 +67,19 @@ export function createResizer(options: ResizerOptions): Promise<Resizer> {
  * - On Android, this requires the Vulkan GPU framework and `AHardwareBuffer*` extensions,
  * which are only available on Android SDK 28.
  *
+ * If this returns `false`, {@linkcode createResizer} still succeeds, but the
+ * returned {@linkcode Resizer} runs on the CPU instead - with identical
+ * outputs, just slower.
+ *
  * @example
  * ```ts
- * function getResizer(options: ResizerOptions): Resizer | CPUFallbackResizer {
- *   if (isResizerAvailable()) {
- *     // GPU accelerated Resizer pipeline is available!
- *     return createResizer(options)
- *   } else {
- *     // GPU accelerated Resizer pipeline is not available on this device,
- *     // fall back to a CPU implementation.
- *     return ...
- *   }
+ * const options: ResizerOptions = {
+ *   ...
+ *   // The CPU fallback is fast enough for smaller models
+ *   width: isResizerAvailable() ? 640 : 320,
+ *   height: isResizerAvailable() ? 640 : 320,
  * }
+ * const resizer = await createResizer(options)
  * ```
  */
 export function isResizerAvailable(): boolean {
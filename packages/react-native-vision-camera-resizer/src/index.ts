@@ -1,6 +1,11 @@
 export * from './createResizer'
+export * from './specs/FrameStatistics'
 export * from './specs/GPUFrame.nitro'
+export * from './specs/MultiResizer.nitro'
 export * from './specs/OutputFormat'
+export * from './specs/Rect'
+export * from './specs/ResizeTransform'
 export * from './specs/Resizer.nitro'
 export * from './specs/ResizerFactory.nitro'
+export * from './specs/ResizerStatistics'
 export * from './useResizer'
@@ -0,0 +1,39 @@
+import type { Frame } from 'react-native-vision-camera'
+import type { GPUFrame } from './GPUFrame.nitro'
+import type { Resizer } from './Resizer.nitro'
+import type { ResizerOptions } from './ResizerFactory.nitro'
+
+/**
+ * Cheap statistics about the luma (brightness) of a {@linkcode Frame},
+ * computed by the GPU in the same pass that produces the {@linkcode GPUFrame}
+ * when {@linkcode ResizerOptions.enableFrameStatistics} is set.
+ *
+ * They can be used to skip inference on {@linkcode Frame}s where nothing
+ * changed ("motion gating"), or on {@linkcode Frame}s that are too dark,
+ * without reading the {@linkcode GPUFrame}'s pixels on the CPU.
+ *
+ * All values are in luma units from `0` (black) to `255` (white), measured
+ * over the region that was resized (the first region of a batch).
+ */
+export interface FrameStatistics {
+  /**
+   * The average luma of all pixels, from `0` to `255`.
+   */
+  meanLuma: number
+  /**
+   * A coarse 16x16 luma thumbnail, stored row-major
+   * (`thumbnail[y * 16 + x]`) as 256 values from `0` to `255`.
+   *
+   * Each value is the average luma of one cell of a 16x16 grid laid
+   * over the output.
+   */
+  thumbnail: number[]
+  /**
+   * The mean absolute difference between this {@linkcode thumbnail}
+   * and the {@linkcode thumbnail} of the previous {@linkcode Frame} this
+   * {@linkcode Resizer} resized, from `0` (identical) to `255`.
+   *
+   * This is `undefined` for the first {@linkcode Frame}.
+   */
+  motion?: number
+}
@@ -1,7 +1,15 @@
 import type { HybridObject } from 'react-native-nitro-modules'
-import type { Frame } from 'react-native-vision-camera'
-import type { ChannelOrder, DataType, PixelLayout } from './OutputFormat'
+import type { Frame, NativeBuffer } from 'react-native-vision-camera'
+import type { FrameStatistics } from './FrameStatistics'
+import type {
+  ChannelOrder,
+  DataType,
+  OutputBufferType,
+  PixelLayout,
+} from './OutputFormat'
+import type { ResizeTransform } from './ResizeTransform'
 import type { Resizer } from './Resizer.nitro'
+import type { ResizerOptions } from './ResizerFactory.nitro'
 
 /**
  * A {@linkcode GPUFrame} represents a texture on the GPU,
@@ -30,6 +38,17 @@ export interface GPUFrame
    * @note If the {@linkcode GPUFrame} has already been disposed, this returns `0`.
    */
   readonly height: number
+  /**
+   * Represents how many images this {@linkcode GPUFrame} contains.
+   *
+   * This is `1` for {@linkcode Resizer.resize | resize(...)}, and the number
+   * of regions for {@linkcode Resizer.resizeBatch | resizeBatch(...)}.
+   * The images are stored back-to-back in the pixel buffer, corresponding to
+   * an N(H)WC / NCHW tensor with `N = batchSize`.
+   *
+   * @note If the {@linkcode GPUFrame} has already been disposed, this returns `0`.
+   */
+  readonly batchSize: number
   /**
    * Represents the channel ordering of the {@linkcode GPUFrame}.
    *
@@ -51,6 +70,15 @@ export interface GPUFrame
    * @note If the {@linkcode GPUFrame} has already been disposed, this returns `undefined`.
    */
   readonly pixelLayout?: PixelLayout
+  /**
+   * Represents the luma {@linkcode FrameStatistics} of the {@linkcode Frame}
+   * this {@linkcode GPUFrame} was resized from.
+   *
+   * @note This is only set if the {@linkcode Resizer} was created with
+   * {@linkcode ResizerOptions.enableFrameStatistics}, and returns `undefined`
+   * once the {@linkcode GPUFrame} has been disposed.
+   */
+  readonly frameStatistics?: FrameStatistics
   /**
    * Get an `ArrayBuffer` representing the shared memory of this {@linkcode GPUFrame}.
    *
@@ -62,6 +90,68 @@ export interface GPUFrame
    * The returned `ArrayBuffer` is only valid as long as this {@linkcode GPUFrame}
    * is valid - once the {@linkcode GPUFrame} has been {@linkcode dispose | dispose()}'d,
    * the returned `ArrayBuffer` is no longer safe to access and may return "garbage data".
+   *
+   * @throws If the {@linkcode Resizer} was created with an
+   * {@linkcode OutputBufferType} of `'native'` - use
+   * {@linkcode getNativeBuffer | getNativeBuffer()} instead.
    */
   getPixelBuffer(): ArrayBuffer
+  /**
+   * Get the platform-native GPU buffer holding the output of this {@linkcode GPUFrame}.
+   *
+   * On Android, the returned {@linkcode NativeBuffer.pointer | pointer} is an
+   * `AHardwareBuffer*` of format `AHARDWAREBUFFER_FORMAT_BLOB` whose width is the
+   * byte-size of the output tensor, which can be bound directly to a GPU or
+   * NNAPI inference delegate without copying the pixels through the CPU.
+   *
+   * If the {@linkcode Resizer} was created with an {@linkcode OutputBufferType}
+   * of `'texture'`, the returned {@linkcode NativeBuffer.pointer | pointer} is an
+   * image-format buffer instead - an `AHardwareBuffer*` of format
+   * `AHARDWAREBUFFER_FORMAT_R8G8B8A8_UNORM` on Android, or a `CVPixelBufferRef`
+   * of format `kCVPixelFormatType_32BGRA` on iOS - which can be sampled directly
+   * on the GPU via `Skia.Image.MakeImageFromNativeBuffer(...)`.
+   *
+   * @discussion
+   * The returned {@linkcode NativeBuffer} holds its own reference to the underlying
+   * buffer, and must be {@linkcode NativeBuffer.release | release()}'d once it is
+   * no longer used. Until then, the {@linkcode Resizer} will not write into it again.
+   *
+   * @throws If the {@linkcode Resizer} was not created with an
+   * {@linkcode OutputBufferType} of `'native'` or `'texture'`.
+   */
+  getNativeBuffer(): NativeBuffer
+  /**
+   * Get the {@linkcode ResizeTransform} that was applied to produce the
+   * image at {@linkcode batchIndex} of this {@linkcode GPUFrame}.
+   *
+   * @param batchIndex The image of the batch, from `0` to {@linkcode batchSize} - 1. Defaults to `0`.
+   * @throws If the {@linkcode GPUFrame} has already been disposed, or {@linkcode batchIndex} is out of range.
+   */
+  getTransform(batchIndex?: number): ResizeTransform
+  /**
+   * Converts points in this {@linkcode GPUFrame}'s output pixel coordinates
+   * (e.g. the bounding boxes of a detection model) into the {@linkcode Frame}'s
+   * pixel coordinate system, undoing the crop, scale, letterboxing, rotation
+   * and mirroring the {@linkcode Resizer} applied.
+   *
+   * The conversion happens in-place, natively and in a single pass, so
+   * it is much faster than converting every point in JS.
+   *
+   * @param points The `ArrayBuffer` of a `Float32Array` of interleaved
+   * `x, y` pairs, in output pixels. It is overwritten with the converted
+   * `x, y` pairs, in {@linkcode Frame} pixels.
+   * @param batchIndex The image of the batch the points belong to. Defaults to `0`.
+   * @throws If the {@linkcode GPUFrame} has already been disposed, {@linkcode batchIndex}
+   * is out of range, or the size of {@linkcode points} is not a multiple of 8 bytes.
+   *
+   * @example
+   * ```ts
+   * const resized = resizer.resize(frame)
+   * const box = new Float32Array([left, top, right, bottom])
+   * resized.convertOutputPointsToFramePoints(box.buffer)
+   * // `box` is now in Frame coordinates. Rotation and mirroring
+   * // may have swapped left/right or top/bottom.
+   * ```
+   */
+  convertOutputPointsToFramePoints(points: ArrayBuffer, batchIndex?: number): void
 }
@@ -0,0 +1,71 @@
+import type { HybridObject } from 'react-native-nitro-modules'
+import type { Frame } from 'react-native-vision-camera'
+import type { GPUFrame } from './GPUFrame.nitro'
+import type { ResizeOptions, Resizer } from './Resizer.nitro'
+import type {
+  ResizerFactory,
+  ResizerOptions,
+} from './ResizerFactory.nitro'
+import type { ResizerStatistics } from './ResizerStatistics'
+
+/**
+ * Represents a GPU-accelerated {@linkcode Frame} resizer that produces
+ * multiple differently configured outputs from a single {@linkcode Frame}.
+ *
+ * You can create instances of the {@linkcode MultiResizer} via
+ * {@linkcode ResizerFactory.createMultiResizer | ResizerFactory.createMultiResizer(...)}.
+ *
+ * Compared to calling {@linkcode Resizer.resize | resize(...)} on multiple
+ * {@linkcode Resizer}s, the {@linkcode MultiResizer} imports the
+ * {@linkcode Frame} only once, and records every output into a single
+ * GPU submission - so it only waits for the GPU once per {@linkcode Frame}.
+ *
+ * @discussion
+ * Like the {@linkcode Resizer}, the {@linkcode MultiResizer} allocates a
+ * memory pool per output. When you are done with the {@linkcode MultiResizer},
+ * it is recommended to {@linkcode dispose | dispose()} it to free up resources.
+ */
+export interface MultiResizer
+  extends HybridObject<{ ios: 'swift'; android: 'c++' }> {
+  /**
+   * Resize the given {@linkcode frame} once for each {@linkcode ResizerOptions}
+   * this {@linkcode MultiResizer} was configured with.
+   *
+   * The same requirements on the input {@linkcode Frame} as for
+   * {@linkcode Resizer.resize | Resizer.resize(...)} apply.
+   * If {@linkcode ResizeOptions.crop} is set, every output is resized
+   * from that same region.
+   *
+   * @returns One {@linkcode GPUFrame} per {@linkcode ResizerOptions},
+   * in the order the {@linkcode MultiResizer} was created with.
+   * Each returned {@linkcode GPUFrame} must be disposed (via
+   * {@linkcode GPUFrame.dispose | dispose()}) to ensure the pipeline
+   * can run continuously.
+   *
+   * @example
+   * ```ts
+   * const [detectorInput, classifierInput] = multiResizer.resize(frame)
+   * ```
+   */
+  resize(frame: Frame, options?: ResizeOptions): GPUFrame[]
+  /**
+   * Asynchronously resize the given {@linkcode frame} once for each
+   * {@linkcode ResizerOptions} this {@linkcode MultiResizer} was configured with.
+   *
+   * The returned `Promise` resolves once the GPU has finished writing
+   * every {@linkcode GPUFrame}.
+   *
+   * @see {@linkcode Resizer.resizeAsync | Resizer.resizeAsync(...)}
+   */
+  resizeAsync(frame: Frame, options?: ResizeOptions): Promise<GPUFrame[]>
+
+  /**
+   * Returns runtime statistics of this {@linkcode MultiResizer}.
+   *
+   * Since all outputs share one import of the {@linkcode Frame} and one
+   * GPU submission, the statistics cover all outputs together.
+   *
+   * @see {@linkcode Resizer.getStatistics | Resizer.getStatistics()}
+   */
+  getStatistics(): ResizerStatistics
+}
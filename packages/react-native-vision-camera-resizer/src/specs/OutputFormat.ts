@@ -1,9 +1,14 @@
 /**
- * Represents how the three output channels are ordered in memory.
+ * Represents which output channels are written per pixel, and how they are ordered in memory.
  *
  * For example, `'rgb'` stores one pixel as `R, G, B`.
+ *
+ * - `'rgb'`/`'bgr'`: 3 color channels.
+ * - `'gray'`: 1 channel holding the luma (`Y`) of each pixel, e.g. for OCR models.
+ * - `'rgba'`/`'bgra'`/`'argb'`: 3 color channels plus an opaque alpha channel (`1.0`).
+ *   With {@linkcode PixelLayout | 'interleaved'} `uint8`/`int8` outputs, every pixel is exactly 32 bits wide.
  */
-export type ChannelOrder = 'rgb' | 'bgr'
+export type ChannelOrder = 'rgb' | 'bgr' | 'gray' | 'rgba' | 'bgra' | 'argb'
 
 /**
  * Represents how the individual channels per pixel are arranged in memory.
@@ -27,6 +32,30 @@ export type PixelLayout = 'interleaved' | 'planar'
  * Represents the scalar encoding used for each output channel.
  *
  * For example, `'float32'` stores each output value as a 32-bit float
- * in the normalized range from `0.0` to `1.0`.
+ * in the normalized range from `0.0` to `1.0`, unless a `mean` or
+ * `standardDeviation` is configured in the `ResizerOptions`.
  */
 export type DataType = 'int8' | 'uint8' | 'float16' | 'float32'
+
+/**
+ * Represents where the output of a `GPUFrame` is stored.
+ *
+ * - `'cpu'`: The output is stored in host-visible memory and can be read
+ *   directly via `GPUFrame.getPixelBuffer()`.
+ * - `'native'`: The output is stored in a platform-native GPU buffer
+ *   (an `AHardwareBuffer` on Android) that can be handed to another
+ *   GPU-capable consumer such as an NNAPI or GPU delegate via
+ *   `GPUFrame.getNativeBuffer()`, without ever being copied or mapped
+ *   into CPU memory.
+ *   This is currently only supported on Android.
+ * - `'texture'`: The output is stored in host-visible memory like `'cpu'`,
+ *   and is additionally copied on the GPU into an image-format native
+ *   buffer (an `AHardwareBuffer` on Android, a `CVPixelBuffer` on iOS)
+ *   that Skia can sample directly via
+ *   `Skia.Image.MakeImageFromNativeBuffer(...)` with
+ *   `GPUFrame.getNativeBuffer()`.
+ *   Requires a `'uint8'` `'interleaved'` output with the platform's
+ *   native texture channel order (`'rgba'` on Android, `'bgra'` on iOS),
+ *   and a `maxBatchSize` of 1.
+ */
+export type OutputBufferType = 'cpu' | 'native' | 'texture'
@@ -0,0 +1,60 @@
+import type { Frame } from 'react-native-vision-camera'
+import type { Rect } from './Rect'
+
+/**
+ * Describes how one image of a `GPUFrame` was produced from its {@linkcode Frame}.
+ *
+ * The {@linkcode crop} of the {@linkcode Frame} is first rotated by
+ * {@linkcode rotationDegrees} and mirrored if {@linkcode isMirrored} is set,
+ * which results in the upright source image.
+ * The upright source image is then scaled by {@linkcode scaleX} / {@linkcode scaleY}
+ * and placed at {@linkcode offsetX} / {@linkcode offsetY} in the output.
+ *
+ * In other words, a point `(x, y)` in the upright source image (in pixels,
+ * relative to its top-left corner) ends up at
+ * `(x * scaleX + offsetX, y * scaleY + offsetY)` in the output.
+ *
+ * To map points (such as detected bounding boxes) from the output back
+ * into the {@linkcode Frame}, prefer `GPUFrame.convertOutputPointsToFramePoints(...)`.
+ */
+export interface ResizeTransform {
+  /**
+   * The region of the {@linkcode Frame} that was resized, in
+   * the {@linkcode Frame}'s pixel coordinate system, before
+   * any rotation or mirroring is applied.
+   */
+  crop: Rect
+  /**
+   * The clockwise rotation that was applied to the {@linkcode crop},
+   * in degrees. Always one of `0`, `90`, `180` or `270`.
+   */
+  rotationDegrees: number
+  /**
+   * Whether the rotated {@linkcode crop} was mirrored horizontally.
+   */
+  isMirrored: boolean
+  /**
+   * The horizontal scale from upright source pixels to output pixels.
+   */
+  scaleX: number
+  /**
+   * The vertical scale from upright source pixels to output pixels.
+   *
+   * This is equal to {@linkcode scaleX} unless the `scaleMode` is `'stretch'`.
+   */
+  scaleY: number
+  /**
+   * The horizontal position of the upright source's left edge in the output, in output pixels.
+   *
+   * This is positive for `'contain'` (letterboxing), negative for `'cover'`
+   * (cropping), and `0` for `'stretch'`.
+   */
+  offsetX: number
+  /**
+   * The vertical position of the upright source's top edge in the output, in output pixels.
+   *
+   * This is positive for `'contain'` (letterboxing), negative for `'cover'`
+   * (cropping), and `0` for `'stretch'`.
+   */
+  offsetY: number
+}
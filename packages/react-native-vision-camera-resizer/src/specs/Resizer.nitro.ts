@@ -10,7 +10,70 @@ import type {
   VideoPixelFormat,
 } from 'react-native-vision-camera'
 import type { GPUFrame } from './GPUFrame.nitro'
-import type { ResizerFactory } from './ResizerFactory.nitro'
+import type { Rect } from './Rect'
+import type {
+  ResizerFactory,
+  ResizerOptions,
+} from './ResizerFactory.nitro'
+import type { ResizerStatistics } from './ResizerStatistics'
+
+/**
+ * Configures a single {@linkcode Resizer.resize | resize(...)} call.
+ */
+export interface ResizeOptions {
+  /**
+   * Configures a region of the {@linkcode Frame} to resize,
+   * instead of the full {@linkcode Frame}.
+   *
+   * The {@linkcode Rect} is in the {@linkcode Frame}'s pixel coordinate
+   * system (from `0` to {@linkcode Frame.width} and `0` to
+   * {@linkcode Frame.height}), before any rotation or mirroring is applied.
+   * It is clamped to the bounds of the {@linkcode Frame}.
+   *
+   * The crop is then scaled into the output using the
+   * {@linkcode ResizerOptions.scaleMode | scaleMode}, and rotated
+   * and mirrored just like a full {@linkcode Frame}.
+   *
+   * @example
+   * ```ts
+   * // Classify a face detected by a previous model
+   * const resized = resizer.resize(frame, {
+   *   crop: { left: 120, top: 80, right: 360, bottom: 400 },
+   * })
+   * ```
+   */
+  crop?: Rect
+  /**
+   * Configures the output width of this call, instead of the
+   * {@linkcode ResizerOptions.width | width} the {@linkcode Resizer}
+   * was created with.
+   *
+   * Must be an integer between `1` and
+   * {@linkcode ResizerOptions.maxWidth | maxWidth}.
+   *
+   * @note Not supported by a `MultiResizer`, whose outputs all
+   * have fixed sizes.
+   * @example
+   * ```ts
+   * // Shrink the model input under thermal pressure
+   * const resized = resizer.resize(frame, { width: 160, height: 160 })
+   * ```
+   * @default ResizerOptions.width
+   */
+  width?: number
+  /**
+   * Configures the output height of this call, instead of the
+   * {@linkcode ResizerOptions.height | height} the {@linkcode Resizer}
+   * was created with.
+   *
+   * Must be an integer between `1` and
+   * {@linkcode ResizerOptions.maxHeight | maxHeight}.
+   *
+   * @see {@linkcode width}
+   * @default ResizerOptions.height
+   */
+  height?: number
+}
 
 /**
  * Represents a GPU-accelerated {@linkcode Frame} resizer and converter.
@@ -103,6 +166,90 @@ export interface Resizer
    *   { pixelFormat: targetPixelFormat }
    * ]
    * ```
+   * @example
+   * Resize a region of interest
+   * ```ts
+   * const resized = resizer.resize(frame, {
+   *   crop: { left: 120, top: 80, right: 360, bottom: 400 },
+   * })
+   * ```
+   */
+  resize(frame: Frame, options?: ResizeOptions): GPUFrame
+  /**
+   * Resize multiple regions of the given {@linkcode frame} into one
+   * batched {@linkcode GPUFrame}, using a single GPU dispatch.
+   *
+   * Each region is cropped, scaled, rotated and mirrored exactly like
+   * {@linkcode ResizeOptions.crop}, and written as one image of the
+   * returned {@linkcode GPUFrame}, in the order of {@linkcode regions}.
+   * The resulting pixel buffer is a tensor with batch size
+   * {@linkcode GPUFrame.batchSize} (e.g. `[N, H, W, 3]` or `[N, 3, H, W]`).
+   *
+   * @discussion
+   * The {@linkcode Resizer} has to be created with a
+   * {@linkcode ResizerOptions.maxBatchSize | maxBatchSize} of at least
+   * `regions.length`.
+   *
+   * @throws If {@linkcode regions} is empty or contains more than
+   * {@linkcode ResizerOptions.maxBatchSize | maxBatchSize} regions.
+   *
+   * @example
+   * ```ts
+   * // Classify every face detected by a previous model at once
+   * const faces: Rect[] = ...
+   * const resized = resizer.resizeBatch(frame, faces)
+   * const buffer = resized.getPixelBuffer() // [faces.length, H, W, C]
+   * resized.dispose()
+   * ```
+   */
+  resizeBatch(frame: Frame, regions: Rect[]): GPUFrame
+  /**
+   * Asynchronously resize the given {@linkcode frame} using the options
+   * this {@linkcode Resizer} was configured with.
+   *
+   * Unlike {@linkcode resize | resize(...)}, this returns as soon as the
+   * GPU work has been submitted, and the returned `Promise` resolves
+   * once the GPU has finished writing the {@linkcode GPUFrame}.
+   * This allows the next {@linkcode Frame} to be submitted while
+   * the previous {@linkcode GPUFrame} is still in flight or being read.
+   *
+   * @discussion
+   * The {@linkcode Resizer} keeps the {@linkcode frame}'s native buffer alive
+   * until the GPU work has finished, so the {@linkcode frame} may be disposed
+   * right after calling {@linkcode resizeAsync | resizeAsync(...)}.
+   *
+   * To keep multiple {@linkcode GPUFrame}s in flight, configure
+   * {@linkcode ResizerOptions.outputBufferCount} accordingly.
+   *
+   * @example
+   * ```ts
+   * const resizer = ...
+   * const frameOutput = useFrameOutput({
+   *   pixelFormat: 'yuv',
+   *   onFrame(frame) {
+   *     'worklet'
+   *     resizer.resizeAsync(frame).then((resized) => {
+   *       const buffer = resized.getPixelBuffer()
+   *       resized.dispose()
+   *     })
+   *     frame.dispose()
+   *   }
+   * })
+   * ```
+   */
+  resizeAsync(frame: Frame, options?: ResizeOptions): Promise<GPUFrame>
+
+  /**
+   * Returns runtime statistics of this {@linkcode Resizer},
+   * for example to diagnose slow {@linkcode resize | resize(...)} calls.
+   *
+   * @example
+   * ```ts
+   * const { importCache } = resizer.getStatistics()
+   * if (importCache != null && importCache.misses > importCache.hits) {
+   *   console.warn('Input buffers are re-imported on almost every Frame!')
+   * }
+   * ```
    */
-  resize(frame: Frame): GPUFrame
+  getStatistics(): ResizerStatistics
 }
@@ -1,7 +1,16 @@
 import type { HybridObject } from 'react-native-nitro-modules'
 import type { Frame } from 'react-native-vision-camera'
-import type { ChannelOrder, DataType, PixelLayout } from './OutputFormat'
+import type { FrameStatistics } from './FrameStatistics'
+import type { GPUFrame } from './GPUFrame.nitro'
+import type {
+  ChannelOrder,
+  DataType,
+  OutputBufferType,
+  PixelLayout,
+} from './OutputFormat'
+import type { MultiResizer } from './MultiResizer.nitro'
 import type { Resizer } from './Resizer.nitro'
+import type { ResizerStatistics } from './ResizerStatistics'
 
 /**
  * The mode tells the GPU resize pipeline how to map
@@ -19,6 +28,20 @@ import type { Resizer } from './Resizer.nitro'
  */
 export type ScaleMode = 'cover' | 'contain' | 'stretch'
 
+/**
+ * The filter the GPU resize pipeline uses to compute each
+ * output pixel from the input pixels it covers.
+ *
+ * - `'bilinear'`: Take one bilinear sample per output pixel.
+ *   This is the fastest, but aliases when downscaling by more
+ *   than ~2x, since most input pixels are skipped.
+ * - `'area'`: Average several bilinear samples spread evenly over the
+ *   input area each output pixel covers (box filter).
+ *   This stays accurate for large downscales (e.g. 4K to 224x224),
+ *   and is equivalent to `'bilinear'` when upscaling.
+ */
+export type ResizeFilter = 'bilinear' | 'area'
+
 /**
  * Configures options for a {@linkcode Resizer}.
  */
@@ -63,6 +86,169 @@ export interface ResizerOptions {
    * @see {@linkcode PixelLayout}
    */
   pixelLayout: PixelLayout
+  /**
+   * Configures how many output buffers the {@linkcode Resizer}
+   * keeps in its ring.
+   *
+   * Every {@linkcode GPUFrame} that is still alive (or still being
+   * processed on the GPU via {@linkcode Resizer.resizeAsync | resizeAsync(...)})
+   * holds one output buffer.
+   * With more than one output buffer, the next {@linkcode Frame} can
+   * already be resized while the previous {@linkcode GPUFrame} is still
+   * being read.
+   *
+   * Each output buffer costs one full output tensor of memory.
+   *
+   * @default 1
+   */
+  outputBufferCount?: number
+  /**
+   * Configures the maximum number of regions a single
+   * {@linkcode Resizer.resizeBatch | resizeBatch(...)} call can resize.
+   *
+   * Each output buffer is sized to hold {@linkcode maxBatchSize} output
+   * tensors, so this multiplies the memory cost of every output buffer.
+   * Must be between `1` and `64`.
+   *
+   * @default 1
+   */
+  maxBatchSize?: number
+  /**
+   * Configures a per-channel mean that will be subtracted
+   * from each output value on the GPU, as in `(x - mean) / standardDeviation`.
+   *
+   * Values are in the normalized range from `0.0` to `1.0` and are
+   * specified in the output {@linkcode ChannelOrder}.
+   * Pass a single value to apply it to every channel.
+   *
+   * @example
+   * ```ts
+   * // ImageNet
+   * mean: [0.485, 0.456, 0.406]
+   * ```
+   * @discussion When using {@linkcode useResizer}, keep a stable
+   * reference to this array (e.g. a module-level constant) to avoid
+   * re-creating the {@linkcode Resizer} on every render.
+   * @default [0]
+   */
+  mean?: number[]
+  /**
+   * Configures a per-channel standard deviation each output value
+   * will be divided by on the GPU, as in `(x - mean) / standardDeviation`.
+   *
+   * Values are in the normalized range from `0.0` to `1.0` and are
+   * specified in the output {@linkcode ChannelOrder}.
+   * Pass a single value to apply it to every channel.
+   *
+   * @example
+   * ```ts
+   * // ImageNet
+   * standardDeviation: [0.229, 0.224, 0.225]
+   * ```
+   * @default [1]
+   */
+  standardDeviation?: number[]
+  /**
+   * Configures the quantization scale for {@linkcode DataType | 'int8'}
+   * and {@linkcode DataType | 'uint8'} outputs, matching the input
+   * tensor's quantization parameters of a quantized model.
+   *
+   * Each (normalized) value is written as
+   * `round(value / quantizationScale) + quantizationZeroPoint`,
+   * clamped to the range of the {@linkcode DataType}.
+   *
+   * Must not be set for float outputs.
+   *
+   * @default 1 / 255
+   */
+  quantizationScale?: number
+  /**
+   * Configures the quantization zero-point for {@linkcode DataType | 'int8'}
+   * and {@linkcode DataType | 'uint8'} outputs.
+   *
+   * @see {@linkcode quantizationScale}
+   * @default 0 for 'uint8', -128 for 'int8'
+   */
+  quantizationZeroPoint?: number
+  /**
+   * Configures where the output of each {@linkcode GPUFrame} is stored.
+   *
+   * Use {@linkcode OutputBufferType | 'native'} to keep the output in a
+   * GPU buffer and pass it to a GPU/NPU inference delegate via
+   * {@linkcode GPUFrame.getNativeBuffer | getNativeBuffer()}, which avoids
+   * the CPU round-trip of {@linkcode GPUFrame.getPixelBuffer | getPixelBuffer()}.
+   *
+   * Use {@linkcode OutputBufferType | 'texture'} to draw the output with Skia
+   * (e.g. a segmentation mask), by passing
+   * {@linkcode GPUFrame.getNativeBuffer | getNativeBuffer()} to
+   * `Skia.Image.MakeImageFromNativeBuffer(...)` without uploading the pixels
+   * from the CPU again.
+   *
+   * @note {@linkcode OutputBufferType | 'native'} is currently only supported on Android.
+   * @default 'cpu'
+   */
+  outputBufferType?: OutputBufferType
+  /**
+   * Enables measuring how long each stage of a resize takes, on the CPU
+   * and on the GPU.
+   *
+   * The timings are reported in {@linkcode ResizerStatistics.timings}, and
+   * are also emitted as trace sections while a Perfetto (or systrace) trace
+   * is being recorded.
+   *
+   * Profiling adds a small overhead to every resize, so only enable it
+   * while investigating performance.
+   *
+   * @note Profiling is currently only supported on Android.
+   * @default false
+   */
+  enableProfiling?: boolean
+  /**
+   * Enables computing {@linkcode FrameStatistics} (mean luma, a coarse
+   * 16x16 luma thumbnail and the motion since the previous {@linkcode Frame})
+   * in the same GPU pass as the resize.
+   *
+   * The result is available as {@linkcode GPUFrame.frameStatistics}, and can
+   * be used to skip inference on {@linkcode Frame}s where nothing changed.
+   *
+   * @default false
+   */
+  enableFrameStatistics?: boolean
+  /**
+   * Configures the {@linkcode ResizeFilter} used to compute each
+   * output pixel.
+   *
+   * Use {@linkcode ResizeFilter | 'area'} when the input is much larger
+   * than the output, to avoid aliasing.
+   *
+   * @default 'bilinear'
+   */
+  filter?: ResizeFilter
+  /**
+   * Configures the largest width a single
+   * {@linkcode Resizer.resize | resize(frame, { width })} call may request,
+   * for models with dynamic input shapes or when adapting the output
+   * resolution at runtime.
+   *
+   * The output buffers are allocated for {@linkcode width} first, and only
+   * grow once a larger size is requested - without re-creating
+   * the {@linkcode Resizer}.
+   *
+   * Must be greater than or equal to {@linkcode width}.
+   *
+   * @default width
+   */
+  maxWidth?: number
+  /**
+   * Configures the largest height a single
+   * {@linkcode Resizer.resize | resize(frame, { height })} call may request.
+   *
+   * Must be greater than or equal to {@linkcode height}.
+   *
+   * @see {@linkcode maxWidth}
+   * @default height
+   */
+  maxHeight?: number
 }
 
 /**
@@ -89,6 +275,9 @@ export interface ResizerFactory
    * - On iOS, this requires the Metal GPU framework, which is always available.
    * - On Android, this requires the Vulkan GPU framework and `AHardwareBuffer*`
    * extensions, which are only available on newer Android versions.
+   *
+   * If this returns `false`, {@linkcode createResizer} falls back to a
+   * (slower) CPU implementation that produces identical outputs.
    */
   isAvailable(): boolean
 
@@ -96,4 +285,28 @@ export interface ResizerFactory
    * Creates a new {@linkcode Resizer} with the given {@linkcode ResizerOptions}.
    */
   createResizer(options: ResizerOptions): Promise<Resizer>
+
+  /**
+   * Creates a new {@linkcode MultiResizer} that resizes each {@linkcode Frame}
+   * into one output per given {@linkcode ResizerOptions}, using a single
+   * import of the {@linkcode Frame} and a single GPU submission.
+   *
+   * @throws If {@linkcode options} is empty.
+   */
+  createMultiResizer(options: ResizerOptions[]): Promise<MultiResizer>
+
+  /**
+   * Compiles the GPU pipelines for each of the given {@linkcode ResizerOptions}
+   * ahead of time, so that the first {@linkcode Resizer.resize | resize(...)} call
+   * does not stall on shader compilation.
+   *
+   * Compiled pipelines are persisted in the app's cache directory and
+   * reused across app launches.
+   *
+   * - On Android, pipelines also depend on the Camera's input format, which
+   *   is only known after the first {@linkcode Frame} has been resized.
+   *   Prewarming therefore builds pipelines for every input format seen on
+   *   previous app launches.
+   */
+  prewarm(options: ResizerOptions[]): Promise<void>
 }
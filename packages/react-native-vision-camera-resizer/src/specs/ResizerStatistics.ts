@@ -0,0 +1,129 @@
+import type { Frame } from 'react-native-vision-camera'
+import type { Resizer } from './Resizer.nitro'
+import type { ResizerOptions } from './ResizerFactory.nitro'
+
+/**
+ * Statistics of the cache that keeps input buffers imported into Vulkan
+ * across {@linkcode Frame}s.
+ *
+ * Cameras recycle a small pool of buffers, so in a steady stream every
+ * {@linkcode Frame} should be a cache hit. Frequent misses or evictions mean
+ * that more buffers are in flight than the cache can hold (e.g. several
+ * Camera streams feeding one {@linkcode Resizer}), and each miss costs a full
+ * Vulkan import.
+ *
+ * All counters are cumulative since the {@linkcode Resizer} was created.
+ */
+export interface ImportCacheStatistics {
+  /**
+   * The number of resizes whose input buffer was already imported.
+   */
+  hits: number
+  /**
+   * The number of resizes that had to import their input buffer.
+   */
+  misses: number
+  /**
+   * The number of imported input buffers that were evicted from the cache
+   * to make room for another one.
+   */
+  evictions: number
+  /**
+   * The number of input buffers that are currently imported.
+   */
+  size: number
+  /**
+   * The current capacity of the cache.
+   *
+   * The capacity adapts to the number of buffers the Camera cycles through.
+   */
+  capacity: number
+}
+
+/**
+ * Rolling percentiles of how long one stage of a resize took, over the
+ * most recent resizes.
+ *
+ * All durations are in milliseconds.
+ */
+export interface StageTimingStatistics {
+  /**
+   * The number of resizes the percentiles are computed from.
+   */
+  sampleCount: number
+  /**
+   * The median duration of this stage.
+   */
+  p50: number
+  /**
+   * The 95th percentile duration of this stage.
+   */
+  p95: number
+  /**
+   * The 99th percentile duration of this stage.
+   */
+  p99: number
+}
+
+/**
+ * Per-stage timings of a {@linkcode Resizer}, to attribute where the
+ * latency of a resize comes from.
+ *
+ * CPU stages are measured on the calling thread, GPU stages are measured
+ * with GPU timestamps.
+ */
+export interface ResizerTimingStatistics {
+  /**
+   * Reading the format of the input buffer.
+   */
+  queryProperties: StageTimingStatistics
+  /**
+   * Importing the input buffer into Vulkan, or finding it in the import cache.
+   */
+  importImage: StageTimingStatistics
+  /**
+   * Updating descriptors and recording the GPU commands.
+   */
+  record: StageTimingStatistics
+  /**
+   * Submitting the GPU commands to the queue.
+   */
+  submit: StageTimingStatistics
+  /**
+   * Blocking until the GPU has finished.
+   */
+  wait: StageTimingStatistics
+  /**
+   * Clearing the output buffer on the GPU.
+   *
+   * Only some output formats need to be cleared, and only GPUs that support
+   * timestamps on the compute queue report this.
+   */
+  gpuFill?: StageTimingStatistics
+  /**
+   * Running the resize compute shader on the GPU.
+   *
+   * Only GPUs that support timestamps on the compute queue report this.
+   */
+  gpuDispatch?: StageTimingStatistics
+}
+
+/**
+ * Runtime statistics of a {@linkcode Resizer}.
+ */
+export interface ResizerStatistics {
+  /**
+   * Statistics of the input buffer import cache.
+   *
+   * Only available on Android when the {@linkcode Resizer} runs on Vulkan,
+   * on iOS Metal textures are cached by CoreVideo internally.
+   */
+  importCache?: ImportCacheStatistics
+  /**
+   * Per-stage timings of the most recent resizes.
+   *
+   * Only available on Android when the {@linkcode Resizer} runs on Vulkan
+   * and was created with {@linkcode ResizerOptions.enableProfiling}.
+   */
+  timings?: ResizerTimingStatistics
+}
@@ -59,6 +59,18 @@ export function useResizer({
   dataType,
   scaleMode,
   pixelLayout,
+  outputBufferCount,
+  maxBatchSize,
+  mean,
+  standardDeviation,
+  quantizationScale,
+  quantizationZeroPoint,
+  outputBufferType,
+  enableProfiling,
+  enableFrameStatistics,
+  filter,
+  maxWidth,
+  maxHeight,
 }: ResizerOptions): ResizerState {
   const [state, setState] = useState<ResizerState>({
     state: 'loading',
@@ -77,6 +89,18 @@ export function useResizer({
           dataType: dataType,
           scaleMode: scaleMode,
           pixelLayout: pixelLayout,
+          outputBufferCount: outputBufferCount,
+          maxBatchSize: maxBatchSize,
+          mean: mean,
+          standardDeviation: standardDeviation,
+          quantizationScale: quantizationScale,
+          quantizationZeroPoint: quantizationZeroPoint,
+          outputBufferType: outputBufferType,
+          enableProfiling: enableProfiling,
+          enableFrameStatistics: enableFrameStatistics,
+          filter: filter,
+          maxWidth: maxWidth,
+          maxHeight: maxHeight,
         })
         if (isCanceled) return
         setState({ state: 'ready', resizer: resizer, error: undefined })
@@ -88,7 +112,26 @@ export function useResizer({
     return () => {
       isCanceled = true
     }
-  }, [channelOrder, dataType, height, pixelLayout, scaleMode, width])
+  }, [
+    channelOrder,
+    dataType,
+    enableFrameStatistics,
+    enableProfiling,
+    filter,
+    height,
+    maxBatchSize,
+    maxHeight,
+    maxWidth,
+    mean,
+    outputBufferCount,
+    outputBufferType,
+    pixelLayout,
+    quantizationScale,
+    quantizationZeroPoint,
+    scaleMode,
+    standardDeviation,
+    width,
+  ])
 
   return state
 }
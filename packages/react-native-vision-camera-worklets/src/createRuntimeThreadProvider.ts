@@ -1,5 +1,9 @@
 import type { RuntimeThreadProvider } from 'react-native-vision-camera'
-import { scheduleOnRuntime, scheduleOnUI } from 'react-native-worklets'
+import {
+  scheduleOnRN,
+  scheduleOnRuntime,
+  scheduleOnUI,
+} from 'react-native-worklets'
 import { createAsyncRunner } from './createAsyncRunner'
 import { createWorkletRuntimeForThread } from './createWorkletRuntimeForThread'
 
@@ -45,13 +49,16 @@ export function createRuntimeThreadProvider(): RuntimeThreadProvider {
             }
           })
         },
-        setOnFrameCallback(frameOutput, onFrame) {
+        setOnFrameCallback(frameOutput, onFrame, onResult) {
           scheduleOnRuntime(runtime, () => {
             'worklet'
             if (onFrame != null) {
               frameOutput.setOnFrameCallback((frame) => {
+                // The Frame might be disposed by `onFrame`, so read its timestamp upfront.
+                const timestamp = onResult != null ? frame.timestamp : 0
+                let result: unknown
                 try {
-                  onFrame(frame)
+                  result = onFrame(frame)
                 } catch (e) {
                   const message =
                     typeof e === 'object' && e != null && 'message' in e
@@ -59,6 +66,10 @@ export function createRuntimeThreadProvider(): RuntimeThreadProvider {
                       : `${e}`
                   console.error(message, e)
                 }
+                if (onResult != null) {
+                  // Always report a result, otherwise later results would be held back.
+                  scheduleOnRN(onResult, timestamp, result)
+                }
                 return true
               })
             } else {
@@ -0,0 +1,300 @@
+///
+/// FrameBufferArena.cpp
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#include "FrameBufferArena.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+namespace margelo::nitro::camera {
+
+namespace {
+
+  // Blocks are aligned to a cache line, which also satisfies SIMD loads and stores.
+  constexpr size_t kAlignment = 64;
+  // The smallest size class is one page, and each following power of two is split into quarters.
+  constexpr size_t kMinSizeClassShift = 12;
+  constexpr size_t kStepsPerPowerOfTwo = 4;
+  constexpr uint32_t kBlockMagic = 0x56434142; // "VCAB"
+  // Retained blocks are trimmed to the peak demand of this window, checked whenever a block is released.
+  constexpr std::chrono::steady_clock::duration kTrimInterval = std::chrono::seconds(2);
+  // A magazine only holds a few blocks per thread, since Frames are large.
+  constexpr size_t kMagazineCapacity = 4;
+  constexpr size_t kMaxMagazineBytes = 32 * 1024 * 1024;
+
+  template <typename T>
+  void updateMaximum(std::atomic<T>& maximum, T value) noexcept {
+    T current = maximum.load(std::memory_order_relaxed);
+    while (value > current && !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+  }
+
+} // namespace
+
+struct FrameBufferArena::Block {
+  uint32_t magic;
+  uint32_t classIndex;
+  std::atomic<bool> isAcquired;
+
+  [[nodiscard]] uint8_t* data() noexcept {
+    return reinterpret_cast<uint8_t*>(this) + kAlignment;
+  }
+  [[nodiscard]] static Block* fromData(uint8_t* data) noexcept {
+    return reinterpret_cast<Block*>(data - kAlignment);
+  }
+};
+
+struct FrameBufferArena::Magazine {
+  // Only contended while another thread trims or clears the arena.
+  std::mutex mutex;
+  std::vector<Block*> blocks;
+  size_t bytes{0};
+  // Threads that only release blocks (e.g. the JS Thread disposing Frames) would strand them in their magazine.
+  bool hasAcquired{false};
+  // Threads that stopped acquiring (e.g. of a stopped Frame Output) return their blocks to the depot on the next trim.
+  bool hasAcquiredSinceTrim{false};
+
+  Magazine() {
+    FrameBufferArena& arena = FrameBufferArena::shared();
+    std::unique_lock lock(arena._magazinesMutex);
+    arena._magazines.push_back(this);
+  }
+
+  ~Magazine() {
+    FrameBufferArena& arena = FrameBufferArena::shared();
+    {
+      std::unique_lock lock(arena._magazinesMutex);
+      arena._magazines.erase(std::find(arena._magazines.begin(), arena._magazines.end(), this));
+    }
+    // The thread exits, so its blocks go back to the shared depot for other threads.
+    std::unique_lock lock(mutex);
+    arena.flushMagazineLocked(*this);
+  }
+};
+
+FrameBufferArena& FrameBufferArena::shared() {
+  // Intentionally leaked, so magazines of exiting threads can still return their blocks during shutdown.
+  static FrameBufferArena* arena = new FrameBufferArena();
+  return *arena;
+}
+
+FrameBufferArena::Magazine& FrameBufferArena::getMagazine() {
+  thread_local Magazine magazine;
+  return magazine;
+}
+
+size_t FrameBufferArena::getSizeClassIndex(size_t size) noexcept {
+  constexpr size_t minSize = size_t{1} << kMinSizeClassShift;
+  if (size <= minSize) {
+    return 0;
+  }
+  // `size` lies in (2^shift, 2^(shift + 1)], which is split into `kStepsPerPowerOfTwo` steps.
+  const size_t shift = 63 - static_cast<size_t>(__builtin_clzll(static_cast<unsigned long long>(size - 1)));
+  const size_t powerOfTwo = size_t{1} << shift;
+  const size_t step = powerOfTwo / kStepsPerPowerOfTwo;
+  const size_t stepIndex = (size - powerOfTwo + step - 1) / step;
+  return (shift - kMinSizeClassShift) * kStepsPerPowerOfTwo + stepIndex;
+}
+
+size_t FrameBufferArena::getSizeClassSize(size_t index) noexcept {
+  if (index == 0) {
+    return size_t{1} << kMinSizeClassShift;
+  }
+  const size_t shift = kMinSizeClassShift + (index - 1) / kStepsPerPowerOfTwo;
+  const size_t stepIndex = (index - 1) % kStepsPerPowerOfTwo + 1;
+  const size_t powerOfTwo = size_t{1} << shift;
+  return powerOfTwo + stepIndex * (powerOfTwo / kStepsPerPowerOfTwo);
+}
+
+uint8_t* FrameBufferArena::acquire(size_t size) {
+  static_assert(sizeof(Block) <= kAlignment, "The Block header must fit into its alignment padding!");
+  const size_t classIndex = getSizeClassIndex(size);
+  if (classIndex >= kSizeClassCount) [[unlikely]] {
+    throw std::runtime_error("Cannot acquire a Frame buffer of " + std::to_string(size) + " bytes - it is larger than the largest size class!");
+  }
+  const size_t classSize = getSizeClassSize(classIndex);
+
+  Block* block = nullptr;
+  Magazine& magazine = getMagazine();
+  {
+    std::unique_lock lock(magazine.mutex);
+    magazine.hasAcquired = true;
+    magazine.hasAcquiredSinceTrim = true;
+    const auto cached = std::find_if(magazine.blocks.begin(), magazine.blocks.end(),
+                                     [=](const Block* candidate) { return candidate->classIndex == classIndex; });
+    if (cached != magazine.blocks.end()) {
+      block = *cached;
+      magazine.blocks.erase(cached);
+      magazine.bytes -= classSize;
+    } else {
+      // This thread now needs a different size (e.g. after a format change), so its cached blocks go back to the depot
+      // where they can be trimmed.
+      flushMagazineLocked(magazine);
+    }
+  }
+  if (block == nullptr) {
+    block = takeFromDepot(classIndex);
+  }
+
+  if (block != nullptr) {
+    _hits.fetch_add(1, std::memory_order_relaxed);
+    _bytesRetained.fetch_sub(classSize, std::memory_order_relaxed);
+  } else {
+    void* memory = nullptr;
+    if (posix_memalign(&memory, kAlignment, kAlignment + classSize) != 0) [[unlikely]] {
+      throw std::runtime_error("Failed to allocate a Frame buffer of " + std::to_string(classSize) + " bytes!");
+    }
+    // Not zero-filled - callers always overwrite the whole block.
+    block = new (memory) Block{.magic = kBlockMagic, .classIndex = static_cast<uint32_t>(classIndex), .isAcquired = false};
+    _misses.fetch_add(1, std::memory_order_relaxed);
+  }
+  block->isAcquired.store(true, std::memory_order_relaxed);
+
+  SizeClass& sizeClass = _classes[classIndex];
+  updateMaximum<size_t>(sizeClass.peakInUse, sizeClass.inUse.fetch_add(1, std::memory_order_relaxed) + 1);
+  updateMaximum<uint64_t>(_peakBytesInUse, _bytesInUse.fetch_add(classSize, std::memory_order_relaxed) + classSize);
+  return block->data();
+}
+
+void FrameBufferArena::release(uint8_t* data) {
+  if (data == nullptr) [[unlikely]] {
+    throw std::runtime_error("Cannot release a null Frame buffer!");
+  }
+  Block* block = Block::fromData(data);
+  if (block->magic != kBlockMagic) [[unlikely]] {
+    throw std::runtime_error("Cannot release a Frame buffer that was not acquired from the FrameBufferArena!");
+  }
+  if (!block->isAcquired.exchange(false, std::memory_order_relaxed)) [[unlikely]] {
+    throw std::runtime_error("Cannot release a Frame buffer twice!");
+  }
+  const size_t classSize = getSizeClassSize(block->classIndex);
+  _classes[block->classIndex].inUse.fetch_sub(1, std::memory_order_relaxed);
+  _bytesInUse.fetch_sub(classSize, std::memory_order_relaxed);
+  _bytesRetained.fetch_add(classSize, std::memory_order_relaxed);
+
+  Magazine& magazine = getMagazine();
+  bool isCached = false;
+  {
+    std::unique_lock lock(magazine.mutex);
+    if (magazine.hasAcquired && magazine.blocks.size() < kMagazineCapacity && magazine.bytes + classSize <= kMaxMagazineBytes) {
+      magazine.blocks.push_back(block);
+      magazine.bytes += classSize;
+      isCached = true;
+    }
+  }
+  if (!isCached) {
+    returnToDepot(block);
+  }
+  trimIfDue();
+}
+
+FrameBufferArena::Block* FrameBufferArena::takeFromDepot(size_t classIndex) {
+  std::unique_lock lock(_mutex);
+  std::vector<Block*>& blocks = _classes[classIndex].blocks;
+  if (blocks.empty()) {
+    return nullptr;
+  }
+  Block* block = blocks.back();
+  blocks.pop_back();
+  return block;
+}
+
+void FrameBufferArena::flushMagazineLocked(Magazine& magazine) {
+  if (magazine.blocks.empty()) {
+    return;
+  }
+  std::unique_lock lock(_mutex);
+  for (Block* block : magazine.blocks) {
+    _classes[block->classIndex].blocks.push_back(block);
+  }
+  magazine.blocks.clear();
+  magazine.bytes = 0;
+}
+
+void FrameBufferArena::returnToDepot(Block* block) {
+  std::unique_lock lock(_mutex);
+  _classes[block->classIndex].blocks.push_back(block);
+}
+
+void FrameBufferArena::trimIfDue() {
+  const int64_t now = std::chrono::steady_clock::now().time_since_epoch().count();
+  int64_t nextTrimTime = _nextTrimTime.load(std::memory_order_relaxed);
+  if (now < nextTrimTime) {
+    return;
+  }
+  // Only the thread that moves the deadline trims, everyone else continues right away.
+  if (!_nextTrimTime.compare_exchange_strong(nextTrimTime, now + kTrimInterval.count(), std::memory_order_relaxed)) {
+    return;
+  }
+  trim();
+}
+
+void FrameBufferArena::trim() {
+  {
+    std::unique_lock registryLock(_magazinesMutex);
+    for (Magazine* magazine : _magazines) {
+      std::unique_lock magazineLock(magazine->mutex);
+      if (!magazine->hasAcquiredSinceTrim) {
+        flushMagazineLocked(*magazine);
+      }
+      magazine->hasAcquiredSinceTrim = false;
+    }
+  }
+
+  std::unique_lock lock(_mutex);
+  for (SizeClass& sizeClass : _classes) {
+    // Keep enough blocks to serve the peak demand of this window again, and start a new window.
+    const size_t inUse = sizeClass.inUse.load(std::memory_order_relaxed);
+    const size_t peakInUse = sizeClass.peakInUse.exchange(inUse, std::memory_order_relaxed);
+    const size_t keep = peakInUse > inUse ? peakInUse - inUse : 0;
+    while (sizeClass.blocks.size() > keep) {
+      freeBlock(sizeClass.blocks.back());
+      sizeClass.blocks.pop_back();
+    }
+  }
+}
+
+void FrameBufferArena::clear() {
+  {
+    std::unique_lock registryLock(_magazinesMutex);
+    for (Magazine* magazine : _magazines) {
+      std::unique_lock magazineLock(magazine->mutex);
+      for (Block* block : magazine->blocks) {
+        freeBlock(block);
+      }
+      magazine->blocks.clear();
+      magazine->bytes = 0;
+    }
+  }
+
+  std::unique_lock lock(_mutex);
+  for (SizeClass& sizeClass : _classes) {
+    for (Block* block : sizeClass.blocks) {
+      freeBlock(block);
+    }
+    sizeClass.blocks.clear();
+  }
+}
+
+void FrameBufferArena::freeBlock(Block* block) noexcept {
+  _bytesRetained.fetch_sub(getSizeClassSize(block->classIndex), std::memory_order_relaxed);
+  block->~Block();
+  std::free(block);
+}
+
+FrameBufferArenaStats FrameBufferArena::getStats() const noexcept {
+  return FrameBufferArenaStats{
+      .hits = _hits.load(std::memory_order_relaxed),
+      .misses = _misses.load(std::memory_order_relaxed),
+      .bytesInUse = _bytesInUse.load(std::memory_order_relaxed),
+      .bytesRetained = _bytesRetained.load(std::memory_order_relaxed),
+      .peakBytesInUse = _peakBytesInUse.load(std::memory_order_relaxed),
+  };
+}
+
+} // namespace margelo::nitro::camera
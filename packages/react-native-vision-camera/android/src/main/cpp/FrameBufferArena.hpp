@@ -0,0 +1,125 @@
+///
+/// FrameBufferArena.hpp
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace margelo::nitro::camera {
+
+/**
+ * Counters of a `FrameBufferArena`, all in bytes except for `hits` and `misses`.
+ */
+struct FrameBufferArenaStats {
+  /**
+   * How many `acquire()` calls were served from a retained block.
+   */
+  uint64_t hits;
+  /**
+   * How many `acquire()` calls had to allocate a new block.
+   */
+  uint64_t misses;
+  /**
+   * The size of all blocks that are currently acquired.
+   */
+  uint64_t bytesInUse;
+  /**
+   * The size of all blocks that are currently retained for reuse.
+   */
+  uint64_t bytesRetained;
+  /**
+   * The highest `bytesInUse` ever observed.
+   */
+  uint64_t peakBytesInUse;
+};
+
+/**
+ * A process-wide arena of uninitialized memory blocks for CPU copies of Frames.
+ *
+ * Requests are rounded up to size classes spaced a quarter of a power of two apart (4 KiB, 5 KiB, 6 KiB, 7 KiB, 8 KiB,
+ * 10 KiB, ...), so a block wastes at most 25% and Frames of similar sizes (e.g. a video and a depth stream) share
+ * blocks, instead of each distinct size needing its own.
+ *
+ * Each thread keeps a small magazine of released blocks that it can reuse without contention. Everything else goes to
+ * a shared depot, which is trimmed every few seconds: for each size class, it only keeps as many blocks as were
+ * acquired at the same time at peak since the last trim, so memory from a previous resolution is freed shortly after a
+ * format change. Magazines of threads that stopped acquiring are returned to the depot before it is trimmed.
+ */
+class FrameBufferArena final {
+public:
+  static FrameBufferArena& shared();
+
+  FrameBufferArena(const FrameBufferArena&) = delete;
+  FrameBufferArena& operator=(const FrameBufferArena&) = delete;
+
+  /**
+   * Acquires a block of at least `size` bytes. Its contents are uninitialized.
+   * @throws std::runtime_error if `size` is larger than the largest size class, or if the allocation fails.
+   */
+  [[nodiscard]] uint8_t* acquire(size_t size);
+  /**
+   * Returns a block previously returned by `acquire(...)` to the arena.
+   * @throws std::runtime_error if `data` was not acquired from this arena, or was already released.
+   */
+  void release(uint8_t* data);
+  /**
+   * Frees retained blocks that exceed each size class's demand since the last trim.
+   * This also runs automatically every few seconds while blocks are released.
+   */
+  void trim();
+  /**
+   * Frees all blocks retained by the shared depot and by the magazines of all threads.
+   * Blocks that are still acquired are not affected.
+   */
+  void clear();
+  [[nodiscard]] FrameBufferArenaStats getStats() const noexcept;
+
+private:
+  FrameBufferArena() = default;
+
+  struct Block;
+  struct Magazine;
+  struct SizeClass {
+    // Guarded by `_mutex`.
+    std::vector<Block*> blocks;
+    // Updated without the lock, since magazines bypass it.
+    std::atomic<size_t> inUse{0};
+    std::atomic<size_t> peakInUse{0};
+  };
+
+  static constexpr size_t kSizeClassCount = 73;
+  [[nodiscard]] static size_t getSizeClassIndex(size_t size) noexcept;
+  [[nodiscard]] static size_t getSizeClassSize(size_t index) noexcept;
+  static Magazine& getMagazine();
+
+  [[nodiscard]] Block* takeFromDepot(size_t classIndex);
+  void flushMagazineLocked(Magazine& magazine);
+  void returnToDepot(Block* block);
+  void trimIfDue();
+  void freeBlock(Block* block) noexcept;
+
+private:
+  // Lock order: `_magazinesMutex`, then a `Magazine`'s mutex, then `_mutex`.
+  std::mutex _mutex;
+  std::array<SizeClass, kSizeClassCount> _classes{};
+  std::mutex _magazinesMutex;
+  // Guarded by `_magazinesMutex`. The magazines of all threads that ever used this arena and are still alive.
+  std::vector<Magazine*> _magazines;
+  // In `std::chrono::steady_clock` ticks.
+  std::atomic<int64_t> _nextTrimTime{0};
+
+  std::atomic<uint64_t> _hits{0};
+  std::atomic<uint64_t> _misses{0};
+  std::atomic<uint64_t> _bytesInUse{0};
+  std::atomic<uint64_t> _bytesRetained{0};
+  std::atomic<uint64_t> _peakBytesInUse{0};
+};
+
+} // namespace margelo::nitro::camera
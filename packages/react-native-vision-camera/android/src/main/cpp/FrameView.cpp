@@ -0,0 +1,134 @@
+///
+/// FrameView.cpp
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#include "FrameView.hpp"
+#include "HybridFramePlaneSpec.hpp"
+#include <cmath>
+#include <dlfcn.h>
+#include <stdexcept>
+
+namespace margelo::nitro::camera {
+
+namespace {
+
+  // `AHardwareBuffer_lockPlanes` is only available on API 29+, but VisionCamera supports older versions, so it is resolved at runtime.
+  using LockPlanesFunction = int (*)(AHardwareBuffer*, uint64_t, int32_t, const ARect*, AHardwareBuffer_Planes*);
+
+  LockPlanesFunction getLockPlanesFunction() {
+    static const LockPlanesFunction lockPlanes = reinterpret_cast<LockPlanesFunction>(dlsym(RTLD_DEFAULT, "AHardwareBuffer_lockPlanes"));
+    return lockPlanes;
+  }
+
+  bool isYuv420(PixelFormat pixelFormat) {
+    switch (pixelFormat) {
+      case PixelFormat::YUV_420_8_BIT_VIDEO:
+      case PixelFormat::YUV_420_8_BIT_FULL:
+      case PixelFormat::YUV_420_10_BIT_VIDEO:
+      case PixelFormat::YUV_420_10_BIT_FULL:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+} // namespace
+
+FrameView::FrameView(const std::shared_ptr<HybridFrameSpec>& frame) {
+  if (frame == nullptr || !frame->getIsValid()) [[unlikely]] {
+    throw std::runtime_error("Cannot create a FrameView for an invalid Frame - was it already disposed?");
+  }
+  _width = static_cast<size_t>(frame->getWidth());
+  _height = static_cast<size_t>(frame->getHeight());
+  _pixelFormat = frame->getPixelFormat();
+  _timestamp = frame->getTimestamp();
+  _orientation = frame->getOrientation();
+  _isMirrored = frame->getIsMirrored();
+
+  if (frame->getHasNativeBuffer()) {
+    _nativeBuffer = frame->getNativeBuffer();
+    if (tryLockPlanes()) {
+      return;
+    }
+    _nativeBuffer->release();
+    _nativeBuffer = std::nullopt;
+  }
+  wrapPlanes(frame);
+}
+
+FrameView::~FrameView() {
+  if (_hardwareBuffer != nullptr) {
+    AHardwareBuffer_unlock(_hardwareBuffer, nullptr);
+  }
+  if (_nativeBuffer.has_value()) {
+    try {
+      _nativeBuffer->release();
+    } catch (...) {
+      // Avoid throwing from a destructor.
+    }
+  }
+}
+
+bool FrameView::tryLockPlanes() {
+  const LockPlanesFunction lockPlanes = getLockPlanesFunction();
+  if (lockPlanes == nullptr) {
+    return false;
+  }
+  AHardwareBuffer* hardwareBuffer = reinterpret_cast<AHardwareBuffer*>(_nativeBuffer->pointer);
+  AHardwareBuffer_Planes planes{};
+  // PRIVATE buffers (or buffers without CPU usage) cannot be locked, their planes are wrapped instead.
+  if (lockPlanes(hardwareBuffer, AHARDWAREBUFFER_USAGE_CPU_READ_OFTEN, -1, nullptr, &planes) != 0) {
+    return false;
+  }
+  _hardwareBuffer = hardwareBuffer;
+
+  _planes.reserve(planes.planeCount);
+  for (uint32_t i = 0; i < planes.planeCount; i++) {
+    const AHardwareBuffer_Plane& plane = planes.planes[i];
+    _planes.push_back(FramePlaneView{
+        .data = static_cast<const uint8_t*>(plane.data),
+        .rowStride = plane.rowStride,
+        .pixelStride = plane.pixelStride,
+        .width = getPlaneWidth(i),
+        .height = getPlaneHeight(i),
+    });
+  }
+  return true;
+}
+
+void FrameView::wrapPlanes(const std::shared_ptr<HybridFrameSpec>& frame) {
+  const std::vector<std::shared_ptr<HybridFramePlaneSpec>> planes = frame->getPlanes();
+  _planes.reserve(planes.size());
+  _planeBuffers.reserve(planes.size());
+  for (const std::shared_ptr<HybridFramePlaneSpec>& plane : planes) {
+    std::shared_ptr<ArrayBuffer> buffer = plane->getPixelBuffer();
+    const double rowStride = plane->getBytesPerRow();
+    // `FramePlane.width` is the row stride in pixels, so it also tells the pixel stride.
+    const double rowStrideInPixels = plane->getWidth();
+    const size_t index = _planes.size();
+    _planes.push_back(FramePlaneView{
+        .data = buffer->data(),
+        .rowStride = static_cast<size_t>(rowStride),
+        .pixelStride = rowStrideInPixels > 0 ? static_cast<size_t>(std::lround(rowStride / rowStrideInPixels)) : 0,
+        .width = getPlaneWidth(index),
+        .height = getPlaneHeight(index),
+    });
+    _planeBuffers.push_back(std::move(buffer));
+  }
+}
+
+bool FrameView::isChromaPlane(size_t planeIndex) const noexcept {
+  // Chroma planes of YUV 4:2:0 Frames are subsampled in both dimensions.
+  return planeIndex > 0 && isYuv420(_pixelFormat);
+}
+
+size_t FrameView::getPlaneWidth(size_t planeIndex) const noexcept {
+  return isChromaPlane(planeIndex) ? (_width + 1) / 2 : _width;
+}
+
+size_t FrameView::getPlaneHeight(size_t planeIndex) const noexcept {
+  return isChromaPlane(planeIndex) ? (_height + 1) / 2 : _height;
+}
+
+} // namespace margelo::nitro::camera
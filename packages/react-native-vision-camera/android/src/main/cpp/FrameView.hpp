@@ -0,0 +1,111 @@
+///
+/// FrameView.hpp
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include "CameraOrientation.hpp"
+#include "HybridFrameSpec.hpp"
+#include "NativeBuffer.hpp"
+#include "PixelFormat.hpp"
+#include <NitroModules/ArrayBuffer.hpp>
+#include <android/hardware_buffer.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace margelo::nitro::camera {
+
+/**
+ * Describes one plane of a `FrameView`, in place.
+ * Pixel `(x, y)` of this plane starts at `data + y * rowStride + x * pixelStride`.
+ * `width` and `height` are in pixels of this plane, so chroma planes of YUV 4:2:0 Frames are half the Frame's size.
+ */
+struct FramePlaneView {
+  const uint8_t* data;
+  size_t rowStride;
+  size_t pixelStride;
+  size_t width;
+  size_t height;
+};
+
+/**
+ * A zero-copy, read-only view over the pixels of one `Frame`, for C++ Frame Processor Plugins.
+ *
+ * Everything is resolved once in the constructor, so reading planes afterwards needs no JNI or JSI calls.
+ * If the Frame has a native buffer, its `AHardwareBuffer` is locked for CPU reads via `AHardwareBuffer_lockPlanes`
+ * (Android 10+). Otherwise, the Frame's planes are wrapped as-is.
+ *
+ * The plane pointers are only valid while both this `FrameView` and its `Frame` are alive.
+ */
+class FrameView final {
+public:
+  explicit FrameView(const std::shared_ptr<HybridFrameSpec>& frame);
+  ~FrameView();
+
+  FrameView(const FrameView&) = delete;
+  FrameView& operator=(const FrameView&) = delete;
+  FrameView(FrameView&&) = delete;
+  FrameView& operator=(FrameView&&) = delete;
+
+  [[nodiscard]] size_t getWidth() const noexcept {
+    return _width;
+  }
+  [[nodiscard]] size_t getHeight() const noexcept {
+    return _height;
+  }
+  [[nodiscard]] PixelFormat getPixelFormat() const noexcept {
+    return _pixelFormat;
+  }
+  /**
+   * The presentation timestamp of the Frame, in nanoseconds.
+   */
+  [[nodiscard]] double getTimestamp() const noexcept {
+    return _timestamp;
+  }
+  [[nodiscard]] CameraOrientation getOrientation() const noexcept {
+    return _orientation;
+  }
+  [[nodiscard]] bool getIsMirrored() const noexcept {
+    return _isMirrored;
+  }
+  /**
+   * The planes of the Frame, e.g. Y, U and V for YUV 4:2:0 Frames, or a single plane for RGB Frames.
+   */
+  [[nodiscard]] const std::vector<FramePlaneView>& getPlanes() const noexcept {
+    return _planes;
+  }
+  /**
+   * Returns the locked `AHardwareBuffer` of the Frame, or `nullptr` if its planes were wrapped instead.
+   */
+  [[nodiscard]] AHardwareBuffer* getHardwareBuffer() const noexcept {
+    return _hardwareBuffer;
+  }
+
+private:
+  bool tryLockPlanes();
+  void wrapPlanes(const std::shared_ptr<HybridFrameSpec>& frame);
+  [[nodiscard]] bool isChromaPlane(size_t planeIndex) const noexcept;
+  [[nodiscard]] size_t getPlaneWidth(size_t planeIndex) const noexcept;
+  [[nodiscard]] size_t getPlaneHeight(size_t planeIndex) const noexcept;
+
+private:
+  size_t _width{0};
+  size_t _height{0};
+  PixelFormat _pixelFormat{PixelFormat::UNKNOWN};
+  double _timestamp{0};
+  CameraOrientation _orientation{CameraOrientation::UP};
+  bool _isMirrored{false};
+  std::vector<FramePlaneView> _planes;
+
+  // Either the locked native buffer...
+  std::optional<NativeBuffer> _nativeBuffer;
+  AHardwareBuffer* _hardwareBuffer{nullptr};
+  // ...or the plane buffers the plane pointers point into.
+  std::vector<std::shared_ptr<ArrayBuffer>> _planeBuffers;
+};
+
+} // namespace margelo::nitro::camera
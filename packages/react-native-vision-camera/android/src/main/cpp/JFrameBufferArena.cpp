@@ -0,0 +1,46 @@
+///
+/// JFrameBufferArena.cpp
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#include "JFrameBufferArena.hpp"
+#include "FrameBufferArena.hpp"
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+namespace margelo::nitro::camera {
+
+using namespace facebook;
+
+jni::local_ref<JFrameBufferLease::jhybridobject> JFrameBufferArena::acquire(jni::alias_ref<jni::JClass>, jint size) {
+  if (size < 0) [[unlikely]] {
+    throw std::runtime_error("Cannot acquire a Frame buffer of " + std::to_string(size) + " bytes!");
+  }
+  return JFrameBufferLease::acquire(static_cast<size_t>(size));
+}
+
+void JFrameBufferArena::trim(jni::alias_ref<jni::JClass>) {
+  FrameBufferArena::shared().trim();
+}
+
+void JFrameBufferArena::clear(jni::alias_ref<jni::JClass>) {
+  FrameBufferArena::shared().clear();
+}
+
+jni::local_ref<jni::JArrayLong> JFrameBufferArena::getStatsNative(jni::alias_ref<jni::JClass>) {
+  const FrameBufferArenaStats stats = FrameBufferArena::shared().getStats();
+  // Same order as the `FrameBufferArena.Stats` constructor in Kotlin.
+  const jlong values[] = {
+      static_cast<jlong>(stats.hits),
+      static_cast<jlong>(stats.misses),
+      static_cast<jlong>(stats.bytesInUse),
+      static_cast<jlong>(stats.bytesRetained),
+      static_cast<jlong>(stats.peakBytesInUse),
+  };
+  auto array = jni::JArrayLong::newArray(std::size(values));
+  array->setRegion(0, std::size(values), values);
+  return array;
+}
+
+} // namespace margelo::nitro::camera
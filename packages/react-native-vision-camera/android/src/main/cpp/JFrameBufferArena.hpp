@@ -0,0 +1,40 @@
+///
+/// JFrameBufferArena.hpp
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include "JFrameBufferLease.hpp"
+#include <fbjni/fbjni.h>
+
+namespace margelo::nitro::camera {
+
+using namespace facebook;
+
+/**
+ * Exposes the shared `FrameBufferArena` to Kotlin, which acquires its blocks as `FrameBufferLease`s.
+ */
+class JFrameBufferArena : public jni::HybridClass<JFrameBufferArena> {
+public:
+  static jni::local_ref<JFrameBufferLease::jhybridobject> acquire(jni::alias_ref<jni::JClass> clazz, jint size);
+  static void trim(jni::alias_ref<jni::JClass> clazz);
+  static void clear(jni::alias_ref<jni::JClass> clazz);
+  static jni::local_ref<jni::JArrayLong> getStatsNative(jni::alias_ref<jni::JClass> clazz);
+
+public:
+  static auto constexpr kJavaDescriptor = "Lcom/margelo/nitro/camera/utils/FrameBufferArena;";
+  static void registerNatives() {
+    registerHybrid({
+        makeNativeMethod("acquire", JFrameBufferArena::acquire),
+        makeNativeMethod("trim", JFrameBufferArena::trim),
+        makeNativeMethod("clear", JFrameBufferArena::clear),
+        makeNativeMethod("getStatsNative", JFrameBufferArena::getStatsNative),
+    });
+  }
+
+private:
+  friend HybridBase;
+};
+
+} // namespace margelo::nitro::camera
@@ -0,0 +1,33 @@
+///
+/// JFrameBufferLease.cpp
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#include "JFrameBufferLease.hpp"
+#include "FrameBufferArena.hpp"
+#include <NitroModules/ArrayBuffer.hpp>
+
+namespace margelo::nitro::camera {
+
+using namespace facebook;
+
+jni::local_ref<JFrameBufferLease::jhybridobject> JFrameBufferLease::acquire(size_t size) {
+  uint8_t* data = FrameBufferArena::shared().acquire(size);
+  // The last owner - either this lease or one of its ArrayBuffers - returns the block to the arena.
+  std::shared_ptr<uint8_t> block(data, [](uint8_t* data) { FrameBufferArena::shared().release(data); });
+  return newObjectCxxArgs(std::move(block), size);
+}
+
+jni::local_ref<jni::JByteBuffer> JFrameBufferLease::getByteBuffer() {
+  // The ByteBuffer is exactly as large as requested, even though its block may be larger.
+  return jni::JByteBuffer::wrapBytes(_block.get(), _size);
+}
+
+jni::local_ref<JArrayBuffer::javaobject> JFrameBufferLease::toArrayBuffer() {
+  std::shared_ptr<ArrayBuffer> arrayBuffer = ArrayBuffer::wrap(_block.get(), _size, [block = _block]() {
+    // `block` is released together with this ArrayBuffer.
+  });
+  return JArrayBuffer::wrap(arrayBuffer);
+}
+
+} // namespace margelo::nitro::camera
@@ -0,0 +1,59 @@
+///
+/// JFrameBufferLease.hpp
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include <NitroModules/JArrayBuffer.hpp>
+#include <fbjni/ByteBuffer.h>
+#include <fbjni/fbjni.h>
+#include <memory>
+
+namespace margelo::nitro::camera {
+
+using namespace facebook;
+
+/**
+ * One block of the shared `FrameBufferArena`, held by Kotlin until it is disposed (or garbage-collected).
+ *
+ * Every `ArrayBuffer` created via `toArrayBuffer()` shares ownership of the block, so it only goes back
+ * to the arena once the lease is disposed *and* all of those `ArrayBuffer`s have been garbage-collected.
+ */
+class JFrameBufferLease : public jni::HybridClass<JFrameBufferLease> {
+public:
+  /**
+   * Acquires a block of `size` bytes from the shared `FrameBufferArena`. Its contents are uninitialized.
+   */
+  static jni::local_ref<jhybridobject> acquire(size_t size);
+
+public:
+  /**
+   * Gets a direct `ByteBuffer` of exactly the requested size to fill the block.
+   * It does not own the block, so it must not be used after the lease is disposed.
+   */
+  jni::local_ref<jni::JByteBuffer> getByteBuffer();
+  /**
+   * Wraps the block in an `ArrayBuffer` that keeps it alive until it is garbage-collected.
+   */
+  jni::local_ref<JArrayBuffer::javaobject> toArrayBuffer();
+
+public:
+  static auto constexpr kJavaDescriptor = "Lcom/margelo/nitro/camera/utils/FrameBufferLease;";
+  static void registerNatives() {
+    registerHybrid({
+        makeNativeMethod("getByteBuffer", JFrameBufferLease::getByteBuffer),
+        makeNativeMethod("toArrayBuffer", JFrameBufferLease::toArrayBuffer),
+    });
+  }
+
+private:
+  JFrameBufferLease(std::shared_ptr<uint8_t> block, size_t size) : _block(std::move(block)), _size(size) {}
+
+private:
+  friend HybridBase;
+  std::shared_ptr<uint8_t> _block;
+  size_t _size;
+};
+
+} // namespace margelo::nitro::camera
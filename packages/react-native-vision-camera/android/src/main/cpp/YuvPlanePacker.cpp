@@ -0,0 +1,166 @@
+///
+/// YuvPlanePacker.cpp
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#include "YuvPlanePacker.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace margelo::nitro::camera {
+
+using namespace facebook;
+
+namespace {
+
+  // Vendors pad the Y plane's height to their own alignment before the UV plane starts, but never by more than this.
+  constexpr size_t kMaxPaddingRows = 64;
+
+  struct PlaneMemory {
+    uint8_t* data;
+    size_t size;
+  };
+
+  PlaneMemory getPlaneMemory(jni::alias_ref<jni::JByteBuffer> buffer, const char* name) {
+    if (buffer == nullptr || !buffer->isDirect()) [[unlikely]] {
+      throw std::runtime_error(std::string("The ") + name + " plane is not a direct ByteBuffer!");
+    }
+    return PlaneMemory{.data = buffer->getDirectBytes(), .size = buffer->getDirectSize()};
+  }
+
+  /**
+   * The number of bytes a plane with the given layout needs, up to its last sample.
+   */
+  size_t getRequiredPlaneSize(size_t rowStride, size_t pixelStride, size_t width, size_t height) {
+    if (width == 0 || height == 0) {
+      return 0;
+    }
+    return rowStride * (height - 1) + pixelStride * (width - 1) + 1;
+  }
+
+  /**
+   * Copies every second byte of `source` (starting at the first one) into `destination`, `count` times.
+   * Never reads past `source[(count - 1) * 2]`, since the last sample of a chroma row may be the last byte of its plane.
+   */
+  void copyEvenBytes(const uint8_t* source, uint8_t* destination, size_t count) {
+    size_t i = 0;
+#if defined(__ARM_NEON)
+    for (; i + 16 < count; i += 16) {
+      const uint8x16x2_t interleaved = vld2q_u8(source + i * 2);
+      vst1q_u8(destination + i, interleaved.val[0]);
+    }
+#elif defined(__SSE2__)
+    const __m128i evenMask = _mm_set1_epi16(0x00FF);
+    for (; i + 16 < count; i += 16) {
+      const __m128i low = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 2)), evenMask);
+      const __m128i high = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 2 + 16)), evenMask);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_packus_epi16(low, high));
+    }
+#endif
+    for (; i < count; i++) {
+      destination[i] = source[i * 2];
+    }
+  }
+
+  /**
+   * Copies a `width` x `height` plane with the given strides into a tightly packed plane at `destination`.
+   */
+  void packPlane(const uint8_t* source, size_t rowStride, size_t pixelStride, size_t width, size_t height, uint8_t* destination) {
+    for (size_t y = 0; y < height; y++) {
+      const uint8_t* sourceRow = source + y * rowStride;
+      uint8_t* destinationRow = destination + y * width;
+      if (pixelStride == 1) {
+        std::memcpy(destinationRow, sourceRow, width);
+      } else if (pixelStride == 2) {
+        copyEvenBytes(sourceRow, destinationRow, width);
+      } else {
+        for (size_t x = 0; x < width; x++) {
+          destinationRow[x] = sourceRow[x * pixelStride];
+        }
+      }
+    }
+  }
+
+} // namespace
+
+jni::local_ref<jni::JByteBuffer> YuvPlanePacker::wrapSemiPlanar(jni::alias_ref<jni::JClass>, jni::alias_ref<jni::JByteBuffer> yBuffer,
+                                                                jni::alias_ref<jni::JByteBuffer> uBuffer, jni::alias_ref<jni::JByteBuffer> vBuffer,
+                                                                jint yRowStride, jint uvRowStride, jint uvPixelStride, jint height) {
+  if (uvPixelStride != 2 || yRowStride <= 0 || uvRowStride <= 0 || height <= 0) {
+    return nullptr;
+  }
+  const PlaneMemory yPlane = getPlaneMemory(yBuffer, "Y");
+  const PlaneMemory uPlane = getPlaneMemory(uBuffer, "U");
+  const PlaneMemory vPlane = getPlaneMemory(vBuffer, "V");
+
+  // NV12 stores U first, NV21 stores V first - either way, the other one starts one byte later.
+  const uintptr_t uAddress = reinterpret_cast<uintptr_t>(uPlane.data);
+  const uintptr_t vAddress = reinterpret_cast<uintptr_t>(vPlane.data);
+  if (vAddress != uAddress + 1 && uAddress != vAddress + 1) {
+    return nullptr;
+  }
+  const uintptr_t yAddress = reinterpret_cast<uintptr_t>(yPlane.data);
+  const uintptr_t uvAddress = std::min(uAddress, vAddress);
+  const size_t minUvOffset = static_cast<size_t>(yRowStride) * static_cast<size_t>(height);
+  const size_t maxUvOffset = static_cast<size_t>(yRowStride) * (static_cast<size_t>(height) + kMaxPaddingRows);
+  if (uvAddress < yAddress + minUvOffset || uvAddress > yAddress + maxUvOffset) {
+    // The UV plane is not part of the Y plane's allocation, so there is no single range to wrap.
+    return nullptr;
+  }
+  if (yAddress + yPlane.size < uvAddress) {
+    // Adjacent addresses do not prove one mapping: the bytes between the end of the Y plane and the start of the UV plane
+    // may not be mapped at all. Only wrap if the Y plane itself reports them as part of its buffer.
+    return nullptr;
+  }
+  const uintptr_t endAddress = std::max(uAddress + uPlane.size, vAddress + vPlane.size);
+  return jni::JByteBuffer::wrapBytes(yPlane.data, endAddress - yAddress);
+}
+
+jlong YuvPlanePacker::getAddressOffset(jni::alias_ref<jni::JClass>, jni::alias_ref<jni::JByteBuffer> base,
+                                       jni::alias_ref<jni::JByteBuffer> buffer) {
+  const PlaneMemory baseMemory = getPlaneMemory(base, "base");
+  const PlaneMemory bufferMemory = getPlaneMemory(buffer, "target");
+  return static_cast<jlong>(reinterpret_cast<intptr_t>(bufferMemory.data) - reinterpret_cast<intptr_t>(baseMemory.data));
+}
+
+void YuvPlanePacker::packI420(jni::alias_ref<jni::JClass>, jni::alias_ref<jni::JByteBuffer> yBuffer, jni::alias_ref<jni::JByteBuffer> uBuffer,
+                              jni::alias_ref<jni::JByteBuffer> vBuffer, jint yRowStride, jint uvRowStride, jint uvPixelStride, jint width, jint height,
+                              jni::alias_ref<jni::JByteBuffer> destination) {
+  if (yRowStride <= 0 || uvRowStride <= 0 || uvPixelStride <= 0 || width <= 0 || height <= 0) [[unlikely]] {
+    throw std::runtime_error("Cannot pack a YUV Image with non-positive strides or dimensions!");
+  }
+  const size_t lumaWidth = static_cast<size_t>(width);
+  const size_t lumaHeight = static_cast<size_t>(height);
+  const size_t chromaWidth = (lumaWidth + 1) / 2;
+  const size_t chromaHeight = (lumaHeight + 1) / 2;
+
+  const PlaneMemory yPlane = getPlaneMemory(yBuffer, "Y");
+  const PlaneMemory uPlane = getPlaneMemory(uBuffer, "U");
+  const PlaneMemory vPlane = getPlaneMemory(vBuffer, "V");
+  const PlaneMemory output = getPlaneMemory(destination, "destination");
+  const size_t requiredChromaSize = getRequiredPlaneSize(uvRowStride, uvPixelStride, chromaWidth, chromaHeight);
+  if (yPlane.size < getRequiredPlaneSize(yRowStride, 1, lumaWidth, lumaHeight) || uPlane.size < requiredChromaSize ||
+      vPlane.size < requiredChromaSize) [[unlikely]] {
+    throw std::runtime_error("The planes of the YUV Image are smaller than its strides and dimensions require!");
+  }
+  const size_t lumaSize = lumaWidth * lumaHeight;
+  const size_t chromaSize = chromaWidth * chromaHeight;
+  if (output.size < lumaSize + chromaSize * 2) [[unlikely]] {
+    throw std::runtime_error("The destination buffer is too small for a " + std::to_string(width) + "x" + std::to_string(height) + " I420 Image!");
+  }
+
+  packPlane(yPlane.data, yRowStride, 1, lumaWidth, lumaHeight, output.data);
+  packPlane(uPlane.data, uvRowStride, uvPixelStride, chromaWidth, chromaHeight, output.data + lumaSize);
+  packPlane(vPlane.data, uvRowStride, uvPixelStride, chromaWidth, chromaHeight, output.data + lumaSize + chromaSize);
+}
+
+} // namespace margelo::nitro::camera
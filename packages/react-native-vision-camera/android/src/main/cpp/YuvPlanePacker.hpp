@@ -0,0 +1,55 @@
+///
+/// YuvPlanePacker.hpp
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include <fbjni/ByteBuffer.h>
+#include <fbjni/fbjni.h>
+
+namespace margelo::nitro::camera {
+
+using namespace facebook;
+
+/**
+ * Turns the three planes of an 8-bit YUV 4:2:0 `Image` into one contiguous buffer.
+ */
+class YuvPlanePacker : public jni::HybridClass<YuvPlanePacker> {
+public:
+  /**
+   * If the U and V planes alias one interleaved UV plane (NV12 or NV21) that follows the Y plane in the same allocation,
+   * returns one direct `ByteBuffer` spanning all planes, without a copy. Otherwise, returns `null`.
+   * The Y plane's reported size must reach the start of the UV plane, so every wrapped byte belongs to a reported plane.
+   */
+  static jni::local_ref<jni::JByteBuffer> wrapSemiPlanar(jni::alias_ref<jni::JClass> clazz, jni::alias_ref<jni::JByteBuffer> yBuffer,
+                                                         jni::alias_ref<jni::JByteBuffer> uBuffer, jni::alias_ref<jni::JByteBuffer> vBuffer,
+                                                         jint yRowStride, jint uvRowStride, jint uvPixelStride, jint height);
+  /**
+   * Returns how many bytes after the start of `base` the start of `buffer` lies in memory, e.g. to find the offset of a
+   * plane inside a buffer returned by `wrapSemiPlanar`.
+   */
+  static jlong getAddressOffset(jni::alias_ref<jni::JClass> clazz, jni::alias_ref<jni::JByteBuffer> base, jni::alias_ref<jni::JByteBuffer> buffer);
+  /**
+   * Copies the Y, U and V planes into `destination` as tightly packed I420: the full-size Y plane, followed by the
+   * half-size U plane and the half-size V plane.
+   */
+  static void packI420(jni::alias_ref<jni::JClass> clazz, jni::alias_ref<jni::JByteBuffer> yBuffer, jni::alias_ref<jni::JByteBuffer> uBuffer,
+                       jni::alias_ref<jni::JByteBuffer> vBuffer, jint yRowStride, jint uvRowStride, jint uvPixelStride, jint width, jint height,
+                       jni::alias_ref<jni::JByteBuffer> destination);
+
+public:
+  static auto constexpr kJavaDescriptor = "Lcom/margelo/nitro/camera/utils/YuvPlanePacker;";
+  static void registerNatives() {
+    registerHybrid({
+        makeNativeMethod("wrapSemiPlanar", YuvPlanePacker::wrapSemiPlanar),
+        makeNativeMethod("getAddressOffset", YuvPlanePacker::getAddressOffset),
+        makeNativeMethod("packI420", YuvPlanePacker::packI420),
+    });
+  }
+
+private:
+  friend HybridBase;
+};
+
+} // namespace margelo::nitro::camera
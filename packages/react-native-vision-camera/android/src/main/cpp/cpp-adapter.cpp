@@ -1,5 +1,8 @@
+#include "JFrameBufferArena.hpp"
+#include "JFrameBufferLease.hpp"
 #include "NativeBufferHelper.hpp"
 #include "VisionCameraOnLoad.hpp"
+#include "YuvPlanePacker.hpp"
 #include <fbjni/fbjni.h>
 #include <jni.h>
 
@@ -9,5 +12,8 @@ JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM* vm, void*) {
     margelo::nitro::camera::registerAllNatives();
     // Initialize custom JNI stuff
     margelo::nitro::camera::NativeBufferHelper::registerNatives();
+    margelo::nitro::camera::YuvPlanePacker::registerNatives();
+    margelo::nitro::camera::JFrameBufferArena::registerNatives();
+    margelo::nitro::camera::JFrameBufferLease::registerNatives();
   });
 }
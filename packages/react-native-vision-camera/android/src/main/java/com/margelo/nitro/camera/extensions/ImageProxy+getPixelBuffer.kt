@@ -1,11 +1,16 @@
 package com.margelo.nitro.camera.extensions
 
+import android.graphics.ImageFormat
 import android.hardware.HardwareBuffer
 import android.os.Build
 import androidx.camera.core.ImageProxy
-import com.margelo.nitro.camera.utils.DirectByteBufferPool
+import com.margelo.nitro.camera.PixelBufferPlaneLayout
+import com.margelo.nitro.camera.utils.FrameBufferArena
+import com.margelo.nitro.camera.utils.FrameBufferLease
+import com.margelo.nitro.camera.utils.YuvPlanePacker
 import com.margelo.nitro.core.ArrayBuffer
 import java.nio.ByteBuffer
+import java.util.concurrent.atomic.AtomicBoolean
 
 val HardwareBuffer.isCpuReadable: Boolean
   get() {
@@ -27,58 +32,205 @@ val ImageProxy.hasPixelBuffer: Boolean
     return planes.isNotEmpty()
   }
 
-data class DisposableArrayBuffer(
-  val arrayBuffer: ArrayBuffer,
-  val dispose: () -> Unit,
-)
+class DisposableArrayBuffer(
+  /**
+   * Where each plane lives inside [arrayBuffer].
+   */
+  val layout: Array<PixelBufferPlaneLayout>,
+  createArrayBuffer: () -> ArrayBuffer,
+  private val onDispose: () -> Unit,
+) {
+  private val isDisposed = AtomicBoolean(false)
 
-private fun ByteBuffer.wrapOrCopyIntoArrayBuffer(): DisposableArrayBuffer {
+  /**
+   * The pixel data, only wrapped once it is first accessed.
+   */
+  val arrayBuffer: ArrayBuffer by lazy(createArrayBuffer)
+
+  /**
+   * Releases this buffer's hold on its memory. Only the first call has an effect.
+   */
+  fun dispose() {
+    if (isDisposed.compareAndSet(false, true)) {
+      onDispose()
+    }
+  }
+}
+
+/**
+ * Wraps this lease so that its block lives until the Frame is disposed and JS has garbage-collected its [ArrayBuffer].
+ */
+private fun FrameBufferLease.toDisposableArrayBuffer(layout: Array<PixelBufferPlaneLayout>): DisposableArrayBuffer =
+  DisposableArrayBuffer(layout, { toArrayBuffer() }) {
+    dispose()
+  }
+
+private fun ImageProxy.PlaneProxy.getLayout(
+  offset: Int,
+  width: Int,
+  height: Int,
+): PixelBufferPlaneLayout =
+  PixelBufferPlaneLayout(
+    offset.toDouble(),
+    rowStride.toDouble(),
+    pixelStride.toDouble(),
+    width.toDouble(),
+    height.toDouble(),
+  )
+
+private fun ByteBuffer.wrapOrCopyIntoArrayBuffer(layout: Array<PixelBufferPlaneLayout>): DisposableArrayBuffer {
   val buffer = readableBytes()
   if (buffer.isDirect) {
-    val arrayBuffer = ArrayBuffer.wrap(buffer)
-    return DisposableArrayBuffer(arrayBuffer) {
+    return DisposableArrayBuffer(layout, { ArrayBuffer.wrap(buffer) }) {
       // no release
     }
   }
 
-  val directBuffer = DirectByteBufferPool.Shared.acquire(buffer.remaining())
-  directBuffer.put(buffer)
-  val arrayBuffer = ArrayBuffer.wrap(directBuffer)
-  return DisposableArrayBuffer(arrayBuffer) {
-    DirectByteBufferPool.Shared.release(directBuffer)
+  val lease = FrameBufferArena.acquire(buffer.remaining())
+  lease.byteBuffer.put(buffer)
+  return lease.toDisposableArrayBuffer(layout)
+}
+
+/**
+ * Whether this Image has 8-bit Y, U and V planes that [YuvPlanePacker] can handle.
+ */
+private val ImageProxy.isPackableYuv: Boolean
+  get() =
+    format == ImageFormat.YUV_420_888 &&
+      planes.size == 3 &&
+      planes[0].pixelStride == 1 &&
+      planes.all { plane -> plane.buffer.isDirect }
+
+/**
+ * Wraps the Y and interleaved UV planes of an NV12 or NV21 Image as one buffer, without copying.
+ * Returns `null` if the planes are not laid out like that in memory.
+ */
+private fun ImageProxy.wrapSemiPlanarYuv(): DisposableArrayBuffer? {
+  val (yPlane, uPlane, vPlane) = planes
+  val yBuffer = yPlane.buffer.readableBytes()
+  val uBuffer = uPlane.buffer.readableBytes()
+  val vBuffer = vPlane.buffer.readableBytes()
+  if (uPlane.rowStride != vPlane.rowStride || uPlane.pixelStride != vPlane.pixelStride) return null
+
+  val byteBuffer =
+    YuvPlanePacker.wrapSemiPlanar(
+      yBuffer,
+      uBuffer,
+      vBuffer,
+      yPlane.rowStride,
+      uPlane.rowStride,
+      uPlane.pixelStride,
+      height,
+    ) ?: return null
+  val uOffset = YuvPlanePacker.getAddressOffset(yBuffer, uBuffer).toInt()
+  val vOffset = YuvPlanePacker.getAddressOffset(yBuffer, vBuffer).toInt()
+  val chromaWidth = (width + 1) / 2
+  val chromaHeight = (height + 1) / 2
+  val layout =
+    arrayOf(
+      yPlane.getLayout(0, width, height),
+      uPlane.getLayout(uOffset, chromaWidth, chromaHeight),
+      vPlane.getLayout(vOffset, chromaWidth, chromaHeight),
+    )
+  return DisposableArrayBuffer(layout, { ArrayBuffer.wrap(byteBuffer) }) {
+    // no release
+  }
+}
+
+/**
+ * Copies the Y, U and V planes of the Image into a pooled buffer as tightly packed I420.
+ */
+private fun ImageProxy.packI420Yuv(): DisposableArrayBuffer {
+  val (yPlane, uPlane, vPlane) = planes
+  val lease = FrameBufferArena.acquire(YuvPlanePacker.getI420Size(width, height))
+  try {
+    YuvPlanePacker.packI420(
+      yPlane.buffer.readableBytes(),
+      uPlane.buffer.readableBytes(),
+      vPlane.buffer.readableBytes(),
+      yPlane.rowStride,
+      uPlane.rowStride,
+      uPlane.pixelStride,
+      width,
+      height,
+      lease.byteBuffer,
+    )
+  } catch (e: Throwable) {
+    lease.dispose()
+    throw e
   }
+  val chromaWidth = (width + 1) / 2
+  val chromaHeight = (height + 1) / 2
+  val lumaSize = width * height
+  val chromaSize = chromaWidth * chromaHeight
+  fun packedLayout(
+    offset: Int,
+    planeWidth: Int,
+    planeHeight: Int,
+  ) = PixelBufferPlaneLayout(offset.toDouble(), planeWidth.toDouble(), 1.0, planeWidth.toDouble(), planeHeight.toDouble())
+  val layout =
+    arrayOf(
+      packedLayout(0, width, height),
+      packedLayout(lumaSize, chromaWidth, chromaHeight),
+      packedLayout(lumaSize + chromaSize, chromaWidth, chromaHeight),
+    )
+  return lease.toDisposableArrayBuffer(layout)
 }
 
+/**
+ * Gets the pixel data of this Image as one [ArrayBuffer], and where each plane lives inside it.
+ *
+ * - Single-plane Images are wrapped as-is, with their original strides.
+ * - 8-bit YUV 4:2:0 Images are wrapped as-is if their planes are one contiguous NV12 or NV21 allocation,
+ *   or otherwise copied into tightly packed I420.
+ * - Other multi-plane Images are copied plane after plane.
+ */
 fun ImageProxy.getPixelBuffer(): DisposableArrayBuffer {
-  if (Build.VERSION.SDK_INT >= Build.VERSION_CODES.P) {
-    hardwareBuffer?.use { hardwareBuffer ->
-      if (hardwareBuffer.isCpuReadable) {
-        // Fast Path: We have a CPU-readable HardwareBuffer.
-        val arrayBuffer = ArrayBuffer.wrap(hardwareBuffer)
-        return DisposableArrayBuffer(arrayBuffer) {
-          // no release
+  if (planes.size == 1) {
+    val plane = planes.single()
+    val layout = arrayOf(plane.getLayout(0, width, height))
+    if (Build.VERSION.SDK_INT >= Build.VERSION_CODES.P) {
+      hardwareBuffer?.use { hardwareBuffer ->
+        if (hardwareBuffer.isCpuReadable) {
+          // Fast Path: We have a CPU-readable HardwareBuffer.
+          val arrayBuffer = ArrayBuffer.wrap(hardwareBuffer)
+          return DisposableArrayBuffer(layout, { arrayBuffer }) {
+            // no release
+          }
         }
       }
     }
+    // Medium Path: We can wrap a single direct plane as a ByteBuffer, or copy it into one if needed.
+    return plane.buffer.wrapOrCopyIntoArrayBuffer(layout)
   }
 
   when {
-    planes.size == 1 -> {
-      // Medium Path: We can wrap a single direct plane as a ByteBuffer, or copy it into one if needed.
-      return planes.single().buffer.wrapOrCopyIntoArrayBuffer()
+    isPackableYuv -> {
+      // Fast Path: NV12/NV21 planes that are contiguous in memory can be wrapped as one buffer.
+      wrapSemiPlanarYuv()?.let { return it }
+      // Medium Path: Repack the planes as I420, honoring their row- and pixel-strides.
+      return packI420Yuv()
     }
     planes.size > 1 -> {
       // Slow Path: We have to copy all planes into a new ByteBuffer.
       val buffers = planes.map { plane -> plane.buffer.readableBytes() }
       val totalBytes = buffers.sumOf { buffer -> buffer.remaining() }
-      val byteBuffer = DirectByteBufferPool.Shared.acquire(totalBytes)
+      val lease = FrameBufferArena.acquire(totalBytes)
+      var offset = 0
+      val layout =
+        planes.mapIndexed { index, plane ->
+          val planeBytes = buffers[index].remaining()
+          val planeWidth = minOf(width, plane.rowStride / maxOf(plane.pixelStride, 1))
+          val planeHeight = minOf(height, (planeBytes + plane.rowStride - 1) / maxOf(plane.rowStride, 1))
+          val planeLayout = plane.getLayout(offset, planeWidth, planeHeight)
+          offset += planeBytes
+          planeLayout
+        }
+      val byteBuffer = lease.byteBuffer
       for (buffer in buffers) {
         byteBuffer.put(buffer)
       }
-      val arrayBuffer = ArrayBuffer.wrap(byteBuffer)
-      return DisposableArrayBuffer(arrayBuffer) {
-        DirectByteBufferPool.Shared.release(byteBuffer)
-      }
+      return lease.toDisposableArrayBuffer(layout.toTypedArray())
     }
     else -> throw Error("ImageProxy does not contain any readable Pixel Data!")
   }
@@ -25,7 +25,7 @@ import com.margelo.nitro.camera.session.ActiveCameraSessionSingle
 import com.margelo.nitro.camera.session.ConstraintResolver
 import com.margelo.nitro.camera.session.toConfig
 import com.margelo.nitro.camera.utils.CustomLifecycle
-import com.margelo.nitro.camera.utils.DirectByteBufferPool
+import com.margelo.nitro.camera.utils.FrameBufferArena
 import com.margelo.nitro.core.Promise
 import kotlinx.coroutines.CoroutineScope
 import kotlinx.coroutines.Dispatchers
@@ -44,6 +44,7 @@ class HybridCameraSession(
     get() = activeSession?.isRunning ?: false
 
   private var activeSession: ActiveCameraSession? = null
+  private var attachedUseCases = emptyList<NativeCameraOutput.PreparedUseCase>()
   private var onStartedListeners = arrayListOf<() -> Unit>()
   private var onStoppedListeners = arrayListOf<() -> Unit>()
   private var onErrorListeners = arrayListOf<(Throwable) -> Unit>()
@@ -63,7 +64,7 @@ class HybridCameraSession(
       //       I think SessionConfig can be rebound directly for faster switches?
 
       // 1. Unbind all inputs/outputs
-      cameraProvider.unbindAll()
+      unbindAll()
       activeSession?.close()
       activeSession = null
 
@@ -90,6 +91,7 @@ class HybridCameraSession(
           val camera = cameraProvider.bindToLifecycle(lifecycleOwner, cameraInfo.cameraSelector, config.sessionConfig)
           // Notify outputs that their use-cases are now attached to the Camera
           config.preparedUseCases.forEach { it.notifyAttached() }
+          attachedUseCases = config.preparedUseCases
           activeSession = ActiveCameraSessionSingle(camera, this)
           applyInitialConfig(camera, connection.initialZoom, connection.initialExposureBias)
           val controller = HybridCameraController(camera)
@@ -124,6 +126,7 @@ class HybridCameraSession(
           val concurrentCamera = cameraProvider.bindToLifecycle(configs)
           // Notify all outputs that their use-cases are now attached to the Camera
           allPreparedUseCases.forEach { it.notifyAttached() }
+          attachedUseCases = allPreparedUseCases
           activeSession = ActiveCameraSessionMulti(concurrentCamera, this)
           concurrentCamera.cameras.forEachIndexed { i, camera ->
             val connection = connections[i]
@@ -153,9 +156,19 @@ class HybridCameraSession(
     Promise.async(uiScope) {
       lifecycleOwner.destroy()
       activeSession?.close()
-      cameraProvider.unbindAll()
+      unbindAll()
     }
-    DirectByteBufferPool.Shared.clear()
+    FrameBufferArena.clear()
+  }
+
+  /**
+   * Unbinds all use-cases from the Camera and notifies their outputs.
+   */
+  @UiThread
+  private fun unbindAll() {
+    cameraProvider.unbindAll()
+    attachedUseCases.forEach { it.notifyDetached() }
+    attachedUseCases = emptyList()
   }
 
   @UiThread
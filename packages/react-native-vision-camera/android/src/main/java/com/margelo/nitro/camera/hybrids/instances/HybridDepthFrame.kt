@@ -19,13 +19,18 @@ import com.margelo.nitro.camera.extensions.getPixelBuffer
 import com.margelo.nitro.camera.public.NativeFrame
 import com.margelo.nitro.core.ArrayBuffer
 import com.margelo.nitro.core.Promise
+import java.util.concurrent.atomic.AtomicReference
 
 class HybridDepthFrame(
   override val image: ImageProxy,
   override val orientation: CameraOrientation,
   override val isMirrored: Boolean,
+  onDisposed: (() -> Unit)? = null,
 ) : HybridDepthSpec(),
   NativeFrame {
+  // Called once, even if the Frame is disposed multiple times.
+  private val onDisposed = AtomicReference(onDisposed)
+
   override val timestamp: Double
     get() = image.imageInfo.timestamp.toDouble()
 
@@ -136,7 +141,9 @@ class HybridDepthFrame(
 
   override fun dispose() {
     super.dispose()
+    onDisposed.getAndSet(null)?.invoke()
     image.close()
     cachedPixelBuffer?.dispose()
+    cachedPixelBuffer = null
   }
 }
@@ -6,6 +6,7 @@ import com.margelo.nitro.camera.CameraOrientation
 import com.margelo.nitro.camera.HybridFramePlaneSpec
 import com.margelo.nitro.camera.HybridFrameSpec
 import com.margelo.nitro.camera.NativeBuffer
+import com.margelo.nitro.camera.PixelBufferPlaneLayout
 import com.margelo.nitro.camera.PixelFormat
 import com.margelo.nitro.camera.Point
 import com.margelo.nitro.camera.extensions.DisposableArrayBuffer
@@ -18,13 +19,18 @@ import com.margelo.nitro.camera.extensions.mapToArray
 import com.margelo.nitro.camera.extensions.pixelFormat
 import com.margelo.nitro.camera.public.NativeFrame
 import com.margelo.nitro.core.ArrayBuffer
+import java.util.concurrent.atomic.AtomicReference
 
 class HybridFrame(
   override val image: ImageProxy,
   override val orientation: CameraOrientation,
   override val isMirrored: Boolean,
+  onDisposed: (() -> Unit)? = null,
 ) : HybridFrameSpec(),
   NativeFrame {
+  // Called once, even if the Frame is disposed multiple times.
+  private val onDisposed = AtomicReference(onDisposed)
+
   override val timestamp: Double
     get() = image.imageInfo.timestamp.toDouble()
   override val isValid: Boolean
@@ -66,8 +72,10 @@ class HybridFrame(
 
   override fun dispose() {
     super.dispose()
+    onDisposed.getAndSet(null)?.invoke()
     planesCached?.forEach { it.dispose() }
     cachedPixelBuffer?.dispose()
+    cachedPixelBuffer = null
     image.close()
   }
 
@@ -89,14 +97,23 @@ class HybridFrame(
 
   private var cachedPixelBuffer: DisposableArrayBuffer? = null
 
-  override fun getPixelBuffer(): ArrayBuffer {
+  private fun getCachedPixelBuffer(): DisposableArrayBuffer {
     cachedPixelBuffer?.let {
       // We already have it cached
-      return it.arrayBuffer
+      return it
     }
     val pixelBuffer = image.getPixelBuffer()
     cachedPixelBuffer = pixelBuffer
-    return pixelBuffer.arrayBuffer
+    return pixelBuffer
+  }
+
+  override fun getPixelBuffer(): ArrayBuffer {
+    return getCachedPixelBuffer().arrayBuffer
+  }
+
+  override fun getPixelBufferLayout(): Array<PixelBufferPlaneLayout> {
+    // The layout depends on how the planes were packed, so this resolves the pixel buffer too.
+    return getCachedPixelBuffer().layout
   }
 
   override fun convertCameraPointToFramePoint(cameraPoint: Point): Point {
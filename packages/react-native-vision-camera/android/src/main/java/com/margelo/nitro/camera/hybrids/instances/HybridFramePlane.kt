@@ -3,9 +3,9 @@ package com.margelo.nitro.camera.hybrids.instances
 import androidx.camera.core.ImageProxy
 import com.margelo.nitro.camera.HybridFramePlaneSpec
 import com.margelo.nitro.camera.extensions.readableBytes
-import com.margelo.nitro.camera.utils.DirectByteBufferPool
+import com.margelo.nitro.camera.utils.FrameBufferArena
+import com.margelo.nitro.camera.utils.FrameBufferLease
 import com.margelo.nitro.core.ArrayBuffer
-import java.nio.ByteBuffer
 
 class HybridFramePlane(
   val plane: ImageProxy.PlaneProxy,
@@ -29,35 +29,34 @@ class HybridFramePlane(
   private val bytesCount: Int
     get() = plane.buffer.capacity()
 
-  private var cachedBuffer: ByteBuffer? = null
-  private val buffer: ByteBuffer
+  private var cachedCopy: FrameBufferLease? = null
+  private val copy: FrameBufferLease
     get() {
-      if (plane.buffer.isDirect) {
-        return plane.buffer.readableBytes()
-      } else {
-        cachedBuffer?.let {
-          // We already have it cached
-          return it
-        }
-        val source = plane.buffer.readableBytes()
-        val copy = DirectByteBufferPool.Shared.acquire(source.remaining())
-        copy.put(source)
-        cachedBuffer = copy
-        return copy
+      cachedCopy?.let {
+        // We already have it cached
+        return it
       }
+      val source = plane.buffer.readableBytes()
+      val lease = FrameBufferArena.acquire(source.remaining())
+      lease.byteBuffer.put(source)
+      cachedCopy = lease
+      return lease
     }
 
   override val memorySize: Long
     get() = plane.buffer.capacity().toLong()
 
   override fun getPixelBuffer(): ArrayBuffer {
-    return ArrayBuffer.wrap(buffer)
+    if (plane.buffer.isDirect) {
+      return ArrayBuffer.wrap(plane.buffer.readableBytes())
+    }
+    // The ArrayBuffer shares the copy, so it stays valid even after this plane is disposed.
+    return copy.toArrayBuffer()
   }
 
   override fun dispose() {
     super.dispose()
-    cachedBuffer?.let {
-      DirectByteBufferPool.Shared.release(it)
-    }
+    cachedCopy?.dispose()
+    cachedCopy = null
   }
 }
@@ -73,6 +73,7 @@ class HybridPhoto(
     super.dispose()
     image.close()
     cachedPixelBuffer?.dispose()
+    cachedPixelBuffer = null
   }
 
   private var cachedPixelBuffer: DisposableArrayBuffer? = null
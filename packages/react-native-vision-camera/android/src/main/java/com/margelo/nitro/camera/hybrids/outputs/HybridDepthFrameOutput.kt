@@ -6,6 +6,7 @@ import androidx.camera.core.resolutionselector.ResolutionSelector
 import com.margelo.nitro.camera.CameraOrientation
 import com.margelo.nitro.camera.DepthFrameOutputOptions
 import com.margelo.nitro.camera.FrameDroppedReason
+import com.margelo.nitro.camera.FrameOutputStatistics
 import com.margelo.nitro.camera.HybridCameraDepthFrameOutputSpec
 import com.margelo.nitro.camera.HybridDepthSpec
 import com.margelo.nitro.camera.HybridNativeThreadSpec
@@ -21,6 +22,7 @@ import com.margelo.nitro.camera.hybrids.HybridNativeThread
 import com.margelo.nitro.camera.hybrids.instances.HybridDepthFrame
 import com.margelo.nitro.camera.public.NativeCameraOutput
 import com.margelo.nitro.camera.utils.DepthImageReaderProxy
+import com.margelo.nitro.camera.utils.FrameOutputTelemetry
 import com.margelo.nitro.camera.utils.IdentifiableExecutor
 
 @SuppressLint("RestrictedApi")
@@ -29,6 +31,7 @@ class HybridDepthFrameOutput(
 ) : HybridCameraDepthFrameOutputSpec(),
   NativeCameraOutput {
   private val executor = IdentifiableExecutor("com.margelo.camera.depth")
+  private val telemetry = FrameOutputTelemetry("com.margelo.camera.depth")
 
   override val mediaType: MediaType = MediaType.DEPTH
   override val thread: HybridNativeThreadSpec by lazy { HybridNativeThread(executor) }
@@ -100,8 +103,9 @@ class HybridDepthFrameOutput(
         // target orientation.
         val orientation = image.orientation
         val isMirrored = mirrorMode == MirrorMode.ON
-        val frame = HybridDepthFrame(image, orientation, isMirrored)
-        onDepthFrame(frame)
+        telemetry.onFrameArrived(image.imageInfo.timestamp)
+        val frame = HybridDepthFrame(image, orientation, isMirrored, telemetry::onFrameDisposed)
+        telemetry.measureCallback { onDepthFrame(frame) }
       }
     } else {
       imageAnalysis.clearAnalyzer()
@@ -114,7 +118,12 @@ class HybridDepthFrameOutput(
   }
 
   override fun setOnDepthFrameDroppedCallback(onDepthFrameDropped: ((FrameDroppedReason) -> Unit)?) {
-    // TODO: CameraX does not have a way to figure out if a Frame has been dropped or not.
+    // CameraX does not report dropped Frames, so the telemetry infers them from timestamp gaps.
+    telemetry.onFrameDropped = onDepthFrameDropped
+  }
+
+  override fun getStatistics(): FrameOutputStatistics {
+    return telemetry.getStatistics()
   }
 
   override fun dispose() {
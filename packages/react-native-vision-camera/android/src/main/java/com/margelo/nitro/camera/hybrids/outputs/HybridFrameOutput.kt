@@ -1,10 +1,12 @@
 package com.margelo.nitro.camera.hybrids.outputs
 
 import androidx.camera.core.ImageAnalysis
+import androidx.camera.core.ImageProxy
 import androidx.camera.core.resolutionselector.ResolutionSelector
 import com.margelo.nitro.camera.CameraOrientation
 import com.margelo.nitro.camera.FrameDroppedReason
 import com.margelo.nitro.camera.FrameOutputOptions
+import com.margelo.nitro.camera.FrameOutputStatistics
 import com.margelo.nitro.camera.HybridCameraFrameOutputSpec
 import com.margelo.nitro.camera.HybridFrameSpec
 import com.margelo.nitro.camera.HybridNativeThreadSpec
@@ -20,16 +22,64 @@ import com.margelo.nitro.camera.extensions.surfaceRotation
 import com.margelo.nitro.camera.hybrids.HybridNativeThread
 import com.margelo.nitro.camera.hybrids.instances.HybridFrame
 import com.margelo.nitro.camera.public.NativeCameraOutput
+import com.margelo.nitro.camera.utils.FrameOutputTelemetry
+import com.margelo.nitro.camera.utils.FrameSequencer
 import com.margelo.nitro.camera.utils.IdentifiableExecutor
+import java.util.concurrent.RejectedExecutionException
 
 class HybridFrameOutput(
   private val options: FrameOutputOptions,
 ) : HybridCameraFrameOutputSpec(),
   NativeCameraOutput {
-  private val executor = IdentifiableExecutor("com.margelo.camera.frame")
+  /**
+   * A thread that runs a Frame Callback, one per `parallelism`.
+   */
+  private class Worker(
+    val executor: IdentifiableExecutor,
+  ) {
+    @Volatile
+    var onFrame: ((HybridFrameSpec) -> Boolean)? = null
+
+    // Guarded by `workersLock`.
+    var isBusy = false
+  }
+
+  private val parallelism = (options.parallelism ?: 1.0).toInt().coerceAtLeast(1)
+  private val workers =
+    List(parallelism) { index ->
+      val name = if (index == 0) "com.margelo.camera.frame" else "com.margelo.camera.frame.$index"
+      Worker(IdentifiableExecutor(name))
+    }
+
+  // With a single worker, Frames are delivered directly on its thread.
+  // Otherwise, a separate thread hands each Frame to an idle worker.
+  private val analyzerExecutor =
+    if (parallelism > 1) IdentifiableExecutor("com.margelo.camera.frame.dispatch") else workers[0].executor
+  private val workersLock = Any()
+
+  // Guarded by `workersLock`.
+  private val queuedImages = ArrayDeque<ImageProxy>()
+
+  // Guarded by `workersLock`. CameraX delivers Images on the [analyzerExecutor] while attached.
+  private var isAttached = false
+
+  // Guarded by `workersLock`.
+  private var isDisposed = false
+
+  // Drops are only inferred from timestamp gaps if the Frames were dropped by CameraX.
+  private val telemetry =
+    FrameOutputTelemetry(
+      "com.margelo.camera.frame",
+      infersDroppedFrames = parallelism == 1 || !options.dropFramesWhileBusy,
+    )
+  private val sequencer = FrameSequencer()
 
   override val mediaType: MediaType = MediaType.VIDEO
-  override val thread: HybridNativeThreadSpec by lazy { HybridNativeThread(executor) }
+  override val threads: Array<HybridNativeThreadSpec> by lazy {
+    workers.map { HybridNativeThread(it.executor) }.toTypedArray()
+  }
+  override val thread: HybridNativeThreadSpec
+    get() = threads[0]
   override var outputOrientation: CameraOrientation = CameraOrientation.UP
     set(value) {
       field = value
@@ -44,11 +94,6 @@ class HybridFrameOutput(
       field = value
       updateAnalyzer()
     }
-  private var onFrame: ((HybridFrameSpec) -> Boolean)? = null
-    set(value) {
-      field = value
-      updateAnalyzer()
-    }
 
   override fun createUseCase(
     mirrorMode: MirrorMode,
@@ -71,8 +116,16 @@ class HybridFrameOutput(
           setResolutionSelector(resolutionSelector)
 
           // Configuration
-          setAllowDroppingLateFrames(options.dropFramesWhileBusy)
-          setBackgroundExecutor(executor)
+          if (parallelism > 1) {
+            // Every busy worker holds on to its Image, so CameraX must not wait for one
+            // Image to be closed before delivering the next. The queue depth bounds how
+            // many Images can be in flight (or queued up) before the Camera stalls.
+            setBackpressureStrategy(ImageAnalysis.STRATEGY_BLOCK_PRODUCER)
+            setImageQueueDepth(if (options.dropFramesWhileBusy) parallelism + 1 else parallelism * 2)
+          } else {
+            setAllowDroppingLateFrames(options.dropFramesWhileBusy)
+          }
+          setBackgroundExecutor(analyzerExecutor)
 
           // Set current CameraOrientation
           setTargetRotation(outputOrientation.surfaceRotation)
@@ -100,47 +153,165 @@ class HybridFrameOutput(
           }
         }.build()
 
-    return NativeCameraOutput.PreparedUseCase(imageAnalysis) {
-      this.imageAnalysis = imageAnalysis
-      this.mirrorMode = mirrorMode
-    }
+    return NativeCameraOutput.PreparedUseCase(
+      imageAnalysis,
+      onAttached = {
+        synchronized(workersLock) { isAttached = true }
+        this.imageAnalysis = imageAnalysis
+        this.mirrorMode = mirrorMode
+      },
+      onDetached = {
+        val shouldShutDown =
+          synchronized(workersLock) {
+            isAttached = false
+            isDisposed
+          }
+        if (shouldShutDown) analyzerExecutor.shutdown()
+      },
+    )
   }
 
   /**
-   * Sets or removes the ImageAnalyzer, depending on `onFrame`.
+   * Sets or removes the ImageAnalyzer, depending on whether any worker has an `onFrame` callback.
    */
   private fun updateAnalyzer() {
     val imageAnalysis = imageAnalysis ?: return
-    val onFrame = onFrame
-
-    if (onFrame != null) {
-      imageAnalysis.setAnalyzer(executor) { image ->
-        // This represents the Image's orientation relative to the
-        // Frame Output. If `enablePhysicalBufferRotation` is true,
-        // it will always be `UP` - otherwise it will be whatever
-        // sensor orientation the Hardware uses, relative to current
-        // target orientation.
-        val orientation = image.orientation
-        val isMirrored = mirrorMode == MirrorMode.ON
-        val frame = HybridFrame(image, orientation, isMirrored)
-        onFrame(frame)
+
+    if (workers.any { it.onFrame != null }) {
+      imageAnalysis.setAnalyzer(analyzerExecutor) { image ->
+        if (parallelism > 1) {
+          dispatch(image)
+        } else {
+          accept(image)
+          deliver(workers[0], image)
+        }
       }
     } else {
       imageAnalysis.clearAnalyzer()
     }
   }
 
+  /**
+   * Records an Image that will be delivered to a Frame Callback.
+   * Runs on the [analyzerExecutor], so Images are recorded in capture order.
+   */
+  private fun accept(image: ImageProxy) {
+    telemetry.onFrameArrived(image.imageInfo.timestamp)
+    sequencer.onFrameDelivered(image.imageInfo.timestamp.toDouble())
+  }
+
+  /**
+   * Hands the given Image to an idle worker, or queues/drops it if all workers are busy.
+   * Runs on the [analyzerExecutor], so Images are dispatched in capture order.
+   */
+  private fun dispatch(image: ImageProxy) {
+    val worker =
+      synchronized(workersLock) {
+        val worker = workers.firstOrNull { !it.isBusy && it.onFrame != null }
+        if (worker != null) {
+          worker.isBusy = true
+        } else if (!options.dropFramesWhileBusy) {
+          // The next worker that finishes picks it up.
+          accept(image)
+          queuedImages.addLast(image)
+          return
+        }
+        worker
+      }
+    if (worker == null) {
+      image.close()
+      telemetry.onDropped(FrameDroppedReason.FRAME_WAS_LATE)
+      return
+    }
+
+    accept(image)
+    try {
+      worker.executor.execute {
+        var nextImage: ImageProxy? = image
+        while (nextImage != null) {
+          deliver(worker, nextImage)
+          nextImage =
+            synchronized(workersLock) {
+              val queuedImage = queuedImages.removeFirstOrNull()
+              if (queuedImage == null) worker.isBusy = false
+              queuedImage
+            }
+        }
+      }
+    } catch (e: RejectedExecutionException) {
+      // The Frame Output was disposed, so its workers no longer accept Images.
+      synchronized(workersLock) { worker.isBusy = false }
+      discard(image)
+    }
+  }
+
+  /**
+   * Calls the worker's Frame Callback with the given Image. Runs on the worker's thread.
+   */
+  private fun deliver(
+    worker: Worker,
+    image: ImageProxy,
+  ) {
+    val onFrame = worker.onFrame
+    if (onFrame == null) {
+      // The callback was removed while the Image was queued.
+      discard(image)
+      return
+    }
+    // This represents the Image's orientation relative to the
+    // Frame Output. If `enablePhysicalBufferRotation` is true,
+    // it will always be `UP` - otherwise it will be whatever
+    // sensor orientation the Hardware uses, relative to current
+    // target orientation.
+    val orientation = image.orientation
+    val isMirrored = mirrorMode == MirrorMode.ON
+    val frame = HybridFrame(image, orientation, isMirrored, telemetry::onFrameDisposed)
+    telemetry.measureCallback { onFrame(frame) }
+  }
+
+  /**
+   * Closes an accepted Image without delivering it. No result will arrive for it.
+   */
+  private fun discard(image: ImageProxy) {
+    sequencer.markCompleted(image.imageInfo.timestamp.toDouble())
+    image.close()
+    telemetry.onFrameDisposed()
+  }
+
   override fun setOnFrameCallback(onFrame: ((HybridFrameSpec) -> Boolean)?) {
-    require(executor.isRunningOnExecutor) { "setOnFrameCallback(...) must be called on the DepthFrameOutput's `thread`!" }
-    this.onFrame = onFrame
+    val worker = workers.firstOrNull { it.executor.isRunningOnExecutor }
+    requireNotNull(worker) { "setOnFrameCallback(...) must be called on one of the FrameOutput's `threads`!" }
+    worker.onFrame = onFrame
+    updateAnalyzer()
   }
 
   override fun setOnFrameDroppedCallback(onFrameDropped: ((FrameDroppedReason) -> Unit)?) {
-    // TODO: CameraX does not have a way to figure out if a Frame has been dropped or not.
+    // CameraX does not report dropped Frames, so the telemetry infers them from timestamp gaps.
+    telemetry.onFrameDropped = onFrameDropped
+  }
+
+  override fun getStatistics(): FrameOutputStatistics {
+    return telemetry.getStatistics()
+  }
+
+  override fun markFrameCompleted(timestamp: Double): Double {
+    return sequencer.markCompleted(timestamp)
   }
 
   override fun dispose() {
     super.dispose()
     imageAnalysis?.clearAnalyzer()
+    val isAnalyzerExecutorInUse =
+      synchronized(workersLock) {
+        isDisposed = true
+        queuedImages.forEach { discard(it) }
+        queuedImages.clear()
+        isAttached
+      }
+    // Frames that are already being processed still finish, after that the threads exit.
+    workers.forEach { if (it.executor !== analyzerExecutor) it.executor.shutdown() }
+    // CameraX keeps posting to its background executor until the use-case is unbound,
+    // so while attached, the analyzer executor is only shut down once it is detached.
+    if (!isAnalyzerExecutorInUse) analyzerExecutor.shutdown()
   }
 }
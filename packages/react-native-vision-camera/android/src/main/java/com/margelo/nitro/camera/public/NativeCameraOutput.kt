@@ -30,13 +30,18 @@ interface NativeCameraOutput {
    * After the [UseCase] has been bound to the Camera via
    * `bindToLifecycle(...)`, call [notifyAttached] to let the
    * output know it can start using the live [UseCase].
+   * Once it has been unbound again, call [notifyDetached].
    */
   class PreparedUseCase(
     val useCase: UseCase,
     private val onAttached: () -> Unit,
+    private val onDetached: () -> Unit = {},
   ) {
     /** Notify the output that this [UseCase] has been attached to the Camera. */
     fun notifyAttached() = onAttached()
+
+    /** Notify the output that this [UseCase] has been unbound from the Camera. */
+    fun notifyDetached() = onDetached()
   }
 
   /**
@@ -0,0 +1,62 @@
+package com.margelo.nitro.camera.utils
+
+import java.nio.ByteBuffer
+
+/**
+ * A process-wide arena of native memory for CPU copies of Frames.
+ *
+ * Buffers are rounded up to size classes (at most 25% larger than
+ * requested), so Frames of different but similar sizes share memory,
+ * and retained memory is trimmed to the recent peak demand of each
+ * size class.
+ *
+ * Unlike [ByteBuffer.allocateDirect], acquired buffers are not
+ * zero-filled. Each one is held by a [FrameBufferLease], which
+ * should be disposed as soon as its Frame is.
+ */
+class FrameBufferArena {
+  data class Stats(
+    /** How many acquisitions reused a retained buffer. */
+    val hits: Long,
+    /** How many acquisitions had to allocate a new buffer. */
+    val misses: Long,
+    /** The size of all currently acquired buffers' blocks, in bytes. */
+    val bytesInUse: Long,
+    /** The size of all blocks retained for reuse, in bytes. */
+    val bytesRetained: Long,
+    /** The highest [bytesInUse] ever observed, in bytes. */
+    val peakBytesInUse: Long,
+  )
+
+  @Suppress("KotlinJniMissingFunction")
+  companion object {
+    /**
+     * Acquires a block of at least [size] bytes. Its contents are uninitialized.
+     */
+    @JvmStatic
+    external fun acquire(size: Int): FrameBufferLease
+
+    /**
+     * Frees retained memory that exceeds the recent peak demand.
+     * This also runs automatically every few seconds while buffers are released.
+     */
+    @JvmStatic
+    external fun trim()
+
+    /**
+     * Frees all retained memory that is not acquired right now,
+     * including the buffers cached by other threads.
+     */
+    @JvmStatic
+    external fun clear()
+
+    @JvmStatic
+    private external fun getStatsNative(): LongArray
+
+    val stats: Stats
+      get() {
+        val values = getStatsNative()
+        return Stats(values[0], values[1], values[2], values[3], values[4])
+      }
+  }
+}
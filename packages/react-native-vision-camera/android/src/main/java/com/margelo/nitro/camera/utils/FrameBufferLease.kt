@@ -0,0 +1,47 @@
+package com.margelo.nitro.camera.utils
+
+import androidx.annotation.Keep
+import com.facebook.jni.HybridData
+import com.facebook.proguard.annotations.DoNotStrip
+import com.margelo.nitro.core.ArrayBuffer
+import java.nio.ByteBuffer
+
+/**
+ * A block of native memory acquired from the [FrameBufferArena].
+ *
+ * The block goes back to the arena once this lease is disposed
+ * (or garbage-collected) and every [ArrayBuffer] created via
+ * [toArrayBuffer] has been garbage-collected, so JS can never
+ * observe a block that was already reused or freed.
+ */
+@DoNotStrip
+@Keep
+@Suppress("KotlinJniMissingFunction")
+class FrameBufferLease private constructor(
+  @DoNotStrip
+  @Keep
+  private val mHybridData: HybridData,
+) {
+  /**
+   * A direct [ByteBuffer] with a capacity of exactly the requested
+   * size, to fill the block. Its contents are uninitialized, and it
+   * must not be used after [dispose].
+   */
+  val byteBuffer: ByteBuffer
+    get() = getByteBuffer()
+
+  /**
+   * Wraps the block in an [ArrayBuffer] that keeps it alive
+   * until the [ArrayBuffer] is garbage-collected.
+   */
+  external fun toArrayBuffer(): ArrayBuffer
+
+  /**
+   * Gives up this lease's hold on the block. Calling this more than once has no effect.
+   */
+  fun dispose() {
+    mHybridData.resetNative()
+  }
+
+  private external fun getByteBuffer(): ByteBuffer
+}
@@ -0,0 +1,219 @@
+package com.margelo.nitro.camera.utils
+
+import android.os.Build
+import android.os.SystemClock
+import android.os.Trace
+import com.margelo.nitro.camera.FrameDropStatistics
+import com.margelo.nitro.camera.FrameDroppedReason
+import com.margelo.nitro.camera.FrameDurationStatistics
+import com.margelo.nitro.camera.FrameOutputStatistics
+import java.util.concurrent.atomic.AtomicLong
+import java.util.concurrent.atomic.AtomicLongArray
+import kotlin.math.ceil
+import kotlin.math.roundToLong
+import kotlin.math.sqrt
+
+/**
+ * Collects runtime statistics of a Frame Output's pipeline, which
+ * are exposed to JS via `getStatistics()`.
+ *
+ * Frames are recorded on the output's executor, while statistics
+ * can be read from any thread - all samples are kept in lock-free
+ * ring buffers, so recording never blocks the Camera pipeline.
+ *
+ * CameraX does not report dropped Frames, so drops are inferred from
+ * gaps between consecutive Frame timestamps: if a gap spans multiple
+ * Frame intervals right after a Frame Callback took longer than one
+ * interval, the Frames in between were dropped because the analyzer
+ * was busy ([FrameDroppedReason.FRAME_WAS_LATE]). Outputs that drop
+ * Frames themselves report them via [onDropped] and disable this
+ * with [infersDroppedFrames].
+ *
+ * If a system trace is being recorded, Frame Callbacks show up as
+ * trace sections named [traceName].
+ */
+class FrameOutputTelemetry(
+  private val traceName: String,
+  private val infersDroppedFrames: Boolean = true,
+) {
+  companion object {
+    private const val WINDOW_SIZE = 120
+    // A gap is only considered a drop if it is this much longer than the expected interval.
+    private const val GAP_THRESHOLD = 1.5
+    // Longer gaps are a stream restart (e.g. the session was stopped), not dropped Frames.
+    private const val MAX_GAP_NS = 1_000_000_000L
+  }
+
+  /**
+   * A lock-free ring buffer of the most recent [WINDOW_SIZE] durations, in nanoseconds.
+   */
+  private class DurationRing {
+    private val samples = AtomicLongArray(WINDOW_SIZE)
+    private val writeIndex = AtomicLong(0)
+
+    fun record(durationNs: Long) {
+      val index = writeIndex.getAndIncrement()
+      samples.set((index % WINDOW_SIZE).toInt(), durationNs)
+    }
+
+    fun getStatistics(): FrameDurationStatistics {
+      val count = writeIndex.get().coerceAtMost(WINDOW_SIZE.toLong()).toInt()
+      if (count == 0) {
+        return FrameDurationStatistics(0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0)
+      }
+      val sorted = DoubleArray(count) { samples.get(it) / 1_000_000.0 }
+      sorted.sort()
+      val average = sorted.average()
+      val variance = sorted.sumOf { (it - average) * (it - average) } / count
+      fun percentile(p: Double): Double = sorted[(ceil(p * count).toInt() - 1).coerceIn(0, count - 1)]
+      return FrameDurationStatistics(
+        sampleCount = count.toDouble(),
+        average = average,
+        standardDeviation = sqrt(variance),
+        minimum = sorted.first(),
+        median = percentile(0.5),
+        p90 = percentile(0.9),
+        p99 = percentile(0.99),
+        maximum = sorted.last(),
+      )
+    }
+  }
+
+  private val deliveryLatency = DurationRing()
+  private val callbackDuration = DurationRing()
+  private val frameInterval = DurationRing()
+  private val framesDelivered = AtomicLong(0)
+  private val framesInFlight = AtomicLong(0)
+  private val droppedFrames = AtomicLongArray(FrameDroppedReason.entries.size)
+
+  // Only accessed on the output's executor.
+  private var lastTimestampNs = -1L
+  private var expectedIntervalNs = 0L
+
+  // Written by whichever thread ran the last Frame Callback.
+  @Volatile
+  private var lastCallbackDurationNs = 0L
+
+  @Volatile
+  var onFrameDropped: ((FrameDroppedReason) -> Unit)? = null
+
+  private val isTracing: Boolean
+    get() = Build.VERSION.SDK_INT >= Build.VERSION_CODES.Q && Trace.isEnabled()
+
+  /**
+   * Records a Frame with the given sensor timestamp (in nanoseconds)
+   * that is about to be delivered to the Frame Callback, and reports
+   * Frames that were dropped before it.
+   * Must be called in capture order, on the output's executor.
+   */
+  fun onFrameArrived(sensorTimestampNs: Long) {
+    framesDelivered.incrementAndGet()
+    val inFlight = framesInFlight.incrementAndGet()
+    if (isTracing) {
+      Trace.setCounter("$traceName in flight", inFlight)
+    }
+
+    // Sensor timestamps are either in the `elapsedRealtime` or in the
+    // `uptime` time base, depending on the device. `elapsedRealtime`
+    // also counts deep sleep, so the smallest non-negative latency is
+    // the one in the right time base.
+    val realtimeLatencyNs = SystemClock.elapsedRealtimeNanos() - sensorTimestampNs
+    val uptimeLatencyNs = System.nanoTime() - sensorTimestampNs
+    val latencyNs =
+      when {
+        uptimeLatencyNs < 0 -> realtimeLatencyNs
+        realtimeLatencyNs < 0 -> uptimeLatencyNs
+        else -> minOf(realtimeLatencyNs, uptimeLatencyNs)
+      }
+    if (latencyNs >= 0) {
+      deliveryLatency.record(latencyNs)
+    }
+
+    val lastTimestampNs = this.lastTimestampNs
+    this.lastTimestampNs = sensorTimestampNs
+    if (lastTimestampNs < 0) return
+    val intervalNs = sensorTimestampNs - lastTimestampNs
+    if (intervalNs <= 0 || intervalNs > MAX_GAP_NS) {
+      // The stream restarted, so the previous interval no longer applies.
+      expectedIntervalNs = 0
+      return
+    }
+    frameInterval.record(intervalNs)
+    if (!infersDroppedFrames) return
+
+    val expectedIntervalNs = this.expectedIntervalNs
+    if (expectedIntervalNs == 0L) {
+      this.expectedIntervalNs = intervalNs
+      return
+    }
+    if (intervalNs > expectedIntervalNs * GAP_THRESHOLD && lastCallbackDurationNs > expectedIntervalNs) {
+      // The analyzer was still busy with the previous Frame, so the Frames in between were dropped.
+      val dropped = (intervalNs.toDouble() / expectedIntervalNs).roundToLong() - 1
+      repeat(dropped.toInt()) { onDropped(FrameDroppedReason.FRAME_WAS_LATE) }
+    } else if (intervalNs > expectedIntervalNs * GAP_THRESHOLD) {
+      // The analyzer was idle, so the Camera itself slowed down (e.g. in low light).
+      this.expectedIntervalNs = intervalNs
+    } else {
+      // Smooth out jitter with an exponential moving average.
+      this.expectedIntervalNs = expectedIntervalNs + (intervalNs - expectedIntervalNs) / 8
+    }
+  }
+
+  /**
+   * Runs the given Frame Callback, measures its duration and wraps
+   * it in a trace section.
+   */
+  fun <T> measureCallback(callback: () -> T): T {
+    val isTracing = isTracing
+    if (isTracing) {
+      Trace.beginSection(traceName)
+    }
+    val startNs = System.nanoTime()
+    try {
+      return callback()
+    } finally {
+      lastCallbackDurationNs = System.nanoTime() - startNs
+      callbackDuration.record(lastCallbackDurationNs)
+      if (isTracing) {
+        Trace.endSection()
+      }
+    }
+  }
+
+  /**
+   * Records that a delivered Frame has been disposed.
+   */
+  fun onFrameDisposed() {
+    val inFlight = framesInFlight.decrementAndGet()
+    if (isTracing) {
+      Trace.setCounter("$traceName in flight", inFlight)
+    }
+  }
+
+  /**
+   * Records a Frame that was dropped before it reached the Frame Callback.
+   */
+  fun onDropped(reason: FrameDroppedReason) {
+    droppedFrames.incrementAndGet(reason.ordinal)
+    onFrameDropped?.invoke(reason)
+  }
+
+  fun getStatistics(): FrameOutputStatistics {
+    val dropped =
+      FrameDropStatistics(
+        frameWasLate = droppedFrames.get(FrameDroppedReason.FRAME_WAS_LATE.ordinal).toDouble(),
+        outOfBuffers = droppedFrames.get(FrameDroppedReason.OUT_OF_BUFFERS.ordinal).toDouble(),
+        discontinuity = droppedFrames.get(FrameDroppedReason.DISCONTINUITY.ordinal).toDouble(),
+        unknown = droppedFrames.get(FrameDroppedReason.UNKNOWN.ordinal).toDouble(),
+      )
+    return FrameOutputStatistics(
+      framesDelivered = framesDelivered.get().toDouble(),
+      framesDropped = dropped.frameWasLate + dropped.outOfBuffers + dropped.discontinuity + dropped.unknown,
+      framesInFlight = framesInFlight.get().toDouble(),
+      droppedFrames = dropped,
+      deliveryLatency = deliveryLatency.getStatistics(),
+      callbackDuration = callbackDuration.getStatistics(),
+      frameInterval = frameInterval.getStatistics(),
+    )
+  }
+}
@@ -0,0 +1,58 @@
+package com.margelo.nitro.camera.utils
+
+/**
+ * Keeps track of the order in which Frames were delivered to Frame
+ * Callbacks, so that their results can be released in capture order
+ * even if they complete out of order (e.g. when processed in parallel).
+ *
+ * Frames are registered in capture order via [onFrameDelivered], and
+ * marked via [markCompleted] once their result has been received.
+ * Both are keyed by the Frame's `timestamp`, as seen by JS.
+ */
+class FrameSequencer {
+  companion object {
+    // If a result never arrives, later results are released once it is this many Frames behind.
+    private const val MAX_PENDING_FRAMES = 64
+  }
+
+  private class PendingFrame(
+    val timestamp: Double,
+  ) {
+    var isCompleted = false
+  }
+
+  private val pendingFrames = ArrayDeque<PendingFrame>()
+
+  /**
+   * Registers a Frame that is about to be delivered to a Frame Callback.
+   * Must be called in capture order.
+   */
+  @Synchronized
+  fun onFrameDelivered(timestamp: Double) {
+    pendingFrames.addLast(PendingFrame(timestamp))
+    if (pendingFrames.size > MAX_PENDING_FRAMES) {
+      pendingFrames.removeFirst()
+    }
+  }
+
+  /**
+   * Marks the Frame with the given [timestamp] as completed, and returns
+   * the latest timestamp up to which all delivered Frames have completed,
+   * or `-1` if an earlier Frame is still pending.
+   */
+  @Synchronized
+  fun markCompleted(timestamp: Double): Double {
+    val pendingFrame = pendingFrames.firstOrNull { it.timestamp == timestamp }
+    pendingFrame?.isCompleted = true
+
+    var releaseUpTo = -1.0
+    while (pendingFrames.firstOrNull()?.isCompleted == true) {
+      releaseUpTo = pendingFrames.removeFirst().timestamp
+    }
+    if (pendingFrame == null && timestamp < (pendingFrames.firstOrNull()?.timestamp ?: Double.MAX_VALUE)) {
+      // The Frame was not tracked (anymore), but nothing before it is pending - release it.
+      releaseUpTo = maxOf(releaseUpTo, timestamp)
+    }
+    return releaseUpTo
+  }
+}
@@ -21,4 +21,12 @@ class IdentifiableExecutor(
 
   val isRunningOnExecutor: Boolean
     get() = Thread.currentThread() == threadRef.get()
+
+  /**
+   * Lets already submitted work finish, then stops the thread.
+   * Work submitted afterwards is rejected.
+   */
+  fun shutdown() {
+    executor.shutdown()
+  }
 }
@@ -0,0 +1,72 @@
+package com.margelo.nitro.camera.utils
+
+import java.nio.ByteBuffer
+
+class YuvPlanePacker {
+  @Suppress("KotlinJniMissingFunction")
+  companion object {
+    /**
+     * Wraps the Y, U and V planes of an 8-bit YUV 4:2:0 Image in one
+     * direct [ByteBuffer] without copying, if the U and V planes
+     * alias one interleaved UV plane (NV12 or NV21) that directly
+     * follows the Y plane in memory, and the Y plane's buffer reaches
+     * up to the start of the UV plane.
+     *
+     * Returns `null` if the planes cannot be wrapped as one buffer.
+     * The returned buffer is only valid as long as the Image is open.
+     */
+    @JvmStatic
+    external fun wrapSemiPlanar(
+      yBuffer: ByteBuffer,
+      uBuffer: ByteBuffer,
+      vBuffer: ByteBuffer,
+      yRowStride: Int,
+      uvRowStride: Int,
+      uvPixelStride: Int,
+      height: Int,
+    ): ByteBuffer?
+
+    /**
+     * Returns how many bytes after the start of [base] the
+     * start of [buffer] lies in memory. Both must be direct.
+     */
+    @JvmStatic
+    external fun getAddressOffset(
+      base: ByteBuffer,
+      buffer: ByteBuffer,
+    ): Long
+
+    /**
+     * Copies the Y, U and V planes of an 8-bit YUV 4:2:0 Image
+     * into [destination] as tightly packed I420 - the Y plane,
+     * followed by the U plane, followed by the V plane.
+     *
+     * [destination] must be a direct [ByteBuffer] of at least
+     * [getI420Size] bytes.
+     */
+    @JvmStatic
+    external fun packI420(
+      yBuffer: ByteBuffer,
+      uBuffer: ByteBuffer,
+      vBuffer: ByteBuffer,
+      yRowStride: Int,
+      uvRowStride: Int,
+      uvPixelStride: Int,
+      width: Int,
+      height: Int,
+      destination: ByteBuffer,
+    )
+
+    /**
+     * The size of a tightly packed I420 Image of the given size, in bytes.
+     */
+    fun getI420Size(
+      width: Int,
+      height: Int,
+    ): Int {
+      val chromaWidth = (width + 1) / 2
+      val chromaHeight = (height + 1) / 2
+      return width * height + chromaWidth * chromaHeight * 2
+    }
+  }
+}
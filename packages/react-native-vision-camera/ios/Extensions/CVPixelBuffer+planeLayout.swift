@@ -0,0 +1,111 @@
+///
+/// CVPixelBuffer+planeLayout.swift
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+import AVFoundation
+import Foundation
+import NitroModules
+
+extension CVPixelBuffer {
+  /**
+   * Gets where each plane lives inside the memory wrapped by `ArrayBuffer.fromPixelBuffer(_:)`.
+   * Bi-planar YUV buffers describe their interleaved CbCr plane as separate U and V planes, like on Android.
+   * Returns an empty array if the layout of this pixel format is unknown.
+   * The given `CVPixelBuffer` has to be already locked.
+   */
+  func getPlaneLayout() -> [PixelBufferPlaneLayout] {
+    guard let baseAddress = CVPixelBufferGetBaseAddress(self) else {
+      return []
+    }
+    let dataSize = CVPixelBufferGetDataSize(self)
+    let pixelFormat = CVPixelBufferGetPixelFormatType(self)
+
+    guard CVPixelBufferIsPlanar(self) else {
+      guard let bytesPerPixel = pixelFormat.bytesPerInterleavedPixel else {
+        return []
+      }
+      return [
+        PixelBufferPlaneLayout(
+          offset: 0,
+          rowStride: Double(CVPixelBufferGetBytesPerRow(self)),
+          pixelStride: Double(bytesPerPixel),
+          width: Double(CVPixelBufferGetWidth(self)),
+          height: Double(CVPixelBufferGetHeight(self)))
+      ]
+    }
+
+    guard let bytesPerSample = pixelFormat.bytesPerBiPlanarSample,
+      CVPixelBufferGetPlaneCount(self) == 2
+    else {
+      return []
+    }
+    var layout: [PixelBufferPlaneLayout] = []
+    for planeIndex in 0..<2 {
+      guard let planeAddress = CVPixelBufferGetBaseAddressOfPlane(self, planeIndex) else {
+        return []
+      }
+      // Offsets are relative to the base address, since that is where `getPixelBuffer()` starts.
+      let offset = baseAddress.distance(to: planeAddress)
+      guard offset >= 0, offset + memorySize(ofPlaneIndex: planeIndex) <= dataSize else {
+        return []
+      }
+      let rowStride = Double(CVPixelBufferGetBytesPerRowOfPlane(self, planeIndex))
+      let width = Double(CVPixelBufferGetWidthOfPlane(self, planeIndex))
+      let height = Double(CVPixelBufferGetHeightOfPlane(self, planeIndex))
+      if planeIndex == 0 {
+        layout.append(
+          PixelBufferPlaneLayout(
+            offset: Double(offset),
+            rowStride: rowStride,
+            pixelStride: Double(bytesPerSample),
+            width: width,
+            height: height))
+      } else {
+        // The CbCr plane interleaves U and V, so V starts one sample after U.
+        for component in 0..<2 {
+          layout.append(
+            PixelBufferPlaneLayout(
+              offset: Double(offset + component * bytesPerSample),
+              rowStride: rowStride,
+              pixelStride: Double(bytesPerSample * 2),
+              width: width,
+              height: height))
+        }
+      }
+    }
+    return layout
+  }
+}
+
+extension OSType {
+  /// The size of one pixel of a non-planar RGB format, in bytes.
+  fileprivate var bytesPerInterleavedPixel: Int? {
+    switch self {
+    case kCVPixelFormatType_32BGRA, kCVPixelFormatType_32RGBA, kCVPixelFormatType_32ARGB:
+      return 4
+    case kCVPixelFormatType_24RGB, kCVPixelFormatType_24BGR:
+      return 3
+    default:
+      return nil
+    }
+  }
+
+  /// The size of one Y, Cb or Cr sample of a bi-planar YUV format, in bytes.
+  fileprivate var bytesPerBiPlanarSample: Int? {
+    switch self {
+    case kCVPixelFormatType_420YpCbCr8BiPlanarVideoRange, kCVPixelFormatType_420YpCbCr8BiPlanarFullRange,
+      kCVPixelFormatType_422YpCbCr8BiPlanarVideoRange, kCVPixelFormatType_422YpCbCr8BiPlanarFullRange,
+      kCVPixelFormatType_444YpCbCr8BiPlanarVideoRange, kCVPixelFormatType_444YpCbCr8BiPlanarFullRange:
+      return 1
+    case kCVPixelFormatType_420YpCbCr10BiPlanarVideoRange, kCVPixelFormatType_420YpCbCr10BiPlanarFullRange,
+      kCVPixelFormatType_422YpCbCr10BiPlanarVideoRange, kCVPixelFormatType_422YpCbCr10BiPlanarFullRange,
+      kCVPixelFormatType_444YpCbCr10BiPlanarVideoRange, kCVPixelFormatType_444YpCbCr10BiPlanarFullRange:
+      // 10-bit samples are stored in the upper bits of 16-bit words.
+      return 2
+    default:
+      return nil
+    }
+  }
+}
@@ -13,22 +13,32 @@ final class HybridDepth: HybridDepthSpec, NativeDepth, LazyLockableBuffer {
   var depthData: AVDepthData?
   let metadata: MediaSampleMetadata
   var isLocked: Bool = false
+  private var onDisposed: (() -> Void)?
   var pixelBuffer: CVPixelBuffer? {
     return depthData?.depthDataMap
   }
 
   init(
     depthData: AVDepthData,
-    metadata: MediaSampleMetadata
+    metadata: MediaSampleMetadata,
+    onDisposed: (() -> Void)? = nil
   ) {
     self.depthData = depthData
     self.metadata = metadata
+    self.onDisposed = onDisposed
     super.init()
   }
 
+  deinit {
+    // A Depth Frame that was never disposed is released with its last reference.
+    onDisposed?()
+  }
+
   func dispose() {
     unlockBuffer()
     depthData = nil
+    onDisposed?()
+    onDisposed = nil
   }
 
   var memorySize: Int {
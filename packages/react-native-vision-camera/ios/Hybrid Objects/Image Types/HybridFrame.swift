@@ -14,20 +14,28 @@ final class HybridFrame: HybridFrameSpec, NativeFrame, LazyLockableBuffer {
   let metadata: MediaSampleMetadata
   var isLocked: Bool = false
   private var planesCached: [HybridFramePlane]?
+  private var onDisposed: (() -> Void)?
   var pixelBuffer: CVPixelBuffer? {
     return sampleBuffer?.imageBuffer
   }
 
   init(
     buffer: CMSampleBuffer,
-    metadata: MediaSampleMetadata
+    metadata: MediaSampleMetadata,
+    onDisposed: (() -> Void)? = nil
   ) {
     self.sampleBuffer = buffer
     self.metadata = metadata
     self.planesCached = nil
+    self.onDisposed = onDisposed
     super.init()
   }
 
+  deinit {
+    // A Frame that was never disposed is released with its last reference.
+    onDisposed?()
+  }
+
   var memorySize: Int {
     return pixelBuffer?.memorySize ?? 0
   }
@@ -105,6 +113,8 @@ final class HybridFrame: HybridFrameSpec, NativeFrame, LazyLockableBuffer {
     try? self.sampleBuffer?.invalidate()
     self.sampleBuffer = nil
     self.planesCached?.forEach { $0.dispose() }
+    self.onDisposed?()
+    self.onDisposed = nil
   }
 
   func getPlanes() throws -> [any HybridFramePlaneSpec] {
@@ -138,6 +148,17 @@ final class HybridFrame: HybridFrameSpec, NativeFrame, LazyLockableBuffer {
     return try ArrayBuffer.fromPixelBuffer(pixelBuffer)
   }
 
+  func getPixelBufferLayout() throws -> [PixelBufferPlaneLayout] {
+    guard isValid else {
+      throw RuntimeError.error(withMessage: "This Frame has already been disposed!")
+    }
+    guard let pixelBuffer else {
+      throw RuntimeError.error(withMessage: "This Frame does not contain a Pixel Buffer!")
+    }
+    try ensureBufferLocked()
+    return pixelBuffer.getPlaneLayout()
+  }
+
   func getNativeBuffer() throws -> NativeBuffer {
     guard let pixelBuffer else {
       throw RuntimeError.error(withMessage: "This Frame does not contain a Pixel Buffer!")
@@ -10,6 +10,8 @@ import NitroModules
 
 final class HybridCameraDepthFrameOutput: HybridCameraDepthFrameOutputSpec, NativeCameraOutput {
   private let delegate: DepthFrameDelegate
+  private let telemetry = FrameOutputTelemetry(name: "com.margelo.camera.depth")
+  private var onDepthFrameDropped: ((FrameDroppedReason) -> Void)?
   private let queue: DispatchQueue
   private let queueSpecificKey = DispatchSpecificKey<Void>()
   private let options: DepthFrameOutputOptions
@@ -56,6 +58,13 @@ final class HybridCameraDepthFrameOutput: HybridCameraDepthFrameOutputSpec, Nati
 
     // Set up our `delegate`
     output.setDelegate(delegate, callbackQueue: queue)
+    // Drops are always counted for `getStatistics()`, even without an `onDepthFrameDropped` callback
+    delegate.onDepthFrameDropped = { [weak self] avReason in
+      guard let self else { return }
+      let reason = FrameDroppedReason(reason: avReason)
+      self.telemetry.onFrameDropped(reason: reason)
+      self.onDepthFrameDropped?(reason)
+    }
     // Configure `videoSettings`
     output.alwaysDiscardsLateDepthData = options.dropFramesWhileBusy
     output.isFilteringEnabled = options.enableFiltering
@@ -117,6 +126,7 @@ final class HybridCameraDepthFrameOutput: HybridCameraDepthFrameOutputSpec, Nati
     }
     if let onDepthFrame {
       delegate.onDepthFrame = { (depth, timestamp, bufferOrientation, isBufferMirrored) in
+        self.telemetry.onFrameArrived(timestamp: timestamp)
         // Prepare Depth Frame + Metadata
         let metadata = self.getMediaSampleMetadata(
           at: timestamp,
@@ -124,9 +134,10 @@ final class HybridCameraDepthFrameOutput: HybridCameraDepthFrameOutputSpec, Nati
           isMirrored: isBufferMirrored)
         let depth = HybridDepth(
           depthData: depth,
-          metadata: metadata)
+          metadata: metadata,
+          onDisposed: self.telemetry.onFrameDisposed)
         // Call sync JS function
-        _ = onDepthFrame(depth)
+        _ = self.telemetry.measureCallback { onDepthFrame(depth) }
       }
     } else {
       delegate.onDepthFrame = nil
@@ -134,13 +145,10 @@ final class HybridCameraDepthFrameOutput: HybridCameraDepthFrameOutputSpec, Nati
   }
 
   func setOnDepthFrameDroppedCallback(onDepthFrameDropped: ((FrameDroppedReason) -> Void)?) throws {
-    if let onDepthFrameDropped {
-      delegate.onDepthFrameDropped = { avReason in
-        let reason = FrameDroppedReason(reason: avReason)
-        onDepthFrameDropped(reason)
-      }
-    } else {
-      delegate.onDepthFrameDropped = nil
-    }
+    self.onDepthFrameDropped = onDepthFrameDropped
+  }
+
+  func getStatistics() throws -> FrameOutputStatistics {
+    return telemetry.getStatistics()
   }
 }
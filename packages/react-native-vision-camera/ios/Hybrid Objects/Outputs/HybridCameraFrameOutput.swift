@@ -9,18 +9,56 @@ import Foundation
 import NitroModules
 
 final class HybridCameraFrameOutput: HybridCameraFrameOutputSpec, NativeCameraOutput {
+  /// A queue that runs a Frame Callback, one per `parallelism`.
+  private final class Worker {
+    let queue: DispatchQueue
+    let queueSpecificKey = DispatchSpecificKey<Void>()
+    // Guarded by `workersLock`.
+    var onFrame: ((any HybridFrameSpec) -> Bool)?
+    var isBusy = false
+
+    init(label: String) {
+      self.queue = DispatchQueue(
+        label: label,
+        qos: .userInteractive,
+        attributes: [],
+        autoreleaseFrequency: .inherit,
+        target: nil)
+      self.queue.setSpecific(key: queueSpecificKey, value: ())
+    }
+  }
+
+  /// A Frame that has not been delivered to a Frame Callback yet.
+  private struct PendingFrame {
+    let sampleBuffer: CMSampleBuffer
+    let timestamp: CMTime
+    let orientation: CameraOrientation
+    let isMirrored: Bool
+  }
+
   private let delegate: FrameDelegate
+  private let telemetry = FrameOutputTelemetry(name: "com.margelo.camera.frame")
+  private let sequencer = FrameSequencer()
+  private var onFrameDropped: ((FrameDroppedReason) -> Void)?
+  private let workers: [Worker]
+  private let workersLock = NSLock()
+  // Guarded by `workersLock`.
+  private var queuedFrames: [PendingFrame] = []
+  /// The queue the `delegate` is called on. With a single worker, this is the
+  /// worker's queue - otherwise it hands each Frame to an idle worker.
   private let queue: DispatchQueue
-  private let queueSpecificKey = DispatchSpecificKey<Void>()
   private var mirrorMode: MirrorMode = .auto
   private let options: FrameOutputOptions
   let mediaType: MediaType = .video
   let requiresAudioInput: Bool = false
   let requiresDepthFormat: Bool = false
   let output: AVCaptureVideoDataOutput
-  lazy var thread: any HybridNativeThreadSpec = {
-    return HybridNativeThread(queue: queue)
+  lazy var threads: [any HybridNativeThreadSpec] = {
+    return workers.map { HybridNativeThread(queue: $0.queue) }
   }()
+  var thread: any HybridNativeThreadSpec {
+    return threads[0]
+  }
   var outputOrientation: CameraOrientation = .up {
     didSet {
       guard let connection = output.connection(with: .video) else { return }
@@ -44,17 +82,48 @@ final class HybridCameraFrameOutput: HybridCameraFrameOutputSpec, NativeCameraOu
     self.output = AVCaptureVideoDataOutput()
     self.delegate = FrameDelegate()
     self.options = options
-    self.queue = DispatchQueue(
-      label: "com.margelo.camera.frame",
-      qos: .userInteractive,
-      attributes: [],
-      autoreleaseFrequency: .inherit,
-      target: nil)
-    self.queue.setSpecific(key: queueSpecificKey, value: ())
+    let parallelism = max(1, Int(exactly: (options.parallelism ?? 1).rounded(.down)) ?? 1)
+    let workers = (0..<parallelism).map { index in
+      Worker(label: index == 0 ? "com.margelo.camera.frame" : "com.margelo.camera.frame.\(index)")
+    }
+    self.workers = workers
+    if parallelism > 1 {
+      self.queue = DispatchQueue(
+        label: "com.margelo.camera.frame.dispatch",
+        qos: .userInteractive,
+        attributes: [],
+        autoreleaseFrequency: .inherit,
+        target: nil)
+    } else {
+      self.queue = workers[0].queue
+    }
     super.init()
 
     // Set up our `delegate`
     output.setSampleBufferDelegate(delegate, queue: queue)
+    delegate.onFrame = { [weak self] (sampleBuffer, timestamp, bufferOrientation, isBufferMirrored) in
+      guard let self else { return }
+      let frame = PendingFrame(
+        sampleBuffer: sampleBuffer,
+        timestamp: timestamp,
+        orientation: bufferOrientation,
+        isMirrored: isBufferMirrored)
+      if self.workers.count > 1 {
+        self.dispatch(frame)
+      } else if self.hasOnFrameCallback(self.workers[0]) {
+        self.accept(frame)
+        self.deliver(frame, on: self.workers[0])
+      }
+    }
+    // Drops are always counted for `getStatistics()`, even without an `onFrameDropped` callback
+    delegate.onFrameDropped = { [weak self] sampleBuffer in
+      guard let self else { return }
+      let reason =
+        sampleBuffer.attachments[.droppedFrameReason].map {
+          FrameDroppedReason(sampleBufferReason: $0)
+        } ?? .unknown
+      self.reportDroppedFrame(reason: reason)
+    }
     // Configure `videoSettings`
     output.videoSettings = videoSettingsForPixelFormat(options.pixelFormat)
     // If the pipeline stalls, drop frames to avoid blowing up RAM
@@ -145,40 +214,102 @@ final class HybridCameraFrameOutput: HybridCameraFrameOutputSpec, NativeCameraOu
       isMirrored: isMirrored)
   }
 
-  func setOnFrameCallback(onFrame: ((any HybridFrameSpec) -> Bool)?) throws {
-    guard DispatchQueue.getSpecific(key: self.queueSpecificKey) != nil else {
-      throw RuntimeError.error(
-        withMessage: "setOnFrameCallback(...) must be called on the FrameOutput's `thread`!")
-    }
-    if let onFrame {
-      delegate.onFrame = { (sampleBuffer, timestamp, bufferOrientation, isBufferMirrored) in
-        // Prepare Frame + Metadata
-        let metadata = self.getMediaSampleMetadata(
-          at: timestamp,
-          orientation: bufferOrientation,
-          isMirrored: isBufferMirrored)
-        let frame = HybridFrame(
-          buffer: sampleBuffer,
-          metadata: metadata)
-        // Call sync JS function
-        _ = onFrame(frame)
+  private func hasOnFrameCallback(_ worker: Worker) -> Bool {
+    workersLock.lock()
+    defer { workersLock.unlock() }
+    return worker.onFrame != nil
+  }
+
+  private func reportDroppedFrame(reason: FrameDroppedReason) {
+    telemetry.onFrameDropped(reason: reason)
+    onFrameDropped?(reason)
+  }
+
+  /// Records a Frame that will be delivered to a Frame Callback.
+  /// Runs on the delegate's `queue`, so Frames are recorded in capture order.
+  private func accept(_ frame: PendingFrame) {
+    telemetry.onFrameArrived(timestamp: frame.timestamp)
+    sequencer.onFrameDelivered(timestamp: frame.timestamp.seconds)
+  }
+
+  /// Hands the given Frame to an idle worker, or queues/drops it if all workers are busy.
+  private func dispatch(_ frame: PendingFrame) {
+    workersLock.lock()
+    guard let worker = workers.first(where: { !$0.isBusy && $0.onFrame != nil }) else {
+      if options.dropFramesWhileBusy {
+        workersLock.unlock()
+        reportDroppedFrame(reason: .frameWasLate)
+      } else {
+        // The next worker that finishes picks it up.
+        accept(frame)
+        queuedFrames.append(frame)
+        workersLock.unlock()
       }
-    } else {
-      delegate.onFrame = nil
+      return
     }
-  }
+    worker.isBusy = true
+    workersLock.unlock()
 
-  func setOnFrameDroppedCallback(onFrameDropped: ((FrameDroppedReason) -> Void)?) throws {
-    if let onFrameDropped {
-      delegate.onFrameDropped = { sampleBuffer in
-        guard let attachment = sampleBuffer.attachments[.droppedFrameReason] else {
-          return
+    accept(frame)
+    worker.queue.async {
+      var nextFrame: PendingFrame? = frame
+      while let currentFrame = nextFrame {
+        self.deliver(currentFrame, on: worker)
+        self.workersLock.lock()
+        nextFrame = self.queuedFrames.isEmpty ? nil : self.queuedFrames.removeFirst()
+        if nextFrame == nil {
+          worker.isBusy = false
         }
-        let reason = FrameDroppedReason(sampleBufferReason: attachment)
-        onFrameDropped(reason)
+        self.workersLock.unlock()
       }
-    } else {
-      delegate.onFrameDropped = nil
     }
   }
+
+  /// Calls the worker's Frame Callback with the given Frame. Runs on the worker's `queue`.
+  private func deliver(_ pendingFrame: PendingFrame, on worker: Worker) {
+    workersLock.lock()
+    let onFrame = worker.onFrame
+    workersLock.unlock()
+    guard let onFrame else {
+      // The callback was removed while the Frame was queued, so no result will arrive for it.
+      _ = sequencer.markCompleted(timestamp: pendingFrame.timestamp.seconds)
+      telemetry.onFrameDisposed()
+      return
+    }
+    // Prepare Frame + Metadata
+    let metadata = getMediaSampleMetadata(
+      at: pendingFrame.timestamp,
+      orientation: pendingFrame.orientation,
+      isMirrored: pendingFrame.isMirrored)
+    let frame = HybridFrame(
+      buffer: pendingFrame.sampleBuffer,
+      metadata: metadata,
+      onDisposed: telemetry.onFrameDisposed)
+    // Call sync JS function
+    _ = telemetry.measureCallback { onFrame(frame) }
+  }
+
+  func setOnFrameCallback(onFrame: ((any HybridFrameSpec) -> Bool)?) throws {
+    guard
+      let worker = workers.first(where: { DispatchQueue.getSpecific(key: $0.queueSpecificKey) != nil })
+    else {
+      throw RuntimeError.error(
+        withMessage: "setOnFrameCallback(...) must be called on one of the FrameOutput's `threads`!")
+    }
+    workersLock.lock()
+    worker.onFrame = onFrame
+    workersLock.unlock()
+  }
+
+  func setOnFrameDroppedCallback(onFrameDropped: ((FrameDroppedReason) -> Void)?) throws {
+    self.onFrameDropped = onFrameDropped
+  }
+
+  func getStatistics() throws -> FrameOutputStatistics {
+    return telemetry.getStatistics()
+  }
+
+  func markFrameCompleted(timestamp: Double) throws -> Double {
+    return sequencer.markCompleted(timestamp: timestamp)
+  }
 }
@@ -0,0 +1,168 @@
+///
+/// FrameOutputTelemetry.swift
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+import AVFoundation
+import Foundation
+import os
+
+/// Collects runtime statistics of a Frame Output's pipeline, which are exposed
+/// to JS via `getStatistics()`.
+///
+/// Frames are recorded on the output's queue, while statistics can be read from
+/// any thread. All samples live in fixed-size ring buffers, so the `lock` is only
+/// held for a few instructions per Frame.
+///
+/// If Instruments is recording Points of Interest, Frame Callbacks show up as
+/// "Frame Callback" intervals, labeled with the output's `name`.
+final class FrameOutputTelemetry {
+  private static let windowSize = 120
+  private static let signposter = OSSignposter(
+    subsystem: "com.margelo.nitro.camera",
+    category: .pointsOfInterest)
+
+  /// A ring buffer of the most recent `windowSize` durations, in milliseconds.
+  private struct DurationRing {
+    private var samples = [Double](repeating: 0, count: FrameOutputTelemetry.windowSize)
+    private var writeIndex = 0
+
+    mutating func record(_ milliseconds: Double) {
+      samples[writeIndex % samples.count] = milliseconds
+      writeIndex += 1
+    }
+
+    func getStatistics() -> FrameDurationStatistics {
+      let count = min(writeIndex, samples.count)
+      guard count > 0 else {
+        return FrameDurationStatistics(
+          sampleCount: 0, average: 0, standardDeviation: 0, minimum: 0, median: 0, p90: 0, p99: 0,
+          maximum: 0)
+      }
+      let sorted = samples[0..<count].sorted()
+      let average = sorted.reduce(0, +) / Double(count)
+      let variance = sorted.reduce(0) { $0 + ($1 - average) * ($1 - average) } / Double(count)
+      func percentile(_ p: Double) -> Double {
+        let index = Int((p * Double(count)).rounded(.up)) - 1
+        return sorted[max(0, min(index, count - 1))]
+      }
+      return FrameDurationStatistics(
+        sampleCount: Double(count),
+        average: average,
+        standardDeviation: variance.squareRoot(),
+        minimum: sorted[0],
+        median: percentile(0.5),
+        p90: percentile(0.9),
+        p99: percentile(0.99),
+        maximum: sorted[count - 1])
+    }
+  }
+
+  private let name: String
+  private let lock = NSLock()
+  private var deliveryLatency = DurationRing()
+  private var callbackDuration = DurationRing()
+  private var frameInterval = DurationRing()
+  private var lastTimestamp: CMTime?
+  private var framesDelivered = 0
+  private var framesInFlight = 0
+  private var droppedFrameWasLate = 0
+  private var droppedOutOfBuffers = 0
+  private var droppedDiscontinuity = 0
+  private var droppedUnknown = 0
+
+  init(name: String) {
+    self.name = name
+  }
+
+  /// Records a Frame with the given presentation timestamp that is about to be
+  /// delivered to the Frame Callback.
+  func onFrameArrived(timestamp: CMTime) {
+    // Capture timestamps are in the host time clock.
+    let now = CMClockGetTime(CMClockGetHostTimeClock())
+    let latency = (now - timestamp).seconds * 1000
+
+    lock.lock()
+    defer { lock.unlock() }
+    framesDelivered += 1
+    framesInFlight += 1
+    if latency >= 0 {
+      deliveryLatency.record(latency)
+    }
+    if let lastTimestamp, timestamp > lastTimestamp {
+      frameInterval.record((timestamp - lastTimestamp).seconds * 1000)
+    }
+    lastTimestamp = timestamp
+  }
+
+  /// Runs the given Frame Callback, measures its duration and wraps it in a
+  /// signpost interval.
+  func measureCallback<T>(_ callback: () throws -> T) rethrows -> T {
+    let signposter = FrameOutputTelemetry.signposter
+    let interval =
+      signposter.isEnabled
+      ? signposter.beginInterval("Frame Callback", id: signposter.makeSignpostID(), "\(self.name)")
+      : nil
+    let start = CMClockGetTime(CMClockGetHostTimeClock())
+    defer {
+      let duration = (CMClockGetTime(CMClockGetHostTimeClock()) - start).seconds * 1000
+      if let interval {
+        signposter.endInterval("Frame Callback", interval)
+      }
+      lock.lock()
+      callbackDuration.record(duration)
+      lock.unlock()
+    }
+    return try callback()
+  }
+
+  /// Records that a delivered Frame has been disposed.
+  func onFrameDisposed() {
+    lock.lock()
+    defer { lock.unlock() }
+    framesInFlight -= 1
+  }
+
+  /// Records a Frame that was dropped before it reached the Frame Callback.
+  func onFrameDropped(reason: FrameDroppedReason) {
+    lock.lock()
+    defer { lock.unlock() }
+    switch reason {
+    case .frameWasLate:
+      droppedFrameWasLate += 1
+    case .outOfBuffers:
+      droppedOutOfBuffers += 1
+    case .discontinuity:
+      droppedDiscontinuity += 1
+    default:
+      droppedUnknown += 1
+    }
+  }
+
+  func getStatistics() -> FrameOutputStatistics {
+    // Copy the samples, so sorting them does not block the output's queue.
+    lock.lock()
+    let deliveryLatency = self.deliveryLatency
+    let callbackDuration = self.callbackDuration
+    let frameInterval = self.frameInterval
+    let framesDelivered = self.framesDelivered
+    let framesInFlight = self.framesInFlight
+    let dropped = FrameDropStatistics(
+      frameWasLate: Double(droppedFrameWasLate),
+      outOfBuffers: Double(droppedOutOfBuffers),
+      discontinuity: Double(droppedDiscontinuity),
+      unknown: Double(droppedUnknown))
+    lock.unlock()
+
+    return FrameOutputStatistics(
+      framesDelivered: Double(framesDelivered),
+      framesDropped: dropped.frameWasLate + dropped.outOfBuffers + dropped.discontinuity
+        + dropped.unknown,
+      framesInFlight: Double(framesInFlight),
+      droppedFrames: dropped,
+      deliveryLatency: deliveryLatency.getStatistics(),
+      callbackDuration: callbackDuration.getStatistics(),
+      frameInterval: frameInterval.getStatistics())
+  }
+}
@@ -0,0 +1,62 @@
+///
+/// FrameSequencer.swift
+/// VisionCamera
+/// Copyright © 2026 Marc Rousavy @ Margelo
+///
+
+import Foundation
+
+/// Keeps track of the order in which Frames were delivered to Frame Callbacks,
+/// so that their results can be released in capture order even if they complete
+/// out of order (e.g. when processed in parallel).
+///
+/// Frames are registered in capture order via `onFrameDelivered(timestamp:)`, and
+/// marked via `markCompleted(timestamp:)` once their result has been received.
+/// Both are keyed by the Frame's `timestamp`, as seen by JS.
+final class FrameSequencer {
+  /// If a result never arrives, later results are released once it is this many Frames behind.
+  private static let maxPendingFrames = 64
+
+  private struct PendingFrame {
+    let timestamp: Double
+    var isCompleted = false
+  }
+
+  private let lock = NSLock()
+  private var pendingFrames: [PendingFrame] = []
+
+  /// Registers a Frame that is about to be delivered to a Frame Callback.
+  /// Must be called in capture order.
+  func onFrameDelivered(timestamp: Double) {
+    lock.lock()
+    defer { lock.unlock() }
+    pendingFrames.append(PendingFrame(timestamp: timestamp))
+    if pendingFrames.count > FrameSequencer.maxPendingFrames {
+      pendingFrames.removeFirst()
+    }
+  }
+
+  /// Marks the Frame with the given `timestamp` as completed, and returns the
+  /// latest timestamp up to which all delivered Frames have completed, or `-1`
+  /// if an earlier Frame is still pending.
+  func markCompleted(timestamp: Double) -> Double {
+    lock.lock()
+    defer { lock.unlock() }
+    let index = pendingFrames.firstIndex { $0.timestamp == timestamp }
+    if let index {
+      pendingFrames[index].isCompleted = true
+    }
+
+    var releaseUpTo = -1.0
+    let completedCount = pendingFrames.prefix { $0.isCompleted }.count
+    if completedCount > 0 {
+      releaseUpTo = pendingFrames[completedCount - 1].timestamp
+      pendingFrames.removeFirst(completedCount)
+    }
+    if index == nil && timestamp < (pendingFrames.first?.timestamp ?? .greatestFiniteMagnitude) {
+      // The Frame was not tracked (anymore), but nothing before it is pending - release it.
+      releaseUpTo = max(releaseUpTo, timestamp)
+    }
+    return releaseUpTo
+  }
+}
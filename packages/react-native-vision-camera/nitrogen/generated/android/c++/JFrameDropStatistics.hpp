@@ -0,0 +1,69 @@
+///
+/// JFrameDropStatistics.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include <fbjni/fbjni.h>
+#include "FrameDropStatistics.hpp"
+
+
+
+namespace margelo::nitro::camera {
+
+  using namespace facebook;
+
+  /**
+   * The C++ JNI bridge between the C++ struct "FrameDropStatistics" and the Kotlin data class "FrameDropStatistics".
+   */
+  struct JFrameDropStatistics final: public jni::JavaClass<JFrameDropStatistics> {
+  public:
+    static constexpr auto kJavaDescriptor = "Lcom/margelo/nitro/camera/FrameDropStatistics;";
+
+  public:
+    /**
+     * Convert this Java/Kotlin-based struct to the C++ struct FrameDropStatistics by copying all values to C++.
+     */
+    [[maybe_unused]]
+    [[nodiscard]]
+    FrameDropStatistics toCpp() const {
+      static const auto clazz = javaClassStatic();
+      static const auto fieldFrameWasLate = clazz->getField<double>("frameWasLate");
+      double frameWasLate = this->getFieldValue(fieldFrameWasLate);
+      static const auto fieldOutOfBuffers = clazz->getField<double>("outOfBuffers");
+      double outOfBuffers = this->getFieldValue(fieldOutOfBuffers);
+      static const auto fieldDiscontinuity = clazz->getField<double>("discontinuity");
+      double discontinuity = this->getFieldValue(fieldDiscontinuity);
+      static const auto fieldUnknown = clazz->getField<double>("unknown");
+      double unknown = this->getFieldValue(fieldUnknown);
+      return FrameDropStatistics(
+        frameWasLate,
+        outOfBuffers,
+        discontinuity,
+        unknown
+      );
+    }
+
+  public:
+    /**
+     * Create a Java/Kotlin-based struct by copying all values from the given C++ struct to Java.
+     */
+    [[maybe_unused]]
+    static jni::local_ref<JFrameDropStatistics::javaobject> fromCpp(const FrameDropStatistics& value) {
+      using JSignature = JFrameDropStatistics(double, double, double, double);
+      static const auto clazz = javaClassStatic();
+      static const auto create = clazz->getStaticMethod<JSignature>("fromCpp");
+      return create(
+        clazz,
+        value.frameWasLate,
+        value.outOfBuffers,
+        value.discontinuity,
+        value.unknown
+      );
+    }
+  };
+
+} // namespace margelo::nitro::camera
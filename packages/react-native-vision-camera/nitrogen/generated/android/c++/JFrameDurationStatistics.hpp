@@ -0,0 +1,85 @@
+///
+/// JFrameDurationStatistics.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include <fbjni/fbjni.h>
+#include "FrameDurationStatistics.hpp"
+
+
+
+namespace margelo::nitro::camera {
+
+  using namespace facebook;
+
+  /**
+   * The C++ JNI bridge between the C++ struct "FrameDurationStatistics" and the Kotlin data class "FrameDurationStatistics".
+   */
+  struct JFrameDurationStatistics final: public jni::JavaClass<JFrameDurationStatistics> {
+  public:
+    static constexpr auto kJavaDescriptor = "Lcom/margelo/nitro/camera/FrameDurationStatistics;";
+
+  public:
+    /**
+     * Convert this Java/Kotlin-based struct to the C++ struct FrameDurationStatistics by copying all values to C++.
+     */
+    [[maybe_unused]]
+    [[nodiscard]]
+    FrameDurationStatistics toCpp() const {
+      static const auto clazz = javaClassStatic();
+      static const auto fieldSampleCount = clazz->getField<double>("sampleCount");
+      double sampleCount = this->getFieldValue(fieldSampleCount);
+      static const auto fieldAverage = clazz->getField<double>("average");
+      double average = this->getFieldValue(fieldAverage);
+      static const auto fieldStandardDeviation = clazz->getField<double>("standardDeviation");
+      double standardDeviation = this->getFieldValue(fieldStandardDeviation);
+      static const auto fieldMinimum = clazz->getField<double>("minimum");
+      double minimum = this->getFieldValue(fieldMinimum);
+      static const auto fieldMedian = clazz->getField<double>("median");
+      double median = this->getFieldValue(fieldMedian);
+      static const auto fieldP90 = clazz->getField<double>("p90");
+      double p90 = this->getFieldValue(fieldP90);
+      static const auto fieldP99 = clazz->getField<double>("p99");
+      double p99 = this->getFieldValue(fieldP99);
+      static const auto fieldMaximum = clazz->getField<double>("maximum");
+      double maximum = this->getFieldValue(fieldMaximum);
+      return FrameDurationStatistics(
+        sampleCount,
+        average,
+        standardDeviation,
+        minimum,
+        median,
+        p90,
+        p99,
+        maximum
+      );
+    }
+
+  public:
+    /**
+     * Create a Java/Kotlin-based struct by copying all values from the given C++ struct to Java.
+     */
+    [[maybe_unused]]
+    static jni::local_ref<JFrameDurationStatistics::javaobject> fromCpp(const FrameDurationStatistics& value) {
+      using JSignature = JFrameDurationStatistics(double, double, double, double, double, double, double, double);
+      static const auto clazz = javaClassStatic();
+      static const auto create = clazz->getStaticMethod<JSignature>("fromCpp");
+      return create(
+        clazz,
+        value.sampleCount,
+        value.average,
+        value.standardDeviation,
+        value.minimum,
+        value.median,
+        value.p90,
+        value.p99,
+        value.maximum
+      );
+    }
+  };
+
+} // namespace margelo::nitro::camera
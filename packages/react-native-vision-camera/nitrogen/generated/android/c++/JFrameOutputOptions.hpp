@@ -14,6 +14,7 @@
 #include "JTargetVideoPixelFormat.hpp"
 #include "Size.hpp"
 #include "TargetVideoPixelFormat.hpp"
+#include <optional>
 
 namespace margelo::nitro::camera {
 
@@ -48,6 +49,8 @@ namespace margelo::nitro::camera {
       jboolean enableCameraMatrixDelivery = this->getFieldValue(fieldEnableCameraMatrixDelivery);
       static const auto fieldDropFramesWhileBusy = clazz->getField<jboolean>("dropFramesWhileBusy");
       jboolean dropFramesWhileBusy = this->getFieldValue(fieldDropFramesWhileBusy);
+      static const auto fieldParallelism = clazz->getField<jni::JDouble>("parallelism");
+      jni::local_ref<jni::JDouble> parallelism = this->getFieldValue(fieldParallelism);
       return FrameOutputOptions(
         targetResolution->toCpp(),
         static_cast<bool>(enablePreviewSizedOutputBuffers),
@@ -55,7 +58,8 @@ namespace margelo::nitro::camera {
         pixelFormat->toCpp(),
         static_cast<bool>(enablePhysicalBufferRotation),
         static_cast<bool>(enableCameraMatrixDelivery),
-        static_cast<bool>(dropFramesWhileBusy)
+        static_cast<bool>(dropFramesWhileBusy),
+        parallelism != nullptr ? std::make_optional(parallelism->value()) : std::nullopt
       );
     }
 
@@ -65,7 +69,7 @@ namespace margelo::nitro::camera {
      */
     [[maybe_unused]]
     static jni::local_ref<JFrameOutputOptions::javaobject> fromCpp(const FrameOutputOptions& value) {
-      using JSignature = JFrameOutputOptions(jni::alias_ref<JSize>, jboolean, jboolean, jni::alias_ref<JTargetVideoPixelFormat>, jboolean, jboolean, jboolean);
+      using JSignature = JFrameOutputOptions(jni::alias_ref<JSize>, jboolean, jboolean, jni::alias_ref<JTargetVideoPixelFormat>, jboolean, jboolean, jboolean, jni::alias_ref<jni::JDouble>);
       static const auto clazz = javaClassStatic();
       static const auto create = clazz->getStaticMethod<JSignature>("fromCpp");
       return create(
@@ -76,7 +80,8 @@ namespace margelo::nitro::camera {
         JTargetVideoPixelFormat::fromCpp(value.pixelFormat),
         value.enablePhysicalBufferRotation,
         value.enableCameraMatrixDelivery,
-        value.dropFramesWhileBusy
+        value.dropFramesWhileBusy,
+        value.parallelism.has_value() ? jni::JDouble::valueOf(value.parallelism.value()) : nullptr
       );
     }
   };
@@ -0,0 +1,84 @@
+///
+/// JFrameOutputStatistics.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include <fbjni/fbjni.h>
+#include "FrameOutputStatistics.hpp"
+
+#include "FrameDropStatistics.hpp"
+#include "FrameDurationStatistics.hpp"
+#include "JFrameDropStatistics.hpp"
+#include "JFrameDurationStatistics.hpp"
+
+namespace margelo::nitro::camera {
+
+  using namespace facebook;
+
+  /**
+   * The C++ JNI bridge between the C++ struct "FrameOutputStatistics" and the Kotlin data class "FrameOutputStatistics".
+   */
+  struct JFrameOutputStatistics final: public jni::JavaClass<JFrameOutputStatistics> {
+  public:
+    static constexpr auto kJavaDescriptor = "Lcom/margelo/nitro/camera/FrameOutputStatistics;";
+
+  public:
+    /**
+     * Convert this Java/Kotlin-based struct to the C++ struct FrameOutputStatistics by copying all values to C++.
+     */
+    [[maybe_unused]]
+    [[nodiscard]]
+    FrameOutputStatistics toCpp() const {
+      static const auto clazz = javaClassStatic();
+      static const auto fieldFramesDelivered = clazz->getField<double>("framesDelivered");
+      double framesDelivered = this->getFieldValue(fieldFramesDelivered);
+      static const auto fieldFramesDropped = clazz->getField<double>("framesDropped");
+      double framesDropped = this->getFieldValue(fieldFramesDropped);
+      static const auto fieldFramesInFlight = clazz->getField<double>("framesInFlight");
+      double framesInFlight = this->getFieldValue(fieldFramesInFlight);
+      static const auto fieldDroppedFrames = clazz->getField<JFrameDropStatistics>("droppedFrames");
+      jni::local_ref<JFrameDropStatistics> droppedFrames = this->getFieldValue(fieldDroppedFrames);
+      static const auto fieldDeliveryLatency = clazz->getField<JFrameDurationStatistics>("deliveryLatency");
+      jni::local_ref<JFrameDurationStatistics> deliveryLatency = this->getFieldValue(fieldDeliveryLatency);
+      static const auto fieldCallbackDuration = clazz->getField<JFrameDurationStatistics>("callbackDuration");
+      jni::local_ref<JFrameDurationStatistics> callbackDuration = this->getFieldValue(fieldCallbackDuration);
+      static const auto fieldFrameInterval = clazz->getField<JFrameDurationStatistics>("frameInterval");
+      jni::local_ref<JFrameDurationStatistics> frameInterval = this->getFieldValue(fieldFrameInterval);
+      return FrameOutputStatistics(
+        framesDelivered,
+        framesDropped,
+        framesInFlight,
+        droppedFrames->toCpp(),
+        deliveryLatency->toCpp(),
+        callbackDuration->toCpp(),
+        frameInterval->toCpp()
+      );
+    }
+
+  public:
+    /**
+     * Create a Java/Kotlin-based struct by copying all values from the given C++ struct to Java.
+     */
+    [[maybe_unused]]
+    static jni::local_ref<JFrameOutputStatistics::javaobject> fromCpp(const FrameOutputStatistics& value) {
+      using JSignature = JFrameOutputStatistics(double, double, double, jni::alias_ref<JFrameDropStatistics>, jni::alias_ref<JFrameDurationStatistics>, jni::alias_ref<JFrameDurationStatistics>, jni::alias_ref<JFrameDurationStatistics>);
+      static const auto clazz = javaClassStatic();
+      static const auto create = clazz->getStaticMethod<JSignature>("fromCpp");
+      return create(
+        clazz,
+        value.framesDelivered,
+        value.framesDropped,
+        value.framesInFlight,
+        JFrameDropStatistics::fromCpp(value.droppedFrames),
+        JFrameDurationStatistics::fromCpp(value.deliveryLatency),
+        JFrameDurationStatistics::fromCpp(value.callbackDuration),
+        JFrameDurationStatistics::fromCpp(value.frameInterval)
+      );
+    }
+  };
+
+} // namespace margelo::nitro::camera
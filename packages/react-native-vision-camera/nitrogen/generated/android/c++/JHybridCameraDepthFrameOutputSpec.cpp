@@ -13,6 +13,12 @@ namespace margelo::nitro::camera { class HybridNativeThreadSpec; }
 namespace margelo::nitro::camera { class HybridDepthSpec; }
 // Forward declaration of `FrameDroppedReason` to properly resolve imports.
 namespace margelo::nitro::camera { enum class FrameDroppedReason; }
+// Forward declaration of `FrameOutputStatistics` to properly resolve imports.
+namespace margelo::nitro::camera { struct FrameOutputStatistics; }
+// Forward declaration of `FrameDropStatistics` to properly resolve imports.
+namespace margelo::nitro::camera { struct FrameDropStatistics; }
+// Forward declaration of `FrameDurationStatistics` to properly resolve imports.
+namespace margelo::nitro::camera { struct FrameDurationStatistics; }
 // Forward declaration of `MediaType` to properly resolve imports.
 namespace margelo::nitro::camera { enum class MediaType; }
 // Forward declaration of `CameraOrientation` to properly resolve imports.
@@ -32,6 +38,12 @@ namespace margelo::nitro::camera { struct Size; }
 #include "FrameDroppedReason.hpp"
 #include "JFunc_void_FrameDroppedReason.hpp"
 #include "JFrameDroppedReason.hpp"
+#include "FrameOutputStatistics.hpp"
+#include "JFrameOutputStatistics.hpp"
+#include "FrameDropStatistics.hpp"
+#include "JFrameDropStatistics.hpp"
+#include "FrameDurationStatistics.hpp"
+#include "JFrameDurationStatistics.hpp"
 #include "MediaType.hpp"
 #include "JMediaType.hpp"
 #include "CameraOrientation.hpp"
@@ -103,5 +115,10 @@ namespace margelo::nitro::camera {
     static const auto method = _javaPart->javaClassStatic()->getMethod<void(jni::alias_ref<JFunc_void_FrameDroppedReason::javaobject> /* onDepthFrameDropped */)>("setOnDepthFrameDroppedCallback_cxx");
     method(_javaPart, onDepthFrameDropped.has_value() ? JFunc_void_FrameDroppedReason_cxx::fromCpp(onDepthFrameDropped.value()) : nullptr);
   }
+  FrameOutputStatistics JHybridCameraDepthFrameOutputSpec::getStatistics() {
+    static const auto method = _javaPart->javaClassStatic()->getMethod<jni::local_ref<JFrameOutputStatistics>()>("getStatistics");
+    auto __result = method(_javaPart);
+    return __result->toCpp();
+  }
 
 } // namespace margelo::nitro::camera
@@ -62,6 +62,7 @@ namespace margelo::nitro::camera {
     // Methods
     void setOnDepthFrameCallback(const std::optional<std::function<bool(const std::shared_ptr<HybridDepthSpec>& /* depth */)>>& onDepthFrame) override;
     void setOnDepthFrameDroppedCallback(const std::optional<std::function<void(FrameDroppedReason /* reason */)>>& onDepthFrameDropped) override;
+    FrameOutputStatistics getStatistics() override;
 
   private:
     jni::global_ref<JHybridCameraDepthFrameOutputSpec::JavaPart> _javaPart;
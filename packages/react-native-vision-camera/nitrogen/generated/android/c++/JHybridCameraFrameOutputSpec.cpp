@@ -13,6 +13,12 @@ namespace margelo::nitro::camera { class HybridNativeThreadSpec; }
 namespace margelo::nitro::camera { class HybridFrameSpec; }
 // Forward declaration of `FrameDroppedReason` to properly resolve imports.
 namespace margelo::nitro::camera { enum class FrameDroppedReason; }
+// Forward declaration of `FrameOutputStatistics` to properly resolve imports.
+namespace margelo::nitro::camera { struct FrameOutputStatistics; }
+// Forward declaration of `FrameDropStatistics` to properly resolve imports.
+namespace margelo::nitro::camera { struct FrameDropStatistics; }
+// Forward declaration of `FrameDurationStatistics` to properly resolve imports.
+namespace margelo::nitro::camera { struct FrameDurationStatistics; }
 // Forward declaration of `MediaType` to properly resolve imports.
 namespace margelo::nitro::camera { enum class MediaType; }
 // Forward declaration of `CameraOrientation` to properly resolve imports.
@@ -23,6 +29,7 @@ namespace margelo::nitro::camera { struct Size; }
 #include <memory>
 #include "HybridNativeThreadSpec.hpp"
 #include "JHybridNativeThreadSpec.hpp"
+#include <vector>
 #include "HybridFrameSpec.hpp"
 #include <functional>
 #include <optional>
@@ -32,6 +39,12 @@ namespace margelo::nitro::camera { struct Size; }
 #include "FrameDroppedReason.hpp"
 #include "JFunc_void_FrameDroppedReason.hpp"
 #include "JFrameDroppedReason.hpp"
+#include "FrameOutputStatistics.hpp"
+#include "JFrameOutputStatistics.hpp"
+#include "FrameDropStatistics.hpp"
+#include "JFrameDropStatistics.hpp"
+#include "FrameDurationStatistics.hpp"
+#include "JFrameDurationStatistics.hpp"
 #include "MediaType.hpp"
 #include "JMediaType.hpp"
 #include "CameraOrientation.hpp"
@@ -74,6 +87,20 @@ namespace margelo::nitro::camera {
     auto __result = method(_javaPart);
     return __result->getJHybridNativeThreadSpec();
   }
+  std::vector<std::shared_ptr<HybridNativeThreadSpec>> JHybridCameraFrameOutputSpec::getThreads() {
+    static const auto method = _javaPart->javaClassStatic()->getMethod<jni::local_ref<jni::JArrayClass<JHybridNativeThreadSpec::JavaPart>>()>("getThreads");
+    auto __result = method(_javaPart);
+    return [&](auto&& __input) {
+      size_t __size = __input->size();
+      std::vector<std::shared_ptr<HybridNativeThreadSpec>> __vector;
+      __vector.reserve(__size);
+      for (size_t __i = 0; __i < __size; __i++) {
+        auto __element = __input->getElement(__i);
+        __vector.push_back(__element->getJHybridNativeThreadSpec());
+      }
+      return __vector;
+    }(__result);
+  }
   MediaType JHybridCameraFrameOutputSpec::getMediaType() {
     static const auto method = _javaPart->javaClassStatic()->getMethod<jni::local_ref<JMediaType>()>("getMediaType");
     auto __result = method(_javaPart);
@@ -103,5 +130,15 @@ namespace margelo::nitro::camera {
     static const auto method = _javaPart->javaClassStatic()->getMethod<void(jni::alias_ref<JFunc_void_FrameDroppedReason::javaobject> /* onFrameDropped */)>("setOnFrameDroppedCallback_cxx");
     method(_javaPart, onFrameDropped.has_value() ? JFunc_void_FrameDroppedReason_cxx::fromCpp(onFrameDropped.value()) : nullptr);
   }
+  FrameOutputStatistics JHybridCameraFrameOutputSpec::getStatistics() {
+    static const auto method = _javaPart->javaClassStatic()->getMethod<jni::local_ref<JFrameOutputStatistics>()>("getStatistics");
+    auto __result = method(_javaPart);
+    return __result->toCpp();
+  }
+  double JHybridCameraFrameOutputSpec::markFrameCompleted(double timestamp) {
+    static const auto method = _javaPart->javaClassStatic()->getMethod<double(double /* timestamp */)>("markFrameCompleted");
+    auto __result = method(_javaPart, timestamp);
+    return __result;
+  }
 
 } // namespace margelo::nitro::camera
@@ -53,6 +53,7 @@ namespace margelo::nitro::camera {
   public:
     // Properties
     std::shared_ptr<HybridNativeThreadSpec> getThread() override;
+    std::vector<std::shared_ptr<HybridNativeThreadSpec>> getThreads() override;
     MediaType getMediaType() override;
     CameraOrientation getOutputOrientation() override;
     void setOutputOrientation(CameraOrientation outputOrientation) override;
@@ -62,6 +63,8 @@ namespace margelo::nitro::camera {
     // Methods
     void setOnFrameCallback(const std::optional<std::function<bool(const std::shared_ptr<HybridFrameSpec>& /* frame */)>>& onFrame) override;
     void setOnFrameDroppedCallback(const std::optional<std::function<void(FrameDroppedReason /* reason */)>>& onFrameDropped) override;
+    FrameOutputStatistics getStatistics() override;
+    double markFrameCompleted(double timestamp) override;
 
   private:
     jni::global_ref<JHybridCameraFrameOutputSpec::JavaPart> _javaPart;
@@ -13,6 +13,8 @@ namespace margelo::nitro::camera { enum class PixelFormat; }
 namespace margelo::nitro::camera { enum class CameraOrientation; }
 // Forward declaration of `HybridFramePlaneSpec` to properly resolve imports.
 namespace margelo::nitro::camera { class HybridFramePlaneSpec; }
+// Forward declaration of `PixelBufferPlaneLayout` to properly resolve imports.
+namespace margelo::nitro::camera { struct PixelBufferPlaneLayout; }
 // Forward declaration of `NativeBuffer` to properly resolve imports.
 namespace margelo::nitro::camera { struct NativeBuffer; }
 // Forward declaration of `Point` to properly resolve imports.
@@ -29,6 +31,8 @@ namespace margelo::nitro::camera { struct Point; }
 #include "JHybridFramePlaneSpec.hpp"
 #include <NitroModules/ArrayBuffer.hpp>
 #include <NitroModules/JArrayBuffer.hpp>
+#include "PixelBufferPlaneLayout.hpp"
+#include "JPixelBufferPlaneLayout.hpp"
 #include "NativeBuffer.hpp"
 #include "JNativeBuffer.hpp"
 #include <functional>
@@ -153,6 +157,20 @@ namespace margelo::nitro::camera {
     auto __result = method(_javaPart);
     return __result->cthis()->getArrayBuffer();
   }
+  std::vector<PixelBufferPlaneLayout> JHybridFrameSpec::getPixelBufferLayout() {
+    static const auto method = _javaPart->javaClassStatic()->getMethod<jni::local_ref<jni::JArrayClass<JPixelBufferPlaneLayout>>()>("getPixelBufferLayout");
+    auto __result = method(_javaPart);
+    return [&](auto&& __input) {
+      size_t __size = __input->size();
+      std::vector<PixelBufferPlaneLayout> __vector;
+      __vector.reserve(__size);
+      for (size_t __i = 0; __i < __size; __i++) {
+        auto __element = __input->getElement(__i);
+        __vector.push_back(__element->toCpp());
+      }
+      return __vector;
+    }(__result);
+  }
   NativeBuffer JHybridFrameSpec::getNativeBuffer() {
     static const auto method = _javaPart->javaClassStatic()->getMethod<jni::local_ref<JNativeBuffer>()>("getNativeBuffer");
     auto __result = method(_javaPart);
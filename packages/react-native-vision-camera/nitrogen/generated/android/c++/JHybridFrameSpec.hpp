@@ -67,6 +67,7 @@ namespace margelo::nitro::camera {
     // Methods
     std::vector<std::shared_ptr<HybridFramePlaneSpec>> getPlanes() override;
     std::shared_ptr<ArrayBuffer> getPixelBuffer() override;
+    std::vector<PixelBufferPlaneLayout> getPixelBufferLayout() override;
     NativeBuffer getNativeBuffer() override;
     Point convertCameraPointToFramePoint(const Point& cameraPoint) override;
     Point convertFramePointToCameraPoint(const Point& framePoint) override;
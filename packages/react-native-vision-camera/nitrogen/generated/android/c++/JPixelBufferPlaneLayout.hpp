@@ -0,0 +1,73 @@
+///
+/// JPixelBufferPlaneLayout.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#include <fbjni/fbjni.h>
+#include "PixelBufferPlaneLayout.hpp"
+
+
+
+namespace margelo::nitro::camera {
+
+  using namespace facebook;
+
+  /**
+   * The C++ JNI bridge between the C++ struct "PixelBufferPlaneLayout" and the Kotlin data class "PixelBufferPlaneLayout".
+   */
+  struct JPixelBufferPlaneLayout final: public jni::JavaClass<JPixelBufferPlaneLayout> {
+  public:
+    static constexpr auto kJavaDescriptor = "Lcom/margelo/nitro/camera/PixelBufferPlaneLayout;";
+
+  public:
+    /**
+     * Convert this Java/Kotlin-based struct to the C++ struct PixelBufferPlaneLayout by copying all values to C++.
+     */
+    [[maybe_unused]]
+    [[nodiscard]]
+    PixelBufferPlaneLayout toCpp() const {
+      static const auto clazz = javaClassStatic();
+      static const auto fieldOffset = clazz->getField<double>("offset");
+      double offset = this->getFieldValue(fieldOffset);
+      static const auto fieldRowStride = clazz->getField<double>("rowStride");
+      double rowStride = this->getFieldValue(fieldRowStride);
+      static const auto fieldPixelStride = clazz->getField<double>("pixelStride");
+      double pixelStride = this->getFieldValue(fieldPixelStride);
+      static const auto fieldWidth = clazz->getField<double>("width");
+      double width = this->getFieldValue(fieldWidth);
+      static const auto fieldHeight = clazz->getField<double>("height");
+      double height = this->getFieldValue(fieldHeight);
+      return PixelBufferPlaneLayout(
+        offset,
+        rowStride,
+        pixelStride,
+        width,
+        height
+      );
+    }
+
+  public:
+    /**
+     * Create a Java/Kotlin-based struct by copying all values from the given C++ struct to Java.
+     */
+    [[maybe_unused]]
+    static jni::local_ref<JPixelBufferPlaneLayout::javaobject> fromCpp(const PixelBufferPlaneLayout& value) {
+      using JSignature = JPixelBufferPlaneLayout(double, double, double, double, double);
+      static const auto clazz = javaClassStatic();
+      static const auto create = clazz->getStaticMethod<JSignature>("fromCpp");
+      return create(
+        clazz,
+        value.offset,
+        value.rowStride,
+        value.pixelStride,
+        value.width,
+        value.height
+      );
+    }
+  };
+
+} // namespace margelo::nitro::camera
@@ -0,0 +1,66 @@
+///
+/// FrameDropStatistics.kt
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+package com.margelo.nitro.camera
+
+import androidx.annotation.Keep
+import com.facebook.proguard.annotations.DoNotStrip
+import java.util.Objects
+
+
+/**
+ * Represents the JavaScript object/struct "FrameDropStatistics".
+ */
+@DoNotStrip
+@Keep
+data class FrameDropStatistics(
+  @DoNotStrip
+  @Keep
+  val frameWasLate: Double,
+  @DoNotStrip
+  @Keep
+  val outOfBuffers: Double,
+  @DoNotStrip
+  @Keep
+  val discontinuity: Double,
+  @DoNotStrip
+  @Keep
+  val unknown: Double
+) {
+  /* primary constructor */
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is FrameDropStatistics) return false
+    return Objects.deepEquals(this.frameWasLate, other.frameWasLate)
+      && Objects.deepEquals(this.outOfBuffers, other.outOfBuffers)
+      && Objects.deepEquals(this.discontinuity, other.discontinuity)
+      && Objects.deepEquals(this.unknown, other.unknown)
+  }
+
+  override fun hashCode(): Int {
+    return arrayOf<Any?>(
+      frameWasLate,
+      outOfBuffers,
+      discontinuity,
+      unknown
+    ).contentDeepHashCode()
+  }
+
+  companion object {
+    /**
+     * Constructor called from C++
+     */
+    @DoNotStrip
+    @Keep
+    @Suppress("unused")
+    @JvmStatic
+    private fun fromCpp(frameWasLate: Double, outOfBuffers: Double, discontinuity: Double, unknown: Double): FrameDropStatistics {
+      return FrameDropStatistics(frameWasLate, outOfBuffers, discontinuity, unknown)
+    }
+  }
+}
@@ -0,0 +1,86 @@
+///
+/// FrameDurationStatistics.kt
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+package com.margelo.nitro.camera
+
+import androidx.annotation.Keep
+import com.facebook.proguard.annotations.DoNotStrip
+import java.util.Objects
+
+
+/**
+ * Represents the JavaScript object/struct "FrameDurationStatistics".
+ */
+@DoNotStrip
+@Keep
+data class FrameDurationStatistics(
+  @DoNotStrip
+  @Keep
+  val sampleCount: Double,
+  @DoNotStrip
+  @Keep
+  val average: Double,
+  @DoNotStrip
+  @Keep
+  val standardDeviation: Double,
+  @DoNotStrip
+  @Keep
+  val minimum: Double,
+  @DoNotStrip
+  @Keep
+  val median: Double,
+  @DoNotStrip
+  @Keep
+  val p90: Double,
+  @DoNotStrip
+  @Keep
+  val p99: Double,
+  @DoNotStrip
+  @Keep
+  val maximum: Double
+) {
+  /* primary constructor */
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is FrameDurationStatistics) return false
+    return Objects.deepEquals(this.sampleCount, other.sampleCount)
+      && Objects.deepEquals(this.average, other.average)
+      && Objects.deepEquals(this.standardDeviation, other.standardDeviation)
+      && Objects.deepEquals(this.minimum, other.minimum)
+      && Objects.deepEquals(this.median, other.median)
+      && Objects.deepEquals(this.p90, other.p90)
+      && Objects.deepEquals(this.p99, other.p99)
+      && Objects.deepEquals(this.maximum, other.maximum)
+  }
+
+  override fun hashCode(): Int {
+    return arrayOf<Any?>(
+      sampleCount,
+      average,
+      standardDeviation,
+      minimum,
+      median,
+      p90,
+      p99,
+      maximum
+    ).contentDeepHashCode()
+  }
+
+  companion object {
+    /**
+     * Constructor called from C++
+     */
+    @DoNotStrip
+    @Keep
+    @Suppress("unused")
+    @JvmStatic
+    private fun fromCpp(sampleCount: Double, average: Double, standardDeviation: Double, minimum: Double, median: Double, p90: Double, p99: Double, maximum: Double): FrameDurationStatistics {
+      return FrameDurationStatistics(sampleCount, average, standardDeviation, minimum, median, p90, p99, maximum)
+    }
+  }
+}
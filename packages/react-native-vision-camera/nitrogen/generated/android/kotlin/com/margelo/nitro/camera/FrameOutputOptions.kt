@@ -38,7 +38,10 @@ data class FrameOutputOptions(
   val enableCameraMatrixDelivery: Boolean,
   @DoNotStrip
   @Keep
-  val dropFramesWhileBusy: Boolean
+  val dropFramesWhileBusy: Boolean,
+  @DoNotStrip
+  @Keep
+  val parallelism: Double?
 ) {
   /* primary constructor */
 
@@ -52,6 +55,7 @@ data class FrameOutputOptions(
       && Objects.deepEquals(this.enablePhysicalBufferRotation, other.enablePhysicalBufferRotation)
       && Objects.deepEquals(this.enableCameraMatrixDelivery, other.enableCameraMatrixDelivery)
       && Objects.deepEquals(this.dropFramesWhileBusy, other.dropFramesWhileBusy)
+      && Objects.deepEquals(this.parallelism, other.parallelism)
   }
 
   override fun hashCode(): Int {
@@ -62,7 +66,8 @@ data class FrameOutputOptions(
       pixelFormat,
       enablePhysicalBufferRotation,
       enableCameraMatrixDelivery,
-      dropFramesWhileBusy
+      dropFramesWhileBusy,
+      parallelism
     ).contentDeepHashCode()
   }
 
@@ -74,8 +79,8 @@ data class FrameOutputOptions(
     @Keep
     @Suppress("unused")
     @JvmStatic
-    private fun fromCpp(targetResolution: Size, enablePreviewSizedOutputBuffers: Boolean, allowDeferredStart: Boolean, pixelFormat: TargetVideoPixelFormat, enablePhysicalBufferRotation: Boolean, enableCameraMatrixDelivery: Boolean, dropFramesWhileBusy: Boolean): FrameOutputOptions {
-      return FrameOutputOptions(targetResolution, enablePreviewSizedOutputBuffers, allowDeferredStart, pixelFormat, enablePhysicalBufferRotation, enableCameraMatrixDelivery, dropFramesWhileBusy)
+    private fun fromCpp(targetResolution: Size, enablePreviewSizedOutputBuffers: Boolean, allowDeferredStart: Boolean, pixelFormat: TargetVideoPixelFormat, enablePhysicalBufferRotation: Boolean, enableCameraMatrixDelivery: Boolean, dropFramesWhileBusy: Boolean, parallelism: Double?): FrameOutputOptions {
+      return FrameOutputOptions(targetResolution, enablePreviewSizedOutputBuffers, allowDeferredStart, pixelFormat, enablePhysicalBufferRotation, enableCameraMatrixDelivery, dropFramesWhileBusy, parallelism)
     }
   }
 }
@@ -0,0 +1,81 @@
+///
+/// FrameOutputStatistics.kt
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+package com.margelo.nitro.camera
+
+import androidx.annotation.Keep
+import com.facebook.proguard.annotations.DoNotStrip
+import java.util.Objects
+
+
+/**
+ * Represents the JavaScript object/struct "FrameOutputStatistics".
+ */
+@DoNotStrip
+@Keep
+data class FrameOutputStatistics(
+  @DoNotStrip
+  @Keep
+  val framesDelivered: Double,
+  @DoNotStrip
+  @Keep
+  val framesDropped: Double,
+  @DoNotStrip
+  @Keep
+  val framesInFlight: Double,
+  @DoNotStrip
+  @Keep
+  val droppedFrames: FrameDropStatistics,
+  @DoNotStrip
+  @Keep
+  val deliveryLatency: FrameDurationStatistics,
+  @DoNotStrip
+  @Keep
+  val callbackDuration: FrameDurationStatistics,
+  @DoNotStrip
+  @Keep
+  val frameInterval: FrameDurationStatistics
+) {
+  /* primary constructor */
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is FrameOutputStatistics) return false
+    return Objects.deepEquals(this.framesDelivered, other.framesDelivered)
+      && Objects.deepEquals(this.framesDropped, other.framesDropped)
+      && Objects.deepEquals(this.framesInFlight, other.framesInFlight)
+      && Objects.deepEquals(this.droppedFrames, other.droppedFrames)
+      && Objects.deepEquals(this.deliveryLatency, other.deliveryLatency)
+      && Objects.deepEquals(this.callbackDuration, other.callbackDuration)
+      && Objects.deepEquals(this.frameInterval, other.frameInterval)
+  }
+
+  override fun hashCode(): Int {
+    return arrayOf<Any?>(
+      framesDelivered,
+      framesDropped,
+      framesInFlight,
+      droppedFrames,
+      deliveryLatency,
+      callbackDuration,
+      frameInterval
+    ).contentDeepHashCode()
+  }
+
+  companion object {
+    /**
+     * Constructor called from C++
+     */
+    @DoNotStrip
+    @Keep
+    @Suppress("unused")
+    @JvmStatic
+    private fun fromCpp(framesDelivered: Double, framesDropped: Double, framesInFlight: Double, droppedFrames: FrameDropStatistics, deliveryLatency: FrameDurationStatistics, callbackDuration: FrameDurationStatistics, frameInterval: FrameDurationStatistics): FrameOutputStatistics {
+      return FrameOutputStatistics(framesDelivered, framesDropped, framesInFlight, droppedFrames, deliveryLatency, callbackDuration, frameInterval)
+    }
+  }
+}
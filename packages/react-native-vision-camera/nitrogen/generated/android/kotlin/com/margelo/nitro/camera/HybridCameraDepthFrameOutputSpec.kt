@@ -48,6 +48,10 @@ abstract class HybridCameraDepthFrameOutputSpec: HybridCameraOutputSpec() {
     val __result = setOnDepthFrameDroppedCallback(onDepthFrameDropped?.let { it })
     return __result
   }
+  
+  @DoNotStrip
+  @Keep
+  abstract fun getStatistics(): FrameOutputStatistics
 
   // Default implementation of `HybridObject.toString()`
   override fun toString(): String {
@@ -29,6 +29,10 @@ abstract class HybridCameraFrameOutputSpec: HybridCameraOutputSpec() {
   @get:DoNotStrip
   @get:Keep
   abstract val thread: HybridNativeThreadSpec
+  
+  @get:DoNotStrip
+  @get:Keep
+  abstract val threads: Array<HybridNativeThreadSpec>
 
   // Methods
   abstract fun setOnFrameCallback(onFrame: ((frame: HybridFrameSpec) -> Boolean)?): Unit
@@ -48,6 +52,14 @@ abstract class HybridCameraFrameOutputSpec: HybridCameraOutputSpec() {
     val __result = setOnFrameDroppedCallback(onFrameDropped?.let { it })
     return __result
   }
+  
+  @DoNotStrip
+  @Keep
+  abstract fun getStatistics(): FrameOutputStatistics
+  
+  @DoNotStrip
+  @Keep
+  abstract fun markFrameCompleted(timestamp: Double): Double
 
   // Default implementation of `HybridObject.toString()`
   override fun toString(): String {
@@ -84,6 +84,10 @@ abstract class HybridFrameSpec: HybridObject() {
   @Keep
   abstract fun getPixelBuffer(): ArrayBuffer
   
+  @DoNotStrip
+  @Keep
+  abstract fun getPixelBufferLayout(): Array<PixelBufferPlaneLayout>
+  
   @DoNotStrip
   @Keep
   abstract fun getNativeBuffer(): NativeBuffer
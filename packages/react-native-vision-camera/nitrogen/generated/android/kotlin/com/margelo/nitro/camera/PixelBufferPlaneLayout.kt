@@ -0,0 +1,71 @@
+///
+/// PixelBufferPlaneLayout.kt
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+package com.margelo.nitro.camera
+
+import androidx.annotation.Keep
+import com.facebook.proguard.annotations.DoNotStrip
+import java.util.Objects
+
+
+/**
+ * Represents the JavaScript object/struct "PixelBufferPlaneLayout".
+ */
+@DoNotStrip
+@Keep
+data class PixelBufferPlaneLayout(
+  @DoNotStrip
+  @Keep
+  val offset: Double,
+  @DoNotStrip
+  @Keep
+  val rowStride: Double,
+  @DoNotStrip
+  @Keep
+  val pixelStride: Double,
+  @DoNotStrip
+  @Keep
+  val width: Double,
+  @DoNotStrip
+  @Keep
+  val height: Double
+) {
+  /* primary constructor */
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is PixelBufferPlaneLayout) return false
+    return Objects.deepEquals(this.offset, other.offset)
+      && Objects.deepEquals(this.rowStride, other.rowStride)
+      && Objects.deepEquals(this.pixelStride, other.pixelStride)
+      && Objects.deepEquals(this.width, other.width)
+      && Objects.deepEquals(this.height, other.height)
+  }
+
+  override fun hashCode(): Int {
+    return arrayOf<Any?>(
+      offset,
+      rowStride,
+      pixelStride,
+      width,
+      height
+    ).contentDeepHashCode()
+  }
+
+  companion object {
+    /**
+     * Constructor called from C++
+     */
+    @DoNotStrip
+    @Keep
+    @Suppress("unused")
+    @JvmStatic
+    private fun fromCpp(offset: Double, rowStride: Double, pixelStride: Double, width: Double, height: Double): PixelBufferPlaneLayout {
+      return PixelBufferPlaneLayout(offset, rowStride, pixelStride, width, height)
+    }
+  }
+}
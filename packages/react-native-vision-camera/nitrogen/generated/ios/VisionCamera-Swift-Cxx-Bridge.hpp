@@ -40,6 +40,8 @@ namespace margelo::nitro::camera { enum class FlashMode; }
 namespace margelo::nitro::camera { enum class FocusResponsiveness; }
 // Forward declaration of `FrameDroppedReason` to properly resolve imports.
 namespace margelo::nitro::camera { enum class FrameDroppedReason; }
+// Forward declaration of `FrameOutputStatistics` to properly resolve imports.
+namespace margelo::nitro::camera { struct FrameOutputStatistics; }
 // Forward declaration of `HybridCameraCalibrationDataSpec` to properly resolve imports.
 namespace margelo::nitro::camera { class HybridCameraCalibrationDataSpec; }
 // Forward declaration of `HybridCameraControllerSpec` to properly resolve imports.
@@ -130,6 +132,8 @@ namespace margelo::nitro::camera { struct NativeBuffer; }
 namespace margelo::nitro::camera { struct PhotoFile; }
 // Forward declaration of `PhotoHDRConstraint` to properly resolve imports.
 namespace margelo::nitro::camera { struct PhotoHDRConstraint; }
+// Forward declaration of `PixelBufferPlaneLayout` to properly resolve imports.
+namespace margelo::nitro::camera { struct PixelBufferPlaneLayout; }
 // Forward declaration of `PixelFormatConstraint` to properly resolve imports.
 namespace margelo::nitro::camera { struct PixelFormatConstraint; }
 // Forward declaration of `PixelFormat` to properly resolve imports.
@@ -269,6 +273,7 @@ namespace VisionCamera { class HybridZoomGestureControllerSpec_cxx; }
 #include "FlashMode.hpp"
 #include "FocusResponsiveness.hpp"
 #include "FrameDroppedReason.hpp"
+#include "FrameOutputStatistics.hpp"
 #include "HybridCameraCalibrationDataSpec.hpp"
 #include "HybridCameraControllerSpec.hpp"
 #include "HybridCameraDepthFrameOutputSpec.hpp"
@@ -313,6 +318,7 @@ namespace VisionCamera { class HybridZoomGestureControllerSpec_cxx; }
 #include "NativeBuffer.hpp"
 #include "PhotoFile.hpp"
 #include "PhotoHDRConstraint.hpp"
+#include "PixelBufferPlaneLayout.hpp"
 #include "PixelFormat.hpp"
 #include "PixelFormatConstraint.hpp"
 #include "Point.hpp"
@@ -1286,6 +1292,17 @@ namespace margelo::nitro::camera::bridge::swift {
   using std__weak_ptr_HybridNativeThreadSpec_ = std::weak_ptr<HybridNativeThreadSpec>;
   inline std__weak_ptr_HybridNativeThreadSpec_ weakify_std__shared_ptr_HybridNativeThreadSpec_(const std::shared_ptr<HybridNativeThreadSpec>& strong) noexcept { return strong; }
   
+  // pragma MARK: std::vector<std::shared_ptr<HybridNativeThreadSpec>>
+  /**
+   * Specialized version of `std::vector<std::shared_ptr<HybridNativeThreadSpec>>`.
+   */
+  using std__vector_std__shared_ptr_HybridNativeThreadSpec__ = std::vector<std::shared_ptr<HybridNativeThreadSpec>>;
+  inline std::vector<std::shared_ptr<HybridNativeThreadSpec>> create_std__vector_std__shared_ptr_HybridNativeThreadSpec__(size_t size) noexcept {
+    std::vector<std::shared_ptr<HybridNativeThreadSpec>> vector;
+    vector.reserve(size);
+    return vector;
+  }
+  
   // pragma MARK: std::shared_ptr<HybridNativeThreadFactorySpec>
   /**
    * Specialized version of `std::shared_ptr<HybridNativeThreadFactorySpec>`.
@@ -1667,6 +1684,26 @@ namespace margelo::nitro::camera::bridge::swift {
     return Result<std::shared_ptr<ArrayBuffer>>::withError(error);
   }
   
+  // pragma MARK: std::vector<PixelBufferPlaneLayout>
+  /**
+   * Specialized version of `std::vector<PixelBufferPlaneLayout>`.
+   */
+  using std__vector_PixelBufferPlaneLayout_ = std::vector<PixelBufferPlaneLayout>;
+  inline std::vector<PixelBufferPlaneLayout> create_std__vector_PixelBufferPlaneLayout_(size_t size) noexcept {
+    std::vector<PixelBufferPlaneLayout> vector;
+    vector.reserve(size);
+    return vector;
+  }
+  
+  // pragma MARK: Result<std::vector<PixelBufferPlaneLayout>>
+  using Result_std__vector_PixelBufferPlaneLayout__ = Result<std::vector<PixelBufferPlaneLayout>>;
+  inline Result_std__vector_PixelBufferPlaneLayout__ create_Result_std__vector_PixelBufferPlaneLayout__(const std::vector<PixelBufferPlaneLayout>& value) noexcept {
+    return Result<std::vector<PixelBufferPlaneLayout>>::withValue(value);
+  }
+  inline Result_std__vector_PixelBufferPlaneLayout__ create_Result_std__vector_PixelBufferPlaneLayout__(const std::exception_ptr& error) noexcept {
+    return Result<std::vector<PixelBufferPlaneLayout>>::withError(error);
+  }
+  
   // pragma MARK: Result<NativeBuffer>
   using Result_NativeBuffer_ = Result<NativeBuffer>;
   inline Result_NativeBuffer_ create_Result_NativeBuffer_(const NativeBuffer& value) noexcept {
@@ -2137,6 +2174,24 @@ namespace margelo::nitro::camera::bridge::swift {
     return optional.value();
   }
   
+  // pragma MARK: Result<FrameOutputStatistics>
+  using Result_FrameOutputStatistics_ = Result<FrameOutputStatistics>;
+  inline Result_FrameOutputStatistics_ create_Result_FrameOutputStatistics_(const FrameOutputStatistics& value) noexcept {
+    return Result<FrameOutputStatistics>::withValue(value);
+  }
+  inline Result_FrameOutputStatistics_ create_Result_FrameOutputStatistics_(const std::exception_ptr& error) noexcept {
+    return Result<FrameOutputStatistics>::withError(error);
+  }
+  
+  // pragma MARK: Result<double>
+  using Result_double_ = Result<double>;
+  inline Result_double_ create_Result_double_(double value) noexcept {
+    return Result<double>::withValue(std::move(value));
+  }
+  inline Result_double_ create_Result_double_(const std::exception_ptr& error) noexcept {
+    return Result<double>::withError(error);
+  }
+  
   // pragma MARK: std::function<bool(const std::shared_ptr<HybridFrameSpec>& /* frame */)>
   /**
    * Specialized version of `std::function<bool(const std::shared_ptr<HybridFrameSpec>&)>`.
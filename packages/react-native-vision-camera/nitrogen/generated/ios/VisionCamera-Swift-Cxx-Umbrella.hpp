@@ -62,10 +62,16 @@ namespace margelo::nitro::camera { enum class FocusMode; }
 namespace margelo::nitro::camera { struct FocusOptions; }
 // Forward declaration of `FocusResponsiveness` to properly resolve imports.
 namespace margelo::nitro::camera { enum class FocusResponsiveness; }
+// Forward declaration of `FrameDropStatistics` to properly resolve imports.
+namespace margelo::nitro::camera { struct FrameDropStatistics; }
 // Forward declaration of `FrameDroppedReason` to properly resolve imports.
 namespace margelo::nitro::camera { enum class FrameDroppedReason; }
+// Forward declaration of `FrameDurationStatistics` to properly resolve imports.
+namespace margelo::nitro::camera { struct FrameDurationStatistics; }
 // Forward declaration of `FrameOutputOptions` to properly resolve imports.
 namespace margelo::nitro::camera { struct FrameOutputOptions; }
+// Forward declaration of `FrameOutputStatistics` to properly resolve imports.
+namespace margelo::nitro::camera { struct FrameOutputStatistics; }
 // Forward declaration of `HybridCameraCalibrationDataSpec` to properly resolve imports.
 namespace margelo::nitro::camera { class HybridCameraCalibrationDataSpec; }
 // Forward declaration of `HybridCameraControllerSpec` to properly resolve imports.
@@ -168,6 +174,8 @@ namespace margelo::nitro::camera { struct PhotoFile; }
 namespace margelo::nitro::camera { struct PhotoHDRConstraint; }
 // Forward declaration of `PhotoOutputOptions` to properly resolve imports.
 namespace margelo::nitro::camera { struct PhotoOutputOptions; }
+// Forward declaration of `PixelBufferPlaneLayout` to properly resolve imports.
+namespace margelo::nitro::camera { struct PixelBufferPlaneLayout; }
 // Forward declaration of `PixelFormatConstraint` to properly resolve imports.
 namespace margelo::nitro::camera { struct PixelFormatConstraint; }
 // Forward declaration of `PixelFormat` to properly resolve imports.
@@ -261,8 +269,11 @@ namespace margelo::nitro::camera { struct WhiteBalanceTemperatureAndTint; }
 #include "FocusMode.hpp"
 #include "FocusOptions.hpp"
 #include "FocusResponsiveness.hpp"
+#include "FrameDropStatistics.hpp"
 #include "FrameDroppedReason.hpp"
+#include "FrameDurationStatistics.hpp"
 #include "FrameOutputOptions.hpp"
+#include "FrameOutputStatistics.hpp"
 #include "HybridCameraCalibrationDataSpec.hpp"
 #include "HybridCameraControllerSpec.hpp"
 #include "HybridCameraDepthFrameOutputSpec.hpp"
@@ -313,6 +324,7 @@ namespace margelo::nitro::camera { struct WhiteBalanceTemperatureAndTint; }
 #include "PhotoFile.hpp"
 #include "PhotoHDRConstraint.hpp"
 #include "PhotoOutputOptions.hpp"
+#include "PixelBufferPlaneLayout.hpp"
 #include "PixelFormat.hpp"
 #include "PixelFormatConstraint.hpp"
 #include "Point.hpp"
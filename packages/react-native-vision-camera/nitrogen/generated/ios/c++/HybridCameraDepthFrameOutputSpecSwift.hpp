@@ -18,6 +18,12 @@ namespace margelo::nitro::camera { class HybridNativeThreadSpec; }
 namespace margelo::nitro::camera { class HybridDepthSpec; }
 // Forward declaration of `FrameDroppedReason` to properly resolve imports.
 namespace margelo::nitro::camera { enum class FrameDroppedReason; }
+// Forward declaration of `FrameOutputStatistics` to properly resolve imports.
+namespace margelo::nitro::camera { struct FrameOutputStatistics; }
+// Forward declaration of `FrameDropStatistics` to properly resolve imports.
+namespace margelo::nitro::camera { struct FrameDropStatistics; }
+// Forward declaration of `FrameDurationStatistics` to properly resolve imports.
+namespace margelo::nitro::camera { struct FrameDurationStatistics; }
 // Forward declaration of `HybridCameraOutputSpecSwift` to properly resolve imports.
 namespace margelo::nitro::camera { class HybridCameraOutputSpecSwift; }
 
@@ -27,6 +33,9 @@ namespace margelo::nitro::camera { class HybridCameraOutputSpecSwift; }
 #include <functional>
 #include <optional>
 #include "FrameDroppedReason.hpp"
+#include "FrameOutputStatistics.hpp"
+#include "FrameDropStatistics.hpp"
+#include "FrameDurationStatistics.hpp"
 #include "HybridCameraOutputSpecSwift.hpp"
 
 #include "VisionCamera-Swift-Cxx-Umbrella.hpp"
@@ -96,6 +105,15 @@ namespace margelo::nitro::camera {
       }
     }
 
+    inline FrameOutputStatistics getStatistics() override {
+      auto __result = _swiftPart.getStatistics();
+      if (__result.hasError()) [[unlikely]] {
+        std::rethrow_exception(__result.error());
+      }
+      auto __value = std::move(__result.value());
+      return __value;
+    }
+
   private:
     VisionCamera::HybridCameraDepthFrameOutputSpec_cxx _swiftPart;
   };
@@ -18,15 +18,25 @@ namespace margelo::nitro::camera { class HybridNativeThreadSpec; }
 namespace margelo::nitro::camera { class HybridFrameSpec; }
 // Forward declaration of `FrameDroppedReason` to properly resolve imports.
 namespace margelo::nitro::camera { enum class FrameDroppedReason; }
+// Forward declaration of `FrameOutputStatistics` to properly resolve imports.
+namespace margelo::nitro::camera { struct FrameOutputStatistics; }
+// Forward declaration of `FrameDropStatistics` to properly resolve imports.
+namespace margelo::nitro::camera { struct FrameDropStatistics; }
+// Forward declaration of `FrameDurationStatistics` to properly resolve imports.
+namespace margelo::nitro::camera { struct FrameDurationStatistics; }
 // Forward declaration of `HybridCameraOutputSpecSwift` to properly resolve imports.
 namespace margelo::nitro::camera { class HybridCameraOutputSpecSwift; }
 
 #include <memory>
 #include "HybridNativeThreadSpec.hpp"
+#include <vector>
 #include "HybridFrameSpec.hpp"
 #include <functional>
 #include <optional>
 #include "FrameDroppedReason.hpp"
+#include "FrameOutputStatistics.hpp"
+#include "FrameDropStatistics.hpp"
+#include "FrameDurationStatistics.hpp"
 #include "HybridCameraOutputSpecSwift.hpp"
 
 #include "VisionCamera-Swift-Cxx-Umbrella.hpp"
@@ -80,6 +90,10 @@ namespace margelo::nitro::camera {
       auto __result = _swiftPart.getThread();
       return __result;
     }
+    inline std::vector<std::shared_ptr<HybridNativeThreadSpec>> getThreads() noexcept override {
+      auto __result = _swiftPart.getThreads();
+      return __result;
+    }
 
   public:
     // Methods
@@ -96,6 +110,23 @@ namespace margelo::nitro::camera {
       }
     }
 
+    inline FrameOutputStatistics getStatistics() override {
+      auto __result = _swiftPart.getStatistics();
+      if (__result.hasError()) [[unlikely]] {
+        std::rethrow_exception(__result.error());
+      }
+      auto __value = std::move(__result.value());
+      return __value;
+    }
+    inline double markFrameCompleted(double timestamp) override {
+      auto __result = _swiftPart.markFrameCompleted(std::forward<decltype(timestamp)>(timestamp));
+      if (__result.hasError()) [[unlikely]] {
+        std::rethrow_exception(__result.error());
+      }
+      auto __value = std::move(__result.value());
+      return __value;
+    }
+
   private:
     VisionCamera::HybridCameraFrameOutputSpec_cxx _swiftPart;
   };
@@ -20,6 +20,8 @@ namespace margelo::nitro::camera { enum class CameraOrientation; }
 namespace margelo::nitro::camera { class HybridFramePlaneSpec; }
 // Forward declaration of `ArrayBufferHolder` to properly resolve imports.
 namespace NitroModules { class ArrayBufferHolder; }
+// Forward declaration of `PixelBufferPlaneLayout` to properly resolve imports.
+namespace margelo::nitro::camera { struct PixelBufferPlaneLayout; }
 // Forward declaration of `NativeBuffer` to properly resolve imports.
 namespace margelo::nitro::camera { struct NativeBuffer; }
 // Forward declaration of `Point` to properly resolve imports.
@@ -33,6 +35,7 @@ namespace margelo::nitro::camera { struct Point; }
 #include "HybridFramePlaneSpec.hpp"
 #include <NitroModules/ArrayBuffer.hpp>
 #include <NitroModules/ArrayBufferHolder.hpp>
+#include "PixelBufferPlaneLayout.hpp"
 #include "NativeBuffer.hpp"
 #include <functional>
 #include "Point.hpp"
@@ -141,6 +144,14 @@ namespace margelo::nitro::camera {
       auto __value = std::move(__result.value());
       return __value;
     }
+    inline std::vector<PixelBufferPlaneLayout> getPixelBufferLayout() override {
+      auto __result = _swiftPart.getPixelBufferLayout();
+      if (__result.hasError()) [[unlikely]] {
+        std::rethrow_exception(__result.error());
+      }
+      auto __value = std::move(__result.value());
+      return __value;
+    }
     inline NativeBuffer getNativeBuffer() override {
       auto __result = _swiftPart.getNativeBuffer();
       if (__result.hasError()) [[unlikely]] {
@@ -0,0 +1,44 @@
+///
+/// FrameDropStatistics.swift
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+import NitroModules
+
+/**
+ * Represents an instance of `FrameDropStatistics`, backed by a C++ struct.
+ */
+public typealias FrameDropStatistics = margelo.nitro.camera.FrameDropStatistics
+
+public extension FrameDropStatistics {
+  private typealias bridge = margelo.nitro.camera.bridge.swift
+
+  /**
+   * Create a new instance of `FrameDropStatistics`.
+   */
+  init(frameWasLate: Double, outOfBuffers: Double, discontinuity: Double, unknown: Double) {
+    self.init(frameWasLate, outOfBuffers, discontinuity, unknown)
+  }
+
+  @inline(__always)
+  var frameWasLate: Double {
+    return self.__frameWasLate
+  }
+  
+  @inline(__always)
+  var outOfBuffers: Double {
+    return self.__outOfBuffers
+  }
+  
+  @inline(__always)
+  var discontinuity: Double {
+    return self.__discontinuity
+  }
+  
+  @inline(__always)
+  var unknown: Double {
+    return self.__unknown
+  }
+}
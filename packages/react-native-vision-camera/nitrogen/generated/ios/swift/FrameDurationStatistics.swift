@@ -0,0 +1,64 @@
+///
+/// FrameDurationStatistics.swift
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+import NitroModules
+
+/**
+ * Represents an instance of `FrameDurationStatistics`, backed by a C++ struct.
+ */
+public typealias FrameDurationStatistics = margelo.nitro.camera.FrameDurationStatistics
+
+public extension FrameDurationStatistics {
+  private typealias bridge = margelo.nitro.camera.bridge.swift
+
+  /**
+   * Create a new instance of `FrameDurationStatistics`.
+   */
+  init(sampleCount: Double, average: Double, standardDeviation: Double, minimum: Double, median: Double, p90: Double, p99: Double, maximum: Double) {
+    self.init(sampleCount, average, standardDeviation, minimum, median, p90, p99, maximum)
+  }
+
+  @inline(__always)
+  var sampleCount: Double {
+    return self.__sampleCount
+  }
+  
+  @inline(__always)
+  var average: Double {
+    return self.__average
+  }
+  
+  @inline(__always)
+  var standardDeviation: Double {
+    return self.__standardDeviation
+  }
+  
+  @inline(__always)
+  var minimum: Double {
+    return self.__minimum
+  }
+  
+  @inline(__always)
+  var median: Double {
+    return self.__median
+  }
+  
+  @inline(__always)
+  var p90: Double {
+    return self.__p90
+  }
+  
+  @inline(__always)
+  var p99: Double {
+    return self.__p99
+  }
+  
+  @inline(__always)
+  var maximum: Double {
+    return self.__maximum
+  }
+}
@@ -18,8 +18,14 @@ public extension FrameOutputOptions {
   /**
    * Create a new instance of `FrameOutputOptions`.
    */
-  init(targetResolution: Size, enablePreviewSizedOutputBuffers: Bool, allowDeferredStart: Bool, pixelFormat: TargetVideoPixelFormat, enablePhysicalBufferRotation: Bool, enableCameraMatrixDelivery: Bool, dropFramesWhileBusy: Bool) {
-    self.init(targetResolution, enablePreviewSizedOutputBuffers, allowDeferredStart, pixelFormat, enablePhysicalBufferRotation, enableCameraMatrixDelivery, dropFramesWhileBusy)
+  init(targetResolution: Size, enablePreviewSizedOutputBuffers: Bool, allowDeferredStart: Bool, pixelFormat: TargetVideoPixelFormat, enablePhysicalBufferRotation: Bool, enableCameraMatrixDelivery: Bool, dropFramesWhileBusy: Bool, parallelism: Double?) {
+    self.init(targetResolution, enablePreviewSizedOutputBuffers, allowDeferredStart, pixelFormat, enablePhysicalBufferRotation, enableCameraMatrixDelivery, dropFramesWhileBusy, { () -> bridge.std__optional_double_ in
+      if let __unwrappedValue = parallelism {
+        return bridge.create_std__optional_double_(__unwrappedValue)
+      } else {
+        return .init()
+      }
+    }())
   }
 
   @inline(__always)
@@ -56,4 +62,16 @@ public extension FrameOutputOptions {
   var dropFramesWhileBusy: Bool {
     return self.__dropFramesWhileBusy
   }
+  
+  @inline(__always)
+  var parallelism: Double? {
+    return { () -> Double? in
+      if bridge.has_value_std__optional_double_(self.__parallelism) {
+        let __unwrapped = bridge.get_std__optional_double_(self.__parallelism)
+        return __unwrapped
+      } else {
+        return nil
+      }
+    }()
+  }
 }
@@ -0,0 +1,59 @@
+///
+/// FrameOutputStatistics.swift
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+import NitroModules
+
+/**
+ * Represents an instance of `FrameOutputStatistics`, backed by a C++ struct.
+ */
+public typealias FrameOutputStatistics = margelo.nitro.camera.FrameOutputStatistics
+
+public extension FrameOutputStatistics {
+  private typealias bridge = margelo.nitro.camera.bridge.swift
+
+  /**
+   * Create a new instance of `FrameOutputStatistics`.
+   */
+  init(framesDelivered: Double, framesDropped: Double, framesInFlight: Double, droppedFrames: FrameDropStatistics, deliveryLatency: FrameDurationStatistics, callbackDuration: FrameDurationStatistics, frameInterval: FrameDurationStatistics) {
+    self.init(framesDelivered, framesDropped, framesInFlight, droppedFrames, deliveryLatency, callbackDuration, frameInterval)
+  }
+
+  @inline(__always)
+  var framesDelivered: Double {
+    return self.__framesDelivered
+  }
+  
+  @inline(__always)
+  var framesDropped: Double {
+    return self.__framesDropped
+  }
+  
+  @inline(__always)
+  var framesInFlight: Double {
+    return self.__framesInFlight
+  }
+  
+  @inline(__always)
+  var droppedFrames: FrameDropStatistics {
+    return self.__droppedFrames
+  }
+  
+  @inline(__always)
+  var deliveryLatency: FrameDurationStatistics {
+    return self.__deliveryLatency
+  }
+  
+  @inline(__always)
+  var callbackDuration: FrameDurationStatistics {
+    return self.__callbackDuration
+  }
+  
+  @inline(__always)
+  var frameInterval: FrameDurationStatistics {
+    return self.__frameInterval
+  }
+}
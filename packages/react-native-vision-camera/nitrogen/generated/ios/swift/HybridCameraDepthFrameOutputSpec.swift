@@ -15,6 +15,7 @@ public protocol HybridCameraDepthFrameOutputSpec_protocol: HybridObject, HybridC
   // Methods
   func setOnDepthFrameCallback(onDepthFrame: ((_ depth: (any HybridDepthSpec)) -> Bool)?) throws -> Void
   func setOnDepthFrameDroppedCallback(onDepthFrameDropped: ((_ reason: FrameDroppedReason) -> Void)?) throws -> Void
+  func getStatistics() throws -> FrameOutputStatistics
 }
 
 public extension HybridCameraDepthFrameOutputSpec_protocol {
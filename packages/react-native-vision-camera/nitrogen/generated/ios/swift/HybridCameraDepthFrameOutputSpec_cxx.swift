@@ -184,4 +184,16 @@ open class HybridCameraDepthFrameOutputSpec_cxx : HybridCameraOutputSpec_cxx {
       return bridge.create_Result_void_(__exceptionPtr)
     }
   }
+  
+  @inline(__always)
+  public final func getStatistics() -> bridge.Result_FrameOutputStatistics_ {
+    do {
+      let __result = try self.__implementation.getStatistics()
+      let __resultCpp = __result
+      return bridge.create_Result_FrameOutputStatistics_(__resultCpp)
+    } catch (let __error) {
+      let __exceptionPtr = __error.toCpp()
+      return bridge.create_Result_FrameOutputStatistics_(__exceptionPtr)
+    }
+  }
 }
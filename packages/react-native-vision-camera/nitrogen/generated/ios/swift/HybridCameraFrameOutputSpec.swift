@@ -11,10 +11,13 @@ import NitroModules
 public protocol HybridCameraFrameOutputSpec_protocol: HybridObject, HybridCameraOutputSpec_protocol {
   // Properties
   var thread: (any HybridNativeThreadSpec) { get }
+  var threads: [(any HybridNativeThreadSpec)] { get }
 
   // Methods
   func setOnFrameCallback(onFrame: ((_ frame: (any HybridFrameSpec)) -> Bool)?) throws -> Void
   func setOnFrameDroppedCallback(onFrameDropped: ((_ reason: FrameDroppedReason) -> Void)?) throws -> Void
+  func getStatistics() throws -> FrameOutputStatistics
+  func markFrameCompleted(timestamp: Double) throws -> Double
 }
 
 public extension HybridCameraFrameOutputSpec_protocol {
@@ -133,6 +133,22 @@ open class HybridCameraFrameOutputSpec_cxx : HybridCameraOutputSpec_cxx {
       }()
     }
   }
+  
+  public final var threads: bridge.std__vector_std__shared_ptr_HybridNativeThreadSpec__ {
+    @inline(__always)
+    get {
+      return { () -> bridge.std__vector_std__shared_ptr_HybridNativeThreadSpec__ in
+        var __vector = bridge.create_std__vector_std__shared_ptr_HybridNativeThreadSpec__(self.__implementation.threads.count)
+        for __item in self.__implementation.threads {
+          __vector.push_back({ () -> bridge.std__shared_ptr_HybridNativeThreadSpec_ in
+            let __cxxWrapped = __item.getCxxWrapper()
+            return __cxxWrapped.getCxxPart()
+          }())
+        }
+        return __vector
+      }()
+    }
+  }
 
   // Methods
   @inline(__always)
@@ -184,4 +200,28 @@ open class HybridCameraFrameOutputSpec_cxx : HybridCameraOutputSpec_cxx {
       return bridge.create_Result_void_(__exceptionPtr)
     }
   }
+  
+  @inline(__always)
+  public final func getStatistics() -> bridge.Result_FrameOutputStatistics_ {
+    do {
+      let __result = try self.__implementation.getStatistics()
+      let __resultCpp = __result
+      return bridge.create_Result_FrameOutputStatistics_(__resultCpp)
+    } catch (let __error) {
+      let __exceptionPtr = __error.toCpp()
+      return bridge.create_Result_FrameOutputStatistics_(__exceptionPtr)
+    }
+  }
+  
+  @inline(__always)
+  public final func markFrameCompleted(timestamp: Double) -> bridge.Result_double_ {
+    do {
+      let __result = try self.__implementation.markFrameCompleted(timestamp: timestamp)
+      let __resultCpp = __result
+      return bridge.create_Result_double_(__resultCpp)
+    } catch (let __error) {
+      let __exceptionPtr = __error.toCpp()
+      return bridge.create_Result_double_(__exceptionPtr)
+    }
+  }
 }
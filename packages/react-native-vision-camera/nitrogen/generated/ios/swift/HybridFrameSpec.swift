@@ -26,6 +26,7 @@ public protocol HybridFrameSpec_protocol: HybridObject {
   // Methods
   func getPlanes() throws -> [(any HybridFramePlaneSpec)]
   func getPixelBuffer() throws -> ArrayBuffer
+  func getPixelBufferLayout() throws -> [PixelBufferPlaneLayout]
   func getNativeBuffer() throws -> NativeBuffer
   func convertCameraPointToFramePoint(cameraPoint: Point) throws -> Point
   func convertFramePointToCameraPoint(framePoint: Point) throws -> Point
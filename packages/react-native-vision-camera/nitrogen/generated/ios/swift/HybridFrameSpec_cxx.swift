@@ -251,6 +251,24 @@ open class HybridFrameSpec_cxx {
     }
   }
   
+  @inline(__always)
+  public final func getPixelBufferLayout() -> bridge.Result_std__vector_PixelBufferPlaneLayout__ {
+    do {
+      let __result = try self.__implementation.getPixelBufferLayout()
+      let __resultCpp = { () -> bridge.std__vector_PixelBufferPlaneLayout_ in
+        var __vector = bridge.create_std__vector_PixelBufferPlaneLayout_(__result.count)
+        for __item in __result {
+          __vector.push_back(__item)
+        }
+        return __vector
+      }()
+      return bridge.create_Result_std__vector_PixelBufferPlaneLayout__(__resultCpp)
+    } catch (let __error) {
+      let __exceptionPtr = __error.toCpp()
+      return bridge.create_Result_std__vector_PixelBufferPlaneLayout__(__exceptionPtr)
+    }
+  }
+  
   @inline(__always)
   public final func getNativeBuffer() -> bridge.Result_NativeBuffer_ {
     do {
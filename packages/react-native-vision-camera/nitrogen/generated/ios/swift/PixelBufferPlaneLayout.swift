@@ -0,0 +1,49 @@
+///
+/// PixelBufferPlaneLayout.swift
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+import NitroModules
+
+/**
+ * Represents an instance of `PixelBufferPlaneLayout`, backed by a C++ struct.
+ */
+public typealias PixelBufferPlaneLayout = margelo.nitro.camera.PixelBufferPlaneLayout
+
+public extension PixelBufferPlaneLayout {
+  private typealias bridge = margelo.nitro.camera.bridge.swift
+
+  /**
+   * Create a new instance of `PixelBufferPlaneLayout`.
+   */
+  init(offset: Double, rowStride: Double, pixelStride: Double, width: Double, height: Double) {
+    self.init(offset, rowStride, pixelStride, width, height)
+  }
+
+  @inline(__always)
+  var offset: Double {
+    return self.__offset
+  }
+  
+  @inline(__always)
+  var rowStride: Double {
+    return self.__rowStride
+  }
+  
+  @inline(__always)
+  var pixelStride: Double {
+    return self.__pixelStride
+  }
+  
+  @inline(__always)
+  var width: Double {
+    return self.__width
+  }
+  
+  @inline(__always)
+  var height: Double {
+    return self.__height
+  }
+}
@@ -0,0 +1,95 @@
+///
+/// FrameDropStatistics.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+
+
+namespace margelo::nitro::camera {
+
+  /**
+   * A struct which can be represented as a JavaScript object (FrameDropStatistics).
+   */
+  struct FrameDropStatistics final {
+  public:
+    double frameWasLate     SWIFT_PRIVATE;
+    double outOfBuffers     SWIFT_PRIVATE;
+    double discontinuity     SWIFT_PRIVATE;
+    double unknown     SWIFT_PRIVATE;
+
+  public:
+    FrameDropStatistics() = default;
+    explicit FrameDropStatistics(double frameWasLate, double outOfBuffers, double discontinuity, double unknown): frameWasLate(frameWasLate), outOfBuffers(outOfBuffers), discontinuity(discontinuity), unknown(unknown) {}
+
+  public:
+    friend bool operator==(const FrameDropStatistics& lhs, const FrameDropStatistics& rhs) = default;
+  };
+
+} // namespace margelo::nitro::camera
+
+namespace margelo::nitro {
+
+  // C++ FrameDropStatistics <> JS FrameDropStatistics (object)
+  template <>
+  struct JSIConverter<margelo::nitro::camera::FrameDropStatistics> final {
+    static inline margelo::nitro::camera::FrameDropStatistics fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::camera::FrameDropStatistics(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "frameWasLate"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "outOfBuffers"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "discontinuity"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "unknown")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::camera::FrameDropStatistics& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "frameWasLate"), JSIConverter<double>::toJSI(runtime, arg.frameWasLate));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "outOfBuffers"), JSIConverter<double>::toJSI(runtime, arg.outOfBuffers));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "discontinuity"), JSIConverter<double>::toJSI(runtime, arg.discontinuity));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "unknown"), JSIConverter<double>::toJSI(runtime, arg.unknown));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "frameWasLate")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "outOfBuffers")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "discontinuity")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "unknown")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,111 @@
+///
+/// FrameDurationStatistics.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+
+
+namespace margelo::nitro::camera {
+
+  /**
+   * A struct which can be represented as a JavaScript object (FrameDurationStatistics).
+   */
+  struct FrameDurationStatistics final {
+  public:
+    double sampleCount     SWIFT_PRIVATE;
+    double average     SWIFT_PRIVATE;
+    double standardDeviation     SWIFT_PRIVATE;
+    double minimum     SWIFT_PRIVATE;
+    double median     SWIFT_PRIVATE;
+    double p90     SWIFT_PRIVATE;
+    double p99     SWIFT_PRIVATE;
+    double maximum     SWIFT_PRIVATE;
+
+  public:
+    FrameDurationStatistics() = default;
+    explicit FrameDurationStatistics(double sampleCount, double average, double standardDeviation, double minimum, double median, double p90, double p99, double maximum): sampleCount(sampleCount), average(average), standardDeviation(standardDeviation), minimum(minimum), median(median), p90(p90), p99(p99), maximum(maximum) {}
+
+  public:
+    friend bool operator==(const FrameDurationStatistics& lhs, const FrameDurationStatistics& rhs) = default;
+  };
+
+} // namespace margelo::nitro::camera
+
+namespace margelo::nitro {
+
+  // C++ FrameDurationStatistics <> JS FrameDurationStatistics (object)
+  template <>
+  struct JSIConverter<margelo::nitro::camera::FrameDurationStatistics> final {
+    static inline margelo::nitro::camera::FrameDurationStatistics fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::camera::FrameDurationStatistics(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "sampleCount"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "average"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "standardDeviation"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "minimum"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "median"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "p90"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "p99"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "maximum")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::camera::FrameDurationStatistics& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "sampleCount"), JSIConverter<double>::toJSI(runtime, arg.sampleCount));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "average"), JSIConverter<double>::toJSI(runtime, arg.average));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "standardDeviation"), JSIConverter<double>::toJSI(runtime, arg.standardDeviation));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "minimum"), JSIConverter<double>::toJSI(runtime, arg.minimum));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "median"), JSIConverter<double>::toJSI(runtime, arg.median));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "p90"), JSIConverter<double>::toJSI(runtime, arg.p90));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "p99"), JSIConverter<double>::toJSI(runtime, arg.p99));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "maximum"), JSIConverter<double>::toJSI(runtime, arg.maximum));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "sampleCount")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "average")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "standardDeviation")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "minimum")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "median")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "p90")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "p99")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "maximum")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
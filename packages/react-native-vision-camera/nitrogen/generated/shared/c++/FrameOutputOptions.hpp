@@ -35,6 +35,7 @@ namespace margelo::nitro::camera { enum class TargetVideoPixelFormat; }
 
 #include "Size.hpp"
 #include "TargetVideoPixelFormat.hpp"
+#include <optional>
 
 namespace margelo::nitro::camera {
 
@@ -50,10 +51,11 @@ namespace margelo::nitro::camera {
     bool enablePhysicalBufferRotation     SWIFT_PRIVATE;
     bool enableCameraMatrixDelivery     SWIFT_PRIVATE;
     bool dropFramesWhileBusy     SWIFT_PRIVATE;
+    std::optional<double> parallelism     SWIFT_PRIVATE;
 
   public:
     FrameOutputOptions() = default;
-    explicit FrameOutputOptions(Size targetResolution, bool enablePreviewSizedOutputBuffers, bool allowDeferredStart, TargetVideoPixelFormat pixelFormat, bool enablePhysicalBufferRotation, bool enableCameraMatrixDelivery, bool dropFramesWhileBusy): targetResolution(targetResolution), enablePreviewSizedOutputBuffers(enablePreviewSizedOutputBuffers), allowDeferredStart(allowDeferredStart), pixelFormat(pixelFormat), enablePhysicalBufferRotation(enablePhysicalBufferRotation), enableCameraMatrixDelivery(enableCameraMatrixDelivery), dropFramesWhileBusy(dropFramesWhileBusy) {}
+    explicit FrameOutputOptions(Size targetResolution, bool enablePreviewSizedOutputBuffers, bool allowDeferredStart, TargetVideoPixelFormat pixelFormat, bool enablePhysicalBufferRotation, bool enableCameraMatrixDelivery, bool dropFramesWhileBusy, std::optional<double> parallelism): targetResolution(targetResolution), enablePreviewSizedOutputBuffers(enablePreviewSizedOutputBuffers), allowDeferredStart(allowDeferredStart), pixelFormat(pixelFormat), enablePhysicalBufferRotation(enablePhysicalBufferRotation), enableCameraMatrixDelivery(enableCameraMatrixDelivery), dropFramesWhileBusy(dropFramesWhileBusy), parallelism(parallelism) {}
 
   public:
     friend bool operator==(const FrameOutputOptions& lhs, const FrameOutputOptions& rhs) = default;
@@ -75,7 +77,8 @@ namespace margelo::nitro {
         JSIConverter<margelo::nitro::camera::TargetVideoPixelFormat>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "pixelFormat"))),
         JSIConverter<bool>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "enablePhysicalBufferRotation"))),
         JSIConverter<bool>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "enableCameraMatrixDelivery"))),
-        JSIConverter<bool>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "dropFramesWhileBusy")))
+        JSIConverter<bool>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "dropFramesWhileBusy"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "parallelism")))
       );
     }
     static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::camera::FrameOutputOptions& arg) {
@@ -87,6 +90,7 @@ namespace margelo::nitro {
       obj.setProperty(runtime, PropNameIDCache::get(runtime, "enablePhysicalBufferRotation"), JSIConverter<bool>::toJSI(runtime, arg.enablePhysicalBufferRotation));
       obj.setProperty(runtime, PropNameIDCache::get(runtime, "enableCameraMatrixDelivery"), JSIConverter<bool>::toJSI(runtime, arg.enableCameraMatrixDelivery));
       obj.setProperty(runtime, PropNameIDCache::get(runtime, "dropFramesWhileBusy"), JSIConverter<bool>::toJSI(runtime, arg.dropFramesWhileBusy));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "parallelism"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.parallelism));
       return obj;
     }
     static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
@@ -104,6 +108,7 @@ namespace margelo::nitro {
       if (!JSIConverter<bool>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "enablePhysicalBufferRotation")))) return false;
       if (!JSIConverter<bool>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "enableCameraMatrixDelivery")))) return false;
       if (!JSIConverter<bool>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "dropFramesWhileBusy")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "parallelism")))) return false;
       return true;
     }
   };
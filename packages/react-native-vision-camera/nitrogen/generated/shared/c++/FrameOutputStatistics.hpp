@@ -0,0 +1,111 @@
+///
+/// FrameOutputStatistics.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `FrameDropStatistics` to properly resolve imports.
+namespace margelo::nitro::camera { struct FrameDropStatistics; }
+// Forward declaration of `FrameDurationStatistics` to properly resolve imports.
+namespace margelo::nitro::camera { struct FrameDurationStatistics; }
+
+#include "FrameDropStatistics.hpp"
+#include "FrameDurationStatistics.hpp"
+
+namespace margelo::nitro::camera {
+
+  /**
+   * A struct which can be represented as a JavaScript object (FrameOutputStatistics).
+   */
+  struct FrameOutputStatistics final {
+  public:
+    double framesDelivered     SWIFT_PRIVATE;
+    double framesDropped     SWIFT_PRIVATE;
+    double framesInFlight     SWIFT_PRIVATE;
+    FrameDropStatistics droppedFrames     SWIFT_PRIVATE;
+    FrameDurationStatistics deliveryLatency     SWIFT_PRIVATE;
+    FrameDurationStatistics callbackDuration     SWIFT_PRIVATE;
+    FrameDurationStatistics frameInterval     SWIFT_PRIVATE;
+
+  public:
+    FrameOutputStatistics() = default;
+    explicit FrameOutputStatistics(double framesDelivered, double framesDropped, double framesInFlight, FrameDropStatistics droppedFrames, FrameDurationStatistics deliveryLatency, FrameDurationStatistics callbackDuration, FrameDurationStatistics frameInterval): framesDelivered(framesDelivered), framesDropped(framesDropped), framesInFlight(framesInFlight), droppedFrames(droppedFrames), deliveryLatency(deliveryLatency), callbackDuration(callbackDuration), frameInterval(frameInterval) {}
+
+  public:
+    friend bool operator==(const FrameOutputStatistics& lhs, const FrameOutputStatistics& rhs) = default;
+  };
+
+} // namespace margelo::nitro::camera
+
+namespace margelo::nitro {
+
+  // C++ FrameOutputStatistics <> JS FrameOutputStatistics (object)
+  template <>
+  struct JSIConverter<margelo::nitro::camera::FrameOutputStatistics> final {
+    static inline margelo::nitro::camera::FrameOutputStatistics fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::camera::FrameOutputStatistics(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "framesDelivered"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "framesDropped"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "framesInFlight"))),
+        JSIConverter<margelo::nitro::camera::FrameDropStatistics>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "droppedFrames"))),
+        JSIConverter<margelo::nitro::camera::FrameDurationStatistics>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "deliveryLatency"))),
+        JSIConverter<margelo::nitro::camera::FrameDurationStatistics>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "callbackDuration"))),
+        JSIConverter<margelo::nitro::camera::FrameDurationStatistics>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "frameInterval")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::camera::FrameOutputStatistics& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "framesDelivered"), JSIConverter<double>::toJSI(runtime, arg.framesDelivered));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "framesDropped"), JSIConverter<double>::toJSI(runtime, arg.framesDropped));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "framesInFlight"), JSIConverter<double>::toJSI(runtime, arg.framesInFlight));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "droppedFrames"), JSIConverter<margelo::nitro::camera::FrameDropStatistics>::toJSI(runtime, arg.droppedFrames));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "deliveryLatency"), JSIConverter<margelo::nitro::camera::FrameDurationStatistics>::toJSI(runtime, arg.deliveryLatency));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "callbackDuration"), JSIConverter<margelo::nitro::camera::FrameDurationStatistics>::toJSI(runtime, arg.callbackDuration));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "frameInterval"), JSIConverter<margelo::nitro::camera::FrameDurationStatistics>::toJSI(runtime, arg.frameInterval));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "framesDelivered")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "framesDropped")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "framesInFlight")))) return false;
+      if (!JSIConverter<margelo::nitro::camera::FrameDropStatistics>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "droppedFrames")))) return false;
+      if (!JSIConverter<margelo::nitro::camera::FrameDurationStatistics>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "deliveryLatency")))) return false;
+      if (!JSIConverter<margelo::nitro::camera::FrameDurationStatistics>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "callbackDuration")))) return false;
+      if (!JSIConverter<margelo::nitro::camera::FrameDurationStatistics>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "frameInterval")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
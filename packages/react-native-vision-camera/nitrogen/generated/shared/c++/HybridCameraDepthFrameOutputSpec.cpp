@@ -18,6 +18,7 @@ namespace margelo::nitro::camera {
       prototype.registerHybridGetter("thread", &HybridCameraDepthFrameOutputSpec::getThread);
       prototype.registerHybridMethod("setOnDepthFrameCallback", &HybridCameraDepthFrameOutputSpec::setOnDepthFrameCallback);
       prototype.registerHybridMethod("setOnDepthFrameDroppedCallback", &HybridCameraDepthFrameOutputSpec::setOnDepthFrameDroppedCallback);
+      prototype.registerHybridMethod("getStatistics", &HybridCameraDepthFrameOutputSpec::getStatistics);
     });
   }
 
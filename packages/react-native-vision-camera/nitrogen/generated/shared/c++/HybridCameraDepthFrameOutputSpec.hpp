@@ -19,6 +19,8 @@ namespace margelo::nitro::camera { class HybridNativeThreadSpec; }
 namespace margelo::nitro::camera { class HybridDepthSpec; }
 // Forward declaration of `FrameDroppedReason` to properly resolve imports.
 namespace margelo::nitro::camera { enum class FrameDroppedReason; }
+// Forward declaration of `FrameOutputStatistics` to properly resolve imports.
+namespace margelo::nitro::camera { struct FrameOutputStatistics; }
 // Forward declaration of `HybridCameraOutputSpec` to properly resolve imports.
 namespace margelo::nitro::camera { class HybridCameraOutputSpec; }
 
@@ -28,6 +30,7 @@ namespace margelo::nitro::camera { class HybridCameraOutputSpec; }
 #include <functional>
 #include <optional>
 #include "FrameDroppedReason.hpp"
+#include "FrameOutputStatistics.hpp"
 #include "HybridCameraOutputSpec.hpp"
 
 namespace margelo::nitro::camera {
@@ -63,6 +66,7 @@ namespace margelo::nitro::camera {
       // Methods
       virtual void setOnDepthFrameCallback(const std::optional<std::function<bool(const std::shared_ptr<HybridDepthSpec>& /* depth */)>>& onDepthFrame) = 0;
       virtual void setOnDepthFrameDroppedCallback(const std::optional<std::function<void(FrameDroppedReason /* reason */)>>& onDepthFrameDropped) = 0;
+      virtual FrameOutputStatistics getStatistics() = 0;
 
     protected:
       // Hybrid Setup
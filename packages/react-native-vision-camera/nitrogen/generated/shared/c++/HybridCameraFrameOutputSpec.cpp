@@ -16,8 +16,11 @@ namespace margelo::nitro::camera {
     // load custom methods/properties
     registerHybrids(this, [](Prototype& prototype) {
       prototype.registerHybridGetter("thread", &HybridCameraFrameOutputSpec::getThread);
+      prototype.registerHybridGetter("threads", &HybridCameraFrameOutputSpec::getThreads);
       prototype.registerHybridMethod("setOnFrameCallback", &HybridCameraFrameOutputSpec::setOnFrameCallback);
       prototype.registerHybridMethod("setOnFrameDroppedCallback", &HybridCameraFrameOutputSpec::setOnFrameDroppedCallback);
+      prototype.registerHybridMethod("getStatistics", &HybridCameraFrameOutputSpec::getStatistics);
+      prototype.registerHybridMethod("markFrameCompleted", &HybridCameraFrameOutputSpec::markFrameCompleted);
     });
   }
 
@@ -19,15 +19,19 @@ namespace margelo::nitro::camera { class HybridNativeThreadSpec; }
 namespace margelo::nitro::camera { class HybridFrameSpec; }
 // Forward declaration of `FrameDroppedReason` to properly resolve imports.
 namespace margelo::nitro::camera { enum class FrameDroppedReason; }
+// Forward declaration of `FrameOutputStatistics` to properly resolve imports.
+namespace margelo::nitro::camera { struct FrameOutputStatistics; }
 // Forward declaration of `HybridCameraOutputSpec` to properly resolve imports.
 namespace margelo::nitro::camera { class HybridCameraOutputSpec; }
 
 #include <memory>
 #include "HybridNativeThreadSpec.hpp"
+#include <vector>
 #include "HybridFrameSpec.hpp"
 #include <functional>
 #include <optional>
 #include "FrameDroppedReason.hpp"
+#include "FrameOutputStatistics.hpp"
 #include "HybridCameraOutputSpec.hpp"
 
 namespace margelo::nitro::camera {
@@ -58,11 +62,14 @@ namespace margelo::nitro::camera {
     public:
       // Properties
       virtual std::shared_ptr<HybridNativeThreadSpec> getThread() = 0;
+      virtual std::vector<std::shared_ptr<HybridNativeThreadSpec>> getThreads() = 0;
 
     public:
       // Methods
       virtual void setOnFrameCallback(const std::optional<std::function<bool(const std::shared_ptr<HybridFrameSpec>& /* frame */)>>& onFrame) = 0;
       virtual void setOnFrameDroppedCallback(const std::optional<std::function<void(FrameDroppedReason /* reason */)>>& onFrameDropped) = 0;
+      virtual FrameOutputStatistics getStatistics() = 0;
+      virtual double markFrameCompleted(double timestamp) = 0;
 
     protected:
       // Hybrid Setup
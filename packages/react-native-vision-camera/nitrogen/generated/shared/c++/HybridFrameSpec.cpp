@@ -28,6 +28,7 @@ namespace margelo::nitro::camera {
       prototype.registerHybridGetter("cameraIntrinsicMatrix", &HybridFrameSpec::getCameraIntrinsicMatrix);
       prototype.registerHybridMethod("getPlanes", &HybridFrameSpec::getPlanes);
       prototype.registerHybridMethod("getPixelBuffer", &HybridFrameSpec::getPixelBuffer);
+      prototype.registerHybridMethod("getPixelBufferLayout", &HybridFrameSpec::getPixelBufferLayout);
       prototype.registerHybridMethod("getNativeBuffer", &HybridFrameSpec::getNativeBuffer);
       prototype.registerHybridMethod("convertCameraPointToFramePoint", &HybridFrameSpec::convertCameraPointToFramePoint);
       prototype.registerHybridMethod("convertFramePointToCameraPoint", &HybridFrameSpec::convertFramePointToCameraPoint);
@@ -19,6 +19,8 @@ namespace margelo::nitro::camera { enum class PixelFormat; }
 namespace margelo::nitro::camera { enum class CameraOrientation; }
 // Forward declaration of `HybridFramePlaneSpec` to properly resolve imports.
 namespace margelo::nitro::camera { class HybridFramePlaneSpec; }
+// Forward declaration of `PixelBufferPlaneLayout` to properly resolve imports.
+namespace margelo::nitro::camera { struct PixelBufferPlaneLayout; }
 // Forward declaration of `NativeBuffer` to properly resolve imports.
 namespace margelo::nitro::camera { struct NativeBuffer; }
 // Forward declaration of `Point` to properly resolve imports.
@@ -31,6 +33,7 @@ namespace margelo::nitro::camera { struct Point; }
 #include <memory>
 #include "HybridFramePlaneSpec.hpp"
 #include <NitroModules/ArrayBuffer.hpp>
+#include "PixelBufferPlaneLayout.hpp"
 #include "NativeBuffer.hpp"
 #include "Point.hpp"
 
@@ -78,6 +81,7 @@ namespace margelo::nitro::camera {
       // Methods
       virtual std::vector<std::shared_ptr<HybridFramePlaneSpec>> getPlanes() = 0;
       virtual std::shared_ptr<ArrayBuffer> getPixelBuffer() = 0;
+      virtual std::vector<PixelBufferPlaneLayout> getPixelBufferLayout() = 0;
       virtual NativeBuffer getNativeBuffer() = 0;
       virtual Point convertCameraPointToFramePoint(const Point& cameraPoint) = 0;
       virtual Point convertFramePointToCameraPoint(const Point& framePoint) = 0;
@@ -0,0 +1,99 @@
+///
+/// PixelBufferPlaneLayout.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+
+
+namespace margelo::nitro::camera {
+
+  /**
+   * A struct which can be represented as a JavaScript object (PixelBufferPlaneLayout).
+   */
+  struct PixelBufferPlaneLayout final {
+  public:
+    double offset     SWIFT_PRIVATE;
+    double rowStride     SWIFT_PRIVATE;
+    double pixelStride     SWIFT_PRIVATE;
+    double width     SWIFT_PRIVATE;
+    double height     SWIFT_PRIVATE;
+
+  public:
+    PixelBufferPlaneLayout() = default;
+    explicit PixelBufferPlaneLayout(double offset, double rowStride, double pixelStride, double width, double height): offset(offset), rowStride(rowStride), pixelStride(pixelStride), width(width), height(height) {}
+
+  public:
+    friend bool operator==(const PixelBufferPlaneLayout& lhs, const PixelBufferPlaneLayout& rhs) = default;
+  };
+
+} // namespace margelo::nitro::camera
+
+namespace margelo::nitro {
+
+  // C++ PixelBufferPlaneLayout <> JS PixelBufferPlaneLayout (object)
+  template <>
+  struct JSIConverter<margelo::nitro::camera::PixelBufferPlaneLayout> final {
+    static inline margelo::nitro::camera::PixelBufferPlaneLayout fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::camera::PixelBufferPlaneLayout(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "offset"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "rowStride"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "pixelStride"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "width"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "height")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::camera::PixelBufferPlaneLayout& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "offset"), JSIConverter<double>::toJSI(runtime, arg.offset));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "rowStride"), JSIConverter<double>::toJSI(runtime, arg.rowStride));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "pixelStride"), JSIConverter<double>::toJSI(runtime, arg.pixelStride));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "width"), JSIConverter<double>::toJSI(runtime, arg.width));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "height"), JSIConverter<double>::toJSI(runtime, arg.height));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "offset")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "rowStride")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "pixelStride")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "width")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "height")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
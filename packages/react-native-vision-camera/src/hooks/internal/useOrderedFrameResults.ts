@@ -0,0 +1,49 @@
+import { useMemo, useRef } from 'react'
+import type { Frame } from '../../specs/instances/Frame.nitro'
+import type {
+  CameraFrameOutput,
+  FrameOutputOptions,
+} from '../../specs/outputs/CameraFrameOutput.nitro'
+
+/**
+ * Returns a JS-Thread callback that receives Frame Processor results
+ * in any order, and forwards them to {@linkcode onFrameResult} in the
+ * order their {@linkcode Frame}s were captured.
+ *
+ * With a {@linkcode FrameOutputOptions.parallelism | parallelism} greater
+ * than `1`, {@linkcode Frame}s are processed on multiple threads at once,
+ * so a fast {@linkcode Frame} can finish before an earlier, slow one.
+ * Results are buffered by timestamp until the {@linkcode CameraFrameOutput}
+ * reports that all earlier results are in (see
+ * {@linkcode CameraFrameOutput.markFrameCompleted | markFrameCompleted(...)}).
+ *
+ * Returns `undefined` if there is no {@linkcode onFrameResult} callback,
+ * so results don't need to be sent to the JS Thread at all.
+ */
+export function useOrderedFrameResults<TResult>(
+  frameOutput: CameraFrameOutput,
+  onFrameResult: ((result: TResult, timestamp: number) => void) | undefined,
+): ((timestamp: number, result: unknown) => void) | undefined {
+  const onFrameResultRef = useRef(onFrameResult)
+  onFrameResultRef.current = onFrameResult
+  const hasOnFrameResult = onFrameResult != null
+
+  return useMemo(() => {
+    if (!hasOnFrameResult) return undefined
+    const pendingResults = new Map<number, unknown>()
+    return (timestamp: number, result: unknown) => {
+      pendingResults.set(timestamp, result)
+      const releaseUpTo = frameOutput.markFrameCompleted(timestamp)
+      if (releaseUpTo < 0) return
+
+      const timestamps = Array.from(pendingResults.keys())
+        .filter((t) => t <= releaseUpTo)
+        .sort((a, b) => a - b)
+      for (const t of timestamps) {
+        const pendingResult = pendingResults.get(t) as TResult
+        pendingResults.delete(t)
+        onFrameResultRef.current?.(pendingResult, t)
+      }
+    }
+  }, [frameOutput, hasOnFrameResult])
+}
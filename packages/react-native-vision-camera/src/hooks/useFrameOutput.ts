@@ -15,8 +15,10 @@ import { VisionCameraWorkletsProxy } from '../third-party/VisionCameraWorkletsPr
 import { CommonResolutions } from '../utils/CommonResolutions'
 import { VisionCamera } from '../VisionCamera'
 import { useMemoizedSize } from './internal/useMemoizedSize'
+import { useOrderedFrameResults } from './internal/useOrderedFrameResults'
 
-export interface UseFrameOutputProps extends Partial<FrameOutputOptions> {
+export interface UseFrameOutputProps<TResult = void>
+  extends Partial<FrameOutputOptions> {
   /**
    * A callback that will be called for every {@linkcode Frame}
    * the Camera sees.
@@ -25,6 +27,9 @@ export interface UseFrameOutputProps extends Partial<FrameOutputOptions> {
    *
    * The {@linkcode Frame} must be disposed as soon as it
    * is no longer needed to avoid stalling the Camera pipeline.
+   *
+   * Its return value is passed to
+   * {@linkcode UseFrameOutputProps.onFrameResult | onFrameResult(...)}.
    * @worklet
    * @example
    * ```ts
@@ -37,7 +42,34 @@ export interface UseFrameOutputProps extends Partial<FrameOutputOptions> {
    * })
    * ```
    */
-  onFrame?: (frame: Frame) => void
+  onFrame?: (frame: Frame) => TResult
+  /**
+   * A callback that will be called on the JS Thread with the
+   * return value of {@linkcode UseFrameOutputProps.onFrame | onFrame(...)}
+   * for every {@linkcode Frame}.
+   *
+   * Results are always delivered in the order the {@linkcode Frame}s
+   * were captured - even if {@linkcode FrameOutputOptions.parallelism | parallelism}
+   * is greater than `1` and a later {@linkcode Frame} finished first.
+   * If {@linkcode UseFrameOutputProps.onFrame | onFrame(...)} threw, `result`
+   * is `undefined`.
+   * @example
+   * ```ts
+   * const frameOutput = useFrameOutput({
+   *   parallelism: 3,
+   *   onFrame(frame) {
+   *     'worklet'
+   *     const faces = faceDetector.detectFaces(frame)
+   *     frame.dispose()
+   *     return faces.length
+   *   },
+   *   onFrameResult(faceCount) {
+   *     setFaceCount(faceCount)
+   *   }
+   * })
+   * ```
+   */
+  onFrameResult?: (result: TResult, timestamp: number) => void
   /**
    * A callback that will be called for every time the
    * Camera pipeline has to drop a {@linkcode Frame}.
@@ -105,6 +137,16 @@ export interface UseFrameOutputProps extends Partial<FrameOutputOptions> {
  * both YUV and RGB, so streaming in {@linkcode TargetVideoPixelFormat | 'yuv'}
  * is more efficient.
  *
+ * @discussion
+ * If your Frame Processor takes longer than a frame interval (e.g. a 40ms
+ * ML model at 30 FPS), set {@linkcode FrameOutputOptions.parallelism | parallelism}
+ * to process multiple {@linkcode Frame}s at the same time. Each of the
+ * {@linkcode CameraFrameOutput.threads | threads} then runs its own copy of
+ * {@linkcode UseFrameOutputProps.onFrame | onFrame(...)}, so it must not rely
+ * on state shared between calls - use
+ * {@linkcode UseFrameOutputProps.onFrameResult | onFrameResult(...)} to receive
+ * results in order instead.
+ *
  * @see {@linkcode TargetVideoPixelFormat}
  * @see {@linkcode VideoPixelFormat}
  *
@@ -119,7 +161,7 @@ export interface UseFrameOutputProps extends Partial<FrameOutputOptions> {
  * })
  * ```
  */
-export function useFrameOutput({
+export function useFrameOutput<TResult = void>({
   targetResolution = CommonResolutions.HD_16_9,
   pixelFormat = 'native',
   dropFramesWhileBusy = true,
@@ -127,9 +169,11 @@ export function useFrameOutput({
   enablePhysicalBufferRotation = false,
   enablePreviewSizedOutputBuffers = false,
   allowDeferredStart = true,
+  parallelism = 1,
   onFrame,
+  onFrameResult,
   onFrameDropped,
-}: UseFrameOutputProps): CameraFrameOutput {
+}: UseFrameOutputProps<TResult>): CameraFrameOutput {
   // 1. `targetResolution` is usually an inline object literal - memoize it by value.
   const memoizedTargetResolution = useMemoizedSize(targetResolution)
 
@@ -144,11 +188,13 @@ export function useFrameOutput({
         enablePreviewSizedOutputBuffers: enablePreviewSizedOutputBuffers,
         allowDeferredStart: allowDeferredStart,
         dropFramesWhileBusy: dropFramesWhileBusy,
+        parallelism: parallelism,
       }),
     [
       memoizedTargetResolution,
       pixelFormat,
       dropFramesWhileBusy,
+      parallelism,
       enableCameraMatrixDelivery,
       enablePhysicalBufferRotation,
       enablePreviewSizedOutputBuffers,
@@ -167,16 +213,23 @@ export function useFrameOutput({
     })
   }, [frameOutput])
 
-  // 4. Create Worklet Runtime for NativeThread
-  const runtime = useMemo(
-    () => VisionCameraWorkletsProxy.createRuntimeForThread(frameOutput.thread),
-    [frameOutput.thread],
+  // 4. Create a Worklet Runtime for each NativeThread
+  const runtimes = useMemo(
+    () =>
+      frameOutput.threads.map((thread) =>
+        VisionCameraWorkletsProxy.createRuntimeForThread(thread),
+      ),
+    [frameOutput],
   )
-  // 5. Update onFrame() callback if it changed
+  // 5. Re-order results of parallel Frames on the JS Thread
+  const onResult = useOrderedFrameResults(frameOutput, onFrameResult)
+  // 6. Update onFrame() callback if it changed
   useEffect(() => {
-    runtime.setOnFrameCallback(frameOutput, onFrame)
-  }, [runtime, frameOutput, onFrame])
+    for (const runtime of runtimes) {
+      runtime.setOnFrameCallback(frameOutput, onFrame, onResult)
+    }
+  }, [runtimes, frameOutput, onFrame, onResult])
 
-  // 6. Return :)
+  // 7. Return :)
   return frameOutput
 }
@@ -31,6 +31,7 @@ export * from './specs/common-types/ExposureMode'
 export * from './specs/common-types/FocusMode'
 export * from './specs/common-types/FocusOptions'
 export * from './specs/common-types/FrameDroppedReason'
+export * from './specs/common-types/FrameOutputStatistics'
 export * from './specs/common-types/ListenerSubscription'
 export * from './specs/common-types/MediaType'
 export * from './specs/common-types/MirrorMode'
@@ -39,6 +40,7 @@ export * from './specs/common-types/OrientationSource'
 export * from './specs/common-types/OutputStreamType'
 export * from './specs/common-types/PermissionStatus'
 export * from './specs/common-types/PhotoContainerFormat'
+export * from './specs/common-types/PixelBufferPlaneLayout'
 export * from './specs/common-types/PixelFormat'
 export * from './specs/common-types/Point'
 export * from './specs/common-types/QualityPrioritization'
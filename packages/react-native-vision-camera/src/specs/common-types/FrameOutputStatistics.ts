@@ -0,0 +1,117 @@
+/**
+ * Statistics of a duration that is measured once per {@linkcode Frame},
+ * over a sliding window of the most recent Frames.
+ *
+ * All durations are in milliseconds.
+ * If no Frame has been measured yet, all values are `0`.
+ */
+export interface FrameDurationStatistics {
+  /**
+   * The number of Frames these statistics were computed from.
+   * This is at most the size of the sliding window (120 Frames).
+   */
+  sampleCount: number
+  /**
+   * The arithmetic mean of all samples.
+   */
+  average: number
+  /**
+   * The standard deviation of all samples.
+   *
+   * For {@linkcode FrameOutputStatistics.frameInterval}, this is the
+   * Frame jitter.
+   */
+  standardDeviation: number
+  /**
+   * The smallest sample.
+   */
+  minimum: number
+  /**
+   * The 50th percentile of all samples.
+   */
+  median: number
+  /**
+   * The 90th percentile of all samples.
+   */
+  p90: number
+  /**
+   * The 99th percentile of all samples.
+   */
+  p99: number
+  /**
+   * The largest sample.
+   */
+  maximum: number
+}
+
+/**
+ * The number of dropped {@linkcode Frame}s, per {@linkcode FrameDroppedReason}.
+ */
+export interface FrameDropStatistics {
+  /**
+   * Frames dropped with reason `'frame-was-late'`.
+   *
+   * This includes Frames that were dropped because the Frame Callback
+   * was still busy with a previous Frame.
+   */
+  frameWasLate: number
+  /**
+   * Frames dropped with reason `'out-of-buffers'`.
+   */
+  outOfBuffers: number
+  /**
+   * Frames dropped with reason `'discontinuity'`.
+   */
+  discontinuity: number
+  /**
+   * Frames dropped with reason `'unknown'`.
+   */
+  unknown: number
+}
+
+/**
+ * Runtime statistics of a {@linkcode CameraFrameOutput} or a
+ * {@linkcode CameraDepthFrameOutput}, to find out where time is spent
+ * in the Frame pipeline.
+ *
+ * @see {@linkcode CameraFrameOutput.getStatistics | CameraFrameOutput.getStatistics()}
+ * @see {@linkcode CameraDepthFrameOutput.getStatistics | CameraDepthFrameOutput.getStatistics()}
+ */
+export interface FrameOutputStatistics {
+  /**
+   * The total number of Frames that were delivered to the Frame Callback.
+   */
+  framesDelivered: number
+  /**
+   * The total number of Frames that were dropped before they
+   * reached the Frame Callback.
+   */
+  framesDropped: number
+  /**
+   * The number of delivered Frames that have not been disposed yet.
+   *
+   * If this keeps growing, Frames are not being disposed, which
+   * eventually stalls the Camera pipeline.
+   */
+  framesInFlight: number
+  /**
+   * The {@linkcode framesDropped | dropped Frames}, by reason.
+   */
+  droppedFrames: FrameDropStatistics
+  /**
+   * The time from when a Frame was captured by the sensor until
+   * it was delivered to the Frame Callback.
+   */
+  deliveryLatency: FrameDurationStatistics
+  /**
+   * The time the Frame Callback took to process a Frame.
+   */
+  callbackDuration: FrameDurationStatistics
+  /**
+   * The time between the capture timestamps of two consecutively
+   * delivered Frames.
+   * Its {@linkcode FrameDurationStatistics.standardDeviation | standardDeviation}
+   * is the Frame jitter.
+   */
+  frameInterval: FrameDurationStatistics
+}
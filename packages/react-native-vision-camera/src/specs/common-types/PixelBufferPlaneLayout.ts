@@ -0,0 +1,39 @@
+/**
+ * Describes where one plane of a {@linkcode Frame}'s pixel buffer lives
+ * inside the `ArrayBuffer` returned by {@linkcode Frame.getPixelBuffer | Frame.getPixelBuffer()}.
+ *
+ * The sample of pixel `(x, y)` of this plane starts at byte
+ * `offset + y * rowStride + x * pixelStride`.
+ *
+ * @see {@linkcode Frame.getPixelBufferLayout | Frame.getPixelBufferLayout()}
+ */
+export interface PixelBufferPlaneLayout {
+  /**
+   * The byte offset of this plane's first sample, relative to the start
+   * of the pixel buffer.
+   */
+  offset: number
+  /**
+   * The distance between the starts of two consecutive rows, in bytes.
+   * This may be larger than {@linkcode width} * {@linkcode pixelStride}
+   * if rows are padded.
+   */
+  rowStride: number
+  /**
+   * The distance between two consecutive samples of one row, in bytes.
+   *
+   * For example, chroma planes of NV12/NV21 Frames interleave U and V,
+   * so their pixel stride is `2`.
+   */
+  pixelStride: number
+  /**
+   * The width of this plane, in samples.
+   * Chroma planes of YUV 4:2:0 Frames are half the Frame's width.
+   */
+  width: number
+  /**
+   * The height of this plane, in rows.
+   * Chroma planes of YUV 4:2:0 Frames are half the Frame's height.
+   */
+  height: number
+}
@@ -1,6 +1,7 @@
 import type { HybridObject } from 'react-native-nitro-modules'
 import type { CameraOrientation } from '../common-types/CameraOrientation'
 import type { NativeBuffer } from '../common-types/NativeBuffer'
+import type { PixelBufferPlaneLayout } from '../common-types/PixelBufferPlaneLayout'
 import type { PixelFormat } from '../common-types/PixelFormat'
 import type { Point } from '../common-types/Point'
 import type {
@@ -294,7 +295,10 @@ export interface Frame
    *
    * @discussion
    * - If the frame is planar (see {@linkcode isPlanar | Frame.isPlanar}, e.g. YUV), this
-   * might or might not contain valid data.
+   * contains all planes, and {@linkcode getPixelBufferLayout | getPixelBufferLayout()}
+   * describes where each plane lives inside it.
+   * On Android, YUV planes are wrapped as-is if they are one contiguous NV12/NV21
+   * allocation, and otherwise copied into tightly packed I420.
    * - If the frame is **not** planar (e.g. RGB), this will contain the entire pixel data.
    *
    * @discussion
@@ -318,6 +322,39 @@ export interface Frame
    */
   getPixelBuffer(): ArrayBuffer
 
+  /**
+   * Describes where each plane lives inside the `ArrayBuffer` returned
+   * by {@linkcode getPixelBuffer | getPixelBuffer()} - its offset,
+   * row stride, pixel stride and size.
+   *
+   * @discussion
+   * YUV Frames always describe their planes in Y, U, V order - even if the U and
+   * V planes are interleaved (NV12/NV21), in which case their
+   * {@linkcode PixelBufferPlaneLayout.pixelStride | pixelStride} is twice the
+   * sample size and their offsets are one sample apart.
+   * Non-planar Frames (e.g. RGB) have a single plane.
+   *
+   * @discussion
+   * If the layout of the Frame's {@linkcode pixelFormat} is unknown, this
+   * returns an empty array (`[]`).
+   *
+   * @throws If this Frame is invalid ({@linkcode isValid}) or
+   * {@linkcode hasPixelBuffer | hasPixelBuffer} is false.
+   *
+   * @example
+   * ```ts
+   * const pixelBuffer = frame.getPixelBuffer()
+   * const [y] = frame.getPixelBufferLayout()
+   * const pixels = new Uint8Array(pixelBuffer)
+   * // Luma of the center pixel:
+   * const centerX = Math.floor(y.width / 2)
+   * const centerY = Math.floor(y.height / 2)
+   * const luma =
+   *   pixels[y.offset + centerY * y.rowStride + centerX * y.pixelStride]
+   * ```
+   */
+  getPixelBufferLayout(): PixelBufferPlaneLayout[]
+
   /**
    * Get a {@linkcode NativeBuffer} that points to
    * this {@linkcode Frame}.
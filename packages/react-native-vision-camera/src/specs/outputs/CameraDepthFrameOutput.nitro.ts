@@ -1,9 +1,13 @@
 import type { Sync } from 'react-native-nitro-modules'
 import type { useDepthOutput } from '../../hooks/useDepthOutput'
 import type { FrameDroppedReason } from '../common-types/FrameDroppedReason'
+import type { FrameOutputStatistics } from '../common-types/FrameOutputStatistics'
 import type { NativeThread } from '../frame-processors/NativeThread.nitro'
 import type { Depth } from '../instances/Depth.nitro'
-import type { FrameOutputOptions } from './CameraFrameOutput.nitro'
+import type {
+  CameraFrameOutput,
+  FrameOutputOptions,
+} from './CameraFrameOutput.nitro'
 import type { CameraOutput } from './CameraOutput.nitro'
 
 /**
@@ -83,4 +87,13 @@ export interface CameraDepthFrameOutput extends CameraOutput {
   setOnDepthFrameDroppedCallback(
     onDepthFrameDropped: ((reason: FrameDroppedReason) => void) | undefined,
   ): void
+  /**
+   * Gets runtime statistics of this {@linkcode CameraDepthFrameOutput},
+   * such as how long {@linkcode Depth} Frames take from the sensor to your
+   * Depth Frame Callback, how long your Depth Frame Callback takes, and
+   * how many Depth Frames were dropped and why.
+   *
+   * @see {@linkcode CameraFrameOutput.getStatistics | CameraFrameOutput.getStatistics()}
+   */
+  getStatistics(): FrameOutputStatistics
 }
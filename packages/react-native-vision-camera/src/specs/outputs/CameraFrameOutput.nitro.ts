@@ -1,6 +1,7 @@
 import type { Sync } from 'react-native-nitro-modules'
 import type { useFrameOutput } from '../../hooks/useFrameOutput'
 import type { FrameDroppedReason } from '../common-types/FrameDroppedReason'
+import type { FrameOutputStatistics } from '../common-types/FrameOutputStatistics'
 import type { NativeBuffer } from '../common-types/NativeBuffer'
 import type { Size } from '../common-types/Size'
 import type { TargetVideoPixelFormat } from '../common-types/VideoPixelFormat'
@@ -160,6 +161,29 @@ export interface FrameOutputOptions {
    * @default true
    */
   dropFramesWhileBusy: boolean
+
+  /**
+   * The number of {@linkcode Frame}s that can be processed in parallel.
+   *
+   * - If set to `1`, all {@linkcode Frame}s are delivered one after
+   * another on a single {@linkcode CameraFrameOutput.thread | thread}.
+   * - If set to a value greater than `1`, the {@linkcode CameraFrameOutput}
+   * creates that many {@linkcode CameraFrameOutput.threads | threads}, and
+   * hands each new {@linkcode Frame} to a thread that is not busy. This
+   * allows a slow Frame Processor (e.g. a 40ms ML model) to keep up with
+   * the Camera's frame rate on multi-core devices, at the cost of holding
+   * more {@linkcode Frame}s in memory at the same time.
+   *
+   * Since {@linkcode Frame}s finish in any order when processed in parallel,
+   * use {@linkcode CameraFrameOutput.markFrameCompleted | markFrameCompleted(...)}
+   * to deliver results in the order the {@linkcode Frame}s were captured.
+   *
+   * If {@linkcode dropFramesWhileBusy} is `true`, a {@linkcode Frame} is only
+   * dropped when all threads are busy.
+   *
+   * @default 1
+   */
+  parallelism?: number
 }
 
 /**
@@ -200,13 +224,28 @@ export interface CameraFrameOutput extends CameraOutput {
    * is running on.
    * This is the thread that {@linkcode setOnFrameCallback | setOnFrameCallback(...)}
    * callbacks run on.
+   *
+   * If {@linkcode FrameOutputOptions.parallelism | parallelism} is greater
+   * than `1`, this is the first of the {@linkcode threads}.
    */
   readonly thread: NativeThread
+  /**
+   * Get all {@linkcode NativeThread}s that this {@linkcode CameraFrameOutput}
+   * delivers {@linkcode Frame}s on - one per
+   * {@linkcode FrameOutputOptions.parallelism | parallelism}.
+   *
+   * Each thread needs its own {@linkcode setOnFrameCallback | setOnFrameCallback(...)}
+   * callback, and only receives {@linkcode Frame}s once it has one.
+   */
+  readonly threads: NativeThread[]
   /**
    * Adds a callback that calls the given {@linkcode onFrame} function
    * every time the Camera produces a new {@linkcode Frame}.
    *
-   * @throws If not called on a Worklet/Runtime running on this {@linkcode thread}.
+   * If {@linkcode FrameOutputOptions.parallelism | parallelism} is greater
+   * than `1`, this only sets the callback of the thread it is called on.
+   *
+   * @throws If not called on a Worklet/Runtime running on one of this output's {@linkcode threads}.
    */
   setOnFrameCallback(onFrame: Sync<(frame: Frame) => boolean> | undefined): void
   /**
@@ -216,4 +255,51 @@ export interface CameraFrameOutput extends CameraOutput {
   setOnFrameDroppedCallback(
     onFrameDropped: ((reason: FrameDroppedReason) => void) | undefined,
   ): void
+  /**
+   * Gets runtime statistics of this {@linkcode CameraFrameOutput}, such as
+   * how long Frames take from the sensor to your Frame Callback, how long
+   * your Frame Callback takes, and how many Frames were dropped and why.
+   *
+   * Statistics are collected continuously at a negligible cost, so this
+   * can also be called periodically in production, e.g. for logging.
+   *
+   * @example
+   * ```ts
+   * const stats = frameOutput.getStatistics()
+   * console.log(`Frame Callback p90: ${stats.callbackDuration.p90}ms`)
+   * console.log(`Jitter: ${stats.frameInterval.standardDeviation}ms`)
+   * ```
+   */
+  getStatistics(): FrameOutputStatistics
+  /**
+   * Marks the result of the {@linkcode Frame} with the given
+   * {@linkcode Frame.timestamp | timestamp} as received, and returns
+   * the latest timestamp up to which the results of all delivered
+   * {@linkcode Frame}s have been received, or `-1` if an earlier
+   * {@linkcode Frame} is still being processed.
+   *
+   * Use this to re-order results of parallel Frame Processors (see
+   * {@linkcode FrameOutputOptions.parallelism | parallelism}): buffer each
+   * result by its timestamp, and release all buffered results up to the
+   * returned timestamp in ascending order.
+   *
+   * A result must be marked for every {@linkcode Frame} that was delivered,
+   * otherwise later results are held back until it falls out of the
+   * re-ordering window.
+   *
+   * @example
+   * ```ts
+   * // Runs on the JS Thread
+   * function onResult(timestamp: number, result: Result) {
+   *   pending.set(timestamp, result)
+   *   const releaseUpTo = frameOutput.markFrameCompleted(timestamp)
+   *   for (const [t, r] of [...pending].sort(([a], [b]) => a - b)) {
+   *     if (t > releaseUpTo) break
+   *     pending.delete(t)
+   *     deliver(r)
+   *   }
+   * }
+   * ```
+   */
+  markFrameCompleted(timestamp: number): number
 }
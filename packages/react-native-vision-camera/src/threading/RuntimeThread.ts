@@ -8,9 +8,18 @@ import type { CameraFrameOutput } from '../specs/outputs/CameraFrameOutput.nitro
  * For example, Worklets.
  */
 export interface RuntimeThread {
+  /**
+   * Sets the Frame Callback of this Runtime's thread.
+   *
+   * If {@linkcode onResult} is set, it will be called on the JS Thread
+   * with the {@linkcode Frame.timestamp | timestamp} and return value of
+   * {@linkcode callback} for every {@linkcode Frame} - even if
+   * {@linkcode callback} threw.
+   */
   setOnFrameCallback(
     frameOutput: CameraFrameOutput,
-    callback: ((frame: Frame) => void) | undefined,
+    callback: ((frame: Frame) => unknown) | undefined,
+    onResult?: (timestamp: number, result: unknown) => void,
   ): void
   setOnDepthFrameCallback(
     depthOutput: CameraDepthFrameOutput,